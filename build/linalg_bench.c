@@ -0,0 +1,8332 @@
+// Generated by `generate_linalg --bench`. Do not edit.
+#include "bench.h"
+#define LINALG_IMPLEMENTATION
+#include "linalg.h"
+
+#define BENCH_BATCH 256
+
+size_t bench_batch = BENCH_BATCH;
+
+vec2f_t bench_vec2f_a[BENCH_BATCH], bench_vec2f_b[BENCH_BATCH], bench_vec2f_c[BENCH_BATCH];
+vec2f_t bench_vec2f_ones[BENCH_BATCH], bench_vec2f_out[BENCH_BATCH];
+float bench_vec2f_scalars[BENCH_BATCH];
+mat2f_t bench_mat2f_A[BENCH_BATCH], bench_mat2f_B[BENCH_BATCH], bench_mat2f_I[BENCH_BATCH], bench_mat2f_out[BENCH_BATCH];
+float bench_vec2f_soa_streams[3][2][BENCH_BATCH];
+vec2f_soa_t bench_vec2f_soa_a, bench_vec2f_soa_b, bench_vec2f_soa_out;
+
+static void bench_vec2f_init(void) {
+    for (size_t i = 0; i < BENCH_BATCH; ++i) {
+        for (size_t k = 0; k < 2; ++k) {
+            bench_vec2f_a[i].e[k] = (float)(1 + (i * 7 + k * 3) % 13);
+            bench_vec2f_b[i].e[k] = (float)(1 + (i * 5 + k * 11) % 13);
+            bench_vec2f_c[i].e[k] = (float)(1 + (i * 3 + k * 7) % 13);
+            bench_vec2f_ones[i].e[k] = 1;
+        }
+        for (size_t k = 0; k < 4; ++k) {
+            bench_mat2f_A[i].e[k] = (float)(1 + (i * 7 + k * 3) % 13);
+            bench_mat2f_B[i].e[k] = (float)(1 + (i * 5 + k * 11) % 13);
+        }
+        bench_mat2f_I[i] = mat2f_I();
+    }
+    bench_vec2f_soa_a.x = bench_vec2f_soa_streams[0][0];
+    bench_vec2f_soa_a.y = bench_vec2f_soa_streams[0][1];
+    bench_vec2f_soa_a.n = BENCH_BATCH;
+    bench_vec2f_soa_b.x = bench_vec2f_soa_streams[1][0];
+    bench_vec2f_soa_b.y = bench_vec2f_soa_streams[1][1];
+    bench_vec2f_soa_b.n = BENCH_BATCH;
+    bench_vec2f_soa_out.x = bench_vec2f_soa_streams[2][0];
+    bench_vec2f_soa_out.y = bench_vec2f_soa_streams[2][1];
+    bench_vec2f_soa_out.n = BENCH_BATCH;
+    vec2f_soa_from_aos(bench_vec2f_soa_a, bench_vec2f_a);
+    vec2f_soa_from_aos(bench_vec2f_soa_b, bench_vec2f_b);
+}
+
+static void bench_vec2f_add(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2f_out[i] = vec2f_add(bench_vec2f_a[i], bench_vec2f_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2f_add_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec2f_add_to(&bench_vec2f_out[i], &bench_vec2f_a[i], &bench_vec2f_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2f_add_assign(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec2f_add_assign(&bench_vec2f_out[i], bench_vec2f_ones[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2f_sub(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2f_out[i] = vec2f_sub(bench_vec2f_a[i], bench_vec2f_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2f_sub_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec2f_sub_to(&bench_vec2f_out[i], &bench_vec2f_a[i], &bench_vec2f_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2f_sub_assign(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec2f_sub_assign(&bench_vec2f_out[i], bench_vec2f_ones[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2f_mul(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2f_out[i] = vec2f_mul(bench_vec2f_a[i], bench_vec2f_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2f_mul_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec2f_mul_to(&bench_vec2f_out[i], &bench_vec2f_a[i], &bench_vec2f_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2f_mul_assign(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec2f_mul_assign(&bench_vec2f_out[i], bench_vec2f_ones[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2f_div(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2f_out[i] = vec2f_div(bench_vec2f_a[i], bench_vec2f_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2f_div_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec2f_div_to(&bench_vec2f_out[i], &bench_vec2f_a[i], &bench_vec2f_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2f_div_assign(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec2f_div_assign(&bench_vec2f_out[i], bench_vec2f_ones[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2f_mod(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2f_out[i] = vec2f_mod(bench_vec2f_a[i], bench_vec2f_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2f_mod_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec2f_mod_to(&bench_vec2f_out[i], &bench_vec2f_a[i], &bench_vec2f_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2f_mod_assign(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec2f_mod_assign(&bench_vec2f_out[i], bench_vec2f_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2f_min(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2f_out[i] = vec2f_min(bench_vec2f_a[i], bench_vec2f_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2f_min_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec2f_min_to(&bench_vec2f_out[i], &bench_vec2f_a[i], &bench_vec2f_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2f_max(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2f_out[i] = vec2f_max(bench_vec2f_a[i], bench_vec2f_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2f_max_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec2f_max_to(&bench_vec2f_out[i], &bench_vec2f_a[i], &bench_vec2f_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2f_floor(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2f_out[i] = vec2f_floor(bench_vec2f_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2f_floor_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec2f_floor_to(&bench_vec2f_out[i], &bench_vec2f_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2f_ceil(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2f_out[i] = vec2f_ceil(bench_vec2f_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2f_ceil_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec2f_ceil_to(&bench_vec2f_out[i], &bench_vec2f_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2f_clamp(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2f_out[i] = vec2f_clamp(bench_vec2f_a[i], bench_vec2f_ones[i], bench_vec2f_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2f_clamp_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec2f_clamp_to(&bench_vec2f_out[i], &bench_vec2f_a[i], &bench_vec2f_ones[i], &bench_vec2f_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2f_abs(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2f_out[i] = vec2f_abs(bench_vec2f_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2f_abs_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec2f_abs_to(&bench_vec2f_out[i], &bench_vec2f_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2f_lerp(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2f_out[i] = vec2f_lerp(bench_vec2f_a[i], bench_vec2f_ones[i], bench_vec2f_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2f_lerp_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec2f_lerp_to(&bench_vec2f_out[i], &bench_vec2f_a[i], &bench_vec2f_ones[i], &bench_vec2f_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2f_sum(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2f_out[i] = vec2f_sum(3, bench_vec2f_a[i], bench_vec2f_ones[i], bench_vec2f_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2f_sum_array(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        bench_vec2f_out[0] = vec2f_sum_array(bench_vec2f_a, bench_batch);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2f_product(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2f_out[i] = vec2f_product(3, bench_vec2f_a[i], bench_vec2f_ones[i], bench_vec2f_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2f_product_array(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        bench_vec2f_out[0] = vec2f_product_array(bench_vec2f_ones, bench_batch);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2f_dot(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2f_scalars[i] = vec2f_dot(bench_vec2f_a[i], bench_vec2f_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2f_sqrlen(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2f_scalars[i] = vec2f_sqrlen(bench_vec2f_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2f_1norm(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2f_scalars[i] = vec2f_1norm(bench_vec2f_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2f_reflect(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2f_out[i] = vec2f_reflect(bench_vec2f_a[i], bench_vec2f_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2f_cross(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2f_scalars[i] = vec2f_cross(bench_vec2f_a[i], bench_vec2f_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2f_2norm(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2f_scalars[i] = vec2f_2norm(bench_vec2f_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2f_eq(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2f_scalars[i] = vec2f_eq(bench_vec2f_a[i], bench_vec2f_b[i], 1e-3);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2f_unit(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2f_out[i] = vec2f_unit(bench_vec2f_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2f_direction(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2f_out[i] = vec2f_direction(bench_vec2f_a[i], bench_vec2f_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2f_angle_between(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2f_scalars[i] = vec2f_angle_between(bench_vec2f_a[i], bench_vec2f_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2f_unit_fast(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2f_out[i] = vec2f_unit_fast(bench_vec2f_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2f_angle_between_fast(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2f_scalars[i] = vec2f_angle_between_fast(bench_vec2f_a[i], bench_vec2f_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat2f_mul(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_mat2f_out[i] = mat2f_mul(bench_mat2f_A[i], bench_mat2f_B[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat2f_mul_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            mat2f_mul_to(&bench_mat2f_out[i], &bench_mat2f_A[i], &bench_mat2f_B[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat2f_nmul(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_mat2f_out[i] = mat2f_nmul(3, bench_mat2f_A[i], bench_mat2f_B[i], bench_mat2f_I[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat2f_mul_chain(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        bench_mat2f_out[0] = mat2f_mul_chain(bench_mat2f_I, bench_batch);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat2f_mul_vec(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2f_out[i] = mat2f_mul_vec(bench_mat2f_A[i], bench_vec2f_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat2f_mul_vec_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            mat2f_mul_vec_to(&bench_vec2f_out[i], &bench_mat2f_A[i], &bench_vec2f_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat2f_hadamard(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_mat2f_out[i] = mat2f_hadamard(bench_mat2f_A[i], bench_mat2f_B[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat2f_hadamard_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            mat2f_hadamard_to(&bench_mat2f_out[i], &bench_mat2f_A[i], &bench_mat2f_B[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat2f_rotate(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_mat2f_out[i] = mat2f_rotate(bench_mat2f_A[i], 0.5);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat2f_rotate_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            mat2f_rotate_to(&bench_mat2f_out[i], &bench_mat2f_A[i], 0.5);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat2f_rotate_fast(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_mat2f_out[i] = mat2f_rotate_fast(bench_mat2f_A[i], 0.5);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat2f_transpose(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_mat2f_out[i] = mat2f_transpose(bench_mat2f_A[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat2f_det(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2f_scalars[i] = mat2f_det(bench_mat2f_A[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat2f_inverse(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_mat2f_out[i] = mat2f_inverse(bench_mat2f_B[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat2f_inverse_array(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        mat2f_inverse_array(bench_mat2f_B, bench_mat2f_out, bench_batch);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat2f_transform_array(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        mat2f_transform_array(&bench_mat2f_A[0], bench_vec2f_a, bench_vec2f_out, bench_batch);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2f_soa_from_aos(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec2f_soa_from_aos(bench_vec2f_soa_out, bench_vec2f_a);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2f_soa_to_aos(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec2f_soa_to_aos(bench_vec2f_out, bench_vec2f_soa_a);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2f_soa_add(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec2f_soa_add(bench_vec2f_soa_out, bench_vec2f_soa_a, bench_vec2f_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2f_soa_sub(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec2f_soa_sub(bench_vec2f_soa_out, bench_vec2f_soa_a, bench_vec2f_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2f_soa_mul(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec2f_soa_mul(bench_vec2f_soa_out, bench_vec2f_soa_a, bench_vec2f_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2f_soa_div(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec2f_soa_div(bench_vec2f_soa_out, bench_vec2f_soa_a, bench_vec2f_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2f_soa_mod(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec2f_soa_mod(bench_vec2f_soa_out, bench_vec2f_soa_a, bench_vec2f_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2f_soa_min(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec2f_soa_min(bench_vec2f_soa_out, bench_vec2f_soa_a, bench_vec2f_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2f_soa_max(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec2f_soa_max(bench_vec2f_soa_out, bench_vec2f_soa_a, bench_vec2f_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2f_soa_floor(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec2f_soa_floor(bench_vec2f_soa_out, bench_vec2f_soa_a);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2f_soa_ceil(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec2f_soa_ceil(bench_vec2f_soa_out, bench_vec2f_soa_a);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2f_soa_clamp(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec2f_soa_clamp(bench_vec2f_soa_out, bench_vec2f_soa_a, bench_vec2f_soa_b, bench_vec2f_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2f_soa_abs(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec2f_soa_abs(bench_vec2f_soa_out, bench_vec2f_soa_a);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2f_soa_lerp(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec2f_soa_lerp(bench_vec2f_soa_out, bench_vec2f_soa_a, bench_vec2f_soa_b, bench_vec2f_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2f_soa_dot(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec2f_soa_dot(bench_vec2f_scalars, bench_vec2f_soa_a, bench_vec2f_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2f_soa_2norm(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec2f_soa_2norm(bench_vec2f_scalars, bench_vec2f_soa_a);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2f_soa_unit(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec2f_soa_unit(bench_vec2f_soa_out, bench_vec2f_soa_a);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat2f_mul_vec_soa(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        mat2f_mul_vec_soa(bench_vec2f_soa_out, bench_mat2f_A[0], bench_vec2f_soa_a);
+        BENCH_CLOBBER();
+    }
+}
+
+vec2d_t bench_vec2d_a[BENCH_BATCH], bench_vec2d_b[BENCH_BATCH], bench_vec2d_c[BENCH_BATCH];
+vec2d_t bench_vec2d_ones[BENCH_BATCH], bench_vec2d_out[BENCH_BATCH];
+double bench_vec2d_scalars[BENCH_BATCH];
+mat2d_t bench_mat2d_A[BENCH_BATCH], bench_mat2d_B[BENCH_BATCH], bench_mat2d_I[BENCH_BATCH], bench_mat2d_out[BENCH_BATCH];
+double bench_vec2d_soa_streams[3][2][BENCH_BATCH];
+vec2d_soa_t bench_vec2d_soa_a, bench_vec2d_soa_b, bench_vec2d_soa_out;
+
+static void bench_vec2d_init(void) {
+    for (size_t i = 0; i < BENCH_BATCH; ++i) {
+        for (size_t k = 0; k < 2; ++k) {
+            bench_vec2d_a[i].e[k] = (double)(1 + (i * 7 + k * 3) % 13);
+            bench_vec2d_b[i].e[k] = (double)(1 + (i * 5 + k * 11) % 13);
+            bench_vec2d_c[i].e[k] = (double)(1 + (i * 3 + k * 7) % 13);
+            bench_vec2d_ones[i].e[k] = 1;
+        }
+        for (size_t k = 0; k < 4; ++k) {
+            bench_mat2d_A[i].e[k] = (double)(1 + (i * 7 + k * 3) % 13);
+            bench_mat2d_B[i].e[k] = (double)(1 + (i * 5 + k * 11) % 13);
+        }
+        bench_mat2d_I[i] = mat2d_I();
+    }
+    bench_vec2d_soa_a.x = bench_vec2d_soa_streams[0][0];
+    bench_vec2d_soa_a.y = bench_vec2d_soa_streams[0][1];
+    bench_vec2d_soa_a.n = BENCH_BATCH;
+    bench_vec2d_soa_b.x = bench_vec2d_soa_streams[1][0];
+    bench_vec2d_soa_b.y = bench_vec2d_soa_streams[1][1];
+    bench_vec2d_soa_b.n = BENCH_BATCH;
+    bench_vec2d_soa_out.x = bench_vec2d_soa_streams[2][0];
+    bench_vec2d_soa_out.y = bench_vec2d_soa_streams[2][1];
+    bench_vec2d_soa_out.n = BENCH_BATCH;
+    vec2d_soa_from_aos(bench_vec2d_soa_a, bench_vec2d_a);
+    vec2d_soa_from_aos(bench_vec2d_soa_b, bench_vec2d_b);
+}
+
+static void bench_vec2d_add(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2d_out[i] = vec2d_add(bench_vec2d_a[i], bench_vec2d_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2d_add_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec2d_add_to(&bench_vec2d_out[i], &bench_vec2d_a[i], &bench_vec2d_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2d_add_assign(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec2d_add_assign(&bench_vec2d_out[i], bench_vec2d_ones[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2d_sub(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2d_out[i] = vec2d_sub(bench_vec2d_a[i], bench_vec2d_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2d_sub_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec2d_sub_to(&bench_vec2d_out[i], &bench_vec2d_a[i], &bench_vec2d_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2d_sub_assign(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec2d_sub_assign(&bench_vec2d_out[i], bench_vec2d_ones[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2d_mul(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2d_out[i] = vec2d_mul(bench_vec2d_a[i], bench_vec2d_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2d_mul_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec2d_mul_to(&bench_vec2d_out[i], &bench_vec2d_a[i], &bench_vec2d_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2d_mul_assign(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec2d_mul_assign(&bench_vec2d_out[i], bench_vec2d_ones[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2d_div(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2d_out[i] = vec2d_div(bench_vec2d_a[i], bench_vec2d_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2d_div_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec2d_div_to(&bench_vec2d_out[i], &bench_vec2d_a[i], &bench_vec2d_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2d_div_assign(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec2d_div_assign(&bench_vec2d_out[i], bench_vec2d_ones[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2d_mod(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2d_out[i] = vec2d_mod(bench_vec2d_a[i], bench_vec2d_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2d_mod_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec2d_mod_to(&bench_vec2d_out[i], &bench_vec2d_a[i], &bench_vec2d_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2d_mod_assign(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec2d_mod_assign(&bench_vec2d_out[i], bench_vec2d_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2d_min(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2d_out[i] = vec2d_min(bench_vec2d_a[i], bench_vec2d_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2d_min_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec2d_min_to(&bench_vec2d_out[i], &bench_vec2d_a[i], &bench_vec2d_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2d_max(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2d_out[i] = vec2d_max(bench_vec2d_a[i], bench_vec2d_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2d_max_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec2d_max_to(&bench_vec2d_out[i], &bench_vec2d_a[i], &bench_vec2d_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2d_floor(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2d_out[i] = vec2d_floor(bench_vec2d_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2d_floor_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec2d_floor_to(&bench_vec2d_out[i], &bench_vec2d_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2d_ceil(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2d_out[i] = vec2d_ceil(bench_vec2d_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2d_ceil_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec2d_ceil_to(&bench_vec2d_out[i], &bench_vec2d_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2d_clamp(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2d_out[i] = vec2d_clamp(bench_vec2d_a[i], bench_vec2d_ones[i], bench_vec2d_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2d_clamp_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec2d_clamp_to(&bench_vec2d_out[i], &bench_vec2d_a[i], &bench_vec2d_ones[i], &bench_vec2d_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2d_abs(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2d_out[i] = vec2d_abs(bench_vec2d_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2d_abs_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec2d_abs_to(&bench_vec2d_out[i], &bench_vec2d_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2d_lerp(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2d_out[i] = vec2d_lerp(bench_vec2d_a[i], bench_vec2d_ones[i], bench_vec2d_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2d_lerp_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec2d_lerp_to(&bench_vec2d_out[i], &bench_vec2d_a[i], &bench_vec2d_ones[i], &bench_vec2d_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2d_sum(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2d_out[i] = vec2d_sum(3, bench_vec2d_a[i], bench_vec2d_ones[i], bench_vec2d_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2d_sum_array(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        bench_vec2d_out[0] = vec2d_sum_array(bench_vec2d_a, bench_batch);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2d_product(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2d_out[i] = vec2d_product(3, bench_vec2d_a[i], bench_vec2d_ones[i], bench_vec2d_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2d_product_array(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        bench_vec2d_out[0] = vec2d_product_array(bench_vec2d_ones, bench_batch);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2d_dot(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2d_scalars[i] = vec2d_dot(bench_vec2d_a[i], bench_vec2d_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2d_sqrlen(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2d_scalars[i] = vec2d_sqrlen(bench_vec2d_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2d_1norm(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2d_scalars[i] = vec2d_1norm(bench_vec2d_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2d_reflect(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2d_out[i] = vec2d_reflect(bench_vec2d_a[i], bench_vec2d_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2d_cross(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2d_scalars[i] = vec2d_cross(bench_vec2d_a[i], bench_vec2d_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2d_2norm(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2d_scalars[i] = vec2d_2norm(bench_vec2d_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2d_eq(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2d_scalars[i] = vec2d_eq(bench_vec2d_a[i], bench_vec2d_b[i], 1e-3);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2d_unit(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2d_out[i] = vec2d_unit(bench_vec2d_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2d_direction(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2d_out[i] = vec2d_direction(bench_vec2d_a[i], bench_vec2d_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2d_angle_between(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2d_scalars[i] = vec2d_angle_between(bench_vec2d_a[i], bench_vec2d_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat2d_mul(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_mat2d_out[i] = mat2d_mul(bench_mat2d_A[i], bench_mat2d_B[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat2d_mul_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            mat2d_mul_to(&bench_mat2d_out[i], &bench_mat2d_A[i], &bench_mat2d_B[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat2d_nmul(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_mat2d_out[i] = mat2d_nmul(3, bench_mat2d_A[i], bench_mat2d_B[i], bench_mat2d_I[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat2d_mul_chain(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        bench_mat2d_out[0] = mat2d_mul_chain(bench_mat2d_I, bench_batch);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat2d_mul_vec(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2d_out[i] = mat2d_mul_vec(bench_mat2d_A[i], bench_vec2d_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat2d_mul_vec_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            mat2d_mul_vec_to(&bench_vec2d_out[i], &bench_mat2d_A[i], &bench_vec2d_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat2d_hadamard(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_mat2d_out[i] = mat2d_hadamard(bench_mat2d_A[i], bench_mat2d_B[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat2d_hadamard_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            mat2d_hadamard_to(&bench_mat2d_out[i], &bench_mat2d_A[i], &bench_mat2d_B[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat2d_rotate(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_mat2d_out[i] = mat2d_rotate(bench_mat2d_A[i], 0.5);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat2d_rotate_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            mat2d_rotate_to(&bench_mat2d_out[i], &bench_mat2d_A[i], 0.5);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat2d_transpose(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_mat2d_out[i] = mat2d_transpose(bench_mat2d_A[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat2d_det(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2d_scalars[i] = mat2d_det(bench_mat2d_A[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat2d_inverse(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_mat2d_out[i] = mat2d_inverse(bench_mat2d_B[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat2d_inverse_array(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        mat2d_inverse_array(bench_mat2d_B, bench_mat2d_out, bench_batch);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat2d_transform_array(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        mat2d_transform_array(&bench_mat2d_A[0], bench_vec2d_a, bench_vec2d_out, bench_batch);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2d_soa_from_aos(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec2d_soa_from_aos(bench_vec2d_soa_out, bench_vec2d_a);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2d_soa_to_aos(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec2d_soa_to_aos(bench_vec2d_out, bench_vec2d_soa_a);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2d_soa_add(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec2d_soa_add(bench_vec2d_soa_out, bench_vec2d_soa_a, bench_vec2d_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2d_soa_sub(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec2d_soa_sub(bench_vec2d_soa_out, bench_vec2d_soa_a, bench_vec2d_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2d_soa_mul(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec2d_soa_mul(bench_vec2d_soa_out, bench_vec2d_soa_a, bench_vec2d_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2d_soa_div(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec2d_soa_div(bench_vec2d_soa_out, bench_vec2d_soa_a, bench_vec2d_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2d_soa_mod(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec2d_soa_mod(bench_vec2d_soa_out, bench_vec2d_soa_a, bench_vec2d_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2d_soa_min(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec2d_soa_min(bench_vec2d_soa_out, bench_vec2d_soa_a, bench_vec2d_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2d_soa_max(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec2d_soa_max(bench_vec2d_soa_out, bench_vec2d_soa_a, bench_vec2d_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2d_soa_floor(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec2d_soa_floor(bench_vec2d_soa_out, bench_vec2d_soa_a);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2d_soa_ceil(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec2d_soa_ceil(bench_vec2d_soa_out, bench_vec2d_soa_a);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2d_soa_clamp(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec2d_soa_clamp(bench_vec2d_soa_out, bench_vec2d_soa_a, bench_vec2d_soa_b, bench_vec2d_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2d_soa_abs(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec2d_soa_abs(bench_vec2d_soa_out, bench_vec2d_soa_a);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2d_soa_lerp(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec2d_soa_lerp(bench_vec2d_soa_out, bench_vec2d_soa_a, bench_vec2d_soa_b, bench_vec2d_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2d_soa_dot(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec2d_soa_dot(bench_vec2d_scalars, bench_vec2d_soa_a, bench_vec2d_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2d_soa_2norm(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec2d_soa_2norm(bench_vec2d_scalars, bench_vec2d_soa_a);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2d_soa_unit(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec2d_soa_unit(bench_vec2d_soa_out, bench_vec2d_soa_a);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat2d_mul_vec_soa(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        mat2d_mul_vec_soa(bench_vec2d_soa_out, bench_mat2d_A[0], bench_vec2d_soa_a);
+        BENCH_CLOBBER();
+    }
+}
+
+vec2i_t bench_vec2i_a[BENCH_BATCH], bench_vec2i_b[BENCH_BATCH], bench_vec2i_c[BENCH_BATCH];
+vec2i_t bench_vec2i_ones[BENCH_BATCH], bench_vec2i_out[BENCH_BATCH];
+int bench_vec2i_scalars[BENCH_BATCH];
+mat2i_t bench_mat2i_A[BENCH_BATCH], bench_mat2i_B[BENCH_BATCH], bench_mat2i_I[BENCH_BATCH], bench_mat2i_out[BENCH_BATCH];
+int bench_vec2i_soa_streams[3][2][BENCH_BATCH];
+vec2i_soa_t bench_vec2i_soa_a, bench_vec2i_soa_b, bench_vec2i_soa_out;
+
+static void bench_vec2i_init(void) {
+    for (size_t i = 0; i < BENCH_BATCH; ++i) {
+        for (size_t k = 0; k < 2; ++k) {
+            bench_vec2i_a[i].e[k] = (int)(1 + (i * 7 + k * 3) % 13);
+            bench_vec2i_b[i].e[k] = (int)(1 + (i * 5 + k * 11) % 13);
+            bench_vec2i_c[i].e[k] = (int)(1 + (i * 3 + k * 7) % 13);
+            bench_vec2i_ones[i].e[k] = 1;
+        }
+        for (size_t k = 0; k < 4; ++k) {
+            bench_mat2i_A[i].e[k] = (int)(1 + (i * 7 + k * 3) % 13);
+            bench_mat2i_B[i].e[k] = (int)(1 + (i * 5 + k * 11) % 13);
+        }
+        bench_mat2i_I[i] = mat2i_I();
+    }
+    bench_vec2i_soa_a.x = bench_vec2i_soa_streams[0][0];
+    bench_vec2i_soa_a.y = bench_vec2i_soa_streams[0][1];
+    bench_vec2i_soa_a.n = BENCH_BATCH;
+    bench_vec2i_soa_b.x = bench_vec2i_soa_streams[1][0];
+    bench_vec2i_soa_b.y = bench_vec2i_soa_streams[1][1];
+    bench_vec2i_soa_b.n = BENCH_BATCH;
+    bench_vec2i_soa_out.x = bench_vec2i_soa_streams[2][0];
+    bench_vec2i_soa_out.y = bench_vec2i_soa_streams[2][1];
+    bench_vec2i_soa_out.n = BENCH_BATCH;
+    vec2i_soa_from_aos(bench_vec2i_soa_a, bench_vec2i_a);
+    vec2i_soa_from_aos(bench_vec2i_soa_b, bench_vec2i_b);
+}
+
+static void bench_vec2i_add(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2i_out[i] = vec2i_add(bench_vec2i_a[i], bench_vec2i_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2i_add_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec2i_add_to(&bench_vec2i_out[i], &bench_vec2i_a[i], &bench_vec2i_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2i_add_assign(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec2i_add_assign(&bench_vec2i_out[i], bench_vec2i_ones[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2i_sub(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2i_out[i] = vec2i_sub(bench_vec2i_a[i], bench_vec2i_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2i_sub_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec2i_sub_to(&bench_vec2i_out[i], &bench_vec2i_a[i], &bench_vec2i_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2i_sub_assign(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec2i_sub_assign(&bench_vec2i_out[i], bench_vec2i_ones[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2i_mul(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2i_out[i] = vec2i_mul(bench_vec2i_a[i], bench_vec2i_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2i_mul_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec2i_mul_to(&bench_vec2i_out[i], &bench_vec2i_a[i], &bench_vec2i_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2i_mul_assign(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec2i_mul_assign(&bench_vec2i_out[i], bench_vec2i_ones[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2i_div(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2i_out[i] = vec2i_div(bench_vec2i_a[i], bench_vec2i_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2i_div_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec2i_div_to(&bench_vec2i_out[i], &bench_vec2i_a[i], &bench_vec2i_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2i_div_assign(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec2i_div_assign(&bench_vec2i_out[i], bench_vec2i_ones[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2i_mod(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2i_out[i] = vec2i_mod(bench_vec2i_a[i], bench_vec2i_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2i_mod_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec2i_mod_to(&bench_vec2i_out[i], &bench_vec2i_a[i], &bench_vec2i_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2i_mod_assign(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec2i_mod_assign(&bench_vec2i_out[i], bench_vec2i_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2i_min(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2i_out[i] = vec2i_min(bench_vec2i_a[i], bench_vec2i_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2i_min_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec2i_min_to(&bench_vec2i_out[i], &bench_vec2i_a[i], &bench_vec2i_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2i_max(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2i_out[i] = vec2i_max(bench_vec2i_a[i], bench_vec2i_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2i_max_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec2i_max_to(&bench_vec2i_out[i], &bench_vec2i_a[i], &bench_vec2i_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2i_clamp(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2i_out[i] = vec2i_clamp(bench_vec2i_a[i], bench_vec2i_ones[i], bench_vec2i_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2i_clamp_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec2i_clamp_to(&bench_vec2i_out[i], &bench_vec2i_a[i], &bench_vec2i_ones[i], &bench_vec2i_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2i_abs(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2i_out[i] = vec2i_abs(bench_vec2i_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2i_abs_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec2i_abs_to(&bench_vec2i_out[i], &bench_vec2i_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2i_sum(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2i_out[i] = vec2i_sum(3, bench_vec2i_a[i], bench_vec2i_ones[i], bench_vec2i_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2i_sum_array(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        bench_vec2i_out[0] = vec2i_sum_array(bench_vec2i_a, bench_batch);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2i_product(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2i_out[i] = vec2i_product(3, bench_vec2i_a[i], bench_vec2i_ones[i], bench_vec2i_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2i_product_array(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        bench_vec2i_out[0] = vec2i_product_array(bench_vec2i_ones, bench_batch);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2i_dot(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2i_scalars[i] = vec2i_dot(bench_vec2i_a[i], bench_vec2i_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2i_sqrlen(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2i_scalars[i] = vec2i_sqrlen(bench_vec2i_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2i_1norm(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2i_scalars[i] = vec2i_1norm(bench_vec2i_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2i_reflect(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2i_out[i] = vec2i_reflect(bench_vec2i_a[i], bench_vec2i_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2i_cross(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2i_scalars[i] = vec2i_cross(bench_vec2i_a[i], bench_vec2i_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat2i_mul(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_mat2i_out[i] = mat2i_mul(bench_mat2i_A[i], bench_mat2i_B[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat2i_mul_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            mat2i_mul_to(&bench_mat2i_out[i], &bench_mat2i_A[i], &bench_mat2i_B[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat2i_nmul(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_mat2i_out[i] = mat2i_nmul(3, bench_mat2i_A[i], bench_mat2i_B[i], bench_mat2i_I[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat2i_mul_chain(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        bench_mat2i_out[0] = mat2i_mul_chain(bench_mat2i_I, bench_batch);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat2i_mul_vec(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2i_out[i] = mat2i_mul_vec(bench_mat2i_A[i], bench_vec2i_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat2i_mul_vec_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            mat2i_mul_vec_to(&bench_vec2i_out[i], &bench_mat2i_A[i], &bench_vec2i_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat2i_hadamard(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_mat2i_out[i] = mat2i_hadamard(bench_mat2i_A[i], bench_mat2i_B[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat2i_hadamard_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            mat2i_hadamard_to(&bench_mat2i_out[i], &bench_mat2i_A[i], &bench_mat2i_B[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat2i_transpose(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_mat2i_out[i] = mat2i_transpose(bench_mat2i_A[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat2i_transform_array(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        mat2i_transform_array(&bench_mat2i_A[0], bench_vec2i_a, bench_vec2i_out, bench_batch);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2i_soa_from_aos(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec2i_soa_from_aos(bench_vec2i_soa_out, bench_vec2i_a);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2i_soa_to_aos(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec2i_soa_to_aos(bench_vec2i_out, bench_vec2i_soa_a);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2i_soa_add(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec2i_soa_add(bench_vec2i_soa_out, bench_vec2i_soa_a, bench_vec2i_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2i_soa_sub(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec2i_soa_sub(bench_vec2i_soa_out, bench_vec2i_soa_a, bench_vec2i_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2i_soa_mul(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec2i_soa_mul(bench_vec2i_soa_out, bench_vec2i_soa_a, bench_vec2i_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2i_soa_div(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec2i_soa_div(bench_vec2i_soa_out, bench_vec2i_soa_a, bench_vec2i_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2i_soa_mod(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec2i_soa_mod(bench_vec2i_soa_out, bench_vec2i_soa_a, bench_vec2i_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2i_soa_min(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec2i_soa_min(bench_vec2i_soa_out, bench_vec2i_soa_a, bench_vec2i_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2i_soa_max(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec2i_soa_max(bench_vec2i_soa_out, bench_vec2i_soa_a, bench_vec2i_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2i_soa_clamp(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec2i_soa_clamp(bench_vec2i_soa_out, bench_vec2i_soa_a, bench_vec2i_soa_b, bench_vec2i_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2i_soa_abs(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec2i_soa_abs(bench_vec2i_soa_out, bench_vec2i_soa_a);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2i_soa_dot(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec2i_soa_dot(bench_vec2i_scalars, bench_vec2i_soa_a, bench_vec2i_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat2i_mul_vec_soa(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        mat2i_mul_vec_soa(bench_vec2i_soa_out, bench_mat2i_A[0], bench_vec2i_soa_a);
+        BENCH_CLOBBER();
+    }
+}
+
+vec2u_t bench_vec2u_a[BENCH_BATCH], bench_vec2u_b[BENCH_BATCH], bench_vec2u_c[BENCH_BATCH];
+vec2u_t bench_vec2u_ones[BENCH_BATCH], bench_vec2u_out[BENCH_BATCH];
+unsigned int bench_vec2u_scalars[BENCH_BATCH];
+mat2u_t bench_mat2u_A[BENCH_BATCH], bench_mat2u_B[BENCH_BATCH], bench_mat2u_I[BENCH_BATCH], bench_mat2u_out[BENCH_BATCH];
+unsigned int bench_vec2u_soa_streams[3][2][BENCH_BATCH];
+vec2u_soa_t bench_vec2u_soa_a, bench_vec2u_soa_b, bench_vec2u_soa_out;
+
+static void bench_vec2u_init(void) {
+    for (size_t i = 0; i < BENCH_BATCH; ++i) {
+        for (size_t k = 0; k < 2; ++k) {
+            bench_vec2u_a[i].e[k] = (unsigned int)(1 + (i * 7 + k * 3) % 13);
+            bench_vec2u_b[i].e[k] = (unsigned int)(1 + (i * 5 + k * 11) % 13);
+            bench_vec2u_c[i].e[k] = (unsigned int)(1 + (i * 3 + k * 7) % 13);
+            bench_vec2u_ones[i].e[k] = 1;
+        }
+        for (size_t k = 0; k < 4; ++k) {
+            bench_mat2u_A[i].e[k] = (unsigned int)(1 + (i * 7 + k * 3) % 13);
+            bench_mat2u_B[i].e[k] = (unsigned int)(1 + (i * 5 + k * 11) % 13);
+        }
+        bench_mat2u_I[i] = mat2u_I();
+    }
+    bench_vec2u_soa_a.x = bench_vec2u_soa_streams[0][0];
+    bench_vec2u_soa_a.y = bench_vec2u_soa_streams[0][1];
+    bench_vec2u_soa_a.n = BENCH_BATCH;
+    bench_vec2u_soa_b.x = bench_vec2u_soa_streams[1][0];
+    bench_vec2u_soa_b.y = bench_vec2u_soa_streams[1][1];
+    bench_vec2u_soa_b.n = BENCH_BATCH;
+    bench_vec2u_soa_out.x = bench_vec2u_soa_streams[2][0];
+    bench_vec2u_soa_out.y = bench_vec2u_soa_streams[2][1];
+    bench_vec2u_soa_out.n = BENCH_BATCH;
+    vec2u_soa_from_aos(bench_vec2u_soa_a, bench_vec2u_a);
+    vec2u_soa_from_aos(bench_vec2u_soa_b, bench_vec2u_b);
+}
+
+static void bench_vec2u_add(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2u_out[i] = vec2u_add(bench_vec2u_a[i], bench_vec2u_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2u_add_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec2u_add_to(&bench_vec2u_out[i], &bench_vec2u_a[i], &bench_vec2u_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2u_add_assign(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec2u_add_assign(&bench_vec2u_out[i], bench_vec2u_ones[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2u_sub(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2u_out[i] = vec2u_sub(bench_vec2u_a[i], bench_vec2u_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2u_sub_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec2u_sub_to(&bench_vec2u_out[i], &bench_vec2u_a[i], &bench_vec2u_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2u_sub_assign(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec2u_sub_assign(&bench_vec2u_out[i], bench_vec2u_ones[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2u_mul(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2u_out[i] = vec2u_mul(bench_vec2u_a[i], bench_vec2u_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2u_mul_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec2u_mul_to(&bench_vec2u_out[i], &bench_vec2u_a[i], &bench_vec2u_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2u_mul_assign(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec2u_mul_assign(&bench_vec2u_out[i], bench_vec2u_ones[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2u_div(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2u_out[i] = vec2u_div(bench_vec2u_a[i], bench_vec2u_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2u_div_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec2u_div_to(&bench_vec2u_out[i], &bench_vec2u_a[i], &bench_vec2u_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2u_div_assign(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec2u_div_assign(&bench_vec2u_out[i], bench_vec2u_ones[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2u_mod(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2u_out[i] = vec2u_mod(bench_vec2u_a[i], bench_vec2u_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2u_mod_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec2u_mod_to(&bench_vec2u_out[i], &bench_vec2u_a[i], &bench_vec2u_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2u_mod_assign(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec2u_mod_assign(&bench_vec2u_out[i], bench_vec2u_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2u_min(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2u_out[i] = vec2u_min(bench_vec2u_a[i], bench_vec2u_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2u_min_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec2u_min_to(&bench_vec2u_out[i], &bench_vec2u_a[i], &bench_vec2u_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2u_max(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2u_out[i] = vec2u_max(bench_vec2u_a[i], bench_vec2u_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2u_max_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec2u_max_to(&bench_vec2u_out[i], &bench_vec2u_a[i], &bench_vec2u_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2u_clamp(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2u_out[i] = vec2u_clamp(bench_vec2u_a[i], bench_vec2u_ones[i], bench_vec2u_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2u_clamp_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec2u_clamp_to(&bench_vec2u_out[i], &bench_vec2u_a[i], &bench_vec2u_ones[i], &bench_vec2u_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2u_sum(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2u_out[i] = vec2u_sum(3, bench_vec2u_a[i], bench_vec2u_ones[i], bench_vec2u_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2u_sum_array(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        bench_vec2u_out[0] = vec2u_sum_array(bench_vec2u_a, bench_batch);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2u_product(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2u_out[i] = vec2u_product(3, bench_vec2u_a[i], bench_vec2u_ones[i], bench_vec2u_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2u_product_array(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        bench_vec2u_out[0] = vec2u_product_array(bench_vec2u_ones, bench_batch);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2u_dot(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2u_scalars[i] = vec2u_dot(bench_vec2u_a[i], bench_vec2u_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2u_sqrlen(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2u_scalars[i] = vec2u_sqrlen(bench_vec2u_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2u_1norm(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2u_scalars[i] = vec2u_1norm(bench_vec2u_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2u_reflect(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2u_out[i] = vec2u_reflect(bench_vec2u_a[i], bench_vec2u_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2u_cross(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2u_scalars[i] = vec2u_cross(bench_vec2u_a[i], bench_vec2u_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat2u_mul(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_mat2u_out[i] = mat2u_mul(bench_mat2u_A[i], bench_mat2u_B[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat2u_mul_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            mat2u_mul_to(&bench_mat2u_out[i], &bench_mat2u_A[i], &bench_mat2u_B[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat2u_nmul(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_mat2u_out[i] = mat2u_nmul(3, bench_mat2u_A[i], bench_mat2u_B[i], bench_mat2u_I[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat2u_mul_chain(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        bench_mat2u_out[0] = mat2u_mul_chain(bench_mat2u_I, bench_batch);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat2u_mul_vec(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec2u_out[i] = mat2u_mul_vec(bench_mat2u_A[i], bench_vec2u_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat2u_mul_vec_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            mat2u_mul_vec_to(&bench_vec2u_out[i], &bench_mat2u_A[i], &bench_vec2u_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat2u_hadamard(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_mat2u_out[i] = mat2u_hadamard(bench_mat2u_A[i], bench_mat2u_B[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat2u_hadamard_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            mat2u_hadamard_to(&bench_mat2u_out[i], &bench_mat2u_A[i], &bench_mat2u_B[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat2u_transpose(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_mat2u_out[i] = mat2u_transpose(bench_mat2u_A[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat2u_transform_array(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        mat2u_transform_array(&bench_mat2u_A[0], bench_vec2u_a, bench_vec2u_out, bench_batch);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2u_soa_from_aos(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec2u_soa_from_aos(bench_vec2u_soa_out, bench_vec2u_a);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2u_soa_to_aos(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec2u_soa_to_aos(bench_vec2u_out, bench_vec2u_soa_a);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2u_soa_add(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec2u_soa_add(bench_vec2u_soa_out, bench_vec2u_soa_a, bench_vec2u_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2u_soa_sub(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec2u_soa_sub(bench_vec2u_soa_out, bench_vec2u_soa_a, bench_vec2u_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2u_soa_mul(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec2u_soa_mul(bench_vec2u_soa_out, bench_vec2u_soa_a, bench_vec2u_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2u_soa_div(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec2u_soa_div(bench_vec2u_soa_out, bench_vec2u_soa_a, bench_vec2u_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2u_soa_mod(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec2u_soa_mod(bench_vec2u_soa_out, bench_vec2u_soa_a, bench_vec2u_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2u_soa_min(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec2u_soa_min(bench_vec2u_soa_out, bench_vec2u_soa_a, bench_vec2u_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2u_soa_max(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec2u_soa_max(bench_vec2u_soa_out, bench_vec2u_soa_a, bench_vec2u_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2u_soa_clamp(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec2u_soa_clamp(bench_vec2u_soa_out, bench_vec2u_soa_a, bench_vec2u_soa_b, bench_vec2u_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2u_soa_dot(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec2u_soa_dot(bench_vec2u_scalars, bench_vec2u_soa_a, bench_vec2u_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat2u_mul_vec_soa(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        mat2u_mul_vec_soa(bench_vec2u_soa_out, bench_mat2u_A[0], bench_vec2u_soa_a);
+        BENCH_CLOBBER();
+    }
+}
+
+vec2h_t bench_vec2h_a[BENCH_BATCH], bench_vec2h_out[BENCH_BATCH];
+static void bench_vec2h_init(void) {
+    vec2h_from_vec2f_array(bench_vec2f_a, bench_vec2h_a, BENCH_BATCH);
+}
+
+static void bench_vec2h_to_vec2f_array(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec2h_to_vec2f_array(bench_vec2h_a, bench_vec2f_out, bench_batch);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec2h_from_vec2f_array(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec2h_from_vec2f_array(bench_vec2f_a, bench_vec2h_out, bench_batch);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat2f_transform_array_h(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        mat2f_transform_array_h(&bench_mat2f_A[0], bench_vec2h_a, bench_vec2h_out, bench_batch);
+        BENCH_CLOBBER();
+    }
+}
+
+vec3f_t bench_vec3f_a[BENCH_BATCH], bench_vec3f_b[BENCH_BATCH], bench_vec3f_c[BENCH_BATCH];
+vec3f_t bench_vec3f_ones[BENCH_BATCH], bench_vec3f_out[BENCH_BATCH];
+float bench_vec3f_scalars[BENCH_BATCH];
+mat3f_t bench_mat3f_A[BENCH_BATCH], bench_mat3f_B[BENCH_BATCH], bench_mat3f_I[BENCH_BATCH], bench_mat3f_out[BENCH_BATCH];
+float bench_vec3f_soa_streams[3][3][BENCH_BATCH];
+vec3f_soa_t bench_vec3f_soa_a, bench_vec3f_soa_b, bench_vec3f_soa_out;
+
+static void bench_vec3f_init(void) {
+    for (size_t i = 0; i < BENCH_BATCH; ++i) {
+        for (size_t k = 0; k < 3; ++k) {
+            bench_vec3f_a[i].e[k] = (float)(1 + (i * 7 + k * 3) % 13);
+            bench_vec3f_b[i].e[k] = (float)(1 + (i * 5 + k * 11) % 13);
+            bench_vec3f_c[i].e[k] = (float)(1 + (i * 3 + k * 7) % 13);
+            bench_vec3f_ones[i].e[k] = 1;
+        }
+        for (size_t k = 0; k < 9; ++k) {
+            bench_mat3f_A[i].e[k] = (float)(1 + (i * 7 + k * 3) % 13);
+            bench_mat3f_B[i].e[k] = (float)(1 + (i * 5 + k * 11) % 13);
+        }
+        bench_mat3f_I[i] = mat3f_I();
+    }
+    bench_vec3f_soa_a.x = bench_vec3f_soa_streams[0][0];
+    bench_vec3f_soa_a.y = bench_vec3f_soa_streams[0][1];
+    bench_vec3f_soa_a.z = bench_vec3f_soa_streams[0][2];
+    bench_vec3f_soa_a.n = BENCH_BATCH;
+    bench_vec3f_soa_b.x = bench_vec3f_soa_streams[1][0];
+    bench_vec3f_soa_b.y = bench_vec3f_soa_streams[1][1];
+    bench_vec3f_soa_b.z = bench_vec3f_soa_streams[1][2];
+    bench_vec3f_soa_b.n = BENCH_BATCH;
+    bench_vec3f_soa_out.x = bench_vec3f_soa_streams[2][0];
+    bench_vec3f_soa_out.y = bench_vec3f_soa_streams[2][1];
+    bench_vec3f_soa_out.z = bench_vec3f_soa_streams[2][2];
+    bench_vec3f_soa_out.n = BENCH_BATCH;
+    vec3f_soa_from_aos(bench_vec3f_soa_a, bench_vec3f_a);
+    vec3f_soa_from_aos(bench_vec3f_soa_b, bench_vec3f_b);
+}
+
+static void bench_vec3f_add(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3f_out[i] = vec3f_add(bench_vec3f_a[i], bench_vec3f_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3f_add_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec3f_add_to(&bench_vec3f_out[i], &bench_vec3f_a[i], &bench_vec3f_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3f_add_assign(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec3f_add_assign(&bench_vec3f_out[i], bench_vec3f_ones[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3f_sub(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3f_out[i] = vec3f_sub(bench_vec3f_a[i], bench_vec3f_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3f_sub_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec3f_sub_to(&bench_vec3f_out[i], &bench_vec3f_a[i], &bench_vec3f_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3f_sub_assign(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec3f_sub_assign(&bench_vec3f_out[i], bench_vec3f_ones[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3f_mul(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3f_out[i] = vec3f_mul(bench_vec3f_a[i], bench_vec3f_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3f_mul_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec3f_mul_to(&bench_vec3f_out[i], &bench_vec3f_a[i], &bench_vec3f_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3f_mul_assign(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec3f_mul_assign(&bench_vec3f_out[i], bench_vec3f_ones[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3f_div(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3f_out[i] = vec3f_div(bench_vec3f_a[i], bench_vec3f_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3f_div_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec3f_div_to(&bench_vec3f_out[i], &bench_vec3f_a[i], &bench_vec3f_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3f_div_assign(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec3f_div_assign(&bench_vec3f_out[i], bench_vec3f_ones[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3f_mod(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3f_out[i] = vec3f_mod(bench_vec3f_a[i], bench_vec3f_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3f_mod_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec3f_mod_to(&bench_vec3f_out[i], &bench_vec3f_a[i], &bench_vec3f_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3f_mod_assign(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec3f_mod_assign(&bench_vec3f_out[i], bench_vec3f_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3f_min(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3f_out[i] = vec3f_min(bench_vec3f_a[i], bench_vec3f_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3f_min_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec3f_min_to(&bench_vec3f_out[i], &bench_vec3f_a[i], &bench_vec3f_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3f_max(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3f_out[i] = vec3f_max(bench_vec3f_a[i], bench_vec3f_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3f_max_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec3f_max_to(&bench_vec3f_out[i], &bench_vec3f_a[i], &bench_vec3f_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3f_floor(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3f_out[i] = vec3f_floor(bench_vec3f_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3f_floor_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec3f_floor_to(&bench_vec3f_out[i], &bench_vec3f_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3f_ceil(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3f_out[i] = vec3f_ceil(bench_vec3f_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3f_ceil_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec3f_ceil_to(&bench_vec3f_out[i], &bench_vec3f_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3f_clamp(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3f_out[i] = vec3f_clamp(bench_vec3f_a[i], bench_vec3f_ones[i], bench_vec3f_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3f_clamp_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec3f_clamp_to(&bench_vec3f_out[i], &bench_vec3f_a[i], &bench_vec3f_ones[i], &bench_vec3f_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3f_abs(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3f_out[i] = vec3f_abs(bench_vec3f_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3f_abs_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec3f_abs_to(&bench_vec3f_out[i], &bench_vec3f_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3f_lerp(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3f_out[i] = vec3f_lerp(bench_vec3f_a[i], bench_vec3f_ones[i], bench_vec3f_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3f_lerp_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec3f_lerp_to(&bench_vec3f_out[i], &bench_vec3f_a[i], &bench_vec3f_ones[i], &bench_vec3f_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3f_sum(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3f_out[i] = vec3f_sum(3, bench_vec3f_a[i], bench_vec3f_ones[i], bench_vec3f_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3f_sum_array(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        bench_vec3f_out[0] = vec3f_sum_array(bench_vec3f_a, bench_batch);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3f_product(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3f_out[i] = vec3f_product(3, bench_vec3f_a[i], bench_vec3f_ones[i], bench_vec3f_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3f_product_array(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        bench_vec3f_out[0] = vec3f_product_array(bench_vec3f_ones, bench_batch);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3f_dot(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3f_scalars[i] = vec3f_dot(bench_vec3f_a[i], bench_vec3f_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3f_sqrlen(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3f_scalars[i] = vec3f_sqrlen(bench_vec3f_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3f_1norm(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3f_scalars[i] = vec3f_1norm(bench_vec3f_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3f_reflect(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3f_out[i] = vec3f_reflect(bench_vec3f_a[i], bench_vec3f_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3f_cross(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3f_out[i] = vec3f_cross(bench_vec3f_a[i], bench_vec3f_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3f_2norm(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3f_scalars[i] = vec3f_2norm(bench_vec3f_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3f_eq(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3f_scalars[i] = vec3f_eq(bench_vec3f_a[i], bench_vec3f_b[i], 1e-3);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3f_unit(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3f_out[i] = vec3f_unit(bench_vec3f_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3f_direction(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3f_out[i] = vec3f_direction(bench_vec3f_a[i], bench_vec3f_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3f_angle_between(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3f_scalars[i] = vec3f_angle_between(bench_vec3f_a[i], bench_vec3f_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3f_unit_fast(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3f_out[i] = vec3f_unit_fast(bench_vec3f_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3f_angle_between_fast(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3f_scalars[i] = vec3f_angle_between_fast(bench_vec3f_a[i], bench_vec3f_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat3f_mul(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_mat3f_out[i] = mat3f_mul(bench_mat3f_A[i], bench_mat3f_B[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat3f_mul_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            mat3f_mul_to(&bench_mat3f_out[i], &bench_mat3f_A[i], &bench_mat3f_B[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat3f_nmul(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_mat3f_out[i] = mat3f_nmul(3, bench_mat3f_A[i], bench_mat3f_B[i], bench_mat3f_I[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat3f_mul_chain(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        bench_mat3f_out[0] = mat3f_mul_chain(bench_mat3f_I, bench_batch);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat3f_mul_vec(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3f_out[i] = mat3f_mul_vec(bench_mat3f_A[i], bench_vec3f_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat3f_mul_vec_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            mat3f_mul_vec_to(&bench_vec3f_out[i], &bench_mat3f_A[i], &bench_vec3f_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat3f_hadamard(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_mat3f_out[i] = mat3f_hadamard(bench_mat3f_A[i], bench_mat3f_B[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat3f_hadamard_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            mat3f_hadamard_to(&bench_mat3f_out[i], &bench_mat3f_A[i], &bench_mat3f_B[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat3f_rotate(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_mat3f_out[i] = mat3f_rotate(bench_mat3f_A[i], AXIS_Z, 0.5);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat3f_rotate_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            mat3f_rotate_to(&bench_mat3f_out[i], &bench_mat3f_A[i], AXIS_Z, 0.5);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat3f_rotate_fast(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_mat3f_out[i] = mat3f_rotate_fast(bench_mat3f_A[i], AXIS_Z, 0.5);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat3f_transpose(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_mat3f_out[i] = mat3f_transpose(bench_mat3f_A[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat3f_det(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3f_scalars[i] = mat3f_det(bench_mat3f_A[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat3f_inverse(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_mat3f_out[i] = mat3f_inverse(bench_mat3f_B[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat3f_inverse_array(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        mat3f_inverse_array(bench_mat3f_B, bench_mat3f_out, bench_batch);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat3f_transform_array(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        mat3f_transform_array(&bench_mat3f_A[0], bench_vec3f_a, bench_vec3f_out, bench_batch);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3f_soa_from_aos(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec3f_soa_from_aos(bench_vec3f_soa_out, bench_vec3f_a);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3f_soa_to_aos(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec3f_soa_to_aos(bench_vec3f_out, bench_vec3f_soa_a);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3f_soa_add(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec3f_soa_add(bench_vec3f_soa_out, bench_vec3f_soa_a, bench_vec3f_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3f_soa_sub(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec3f_soa_sub(bench_vec3f_soa_out, bench_vec3f_soa_a, bench_vec3f_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3f_soa_mul(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec3f_soa_mul(bench_vec3f_soa_out, bench_vec3f_soa_a, bench_vec3f_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3f_soa_div(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec3f_soa_div(bench_vec3f_soa_out, bench_vec3f_soa_a, bench_vec3f_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3f_soa_mod(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec3f_soa_mod(bench_vec3f_soa_out, bench_vec3f_soa_a, bench_vec3f_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3f_soa_min(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec3f_soa_min(bench_vec3f_soa_out, bench_vec3f_soa_a, bench_vec3f_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3f_soa_max(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec3f_soa_max(bench_vec3f_soa_out, bench_vec3f_soa_a, bench_vec3f_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3f_soa_floor(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec3f_soa_floor(bench_vec3f_soa_out, bench_vec3f_soa_a);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3f_soa_ceil(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec3f_soa_ceil(bench_vec3f_soa_out, bench_vec3f_soa_a);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3f_soa_clamp(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec3f_soa_clamp(bench_vec3f_soa_out, bench_vec3f_soa_a, bench_vec3f_soa_b, bench_vec3f_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3f_soa_abs(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec3f_soa_abs(bench_vec3f_soa_out, bench_vec3f_soa_a);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3f_soa_lerp(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec3f_soa_lerp(bench_vec3f_soa_out, bench_vec3f_soa_a, bench_vec3f_soa_b, bench_vec3f_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3f_soa_dot(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec3f_soa_dot(bench_vec3f_scalars, bench_vec3f_soa_a, bench_vec3f_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3f_soa_2norm(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec3f_soa_2norm(bench_vec3f_scalars, bench_vec3f_soa_a);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3f_soa_unit(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec3f_soa_unit(bench_vec3f_soa_out, bench_vec3f_soa_a);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat3f_mul_vec_soa(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        mat3f_mul_vec_soa(bench_vec3f_soa_out, bench_mat3f_A[0], bench_vec3f_soa_a);
+        BENCH_CLOBBER();
+    }
+}
+
+vec3d_t bench_vec3d_a[BENCH_BATCH], bench_vec3d_b[BENCH_BATCH], bench_vec3d_c[BENCH_BATCH];
+vec3d_t bench_vec3d_ones[BENCH_BATCH], bench_vec3d_out[BENCH_BATCH];
+double bench_vec3d_scalars[BENCH_BATCH];
+mat3d_t bench_mat3d_A[BENCH_BATCH], bench_mat3d_B[BENCH_BATCH], bench_mat3d_I[BENCH_BATCH], bench_mat3d_out[BENCH_BATCH];
+double bench_vec3d_soa_streams[3][3][BENCH_BATCH];
+vec3d_soa_t bench_vec3d_soa_a, bench_vec3d_soa_b, bench_vec3d_soa_out;
+
+static void bench_vec3d_init(void) {
+    for (size_t i = 0; i < BENCH_BATCH; ++i) {
+        for (size_t k = 0; k < 3; ++k) {
+            bench_vec3d_a[i].e[k] = (double)(1 + (i * 7 + k * 3) % 13);
+            bench_vec3d_b[i].e[k] = (double)(1 + (i * 5 + k * 11) % 13);
+            bench_vec3d_c[i].e[k] = (double)(1 + (i * 3 + k * 7) % 13);
+            bench_vec3d_ones[i].e[k] = 1;
+        }
+        for (size_t k = 0; k < 9; ++k) {
+            bench_mat3d_A[i].e[k] = (double)(1 + (i * 7 + k * 3) % 13);
+            bench_mat3d_B[i].e[k] = (double)(1 + (i * 5 + k * 11) % 13);
+        }
+        bench_mat3d_I[i] = mat3d_I();
+    }
+    bench_vec3d_soa_a.x = bench_vec3d_soa_streams[0][0];
+    bench_vec3d_soa_a.y = bench_vec3d_soa_streams[0][1];
+    bench_vec3d_soa_a.z = bench_vec3d_soa_streams[0][2];
+    bench_vec3d_soa_a.n = BENCH_BATCH;
+    bench_vec3d_soa_b.x = bench_vec3d_soa_streams[1][0];
+    bench_vec3d_soa_b.y = bench_vec3d_soa_streams[1][1];
+    bench_vec3d_soa_b.z = bench_vec3d_soa_streams[1][2];
+    bench_vec3d_soa_b.n = BENCH_BATCH;
+    bench_vec3d_soa_out.x = bench_vec3d_soa_streams[2][0];
+    bench_vec3d_soa_out.y = bench_vec3d_soa_streams[2][1];
+    bench_vec3d_soa_out.z = bench_vec3d_soa_streams[2][2];
+    bench_vec3d_soa_out.n = BENCH_BATCH;
+    vec3d_soa_from_aos(bench_vec3d_soa_a, bench_vec3d_a);
+    vec3d_soa_from_aos(bench_vec3d_soa_b, bench_vec3d_b);
+}
+
+static void bench_vec3d_add(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3d_out[i] = vec3d_add(bench_vec3d_a[i], bench_vec3d_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3d_add_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec3d_add_to(&bench_vec3d_out[i], &bench_vec3d_a[i], &bench_vec3d_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3d_add_assign(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec3d_add_assign(&bench_vec3d_out[i], bench_vec3d_ones[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3d_sub(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3d_out[i] = vec3d_sub(bench_vec3d_a[i], bench_vec3d_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3d_sub_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec3d_sub_to(&bench_vec3d_out[i], &bench_vec3d_a[i], &bench_vec3d_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3d_sub_assign(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec3d_sub_assign(&bench_vec3d_out[i], bench_vec3d_ones[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3d_mul(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3d_out[i] = vec3d_mul(bench_vec3d_a[i], bench_vec3d_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3d_mul_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec3d_mul_to(&bench_vec3d_out[i], &bench_vec3d_a[i], &bench_vec3d_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3d_mul_assign(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec3d_mul_assign(&bench_vec3d_out[i], bench_vec3d_ones[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3d_div(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3d_out[i] = vec3d_div(bench_vec3d_a[i], bench_vec3d_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3d_div_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec3d_div_to(&bench_vec3d_out[i], &bench_vec3d_a[i], &bench_vec3d_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3d_div_assign(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec3d_div_assign(&bench_vec3d_out[i], bench_vec3d_ones[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3d_mod(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3d_out[i] = vec3d_mod(bench_vec3d_a[i], bench_vec3d_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3d_mod_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec3d_mod_to(&bench_vec3d_out[i], &bench_vec3d_a[i], &bench_vec3d_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3d_mod_assign(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec3d_mod_assign(&bench_vec3d_out[i], bench_vec3d_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3d_min(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3d_out[i] = vec3d_min(bench_vec3d_a[i], bench_vec3d_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3d_min_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec3d_min_to(&bench_vec3d_out[i], &bench_vec3d_a[i], &bench_vec3d_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3d_max(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3d_out[i] = vec3d_max(bench_vec3d_a[i], bench_vec3d_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3d_max_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec3d_max_to(&bench_vec3d_out[i], &bench_vec3d_a[i], &bench_vec3d_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3d_floor(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3d_out[i] = vec3d_floor(bench_vec3d_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3d_floor_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec3d_floor_to(&bench_vec3d_out[i], &bench_vec3d_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3d_ceil(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3d_out[i] = vec3d_ceil(bench_vec3d_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3d_ceil_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec3d_ceil_to(&bench_vec3d_out[i], &bench_vec3d_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3d_clamp(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3d_out[i] = vec3d_clamp(bench_vec3d_a[i], bench_vec3d_ones[i], bench_vec3d_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3d_clamp_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec3d_clamp_to(&bench_vec3d_out[i], &bench_vec3d_a[i], &bench_vec3d_ones[i], &bench_vec3d_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3d_abs(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3d_out[i] = vec3d_abs(bench_vec3d_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3d_abs_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec3d_abs_to(&bench_vec3d_out[i], &bench_vec3d_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3d_lerp(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3d_out[i] = vec3d_lerp(bench_vec3d_a[i], bench_vec3d_ones[i], bench_vec3d_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3d_lerp_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec3d_lerp_to(&bench_vec3d_out[i], &bench_vec3d_a[i], &bench_vec3d_ones[i], &bench_vec3d_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3d_sum(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3d_out[i] = vec3d_sum(3, bench_vec3d_a[i], bench_vec3d_ones[i], bench_vec3d_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3d_sum_array(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        bench_vec3d_out[0] = vec3d_sum_array(bench_vec3d_a, bench_batch);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3d_product(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3d_out[i] = vec3d_product(3, bench_vec3d_a[i], bench_vec3d_ones[i], bench_vec3d_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3d_product_array(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        bench_vec3d_out[0] = vec3d_product_array(bench_vec3d_ones, bench_batch);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3d_dot(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3d_scalars[i] = vec3d_dot(bench_vec3d_a[i], bench_vec3d_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3d_sqrlen(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3d_scalars[i] = vec3d_sqrlen(bench_vec3d_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3d_1norm(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3d_scalars[i] = vec3d_1norm(bench_vec3d_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3d_reflect(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3d_out[i] = vec3d_reflect(bench_vec3d_a[i], bench_vec3d_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3d_cross(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3d_out[i] = vec3d_cross(bench_vec3d_a[i], bench_vec3d_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3d_2norm(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3d_scalars[i] = vec3d_2norm(bench_vec3d_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3d_eq(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3d_scalars[i] = vec3d_eq(bench_vec3d_a[i], bench_vec3d_b[i], 1e-3);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3d_unit(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3d_out[i] = vec3d_unit(bench_vec3d_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3d_direction(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3d_out[i] = vec3d_direction(bench_vec3d_a[i], bench_vec3d_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3d_angle_between(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3d_scalars[i] = vec3d_angle_between(bench_vec3d_a[i], bench_vec3d_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat3d_mul(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_mat3d_out[i] = mat3d_mul(bench_mat3d_A[i], bench_mat3d_B[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat3d_mul_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            mat3d_mul_to(&bench_mat3d_out[i], &bench_mat3d_A[i], &bench_mat3d_B[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat3d_nmul(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_mat3d_out[i] = mat3d_nmul(3, bench_mat3d_A[i], bench_mat3d_B[i], bench_mat3d_I[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat3d_mul_chain(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        bench_mat3d_out[0] = mat3d_mul_chain(bench_mat3d_I, bench_batch);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat3d_mul_vec(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3d_out[i] = mat3d_mul_vec(bench_mat3d_A[i], bench_vec3d_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat3d_mul_vec_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            mat3d_mul_vec_to(&bench_vec3d_out[i], &bench_mat3d_A[i], &bench_vec3d_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat3d_hadamard(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_mat3d_out[i] = mat3d_hadamard(bench_mat3d_A[i], bench_mat3d_B[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat3d_hadamard_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            mat3d_hadamard_to(&bench_mat3d_out[i], &bench_mat3d_A[i], &bench_mat3d_B[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat3d_rotate(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_mat3d_out[i] = mat3d_rotate(bench_mat3d_A[i], AXIS_Z, 0.5);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat3d_rotate_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            mat3d_rotate_to(&bench_mat3d_out[i], &bench_mat3d_A[i], AXIS_Z, 0.5);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat3d_transpose(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_mat3d_out[i] = mat3d_transpose(bench_mat3d_A[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat3d_det(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3d_scalars[i] = mat3d_det(bench_mat3d_A[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat3d_inverse(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_mat3d_out[i] = mat3d_inverse(bench_mat3d_B[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat3d_inverse_array(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        mat3d_inverse_array(bench_mat3d_B, bench_mat3d_out, bench_batch);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat3d_transform_array(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        mat3d_transform_array(&bench_mat3d_A[0], bench_vec3d_a, bench_vec3d_out, bench_batch);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3d_soa_from_aos(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec3d_soa_from_aos(bench_vec3d_soa_out, bench_vec3d_a);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3d_soa_to_aos(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec3d_soa_to_aos(bench_vec3d_out, bench_vec3d_soa_a);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3d_soa_add(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec3d_soa_add(bench_vec3d_soa_out, bench_vec3d_soa_a, bench_vec3d_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3d_soa_sub(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec3d_soa_sub(bench_vec3d_soa_out, bench_vec3d_soa_a, bench_vec3d_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3d_soa_mul(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec3d_soa_mul(bench_vec3d_soa_out, bench_vec3d_soa_a, bench_vec3d_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3d_soa_div(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec3d_soa_div(bench_vec3d_soa_out, bench_vec3d_soa_a, bench_vec3d_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3d_soa_mod(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec3d_soa_mod(bench_vec3d_soa_out, bench_vec3d_soa_a, bench_vec3d_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3d_soa_min(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec3d_soa_min(bench_vec3d_soa_out, bench_vec3d_soa_a, bench_vec3d_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3d_soa_max(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec3d_soa_max(bench_vec3d_soa_out, bench_vec3d_soa_a, bench_vec3d_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3d_soa_floor(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec3d_soa_floor(bench_vec3d_soa_out, bench_vec3d_soa_a);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3d_soa_ceil(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec3d_soa_ceil(bench_vec3d_soa_out, bench_vec3d_soa_a);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3d_soa_clamp(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec3d_soa_clamp(bench_vec3d_soa_out, bench_vec3d_soa_a, bench_vec3d_soa_b, bench_vec3d_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3d_soa_abs(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec3d_soa_abs(bench_vec3d_soa_out, bench_vec3d_soa_a);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3d_soa_lerp(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec3d_soa_lerp(bench_vec3d_soa_out, bench_vec3d_soa_a, bench_vec3d_soa_b, bench_vec3d_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3d_soa_dot(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec3d_soa_dot(bench_vec3d_scalars, bench_vec3d_soa_a, bench_vec3d_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3d_soa_2norm(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec3d_soa_2norm(bench_vec3d_scalars, bench_vec3d_soa_a);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3d_soa_unit(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec3d_soa_unit(bench_vec3d_soa_out, bench_vec3d_soa_a);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat3d_mul_vec_soa(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        mat3d_mul_vec_soa(bench_vec3d_soa_out, bench_mat3d_A[0], bench_vec3d_soa_a);
+        BENCH_CLOBBER();
+    }
+}
+
+vec3i_t bench_vec3i_a[BENCH_BATCH], bench_vec3i_b[BENCH_BATCH], bench_vec3i_c[BENCH_BATCH];
+vec3i_t bench_vec3i_ones[BENCH_BATCH], bench_vec3i_out[BENCH_BATCH];
+int bench_vec3i_scalars[BENCH_BATCH];
+mat3i_t bench_mat3i_A[BENCH_BATCH], bench_mat3i_B[BENCH_BATCH], bench_mat3i_I[BENCH_BATCH], bench_mat3i_out[BENCH_BATCH];
+int bench_vec3i_soa_streams[3][3][BENCH_BATCH];
+vec3i_soa_t bench_vec3i_soa_a, bench_vec3i_soa_b, bench_vec3i_soa_out;
+
+static void bench_vec3i_init(void) {
+    for (size_t i = 0; i < BENCH_BATCH; ++i) {
+        for (size_t k = 0; k < 3; ++k) {
+            bench_vec3i_a[i].e[k] = (int)(1 + (i * 7 + k * 3) % 13);
+            bench_vec3i_b[i].e[k] = (int)(1 + (i * 5 + k * 11) % 13);
+            bench_vec3i_c[i].e[k] = (int)(1 + (i * 3 + k * 7) % 13);
+            bench_vec3i_ones[i].e[k] = 1;
+        }
+        for (size_t k = 0; k < 9; ++k) {
+            bench_mat3i_A[i].e[k] = (int)(1 + (i * 7 + k * 3) % 13);
+            bench_mat3i_B[i].e[k] = (int)(1 + (i * 5 + k * 11) % 13);
+        }
+        bench_mat3i_I[i] = mat3i_I();
+    }
+    bench_vec3i_soa_a.x = bench_vec3i_soa_streams[0][0];
+    bench_vec3i_soa_a.y = bench_vec3i_soa_streams[0][1];
+    bench_vec3i_soa_a.z = bench_vec3i_soa_streams[0][2];
+    bench_vec3i_soa_a.n = BENCH_BATCH;
+    bench_vec3i_soa_b.x = bench_vec3i_soa_streams[1][0];
+    bench_vec3i_soa_b.y = bench_vec3i_soa_streams[1][1];
+    bench_vec3i_soa_b.z = bench_vec3i_soa_streams[1][2];
+    bench_vec3i_soa_b.n = BENCH_BATCH;
+    bench_vec3i_soa_out.x = bench_vec3i_soa_streams[2][0];
+    bench_vec3i_soa_out.y = bench_vec3i_soa_streams[2][1];
+    bench_vec3i_soa_out.z = bench_vec3i_soa_streams[2][2];
+    bench_vec3i_soa_out.n = BENCH_BATCH;
+    vec3i_soa_from_aos(bench_vec3i_soa_a, bench_vec3i_a);
+    vec3i_soa_from_aos(bench_vec3i_soa_b, bench_vec3i_b);
+}
+
+static void bench_vec3i_add(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3i_out[i] = vec3i_add(bench_vec3i_a[i], bench_vec3i_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3i_add_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec3i_add_to(&bench_vec3i_out[i], &bench_vec3i_a[i], &bench_vec3i_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3i_add_assign(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec3i_add_assign(&bench_vec3i_out[i], bench_vec3i_ones[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3i_sub(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3i_out[i] = vec3i_sub(bench_vec3i_a[i], bench_vec3i_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3i_sub_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec3i_sub_to(&bench_vec3i_out[i], &bench_vec3i_a[i], &bench_vec3i_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3i_sub_assign(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec3i_sub_assign(&bench_vec3i_out[i], bench_vec3i_ones[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3i_mul(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3i_out[i] = vec3i_mul(bench_vec3i_a[i], bench_vec3i_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3i_mul_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec3i_mul_to(&bench_vec3i_out[i], &bench_vec3i_a[i], &bench_vec3i_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3i_mul_assign(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec3i_mul_assign(&bench_vec3i_out[i], bench_vec3i_ones[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3i_div(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3i_out[i] = vec3i_div(bench_vec3i_a[i], bench_vec3i_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3i_div_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec3i_div_to(&bench_vec3i_out[i], &bench_vec3i_a[i], &bench_vec3i_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3i_div_assign(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec3i_div_assign(&bench_vec3i_out[i], bench_vec3i_ones[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3i_mod(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3i_out[i] = vec3i_mod(bench_vec3i_a[i], bench_vec3i_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3i_mod_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec3i_mod_to(&bench_vec3i_out[i], &bench_vec3i_a[i], &bench_vec3i_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3i_mod_assign(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec3i_mod_assign(&bench_vec3i_out[i], bench_vec3i_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3i_min(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3i_out[i] = vec3i_min(bench_vec3i_a[i], bench_vec3i_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3i_min_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec3i_min_to(&bench_vec3i_out[i], &bench_vec3i_a[i], &bench_vec3i_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3i_max(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3i_out[i] = vec3i_max(bench_vec3i_a[i], bench_vec3i_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3i_max_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec3i_max_to(&bench_vec3i_out[i], &bench_vec3i_a[i], &bench_vec3i_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3i_clamp(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3i_out[i] = vec3i_clamp(bench_vec3i_a[i], bench_vec3i_ones[i], bench_vec3i_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3i_clamp_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec3i_clamp_to(&bench_vec3i_out[i], &bench_vec3i_a[i], &bench_vec3i_ones[i], &bench_vec3i_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3i_abs(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3i_out[i] = vec3i_abs(bench_vec3i_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3i_abs_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec3i_abs_to(&bench_vec3i_out[i], &bench_vec3i_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3i_sum(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3i_out[i] = vec3i_sum(3, bench_vec3i_a[i], bench_vec3i_ones[i], bench_vec3i_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3i_sum_array(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        bench_vec3i_out[0] = vec3i_sum_array(bench_vec3i_a, bench_batch);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3i_product(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3i_out[i] = vec3i_product(3, bench_vec3i_a[i], bench_vec3i_ones[i], bench_vec3i_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3i_product_array(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        bench_vec3i_out[0] = vec3i_product_array(bench_vec3i_ones, bench_batch);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3i_dot(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3i_scalars[i] = vec3i_dot(bench_vec3i_a[i], bench_vec3i_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3i_sqrlen(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3i_scalars[i] = vec3i_sqrlen(bench_vec3i_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3i_1norm(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3i_scalars[i] = vec3i_1norm(bench_vec3i_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3i_reflect(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3i_out[i] = vec3i_reflect(bench_vec3i_a[i], bench_vec3i_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3i_cross(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3i_out[i] = vec3i_cross(bench_vec3i_a[i], bench_vec3i_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat3i_mul(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_mat3i_out[i] = mat3i_mul(bench_mat3i_A[i], bench_mat3i_B[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat3i_mul_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            mat3i_mul_to(&bench_mat3i_out[i], &bench_mat3i_A[i], &bench_mat3i_B[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat3i_nmul(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_mat3i_out[i] = mat3i_nmul(3, bench_mat3i_A[i], bench_mat3i_B[i], bench_mat3i_I[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat3i_mul_chain(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        bench_mat3i_out[0] = mat3i_mul_chain(bench_mat3i_I, bench_batch);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat3i_mul_vec(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3i_out[i] = mat3i_mul_vec(bench_mat3i_A[i], bench_vec3i_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat3i_mul_vec_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            mat3i_mul_vec_to(&bench_vec3i_out[i], &bench_mat3i_A[i], &bench_vec3i_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat3i_hadamard(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_mat3i_out[i] = mat3i_hadamard(bench_mat3i_A[i], bench_mat3i_B[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat3i_hadamard_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            mat3i_hadamard_to(&bench_mat3i_out[i], &bench_mat3i_A[i], &bench_mat3i_B[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat3i_transpose(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_mat3i_out[i] = mat3i_transpose(bench_mat3i_A[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat3i_transform_array(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        mat3i_transform_array(&bench_mat3i_A[0], bench_vec3i_a, bench_vec3i_out, bench_batch);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3i_soa_from_aos(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec3i_soa_from_aos(bench_vec3i_soa_out, bench_vec3i_a);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3i_soa_to_aos(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec3i_soa_to_aos(bench_vec3i_out, bench_vec3i_soa_a);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3i_soa_add(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec3i_soa_add(bench_vec3i_soa_out, bench_vec3i_soa_a, bench_vec3i_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3i_soa_sub(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec3i_soa_sub(bench_vec3i_soa_out, bench_vec3i_soa_a, bench_vec3i_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3i_soa_mul(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec3i_soa_mul(bench_vec3i_soa_out, bench_vec3i_soa_a, bench_vec3i_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3i_soa_div(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec3i_soa_div(bench_vec3i_soa_out, bench_vec3i_soa_a, bench_vec3i_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3i_soa_mod(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec3i_soa_mod(bench_vec3i_soa_out, bench_vec3i_soa_a, bench_vec3i_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3i_soa_min(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec3i_soa_min(bench_vec3i_soa_out, bench_vec3i_soa_a, bench_vec3i_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3i_soa_max(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec3i_soa_max(bench_vec3i_soa_out, bench_vec3i_soa_a, bench_vec3i_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3i_soa_clamp(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec3i_soa_clamp(bench_vec3i_soa_out, bench_vec3i_soa_a, bench_vec3i_soa_b, bench_vec3i_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3i_soa_abs(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec3i_soa_abs(bench_vec3i_soa_out, bench_vec3i_soa_a);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3i_soa_dot(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec3i_soa_dot(bench_vec3i_scalars, bench_vec3i_soa_a, bench_vec3i_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat3i_mul_vec_soa(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        mat3i_mul_vec_soa(bench_vec3i_soa_out, bench_mat3i_A[0], bench_vec3i_soa_a);
+        BENCH_CLOBBER();
+    }
+}
+
+vec3u_t bench_vec3u_a[BENCH_BATCH], bench_vec3u_b[BENCH_BATCH], bench_vec3u_c[BENCH_BATCH];
+vec3u_t bench_vec3u_ones[BENCH_BATCH], bench_vec3u_out[BENCH_BATCH];
+unsigned int bench_vec3u_scalars[BENCH_BATCH];
+mat3u_t bench_mat3u_A[BENCH_BATCH], bench_mat3u_B[BENCH_BATCH], bench_mat3u_I[BENCH_BATCH], bench_mat3u_out[BENCH_BATCH];
+unsigned int bench_vec3u_soa_streams[3][3][BENCH_BATCH];
+vec3u_soa_t bench_vec3u_soa_a, bench_vec3u_soa_b, bench_vec3u_soa_out;
+
+static void bench_vec3u_init(void) {
+    for (size_t i = 0; i < BENCH_BATCH; ++i) {
+        for (size_t k = 0; k < 3; ++k) {
+            bench_vec3u_a[i].e[k] = (unsigned int)(1 + (i * 7 + k * 3) % 13);
+            bench_vec3u_b[i].e[k] = (unsigned int)(1 + (i * 5 + k * 11) % 13);
+            bench_vec3u_c[i].e[k] = (unsigned int)(1 + (i * 3 + k * 7) % 13);
+            bench_vec3u_ones[i].e[k] = 1;
+        }
+        for (size_t k = 0; k < 9; ++k) {
+            bench_mat3u_A[i].e[k] = (unsigned int)(1 + (i * 7 + k * 3) % 13);
+            bench_mat3u_B[i].e[k] = (unsigned int)(1 + (i * 5 + k * 11) % 13);
+        }
+        bench_mat3u_I[i] = mat3u_I();
+    }
+    bench_vec3u_soa_a.x = bench_vec3u_soa_streams[0][0];
+    bench_vec3u_soa_a.y = bench_vec3u_soa_streams[0][1];
+    bench_vec3u_soa_a.z = bench_vec3u_soa_streams[0][2];
+    bench_vec3u_soa_a.n = BENCH_BATCH;
+    bench_vec3u_soa_b.x = bench_vec3u_soa_streams[1][0];
+    bench_vec3u_soa_b.y = bench_vec3u_soa_streams[1][1];
+    bench_vec3u_soa_b.z = bench_vec3u_soa_streams[1][2];
+    bench_vec3u_soa_b.n = BENCH_BATCH;
+    bench_vec3u_soa_out.x = bench_vec3u_soa_streams[2][0];
+    bench_vec3u_soa_out.y = bench_vec3u_soa_streams[2][1];
+    bench_vec3u_soa_out.z = bench_vec3u_soa_streams[2][2];
+    bench_vec3u_soa_out.n = BENCH_BATCH;
+    vec3u_soa_from_aos(bench_vec3u_soa_a, bench_vec3u_a);
+    vec3u_soa_from_aos(bench_vec3u_soa_b, bench_vec3u_b);
+}
+
+static void bench_vec3u_add(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3u_out[i] = vec3u_add(bench_vec3u_a[i], bench_vec3u_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3u_add_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec3u_add_to(&bench_vec3u_out[i], &bench_vec3u_a[i], &bench_vec3u_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3u_add_assign(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec3u_add_assign(&bench_vec3u_out[i], bench_vec3u_ones[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3u_sub(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3u_out[i] = vec3u_sub(bench_vec3u_a[i], bench_vec3u_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3u_sub_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec3u_sub_to(&bench_vec3u_out[i], &bench_vec3u_a[i], &bench_vec3u_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3u_sub_assign(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec3u_sub_assign(&bench_vec3u_out[i], bench_vec3u_ones[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3u_mul(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3u_out[i] = vec3u_mul(bench_vec3u_a[i], bench_vec3u_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3u_mul_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec3u_mul_to(&bench_vec3u_out[i], &bench_vec3u_a[i], &bench_vec3u_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3u_mul_assign(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec3u_mul_assign(&bench_vec3u_out[i], bench_vec3u_ones[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3u_div(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3u_out[i] = vec3u_div(bench_vec3u_a[i], bench_vec3u_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3u_div_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec3u_div_to(&bench_vec3u_out[i], &bench_vec3u_a[i], &bench_vec3u_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3u_div_assign(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec3u_div_assign(&bench_vec3u_out[i], bench_vec3u_ones[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3u_mod(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3u_out[i] = vec3u_mod(bench_vec3u_a[i], bench_vec3u_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3u_mod_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec3u_mod_to(&bench_vec3u_out[i], &bench_vec3u_a[i], &bench_vec3u_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3u_mod_assign(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec3u_mod_assign(&bench_vec3u_out[i], bench_vec3u_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3u_min(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3u_out[i] = vec3u_min(bench_vec3u_a[i], bench_vec3u_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3u_min_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec3u_min_to(&bench_vec3u_out[i], &bench_vec3u_a[i], &bench_vec3u_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3u_max(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3u_out[i] = vec3u_max(bench_vec3u_a[i], bench_vec3u_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3u_max_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec3u_max_to(&bench_vec3u_out[i], &bench_vec3u_a[i], &bench_vec3u_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3u_clamp(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3u_out[i] = vec3u_clamp(bench_vec3u_a[i], bench_vec3u_ones[i], bench_vec3u_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3u_clamp_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec3u_clamp_to(&bench_vec3u_out[i], &bench_vec3u_a[i], &bench_vec3u_ones[i], &bench_vec3u_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3u_sum(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3u_out[i] = vec3u_sum(3, bench_vec3u_a[i], bench_vec3u_ones[i], bench_vec3u_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3u_sum_array(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        bench_vec3u_out[0] = vec3u_sum_array(bench_vec3u_a, bench_batch);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3u_product(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3u_out[i] = vec3u_product(3, bench_vec3u_a[i], bench_vec3u_ones[i], bench_vec3u_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3u_product_array(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        bench_vec3u_out[0] = vec3u_product_array(bench_vec3u_ones, bench_batch);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3u_dot(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3u_scalars[i] = vec3u_dot(bench_vec3u_a[i], bench_vec3u_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3u_sqrlen(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3u_scalars[i] = vec3u_sqrlen(bench_vec3u_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3u_1norm(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3u_scalars[i] = vec3u_1norm(bench_vec3u_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3u_reflect(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3u_out[i] = vec3u_reflect(bench_vec3u_a[i], bench_vec3u_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3u_cross(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3u_out[i] = vec3u_cross(bench_vec3u_a[i], bench_vec3u_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat3u_mul(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_mat3u_out[i] = mat3u_mul(bench_mat3u_A[i], bench_mat3u_B[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat3u_mul_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            mat3u_mul_to(&bench_mat3u_out[i], &bench_mat3u_A[i], &bench_mat3u_B[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat3u_nmul(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_mat3u_out[i] = mat3u_nmul(3, bench_mat3u_A[i], bench_mat3u_B[i], bench_mat3u_I[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat3u_mul_chain(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        bench_mat3u_out[0] = mat3u_mul_chain(bench_mat3u_I, bench_batch);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat3u_mul_vec(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3u_out[i] = mat3u_mul_vec(bench_mat3u_A[i], bench_vec3u_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat3u_mul_vec_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            mat3u_mul_vec_to(&bench_vec3u_out[i], &bench_mat3u_A[i], &bench_vec3u_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat3u_hadamard(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_mat3u_out[i] = mat3u_hadamard(bench_mat3u_A[i], bench_mat3u_B[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat3u_hadamard_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            mat3u_hadamard_to(&bench_mat3u_out[i], &bench_mat3u_A[i], &bench_mat3u_B[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat3u_transpose(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_mat3u_out[i] = mat3u_transpose(bench_mat3u_A[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat3u_transform_array(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        mat3u_transform_array(&bench_mat3u_A[0], bench_vec3u_a, bench_vec3u_out, bench_batch);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3u_soa_from_aos(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec3u_soa_from_aos(bench_vec3u_soa_out, bench_vec3u_a);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3u_soa_to_aos(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec3u_soa_to_aos(bench_vec3u_out, bench_vec3u_soa_a);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3u_soa_add(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec3u_soa_add(bench_vec3u_soa_out, bench_vec3u_soa_a, bench_vec3u_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3u_soa_sub(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec3u_soa_sub(bench_vec3u_soa_out, bench_vec3u_soa_a, bench_vec3u_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3u_soa_mul(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec3u_soa_mul(bench_vec3u_soa_out, bench_vec3u_soa_a, bench_vec3u_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3u_soa_div(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec3u_soa_div(bench_vec3u_soa_out, bench_vec3u_soa_a, bench_vec3u_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3u_soa_mod(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec3u_soa_mod(bench_vec3u_soa_out, bench_vec3u_soa_a, bench_vec3u_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3u_soa_min(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec3u_soa_min(bench_vec3u_soa_out, bench_vec3u_soa_a, bench_vec3u_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3u_soa_max(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec3u_soa_max(bench_vec3u_soa_out, bench_vec3u_soa_a, bench_vec3u_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3u_soa_clamp(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec3u_soa_clamp(bench_vec3u_soa_out, bench_vec3u_soa_a, bench_vec3u_soa_b, bench_vec3u_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3u_soa_dot(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec3u_soa_dot(bench_vec3u_scalars, bench_vec3u_soa_a, bench_vec3u_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat3u_mul_vec_soa(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        mat3u_mul_vec_soa(bench_vec3u_soa_out, bench_mat3u_A[0], bench_vec3u_soa_a);
+        BENCH_CLOBBER();
+    }
+}
+
+vec3h_t bench_vec3h_a[BENCH_BATCH], bench_vec3h_out[BENCH_BATCH];
+static void bench_vec3h_init(void) {
+    vec3h_from_vec3f_array(bench_vec3f_a, bench_vec3h_a, BENCH_BATCH);
+}
+
+static void bench_vec3h_to_vec3f_array(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec3h_to_vec3f_array(bench_vec3h_a, bench_vec3f_out, bench_batch);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec3h_from_vec3f_array(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec3h_from_vec3f_array(bench_vec3f_a, bench_vec3h_out, bench_batch);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat3f_transform_array_h(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        mat3f_transform_array_h(&bench_mat3f_A[0], bench_vec3h_a, bench_vec3h_out, bench_batch);
+        BENCH_CLOBBER();
+    }
+}
+
+vec4f_t bench_vec4f_a[BENCH_BATCH], bench_vec4f_b[BENCH_BATCH], bench_vec4f_c[BENCH_BATCH];
+vec4f_t bench_vec4f_ones[BENCH_BATCH], bench_vec4f_out[BENCH_BATCH];
+float bench_vec4f_scalars[BENCH_BATCH];
+mat4f_t bench_mat4f_A[BENCH_BATCH], bench_mat4f_B[BENCH_BATCH], bench_mat4f_I[BENCH_BATCH], bench_mat4f_out[BENCH_BATCH];
+float bench_vec4f_soa_streams[3][4][BENCH_BATCH];
+vec4f_soa_t bench_vec4f_soa_a, bench_vec4f_soa_b, bench_vec4f_soa_out;
+
+static void bench_vec4f_init(void) {
+    for (size_t i = 0; i < BENCH_BATCH; ++i) {
+        for (size_t k = 0; k < 4; ++k) {
+            bench_vec4f_a[i].e[k] = (float)(1 + (i * 7 + k * 3) % 13);
+            bench_vec4f_b[i].e[k] = (float)(1 + (i * 5 + k * 11) % 13);
+            bench_vec4f_c[i].e[k] = (float)(1 + (i * 3 + k * 7) % 13);
+            bench_vec4f_ones[i].e[k] = 1;
+        }
+        for (size_t k = 0; k < 16; ++k) {
+            bench_mat4f_A[i].e[k] = (float)(1 + (i * 7 + k * 3) % 13);
+            bench_mat4f_B[i].e[k] = (float)(1 + (i * 5 + k * 11) % 13);
+        }
+        bench_mat4f_I[i] = mat4f_I();
+    }
+    bench_vec4f_soa_a.x = bench_vec4f_soa_streams[0][0];
+    bench_vec4f_soa_a.y = bench_vec4f_soa_streams[0][1];
+    bench_vec4f_soa_a.z = bench_vec4f_soa_streams[0][2];
+    bench_vec4f_soa_a.w = bench_vec4f_soa_streams[0][3];
+    bench_vec4f_soa_a.n = BENCH_BATCH;
+    bench_vec4f_soa_b.x = bench_vec4f_soa_streams[1][0];
+    bench_vec4f_soa_b.y = bench_vec4f_soa_streams[1][1];
+    bench_vec4f_soa_b.z = bench_vec4f_soa_streams[1][2];
+    bench_vec4f_soa_b.w = bench_vec4f_soa_streams[1][3];
+    bench_vec4f_soa_b.n = BENCH_BATCH;
+    bench_vec4f_soa_out.x = bench_vec4f_soa_streams[2][0];
+    bench_vec4f_soa_out.y = bench_vec4f_soa_streams[2][1];
+    bench_vec4f_soa_out.z = bench_vec4f_soa_streams[2][2];
+    bench_vec4f_soa_out.w = bench_vec4f_soa_streams[2][3];
+    bench_vec4f_soa_out.n = BENCH_BATCH;
+    vec4f_soa_from_aos(bench_vec4f_soa_a, bench_vec4f_a);
+    vec4f_soa_from_aos(bench_vec4f_soa_b, bench_vec4f_b);
+}
+
+static void bench_vec4f_add(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec4f_out[i] = vec4f_add(bench_vec4f_a[i], bench_vec4f_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4f_add_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec4f_add_to(&bench_vec4f_out[i], &bench_vec4f_a[i], &bench_vec4f_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4f_add_assign(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec4f_add_assign(&bench_vec4f_out[i], bench_vec4f_ones[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4f_sub(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec4f_out[i] = vec4f_sub(bench_vec4f_a[i], bench_vec4f_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4f_sub_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec4f_sub_to(&bench_vec4f_out[i], &bench_vec4f_a[i], &bench_vec4f_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4f_sub_assign(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec4f_sub_assign(&bench_vec4f_out[i], bench_vec4f_ones[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4f_mul(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec4f_out[i] = vec4f_mul(bench_vec4f_a[i], bench_vec4f_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4f_mul_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec4f_mul_to(&bench_vec4f_out[i], &bench_vec4f_a[i], &bench_vec4f_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4f_mul_assign(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec4f_mul_assign(&bench_vec4f_out[i], bench_vec4f_ones[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4f_div(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec4f_out[i] = vec4f_div(bench_vec4f_a[i], bench_vec4f_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4f_div_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec4f_div_to(&bench_vec4f_out[i], &bench_vec4f_a[i], &bench_vec4f_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4f_div_assign(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec4f_div_assign(&bench_vec4f_out[i], bench_vec4f_ones[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4f_mod(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec4f_out[i] = vec4f_mod(bench_vec4f_a[i], bench_vec4f_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4f_mod_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec4f_mod_to(&bench_vec4f_out[i], &bench_vec4f_a[i], &bench_vec4f_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4f_mod_assign(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec4f_mod_assign(&bench_vec4f_out[i], bench_vec4f_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4f_min(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec4f_out[i] = vec4f_min(bench_vec4f_a[i], bench_vec4f_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4f_min_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec4f_min_to(&bench_vec4f_out[i], &bench_vec4f_a[i], &bench_vec4f_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4f_max(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec4f_out[i] = vec4f_max(bench_vec4f_a[i], bench_vec4f_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4f_max_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec4f_max_to(&bench_vec4f_out[i], &bench_vec4f_a[i], &bench_vec4f_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4f_floor(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec4f_out[i] = vec4f_floor(bench_vec4f_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4f_floor_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec4f_floor_to(&bench_vec4f_out[i], &bench_vec4f_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4f_ceil(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec4f_out[i] = vec4f_ceil(bench_vec4f_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4f_ceil_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec4f_ceil_to(&bench_vec4f_out[i], &bench_vec4f_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4f_clamp(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec4f_out[i] = vec4f_clamp(bench_vec4f_a[i], bench_vec4f_ones[i], bench_vec4f_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4f_clamp_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec4f_clamp_to(&bench_vec4f_out[i], &bench_vec4f_a[i], &bench_vec4f_ones[i], &bench_vec4f_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4f_abs(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec4f_out[i] = vec4f_abs(bench_vec4f_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4f_abs_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec4f_abs_to(&bench_vec4f_out[i], &bench_vec4f_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4f_lerp(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec4f_out[i] = vec4f_lerp(bench_vec4f_a[i], bench_vec4f_ones[i], bench_vec4f_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4f_lerp_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec4f_lerp_to(&bench_vec4f_out[i], &bench_vec4f_a[i], &bench_vec4f_ones[i], &bench_vec4f_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4f_sum(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec4f_out[i] = vec4f_sum(3, bench_vec4f_a[i], bench_vec4f_ones[i], bench_vec4f_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4f_sum_array(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        bench_vec4f_out[0] = vec4f_sum_array(bench_vec4f_a, bench_batch);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4f_product(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec4f_out[i] = vec4f_product(3, bench_vec4f_a[i], bench_vec4f_ones[i], bench_vec4f_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4f_product_array(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        bench_vec4f_out[0] = vec4f_product_array(bench_vec4f_ones, bench_batch);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4f_dot(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec4f_scalars[i] = vec4f_dot(bench_vec4f_a[i], bench_vec4f_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4f_sqrlen(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec4f_scalars[i] = vec4f_sqrlen(bench_vec4f_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4f_1norm(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec4f_scalars[i] = vec4f_1norm(bench_vec4f_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4f_reflect(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec4f_out[i] = vec4f_reflect(bench_vec4f_a[i], bench_vec4f_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4f_2norm(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec4f_scalars[i] = vec4f_2norm(bench_vec4f_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4f_eq(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec4f_scalars[i] = vec4f_eq(bench_vec4f_a[i], bench_vec4f_b[i], 1e-3);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4f_unit(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec4f_out[i] = vec4f_unit(bench_vec4f_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4f_direction(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec4f_out[i] = vec4f_direction(bench_vec4f_a[i], bench_vec4f_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4f_unit_fast(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec4f_out[i] = vec4f_unit_fast(bench_vec4f_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat4f_mul(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_mat4f_out[i] = mat4f_mul(bench_mat4f_A[i], bench_mat4f_B[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat4f_mul_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            mat4f_mul_to(&bench_mat4f_out[i], &bench_mat4f_A[i], &bench_mat4f_B[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat4f_nmul(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_mat4f_out[i] = mat4f_nmul(3, bench_mat4f_A[i], bench_mat4f_B[i], bench_mat4f_I[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat4f_mul_chain(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        bench_mat4f_out[0] = mat4f_mul_chain(bench_mat4f_I, bench_batch);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat4f_mul_vec(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec4f_out[i] = mat4f_mul_vec(bench_mat4f_A[i], bench_vec4f_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat4f_mul_vec_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            mat4f_mul_vec_to(&bench_vec4f_out[i], &bench_mat4f_A[i], &bench_vec4f_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat4f_hadamard(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_mat4f_out[i] = mat4f_hadamard(bench_mat4f_A[i], bench_mat4f_B[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat4f_hadamard_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            mat4f_hadamard_to(&bench_mat4f_out[i], &bench_mat4f_A[i], &bench_mat4f_B[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat4f_rotate(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_mat4f_out[i] = mat4f_rotate(bench_mat4f_A[i], AXIS_Z, 0.5);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat4f_rotate_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            mat4f_rotate_to(&bench_mat4f_out[i], &bench_mat4f_A[i], AXIS_Z, 0.5);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat4f_rotate_fast(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_mat4f_out[i] = mat4f_rotate_fast(bench_mat4f_A[i], AXIS_Z, 0.5);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat4f_transpose(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_mat4f_out[i] = mat4f_transpose(bench_mat4f_A[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat4f_det(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec4f_scalars[i] = mat4f_det(bench_mat4f_A[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat4f_inverse(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_mat4f_out[i] = mat4f_inverse(bench_mat4f_B[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat4f_inverse_array(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        mat4f_inverse_array(bench_mat4f_B, bench_mat4f_out, bench_batch);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat4f_inverse_affine(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_mat4f_out[i] = mat4f_inverse_affine(bench_mat4f_B[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat4f_transform_array(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        mat4f_transform_array(&bench_mat4f_A[0], bench_vec4f_a, bench_vec4f_out, bench_batch);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4f_soa_from_aos(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec4f_soa_from_aos(bench_vec4f_soa_out, bench_vec4f_a);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4f_soa_to_aos(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec4f_soa_to_aos(bench_vec4f_out, bench_vec4f_soa_a);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4f_soa_add(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec4f_soa_add(bench_vec4f_soa_out, bench_vec4f_soa_a, bench_vec4f_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4f_soa_sub(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec4f_soa_sub(bench_vec4f_soa_out, bench_vec4f_soa_a, bench_vec4f_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4f_soa_mul(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec4f_soa_mul(bench_vec4f_soa_out, bench_vec4f_soa_a, bench_vec4f_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4f_soa_div(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec4f_soa_div(bench_vec4f_soa_out, bench_vec4f_soa_a, bench_vec4f_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4f_soa_mod(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec4f_soa_mod(bench_vec4f_soa_out, bench_vec4f_soa_a, bench_vec4f_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4f_soa_min(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec4f_soa_min(bench_vec4f_soa_out, bench_vec4f_soa_a, bench_vec4f_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4f_soa_max(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec4f_soa_max(bench_vec4f_soa_out, bench_vec4f_soa_a, bench_vec4f_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4f_soa_floor(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec4f_soa_floor(bench_vec4f_soa_out, bench_vec4f_soa_a);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4f_soa_ceil(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec4f_soa_ceil(bench_vec4f_soa_out, bench_vec4f_soa_a);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4f_soa_clamp(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec4f_soa_clamp(bench_vec4f_soa_out, bench_vec4f_soa_a, bench_vec4f_soa_b, bench_vec4f_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4f_soa_abs(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec4f_soa_abs(bench_vec4f_soa_out, bench_vec4f_soa_a);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4f_soa_lerp(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec4f_soa_lerp(bench_vec4f_soa_out, bench_vec4f_soa_a, bench_vec4f_soa_b, bench_vec4f_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4f_soa_dot(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec4f_soa_dot(bench_vec4f_scalars, bench_vec4f_soa_a, bench_vec4f_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4f_soa_2norm(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec4f_soa_2norm(bench_vec4f_scalars, bench_vec4f_soa_a);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4f_soa_unit(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec4f_soa_unit(bench_vec4f_soa_out, bench_vec4f_soa_a);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat4f_mul_vec_soa(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        mat4f_mul_vec_soa(bench_vec4f_soa_out, bench_mat4f_A[0], bench_vec4f_soa_a);
+        BENCH_CLOBBER();
+    }
+}
+
+vec4d_t bench_vec4d_a[BENCH_BATCH], bench_vec4d_b[BENCH_BATCH], bench_vec4d_c[BENCH_BATCH];
+vec4d_t bench_vec4d_ones[BENCH_BATCH], bench_vec4d_out[BENCH_BATCH];
+double bench_vec4d_scalars[BENCH_BATCH];
+mat4d_t bench_mat4d_A[BENCH_BATCH], bench_mat4d_B[BENCH_BATCH], bench_mat4d_I[BENCH_BATCH], bench_mat4d_out[BENCH_BATCH];
+double bench_vec4d_soa_streams[3][4][BENCH_BATCH];
+vec4d_soa_t bench_vec4d_soa_a, bench_vec4d_soa_b, bench_vec4d_soa_out;
+
+static void bench_vec4d_init(void) {
+    for (size_t i = 0; i < BENCH_BATCH; ++i) {
+        for (size_t k = 0; k < 4; ++k) {
+            bench_vec4d_a[i].e[k] = (double)(1 + (i * 7 + k * 3) % 13);
+            bench_vec4d_b[i].e[k] = (double)(1 + (i * 5 + k * 11) % 13);
+            bench_vec4d_c[i].e[k] = (double)(1 + (i * 3 + k * 7) % 13);
+            bench_vec4d_ones[i].e[k] = 1;
+        }
+        for (size_t k = 0; k < 16; ++k) {
+            bench_mat4d_A[i].e[k] = (double)(1 + (i * 7 + k * 3) % 13);
+            bench_mat4d_B[i].e[k] = (double)(1 + (i * 5 + k * 11) % 13);
+        }
+        bench_mat4d_I[i] = mat4d_I();
+    }
+    bench_vec4d_soa_a.x = bench_vec4d_soa_streams[0][0];
+    bench_vec4d_soa_a.y = bench_vec4d_soa_streams[0][1];
+    bench_vec4d_soa_a.z = bench_vec4d_soa_streams[0][2];
+    bench_vec4d_soa_a.w = bench_vec4d_soa_streams[0][3];
+    bench_vec4d_soa_a.n = BENCH_BATCH;
+    bench_vec4d_soa_b.x = bench_vec4d_soa_streams[1][0];
+    bench_vec4d_soa_b.y = bench_vec4d_soa_streams[1][1];
+    bench_vec4d_soa_b.z = bench_vec4d_soa_streams[1][2];
+    bench_vec4d_soa_b.w = bench_vec4d_soa_streams[1][3];
+    bench_vec4d_soa_b.n = BENCH_BATCH;
+    bench_vec4d_soa_out.x = bench_vec4d_soa_streams[2][0];
+    bench_vec4d_soa_out.y = bench_vec4d_soa_streams[2][1];
+    bench_vec4d_soa_out.z = bench_vec4d_soa_streams[2][2];
+    bench_vec4d_soa_out.w = bench_vec4d_soa_streams[2][3];
+    bench_vec4d_soa_out.n = BENCH_BATCH;
+    vec4d_soa_from_aos(bench_vec4d_soa_a, bench_vec4d_a);
+    vec4d_soa_from_aos(bench_vec4d_soa_b, bench_vec4d_b);
+}
+
+static void bench_vec4d_add(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec4d_out[i] = vec4d_add(bench_vec4d_a[i], bench_vec4d_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4d_add_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec4d_add_to(&bench_vec4d_out[i], &bench_vec4d_a[i], &bench_vec4d_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4d_add_assign(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec4d_add_assign(&bench_vec4d_out[i], bench_vec4d_ones[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4d_sub(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec4d_out[i] = vec4d_sub(bench_vec4d_a[i], bench_vec4d_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4d_sub_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec4d_sub_to(&bench_vec4d_out[i], &bench_vec4d_a[i], &bench_vec4d_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4d_sub_assign(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec4d_sub_assign(&bench_vec4d_out[i], bench_vec4d_ones[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4d_mul(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec4d_out[i] = vec4d_mul(bench_vec4d_a[i], bench_vec4d_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4d_mul_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec4d_mul_to(&bench_vec4d_out[i], &bench_vec4d_a[i], &bench_vec4d_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4d_mul_assign(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec4d_mul_assign(&bench_vec4d_out[i], bench_vec4d_ones[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4d_div(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec4d_out[i] = vec4d_div(bench_vec4d_a[i], bench_vec4d_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4d_div_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec4d_div_to(&bench_vec4d_out[i], &bench_vec4d_a[i], &bench_vec4d_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4d_div_assign(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec4d_div_assign(&bench_vec4d_out[i], bench_vec4d_ones[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4d_mod(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec4d_out[i] = vec4d_mod(bench_vec4d_a[i], bench_vec4d_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4d_mod_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec4d_mod_to(&bench_vec4d_out[i], &bench_vec4d_a[i], &bench_vec4d_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4d_mod_assign(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec4d_mod_assign(&bench_vec4d_out[i], bench_vec4d_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4d_min(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec4d_out[i] = vec4d_min(bench_vec4d_a[i], bench_vec4d_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4d_min_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec4d_min_to(&bench_vec4d_out[i], &bench_vec4d_a[i], &bench_vec4d_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4d_max(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec4d_out[i] = vec4d_max(bench_vec4d_a[i], bench_vec4d_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4d_max_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec4d_max_to(&bench_vec4d_out[i], &bench_vec4d_a[i], &bench_vec4d_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4d_floor(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec4d_out[i] = vec4d_floor(bench_vec4d_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4d_floor_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec4d_floor_to(&bench_vec4d_out[i], &bench_vec4d_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4d_ceil(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec4d_out[i] = vec4d_ceil(bench_vec4d_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4d_ceil_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec4d_ceil_to(&bench_vec4d_out[i], &bench_vec4d_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4d_clamp(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec4d_out[i] = vec4d_clamp(bench_vec4d_a[i], bench_vec4d_ones[i], bench_vec4d_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4d_clamp_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec4d_clamp_to(&bench_vec4d_out[i], &bench_vec4d_a[i], &bench_vec4d_ones[i], &bench_vec4d_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4d_abs(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec4d_out[i] = vec4d_abs(bench_vec4d_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4d_abs_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec4d_abs_to(&bench_vec4d_out[i], &bench_vec4d_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4d_lerp(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec4d_out[i] = vec4d_lerp(bench_vec4d_a[i], bench_vec4d_ones[i], bench_vec4d_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4d_lerp_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec4d_lerp_to(&bench_vec4d_out[i], &bench_vec4d_a[i], &bench_vec4d_ones[i], &bench_vec4d_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4d_sum(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec4d_out[i] = vec4d_sum(3, bench_vec4d_a[i], bench_vec4d_ones[i], bench_vec4d_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4d_sum_array(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        bench_vec4d_out[0] = vec4d_sum_array(bench_vec4d_a, bench_batch);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4d_product(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec4d_out[i] = vec4d_product(3, bench_vec4d_a[i], bench_vec4d_ones[i], bench_vec4d_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4d_product_array(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        bench_vec4d_out[0] = vec4d_product_array(bench_vec4d_ones, bench_batch);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4d_dot(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec4d_scalars[i] = vec4d_dot(bench_vec4d_a[i], bench_vec4d_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4d_sqrlen(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec4d_scalars[i] = vec4d_sqrlen(bench_vec4d_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4d_1norm(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec4d_scalars[i] = vec4d_1norm(bench_vec4d_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4d_reflect(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec4d_out[i] = vec4d_reflect(bench_vec4d_a[i], bench_vec4d_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4d_2norm(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec4d_scalars[i] = vec4d_2norm(bench_vec4d_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4d_eq(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec4d_scalars[i] = vec4d_eq(bench_vec4d_a[i], bench_vec4d_b[i], 1e-3);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4d_unit(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec4d_out[i] = vec4d_unit(bench_vec4d_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4d_direction(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec4d_out[i] = vec4d_direction(bench_vec4d_a[i], bench_vec4d_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat4d_mul(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_mat4d_out[i] = mat4d_mul(bench_mat4d_A[i], bench_mat4d_B[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat4d_mul_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            mat4d_mul_to(&bench_mat4d_out[i], &bench_mat4d_A[i], &bench_mat4d_B[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat4d_nmul(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_mat4d_out[i] = mat4d_nmul(3, bench_mat4d_A[i], bench_mat4d_B[i], bench_mat4d_I[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat4d_mul_chain(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        bench_mat4d_out[0] = mat4d_mul_chain(bench_mat4d_I, bench_batch);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat4d_mul_vec(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec4d_out[i] = mat4d_mul_vec(bench_mat4d_A[i], bench_vec4d_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat4d_mul_vec_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            mat4d_mul_vec_to(&bench_vec4d_out[i], &bench_mat4d_A[i], &bench_vec4d_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat4d_hadamard(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_mat4d_out[i] = mat4d_hadamard(bench_mat4d_A[i], bench_mat4d_B[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat4d_hadamard_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            mat4d_hadamard_to(&bench_mat4d_out[i], &bench_mat4d_A[i], &bench_mat4d_B[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat4d_rotate(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_mat4d_out[i] = mat4d_rotate(bench_mat4d_A[i], AXIS_Z, 0.5);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat4d_rotate_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            mat4d_rotate_to(&bench_mat4d_out[i], &bench_mat4d_A[i], AXIS_Z, 0.5);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat4d_transpose(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_mat4d_out[i] = mat4d_transpose(bench_mat4d_A[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat4d_det(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec4d_scalars[i] = mat4d_det(bench_mat4d_A[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat4d_inverse(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_mat4d_out[i] = mat4d_inverse(bench_mat4d_B[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat4d_inverse_array(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        mat4d_inverse_array(bench_mat4d_B, bench_mat4d_out, bench_batch);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat4d_inverse_affine(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_mat4d_out[i] = mat4d_inverse_affine(bench_mat4d_B[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat4d_transform_array(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        mat4d_transform_array(&bench_mat4d_A[0], bench_vec4d_a, bench_vec4d_out, bench_batch);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4d_soa_from_aos(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec4d_soa_from_aos(bench_vec4d_soa_out, bench_vec4d_a);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4d_soa_to_aos(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec4d_soa_to_aos(bench_vec4d_out, bench_vec4d_soa_a);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4d_soa_add(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec4d_soa_add(bench_vec4d_soa_out, bench_vec4d_soa_a, bench_vec4d_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4d_soa_sub(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec4d_soa_sub(bench_vec4d_soa_out, bench_vec4d_soa_a, bench_vec4d_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4d_soa_mul(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec4d_soa_mul(bench_vec4d_soa_out, bench_vec4d_soa_a, bench_vec4d_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4d_soa_div(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec4d_soa_div(bench_vec4d_soa_out, bench_vec4d_soa_a, bench_vec4d_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4d_soa_mod(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec4d_soa_mod(bench_vec4d_soa_out, bench_vec4d_soa_a, bench_vec4d_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4d_soa_min(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec4d_soa_min(bench_vec4d_soa_out, bench_vec4d_soa_a, bench_vec4d_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4d_soa_max(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec4d_soa_max(bench_vec4d_soa_out, bench_vec4d_soa_a, bench_vec4d_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4d_soa_floor(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec4d_soa_floor(bench_vec4d_soa_out, bench_vec4d_soa_a);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4d_soa_ceil(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec4d_soa_ceil(bench_vec4d_soa_out, bench_vec4d_soa_a);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4d_soa_clamp(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec4d_soa_clamp(bench_vec4d_soa_out, bench_vec4d_soa_a, bench_vec4d_soa_b, bench_vec4d_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4d_soa_abs(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec4d_soa_abs(bench_vec4d_soa_out, bench_vec4d_soa_a);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4d_soa_lerp(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec4d_soa_lerp(bench_vec4d_soa_out, bench_vec4d_soa_a, bench_vec4d_soa_b, bench_vec4d_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4d_soa_dot(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec4d_soa_dot(bench_vec4d_scalars, bench_vec4d_soa_a, bench_vec4d_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4d_soa_2norm(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec4d_soa_2norm(bench_vec4d_scalars, bench_vec4d_soa_a);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4d_soa_unit(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec4d_soa_unit(bench_vec4d_soa_out, bench_vec4d_soa_a);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat4d_mul_vec_soa(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        mat4d_mul_vec_soa(bench_vec4d_soa_out, bench_mat4d_A[0], bench_vec4d_soa_a);
+        BENCH_CLOBBER();
+    }
+}
+
+vec4i_t bench_vec4i_a[BENCH_BATCH], bench_vec4i_b[BENCH_BATCH], bench_vec4i_c[BENCH_BATCH];
+vec4i_t bench_vec4i_ones[BENCH_BATCH], bench_vec4i_out[BENCH_BATCH];
+int bench_vec4i_scalars[BENCH_BATCH];
+mat4i_t bench_mat4i_A[BENCH_BATCH], bench_mat4i_B[BENCH_BATCH], bench_mat4i_I[BENCH_BATCH], bench_mat4i_out[BENCH_BATCH];
+int bench_vec4i_soa_streams[3][4][BENCH_BATCH];
+vec4i_soa_t bench_vec4i_soa_a, bench_vec4i_soa_b, bench_vec4i_soa_out;
+
+static void bench_vec4i_init(void) {
+    for (size_t i = 0; i < BENCH_BATCH; ++i) {
+        for (size_t k = 0; k < 4; ++k) {
+            bench_vec4i_a[i].e[k] = (int)(1 + (i * 7 + k * 3) % 13);
+            bench_vec4i_b[i].e[k] = (int)(1 + (i * 5 + k * 11) % 13);
+            bench_vec4i_c[i].e[k] = (int)(1 + (i * 3 + k * 7) % 13);
+            bench_vec4i_ones[i].e[k] = 1;
+        }
+        for (size_t k = 0; k < 16; ++k) {
+            bench_mat4i_A[i].e[k] = (int)(1 + (i * 7 + k * 3) % 13);
+            bench_mat4i_B[i].e[k] = (int)(1 + (i * 5 + k * 11) % 13);
+        }
+        bench_mat4i_I[i] = mat4i_I();
+    }
+    bench_vec4i_soa_a.x = bench_vec4i_soa_streams[0][0];
+    bench_vec4i_soa_a.y = bench_vec4i_soa_streams[0][1];
+    bench_vec4i_soa_a.z = bench_vec4i_soa_streams[0][2];
+    bench_vec4i_soa_a.w = bench_vec4i_soa_streams[0][3];
+    bench_vec4i_soa_a.n = BENCH_BATCH;
+    bench_vec4i_soa_b.x = bench_vec4i_soa_streams[1][0];
+    bench_vec4i_soa_b.y = bench_vec4i_soa_streams[1][1];
+    bench_vec4i_soa_b.z = bench_vec4i_soa_streams[1][2];
+    bench_vec4i_soa_b.w = bench_vec4i_soa_streams[1][3];
+    bench_vec4i_soa_b.n = BENCH_BATCH;
+    bench_vec4i_soa_out.x = bench_vec4i_soa_streams[2][0];
+    bench_vec4i_soa_out.y = bench_vec4i_soa_streams[2][1];
+    bench_vec4i_soa_out.z = bench_vec4i_soa_streams[2][2];
+    bench_vec4i_soa_out.w = bench_vec4i_soa_streams[2][3];
+    bench_vec4i_soa_out.n = BENCH_BATCH;
+    vec4i_soa_from_aos(bench_vec4i_soa_a, bench_vec4i_a);
+    vec4i_soa_from_aos(bench_vec4i_soa_b, bench_vec4i_b);
+}
+
+static void bench_vec4i_add(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec4i_out[i] = vec4i_add(bench_vec4i_a[i], bench_vec4i_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4i_add_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec4i_add_to(&bench_vec4i_out[i], &bench_vec4i_a[i], &bench_vec4i_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4i_add_assign(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec4i_add_assign(&bench_vec4i_out[i], bench_vec4i_ones[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4i_sub(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec4i_out[i] = vec4i_sub(bench_vec4i_a[i], bench_vec4i_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4i_sub_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec4i_sub_to(&bench_vec4i_out[i], &bench_vec4i_a[i], &bench_vec4i_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4i_sub_assign(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec4i_sub_assign(&bench_vec4i_out[i], bench_vec4i_ones[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4i_mul(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec4i_out[i] = vec4i_mul(bench_vec4i_a[i], bench_vec4i_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4i_mul_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec4i_mul_to(&bench_vec4i_out[i], &bench_vec4i_a[i], &bench_vec4i_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4i_mul_assign(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec4i_mul_assign(&bench_vec4i_out[i], bench_vec4i_ones[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4i_div(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec4i_out[i] = vec4i_div(bench_vec4i_a[i], bench_vec4i_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4i_div_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec4i_div_to(&bench_vec4i_out[i], &bench_vec4i_a[i], &bench_vec4i_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4i_div_assign(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec4i_div_assign(&bench_vec4i_out[i], bench_vec4i_ones[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4i_mod(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec4i_out[i] = vec4i_mod(bench_vec4i_a[i], bench_vec4i_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4i_mod_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec4i_mod_to(&bench_vec4i_out[i], &bench_vec4i_a[i], &bench_vec4i_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4i_mod_assign(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec4i_mod_assign(&bench_vec4i_out[i], bench_vec4i_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4i_min(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec4i_out[i] = vec4i_min(bench_vec4i_a[i], bench_vec4i_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4i_min_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec4i_min_to(&bench_vec4i_out[i], &bench_vec4i_a[i], &bench_vec4i_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4i_max(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec4i_out[i] = vec4i_max(bench_vec4i_a[i], bench_vec4i_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4i_max_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec4i_max_to(&bench_vec4i_out[i], &bench_vec4i_a[i], &bench_vec4i_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4i_clamp(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec4i_out[i] = vec4i_clamp(bench_vec4i_a[i], bench_vec4i_ones[i], bench_vec4i_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4i_clamp_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec4i_clamp_to(&bench_vec4i_out[i], &bench_vec4i_a[i], &bench_vec4i_ones[i], &bench_vec4i_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4i_abs(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec4i_out[i] = vec4i_abs(bench_vec4i_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4i_abs_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec4i_abs_to(&bench_vec4i_out[i], &bench_vec4i_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4i_sum(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec4i_out[i] = vec4i_sum(3, bench_vec4i_a[i], bench_vec4i_ones[i], bench_vec4i_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4i_sum_array(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        bench_vec4i_out[0] = vec4i_sum_array(bench_vec4i_a, bench_batch);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4i_product(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec4i_out[i] = vec4i_product(3, bench_vec4i_a[i], bench_vec4i_ones[i], bench_vec4i_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4i_product_array(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        bench_vec4i_out[0] = vec4i_product_array(bench_vec4i_ones, bench_batch);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4i_dot(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec4i_scalars[i] = vec4i_dot(bench_vec4i_a[i], bench_vec4i_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4i_sqrlen(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec4i_scalars[i] = vec4i_sqrlen(bench_vec4i_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4i_1norm(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec4i_scalars[i] = vec4i_1norm(bench_vec4i_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4i_reflect(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec4i_out[i] = vec4i_reflect(bench_vec4i_a[i], bench_vec4i_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat4i_mul(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_mat4i_out[i] = mat4i_mul(bench_mat4i_A[i], bench_mat4i_B[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat4i_mul_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            mat4i_mul_to(&bench_mat4i_out[i], &bench_mat4i_A[i], &bench_mat4i_B[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat4i_nmul(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_mat4i_out[i] = mat4i_nmul(3, bench_mat4i_A[i], bench_mat4i_B[i], bench_mat4i_I[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat4i_mul_chain(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        bench_mat4i_out[0] = mat4i_mul_chain(bench_mat4i_I, bench_batch);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat4i_mul_vec(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec4i_out[i] = mat4i_mul_vec(bench_mat4i_A[i], bench_vec4i_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat4i_mul_vec_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            mat4i_mul_vec_to(&bench_vec4i_out[i], &bench_mat4i_A[i], &bench_vec4i_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat4i_hadamard(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_mat4i_out[i] = mat4i_hadamard(bench_mat4i_A[i], bench_mat4i_B[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat4i_hadamard_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            mat4i_hadamard_to(&bench_mat4i_out[i], &bench_mat4i_A[i], &bench_mat4i_B[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat4i_transpose(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_mat4i_out[i] = mat4i_transpose(bench_mat4i_A[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat4i_transform_array(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        mat4i_transform_array(&bench_mat4i_A[0], bench_vec4i_a, bench_vec4i_out, bench_batch);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4i_soa_from_aos(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec4i_soa_from_aos(bench_vec4i_soa_out, bench_vec4i_a);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4i_soa_to_aos(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec4i_soa_to_aos(bench_vec4i_out, bench_vec4i_soa_a);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4i_soa_add(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec4i_soa_add(bench_vec4i_soa_out, bench_vec4i_soa_a, bench_vec4i_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4i_soa_sub(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec4i_soa_sub(bench_vec4i_soa_out, bench_vec4i_soa_a, bench_vec4i_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4i_soa_mul(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec4i_soa_mul(bench_vec4i_soa_out, bench_vec4i_soa_a, bench_vec4i_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4i_soa_div(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec4i_soa_div(bench_vec4i_soa_out, bench_vec4i_soa_a, bench_vec4i_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4i_soa_mod(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec4i_soa_mod(bench_vec4i_soa_out, bench_vec4i_soa_a, bench_vec4i_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4i_soa_min(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec4i_soa_min(bench_vec4i_soa_out, bench_vec4i_soa_a, bench_vec4i_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4i_soa_max(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec4i_soa_max(bench_vec4i_soa_out, bench_vec4i_soa_a, bench_vec4i_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4i_soa_clamp(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec4i_soa_clamp(bench_vec4i_soa_out, bench_vec4i_soa_a, bench_vec4i_soa_b, bench_vec4i_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4i_soa_abs(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec4i_soa_abs(bench_vec4i_soa_out, bench_vec4i_soa_a);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4i_soa_dot(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec4i_soa_dot(bench_vec4i_scalars, bench_vec4i_soa_a, bench_vec4i_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat4i_mul_vec_soa(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        mat4i_mul_vec_soa(bench_vec4i_soa_out, bench_mat4i_A[0], bench_vec4i_soa_a);
+        BENCH_CLOBBER();
+    }
+}
+
+vec4u_t bench_vec4u_a[BENCH_BATCH], bench_vec4u_b[BENCH_BATCH], bench_vec4u_c[BENCH_BATCH];
+vec4u_t bench_vec4u_ones[BENCH_BATCH], bench_vec4u_out[BENCH_BATCH];
+unsigned int bench_vec4u_scalars[BENCH_BATCH];
+mat4u_t bench_mat4u_A[BENCH_BATCH], bench_mat4u_B[BENCH_BATCH], bench_mat4u_I[BENCH_BATCH], bench_mat4u_out[BENCH_BATCH];
+unsigned int bench_vec4u_soa_streams[3][4][BENCH_BATCH];
+vec4u_soa_t bench_vec4u_soa_a, bench_vec4u_soa_b, bench_vec4u_soa_out;
+
+static void bench_vec4u_init(void) {
+    for (size_t i = 0; i < BENCH_BATCH; ++i) {
+        for (size_t k = 0; k < 4; ++k) {
+            bench_vec4u_a[i].e[k] = (unsigned int)(1 + (i * 7 + k * 3) % 13);
+            bench_vec4u_b[i].e[k] = (unsigned int)(1 + (i * 5 + k * 11) % 13);
+            bench_vec4u_c[i].e[k] = (unsigned int)(1 + (i * 3 + k * 7) % 13);
+            bench_vec4u_ones[i].e[k] = 1;
+        }
+        for (size_t k = 0; k < 16; ++k) {
+            bench_mat4u_A[i].e[k] = (unsigned int)(1 + (i * 7 + k * 3) % 13);
+            bench_mat4u_B[i].e[k] = (unsigned int)(1 + (i * 5 + k * 11) % 13);
+        }
+        bench_mat4u_I[i] = mat4u_I();
+    }
+    bench_vec4u_soa_a.x = bench_vec4u_soa_streams[0][0];
+    bench_vec4u_soa_a.y = bench_vec4u_soa_streams[0][1];
+    bench_vec4u_soa_a.z = bench_vec4u_soa_streams[0][2];
+    bench_vec4u_soa_a.w = bench_vec4u_soa_streams[0][3];
+    bench_vec4u_soa_a.n = BENCH_BATCH;
+    bench_vec4u_soa_b.x = bench_vec4u_soa_streams[1][0];
+    bench_vec4u_soa_b.y = bench_vec4u_soa_streams[1][1];
+    bench_vec4u_soa_b.z = bench_vec4u_soa_streams[1][2];
+    bench_vec4u_soa_b.w = bench_vec4u_soa_streams[1][3];
+    bench_vec4u_soa_b.n = BENCH_BATCH;
+    bench_vec4u_soa_out.x = bench_vec4u_soa_streams[2][0];
+    bench_vec4u_soa_out.y = bench_vec4u_soa_streams[2][1];
+    bench_vec4u_soa_out.z = bench_vec4u_soa_streams[2][2];
+    bench_vec4u_soa_out.w = bench_vec4u_soa_streams[2][3];
+    bench_vec4u_soa_out.n = BENCH_BATCH;
+    vec4u_soa_from_aos(bench_vec4u_soa_a, bench_vec4u_a);
+    vec4u_soa_from_aos(bench_vec4u_soa_b, bench_vec4u_b);
+}
+
+static void bench_vec4u_add(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec4u_out[i] = vec4u_add(bench_vec4u_a[i], bench_vec4u_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4u_add_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec4u_add_to(&bench_vec4u_out[i], &bench_vec4u_a[i], &bench_vec4u_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4u_add_assign(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec4u_add_assign(&bench_vec4u_out[i], bench_vec4u_ones[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4u_sub(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec4u_out[i] = vec4u_sub(bench_vec4u_a[i], bench_vec4u_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4u_sub_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec4u_sub_to(&bench_vec4u_out[i], &bench_vec4u_a[i], &bench_vec4u_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4u_sub_assign(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec4u_sub_assign(&bench_vec4u_out[i], bench_vec4u_ones[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4u_mul(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec4u_out[i] = vec4u_mul(bench_vec4u_a[i], bench_vec4u_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4u_mul_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec4u_mul_to(&bench_vec4u_out[i], &bench_vec4u_a[i], &bench_vec4u_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4u_mul_assign(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec4u_mul_assign(&bench_vec4u_out[i], bench_vec4u_ones[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4u_div(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec4u_out[i] = vec4u_div(bench_vec4u_a[i], bench_vec4u_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4u_div_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec4u_div_to(&bench_vec4u_out[i], &bench_vec4u_a[i], &bench_vec4u_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4u_div_assign(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec4u_div_assign(&bench_vec4u_out[i], bench_vec4u_ones[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4u_mod(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec4u_out[i] = vec4u_mod(bench_vec4u_a[i], bench_vec4u_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4u_mod_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec4u_mod_to(&bench_vec4u_out[i], &bench_vec4u_a[i], &bench_vec4u_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4u_mod_assign(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec4u_mod_assign(&bench_vec4u_out[i], bench_vec4u_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4u_min(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec4u_out[i] = vec4u_min(bench_vec4u_a[i], bench_vec4u_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4u_min_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec4u_min_to(&bench_vec4u_out[i], &bench_vec4u_a[i], &bench_vec4u_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4u_max(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec4u_out[i] = vec4u_max(bench_vec4u_a[i], bench_vec4u_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4u_max_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec4u_max_to(&bench_vec4u_out[i], &bench_vec4u_a[i], &bench_vec4u_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4u_clamp(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec4u_out[i] = vec4u_clamp(bench_vec4u_a[i], bench_vec4u_ones[i], bench_vec4u_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4u_clamp_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            vec4u_clamp_to(&bench_vec4u_out[i], &bench_vec4u_a[i], &bench_vec4u_ones[i], &bench_vec4u_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4u_sum(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec4u_out[i] = vec4u_sum(3, bench_vec4u_a[i], bench_vec4u_ones[i], bench_vec4u_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4u_sum_array(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        bench_vec4u_out[0] = vec4u_sum_array(bench_vec4u_a, bench_batch);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4u_product(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec4u_out[i] = vec4u_product(3, bench_vec4u_a[i], bench_vec4u_ones[i], bench_vec4u_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4u_product_array(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        bench_vec4u_out[0] = vec4u_product_array(bench_vec4u_ones, bench_batch);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4u_dot(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec4u_scalars[i] = vec4u_dot(bench_vec4u_a[i], bench_vec4u_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4u_sqrlen(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec4u_scalars[i] = vec4u_sqrlen(bench_vec4u_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4u_1norm(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec4u_scalars[i] = vec4u_1norm(bench_vec4u_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4u_reflect(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec4u_out[i] = vec4u_reflect(bench_vec4u_a[i], bench_vec4u_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat4u_mul(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_mat4u_out[i] = mat4u_mul(bench_mat4u_A[i], bench_mat4u_B[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat4u_mul_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            mat4u_mul_to(&bench_mat4u_out[i], &bench_mat4u_A[i], &bench_mat4u_B[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat4u_nmul(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_mat4u_out[i] = mat4u_nmul(3, bench_mat4u_A[i], bench_mat4u_B[i], bench_mat4u_I[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat4u_mul_chain(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        bench_mat4u_out[0] = mat4u_mul_chain(bench_mat4u_I, bench_batch);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat4u_mul_vec(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec4u_out[i] = mat4u_mul_vec(bench_mat4u_A[i], bench_vec4u_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat4u_mul_vec_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            mat4u_mul_vec_to(&bench_vec4u_out[i], &bench_mat4u_A[i], &bench_vec4u_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat4u_hadamard(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_mat4u_out[i] = mat4u_hadamard(bench_mat4u_A[i], bench_mat4u_B[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat4u_hadamard_to(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            mat4u_hadamard_to(&bench_mat4u_out[i], &bench_mat4u_A[i], &bench_mat4u_B[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat4u_transpose(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_mat4u_out[i] = mat4u_transpose(bench_mat4u_A[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat4u_transform_array(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        mat4u_transform_array(&bench_mat4u_A[0], bench_vec4u_a, bench_vec4u_out, bench_batch);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4u_soa_from_aos(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec4u_soa_from_aos(bench_vec4u_soa_out, bench_vec4u_a);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4u_soa_to_aos(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec4u_soa_to_aos(bench_vec4u_out, bench_vec4u_soa_a);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4u_soa_add(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec4u_soa_add(bench_vec4u_soa_out, bench_vec4u_soa_a, bench_vec4u_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4u_soa_sub(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec4u_soa_sub(bench_vec4u_soa_out, bench_vec4u_soa_a, bench_vec4u_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4u_soa_mul(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec4u_soa_mul(bench_vec4u_soa_out, bench_vec4u_soa_a, bench_vec4u_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4u_soa_div(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec4u_soa_div(bench_vec4u_soa_out, bench_vec4u_soa_a, bench_vec4u_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4u_soa_mod(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec4u_soa_mod(bench_vec4u_soa_out, bench_vec4u_soa_a, bench_vec4u_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4u_soa_min(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec4u_soa_min(bench_vec4u_soa_out, bench_vec4u_soa_a, bench_vec4u_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4u_soa_max(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec4u_soa_max(bench_vec4u_soa_out, bench_vec4u_soa_a, bench_vec4u_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4u_soa_clamp(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec4u_soa_clamp(bench_vec4u_soa_out, bench_vec4u_soa_a, bench_vec4u_soa_b, bench_vec4u_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4u_soa_dot(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec4u_soa_dot(bench_vec4u_scalars, bench_vec4u_soa_a, bench_vec4u_soa_b);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat4u_mul_vec_soa(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        mat4u_mul_vec_soa(bench_vec4u_soa_out, bench_mat4u_A[0], bench_vec4u_soa_a);
+        BENCH_CLOBBER();
+    }
+}
+
+vec4h_t bench_vec4h_a[BENCH_BATCH], bench_vec4h_out[BENCH_BATCH];
+static void bench_vec4h_init(void) {
+    vec4h_from_vec4f_array(bench_vec4f_a, bench_vec4h_a, BENCH_BATCH);
+}
+
+static void bench_vec4h_to_vec4f_array(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec4h_to_vec4f_array(bench_vec4h_a, bench_vec4f_out, bench_batch);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_vec4h_from_vec4f_array(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        vec4h_from_vec4f_array(bench_vec4f_a, bench_vec4h_out, bench_batch);
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat4f_transform_array_h(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        mat4f_transform_array_h(&bench_mat4f_A[0], bench_vec4h_a, bench_vec4h_out, bench_batch);
+        BENCH_CLOBBER();
+    }
+}
+
+mat2x3f_t bench_mat2x3f_A[BENCH_BATCH], bench_mat2x3f_out[BENCH_BATCH];
+static void bench_mat2x3f_init(void) {
+    for (size_t i = 0; i < BENCH_BATCH; ++i) {
+        bench_mat2x3f_A[i] = mat2x3f_from_mat3f(bench_mat3f_A[i]);
+    }
+}
+
+static void bench_mat2x3f_mul_affine(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_mat2x3f_out[i] = mat2x3f_mul_affine(bench_mat2x3f_A[i], bench_mat2x3f_A[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat2x3f_transform_affine_array(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        mat2x3f_transform_affine_array(&bench_mat2x3f_A[0], bench_vec2f_a, bench_vec2f_out, bench_batch);
+        BENCH_CLOBBER();
+    }
+}
+
+mat2x3d_t bench_mat2x3d_A[BENCH_BATCH], bench_mat2x3d_out[BENCH_BATCH];
+static void bench_mat2x3d_init(void) {
+    for (size_t i = 0; i < BENCH_BATCH; ++i) {
+        bench_mat2x3d_A[i] = mat2x3d_from_mat3d(bench_mat3d_A[i]);
+    }
+}
+
+static void bench_mat2x3d_mul_affine(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_mat2x3d_out[i] = mat2x3d_mul_affine(bench_mat2x3d_A[i], bench_mat2x3d_A[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat2x3d_transform_affine_array(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        mat2x3d_transform_affine_array(&bench_mat2x3d_A[0], bench_vec2d_a, bench_vec2d_out, bench_batch);
+        BENCH_CLOBBER();
+    }
+}
+
+mat2x3i_t bench_mat2x3i_A[BENCH_BATCH], bench_mat2x3i_out[BENCH_BATCH];
+static void bench_mat2x3i_init(void) {
+    for (size_t i = 0; i < BENCH_BATCH; ++i) {
+        bench_mat2x3i_A[i] = mat2x3i_from_mat3i(bench_mat3i_A[i]);
+    }
+}
+
+static void bench_mat2x3i_mul_affine(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_mat2x3i_out[i] = mat2x3i_mul_affine(bench_mat2x3i_A[i], bench_mat2x3i_A[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat2x3i_transform_affine_array(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        mat2x3i_transform_affine_array(&bench_mat2x3i_A[0], bench_vec2i_a, bench_vec2i_out, bench_batch);
+        BENCH_CLOBBER();
+    }
+}
+
+mat2x3u_t bench_mat2x3u_A[BENCH_BATCH], bench_mat2x3u_out[BENCH_BATCH];
+static void bench_mat2x3u_init(void) {
+    for (size_t i = 0; i < BENCH_BATCH; ++i) {
+        bench_mat2x3u_A[i] = mat2x3u_from_mat3u(bench_mat3u_A[i]);
+    }
+}
+
+static void bench_mat2x3u_mul_affine(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_mat2x3u_out[i] = mat2x3u_mul_affine(bench_mat2x3u_A[i], bench_mat2x3u_A[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat2x3u_transform_affine_array(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        mat2x3u_transform_affine_array(&bench_mat2x3u_A[0], bench_vec2u_a, bench_vec2u_out, bench_batch);
+        BENCH_CLOBBER();
+    }
+}
+
+mat3x4f_t bench_mat3x4f_A[BENCH_BATCH], bench_mat3x4f_out[BENCH_BATCH];
+static void bench_mat3x4f_init(void) {
+    for (size_t i = 0; i < BENCH_BATCH; ++i) {
+        bench_mat3x4f_A[i] = mat3x4f_from_mat4f(bench_mat4f_A[i]);
+    }
+}
+
+static void bench_mat3x4f_mul_affine(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_mat3x4f_out[i] = mat3x4f_mul_affine(bench_mat3x4f_A[i], bench_mat3x4f_A[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat3x4f_transform_affine_array(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        mat3x4f_transform_affine_array(&bench_mat3x4f_A[0], bench_vec3f_a, bench_vec3f_out, bench_batch);
+        BENCH_CLOBBER();
+    }
+}
+
+mat3x4d_t bench_mat3x4d_A[BENCH_BATCH], bench_mat3x4d_out[BENCH_BATCH];
+static void bench_mat3x4d_init(void) {
+    for (size_t i = 0; i < BENCH_BATCH; ++i) {
+        bench_mat3x4d_A[i] = mat3x4d_from_mat4d(bench_mat4d_A[i]);
+    }
+}
+
+static void bench_mat3x4d_mul_affine(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_mat3x4d_out[i] = mat3x4d_mul_affine(bench_mat3x4d_A[i], bench_mat3x4d_A[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat3x4d_transform_affine_array(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        mat3x4d_transform_affine_array(&bench_mat3x4d_A[0], bench_vec3d_a, bench_vec3d_out, bench_batch);
+        BENCH_CLOBBER();
+    }
+}
+
+mat3x4i_t bench_mat3x4i_A[BENCH_BATCH], bench_mat3x4i_out[BENCH_BATCH];
+static void bench_mat3x4i_init(void) {
+    for (size_t i = 0; i < BENCH_BATCH; ++i) {
+        bench_mat3x4i_A[i] = mat3x4i_from_mat4i(bench_mat4i_A[i]);
+    }
+}
+
+static void bench_mat3x4i_mul_affine(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_mat3x4i_out[i] = mat3x4i_mul_affine(bench_mat3x4i_A[i], bench_mat3x4i_A[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat3x4i_transform_affine_array(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        mat3x4i_transform_affine_array(&bench_mat3x4i_A[0], bench_vec3i_a, bench_vec3i_out, bench_batch);
+        BENCH_CLOBBER();
+    }
+}
+
+mat3x4u_t bench_mat3x4u_A[BENCH_BATCH], bench_mat3x4u_out[BENCH_BATCH];
+static void bench_mat3x4u_init(void) {
+    for (size_t i = 0; i < BENCH_BATCH; ++i) {
+        bench_mat3x4u_A[i] = mat3x4u_from_mat4u(bench_mat4u_A[i]);
+    }
+}
+
+static void bench_mat3x4u_mul_affine(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_mat3x4u_out[i] = mat3x4u_mul_affine(bench_mat3x4u_A[i], bench_mat3x4u_A[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_mat3x4u_transform_affine_array(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        mat3x4u_transform_affine_array(&bench_mat3x4u_A[0], bench_vec3u_a, bench_vec3u_out, bench_batch);
+        BENCH_CLOBBER();
+    }
+}
+
+quatf_t bench_quatf_a[BENCH_BATCH], bench_quatf_b[BENCH_BATCH], bench_quatf_out[BENCH_BATCH];
+mat3f_t bench_quatf_R[BENCH_BATCH];
+
+static void bench_quatf_init(void) {
+    for (size_t i = 0; i < BENCH_BATCH; ++i) {
+        bench_quatf_a[i] = quatf_normalize(quatf(1, (float)(i % 7), 2, (float)(i % 5)));
+        bench_quatf_b[i] = quatf_normalize(quatf((float)(i % 3), 1, (float)(i % 11), 3));
+        bench_quatf_R[i] = quatf_to_mat3(bench_quatf_a[i]);
+    }
+}
+
+static void bench_quatf_mul(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_quatf_out[i] = quatf_mul(bench_quatf_a[i], bench_quatf_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_quatf_conjugate(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_quatf_out[i] = quatf_conjugate(bench_quatf_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_quatf_inverse(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_quatf_out[i] = quatf_inverse(bench_quatf_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_quatf_normalize(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_quatf_out[i] = quatf_normalize(bench_quatf_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_quatf_nlerp(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_quatf_out[i] = quatf_nlerp(bench_quatf_a[i], bench_quatf_b[i], 0.25);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_quatf_slerp(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_quatf_out[i] = quatf_slerp(bench_quatf_a[i], bench_quatf_b[i], 0.25);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_quatf_rotate_vec(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3f_out[i] = quatf_rotate_vec(bench_quatf_a[i], bench_vec3f_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_quatf_to_mat3(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_mat3f_out[i] = quatf_to_mat3(bench_quatf_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_quatf_to_mat4(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_mat4f_out[i] = quatf_to_mat4(bench_quatf_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_quatf_from_mat3(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_quatf_out[i] = quatf_from_mat3(bench_quatf_R[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+quatd_t bench_quatd_a[BENCH_BATCH], bench_quatd_b[BENCH_BATCH], bench_quatd_out[BENCH_BATCH];
+mat3d_t bench_quatd_R[BENCH_BATCH];
+
+static void bench_quatd_init(void) {
+    for (size_t i = 0; i < BENCH_BATCH; ++i) {
+        bench_quatd_a[i] = quatd_normalize(quatd(1, (double)(i % 7), 2, (double)(i % 5)));
+        bench_quatd_b[i] = quatd_normalize(quatd((double)(i % 3), 1, (double)(i % 11), 3));
+        bench_quatd_R[i] = quatd_to_mat3(bench_quatd_a[i]);
+    }
+}
+
+static void bench_quatd_mul(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_quatd_out[i] = quatd_mul(bench_quatd_a[i], bench_quatd_b[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_quatd_conjugate(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_quatd_out[i] = quatd_conjugate(bench_quatd_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_quatd_inverse(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_quatd_out[i] = quatd_inverse(bench_quatd_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_quatd_normalize(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_quatd_out[i] = quatd_normalize(bench_quatd_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_quatd_nlerp(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_quatd_out[i] = quatd_nlerp(bench_quatd_a[i], bench_quatd_b[i], 0.25);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_quatd_slerp(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_quatd_out[i] = quatd_slerp(bench_quatd_a[i], bench_quatd_b[i], 0.25);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_quatd_rotate_vec(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_vec3d_out[i] = quatd_rotate_vec(bench_quatd_a[i], bench_vec3d_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_quatd_to_mat3(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_mat3d_out[i] = quatd_to_mat3(bench_quatd_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_quatd_to_mat4(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_mat4d_out[i] = quatd_to_mat4(bench_quatd_a[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static void bench_quatd_from_mat3(size_t reps) {
+    for (size_t r = 0; r < reps; ++r) {
+        for (size_t i = 0; i < BENCH_BATCH; ++i) {
+            bench_quatd_out[i] = quatd_from_mat3(bench_quatd_R[i]);
+        }
+        BENCH_CLOBBER();
+    }
+}
+
+static const bench_case_t benches[] = {
+    {"vec_op", "vec2f_add", 2, "float", BENCH_BATCH, bench_vec2f_add},
+    {"vec_op_to", "vec2f_add_to", 2, "float", BENCH_BATCH, bench_vec2f_add_to},
+    {"vec_op_assign", "vec2f_add_assign", 2, "float", BENCH_BATCH, bench_vec2f_add_assign},
+    {"vec_op", "vec2f_sub", 2, "float", BENCH_BATCH, bench_vec2f_sub},
+    {"vec_op_to", "vec2f_sub_to", 2, "float", BENCH_BATCH, bench_vec2f_sub_to},
+    {"vec_op_assign", "vec2f_sub_assign", 2, "float", BENCH_BATCH, bench_vec2f_sub_assign},
+    {"vec_op", "vec2f_mul", 2, "float", BENCH_BATCH, bench_vec2f_mul},
+    {"vec_op_to", "vec2f_mul_to", 2, "float", BENCH_BATCH, bench_vec2f_mul_to},
+    {"vec_op_assign", "vec2f_mul_assign", 2, "float", BENCH_BATCH, bench_vec2f_mul_assign},
+    {"vec_op", "vec2f_div", 2, "float", BENCH_BATCH, bench_vec2f_div},
+    {"vec_op_to", "vec2f_div_to", 2, "float", BENCH_BATCH, bench_vec2f_div_to},
+    {"vec_op_assign", "vec2f_div_assign", 2, "float", BENCH_BATCH, bench_vec2f_div_assign},
+    {"vec_op", "vec2f_mod", 2, "float", BENCH_BATCH, bench_vec2f_mod},
+    {"vec_op_to", "vec2f_mod_to", 2, "float", BENCH_BATCH, bench_vec2f_mod_to},
+    {"vec_op_assign", "vec2f_mod_assign", 2, "float", BENCH_BATCH, bench_vec2f_mod_assign},
+    {"vec_fn", "vec2f_min", 2, "float", BENCH_BATCH, bench_vec2f_min},
+    {"vec_fn_to", "vec2f_min_to", 2, "float", BENCH_BATCH, bench_vec2f_min_to},
+    {"vec_fn", "vec2f_max", 2, "float", BENCH_BATCH, bench_vec2f_max},
+    {"vec_fn_to", "vec2f_max_to", 2, "float", BENCH_BATCH, bench_vec2f_max_to},
+    {"vec_fn", "vec2f_floor", 2, "float", BENCH_BATCH, bench_vec2f_floor},
+    {"vec_fn_to", "vec2f_floor_to", 2, "float", BENCH_BATCH, bench_vec2f_floor_to},
+    {"vec_fn", "vec2f_ceil", 2, "float", BENCH_BATCH, bench_vec2f_ceil},
+    {"vec_fn_to", "vec2f_ceil_to", 2, "float", BENCH_BATCH, bench_vec2f_ceil_to},
+    {"vec_fn", "vec2f_clamp", 2, "float", BENCH_BATCH, bench_vec2f_clamp},
+    {"vec_fn_to", "vec2f_clamp_to", 2, "float", BENCH_BATCH, bench_vec2f_clamp_to},
+    {"vec_fn", "vec2f_abs", 2, "float", BENCH_BATCH, bench_vec2f_abs},
+    {"vec_fn_to", "vec2f_abs_to", 2, "float", BENCH_BATCH, bench_vec2f_abs_to},
+    {"vec_fn", "vec2f_lerp", 2, "float", BENCH_BATCH, bench_vec2f_lerp},
+    {"vec_fn_to", "vec2f_lerp_to", 2, "float", BENCH_BATCH, bench_vec2f_lerp_to},
+    {"vec_variadic", "vec2f_sum", 2, "float", BENCH_BATCH, bench_vec2f_sum},
+    {"vec_array", "vec2f_sum_array", 2, "float", BENCH_BATCH, bench_vec2f_sum_array},
+    {"vec_variadic", "vec2f_product", 2, "float", BENCH_BATCH, bench_vec2f_product},
+    {"vec_array", "vec2f_product_array", 2, "float", BENCH_BATCH, bench_vec2f_product_array},
+    {"vec_metric", "vec2f_dot", 2, "float", BENCH_BATCH, bench_vec2f_dot},
+    {"vec_metric", "vec2f_sqrlen", 2, "float", BENCH_BATCH, bench_vec2f_sqrlen},
+    {"vec_metric", "vec2f_1norm", 2, "float", BENCH_BATCH, bench_vec2f_1norm},
+    {"vec_geometry", "vec2f_reflect", 2, "float", BENCH_BATCH, bench_vec2f_reflect},
+    {"vec_geometry", "vec2f_cross", 2, "float", BENCH_BATCH, bench_vec2f_cross},
+    {"vec_metric", "vec2f_2norm", 2, "float", BENCH_BATCH, bench_vec2f_2norm},
+    {"vec_metric", "vec2f_eq", 2, "float", BENCH_BATCH, bench_vec2f_eq},
+    {"vec_geometry", "vec2f_unit", 2, "float", BENCH_BATCH, bench_vec2f_unit},
+    {"vec_geometry", "vec2f_direction", 2, "float", BENCH_BATCH, bench_vec2f_direction},
+    {"vec_metric", "vec2f_angle_between", 2, "float", BENCH_BATCH, bench_vec2f_angle_between},
+    {"vec_geometry", "vec2f_unit_fast", 2, "float", BENCH_BATCH, bench_vec2f_unit_fast},
+    {"vec_metric", "vec2f_angle_between_fast", 2, "float", BENCH_BATCH, bench_vec2f_angle_between_fast},
+    {"mat", "mat2f_mul", 2, "float", BENCH_BATCH, bench_mat2f_mul},
+    {"mat", "mat2f_mul_to", 2, "float", BENCH_BATCH, bench_mat2f_mul_to},
+    {"mat", "mat2f_nmul", 2, "float", BENCH_BATCH, bench_mat2f_nmul},
+    {"mat", "mat2f_mul_chain", 2, "float", BENCH_BATCH, bench_mat2f_mul_chain},
+    {"mat", "mat2f_mul_vec", 2, "float", BENCH_BATCH, bench_mat2f_mul_vec},
+    {"mat", "mat2f_mul_vec_to", 2, "float", BENCH_BATCH, bench_mat2f_mul_vec_to},
+    {"mat", "mat2f_hadamard", 2, "float", BENCH_BATCH, bench_mat2f_hadamard},
+    {"mat", "mat2f_hadamard_to", 2, "float", BENCH_BATCH, bench_mat2f_hadamard_to},
+    {"mat", "mat2f_rotate", 2, "float", BENCH_BATCH, bench_mat2f_rotate},
+    {"mat", "mat2f_rotate_to", 2, "float", BENCH_BATCH, bench_mat2f_rotate_to},
+    {"mat", "mat2f_rotate_fast", 2, "float", BENCH_BATCH, bench_mat2f_rotate_fast},
+    {"mat", "mat2f_transpose", 2, "float", BENCH_BATCH, bench_mat2f_transpose},
+    {"mat", "mat2f_det", 2, "float", BENCH_BATCH, bench_mat2f_det},
+    {"mat", "mat2f_inverse", 2, "float", BENCH_BATCH, bench_mat2f_inverse},
+    {"batch", "mat2f_inverse_array", 2, "float", BENCH_BATCH, bench_mat2f_inverse_array},
+    {"batch", "mat2f_transform_array", 2, "float", BENCH_BATCH, bench_mat2f_transform_array},
+    {"batch", "vec2f_soa_from_aos", 2, "float", BENCH_BATCH, bench_vec2f_soa_from_aos},
+    {"batch", "vec2f_soa_to_aos", 2, "float", BENCH_BATCH, bench_vec2f_soa_to_aos},
+    {"batch", "vec2f_soa_add", 2, "float", BENCH_BATCH, bench_vec2f_soa_add},
+    {"batch", "vec2f_soa_sub", 2, "float", BENCH_BATCH, bench_vec2f_soa_sub},
+    {"batch", "vec2f_soa_mul", 2, "float", BENCH_BATCH, bench_vec2f_soa_mul},
+    {"batch", "vec2f_soa_div", 2, "float", BENCH_BATCH, bench_vec2f_soa_div},
+    {"batch", "vec2f_soa_mod", 2, "float", BENCH_BATCH, bench_vec2f_soa_mod},
+    {"batch", "vec2f_soa_min", 2, "float", BENCH_BATCH, bench_vec2f_soa_min},
+    {"batch", "vec2f_soa_max", 2, "float", BENCH_BATCH, bench_vec2f_soa_max},
+    {"batch", "vec2f_soa_floor", 2, "float", BENCH_BATCH, bench_vec2f_soa_floor},
+    {"batch", "vec2f_soa_ceil", 2, "float", BENCH_BATCH, bench_vec2f_soa_ceil},
+    {"batch", "vec2f_soa_clamp", 2, "float", BENCH_BATCH, bench_vec2f_soa_clamp},
+    {"batch", "vec2f_soa_abs", 2, "float", BENCH_BATCH, bench_vec2f_soa_abs},
+    {"batch", "vec2f_soa_lerp", 2, "float", BENCH_BATCH, bench_vec2f_soa_lerp},
+    {"batch", "vec2f_soa_dot", 2, "float", BENCH_BATCH, bench_vec2f_soa_dot},
+    {"batch", "vec2f_soa_2norm", 2, "float", BENCH_BATCH, bench_vec2f_soa_2norm},
+    {"batch", "vec2f_soa_unit", 2, "float", BENCH_BATCH, bench_vec2f_soa_unit},
+    {"batch", "mat2f_mul_vec_soa", 2, "float", BENCH_BATCH, bench_mat2f_mul_vec_soa},
+    {"vec_op", "vec2d_add", 2, "double", BENCH_BATCH, bench_vec2d_add},
+    {"vec_op_to", "vec2d_add_to", 2, "double", BENCH_BATCH, bench_vec2d_add_to},
+    {"vec_op_assign", "vec2d_add_assign", 2, "double", BENCH_BATCH, bench_vec2d_add_assign},
+    {"vec_op", "vec2d_sub", 2, "double", BENCH_BATCH, bench_vec2d_sub},
+    {"vec_op_to", "vec2d_sub_to", 2, "double", BENCH_BATCH, bench_vec2d_sub_to},
+    {"vec_op_assign", "vec2d_sub_assign", 2, "double", BENCH_BATCH, bench_vec2d_sub_assign},
+    {"vec_op", "vec2d_mul", 2, "double", BENCH_BATCH, bench_vec2d_mul},
+    {"vec_op_to", "vec2d_mul_to", 2, "double", BENCH_BATCH, bench_vec2d_mul_to},
+    {"vec_op_assign", "vec2d_mul_assign", 2, "double", BENCH_BATCH, bench_vec2d_mul_assign},
+    {"vec_op", "vec2d_div", 2, "double", BENCH_BATCH, bench_vec2d_div},
+    {"vec_op_to", "vec2d_div_to", 2, "double", BENCH_BATCH, bench_vec2d_div_to},
+    {"vec_op_assign", "vec2d_div_assign", 2, "double", BENCH_BATCH, bench_vec2d_div_assign},
+    {"vec_op", "vec2d_mod", 2, "double", BENCH_BATCH, bench_vec2d_mod},
+    {"vec_op_to", "vec2d_mod_to", 2, "double", BENCH_BATCH, bench_vec2d_mod_to},
+    {"vec_op_assign", "vec2d_mod_assign", 2, "double", BENCH_BATCH, bench_vec2d_mod_assign},
+    {"vec_fn", "vec2d_min", 2, "double", BENCH_BATCH, bench_vec2d_min},
+    {"vec_fn_to", "vec2d_min_to", 2, "double", BENCH_BATCH, bench_vec2d_min_to},
+    {"vec_fn", "vec2d_max", 2, "double", BENCH_BATCH, bench_vec2d_max},
+    {"vec_fn_to", "vec2d_max_to", 2, "double", BENCH_BATCH, bench_vec2d_max_to},
+    {"vec_fn", "vec2d_floor", 2, "double", BENCH_BATCH, bench_vec2d_floor},
+    {"vec_fn_to", "vec2d_floor_to", 2, "double", BENCH_BATCH, bench_vec2d_floor_to},
+    {"vec_fn", "vec2d_ceil", 2, "double", BENCH_BATCH, bench_vec2d_ceil},
+    {"vec_fn_to", "vec2d_ceil_to", 2, "double", BENCH_BATCH, bench_vec2d_ceil_to},
+    {"vec_fn", "vec2d_clamp", 2, "double", BENCH_BATCH, bench_vec2d_clamp},
+    {"vec_fn_to", "vec2d_clamp_to", 2, "double", BENCH_BATCH, bench_vec2d_clamp_to},
+    {"vec_fn", "vec2d_abs", 2, "double", BENCH_BATCH, bench_vec2d_abs},
+    {"vec_fn_to", "vec2d_abs_to", 2, "double", BENCH_BATCH, bench_vec2d_abs_to},
+    {"vec_fn", "vec2d_lerp", 2, "double", BENCH_BATCH, bench_vec2d_lerp},
+    {"vec_fn_to", "vec2d_lerp_to", 2, "double", BENCH_BATCH, bench_vec2d_lerp_to},
+    {"vec_variadic", "vec2d_sum", 2, "double", BENCH_BATCH, bench_vec2d_sum},
+    {"vec_array", "vec2d_sum_array", 2, "double", BENCH_BATCH, bench_vec2d_sum_array},
+    {"vec_variadic", "vec2d_product", 2, "double", BENCH_BATCH, bench_vec2d_product},
+    {"vec_array", "vec2d_product_array", 2, "double", BENCH_BATCH, bench_vec2d_product_array},
+    {"vec_metric", "vec2d_dot", 2, "double", BENCH_BATCH, bench_vec2d_dot},
+    {"vec_metric", "vec2d_sqrlen", 2, "double", BENCH_BATCH, bench_vec2d_sqrlen},
+    {"vec_metric", "vec2d_1norm", 2, "double", BENCH_BATCH, bench_vec2d_1norm},
+    {"vec_geometry", "vec2d_reflect", 2, "double", BENCH_BATCH, bench_vec2d_reflect},
+    {"vec_geometry", "vec2d_cross", 2, "double", BENCH_BATCH, bench_vec2d_cross},
+    {"vec_metric", "vec2d_2norm", 2, "double", BENCH_BATCH, bench_vec2d_2norm},
+    {"vec_metric", "vec2d_eq", 2, "double", BENCH_BATCH, bench_vec2d_eq},
+    {"vec_geometry", "vec2d_unit", 2, "double", BENCH_BATCH, bench_vec2d_unit},
+    {"vec_geometry", "vec2d_direction", 2, "double", BENCH_BATCH, bench_vec2d_direction},
+    {"vec_metric", "vec2d_angle_between", 2, "double", BENCH_BATCH, bench_vec2d_angle_between},
+    {"mat", "mat2d_mul", 2, "double", BENCH_BATCH, bench_mat2d_mul},
+    {"mat", "mat2d_mul_to", 2, "double", BENCH_BATCH, bench_mat2d_mul_to},
+    {"mat", "mat2d_nmul", 2, "double", BENCH_BATCH, bench_mat2d_nmul},
+    {"mat", "mat2d_mul_chain", 2, "double", BENCH_BATCH, bench_mat2d_mul_chain},
+    {"mat", "mat2d_mul_vec", 2, "double", BENCH_BATCH, bench_mat2d_mul_vec},
+    {"mat", "mat2d_mul_vec_to", 2, "double", BENCH_BATCH, bench_mat2d_mul_vec_to},
+    {"mat", "mat2d_hadamard", 2, "double", BENCH_BATCH, bench_mat2d_hadamard},
+    {"mat", "mat2d_hadamard_to", 2, "double", BENCH_BATCH, bench_mat2d_hadamard_to},
+    {"mat", "mat2d_rotate", 2, "double", BENCH_BATCH, bench_mat2d_rotate},
+    {"mat", "mat2d_rotate_to", 2, "double", BENCH_BATCH, bench_mat2d_rotate_to},
+    {"mat", "mat2d_transpose", 2, "double", BENCH_BATCH, bench_mat2d_transpose},
+    {"mat", "mat2d_det", 2, "double", BENCH_BATCH, bench_mat2d_det},
+    {"mat", "mat2d_inverse", 2, "double", BENCH_BATCH, bench_mat2d_inverse},
+    {"batch", "mat2d_inverse_array", 2, "double", BENCH_BATCH, bench_mat2d_inverse_array},
+    {"batch", "mat2d_transform_array", 2, "double", BENCH_BATCH, bench_mat2d_transform_array},
+    {"batch", "vec2d_soa_from_aos", 2, "double", BENCH_BATCH, bench_vec2d_soa_from_aos},
+    {"batch", "vec2d_soa_to_aos", 2, "double", BENCH_BATCH, bench_vec2d_soa_to_aos},
+    {"batch", "vec2d_soa_add", 2, "double", BENCH_BATCH, bench_vec2d_soa_add},
+    {"batch", "vec2d_soa_sub", 2, "double", BENCH_BATCH, bench_vec2d_soa_sub},
+    {"batch", "vec2d_soa_mul", 2, "double", BENCH_BATCH, bench_vec2d_soa_mul},
+    {"batch", "vec2d_soa_div", 2, "double", BENCH_BATCH, bench_vec2d_soa_div},
+    {"batch", "vec2d_soa_mod", 2, "double", BENCH_BATCH, bench_vec2d_soa_mod},
+    {"batch", "vec2d_soa_min", 2, "double", BENCH_BATCH, bench_vec2d_soa_min},
+    {"batch", "vec2d_soa_max", 2, "double", BENCH_BATCH, bench_vec2d_soa_max},
+    {"batch", "vec2d_soa_floor", 2, "double", BENCH_BATCH, bench_vec2d_soa_floor},
+    {"batch", "vec2d_soa_ceil", 2, "double", BENCH_BATCH, bench_vec2d_soa_ceil},
+    {"batch", "vec2d_soa_clamp", 2, "double", BENCH_BATCH, bench_vec2d_soa_clamp},
+    {"batch", "vec2d_soa_abs", 2, "double", BENCH_BATCH, bench_vec2d_soa_abs},
+    {"batch", "vec2d_soa_lerp", 2, "double", BENCH_BATCH, bench_vec2d_soa_lerp},
+    {"batch", "vec2d_soa_dot", 2, "double", BENCH_BATCH, bench_vec2d_soa_dot},
+    {"batch", "vec2d_soa_2norm", 2, "double", BENCH_BATCH, bench_vec2d_soa_2norm},
+    {"batch", "vec2d_soa_unit", 2, "double", BENCH_BATCH, bench_vec2d_soa_unit},
+    {"batch", "mat2d_mul_vec_soa", 2, "double", BENCH_BATCH, bench_mat2d_mul_vec_soa},
+    {"vec_op", "vec2i_add", 2, "int", BENCH_BATCH, bench_vec2i_add},
+    {"vec_op_to", "vec2i_add_to", 2, "int", BENCH_BATCH, bench_vec2i_add_to},
+    {"vec_op_assign", "vec2i_add_assign", 2, "int", BENCH_BATCH, bench_vec2i_add_assign},
+    {"vec_op", "vec2i_sub", 2, "int", BENCH_BATCH, bench_vec2i_sub},
+    {"vec_op_to", "vec2i_sub_to", 2, "int", BENCH_BATCH, bench_vec2i_sub_to},
+    {"vec_op_assign", "vec2i_sub_assign", 2, "int", BENCH_BATCH, bench_vec2i_sub_assign},
+    {"vec_op", "vec2i_mul", 2, "int", BENCH_BATCH, bench_vec2i_mul},
+    {"vec_op_to", "vec2i_mul_to", 2, "int", BENCH_BATCH, bench_vec2i_mul_to},
+    {"vec_op_assign", "vec2i_mul_assign", 2, "int", BENCH_BATCH, bench_vec2i_mul_assign},
+    {"vec_op", "vec2i_div", 2, "int", BENCH_BATCH, bench_vec2i_div},
+    {"vec_op_to", "vec2i_div_to", 2, "int", BENCH_BATCH, bench_vec2i_div_to},
+    {"vec_op_assign", "vec2i_div_assign", 2, "int", BENCH_BATCH, bench_vec2i_div_assign},
+    {"vec_op", "vec2i_mod", 2, "int", BENCH_BATCH, bench_vec2i_mod},
+    {"vec_op_to", "vec2i_mod_to", 2, "int", BENCH_BATCH, bench_vec2i_mod_to},
+    {"vec_op_assign", "vec2i_mod_assign", 2, "int", BENCH_BATCH, bench_vec2i_mod_assign},
+    {"vec_fn", "vec2i_min", 2, "int", BENCH_BATCH, bench_vec2i_min},
+    {"vec_fn_to", "vec2i_min_to", 2, "int", BENCH_BATCH, bench_vec2i_min_to},
+    {"vec_fn", "vec2i_max", 2, "int", BENCH_BATCH, bench_vec2i_max},
+    {"vec_fn_to", "vec2i_max_to", 2, "int", BENCH_BATCH, bench_vec2i_max_to},
+    {"vec_fn", "vec2i_clamp", 2, "int", BENCH_BATCH, bench_vec2i_clamp},
+    {"vec_fn_to", "vec2i_clamp_to", 2, "int", BENCH_BATCH, bench_vec2i_clamp_to},
+    {"vec_fn", "vec2i_abs", 2, "int", BENCH_BATCH, bench_vec2i_abs},
+    {"vec_fn_to", "vec2i_abs_to", 2, "int", BENCH_BATCH, bench_vec2i_abs_to},
+    {"vec_variadic", "vec2i_sum", 2, "int", BENCH_BATCH, bench_vec2i_sum},
+    {"vec_array", "vec2i_sum_array", 2, "int", BENCH_BATCH, bench_vec2i_sum_array},
+    {"vec_variadic", "vec2i_product", 2, "int", BENCH_BATCH, bench_vec2i_product},
+    {"vec_array", "vec2i_product_array", 2, "int", BENCH_BATCH, bench_vec2i_product_array},
+    {"vec_metric", "vec2i_dot", 2, "int", BENCH_BATCH, bench_vec2i_dot},
+    {"vec_metric", "vec2i_sqrlen", 2, "int", BENCH_BATCH, bench_vec2i_sqrlen},
+    {"vec_metric", "vec2i_1norm", 2, "int", BENCH_BATCH, bench_vec2i_1norm},
+    {"vec_geometry", "vec2i_reflect", 2, "int", BENCH_BATCH, bench_vec2i_reflect},
+    {"vec_geometry", "vec2i_cross", 2, "int", BENCH_BATCH, bench_vec2i_cross},
+    {"mat", "mat2i_mul", 2, "int", BENCH_BATCH, bench_mat2i_mul},
+    {"mat", "mat2i_mul_to", 2, "int", BENCH_BATCH, bench_mat2i_mul_to},
+    {"mat", "mat2i_nmul", 2, "int", BENCH_BATCH, bench_mat2i_nmul},
+    {"mat", "mat2i_mul_chain", 2, "int", BENCH_BATCH, bench_mat2i_mul_chain},
+    {"mat", "mat2i_mul_vec", 2, "int", BENCH_BATCH, bench_mat2i_mul_vec},
+    {"mat", "mat2i_mul_vec_to", 2, "int", BENCH_BATCH, bench_mat2i_mul_vec_to},
+    {"mat", "mat2i_hadamard", 2, "int", BENCH_BATCH, bench_mat2i_hadamard},
+    {"mat", "mat2i_hadamard_to", 2, "int", BENCH_BATCH, bench_mat2i_hadamard_to},
+    {"mat", "mat2i_transpose", 2, "int", BENCH_BATCH, bench_mat2i_transpose},
+    {"batch", "mat2i_transform_array", 2, "int", BENCH_BATCH, bench_mat2i_transform_array},
+    {"batch", "vec2i_soa_from_aos", 2, "int", BENCH_BATCH, bench_vec2i_soa_from_aos},
+    {"batch", "vec2i_soa_to_aos", 2, "int", BENCH_BATCH, bench_vec2i_soa_to_aos},
+    {"batch", "vec2i_soa_add", 2, "int", BENCH_BATCH, bench_vec2i_soa_add},
+    {"batch", "vec2i_soa_sub", 2, "int", BENCH_BATCH, bench_vec2i_soa_sub},
+    {"batch", "vec2i_soa_mul", 2, "int", BENCH_BATCH, bench_vec2i_soa_mul},
+    {"batch", "vec2i_soa_div", 2, "int", BENCH_BATCH, bench_vec2i_soa_div},
+    {"batch", "vec2i_soa_mod", 2, "int", BENCH_BATCH, bench_vec2i_soa_mod},
+    {"batch", "vec2i_soa_min", 2, "int", BENCH_BATCH, bench_vec2i_soa_min},
+    {"batch", "vec2i_soa_max", 2, "int", BENCH_BATCH, bench_vec2i_soa_max},
+    {"batch", "vec2i_soa_clamp", 2, "int", BENCH_BATCH, bench_vec2i_soa_clamp},
+    {"batch", "vec2i_soa_abs", 2, "int", BENCH_BATCH, bench_vec2i_soa_abs},
+    {"batch", "vec2i_soa_dot", 2, "int", BENCH_BATCH, bench_vec2i_soa_dot},
+    {"batch", "mat2i_mul_vec_soa", 2, "int", BENCH_BATCH, bench_mat2i_mul_vec_soa},
+    {"vec_op", "vec2u_add", 2, "unsigned int", BENCH_BATCH, bench_vec2u_add},
+    {"vec_op_to", "vec2u_add_to", 2, "unsigned int", BENCH_BATCH, bench_vec2u_add_to},
+    {"vec_op_assign", "vec2u_add_assign", 2, "unsigned int", BENCH_BATCH, bench_vec2u_add_assign},
+    {"vec_op", "vec2u_sub", 2, "unsigned int", BENCH_BATCH, bench_vec2u_sub},
+    {"vec_op_to", "vec2u_sub_to", 2, "unsigned int", BENCH_BATCH, bench_vec2u_sub_to},
+    {"vec_op_assign", "vec2u_sub_assign", 2, "unsigned int", BENCH_BATCH, bench_vec2u_sub_assign},
+    {"vec_op", "vec2u_mul", 2, "unsigned int", BENCH_BATCH, bench_vec2u_mul},
+    {"vec_op_to", "vec2u_mul_to", 2, "unsigned int", BENCH_BATCH, bench_vec2u_mul_to},
+    {"vec_op_assign", "vec2u_mul_assign", 2, "unsigned int", BENCH_BATCH, bench_vec2u_mul_assign},
+    {"vec_op", "vec2u_div", 2, "unsigned int", BENCH_BATCH, bench_vec2u_div},
+    {"vec_op_to", "vec2u_div_to", 2, "unsigned int", BENCH_BATCH, bench_vec2u_div_to},
+    {"vec_op_assign", "vec2u_div_assign", 2, "unsigned int", BENCH_BATCH, bench_vec2u_div_assign},
+    {"vec_op", "vec2u_mod", 2, "unsigned int", BENCH_BATCH, bench_vec2u_mod},
+    {"vec_op_to", "vec2u_mod_to", 2, "unsigned int", BENCH_BATCH, bench_vec2u_mod_to},
+    {"vec_op_assign", "vec2u_mod_assign", 2, "unsigned int", BENCH_BATCH, bench_vec2u_mod_assign},
+    {"vec_fn", "vec2u_min", 2, "unsigned int", BENCH_BATCH, bench_vec2u_min},
+    {"vec_fn_to", "vec2u_min_to", 2, "unsigned int", BENCH_BATCH, bench_vec2u_min_to},
+    {"vec_fn", "vec2u_max", 2, "unsigned int", BENCH_BATCH, bench_vec2u_max},
+    {"vec_fn_to", "vec2u_max_to", 2, "unsigned int", BENCH_BATCH, bench_vec2u_max_to},
+    {"vec_fn", "vec2u_clamp", 2, "unsigned int", BENCH_BATCH, bench_vec2u_clamp},
+    {"vec_fn_to", "vec2u_clamp_to", 2, "unsigned int", BENCH_BATCH, bench_vec2u_clamp_to},
+    {"vec_variadic", "vec2u_sum", 2, "unsigned int", BENCH_BATCH, bench_vec2u_sum},
+    {"vec_array", "vec2u_sum_array", 2, "unsigned int", BENCH_BATCH, bench_vec2u_sum_array},
+    {"vec_variadic", "vec2u_product", 2, "unsigned int", BENCH_BATCH, bench_vec2u_product},
+    {"vec_array", "vec2u_product_array", 2, "unsigned int", BENCH_BATCH, bench_vec2u_product_array},
+    {"vec_metric", "vec2u_dot", 2, "unsigned int", BENCH_BATCH, bench_vec2u_dot},
+    {"vec_metric", "vec2u_sqrlen", 2, "unsigned int", BENCH_BATCH, bench_vec2u_sqrlen},
+    {"vec_metric", "vec2u_1norm", 2, "unsigned int", BENCH_BATCH, bench_vec2u_1norm},
+    {"vec_geometry", "vec2u_reflect", 2, "unsigned int", BENCH_BATCH, bench_vec2u_reflect},
+    {"vec_geometry", "vec2u_cross", 2, "unsigned int", BENCH_BATCH, bench_vec2u_cross},
+    {"mat", "mat2u_mul", 2, "unsigned int", BENCH_BATCH, bench_mat2u_mul},
+    {"mat", "mat2u_mul_to", 2, "unsigned int", BENCH_BATCH, bench_mat2u_mul_to},
+    {"mat", "mat2u_nmul", 2, "unsigned int", BENCH_BATCH, bench_mat2u_nmul},
+    {"mat", "mat2u_mul_chain", 2, "unsigned int", BENCH_BATCH, bench_mat2u_mul_chain},
+    {"mat", "mat2u_mul_vec", 2, "unsigned int", BENCH_BATCH, bench_mat2u_mul_vec},
+    {"mat", "mat2u_mul_vec_to", 2, "unsigned int", BENCH_BATCH, bench_mat2u_mul_vec_to},
+    {"mat", "mat2u_hadamard", 2, "unsigned int", BENCH_BATCH, bench_mat2u_hadamard},
+    {"mat", "mat2u_hadamard_to", 2, "unsigned int", BENCH_BATCH, bench_mat2u_hadamard_to},
+    {"mat", "mat2u_transpose", 2, "unsigned int", BENCH_BATCH, bench_mat2u_transpose},
+    {"batch", "mat2u_transform_array", 2, "unsigned int", BENCH_BATCH, bench_mat2u_transform_array},
+    {"batch", "vec2u_soa_from_aos", 2, "unsigned int", BENCH_BATCH, bench_vec2u_soa_from_aos},
+    {"batch", "vec2u_soa_to_aos", 2, "unsigned int", BENCH_BATCH, bench_vec2u_soa_to_aos},
+    {"batch", "vec2u_soa_add", 2, "unsigned int", BENCH_BATCH, bench_vec2u_soa_add},
+    {"batch", "vec2u_soa_sub", 2, "unsigned int", BENCH_BATCH, bench_vec2u_soa_sub},
+    {"batch", "vec2u_soa_mul", 2, "unsigned int", BENCH_BATCH, bench_vec2u_soa_mul},
+    {"batch", "vec2u_soa_div", 2, "unsigned int", BENCH_BATCH, bench_vec2u_soa_div},
+    {"batch", "vec2u_soa_mod", 2, "unsigned int", BENCH_BATCH, bench_vec2u_soa_mod},
+    {"batch", "vec2u_soa_min", 2, "unsigned int", BENCH_BATCH, bench_vec2u_soa_min},
+    {"batch", "vec2u_soa_max", 2, "unsigned int", BENCH_BATCH, bench_vec2u_soa_max},
+    {"batch", "vec2u_soa_clamp", 2, "unsigned int", BENCH_BATCH, bench_vec2u_soa_clamp},
+    {"batch", "vec2u_soa_dot", 2, "unsigned int", BENCH_BATCH, bench_vec2u_soa_dot},
+    {"batch", "mat2u_mul_vec_soa", 2, "unsigned int", BENCH_BATCH, bench_mat2u_mul_vec_soa},
+    {"batch", "vec2h_to_vec2f_array", 2, "half_t", BENCH_BATCH, bench_vec2h_to_vec2f_array},
+    {"batch", "vec2h_from_vec2f_array", 2, "half_t", BENCH_BATCH, bench_vec2h_from_vec2f_array},
+    {"batch", "mat2f_transform_array_h", 2, "half_t", BENCH_BATCH, bench_mat2f_transform_array_h},
+    {"vec_op", "vec3f_add", 3, "float", BENCH_BATCH, bench_vec3f_add},
+    {"vec_op_to", "vec3f_add_to", 3, "float", BENCH_BATCH, bench_vec3f_add_to},
+    {"vec_op_assign", "vec3f_add_assign", 3, "float", BENCH_BATCH, bench_vec3f_add_assign},
+    {"vec_op", "vec3f_sub", 3, "float", BENCH_BATCH, bench_vec3f_sub},
+    {"vec_op_to", "vec3f_sub_to", 3, "float", BENCH_BATCH, bench_vec3f_sub_to},
+    {"vec_op_assign", "vec3f_sub_assign", 3, "float", BENCH_BATCH, bench_vec3f_sub_assign},
+    {"vec_op", "vec3f_mul", 3, "float", BENCH_BATCH, bench_vec3f_mul},
+    {"vec_op_to", "vec3f_mul_to", 3, "float", BENCH_BATCH, bench_vec3f_mul_to},
+    {"vec_op_assign", "vec3f_mul_assign", 3, "float", BENCH_BATCH, bench_vec3f_mul_assign},
+    {"vec_op", "vec3f_div", 3, "float", BENCH_BATCH, bench_vec3f_div},
+    {"vec_op_to", "vec3f_div_to", 3, "float", BENCH_BATCH, bench_vec3f_div_to},
+    {"vec_op_assign", "vec3f_div_assign", 3, "float", BENCH_BATCH, bench_vec3f_div_assign},
+    {"vec_op", "vec3f_mod", 3, "float", BENCH_BATCH, bench_vec3f_mod},
+    {"vec_op_to", "vec3f_mod_to", 3, "float", BENCH_BATCH, bench_vec3f_mod_to},
+    {"vec_op_assign", "vec3f_mod_assign", 3, "float", BENCH_BATCH, bench_vec3f_mod_assign},
+    {"vec_fn", "vec3f_min", 3, "float", BENCH_BATCH, bench_vec3f_min},
+    {"vec_fn_to", "vec3f_min_to", 3, "float", BENCH_BATCH, bench_vec3f_min_to},
+    {"vec_fn", "vec3f_max", 3, "float", BENCH_BATCH, bench_vec3f_max},
+    {"vec_fn_to", "vec3f_max_to", 3, "float", BENCH_BATCH, bench_vec3f_max_to},
+    {"vec_fn", "vec3f_floor", 3, "float", BENCH_BATCH, bench_vec3f_floor},
+    {"vec_fn_to", "vec3f_floor_to", 3, "float", BENCH_BATCH, bench_vec3f_floor_to},
+    {"vec_fn", "vec3f_ceil", 3, "float", BENCH_BATCH, bench_vec3f_ceil},
+    {"vec_fn_to", "vec3f_ceil_to", 3, "float", BENCH_BATCH, bench_vec3f_ceil_to},
+    {"vec_fn", "vec3f_clamp", 3, "float", BENCH_BATCH, bench_vec3f_clamp},
+    {"vec_fn_to", "vec3f_clamp_to", 3, "float", BENCH_BATCH, bench_vec3f_clamp_to},
+    {"vec_fn", "vec3f_abs", 3, "float", BENCH_BATCH, bench_vec3f_abs},
+    {"vec_fn_to", "vec3f_abs_to", 3, "float", BENCH_BATCH, bench_vec3f_abs_to},
+    {"vec_fn", "vec3f_lerp", 3, "float", BENCH_BATCH, bench_vec3f_lerp},
+    {"vec_fn_to", "vec3f_lerp_to", 3, "float", BENCH_BATCH, bench_vec3f_lerp_to},
+    {"vec_variadic", "vec3f_sum", 3, "float", BENCH_BATCH, bench_vec3f_sum},
+    {"vec_array", "vec3f_sum_array", 3, "float", BENCH_BATCH, bench_vec3f_sum_array},
+    {"vec_variadic", "vec3f_product", 3, "float", BENCH_BATCH, bench_vec3f_product},
+    {"vec_array", "vec3f_product_array", 3, "float", BENCH_BATCH, bench_vec3f_product_array},
+    {"vec_metric", "vec3f_dot", 3, "float", BENCH_BATCH, bench_vec3f_dot},
+    {"vec_metric", "vec3f_sqrlen", 3, "float", BENCH_BATCH, bench_vec3f_sqrlen},
+    {"vec_metric", "vec3f_1norm", 3, "float", BENCH_BATCH, bench_vec3f_1norm},
+    {"vec_geometry", "vec3f_reflect", 3, "float", BENCH_BATCH, bench_vec3f_reflect},
+    {"vec_geometry", "vec3f_cross", 3, "float", BENCH_BATCH, bench_vec3f_cross},
+    {"vec_metric", "vec3f_2norm", 3, "float", BENCH_BATCH, bench_vec3f_2norm},
+    {"vec_metric", "vec3f_eq", 3, "float", BENCH_BATCH, bench_vec3f_eq},
+    {"vec_geometry", "vec3f_unit", 3, "float", BENCH_BATCH, bench_vec3f_unit},
+    {"vec_geometry", "vec3f_direction", 3, "float", BENCH_BATCH, bench_vec3f_direction},
+    {"vec_metric", "vec3f_angle_between", 3, "float", BENCH_BATCH, bench_vec3f_angle_between},
+    {"vec_geometry", "vec3f_unit_fast", 3, "float", BENCH_BATCH, bench_vec3f_unit_fast},
+    {"vec_metric", "vec3f_angle_between_fast", 3, "float", BENCH_BATCH, bench_vec3f_angle_between_fast},
+    {"mat", "mat3f_mul", 3, "float", BENCH_BATCH, bench_mat3f_mul},
+    {"mat", "mat3f_mul_to", 3, "float", BENCH_BATCH, bench_mat3f_mul_to},
+    {"mat", "mat3f_nmul", 3, "float", BENCH_BATCH, bench_mat3f_nmul},
+    {"mat", "mat3f_mul_chain", 3, "float", BENCH_BATCH, bench_mat3f_mul_chain},
+    {"mat", "mat3f_mul_vec", 3, "float", BENCH_BATCH, bench_mat3f_mul_vec},
+    {"mat", "mat3f_mul_vec_to", 3, "float", BENCH_BATCH, bench_mat3f_mul_vec_to},
+    {"mat", "mat3f_hadamard", 3, "float", BENCH_BATCH, bench_mat3f_hadamard},
+    {"mat", "mat3f_hadamard_to", 3, "float", BENCH_BATCH, bench_mat3f_hadamard_to},
+    {"mat", "mat3f_rotate", 3, "float", BENCH_BATCH, bench_mat3f_rotate},
+    {"mat", "mat3f_rotate_to", 3, "float", BENCH_BATCH, bench_mat3f_rotate_to},
+    {"mat", "mat3f_rotate_fast", 3, "float", BENCH_BATCH, bench_mat3f_rotate_fast},
+    {"mat", "mat3f_transpose", 3, "float", BENCH_BATCH, bench_mat3f_transpose},
+    {"mat", "mat3f_det", 3, "float", BENCH_BATCH, bench_mat3f_det},
+    {"mat", "mat3f_inverse", 3, "float", BENCH_BATCH, bench_mat3f_inverse},
+    {"batch", "mat3f_inverse_array", 3, "float", BENCH_BATCH, bench_mat3f_inverse_array},
+    {"batch", "mat3f_transform_array", 3, "float", BENCH_BATCH, bench_mat3f_transform_array},
+    {"batch", "vec3f_soa_from_aos", 3, "float", BENCH_BATCH, bench_vec3f_soa_from_aos},
+    {"batch", "vec3f_soa_to_aos", 3, "float", BENCH_BATCH, bench_vec3f_soa_to_aos},
+    {"batch", "vec3f_soa_add", 3, "float", BENCH_BATCH, bench_vec3f_soa_add},
+    {"batch", "vec3f_soa_sub", 3, "float", BENCH_BATCH, bench_vec3f_soa_sub},
+    {"batch", "vec3f_soa_mul", 3, "float", BENCH_BATCH, bench_vec3f_soa_mul},
+    {"batch", "vec3f_soa_div", 3, "float", BENCH_BATCH, bench_vec3f_soa_div},
+    {"batch", "vec3f_soa_mod", 3, "float", BENCH_BATCH, bench_vec3f_soa_mod},
+    {"batch", "vec3f_soa_min", 3, "float", BENCH_BATCH, bench_vec3f_soa_min},
+    {"batch", "vec3f_soa_max", 3, "float", BENCH_BATCH, bench_vec3f_soa_max},
+    {"batch", "vec3f_soa_floor", 3, "float", BENCH_BATCH, bench_vec3f_soa_floor},
+    {"batch", "vec3f_soa_ceil", 3, "float", BENCH_BATCH, bench_vec3f_soa_ceil},
+    {"batch", "vec3f_soa_clamp", 3, "float", BENCH_BATCH, bench_vec3f_soa_clamp},
+    {"batch", "vec3f_soa_abs", 3, "float", BENCH_BATCH, bench_vec3f_soa_abs},
+    {"batch", "vec3f_soa_lerp", 3, "float", BENCH_BATCH, bench_vec3f_soa_lerp},
+    {"batch", "vec3f_soa_dot", 3, "float", BENCH_BATCH, bench_vec3f_soa_dot},
+    {"batch", "vec3f_soa_2norm", 3, "float", BENCH_BATCH, bench_vec3f_soa_2norm},
+    {"batch", "vec3f_soa_unit", 3, "float", BENCH_BATCH, bench_vec3f_soa_unit},
+    {"batch", "mat3f_mul_vec_soa", 3, "float", BENCH_BATCH, bench_mat3f_mul_vec_soa},
+    {"vec_op", "vec3d_add", 3, "double", BENCH_BATCH, bench_vec3d_add},
+    {"vec_op_to", "vec3d_add_to", 3, "double", BENCH_BATCH, bench_vec3d_add_to},
+    {"vec_op_assign", "vec3d_add_assign", 3, "double", BENCH_BATCH, bench_vec3d_add_assign},
+    {"vec_op", "vec3d_sub", 3, "double", BENCH_BATCH, bench_vec3d_sub},
+    {"vec_op_to", "vec3d_sub_to", 3, "double", BENCH_BATCH, bench_vec3d_sub_to},
+    {"vec_op_assign", "vec3d_sub_assign", 3, "double", BENCH_BATCH, bench_vec3d_sub_assign},
+    {"vec_op", "vec3d_mul", 3, "double", BENCH_BATCH, bench_vec3d_mul},
+    {"vec_op_to", "vec3d_mul_to", 3, "double", BENCH_BATCH, bench_vec3d_mul_to},
+    {"vec_op_assign", "vec3d_mul_assign", 3, "double", BENCH_BATCH, bench_vec3d_mul_assign},
+    {"vec_op", "vec3d_div", 3, "double", BENCH_BATCH, bench_vec3d_div},
+    {"vec_op_to", "vec3d_div_to", 3, "double", BENCH_BATCH, bench_vec3d_div_to},
+    {"vec_op_assign", "vec3d_div_assign", 3, "double", BENCH_BATCH, bench_vec3d_div_assign},
+    {"vec_op", "vec3d_mod", 3, "double", BENCH_BATCH, bench_vec3d_mod},
+    {"vec_op_to", "vec3d_mod_to", 3, "double", BENCH_BATCH, bench_vec3d_mod_to},
+    {"vec_op_assign", "vec3d_mod_assign", 3, "double", BENCH_BATCH, bench_vec3d_mod_assign},
+    {"vec_fn", "vec3d_min", 3, "double", BENCH_BATCH, bench_vec3d_min},
+    {"vec_fn_to", "vec3d_min_to", 3, "double", BENCH_BATCH, bench_vec3d_min_to},
+    {"vec_fn", "vec3d_max", 3, "double", BENCH_BATCH, bench_vec3d_max},
+    {"vec_fn_to", "vec3d_max_to", 3, "double", BENCH_BATCH, bench_vec3d_max_to},
+    {"vec_fn", "vec3d_floor", 3, "double", BENCH_BATCH, bench_vec3d_floor},
+    {"vec_fn_to", "vec3d_floor_to", 3, "double", BENCH_BATCH, bench_vec3d_floor_to},
+    {"vec_fn", "vec3d_ceil", 3, "double", BENCH_BATCH, bench_vec3d_ceil},
+    {"vec_fn_to", "vec3d_ceil_to", 3, "double", BENCH_BATCH, bench_vec3d_ceil_to},
+    {"vec_fn", "vec3d_clamp", 3, "double", BENCH_BATCH, bench_vec3d_clamp},
+    {"vec_fn_to", "vec3d_clamp_to", 3, "double", BENCH_BATCH, bench_vec3d_clamp_to},
+    {"vec_fn", "vec3d_abs", 3, "double", BENCH_BATCH, bench_vec3d_abs},
+    {"vec_fn_to", "vec3d_abs_to", 3, "double", BENCH_BATCH, bench_vec3d_abs_to},
+    {"vec_fn", "vec3d_lerp", 3, "double", BENCH_BATCH, bench_vec3d_lerp},
+    {"vec_fn_to", "vec3d_lerp_to", 3, "double", BENCH_BATCH, bench_vec3d_lerp_to},
+    {"vec_variadic", "vec3d_sum", 3, "double", BENCH_BATCH, bench_vec3d_sum},
+    {"vec_array", "vec3d_sum_array", 3, "double", BENCH_BATCH, bench_vec3d_sum_array},
+    {"vec_variadic", "vec3d_product", 3, "double", BENCH_BATCH, bench_vec3d_product},
+    {"vec_array", "vec3d_product_array", 3, "double", BENCH_BATCH, bench_vec3d_product_array},
+    {"vec_metric", "vec3d_dot", 3, "double", BENCH_BATCH, bench_vec3d_dot},
+    {"vec_metric", "vec3d_sqrlen", 3, "double", BENCH_BATCH, bench_vec3d_sqrlen},
+    {"vec_metric", "vec3d_1norm", 3, "double", BENCH_BATCH, bench_vec3d_1norm},
+    {"vec_geometry", "vec3d_reflect", 3, "double", BENCH_BATCH, bench_vec3d_reflect},
+    {"vec_geometry", "vec3d_cross", 3, "double", BENCH_BATCH, bench_vec3d_cross},
+    {"vec_metric", "vec3d_2norm", 3, "double", BENCH_BATCH, bench_vec3d_2norm},
+    {"vec_metric", "vec3d_eq", 3, "double", BENCH_BATCH, bench_vec3d_eq},
+    {"vec_geometry", "vec3d_unit", 3, "double", BENCH_BATCH, bench_vec3d_unit},
+    {"vec_geometry", "vec3d_direction", 3, "double", BENCH_BATCH, bench_vec3d_direction},
+    {"vec_metric", "vec3d_angle_between", 3, "double", BENCH_BATCH, bench_vec3d_angle_between},
+    {"mat", "mat3d_mul", 3, "double", BENCH_BATCH, bench_mat3d_mul},
+    {"mat", "mat3d_mul_to", 3, "double", BENCH_BATCH, bench_mat3d_mul_to},
+    {"mat", "mat3d_nmul", 3, "double", BENCH_BATCH, bench_mat3d_nmul},
+    {"mat", "mat3d_mul_chain", 3, "double", BENCH_BATCH, bench_mat3d_mul_chain},
+    {"mat", "mat3d_mul_vec", 3, "double", BENCH_BATCH, bench_mat3d_mul_vec},
+    {"mat", "mat3d_mul_vec_to", 3, "double", BENCH_BATCH, bench_mat3d_mul_vec_to},
+    {"mat", "mat3d_hadamard", 3, "double", BENCH_BATCH, bench_mat3d_hadamard},
+    {"mat", "mat3d_hadamard_to", 3, "double", BENCH_BATCH, bench_mat3d_hadamard_to},
+    {"mat", "mat3d_rotate", 3, "double", BENCH_BATCH, bench_mat3d_rotate},
+    {"mat", "mat3d_rotate_to", 3, "double", BENCH_BATCH, bench_mat3d_rotate_to},
+    {"mat", "mat3d_transpose", 3, "double", BENCH_BATCH, bench_mat3d_transpose},
+    {"mat", "mat3d_det", 3, "double", BENCH_BATCH, bench_mat3d_det},
+    {"mat", "mat3d_inverse", 3, "double", BENCH_BATCH, bench_mat3d_inverse},
+    {"batch", "mat3d_inverse_array", 3, "double", BENCH_BATCH, bench_mat3d_inverse_array},
+    {"batch", "mat3d_transform_array", 3, "double", BENCH_BATCH, bench_mat3d_transform_array},
+    {"batch", "vec3d_soa_from_aos", 3, "double", BENCH_BATCH, bench_vec3d_soa_from_aos},
+    {"batch", "vec3d_soa_to_aos", 3, "double", BENCH_BATCH, bench_vec3d_soa_to_aos},
+    {"batch", "vec3d_soa_add", 3, "double", BENCH_BATCH, bench_vec3d_soa_add},
+    {"batch", "vec3d_soa_sub", 3, "double", BENCH_BATCH, bench_vec3d_soa_sub},
+    {"batch", "vec3d_soa_mul", 3, "double", BENCH_BATCH, bench_vec3d_soa_mul},
+    {"batch", "vec3d_soa_div", 3, "double", BENCH_BATCH, bench_vec3d_soa_div},
+    {"batch", "vec3d_soa_mod", 3, "double", BENCH_BATCH, bench_vec3d_soa_mod},
+    {"batch", "vec3d_soa_min", 3, "double", BENCH_BATCH, bench_vec3d_soa_min},
+    {"batch", "vec3d_soa_max", 3, "double", BENCH_BATCH, bench_vec3d_soa_max},
+    {"batch", "vec3d_soa_floor", 3, "double", BENCH_BATCH, bench_vec3d_soa_floor},
+    {"batch", "vec3d_soa_ceil", 3, "double", BENCH_BATCH, bench_vec3d_soa_ceil},
+    {"batch", "vec3d_soa_clamp", 3, "double", BENCH_BATCH, bench_vec3d_soa_clamp},
+    {"batch", "vec3d_soa_abs", 3, "double", BENCH_BATCH, bench_vec3d_soa_abs},
+    {"batch", "vec3d_soa_lerp", 3, "double", BENCH_BATCH, bench_vec3d_soa_lerp},
+    {"batch", "vec3d_soa_dot", 3, "double", BENCH_BATCH, bench_vec3d_soa_dot},
+    {"batch", "vec3d_soa_2norm", 3, "double", BENCH_BATCH, bench_vec3d_soa_2norm},
+    {"batch", "vec3d_soa_unit", 3, "double", BENCH_BATCH, bench_vec3d_soa_unit},
+    {"batch", "mat3d_mul_vec_soa", 3, "double", BENCH_BATCH, bench_mat3d_mul_vec_soa},
+    {"vec_op", "vec3i_add", 3, "int", BENCH_BATCH, bench_vec3i_add},
+    {"vec_op_to", "vec3i_add_to", 3, "int", BENCH_BATCH, bench_vec3i_add_to},
+    {"vec_op_assign", "vec3i_add_assign", 3, "int", BENCH_BATCH, bench_vec3i_add_assign},
+    {"vec_op", "vec3i_sub", 3, "int", BENCH_BATCH, bench_vec3i_sub},
+    {"vec_op_to", "vec3i_sub_to", 3, "int", BENCH_BATCH, bench_vec3i_sub_to},
+    {"vec_op_assign", "vec3i_sub_assign", 3, "int", BENCH_BATCH, bench_vec3i_sub_assign},
+    {"vec_op", "vec3i_mul", 3, "int", BENCH_BATCH, bench_vec3i_mul},
+    {"vec_op_to", "vec3i_mul_to", 3, "int", BENCH_BATCH, bench_vec3i_mul_to},
+    {"vec_op_assign", "vec3i_mul_assign", 3, "int", BENCH_BATCH, bench_vec3i_mul_assign},
+    {"vec_op", "vec3i_div", 3, "int", BENCH_BATCH, bench_vec3i_div},
+    {"vec_op_to", "vec3i_div_to", 3, "int", BENCH_BATCH, bench_vec3i_div_to},
+    {"vec_op_assign", "vec3i_div_assign", 3, "int", BENCH_BATCH, bench_vec3i_div_assign},
+    {"vec_op", "vec3i_mod", 3, "int", BENCH_BATCH, bench_vec3i_mod},
+    {"vec_op_to", "vec3i_mod_to", 3, "int", BENCH_BATCH, bench_vec3i_mod_to},
+    {"vec_op_assign", "vec3i_mod_assign", 3, "int", BENCH_BATCH, bench_vec3i_mod_assign},
+    {"vec_fn", "vec3i_min", 3, "int", BENCH_BATCH, bench_vec3i_min},
+    {"vec_fn_to", "vec3i_min_to", 3, "int", BENCH_BATCH, bench_vec3i_min_to},
+    {"vec_fn", "vec3i_max", 3, "int", BENCH_BATCH, bench_vec3i_max},
+    {"vec_fn_to", "vec3i_max_to", 3, "int", BENCH_BATCH, bench_vec3i_max_to},
+    {"vec_fn", "vec3i_clamp", 3, "int", BENCH_BATCH, bench_vec3i_clamp},
+    {"vec_fn_to", "vec3i_clamp_to", 3, "int", BENCH_BATCH, bench_vec3i_clamp_to},
+    {"vec_fn", "vec3i_abs", 3, "int", BENCH_BATCH, bench_vec3i_abs},
+    {"vec_fn_to", "vec3i_abs_to", 3, "int", BENCH_BATCH, bench_vec3i_abs_to},
+    {"vec_variadic", "vec3i_sum", 3, "int", BENCH_BATCH, bench_vec3i_sum},
+    {"vec_array", "vec3i_sum_array", 3, "int", BENCH_BATCH, bench_vec3i_sum_array},
+    {"vec_variadic", "vec3i_product", 3, "int", BENCH_BATCH, bench_vec3i_product},
+    {"vec_array", "vec3i_product_array", 3, "int", BENCH_BATCH, bench_vec3i_product_array},
+    {"vec_metric", "vec3i_dot", 3, "int", BENCH_BATCH, bench_vec3i_dot},
+    {"vec_metric", "vec3i_sqrlen", 3, "int", BENCH_BATCH, bench_vec3i_sqrlen},
+    {"vec_metric", "vec3i_1norm", 3, "int", BENCH_BATCH, bench_vec3i_1norm},
+    {"vec_geometry", "vec3i_reflect", 3, "int", BENCH_BATCH, bench_vec3i_reflect},
+    {"vec_geometry", "vec3i_cross", 3, "int", BENCH_BATCH, bench_vec3i_cross},
+    {"mat", "mat3i_mul", 3, "int", BENCH_BATCH, bench_mat3i_mul},
+    {"mat", "mat3i_mul_to", 3, "int", BENCH_BATCH, bench_mat3i_mul_to},
+    {"mat", "mat3i_nmul", 3, "int", BENCH_BATCH, bench_mat3i_nmul},
+    {"mat", "mat3i_mul_chain", 3, "int", BENCH_BATCH, bench_mat3i_mul_chain},
+    {"mat", "mat3i_mul_vec", 3, "int", BENCH_BATCH, bench_mat3i_mul_vec},
+    {"mat", "mat3i_mul_vec_to", 3, "int", BENCH_BATCH, bench_mat3i_mul_vec_to},
+    {"mat", "mat3i_hadamard", 3, "int", BENCH_BATCH, bench_mat3i_hadamard},
+    {"mat", "mat3i_hadamard_to", 3, "int", BENCH_BATCH, bench_mat3i_hadamard_to},
+    {"mat", "mat3i_transpose", 3, "int", BENCH_BATCH, bench_mat3i_transpose},
+    {"batch", "mat3i_transform_array", 3, "int", BENCH_BATCH, bench_mat3i_transform_array},
+    {"batch", "vec3i_soa_from_aos", 3, "int", BENCH_BATCH, bench_vec3i_soa_from_aos},
+    {"batch", "vec3i_soa_to_aos", 3, "int", BENCH_BATCH, bench_vec3i_soa_to_aos},
+    {"batch", "vec3i_soa_add", 3, "int", BENCH_BATCH, bench_vec3i_soa_add},
+    {"batch", "vec3i_soa_sub", 3, "int", BENCH_BATCH, bench_vec3i_soa_sub},
+    {"batch", "vec3i_soa_mul", 3, "int", BENCH_BATCH, bench_vec3i_soa_mul},
+    {"batch", "vec3i_soa_div", 3, "int", BENCH_BATCH, bench_vec3i_soa_div},
+    {"batch", "vec3i_soa_mod", 3, "int", BENCH_BATCH, bench_vec3i_soa_mod},
+    {"batch", "vec3i_soa_min", 3, "int", BENCH_BATCH, bench_vec3i_soa_min},
+    {"batch", "vec3i_soa_max", 3, "int", BENCH_BATCH, bench_vec3i_soa_max},
+    {"batch", "vec3i_soa_clamp", 3, "int", BENCH_BATCH, bench_vec3i_soa_clamp},
+    {"batch", "vec3i_soa_abs", 3, "int", BENCH_BATCH, bench_vec3i_soa_abs},
+    {"batch", "vec3i_soa_dot", 3, "int", BENCH_BATCH, bench_vec3i_soa_dot},
+    {"batch", "mat3i_mul_vec_soa", 3, "int", BENCH_BATCH, bench_mat3i_mul_vec_soa},
+    {"vec_op", "vec3u_add", 3, "unsigned int", BENCH_BATCH, bench_vec3u_add},
+    {"vec_op_to", "vec3u_add_to", 3, "unsigned int", BENCH_BATCH, bench_vec3u_add_to},
+    {"vec_op_assign", "vec3u_add_assign", 3, "unsigned int", BENCH_BATCH, bench_vec3u_add_assign},
+    {"vec_op", "vec3u_sub", 3, "unsigned int", BENCH_BATCH, bench_vec3u_sub},
+    {"vec_op_to", "vec3u_sub_to", 3, "unsigned int", BENCH_BATCH, bench_vec3u_sub_to},
+    {"vec_op_assign", "vec3u_sub_assign", 3, "unsigned int", BENCH_BATCH, bench_vec3u_sub_assign},
+    {"vec_op", "vec3u_mul", 3, "unsigned int", BENCH_BATCH, bench_vec3u_mul},
+    {"vec_op_to", "vec3u_mul_to", 3, "unsigned int", BENCH_BATCH, bench_vec3u_mul_to},
+    {"vec_op_assign", "vec3u_mul_assign", 3, "unsigned int", BENCH_BATCH, bench_vec3u_mul_assign},
+    {"vec_op", "vec3u_div", 3, "unsigned int", BENCH_BATCH, bench_vec3u_div},
+    {"vec_op_to", "vec3u_div_to", 3, "unsigned int", BENCH_BATCH, bench_vec3u_div_to},
+    {"vec_op_assign", "vec3u_div_assign", 3, "unsigned int", BENCH_BATCH, bench_vec3u_div_assign},
+    {"vec_op", "vec3u_mod", 3, "unsigned int", BENCH_BATCH, bench_vec3u_mod},
+    {"vec_op_to", "vec3u_mod_to", 3, "unsigned int", BENCH_BATCH, bench_vec3u_mod_to},
+    {"vec_op_assign", "vec3u_mod_assign", 3, "unsigned int", BENCH_BATCH, bench_vec3u_mod_assign},
+    {"vec_fn", "vec3u_min", 3, "unsigned int", BENCH_BATCH, bench_vec3u_min},
+    {"vec_fn_to", "vec3u_min_to", 3, "unsigned int", BENCH_BATCH, bench_vec3u_min_to},
+    {"vec_fn", "vec3u_max", 3, "unsigned int", BENCH_BATCH, bench_vec3u_max},
+    {"vec_fn_to", "vec3u_max_to", 3, "unsigned int", BENCH_BATCH, bench_vec3u_max_to},
+    {"vec_fn", "vec3u_clamp", 3, "unsigned int", BENCH_BATCH, bench_vec3u_clamp},
+    {"vec_fn_to", "vec3u_clamp_to", 3, "unsigned int", BENCH_BATCH, bench_vec3u_clamp_to},
+    {"vec_variadic", "vec3u_sum", 3, "unsigned int", BENCH_BATCH, bench_vec3u_sum},
+    {"vec_array", "vec3u_sum_array", 3, "unsigned int", BENCH_BATCH, bench_vec3u_sum_array},
+    {"vec_variadic", "vec3u_product", 3, "unsigned int", BENCH_BATCH, bench_vec3u_product},
+    {"vec_array", "vec3u_product_array", 3, "unsigned int", BENCH_BATCH, bench_vec3u_product_array},
+    {"vec_metric", "vec3u_dot", 3, "unsigned int", BENCH_BATCH, bench_vec3u_dot},
+    {"vec_metric", "vec3u_sqrlen", 3, "unsigned int", BENCH_BATCH, bench_vec3u_sqrlen},
+    {"vec_metric", "vec3u_1norm", 3, "unsigned int", BENCH_BATCH, bench_vec3u_1norm},
+    {"vec_geometry", "vec3u_reflect", 3, "unsigned int", BENCH_BATCH, bench_vec3u_reflect},
+    {"vec_geometry", "vec3u_cross", 3, "unsigned int", BENCH_BATCH, bench_vec3u_cross},
+    {"mat", "mat3u_mul", 3, "unsigned int", BENCH_BATCH, bench_mat3u_mul},
+    {"mat", "mat3u_mul_to", 3, "unsigned int", BENCH_BATCH, bench_mat3u_mul_to},
+    {"mat", "mat3u_nmul", 3, "unsigned int", BENCH_BATCH, bench_mat3u_nmul},
+    {"mat", "mat3u_mul_chain", 3, "unsigned int", BENCH_BATCH, bench_mat3u_mul_chain},
+    {"mat", "mat3u_mul_vec", 3, "unsigned int", BENCH_BATCH, bench_mat3u_mul_vec},
+    {"mat", "mat3u_mul_vec_to", 3, "unsigned int", BENCH_BATCH, bench_mat3u_mul_vec_to},
+    {"mat", "mat3u_hadamard", 3, "unsigned int", BENCH_BATCH, bench_mat3u_hadamard},
+    {"mat", "mat3u_hadamard_to", 3, "unsigned int", BENCH_BATCH, bench_mat3u_hadamard_to},
+    {"mat", "mat3u_transpose", 3, "unsigned int", BENCH_BATCH, bench_mat3u_transpose},
+    {"batch", "mat3u_transform_array", 3, "unsigned int", BENCH_BATCH, bench_mat3u_transform_array},
+    {"batch", "vec3u_soa_from_aos", 3, "unsigned int", BENCH_BATCH, bench_vec3u_soa_from_aos},
+    {"batch", "vec3u_soa_to_aos", 3, "unsigned int", BENCH_BATCH, bench_vec3u_soa_to_aos},
+    {"batch", "vec3u_soa_add", 3, "unsigned int", BENCH_BATCH, bench_vec3u_soa_add},
+    {"batch", "vec3u_soa_sub", 3, "unsigned int", BENCH_BATCH, bench_vec3u_soa_sub},
+    {"batch", "vec3u_soa_mul", 3, "unsigned int", BENCH_BATCH, bench_vec3u_soa_mul},
+    {"batch", "vec3u_soa_div", 3, "unsigned int", BENCH_BATCH, bench_vec3u_soa_div},
+    {"batch", "vec3u_soa_mod", 3, "unsigned int", BENCH_BATCH, bench_vec3u_soa_mod},
+    {"batch", "vec3u_soa_min", 3, "unsigned int", BENCH_BATCH, bench_vec3u_soa_min},
+    {"batch", "vec3u_soa_max", 3, "unsigned int", BENCH_BATCH, bench_vec3u_soa_max},
+    {"batch", "vec3u_soa_clamp", 3, "unsigned int", BENCH_BATCH, bench_vec3u_soa_clamp},
+    {"batch", "vec3u_soa_dot", 3, "unsigned int", BENCH_BATCH, bench_vec3u_soa_dot},
+    {"batch", "mat3u_mul_vec_soa", 3, "unsigned int", BENCH_BATCH, bench_mat3u_mul_vec_soa},
+    {"batch", "vec3h_to_vec3f_array", 3, "half_t", BENCH_BATCH, bench_vec3h_to_vec3f_array},
+    {"batch", "vec3h_from_vec3f_array", 3, "half_t", BENCH_BATCH, bench_vec3h_from_vec3f_array},
+    {"batch", "mat3f_transform_array_h", 3, "half_t", BENCH_BATCH, bench_mat3f_transform_array_h},
+    {"vec_op", "vec4f_add", 4, "float", BENCH_BATCH, bench_vec4f_add},
+    {"vec_op_to", "vec4f_add_to", 4, "float", BENCH_BATCH, bench_vec4f_add_to},
+    {"vec_op_assign", "vec4f_add_assign", 4, "float", BENCH_BATCH, bench_vec4f_add_assign},
+    {"vec_op", "vec4f_sub", 4, "float", BENCH_BATCH, bench_vec4f_sub},
+    {"vec_op_to", "vec4f_sub_to", 4, "float", BENCH_BATCH, bench_vec4f_sub_to},
+    {"vec_op_assign", "vec4f_sub_assign", 4, "float", BENCH_BATCH, bench_vec4f_sub_assign},
+    {"vec_op", "vec4f_mul", 4, "float", BENCH_BATCH, bench_vec4f_mul},
+    {"vec_op_to", "vec4f_mul_to", 4, "float", BENCH_BATCH, bench_vec4f_mul_to},
+    {"vec_op_assign", "vec4f_mul_assign", 4, "float", BENCH_BATCH, bench_vec4f_mul_assign},
+    {"vec_op", "vec4f_div", 4, "float", BENCH_BATCH, bench_vec4f_div},
+    {"vec_op_to", "vec4f_div_to", 4, "float", BENCH_BATCH, bench_vec4f_div_to},
+    {"vec_op_assign", "vec4f_div_assign", 4, "float", BENCH_BATCH, bench_vec4f_div_assign},
+    {"vec_op", "vec4f_mod", 4, "float", BENCH_BATCH, bench_vec4f_mod},
+    {"vec_op_to", "vec4f_mod_to", 4, "float", BENCH_BATCH, bench_vec4f_mod_to},
+    {"vec_op_assign", "vec4f_mod_assign", 4, "float", BENCH_BATCH, bench_vec4f_mod_assign},
+    {"vec_fn", "vec4f_min", 4, "float", BENCH_BATCH, bench_vec4f_min},
+    {"vec_fn_to", "vec4f_min_to", 4, "float", BENCH_BATCH, bench_vec4f_min_to},
+    {"vec_fn", "vec4f_max", 4, "float", BENCH_BATCH, bench_vec4f_max},
+    {"vec_fn_to", "vec4f_max_to", 4, "float", BENCH_BATCH, bench_vec4f_max_to},
+    {"vec_fn", "vec4f_floor", 4, "float", BENCH_BATCH, bench_vec4f_floor},
+    {"vec_fn_to", "vec4f_floor_to", 4, "float", BENCH_BATCH, bench_vec4f_floor_to},
+    {"vec_fn", "vec4f_ceil", 4, "float", BENCH_BATCH, bench_vec4f_ceil},
+    {"vec_fn_to", "vec4f_ceil_to", 4, "float", BENCH_BATCH, bench_vec4f_ceil_to},
+    {"vec_fn", "vec4f_clamp", 4, "float", BENCH_BATCH, bench_vec4f_clamp},
+    {"vec_fn_to", "vec4f_clamp_to", 4, "float", BENCH_BATCH, bench_vec4f_clamp_to},
+    {"vec_fn", "vec4f_abs", 4, "float", BENCH_BATCH, bench_vec4f_abs},
+    {"vec_fn_to", "vec4f_abs_to", 4, "float", BENCH_BATCH, bench_vec4f_abs_to},
+    {"vec_fn", "vec4f_lerp", 4, "float", BENCH_BATCH, bench_vec4f_lerp},
+    {"vec_fn_to", "vec4f_lerp_to", 4, "float", BENCH_BATCH, bench_vec4f_lerp_to},
+    {"vec_variadic", "vec4f_sum", 4, "float", BENCH_BATCH, bench_vec4f_sum},
+    {"vec_array", "vec4f_sum_array", 4, "float", BENCH_BATCH, bench_vec4f_sum_array},
+    {"vec_variadic", "vec4f_product", 4, "float", BENCH_BATCH, bench_vec4f_product},
+    {"vec_array", "vec4f_product_array", 4, "float", BENCH_BATCH, bench_vec4f_product_array},
+    {"vec_metric", "vec4f_dot", 4, "float", BENCH_BATCH, bench_vec4f_dot},
+    {"vec_metric", "vec4f_sqrlen", 4, "float", BENCH_BATCH, bench_vec4f_sqrlen},
+    {"vec_metric", "vec4f_1norm", 4, "float", BENCH_BATCH, bench_vec4f_1norm},
+    {"vec_geometry", "vec4f_reflect", 4, "float", BENCH_BATCH, bench_vec4f_reflect},
+    {"vec_metric", "vec4f_2norm", 4, "float", BENCH_BATCH, bench_vec4f_2norm},
+    {"vec_metric", "vec4f_eq", 4, "float", BENCH_BATCH, bench_vec4f_eq},
+    {"vec_geometry", "vec4f_unit", 4, "float", BENCH_BATCH, bench_vec4f_unit},
+    {"vec_geometry", "vec4f_direction", 4, "float", BENCH_BATCH, bench_vec4f_direction},
+    {"vec_geometry", "vec4f_unit_fast", 4, "float", BENCH_BATCH, bench_vec4f_unit_fast},
+    {"mat", "mat4f_mul", 4, "float", BENCH_BATCH, bench_mat4f_mul},
+    {"mat", "mat4f_mul_to", 4, "float", BENCH_BATCH, bench_mat4f_mul_to},
+    {"mat", "mat4f_nmul", 4, "float", BENCH_BATCH, bench_mat4f_nmul},
+    {"mat", "mat4f_mul_chain", 4, "float", BENCH_BATCH, bench_mat4f_mul_chain},
+    {"mat", "mat4f_mul_vec", 4, "float", BENCH_BATCH, bench_mat4f_mul_vec},
+    {"mat", "mat4f_mul_vec_to", 4, "float", BENCH_BATCH, bench_mat4f_mul_vec_to},
+    {"mat", "mat4f_hadamard", 4, "float", BENCH_BATCH, bench_mat4f_hadamard},
+    {"mat", "mat4f_hadamard_to", 4, "float", BENCH_BATCH, bench_mat4f_hadamard_to},
+    {"mat", "mat4f_rotate", 4, "float", BENCH_BATCH, bench_mat4f_rotate},
+    {"mat", "mat4f_rotate_to", 4, "float", BENCH_BATCH, bench_mat4f_rotate_to},
+    {"mat", "mat4f_rotate_fast", 4, "float", BENCH_BATCH, bench_mat4f_rotate_fast},
+    {"mat", "mat4f_transpose", 4, "float", BENCH_BATCH, bench_mat4f_transpose},
+    {"mat", "mat4f_det", 4, "float", BENCH_BATCH, bench_mat4f_det},
+    {"mat", "mat4f_inverse", 4, "float", BENCH_BATCH, bench_mat4f_inverse},
+    {"batch", "mat4f_inverse_array", 4, "float", BENCH_BATCH, bench_mat4f_inverse_array},
+    {"mat", "mat4f_inverse_affine", 4, "float", BENCH_BATCH, bench_mat4f_inverse_affine},
+    {"batch", "mat4f_transform_array", 4, "float", BENCH_BATCH, bench_mat4f_transform_array},
+    {"batch", "vec4f_soa_from_aos", 4, "float", BENCH_BATCH, bench_vec4f_soa_from_aos},
+    {"batch", "vec4f_soa_to_aos", 4, "float", BENCH_BATCH, bench_vec4f_soa_to_aos},
+    {"batch", "vec4f_soa_add", 4, "float", BENCH_BATCH, bench_vec4f_soa_add},
+    {"batch", "vec4f_soa_sub", 4, "float", BENCH_BATCH, bench_vec4f_soa_sub},
+    {"batch", "vec4f_soa_mul", 4, "float", BENCH_BATCH, bench_vec4f_soa_mul},
+    {"batch", "vec4f_soa_div", 4, "float", BENCH_BATCH, bench_vec4f_soa_div},
+    {"batch", "vec4f_soa_mod", 4, "float", BENCH_BATCH, bench_vec4f_soa_mod},
+    {"batch", "vec4f_soa_min", 4, "float", BENCH_BATCH, bench_vec4f_soa_min},
+    {"batch", "vec4f_soa_max", 4, "float", BENCH_BATCH, bench_vec4f_soa_max},
+    {"batch", "vec4f_soa_floor", 4, "float", BENCH_BATCH, bench_vec4f_soa_floor},
+    {"batch", "vec4f_soa_ceil", 4, "float", BENCH_BATCH, bench_vec4f_soa_ceil},
+    {"batch", "vec4f_soa_clamp", 4, "float", BENCH_BATCH, bench_vec4f_soa_clamp},
+    {"batch", "vec4f_soa_abs", 4, "float", BENCH_BATCH, bench_vec4f_soa_abs},
+    {"batch", "vec4f_soa_lerp", 4, "float", BENCH_BATCH, bench_vec4f_soa_lerp},
+    {"batch", "vec4f_soa_dot", 4, "float", BENCH_BATCH, bench_vec4f_soa_dot},
+    {"batch", "vec4f_soa_2norm", 4, "float", BENCH_BATCH, bench_vec4f_soa_2norm},
+    {"batch", "vec4f_soa_unit", 4, "float", BENCH_BATCH, bench_vec4f_soa_unit},
+    {"batch", "mat4f_mul_vec_soa", 4, "float", BENCH_BATCH, bench_mat4f_mul_vec_soa},
+    {"vec_op", "vec4d_add", 4, "double", BENCH_BATCH, bench_vec4d_add},
+    {"vec_op_to", "vec4d_add_to", 4, "double", BENCH_BATCH, bench_vec4d_add_to},
+    {"vec_op_assign", "vec4d_add_assign", 4, "double", BENCH_BATCH, bench_vec4d_add_assign},
+    {"vec_op", "vec4d_sub", 4, "double", BENCH_BATCH, bench_vec4d_sub},
+    {"vec_op_to", "vec4d_sub_to", 4, "double", BENCH_BATCH, bench_vec4d_sub_to},
+    {"vec_op_assign", "vec4d_sub_assign", 4, "double", BENCH_BATCH, bench_vec4d_sub_assign},
+    {"vec_op", "vec4d_mul", 4, "double", BENCH_BATCH, bench_vec4d_mul},
+    {"vec_op_to", "vec4d_mul_to", 4, "double", BENCH_BATCH, bench_vec4d_mul_to},
+    {"vec_op_assign", "vec4d_mul_assign", 4, "double", BENCH_BATCH, bench_vec4d_mul_assign},
+    {"vec_op", "vec4d_div", 4, "double", BENCH_BATCH, bench_vec4d_div},
+    {"vec_op_to", "vec4d_div_to", 4, "double", BENCH_BATCH, bench_vec4d_div_to},
+    {"vec_op_assign", "vec4d_div_assign", 4, "double", BENCH_BATCH, bench_vec4d_div_assign},
+    {"vec_op", "vec4d_mod", 4, "double", BENCH_BATCH, bench_vec4d_mod},
+    {"vec_op_to", "vec4d_mod_to", 4, "double", BENCH_BATCH, bench_vec4d_mod_to},
+    {"vec_op_assign", "vec4d_mod_assign", 4, "double", BENCH_BATCH, bench_vec4d_mod_assign},
+    {"vec_fn", "vec4d_min", 4, "double", BENCH_BATCH, bench_vec4d_min},
+    {"vec_fn_to", "vec4d_min_to", 4, "double", BENCH_BATCH, bench_vec4d_min_to},
+    {"vec_fn", "vec4d_max", 4, "double", BENCH_BATCH, bench_vec4d_max},
+    {"vec_fn_to", "vec4d_max_to", 4, "double", BENCH_BATCH, bench_vec4d_max_to},
+    {"vec_fn", "vec4d_floor", 4, "double", BENCH_BATCH, bench_vec4d_floor},
+    {"vec_fn_to", "vec4d_floor_to", 4, "double", BENCH_BATCH, bench_vec4d_floor_to},
+    {"vec_fn", "vec4d_ceil", 4, "double", BENCH_BATCH, bench_vec4d_ceil},
+    {"vec_fn_to", "vec4d_ceil_to", 4, "double", BENCH_BATCH, bench_vec4d_ceil_to},
+    {"vec_fn", "vec4d_clamp", 4, "double", BENCH_BATCH, bench_vec4d_clamp},
+    {"vec_fn_to", "vec4d_clamp_to", 4, "double", BENCH_BATCH, bench_vec4d_clamp_to},
+    {"vec_fn", "vec4d_abs", 4, "double", BENCH_BATCH, bench_vec4d_abs},
+    {"vec_fn_to", "vec4d_abs_to", 4, "double", BENCH_BATCH, bench_vec4d_abs_to},
+    {"vec_fn", "vec4d_lerp", 4, "double", BENCH_BATCH, bench_vec4d_lerp},
+    {"vec_fn_to", "vec4d_lerp_to", 4, "double", BENCH_BATCH, bench_vec4d_lerp_to},
+    {"vec_variadic", "vec4d_sum", 4, "double", BENCH_BATCH, bench_vec4d_sum},
+    {"vec_array", "vec4d_sum_array", 4, "double", BENCH_BATCH, bench_vec4d_sum_array},
+    {"vec_variadic", "vec4d_product", 4, "double", BENCH_BATCH, bench_vec4d_product},
+    {"vec_array", "vec4d_product_array", 4, "double", BENCH_BATCH, bench_vec4d_product_array},
+    {"vec_metric", "vec4d_dot", 4, "double", BENCH_BATCH, bench_vec4d_dot},
+    {"vec_metric", "vec4d_sqrlen", 4, "double", BENCH_BATCH, bench_vec4d_sqrlen},
+    {"vec_metric", "vec4d_1norm", 4, "double", BENCH_BATCH, bench_vec4d_1norm},
+    {"vec_geometry", "vec4d_reflect", 4, "double", BENCH_BATCH, bench_vec4d_reflect},
+    {"vec_metric", "vec4d_2norm", 4, "double", BENCH_BATCH, bench_vec4d_2norm},
+    {"vec_metric", "vec4d_eq", 4, "double", BENCH_BATCH, bench_vec4d_eq},
+    {"vec_geometry", "vec4d_unit", 4, "double", BENCH_BATCH, bench_vec4d_unit},
+    {"vec_geometry", "vec4d_direction", 4, "double", BENCH_BATCH, bench_vec4d_direction},
+    {"mat", "mat4d_mul", 4, "double", BENCH_BATCH, bench_mat4d_mul},
+    {"mat", "mat4d_mul_to", 4, "double", BENCH_BATCH, bench_mat4d_mul_to},
+    {"mat", "mat4d_nmul", 4, "double", BENCH_BATCH, bench_mat4d_nmul},
+    {"mat", "mat4d_mul_chain", 4, "double", BENCH_BATCH, bench_mat4d_mul_chain},
+    {"mat", "mat4d_mul_vec", 4, "double", BENCH_BATCH, bench_mat4d_mul_vec},
+    {"mat", "mat4d_mul_vec_to", 4, "double", BENCH_BATCH, bench_mat4d_mul_vec_to},
+    {"mat", "mat4d_hadamard", 4, "double", BENCH_BATCH, bench_mat4d_hadamard},
+    {"mat", "mat4d_hadamard_to", 4, "double", BENCH_BATCH, bench_mat4d_hadamard_to},
+    {"mat", "mat4d_rotate", 4, "double", BENCH_BATCH, bench_mat4d_rotate},
+    {"mat", "mat4d_rotate_to", 4, "double", BENCH_BATCH, bench_mat4d_rotate_to},
+    {"mat", "mat4d_transpose", 4, "double", BENCH_BATCH, bench_mat4d_transpose},
+    {"mat", "mat4d_det", 4, "double", BENCH_BATCH, bench_mat4d_det},
+    {"mat", "mat4d_inverse", 4, "double", BENCH_BATCH, bench_mat4d_inverse},
+    {"batch", "mat4d_inverse_array", 4, "double", BENCH_BATCH, bench_mat4d_inverse_array},
+    {"mat", "mat4d_inverse_affine", 4, "double", BENCH_BATCH, bench_mat4d_inverse_affine},
+    {"batch", "mat4d_transform_array", 4, "double", BENCH_BATCH, bench_mat4d_transform_array},
+    {"batch", "vec4d_soa_from_aos", 4, "double", BENCH_BATCH, bench_vec4d_soa_from_aos},
+    {"batch", "vec4d_soa_to_aos", 4, "double", BENCH_BATCH, bench_vec4d_soa_to_aos},
+    {"batch", "vec4d_soa_add", 4, "double", BENCH_BATCH, bench_vec4d_soa_add},
+    {"batch", "vec4d_soa_sub", 4, "double", BENCH_BATCH, bench_vec4d_soa_sub},
+    {"batch", "vec4d_soa_mul", 4, "double", BENCH_BATCH, bench_vec4d_soa_mul},
+    {"batch", "vec4d_soa_div", 4, "double", BENCH_BATCH, bench_vec4d_soa_div},
+    {"batch", "vec4d_soa_mod", 4, "double", BENCH_BATCH, bench_vec4d_soa_mod},
+    {"batch", "vec4d_soa_min", 4, "double", BENCH_BATCH, bench_vec4d_soa_min},
+    {"batch", "vec4d_soa_max", 4, "double", BENCH_BATCH, bench_vec4d_soa_max},
+    {"batch", "vec4d_soa_floor", 4, "double", BENCH_BATCH, bench_vec4d_soa_floor},
+    {"batch", "vec4d_soa_ceil", 4, "double", BENCH_BATCH, bench_vec4d_soa_ceil},
+    {"batch", "vec4d_soa_clamp", 4, "double", BENCH_BATCH, bench_vec4d_soa_clamp},
+    {"batch", "vec4d_soa_abs", 4, "double", BENCH_BATCH, bench_vec4d_soa_abs},
+    {"batch", "vec4d_soa_lerp", 4, "double", BENCH_BATCH, bench_vec4d_soa_lerp},
+    {"batch", "vec4d_soa_dot", 4, "double", BENCH_BATCH, bench_vec4d_soa_dot},
+    {"batch", "vec4d_soa_2norm", 4, "double", BENCH_BATCH, bench_vec4d_soa_2norm},
+    {"batch", "vec4d_soa_unit", 4, "double", BENCH_BATCH, bench_vec4d_soa_unit},
+    {"batch", "mat4d_mul_vec_soa", 4, "double", BENCH_BATCH, bench_mat4d_mul_vec_soa},
+    {"vec_op", "vec4i_add", 4, "int", BENCH_BATCH, bench_vec4i_add},
+    {"vec_op_to", "vec4i_add_to", 4, "int", BENCH_BATCH, bench_vec4i_add_to},
+    {"vec_op_assign", "vec4i_add_assign", 4, "int", BENCH_BATCH, bench_vec4i_add_assign},
+    {"vec_op", "vec4i_sub", 4, "int", BENCH_BATCH, bench_vec4i_sub},
+    {"vec_op_to", "vec4i_sub_to", 4, "int", BENCH_BATCH, bench_vec4i_sub_to},
+    {"vec_op_assign", "vec4i_sub_assign", 4, "int", BENCH_BATCH, bench_vec4i_sub_assign},
+    {"vec_op", "vec4i_mul", 4, "int", BENCH_BATCH, bench_vec4i_mul},
+    {"vec_op_to", "vec4i_mul_to", 4, "int", BENCH_BATCH, bench_vec4i_mul_to},
+    {"vec_op_assign", "vec4i_mul_assign", 4, "int", BENCH_BATCH, bench_vec4i_mul_assign},
+    {"vec_op", "vec4i_div", 4, "int", BENCH_BATCH, bench_vec4i_div},
+    {"vec_op_to", "vec4i_div_to", 4, "int", BENCH_BATCH, bench_vec4i_div_to},
+    {"vec_op_assign", "vec4i_div_assign", 4, "int", BENCH_BATCH, bench_vec4i_div_assign},
+    {"vec_op", "vec4i_mod", 4, "int", BENCH_BATCH, bench_vec4i_mod},
+    {"vec_op_to", "vec4i_mod_to", 4, "int", BENCH_BATCH, bench_vec4i_mod_to},
+    {"vec_op_assign", "vec4i_mod_assign", 4, "int", BENCH_BATCH, bench_vec4i_mod_assign},
+    {"vec_fn", "vec4i_min", 4, "int", BENCH_BATCH, bench_vec4i_min},
+    {"vec_fn_to", "vec4i_min_to", 4, "int", BENCH_BATCH, bench_vec4i_min_to},
+    {"vec_fn", "vec4i_max", 4, "int", BENCH_BATCH, bench_vec4i_max},
+    {"vec_fn_to", "vec4i_max_to", 4, "int", BENCH_BATCH, bench_vec4i_max_to},
+    {"vec_fn", "vec4i_clamp", 4, "int", BENCH_BATCH, bench_vec4i_clamp},
+    {"vec_fn_to", "vec4i_clamp_to", 4, "int", BENCH_BATCH, bench_vec4i_clamp_to},
+    {"vec_fn", "vec4i_abs", 4, "int", BENCH_BATCH, bench_vec4i_abs},
+    {"vec_fn_to", "vec4i_abs_to", 4, "int", BENCH_BATCH, bench_vec4i_abs_to},
+    {"vec_variadic", "vec4i_sum", 4, "int", BENCH_BATCH, bench_vec4i_sum},
+    {"vec_array", "vec4i_sum_array", 4, "int", BENCH_BATCH, bench_vec4i_sum_array},
+    {"vec_variadic", "vec4i_product", 4, "int", BENCH_BATCH, bench_vec4i_product},
+    {"vec_array", "vec4i_product_array", 4, "int", BENCH_BATCH, bench_vec4i_product_array},
+    {"vec_metric", "vec4i_dot", 4, "int", BENCH_BATCH, bench_vec4i_dot},
+    {"vec_metric", "vec4i_sqrlen", 4, "int", BENCH_BATCH, bench_vec4i_sqrlen},
+    {"vec_metric", "vec4i_1norm", 4, "int", BENCH_BATCH, bench_vec4i_1norm},
+    {"vec_geometry", "vec4i_reflect", 4, "int", BENCH_BATCH, bench_vec4i_reflect},
+    {"mat", "mat4i_mul", 4, "int", BENCH_BATCH, bench_mat4i_mul},
+    {"mat", "mat4i_mul_to", 4, "int", BENCH_BATCH, bench_mat4i_mul_to},
+    {"mat", "mat4i_nmul", 4, "int", BENCH_BATCH, bench_mat4i_nmul},
+    {"mat", "mat4i_mul_chain", 4, "int", BENCH_BATCH, bench_mat4i_mul_chain},
+    {"mat", "mat4i_mul_vec", 4, "int", BENCH_BATCH, bench_mat4i_mul_vec},
+    {"mat", "mat4i_mul_vec_to", 4, "int", BENCH_BATCH, bench_mat4i_mul_vec_to},
+    {"mat", "mat4i_hadamard", 4, "int", BENCH_BATCH, bench_mat4i_hadamard},
+    {"mat", "mat4i_hadamard_to", 4, "int", BENCH_BATCH, bench_mat4i_hadamard_to},
+    {"mat", "mat4i_transpose", 4, "int", BENCH_BATCH, bench_mat4i_transpose},
+    {"batch", "mat4i_transform_array", 4, "int", BENCH_BATCH, bench_mat4i_transform_array},
+    {"batch", "vec4i_soa_from_aos", 4, "int", BENCH_BATCH, bench_vec4i_soa_from_aos},
+    {"batch", "vec4i_soa_to_aos", 4, "int", BENCH_BATCH, bench_vec4i_soa_to_aos},
+    {"batch", "vec4i_soa_add", 4, "int", BENCH_BATCH, bench_vec4i_soa_add},
+    {"batch", "vec4i_soa_sub", 4, "int", BENCH_BATCH, bench_vec4i_soa_sub},
+    {"batch", "vec4i_soa_mul", 4, "int", BENCH_BATCH, bench_vec4i_soa_mul},
+    {"batch", "vec4i_soa_div", 4, "int", BENCH_BATCH, bench_vec4i_soa_div},
+    {"batch", "vec4i_soa_mod", 4, "int", BENCH_BATCH, bench_vec4i_soa_mod},
+    {"batch", "vec4i_soa_min", 4, "int", BENCH_BATCH, bench_vec4i_soa_min},
+    {"batch", "vec4i_soa_max", 4, "int", BENCH_BATCH, bench_vec4i_soa_max},
+    {"batch", "vec4i_soa_clamp", 4, "int", BENCH_BATCH, bench_vec4i_soa_clamp},
+    {"batch", "vec4i_soa_abs", 4, "int", BENCH_BATCH, bench_vec4i_soa_abs},
+    {"batch", "vec4i_soa_dot", 4, "int", BENCH_BATCH, bench_vec4i_soa_dot},
+    {"batch", "mat4i_mul_vec_soa", 4, "int", BENCH_BATCH, bench_mat4i_mul_vec_soa},
+    {"vec_op", "vec4u_add", 4, "unsigned int", BENCH_BATCH, bench_vec4u_add},
+    {"vec_op_to", "vec4u_add_to", 4, "unsigned int", BENCH_BATCH, bench_vec4u_add_to},
+    {"vec_op_assign", "vec4u_add_assign", 4, "unsigned int", BENCH_BATCH, bench_vec4u_add_assign},
+    {"vec_op", "vec4u_sub", 4, "unsigned int", BENCH_BATCH, bench_vec4u_sub},
+    {"vec_op_to", "vec4u_sub_to", 4, "unsigned int", BENCH_BATCH, bench_vec4u_sub_to},
+    {"vec_op_assign", "vec4u_sub_assign", 4, "unsigned int", BENCH_BATCH, bench_vec4u_sub_assign},
+    {"vec_op", "vec4u_mul", 4, "unsigned int", BENCH_BATCH, bench_vec4u_mul},
+    {"vec_op_to", "vec4u_mul_to", 4, "unsigned int", BENCH_BATCH, bench_vec4u_mul_to},
+    {"vec_op_assign", "vec4u_mul_assign", 4, "unsigned int", BENCH_BATCH, bench_vec4u_mul_assign},
+    {"vec_op", "vec4u_div", 4, "unsigned int", BENCH_BATCH, bench_vec4u_div},
+    {"vec_op_to", "vec4u_div_to", 4, "unsigned int", BENCH_BATCH, bench_vec4u_div_to},
+    {"vec_op_assign", "vec4u_div_assign", 4, "unsigned int", BENCH_BATCH, bench_vec4u_div_assign},
+    {"vec_op", "vec4u_mod", 4, "unsigned int", BENCH_BATCH, bench_vec4u_mod},
+    {"vec_op_to", "vec4u_mod_to", 4, "unsigned int", BENCH_BATCH, bench_vec4u_mod_to},
+    {"vec_op_assign", "vec4u_mod_assign", 4, "unsigned int", BENCH_BATCH, bench_vec4u_mod_assign},
+    {"vec_fn", "vec4u_min", 4, "unsigned int", BENCH_BATCH, bench_vec4u_min},
+    {"vec_fn_to", "vec4u_min_to", 4, "unsigned int", BENCH_BATCH, bench_vec4u_min_to},
+    {"vec_fn", "vec4u_max", 4, "unsigned int", BENCH_BATCH, bench_vec4u_max},
+    {"vec_fn_to", "vec4u_max_to", 4, "unsigned int", BENCH_BATCH, bench_vec4u_max_to},
+    {"vec_fn", "vec4u_clamp", 4, "unsigned int", BENCH_BATCH, bench_vec4u_clamp},
+    {"vec_fn_to", "vec4u_clamp_to", 4, "unsigned int", BENCH_BATCH, bench_vec4u_clamp_to},
+    {"vec_variadic", "vec4u_sum", 4, "unsigned int", BENCH_BATCH, bench_vec4u_sum},
+    {"vec_array", "vec4u_sum_array", 4, "unsigned int", BENCH_BATCH, bench_vec4u_sum_array},
+    {"vec_variadic", "vec4u_product", 4, "unsigned int", BENCH_BATCH, bench_vec4u_product},
+    {"vec_array", "vec4u_product_array", 4, "unsigned int", BENCH_BATCH, bench_vec4u_product_array},
+    {"vec_metric", "vec4u_dot", 4, "unsigned int", BENCH_BATCH, bench_vec4u_dot},
+    {"vec_metric", "vec4u_sqrlen", 4, "unsigned int", BENCH_BATCH, bench_vec4u_sqrlen},
+    {"vec_metric", "vec4u_1norm", 4, "unsigned int", BENCH_BATCH, bench_vec4u_1norm},
+    {"vec_geometry", "vec4u_reflect", 4, "unsigned int", BENCH_BATCH, bench_vec4u_reflect},
+    {"mat", "mat4u_mul", 4, "unsigned int", BENCH_BATCH, bench_mat4u_mul},
+    {"mat", "mat4u_mul_to", 4, "unsigned int", BENCH_BATCH, bench_mat4u_mul_to},
+    {"mat", "mat4u_nmul", 4, "unsigned int", BENCH_BATCH, bench_mat4u_nmul},
+    {"mat", "mat4u_mul_chain", 4, "unsigned int", BENCH_BATCH, bench_mat4u_mul_chain},
+    {"mat", "mat4u_mul_vec", 4, "unsigned int", BENCH_BATCH, bench_mat4u_mul_vec},
+    {"mat", "mat4u_mul_vec_to", 4, "unsigned int", BENCH_BATCH, bench_mat4u_mul_vec_to},
+    {"mat", "mat4u_hadamard", 4, "unsigned int", BENCH_BATCH, bench_mat4u_hadamard},
+    {"mat", "mat4u_hadamard_to", 4, "unsigned int", BENCH_BATCH, bench_mat4u_hadamard_to},
+    {"mat", "mat4u_transpose", 4, "unsigned int", BENCH_BATCH, bench_mat4u_transpose},
+    {"batch", "mat4u_transform_array", 4, "unsigned int", BENCH_BATCH, bench_mat4u_transform_array},
+    {"batch", "vec4u_soa_from_aos", 4, "unsigned int", BENCH_BATCH, bench_vec4u_soa_from_aos},
+    {"batch", "vec4u_soa_to_aos", 4, "unsigned int", BENCH_BATCH, bench_vec4u_soa_to_aos},
+    {"batch", "vec4u_soa_add", 4, "unsigned int", BENCH_BATCH, bench_vec4u_soa_add},
+    {"batch", "vec4u_soa_sub", 4, "unsigned int", BENCH_BATCH, bench_vec4u_soa_sub},
+    {"batch", "vec4u_soa_mul", 4, "unsigned int", BENCH_BATCH, bench_vec4u_soa_mul},
+    {"batch", "vec4u_soa_div", 4, "unsigned int", BENCH_BATCH, bench_vec4u_soa_div},
+    {"batch", "vec4u_soa_mod", 4, "unsigned int", BENCH_BATCH, bench_vec4u_soa_mod},
+    {"batch", "vec4u_soa_min", 4, "unsigned int", BENCH_BATCH, bench_vec4u_soa_min},
+    {"batch", "vec4u_soa_max", 4, "unsigned int", BENCH_BATCH, bench_vec4u_soa_max},
+    {"batch", "vec4u_soa_clamp", 4, "unsigned int", BENCH_BATCH, bench_vec4u_soa_clamp},
+    {"batch", "vec4u_soa_dot", 4, "unsigned int", BENCH_BATCH, bench_vec4u_soa_dot},
+    {"batch", "mat4u_mul_vec_soa", 4, "unsigned int", BENCH_BATCH, bench_mat4u_mul_vec_soa},
+    {"batch", "vec4h_to_vec4f_array", 4, "half_t", BENCH_BATCH, bench_vec4h_to_vec4f_array},
+    {"batch", "vec4h_from_vec4f_array", 4, "half_t", BENCH_BATCH, bench_vec4h_from_vec4f_array},
+    {"batch", "mat4f_transform_array_h", 4, "half_t", BENCH_BATCH, bench_mat4f_transform_array_h},
+    {"mat", "mat2x3f_mul_affine", 2, "float", BENCH_BATCH, bench_mat2x3f_mul_affine},
+    {"batch", "mat2x3f_transform_affine_array", 2, "float", BENCH_BATCH, bench_mat2x3f_transform_affine_array},
+    {"mat", "mat2x3d_mul_affine", 2, "double", BENCH_BATCH, bench_mat2x3d_mul_affine},
+    {"batch", "mat2x3d_transform_affine_array", 2, "double", BENCH_BATCH, bench_mat2x3d_transform_affine_array},
+    {"mat", "mat2x3i_mul_affine", 2, "int", BENCH_BATCH, bench_mat2x3i_mul_affine},
+    {"batch", "mat2x3i_transform_affine_array", 2, "int", BENCH_BATCH, bench_mat2x3i_transform_affine_array},
+    {"mat", "mat2x3u_mul_affine", 2, "unsigned int", BENCH_BATCH, bench_mat2x3u_mul_affine},
+    {"batch", "mat2x3u_transform_affine_array", 2, "unsigned int", BENCH_BATCH, bench_mat2x3u_transform_affine_array},
+    {"mat", "mat3x4f_mul_affine", 3, "float", BENCH_BATCH, bench_mat3x4f_mul_affine},
+    {"batch", "mat3x4f_transform_affine_array", 3, "float", BENCH_BATCH, bench_mat3x4f_transform_affine_array},
+    {"mat", "mat3x4d_mul_affine", 3, "double", BENCH_BATCH, bench_mat3x4d_mul_affine},
+    {"batch", "mat3x4d_transform_affine_array", 3, "double", BENCH_BATCH, bench_mat3x4d_transform_affine_array},
+    {"mat", "mat3x4i_mul_affine", 3, "int", BENCH_BATCH, bench_mat3x4i_mul_affine},
+    {"batch", "mat3x4i_transform_affine_array", 3, "int", BENCH_BATCH, bench_mat3x4i_transform_affine_array},
+    {"mat", "mat3x4u_mul_affine", 3, "unsigned int", BENCH_BATCH, bench_mat3x4u_mul_affine},
+    {"batch", "mat3x4u_transform_affine_array", 3, "unsigned int", BENCH_BATCH, bench_mat3x4u_transform_affine_array},
+    {"quat", "quatf_mul", 4, "float", BENCH_BATCH, bench_quatf_mul},
+    {"quat", "quatf_conjugate", 4, "float", BENCH_BATCH, bench_quatf_conjugate},
+    {"quat", "quatf_inverse", 4, "float", BENCH_BATCH, bench_quatf_inverse},
+    {"quat", "quatf_normalize", 4, "float", BENCH_BATCH, bench_quatf_normalize},
+    {"quat", "quatf_nlerp", 4, "float", BENCH_BATCH, bench_quatf_nlerp},
+    {"quat", "quatf_slerp", 4, "float", BENCH_BATCH, bench_quatf_slerp},
+    {"quat", "quatf_rotate_vec", 4, "float", BENCH_BATCH, bench_quatf_rotate_vec},
+    {"quat", "quatf_to_mat3", 4, "float", BENCH_BATCH, bench_quatf_to_mat3},
+    {"quat", "quatf_to_mat4", 4, "float", BENCH_BATCH, bench_quatf_to_mat4},
+    {"quat", "quatf_from_mat3", 4, "float", BENCH_BATCH, bench_quatf_from_mat3},
+    {"quat", "quatd_mul", 4, "double", BENCH_BATCH, bench_quatd_mul},
+    {"quat", "quatd_conjugate", 4, "double", BENCH_BATCH, bench_quatd_conjugate},
+    {"quat", "quatd_inverse", 4, "double", BENCH_BATCH, bench_quatd_inverse},
+    {"quat", "quatd_normalize", 4, "double", BENCH_BATCH, bench_quatd_normalize},
+    {"quat", "quatd_nlerp", 4, "double", BENCH_BATCH, bench_quatd_nlerp},
+    {"quat", "quatd_slerp", 4, "double", BENCH_BATCH, bench_quatd_slerp},
+    {"quat", "quatd_rotate_vec", 4, "double", BENCH_BATCH, bench_quatd_rotate_vec},
+    {"quat", "quatd_to_mat3", 4, "double", BENCH_BATCH, bench_quatd_to_mat3},
+    {"quat", "quatd_to_mat4", 4, "double", BENCH_BATCH, bench_quatd_to_mat4},
+    {"quat", "quatd_from_mat3", 4, "double", BENCH_BATCH, bench_quatd_from_mat3},
+};
+
+// Usage: linalg_bench [function name filter]
+int main(int argc, char **argv) {
+    bench_vec2f_init();
+    bench_vec2d_init();
+    bench_vec2i_init();
+    bench_vec2u_init();
+    bench_vec2h_init();
+    bench_vec3f_init();
+    bench_vec3d_init();
+    bench_vec3i_init();
+    bench_vec3u_init();
+    bench_vec3h_init();
+    bench_vec4f_init();
+    bench_vec4d_init();
+    bench_vec4i_init();
+    bench_vec4u_init();
+    bench_vec4h_init();
+    bench_mat2x3f_init();
+    bench_mat2x3d_init();
+    bench_mat2x3i_init();
+    bench_mat2x3u_init();
+    bench_mat3x4f_init();
+    bench_mat3x4d_init();
+    bench_mat3x4i_init();
+    bench_mat3x4u_init();
+    bench_quatf_init();
+    bench_quatd_init();
+    const char *filter = argc > 1 ? argv[1] : NULL;
+    bench_run(benches, sizeof(benches) / sizeof(benches[0]), filter, stdout);
+    return 0;
+}
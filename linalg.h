@@ -2,6 +2,7 @@
 #define LINALG_H
 
 #include "src/maths.h"
+#include <assert.h>
 #include <math.h>
 #include <stdarg.h>
 
@@ -9,9 +10,43 @@
 typedef unsigned long size_t;
 #endif // __STDDEF_H
 
+#ifdef LINALG_STATIC
+#define LINALG_IMPLEMENTATION
 #ifndef LINALG_DEF
 #define LINALG_DEF static inline
 #endif // LINALG_DEF
+#endif // LINALG_STATIC
+
+#ifndef LINALG_DEF
+#define LINALG_DEF extern
+#endif // LINALG_DEF
+
+#ifndef LINALG_INLINE
+#if defined(__GNUC__) || defined(__clang__)
+#define LINALG_INLINE static inline __attribute__((always_inline))
+#else
+#define LINALG_INLINE static inline
+#endif
+#endif // LINALG_INLINE
+
+#ifndef LINALG_PAIRWISE_BLOCK
+#define LINALG_PAIRWISE_BLOCK 8
+#endif // LINALG_PAIRWISE_BLOCK
+
+#ifdef LINALG_SIMD
+#ifndef __SSE__
+#error "LINALG_SIMD requires a target with SSE."
+#endif // __SSE__
+#include <immintrin.h>
+
+LINALG_INLINE __m128 linalg_madd_ps(__m128 a, __m128 b, __m128 c) {
+#ifdef __FMA__
+    return _mm_fmadd_ps(a, b, c);
+#else
+    return _mm_add_ps(_mm_mul_ps(a, b), c);
+#endif // __FMA__
+}
+#endif // LINALG_SIMD
 
 typedef enum {
     AXIS_X = 0,
@@ -19,6 +54,50 @@ typedef enum {
     AXIS_Z,
 } rotate_axis_s;
 
+// IEEE 754 half precision bits, for storage only: see `vecN<h>_t`.
+typedef unsigned short half_t;
+
+#ifndef LINALG_HALF_BLOCK
+#define LINALG_HALF_BLOCK 64
+#endif // LINALG_HALF_BLOCK
+
+LINALG_INLINE float linalg_half_to_float(half_t h) {
+    union {
+        unsigned int u;
+        float f;
+    } v = {.u = (h & 0x7FFFu) << 13};
+    v.f *= 0x1p112f;
+    if (v.f >= 0x1p16f) {
+        v.u |= 0xFFu << 23; // Infinity or NaN.
+    }
+    v.u |= (h & 0x8000u) << 16;
+    return v.f;
+}
+
+LINALG_INLINE half_t linalg_float_to_half(float x) {
+    union {
+        unsigned int u;
+        float f;
+    } v = {.f = x};
+    unsigned int sign = (v.u >> 16) & 0x8000u;
+    unsigned int h;
+    v.u &= 0x7FFFFFFFu;
+    if (v.u >= 0x47800000u) {
+        // Out of range (>= 2^16), infinity or NaN.
+        h = v.u > 0x7F800000u ? 0x7E00u : 0x7C00u;
+    } else if (v.u < 0x38800000u) {
+        // Subnormal or zero (< 2^-14): adding 0.5 lines the mantissa up
+        // with the half ulp, and lets the FPU round it.
+        v.f += 0.5f;
+        h = v.u - 0x3F000000u;
+    } else {
+        // Rebias the exponent and round the 13 dropped bits to even.
+        unsigned int odd = (v.u >> 13) & 1u;
+        h = (v.u - (112u << 23) + 0xFFFu + odd) >> 13;
+    }
+    return (half_t)(h | sign);
+}
+
 typedef union {
     struct {
         float x, y;
@@ -39,6 +118,11 @@ typedef union {
     vec2f_t v[2];
 } mat2f_t;
 
+typedef struct {
+    float *x, *y;
+    size_t n;
+} vec2f_soa_t;
+
 typedef union {
     struct {
         double x, y;
@@ -59,6 +143,11 @@ typedef union {
     vec2d_t v[2];
 } mat2d_t;
 
+typedef struct {
+    double *x, *y;
+    size_t n;
+} vec2d_soa_t;
+
 typedef union {
     struct {
         int x, y;
@@ -76,6 +165,11 @@ typedef union {
     vec2i_t v[2];
 } mat2i_t;
 
+typedef struct {
+    int *x, *y;
+    size_t n;
+} vec2i_soa_t;
+
 typedef union {
     struct {
         unsigned int x, y;
@@ -93,6 +187,18 @@ typedef union {
     vec2u_t v[2];
 } mat2u_t;
 
+typedef struct {
+    unsigned int *x, *y;
+    size_t n;
+} vec2u_soa_t;
+
+typedef union {
+    struct {
+        half_t x, y;
+    };
+    half_t e[2];
+} vec2h_t;
+
 typedef union {
     struct {
         float x, y, z;
@@ -114,6 +220,11 @@ typedef union {
     vec3f_t v[3];
 } mat3f_t;
 
+typedef struct {
+    float *x, *y, *z;
+    size_t n;
+} vec3f_soa_t;
+
 typedef union {
     struct {
         double x, y, z;
@@ -135,6 +246,11 @@ typedef union {
     vec3d_t v[3];
 } mat3d_t;
 
+typedef struct {
+    double *x, *y, *z;
+    size_t n;
+} vec3d_soa_t;
+
 typedef union {
     struct {
         int x, y, z;
@@ -156,6 +272,11 @@ typedef union {
     vec3i_t v[3];
 } mat3i_t;
 
+typedef struct {
+    int *x, *y, *z;
+    size_t n;
+} vec3i_soa_t;
+
 typedef union {
     struct {
         unsigned int x, y, z;
@@ -177,6 +298,21 @@ typedef union {
     vec3u_t v[3];
 } mat3u_t;
 
+typedef struct {
+    unsigned int *x, *y, *z;
+    size_t n;
+} vec3u_soa_t;
+
+typedef union {
+    struct {
+        half_t x, y, z;
+    };
+    struct {
+        half_t r, g, b;
+    };
+    half_t e[3];
+} vec3h_t;
+
 typedef union {
     struct {
         float x, y, z, w;
@@ -185,6 +321,9 @@ typedef union {
         float r, g, b, a;
     };
     float e[4];
+#ifdef LINALG_SIMD
+    __m128 m;
+#endif // LINALG_SIMD
 } vec4f_t;
 
 typedef union {
@@ -197,8 +336,16 @@ typedef union {
     float M[4][4];
     float e[4 * 4];
     vec4f_t v[4];
+#ifdef LINALG_SIMD
+    __m128 m[4];
+#endif // LINALG_SIMD
 } mat4f_t;
 
+typedef struct {
+    float *x, *y, *z, *w;
+    size_t n;
+} vec4f_soa_t;
+
 typedef union {
     struct {
         double x, y, z, w;
@@ -221,6 +368,11 @@ typedef union {
     vec4d_t v[4];
 } mat4d_t;
 
+typedef struct {
+    double *x, *y, *z, *w;
+    size_t n;
+} vec4d_soa_t;
+
 typedef union {
     struct {
         int x, y, z, w;
@@ -243,6 +395,11 @@ typedef union {
     vec4i_t v[4];
 } mat4i_t;
 
+typedef struct {
+    int *x, *y, *z, *w;
+    size_t n;
+} vec4i_soa_t;
+
 typedef union {
     struct {
         unsigned int x, y, z, w;
@@ -265,184 +422,537 @@ typedef union {
     vec4u_t v[4];
 } mat4u_t;
 
-LINALG_DEF vec2f_t vec2f(float x, float y) {
+typedef struct {
+    unsigned int *x, *y, *z, *w;
+    size_t n;
+} vec4u_soa_t;
+
+typedef union {
+    struct {
+        half_t x, y, z, w;
+    };
+    struct {
+        half_t r, g, b, a;
+    };
+    half_t e[4];
+} vec4h_t;
+
+typedef union {
+    struct {
+        float _11, _12, _13;
+        float _21, _22, _23;
+    };
+    float M[2][3];
+    float e[2 * 3];
+    vec3f_t v[2];
+} mat2x3f_t;
+
+typedef union {
+    struct {
+        double _11, _12, _13;
+        double _21, _22, _23;
+    };
+    double M[2][3];
+    double e[2 * 3];
+    vec3d_t v[2];
+} mat2x3d_t;
+
+typedef union {
+    struct {
+        int _11, _12, _13;
+        int _21, _22, _23;
+    };
+    int M[2][3];
+    int e[2 * 3];
+    vec3i_t v[2];
+} mat2x3i_t;
+
+typedef union {
+    struct {
+        unsigned int _11, _12, _13;
+        unsigned int _21, _22, _23;
+    };
+    unsigned int M[2][3];
+    unsigned int e[2 * 3];
+    vec3u_t v[2];
+} mat2x3u_t;
+
+typedef union {
+    struct {
+        float _11, _12, _13, _14;
+        float _21, _22, _23, _24;
+    };
+    float M[2][4];
+    float e[2 * 4];
+    vec4f_t v[2];
+} mat2x4f_t;
+
+typedef union {
+    struct {
+        double _11, _12, _13, _14;
+        double _21, _22, _23, _24;
+    };
+    double M[2][4];
+    double e[2 * 4];
+    vec4d_t v[2];
+} mat2x4d_t;
+
+typedef union {
+    struct {
+        int _11, _12, _13, _14;
+        int _21, _22, _23, _24;
+    };
+    int M[2][4];
+    int e[2 * 4];
+    vec4i_t v[2];
+} mat2x4i_t;
+
+typedef union {
+    struct {
+        unsigned int _11, _12, _13, _14;
+        unsigned int _21, _22, _23, _24;
+    };
+    unsigned int M[2][4];
+    unsigned int e[2 * 4];
+    vec4u_t v[2];
+} mat2x4u_t;
+
+typedef union {
+    struct {
+        float _11, _12;
+        float _21, _22;
+        float _31, _32;
+    };
+    float M[3][2];
+    float e[3 * 2];
+    vec2f_t v[3];
+} mat3x2f_t;
+
+typedef union {
+    struct {
+        double _11, _12;
+        double _21, _22;
+        double _31, _32;
+    };
+    double M[3][2];
+    double e[3 * 2];
+    vec2d_t v[3];
+} mat3x2d_t;
+
+typedef union {
+    struct {
+        int _11, _12;
+        int _21, _22;
+        int _31, _32;
+    };
+    int M[3][2];
+    int e[3 * 2];
+    vec2i_t v[3];
+} mat3x2i_t;
+
+typedef union {
+    struct {
+        unsigned int _11, _12;
+        unsigned int _21, _22;
+        unsigned int _31, _32;
+    };
+    unsigned int M[3][2];
+    unsigned int e[3 * 2];
+    vec2u_t v[3];
+} mat3x2u_t;
+
+typedef union {
+    struct {
+        float _11, _12, _13, _14;
+        float _21, _22, _23, _24;
+        float _31, _32, _33, _34;
+    };
+    float M[3][4];
+    float e[3 * 4];
+    vec4f_t v[3];
+} mat3x4f_t;
+
+typedef union {
+    struct {
+        double _11, _12, _13, _14;
+        double _21, _22, _23, _24;
+        double _31, _32, _33, _34;
+    };
+    double M[3][4];
+    double e[3 * 4];
+    vec4d_t v[3];
+} mat3x4d_t;
+
+typedef union {
+    struct {
+        int _11, _12, _13, _14;
+        int _21, _22, _23, _24;
+        int _31, _32, _33, _34;
+    };
+    int M[3][4];
+    int e[3 * 4];
+    vec4i_t v[3];
+} mat3x4i_t;
+
+typedef union {
+    struct {
+        unsigned int _11, _12, _13, _14;
+        unsigned int _21, _22, _23, _24;
+        unsigned int _31, _32, _33, _34;
+    };
+    unsigned int M[3][4];
+    unsigned int e[3 * 4];
+    vec4u_t v[3];
+} mat3x4u_t;
+
+typedef union {
+    struct {
+        float _11, _12;
+        float _21, _22;
+        float _31, _32;
+        float _41, _42;
+    };
+    float M[4][2];
+    float e[4 * 2];
+    vec2f_t v[4];
+} mat4x2f_t;
+
+typedef union {
+    struct {
+        double _11, _12;
+        double _21, _22;
+        double _31, _32;
+        double _41, _42;
+    };
+    double M[4][2];
+    double e[4 * 2];
+    vec2d_t v[4];
+} mat4x2d_t;
+
+typedef union {
+    struct {
+        int _11, _12;
+        int _21, _22;
+        int _31, _32;
+        int _41, _42;
+    };
+    int M[4][2];
+    int e[4 * 2];
+    vec2i_t v[4];
+} mat4x2i_t;
+
+typedef union {
+    struct {
+        unsigned int _11, _12;
+        unsigned int _21, _22;
+        unsigned int _31, _32;
+        unsigned int _41, _42;
+    };
+    unsigned int M[4][2];
+    unsigned int e[4 * 2];
+    vec2u_t v[4];
+} mat4x2u_t;
+
+typedef union {
+    struct {
+        float _11, _12, _13;
+        float _21, _22, _23;
+        float _31, _32, _33;
+        float _41, _42, _43;
+    };
+    float M[4][3];
+    float e[4 * 3];
+    vec3f_t v[4];
+} mat4x3f_t;
+
+typedef union {
+    struct {
+        double _11, _12, _13;
+        double _21, _22, _23;
+        double _31, _32, _33;
+        double _41, _42, _43;
+    };
+    double M[4][3];
+    double e[4 * 3];
+    vec3d_t v[4];
+} mat4x3d_t;
+
+typedef union {
+    struct {
+        int _11, _12, _13;
+        int _21, _22, _23;
+        int _31, _32, _33;
+        int _41, _42, _43;
+    };
+    int M[4][3];
+    int e[4 * 3];
+    vec3i_t v[4];
+} mat4x3i_t;
+
+typedef union {
+    struct {
+        unsigned int _11, _12, _13;
+        unsigned int _21, _22, _23;
+        unsigned int _31, _32, _33;
+        unsigned int _41, _42, _43;
+    };
+    unsigned int M[4][3];
+    unsigned int e[4 * 3];
+    vec3u_t v[4];
+} mat4x3u_t;
+
+typedef union {
+    struct {
+        float x, y, z, w;
+    };
+    float e[4];
+    vec4f_t v;
+} quatf_t;
+
+typedef union {
+    struct {
+        double x, y, z, w;
+    };
+    double e[4];
+    vec4d_t v;
+} quatd_t;
+
+// Types of this header, for the modules built on it.
+#define LINALG_HAS_VEC2F
+#define LINALG_HAS_MAT2F
+#define LINALG_HAS_VEC2F_SOA
+#define LINALG_HAS_VEC2D
+#define LINALG_HAS_MAT2D
+#define LINALG_HAS_VEC2D_SOA
+#define LINALG_HAS_VEC2I
+#define LINALG_HAS_MAT2I
+#define LINALG_HAS_VEC2I_SOA
+#define LINALG_HAS_VEC2U
+#define LINALG_HAS_MAT2U
+#define LINALG_HAS_VEC2U_SOA
+#define LINALG_HAS_VEC2H
+#define LINALG_HAS_VEC3F
+#define LINALG_HAS_MAT3F
+#define LINALG_HAS_VEC3F_SOA
+#define LINALG_HAS_VEC3D
+#define LINALG_HAS_MAT3D
+#define LINALG_HAS_VEC3D_SOA
+#define LINALG_HAS_VEC3I
+#define LINALG_HAS_MAT3I
+#define LINALG_HAS_VEC3I_SOA
+#define LINALG_HAS_VEC3U
+#define LINALG_HAS_MAT3U
+#define LINALG_HAS_VEC3U_SOA
+#define LINALG_HAS_VEC3H
+#define LINALG_HAS_VEC4F
+#define LINALG_HAS_MAT4F
+#define LINALG_HAS_VEC4F_SOA
+#define LINALG_HAS_VEC4D
+#define LINALG_HAS_MAT4D
+#define LINALG_HAS_VEC4D_SOA
+#define LINALG_HAS_VEC4I
+#define LINALG_HAS_MAT4I
+#define LINALG_HAS_VEC4I_SOA
+#define LINALG_HAS_VEC4U
+#define LINALG_HAS_MAT4U
+#define LINALG_HAS_VEC4U_SOA
+#define LINALG_HAS_VEC4H
+#define LINALG_HAS_QUATF
+#define LINALG_HAS_QUATD
+
+LINALG_INLINE vec2f_t vec2f(float x, float y) {
     vec2f_t v = {{x, y}};
     return v;
 }
 
-vec2f_t vec2f_splat(float x) {
+LINALG_INLINE vec2f_t vec2f_splat(float x) {
     vec2f_t v = {{x, x}};
     return v;
 }
 
-LINALG_DEF mat2f_t mat2f_zero(void) {
+LINALG_INLINE mat2f_t mat2f_zero(void) {
     mat2f_t M = {0};
     return M;
 }
 
-LINALG_DEF mat2f_t mat2f_I(void) {
+LINALG_INLINE mat2f_t mat2f_I(void) {
     mat2f_t M = {0};
     M._11 = 1;
     M._22 = 1;
     return M;
 }
 
-LINALG_DEF mat2f_t mat2f_splat(float x) {
+LINALG_INLINE mat2f_t mat2f_splat(float x) {
     mat2f_t M = {0};
     M._11 = x;
     M._22 = x;
     return M;
 }
 
-LINALG_DEF mat2f_t mat2f_diag(vec2f_t diag) {
+LINALG_INLINE mat2f_t mat2f_diag(vec2f_t diag) {
     mat2f_t M = {0};
     M._11 = diag.e[0];
     M._22 = diag.e[1];
     return M;
 }
 
-LINALG_DEF mat2f_t mat2f_R(float angle) {
+LINALG_INLINE mat2f_t mat2f_R(float angle) {
+    const float c = cosf(angle);
+    const float s = sinf(angle);
+    mat2f_t R;
+    R._11 = c;
+    R._12 = -s;
+    R._21 = s;
+    R._22 = c;
+    return R;
+}
+
+LINALG_INLINE mat2f_t mat2f_R_fast(float angle) {
+    float c, s;
+    sincosf_fast(angle, &s, &c);
     mat2f_t R;
-    R._11 = cosf(angle);
-    R._12 = -sinf(angle);
-    R._21 = sinf(angle);
-    R._22 = cosf(angle);
+    R._11 = c;
+    R._12 = -s;
+    R._21 = s;
+    R._22 = c;
     return R;
 }
 
-LINALG_DEF vec2d_t vec2d(double x, double y) {
+LINALG_INLINE vec2d_t vec2d(double x, double y) {
     vec2d_t v = {{x, y}};
     return v;
 }
 
-vec2d_t vec2d_splat(double x) {
+LINALG_INLINE vec2d_t vec2d_splat(double x) {
     vec2d_t v = {{x, x}};
     return v;
 }
 
-LINALG_DEF mat2d_t mat2d_zero(void) {
+LINALG_INLINE mat2d_t mat2d_zero(void) {
     mat2d_t M = {0};
     return M;
 }
 
-LINALG_DEF mat2d_t mat2d_I(void) {
+LINALG_INLINE mat2d_t mat2d_I(void) {
     mat2d_t M = {0};
     M._11 = 1;
     M._22 = 1;
     return M;
 }
 
-LINALG_DEF mat2d_t mat2d_splat(double x) {
+LINALG_INLINE mat2d_t mat2d_splat(double x) {
     mat2d_t M = {0};
     M._11 = x;
     M._22 = x;
     return M;
 }
 
-LINALG_DEF mat2d_t mat2d_diag(vec2d_t diag) {
+LINALG_INLINE mat2d_t mat2d_diag(vec2d_t diag) {
     mat2d_t M = {0};
     M._11 = diag.e[0];
     M._22 = diag.e[1];
     return M;
 }
 
-LINALG_DEF mat2d_t mat2d_R(double angle) {
+LINALG_INLINE mat2d_t mat2d_R(double angle) {
+    const double c = cos(angle);
+    const double s = sin(angle);
     mat2d_t R;
-    R._11 = cos(angle);
-    R._12 = -sin(angle);
-    R._21 = sin(angle);
-    R._22 = cos(angle);
+    R._11 = c;
+    R._12 = -s;
+    R._21 = s;
+    R._22 = c;
     return R;
 }
 
-LINALG_DEF vec2i_t vec2i(int x, int y) {
+LINALG_INLINE vec2i_t vec2i(int x, int y) {
     vec2i_t v = {{x, y}};
     return v;
 }
 
-vec2i_t vec2i_splat(int x) {
+LINALG_INLINE vec2i_t vec2i_splat(int x) {
     vec2i_t v = {{x, x}};
     return v;
 }
 
-LINALG_DEF mat2i_t mat2i_zero(void) {
+LINALG_INLINE mat2i_t mat2i_zero(void) {
     mat2i_t M = {0};
     return M;
 }
 
-LINALG_DEF mat2i_t mat2i_I(void) {
+LINALG_INLINE mat2i_t mat2i_I(void) {
     mat2i_t M = {0};
     M._11 = 1;
     M._22 = 1;
     return M;
 }
 
-LINALG_DEF mat2i_t mat2i_splat(int x) {
+LINALG_INLINE mat2i_t mat2i_splat(int x) {
     mat2i_t M = {0};
     M._11 = x;
     M._22 = x;
     return M;
 }
 
-LINALG_DEF mat2i_t mat2i_diag(vec2i_t diag) {
+LINALG_INLINE mat2i_t mat2i_diag(vec2i_t diag) {
     mat2i_t M = {0};
     M._11 = diag.e[0];
     M._22 = diag.e[1];
     return M;
 }
 
-LINALG_DEF vec2u_t vec2u(unsigned int x, unsigned int y) {
+LINALG_INLINE vec2u_t vec2u(unsigned int x, unsigned int y) {
     vec2u_t v = {{x, y}};
     return v;
 }
 
-vec2u_t vec2u_splat(unsigned int x) {
+LINALG_INLINE vec2u_t vec2u_splat(unsigned int x) {
     vec2u_t v = {{x, x}};
     return v;
 }
 
-LINALG_DEF mat2u_t mat2u_zero(void) {
+LINALG_INLINE mat2u_t mat2u_zero(void) {
     mat2u_t M = {0};
     return M;
 }
 
-LINALG_DEF mat2u_t mat2u_I(void) {
+LINALG_INLINE mat2u_t mat2u_I(void) {
     mat2u_t M = {0};
     M._11 = 1;
     M._22 = 1;
     return M;
 }
 
-LINALG_DEF mat2u_t mat2u_splat(unsigned int x) {
+LINALG_INLINE mat2u_t mat2u_splat(unsigned int x) {
     mat2u_t M = {0};
     M._11 = x;
     M._22 = x;
     return M;
 }
 
-LINALG_DEF mat2u_t mat2u_diag(vec2u_t diag) {
+LINALG_INLINE mat2u_t mat2u_diag(vec2u_t diag) {
     mat2u_t M = {0};
     M._11 = diag.e[0];
     M._22 = diag.e[1];
     return M;
 }
 
-LINALG_DEF vec3f_t vec3f(float x, float y, float z) {
+LINALG_INLINE vec3f_t vec3f(float x, float y, float z) {
     vec3f_t v = {{x, y, z}};
     return v;
 }
 
-vec3f_t vec3f_splat(float x) {
+LINALG_INLINE vec3f_t vec3f_splat(float x) {
     vec3f_t v = {{x, x, x}};
     return v;
 }
 
-LINALG_DEF mat3f_t mat3f_zero(void) {
+LINALG_INLINE mat3f_t mat3f_zero(void) {
     mat3f_t M = {0};
     return M;
 }
 
-LINALG_DEF mat3f_t mat3f_I(void) {
+LINALG_INLINE mat3f_t mat3f_I(void) {
     mat3f_t M = {0};
     M._11 = 1;
     M._22 = 1;
@@ -450,7 +960,7 @@ LINALG_DEF mat3f_t mat3f_I(void) {
     return M;
 }
 
-LINALG_DEF mat3f_t mat3f_splat(float x) {
+LINALG_INLINE mat3f_t mat3f_splat(float x) {
     mat3f_t M = {0};
     M._11 = x;
     M._22 = x;
@@ -458,7 +968,7 @@ LINALG_DEF mat3f_t mat3f_splat(float x) {
     return M;
 }
 
-LINALG_DEF mat3f_t mat3f_diag(vec3f_t diag) {
+LINALG_INLINE mat3f_t mat3f_diag(vec3f_t diag) {
     mat3f_t M = {0};
     M._11 = diag.e[0];
     M._22 = diag.e[1];
@@ -466,33 +976,50 @@ LINALG_DEF mat3f_t mat3f_diag(vec3f_t diag) {
     return M;
 }
 
-LINALG_DEF mat3f_t mat3f_R(rotate_axis_s axis, float angle) {
+LINALG_INLINE mat3f_t mat3f_R(rotate_axis_s axis, float angle) {
+    const float c = cosf(angle);
+    const float s = sinf(angle);
+    mat3f_t R = {0};
+    size_t i = (axis + 1) % 3;
+    size_t j = (axis + 2) % 3;
+    R.M[i][i] = c;
+    R.M[i][j] = -s;
+    R.M[j][i] = s;
+    R.M[j][j] = c;
+    R.M[axis][axis] = 1;
+    return R;
+}
+
+LINALG_INLINE mat3f_t mat3f_R_fast(rotate_axis_s axis, float angle) {
+    float c, s;
+    sincosf_fast(angle, &s, &c);
     mat3f_t R = {0};
     size_t i = (axis + 1) % 3;
     size_t j = (axis + 2) % 3;
-    R.M[i][i] = cosf(angle);
-    R.M[i][j] = -sinf(angle);
-    R.M[j][i] = sinf(angle);
-    R.M[j][j] = cosf(angle);
+    R.M[i][i] = c;
+    R.M[i][j] = -s;
+    R.M[j][i] = s;
+    R.M[j][j] = c;
+    R.M[axis][axis] = 1;
     return R;
 }
 
-LINALG_DEF vec3d_t vec3d(double x, double y, double z) {
+LINALG_INLINE vec3d_t vec3d(double x, double y, double z) {
     vec3d_t v = {{x, y, z}};
     return v;
 }
 
-vec3d_t vec3d_splat(double x) {
+LINALG_INLINE vec3d_t vec3d_splat(double x) {
     vec3d_t v = {{x, x, x}};
     return v;
 }
 
-LINALG_DEF mat3d_t mat3d_zero(void) {
+LINALG_INLINE mat3d_t mat3d_zero(void) {
     mat3d_t M = {0};
     return M;
 }
 
-LINALG_DEF mat3d_t mat3d_I(void) {
+LINALG_INLINE mat3d_t mat3d_I(void) {
     mat3d_t M = {0};
     M._11 = 1;
     M._22 = 1;
@@ -500,7 +1027,7 @@ LINALG_DEF mat3d_t mat3d_I(void) {
     return M;
 }
 
-LINALG_DEF mat3d_t mat3d_splat(double x) {
+LINALG_INLINE mat3d_t mat3d_splat(double x) {
     mat3d_t M = {0};
     M._11 = x;
     M._22 = x;
@@ -508,7 +1035,7 @@ LINALG_DEF mat3d_t mat3d_splat(double x) {
     return M;
 }
 
-LINALG_DEF mat3d_t mat3d_diag(vec3d_t diag) {
+LINALG_INLINE mat3d_t mat3d_diag(vec3d_t diag) {
     mat3d_t M = {0};
     M._11 = diag.e[0];
     M._22 = diag.e[1];
@@ -516,33 +1043,36 @@ LINALG_DEF mat3d_t mat3d_diag(vec3d_t diag) {
     return M;
 }
 
-LINALG_DEF mat3d_t mat3d_R(rotate_axis_s axis, double angle) {
+LINALG_INLINE mat3d_t mat3d_R(rotate_axis_s axis, double angle) {
+    const double c = cos(angle);
+    const double s = sin(angle);
     mat3d_t R = {0};
     size_t i = (axis + 1) % 3;
     size_t j = (axis + 2) % 3;
-    R.M[i][i] = cos(angle);
-    R.M[i][j] = -sin(angle);
-    R.M[j][i] = sin(angle);
-    R.M[j][j] = cos(angle);
+    R.M[i][i] = c;
+    R.M[i][j] = -s;
+    R.M[j][i] = s;
+    R.M[j][j] = c;
+    R.M[axis][axis] = 1;
     return R;
 }
 
-LINALG_DEF vec3i_t vec3i(int x, int y, int z) {
+LINALG_INLINE vec3i_t vec3i(int x, int y, int z) {
     vec3i_t v = {{x, y, z}};
     return v;
 }
 
-vec3i_t vec3i_splat(int x) {
+LINALG_INLINE vec3i_t vec3i_splat(int x) {
     vec3i_t v = {{x, x, x}};
     return v;
 }
 
-LINALG_DEF mat3i_t mat3i_zero(void) {
+LINALG_INLINE mat3i_t mat3i_zero(void) {
     mat3i_t M = {0};
     return M;
 }
 
-LINALG_DEF mat3i_t mat3i_I(void) {
+LINALG_INLINE mat3i_t mat3i_I(void) {
     mat3i_t M = {0};
     M._11 = 1;
     M._22 = 1;
@@ -550,7 +1080,7 @@ LINALG_DEF mat3i_t mat3i_I(void) {
     return M;
 }
 
-LINALG_DEF mat3i_t mat3i_splat(int x) {
+LINALG_INLINE mat3i_t mat3i_splat(int x) {
     mat3i_t M = {0};
     M._11 = x;
     M._22 = x;
@@ -558,7 +1088,7 @@ LINALG_DEF mat3i_t mat3i_splat(int x) {
     return M;
 }
 
-LINALG_DEF mat3i_t mat3i_diag(vec3i_t diag) {
+LINALG_INLINE mat3i_t mat3i_diag(vec3i_t diag) {
     mat3i_t M = {0};
     M._11 = diag.e[0];
     M._22 = diag.e[1];
@@ -566,22 +1096,22 @@ LINALG_DEF mat3i_t mat3i_diag(vec3i_t diag) {
     return M;
 }
 
-LINALG_DEF vec3u_t vec3u(unsigned int x, unsigned int y, unsigned int z) {
+LINALG_INLINE vec3u_t vec3u(unsigned int x, unsigned int y, unsigned int z) {
     vec3u_t v = {{x, y, z}};
     return v;
 }
 
-vec3u_t vec3u_splat(unsigned int x) {
+LINALG_INLINE vec3u_t vec3u_splat(unsigned int x) {
     vec3u_t v = {{x, x, x}};
     return v;
 }
 
-LINALG_DEF mat3u_t mat3u_zero(void) {
+LINALG_INLINE mat3u_t mat3u_zero(void) {
     mat3u_t M = {0};
     return M;
 }
 
-LINALG_DEF mat3u_t mat3u_I(void) {
+LINALG_INLINE mat3u_t mat3u_I(void) {
     mat3u_t M = {0};
     M._11 = 1;
     M._22 = 1;
@@ -589,7 +1119,7 @@ LINALG_DEF mat3u_t mat3u_I(void) {
     return M;
 }
 
-LINALG_DEF mat3u_t mat3u_splat(unsigned int x) {
+LINALG_INLINE mat3u_t mat3u_splat(unsigned int x) {
     mat3u_t M = {0};
     M._11 = x;
     M._22 = x;
@@ -597,7 +1127,7 @@ LINALG_DEF mat3u_t mat3u_splat(unsigned int x) {
     return M;
 }
 
-LINALG_DEF mat3u_t mat3u_diag(vec3u_t diag) {
+LINALG_INLINE mat3u_t mat3u_diag(vec3u_t diag) {
     mat3u_t M = {0};
     M._11 = diag.e[0];
     M._22 = diag.e[1];
@@ -605,22 +1135,22 @@ LINALG_DEF mat3u_t mat3u_diag(vec3u_t diag) {
     return M;
 }
 
-LINALG_DEF vec4f_t vec4f(float x, float y, float z, float w) {
+LINALG_INLINE vec4f_t vec4f(float x, float y, float z, float w) {
     vec4f_t v = {{x, y, z, w}};
     return v;
 }
 
-vec4f_t vec4f_splat(float x) {
+LINALG_INLINE vec4f_t vec4f_splat(float x) {
     vec4f_t v = {{x, x, x, x}};
     return v;
 }
 
-LINALG_DEF mat4f_t mat4f_zero(void) {
+LINALG_INLINE mat4f_t mat4f_zero(void) {
     mat4f_t M = {0};
     return M;
 }
 
-LINALG_DEF mat4f_t mat4f_I(void) {
+LINALG_INLINE mat4f_t mat4f_I(void) {
     mat4f_t M = {0};
     M._11 = 1;
     M._22 = 1;
@@ -629,7 +1159,7 @@ LINALG_DEF mat4f_t mat4f_I(void) {
     return M;
 }
 
-LINALG_DEF mat4f_t mat4f_splat(float x) {
+LINALG_INLINE mat4f_t mat4f_splat(float x) {
     mat4f_t M = {0};
     M._11 = x;
     M._22 = x;
@@ -638,7 +1168,7 @@ LINALG_DEF mat4f_t mat4f_splat(float x) {
     return M;
 }
 
-LINALG_DEF mat4f_t mat4f_diag(vec4f_t diag) {
+LINALG_INLINE mat4f_t mat4f_diag(vec4f_t diag) {
     mat4f_t M = {0};
     M._11 = diag.e[0];
     M._22 = diag.e[1];
@@ -647,45 +1177,82 @@ LINALG_DEF mat4f_t mat4f_diag(vec4f_t diag) {
     return M;
 }
 
-LINALG_DEF mat4f_t mat4f_R(rotate_axis_s axis, float angle) {
+LINALG_INLINE mat4f_t mat4f_R(rotate_axis_s axis, float angle) {
+    const float c = cosf(angle);
+    const float s = sinf(angle);
+    mat4f_t R = {0};
+    size_t i = (axis + 1) % 3;
+    size_t j = (axis + 2) % 3;
+    R.M[i][i] = c;
+    R.M[i][j] = -s;
+    R.M[j][i] = s;
+    R.M[j][j] = c;
+    R.M[axis][axis] = 1;
+    R.M[3][3] = 1;
+    return R;
+}
+
+LINALG_INLINE mat4f_t mat4f_R_fast(rotate_axis_s axis, float angle) {
+    float c, s;
+    sincosf_fast(angle, &s, &c);
     mat4f_t R = {0};
     size_t i = (axis + 1) % 3;
     size_t j = (axis + 2) % 3;
-    R.M[i][i] = cosf(angle);
-    R.M[i][j] = -sinf(angle);
-    R.M[j][i] = sinf(angle);
-    R.M[j][j] = cosf(angle);
+    R.M[i][i] = c;
+    R.M[i][j] = -s;
+    R.M[j][i] = s;
+    R.M[j][j] = c;
+    R.M[axis][axis] = 1;
+    R.M[3][3] = 1;
     return R;
 }
 
-LINALG_DEF mat4f_t mat4f_T(rotate_axis_s axis, float angle) {
+LINALG_INLINE mat4f_t mat4f_T(rotate_axis_s axis, float angle) {
+    const float c = cosf(angle);
+    const float s = sinf(angle);
+    mat4f_t T = {0};
+    size_t i = (axis + 1) % 3;
+    size_t j = (axis + 2) % 3;
+    T.M[i][i] = c;
+    T.M[i][j] = -s;
+    T.M[j][i] = s;
+    T.M[j][j] = c;
+    T.M[axis][axis] = 1;
+    T.M[3][3] = 1;
+    return T;
+}
+
+LINALG_INLINE mat4f_t mat4f_T_fast(rotate_axis_s axis, float angle) {
+    float c, s;
+    sincosf_fast(angle, &s, &c);
     mat4f_t T = {0};
     size_t i = (axis + 1) % 3;
     size_t j = (axis + 2) % 3;
-    T.M[i][i] = cosf(angle);
-    T.M[i][j] = -sinf(angle);
-    T.M[j][i] = sinf(angle);
-    T.M[j][j] = cosf(angle);
+    T.M[i][i] = c;
+    T.M[i][j] = -s;
+    T.M[j][i] = s;
+    T.M[j][j] = c;
+    T.M[axis][axis] = 1;
     T.M[3][3] = 1;
     return T;
 }
 
-LINALG_DEF vec4d_t vec4d(double x, double y, double z, double w) {
+LINALG_INLINE vec4d_t vec4d(double x, double y, double z, double w) {
     vec4d_t v = {{x, y, z, w}};
     return v;
 }
 
-vec4d_t vec4d_splat(double x) {
+LINALG_INLINE vec4d_t vec4d_splat(double x) {
     vec4d_t v = {{x, x, x, x}};
     return v;
 }
 
-LINALG_DEF mat4d_t mat4d_zero(void) {
+LINALG_INLINE mat4d_t mat4d_zero(void) {
     mat4d_t M = {0};
     return M;
 }
 
-LINALG_DEF mat4d_t mat4d_I(void) {
+LINALG_INLINE mat4d_t mat4d_I(void) {
     mat4d_t M = {0};
     M._11 = 1;
     M._22 = 1;
@@ -694,7 +1261,7 @@ LINALG_DEF mat4d_t mat4d_I(void) {
     return M;
 }
 
-LINALG_DEF mat4d_t mat4d_splat(double x) {
+LINALG_INLINE mat4d_t mat4d_splat(double x) {
     mat4d_t M = {0};
     M._11 = x;
     M._22 = x;
@@ -703,7 +1270,7 @@ LINALG_DEF mat4d_t mat4d_splat(double x) {
     return M;
 }
 
-LINALG_DEF mat4d_t mat4d_diag(vec4d_t diag) {
+LINALG_INLINE mat4d_t mat4d_diag(vec4d_t diag) {
     mat4d_t M = {0};
     M._11 = diag.e[0];
     M._22 = diag.e[1];
@@ -712,45 +1279,52 @@ LINALG_DEF mat4d_t mat4d_diag(vec4d_t diag) {
     return M;
 }
 
-LINALG_DEF mat4d_t mat4d_R(rotate_axis_s axis, double angle) {
+LINALG_INLINE mat4d_t mat4d_R(rotate_axis_s axis, double angle) {
+    const double c = cos(angle);
+    const double s = sin(angle);
     mat4d_t R = {0};
     size_t i = (axis + 1) % 3;
     size_t j = (axis + 2) % 3;
-    R.M[i][i] = cos(angle);
-    R.M[i][j] = -sin(angle);
-    R.M[j][i] = sin(angle);
-    R.M[j][j] = cos(angle);
+    R.M[i][i] = c;
+    R.M[i][j] = -s;
+    R.M[j][i] = s;
+    R.M[j][j] = c;
+    R.M[axis][axis] = 1;
+    R.M[3][3] = 1;
     return R;
 }
 
-LINALG_DEF mat4d_t mat4d_T(rotate_axis_s axis, double angle) {
+LINALG_INLINE mat4d_t mat4d_T(rotate_axis_s axis, double angle) {
+    const double c = cos(angle);
+    const double s = sin(angle);
     mat4d_t T = {0};
     size_t i = (axis + 1) % 3;
     size_t j = (axis + 2) % 3;
-    T.M[i][i] = cos(angle);
-    T.M[i][j] = -sin(angle);
-    T.M[j][i] = sin(angle);
-    T.M[j][j] = cos(angle);
+    T.M[i][i] = c;
+    T.M[i][j] = -s;
+    T.M[j][i] = s;
+    T.M[j][j] = c;
+    T.M[axis][axis] = 1;
     T.M[3][3] = 1;
     return T;
 }
 
-LINALG_DEF vec4i_t vec4i(int x, int y, int z, int w) {
+LINALG_INLINE vec4i_t vec4i(int x, int y, int z, int w) {
     vec4i_t v = {{x, y, z, w}};
     return v;
 }
 
-vec4i_t vec4i_splat(int x) {
+LINALG_INLINE vec4i_t vec4i_splat(int x) {
     vec4i_t v = {{x, x, x, x}};
     return v;
 }
 
-LINALG_DEF mat4i_t mat4i_zero(void) {
+LINALG_INLINE mat4i_t mat4i_zero(void) {
     mat4i_t M = {0};
     return M;
 }
 
-LINALG_DEF mat4i_t mat4i_I(void) {
+LINALG_INLINE mat4i_t mat4i_I(void) {
     mat4i_t M = {0};
     M._11 = 1;
     M._22 = 1;
@@ -759,7 +1333,7 @@ LINALG_DEF mat4i_t mat4i_I(void) {
     return M;
 }
 
-LINALG_DEF mat4i_t mat4i_splat(int x) {
+LINALG_INLINE mat4i_t mat4i_splat(int x) {
     mat4i_t M = {0};
     M._11 = x;
     M._22 = x;
@@ -768,7 +1342,7 @@ LINALG_DEF mat4i_t mat4i_splat(int x) {
     return M;
 }
 
-LINALG_DEF mat4i_t mat4i_diag(vec4i_t diag) {
+LINALG_INLINE mat4i_t mat4i_diag(vec4i_t diag) {
     mat4i_t M = {0};
     M._11 = diag.e[0];
     M._22 = diag.e[1];
@@ -777,23 +1351,23 @@ LINALG_DEF mat4i_t mat4i_diag(vec4i_t diag) {
     return M;
 }
 
-LINALG_DEF vec4u_t vec4u(unsigned int x, unsigned int y, unsigned int z,
-                         unsigned int w) {
+LINALG_INLINE vec4u_t vec4u(unsigned int x, unsigned int y, unsigned int z,
+                            unsigned int w) {
     vec4u_t v = {{x, y, z, w}};
     return v;
 }
 
-vec4u_t vec4u_splat(unsigned int x) {
+LINALG_INLINE vec4u_t vec4u_splat(unsigned int x) {
     vec4u_t v = {{x, x, x, x}};
     return v;
 }
 
-LINALG_DEF mat4u_t mat4u_zero(void) {
+LINALG_INLINE mat4u_t mat4u_zero(void) {
     mat4u_t M = {0};
     return M;
 }
 
-LINALG_DEF mat4u_t mat4u_I(void) {
+LINALG_INLINE mat4u_t mat4u_I(void) {
     mat4u_t M = {0};
     M._11 = 1;
     M._22 = 1;
@@ -802,7 +1376,7 @@ LINALG_DEF mat4u_t mat4u_I(void) {
     return M;
 }
 
-LINALG_DEF mat4u_t mat4u_splat(unsigned int x) {
+LINALG_INLINE mat4u_t mat4u_splat(unsigned int x) {
     mat4u_t M = {0};
     M._11 = x;
     M._22 = x;
@@ -811,7 +1385,7 @@ LINALG_DEF mat4u_t mat4u_splat(unsigned int x) {
     return M;
 }
 
-LINALG_DEF mat4u_t mat4u_diag(vec4u_t diag) {
+LINALG_INLINE mat4u_t mat4u_diag(vec4u_t diag) {
     mat4u_t M = {0};
     M._11 = diag.e[0];
     M._22 = diag.e[1];
@@ -820,111 +1394,188 @@ LINALG_DEF mat4u_t mat4u_diag(vec4u_t diag) {
     return M;
 }
 
-LINALG_DEF vec2f_t vec2f_add(vec2f_t a, vec2f_t b) {
+LINALG_INLINE vec2f_t vec2f_add(vec2f_t a, vec2f_t b) {
     a.x += b.x;
     a.y += b.y;
     return a;
 }
 
-LINALG_DEF vec2f_t vec2f_sub(vec2f_t a, vec2f_t b) {
+LINALG_INLINE void vec2f_add_to(vec2f_t *restrict out, const vec2f_t *a,
+                                const vec2f_t *b) {
+    out->x = a->x + b->x;
+    out->y = a->y + b->y;
+}
+
+LINALG_INLINE void vec2f_add_assign(vec2f_t *a, vec2f_t b) {
+    a->x += b.x;
+    a->y += b.y;
+}
+
+LINALG_INLINE vec2f_t vec2f_sub(vec2f_t a, vec2f_t b) {
     a.x -= b.x;
     a.y -= b.y;
     return a;
 }
 
-LINALG_DEF vec2f_t vec2f_mul(vec2f_t a, vec2f_t b) {
+LINALG_INLINE void vec2f_sub_to(vec2f_t *restrict out, const vec2f_t *a,
+                                const vec2f_t *b) {
+    out->x = a->x - b->x;
+    out->y = a->y - b->y;
+}
+
+LINALG_INLINE void vec2f_sub_assign(vec2f_t *a, vec2f_t b) {
+    a->x -= b.x;
+    a->y -= b.y;
+}
+
+LINALG_INLINE vec2f_t vec2f_mul(vec2f_t a, vec2f_t b) {
     a.x *= b.x;
     a.y *= b.y;
     return a;
 }
 
-LINALG_DEF vec2f_t vec2f_div(vec2f_t a, vec2f_t b) {
+LINALG_INLINE void vec2f_mul_to(vec2f_t *restrict out, const vec2f_t *a,
+                                const vec2f_t *b) {
+    out->x = a->x * b->x;
+    out->y = a->y * b->y;
+}
+
+LINALG_INLINE void vec2f_mul_assign(vec2f_t *a, vec2f_t b) {
+    a->x *= b.x;
+    a->y *= b.y;
+}
+
+LINALG_INLINE vec2f_t vec2f_div(vec2f_t a, vec2f_t b) {
     a.x /= b.x;
     a.y /= b.y;
     return a;
 }
 
-LINALG_DEF vec2f_t vec2f_mod(vec2f_t a, vec2f_t b) {
+LINALG_INLINE void vec2f_div_to(vec2f_t *restrict out, const vec2f_t *a,
+                                const vec2f_t *b) {
+    out->x = a->x / b->x;
+    out->y = a->y / b->y;
+}
+
+LINALG_INLINE void vec2f_div_assign(vec2f_t *a, vec2f_t b) {
+    a->x /= b.x;
+    a->y /= b.y;
+}
+
+LINALG_INLINE vec2f_t vec2f_mod(vec2f_t a, vec2f_t b) {
     a.x = fmodf(a.x, b.x);
     a.y = fmodf(a.y, b.y);
     return a;
 }
 
-LINALG_DEF vec2f_t vec2f_min(vec2f_t a, vec2f_t b) {
+LINALG_INLINE void vec2f_mod_to(vec2f_t *restrict out, const vec2f_t *a,
+                                const vec2f_t *b) {
+    out->x = fmodf(a->x, b->x);
+    out->y = fmodf(a->y, b->y);
+}
+
+LINALG_INLINE void vec2f_mod_assign(vec2f_t *a, vec2f_t b) {
+    a->x = fmodf(a->x, b.x);
+    a->y = fmodf(a->y, b.y);
+}
+
+LINALG_INLINE vec2f_t vec2f_min(vec2f_t a, vec2f_t b) {
     a.x = minf(a.x, b.x);
     a.y = minf(a.y, b.y);
     return a;
 }
 
-LINALG_DEF vec2f_t vec2f_max(vec2f_t a, vec2f_t b) {
+LINALG_INLINE void vec2f_min_to(vec2f_t *restrict out, const vec2f_t *a,
+                                const vec2f_t *b) {
+    out->x = minf(a->x, b->x);
+    out->y = minf(a->y, b->y);
+}
+
+LINALG_INLINE vec2f_t vec2f_max(vec2f_t a, vec2f_t b) {
     a.x = maxf(a.x, b.x);
     a.y = maxf(a.y, b.y);
     return a;
 }
 
-LINALG_DEF vec2f_t vec2f_floor(vec2f_t v) {
+LINALG_INLINE void vec2f_max_to(vec2f_t *restrict out, const vec2f_t *a,
+                                const vec2f_t *b) {
+    out->x = maxf(a->x, b->x);
+    out->y = maxf(a->y, b->y);
+}
+
+LINALG_INLINE vec2f_t vec2f_floor(vec2f_t v) {
     v.x = floorf(v.x);
     v.y = floorf(v.y);
     return v;
 }
 
-LINALG_DEF vec2f_t vec2f_ceil(vec2f_t v) {
+LINALG_INLINE void vec2f_floor_to(vec2f_t *restrict out, const vec2f_t *v) {
+    out->x = floorf(v->x);
+    out->y = floorf(v->y);
+}
+
+LINALG_INLINE vec2f_t vec2f_ceil(vec2f_t v) {
     v.x = ceilf(v.x);
     v.y = ceilf(v.y);
     return v;
 }
 
-LINALG_DEF vec2f_t vec2f_clamp(vec2f_t v, vec2f_t min, vec2f_t max) {
+LINALG_INLINE void vec2f_ceil_to(vec2f_t *restrict out, const vec2f_t *v) {
+    out->x = ceilf(v->x);
+    out->y = ceilf(v->y);
+}
+
+LINALG_INLINE vec2f_t vec2f_clamp(vec2f_t v, vec2f_t min, vec2f_t max) {
     v.x = clampf(v.x, min.x, max.x);
     v.y = clampf(v.y, min.y, max.y);
     return v;
 }
 
-LINALG_DEF vec2f_t vec2f_abs(vec2f_t v) {
+LINALG_INLINE void vec2f_clamp_to(vec2f_t *restrict out, const vec2f_t *v,
+                                  const vec2f_t *min, const vec2f_t *max) {
+    out->x = clampf(v->x, min->x, max->x);
+    out->y = clampf(v->y, min->y, max->y);
+}
+
+LINALG_INLINE vec2f_t vec2f_abs(vec2f_t v) {
     v.x = fabsf(v.x);
     v.y = fabsf(v.y);
     return v;
 }
 
-LINALG_DEF vec2f_t vec2f_lerp(vec2f_t a, vec2f_t b, vec2f_t t) {
+LINALG_INLINE void vec2f_abs_to(vec2f_t *restrict out, const vec2f_t *v) {
+    out->x = fabsf(v->x);
+    out->y = fabsf(v->y);
+}
+
+LINALG_INLINE vec2f_t vec2f_lerp(vec2f_t a, vec2f_t b, vec2f_t t) {
     a.x = lerpf(a.x, b.x, t.x);
     a.y = lerpf(a.y, b.y, t.y);
     return a;
 }
 
-LINALG_DEF vec2f_t vec2f_sum(size_t n, ...) {
-    va_list args;
-    va_start(args, n);
-    vec2f_t sum = {0};
-    for (size_t i = 0; i < n; ++i) {
-        vec2f_t v = va_arg(args, vec2f_t);
-        sum = vec2f_add(sum, v);
-    }
-    return sum;
+LINALG_INLINE void vec2f_lerp_to(vec2f_t *restrict out, const vec2f_t *a,
+                                 const vec2f_t *b, const vec2f_t *t) {
+    out->x = lerpf(a->x, b->x, t->x);
+    out->y = lerpf(a->y, b->y, t->y);
 }
 
-LINALG_DEF vec2f_t vec2f_product(size_t n, ...) {
-    va_list args;
-    va_start(args, n);
-    vec2f_t product = vec2f_splat(1);
-    for (size_t i = 0; i < n; ++i) {
-        vec2f_t v = va_arg(args, vec2f_t);
-        product = vec2f_mul(product, v);
-    }
-    return product;
-}
+LINALG_DEF vec2f_t vec2f_sum(size_t n, ...);
+LINALG_DEF vec2f_t vec2f_sum_array(const vec2f_t *xs, size_t n);
+LINALG_DEF vec2f_t vec2f_product(size_t n, ...);
+LINALG_DEF vec2f_t vec2f_product_array(const vec2f_t *xs, size_t n);
 
-LINALG_DEF float vec2f_dot(vec2f_t a, vec2f_t b) {
+LINALG_INLINE float vec2f_dot(vec2f_t a, vec2f_t b) {
     return a.x * b.x + a.y * b.y;
 }
 
-LINALG_DEF float vec2f_cross(vec2f_t a, vec2f_t b) {
+LINALG_INLINE float vec2f_cross(vec2f_t a, vec2f_t b) {
     return a.x * b.y - a.y * b.x;
 }
 
-LINALG_DEF float vec2f_sqrlen(vec2f_t v) { return vec2f_dot(v, v); }
+LINALG_INLINE float vec2f_sqrlen(vec2f_t v) { return vec2f_dot(v, v); }
 
-LINALG_DEF float vec2f_1norm(vec2f_t v) {
+LINALG_INLINE float vec2f_1norm(vec2f_t v) {
     v = vec2f_abs(v);
     float norm = 0;
     norm += v.x;
@@ -932,15 +1583,19 @@ LINALG_DEF float vec2f_1norm(vec2f_t v) {
     return norm;
 }
 
-LINALG_DEF float vec2f_2norm(vec2f_t v) { return sqrtf(vec2f_sqrlen(v)); }
+LINALG_INLINE float vec2f_2norm(vec2f_t v) { return sqrtf(vec2f_sqrlen(v)); }
 
-LINALG_DEF vec2f_t vec2f_unit(vec2f_t v) {
+LINALG_INLINE vec2f_t vec2f_unit(vec2f_t v) {
     return vec2f_div(v, vec2f_splat(vec2f_2norm(v)));
 }
 
-LINALG_DEF vec2f_t vec2f_norm(vec2f_t v) { return vec2f_unit(v); }
+LINALG_INLINE vec2f_t vec2f_norm(vec2f_t v) { return vec2f_unit(v); }
+
+LINALG_INLINE vec2f_t vec2f_unit_fast(vec2f_t v) {
+    return vec2f_mul(v, vec2f_splat(rsqrtf_fast(vec2f_sqrlen(v))));
+}
 
-LINALG_DEF _Bool vec2f_eq(vec2f_t a, vec2f_t b, float epsilon) {
+LINALG_INLINE _Bool vec2f_eq(vec2f_t a, vec2f_t b, float epsilon) {
     if (fabsf(b.x - a.x) > epsilon) {
         return 0;
     }
@@ -950,7 +1605,7 @@ LINALG_DEF _Bool vec2f_eq(vec2f_t a, vec2f_t b, float epsilon) {
     return 1;
 }
 
-LINALG_DEF vec2f_t vec2f_reflect(vec2f_t v, vec2f_t n) {
+LINALG_INLINE vec2f_t vec2f_reflect(vec2f_t v, vec2f_t n) {
     vec2f_t result = n;
     result = vec2f_mul(result, vec2f_splat(vec2f_dot(v, n)));
     result = vec2f_mul(result, vec2f_splat(2));
@@ -958,18 +1613,26 @@ LINALG_DEF vec2f_t vec2f_reflect(vec2f_t v, vec2f_t n) {
     return result;
 }
 
-LINALG_DEF vec2f_t vec2f_direction(vec2f_t a, vec2f_t b) {
+LINALG_INLINE vec2f_t vec2f_direction(vec2f_t a, vec2f_t b) {
     vec2f_t delta = vec2f_sub(b, a);
     return vec2f_unit(delta);
 }
 
-LINALG_DEF float vec2f_angle_between(vec2f_t a, vec2f_t b) {
+LINALG_INLINE float vec2f_angle_between(vec2f_t a, vec2f_t b) {
     vec2f_t a_unit = vec2f_unit(a);
     vec2f_t b_unit = vec2f_unit(b);
     return acosf(vec2f_dot(a_unit, b_unit));
 }
 
-LINALG_DEF mat2f_t mat2f_mul(mat2f_t A, mat2f_t B) {
+LINALG_INLINE float vec2f_angle_between_fast(vec2f_t a, vec2f_t b) {
+    float cos_angle = vec2f_dot(a,
+                                b) *
+                                    rsqrtf_fast(vec2f_sqrlen(a) *
+                                                vec2f_sqrlen(b));
+    return acosf_fast(clampf(cos_angle, -1, 1));
+}
+
+LINALG_INLINE mat2f_t mat2f_mul(mat2f_t A, mat2f_t B) {
     mat2f_t result;
     result._11 = A._11 * B._11 + A._12 * B._21;
     result._12 = A._11 * B._12 + A._12 * B._22;
@@ -978,143 +1641,318 @@ LINALG_DEF mat2f_t mat2f_mul(mat2f_t A, mat2f_t B) {
     return result;
 }
 
-LINALG_DEF mat2f_t mat2f_nmul(size_t n, ...) {
-    va_list args;
-    va_start(args, n);
-    mat2f_t product = mat2f_I();
-    for (size_t i = 0; i < n; ++i) {
-        mat2f_t A = va_arg(args, mat2f_t);
-        product = mat2f_mul(product, A);
-    }
-    return product;
+LINALG_INLINE void mat2f_mul_to(mat2f_t *restrict out, const mat2f_t *A,
+                                const mat2f_t *B) {
+    out->_11 = A->_11 * B->_11 + A->_12 * B->_21;
+    out->_12 = A->_11 * B->_12 + A->_12 * B->_22;
+    out->_21 = A->_21 * B->_11 + A->_22 * B->_21;
+    out->_22 = A->_21 * B->_12 + A->_22 * B->_22;
 }
 
-LINALG_DEF vec2f_t mat2f_mul_vec(mat2f_t M, vec2f_t v) {
+LINALG_DEF mat2f_t mat2f_nmul(size_t n, ...);
+LINALG_DEF mat2f_t mat2f_mul_chain(const mat2f_t *Ms, size_t n);
+
+LINALG_INLINE vec2f_t mat2f_mul_vec(mat2f_t M, vec2f_t v) {
     vec2f_t result;
     result.x = vec2f_dot(M.v[0], v);
     result.y = vec2f_dot(M.v[1], v);
     return result;
 }
 
-LINALG_DEF mat2f_t mat2f_hadamard(mat2f_t A, mat2f_t B) {
+LINALG_INLINE void mat2f_mul_vec_to(vec2f_t *restrict out, const mat2f_t *M,
+                                    const vec2f_t *v) {
+    out->x = M->_11 * v->x + M->_12 * v->y;
+    out->y = M->_21 * v->x + M->_22 * v->y;
+}
+
+LINALG_INLINE mat2f_t mat2f_hadamard(mat2f_t A, mat2f_t B) {
     A.e[0] *= B.e[0];
     A.e[1] *= B.e[1];
+    A.e[2] *= B.e[2];
+    A.e[3] *= B.e[3];
+    return A;
+}
+
+LINALG_INLINE void mat2f_hadamard_to(mat2f_t *restrict out, const mat2f_t *A,
+                                     const mat2f_t *B) {
+    out->e[0] = A->e[0] * B->e[0];
+    out->e[1] = A->e[1] * B->e[1];
+    out->e[2] = A->e[2] * B->e[2];
+    out->e[3] = A->e[3] * B->e[3];
+}
+
+LINALG_INLINE mat2f_t mat2f_rotate(mat2f_t A, float angle) {
+    const float c = cosf(angle);
+    const float s = sinf(angle);
+    A._11 *= c;
+    A._12 *= -s;
+    A._21 *= s;
+    A._22 *= c;
     return A;
 }
 
-LINALG_DEF mat2f_t mat2f_rotate(mat2f_t A, float angle) {
-    A._11 *= cosf(angle);
-    A._12 *= -sinf(angle);
-    A._21 *= sinf(angle);
-    A._22 *= cosf(angle);
+LINALG_INLINE mat2f_t mat2f_rotate_fast(mat2f_t A, float angle) {
+    float c, s;
+    sincosf_fast(angle, &s, &c);
+    A._11 *= c;
+    A._12 *= -s;
+    A._21 *= s;
+    A._22 *= c;
     return A;
 }
 
-LINALG_DEF vec2d_t vec2d_add(vec2d_t a, vec2d_t b) {
+LINALG_INLINE void mat2f_rotate_to(mat2f_t *restrict out, const mat2f_t *A,
+                                   float angle) {
+    const float c = cosf(angle);
+    const float s = sinf(angle);
+    *out = *A;
+    out->_11 *= c;
+    out->_12 *= -s;
+    out->_21 *= s;
+    out->_22 *= c;
+}
+
+LINALG_INLINE void mat2f_rotate_fast_to(mat2f_t *restrict out, const mat2f_t *A,
+                                        float angle) {
+    float c, s;
+    sincosf_fast(angle, &s, &c);
+    *out = *A;
+    out->_11 *= c;
+    out->_12 *= -s;
+    out->_21 *= s;
+    out->_22 *= c;
+}
+
+LINALG_INLINE void mat2f_rotate_assign(mat2f_t *A, float angle) {
+    const float c = cosf(angle);
+    const float s = sinf(angle);
+    A->_11 *= c;
+    A->_12 *= -s;
+    A->_21 *= s;
+    A->_22 *= c;
+}
+
+LINALG_INLINE void mat2f_rotate_fast_assign(mat2f_t *A, float angle) {
+    float c, s;
+    sincosf_fast(angle, &s, &c);
+    A->_11 *= c;
+    A->_12 *= -s;
+    A->_21 *= s;
+    A->_22 *= c;
+}
+
+LINALG_DEF void mat2f_transform_array(const mat2f_t *M,
+                                      const vec2f_t *restrict in,
+                                      vec2f_t *restrict out, size_t n);
+
+LINALG_INLINE mat2f_t mat2f_transpose(mat2f_t M) {
+    mat2f_t T;
+    T._11 = M._11;
+    T._12 = M._21;
+    T._21 = M._12;
+    T._22 = M._22;
+    return T;
+}
+
+LINALG_INLINE float mat2f_det(mat2f_t M) {
+    return M._11 * M._22 - M._12 * M._21;
+}
+
+LINALG_INLINE mat2f_t mat2f_inverse(mat2f_t M) {
+    mat2f_t result;
+    const float inv_det = 1 / mat2f_det(M);
+    result._11 = M._22 * inv_det;
+    result._12 = -M._12 * inv_det;
+    result._21 = -M._21 * inv_det;
+    result._22 = M._11 * inv_det;
+    return result;
+}
+
+LINALG_DEF void mat2f_inverse_array(const mat2f_t *restrict in,
+                                    mat2f_t *restrict out, size_t n);
+
+LINALG_INLINE vec2d_t vec2d_add(vec2d_t a, vec2d_t b) {
     a.x += b.x;
     a.y += b.y;
     return a;
 }
 
-LINALG_DEF vec2d_t vec2d_sub(vec2d_t a, vec2d_t b) {
+LINALG_INLINE void vec2d_add_to(vec2d_t *restrict out, const vec2d_t *a,
+                                const vec2d_t *b) {
+    out->x = a->x + b->x;
+    out->y = a->y + b->y;
+}
+
+LINALG_INLINE void vec2d_add_assign(vec2d_t *a, vec2d_t b) {
+    a->x += b.x;
+    a->y += b.y;
+}
+
+LINALG_INLINE vec2d_t vec2d_sub(vec2d_t a, vec2d_t b) {
     a.x -= b.x;
     a.y -= b.y;
     return a;
 }
 
-LINALG_DEF vec2d_t vec2d_mul(vec2d_t a, vec2d_t b) {
+LINALG_INLINE void vec2d_sub_to(vec2d_t *restrict out, const vec2d_t *a,
+                                const vec2d_t *b) {
+    out->x = a->x - b->x;
+    out->y = a->y - b->y;
+}
+
+LINALG_INLINE void vec2d_sub_assign(vec2d_t *a, vec2d_t b) {
+    a->x -= b.x;
+    a->y -= b.y;
+}
+
+LINALG_INLINE vec2d_t vec2d_mul(vec2d_t a, vec2d_t b) {
     a.x *= b.x;
     a.y *= b.y;
     return a;
 }
 
-LINALG_DEF vec2d_t vec2d_div(vec2d_t a, vec2d_t b) {
+LINALG_INLINE void vec2d_mul_to(vec2d_t *restrict out, const vec2d_t *a,
+                                const vec2d_t *b) {
+    out->x = a->x * b->x;
+    out->y = a->y * b->y;
+}
+
+LINALG_INLINE void vec2d_mul_assign(vec2d_t *a, vec2d_t b) {
+    a->x *= b.x;
+    a->y *= b.y;
+}
+
+LINALG_INLINE vec2d_t vec2d_div(vec2d_t a, vec2d_t b) {
     a.x /= b.x;
     a.y /= b.y;
     return a;
 }
 
-LINALG_DEF vec2d_t vec2d_mod(vec2d_t a, vec2d_t b) {
+LINALG_INLINE void vec2d_div_to(vec2d_t *restrict out, const vec2d_t *a,
+                                const vec2d_t *b) {
+    out->x = a->x / b->x;
+    out->y = a->y / b->y;
+}
+
+LINALG_INLINE void vec2d_div_assign(vec2d_t *a, vec2d_t b) {
+    a->x /= b.x;
+    a->y /= b.y;
+}
+
+LINALG_INLINE vec2d_t vec2d_mod(vec2d_t a, vec2d_t b) {
     a.x = fmod(a.x, b.x);
     a.y = fmod(a.y, b.y);
     return a;
 }
 
-LINALG_DEF vec2d_t vec2d_min(vec2d_t a, vec2d_t b) {
+LINALG_INLINE void vec2d_mod_to(vec2d_t *restrict out, const vec2d_t *a,
+                                const vec2d_t *b) {
+    out->x = fmod(a->x, b->x);
+    out->y = fmod(a->y, b->y);
+}
+
+LINALG_INLINE void vec2d_mod_assign(vec2d_t *a, vec2d_t b) {
+    a->x = fmod(a->x, b.x);
+    a->y = fmod(a->y, b.y);
+}
+
+LINALG_INLINE vec2d_t vec2d_min(vec2d_t a, vec2d_t b) {
     a.x = mind(a.x, b.x);
     a.y = mind(a.y, b.y);
     return a;
 }
 
-LINALG_DEF vec2d_t vec2d_max(vec2d_t a, vec2d_t b) {
+LINALG_INLINE void vec2d_min_to(vec2d_t *restrict out, const vec2d_t *a,
+                                const vec2d_t *b) {
+    out->x = mind(a->x, b->x);
+    out->y = mind(a->y, b->y);
+}
+
+LINALG_INLINE vec2d_t vec2d_max(vec2d_t a, vec2d_t b) {
     a.x = maxd(a.x, b.x);
     a.y = maxd(a.y, b.y);
     return a;
 }
 
-LINALG_DEF vec2d_t vec2d_floor(vec2d_t v) {
+LINALG_INLINE void vec2d_max_to(vec2d_t *restrict out, const vec2d_t *a,
+                                const vec2d_t *b) {
+    out->x = maxd(a->x, b->x);
+    out->y = maxd(a->y, b->y);
+}
+
+LINALG_INLINE vec2d_t vec2d_floor(vec2d_t v) {
     v.x = floor(v.x);
     v.y = floor(v.y);
     return v;
 }
 
-LINALG_DEF vec2d_t vec2d_ceil(vec2d_t v) {
+LINALG_INLINE void vec2d_floor_to(vec2d_t *restrict out, const vec2d_t *v) {
+    out->x = floor(v->x);
+    out->y = floor(v->y);
+}
+
+LINALG_INLINE vec2d_t vec2d_ceil(vec2d_t v) {
     v.x = ceil(v.x);
     v.y = ceil(v.y);
     return v;
 }
 
-LINALG_DEF vec2d_t vec2d_clamp(vec2d_t v, vec2d_t min, vec2d_t max) {
+LINALG_INLINE void vec2d_ceil_to(vec2d_t *restrict out, const vec2d_t *v) {
+    out->x = ceil(v->x);
+    out->y = ceil(v->y);
+}
+
+LINALG_INLINE vec2d_t vec2d_clamp(vec2d_t v, vec2d_t min, vec2d_t max) {
     v.x = clampd(v.x, min.x, max.x);
     v.y = clampd(v.y, min.y, max.y);
     return v;
 }
 
-LINALG_DEF vec2d_t vec2d_abs(vec2d_t v) {
+LINALG_INLINE void vec2d_clamp_to(vec2d_t *restrict out, const vec2d_t *v,
+                                  const vec2d_t *min, const vec2d_t *max) {
+    out->x = clampd(v->x, min->x, max->x);
+    out->y = clampd(v->y, min->y, max->y);
+}
+
+LINALG_INLINE vec2d_t vec2d_abs(vec2d_t v) {
     v.x = fabs(v.x);
     v.y = fabs(v.y);
     return v;
 }
 
-LINALG_DEF vec2d_t vec2d_lerp(vec2d_t a, vec2d_t b, vec2d_t t) {
+LINALG_INLINE void vec2d_abs_to(vec2d_t *restrict out, const vec2d_t *v) {
+    out->x = fabs(v->x);
+    out->y = fabs(v->y);
+}
+
+LINALG_INLINE vec2d_t vec2d_lerp(vec2d_t a, vec2d_t b, vec2d_t t) {
     a.x = lerpd(a.x, b.x, t.x);
     a.y = lerpd(a.y, b.y, t.y);
     return a;
 }
 
-LINALG_DEF vec2d_t vec2d_sum(size_t n, ...) {
-    va_list args;
-    va_start(args, n);
-    vec2d_t sum = {0};
-    for (size_t i = 0; i < n; ++i) {
-        vec2d_t v = va_arg(args, vec2d_t);
-        sum = vec2d_add(sum, v);
-    }
-    return sum;
+LINALG_INLINE void vec2d_lerp_to(vec2d_t *restrict out, const vec2d_t *a,
+                                 const vec2d_t *b, const vec2d_t *t) {
+    out->x = lerpd(a->x, b->x, t->x);
+    out->y = lerpd(a->y, b->y, t->y);
 }
 
-LINALG_DEF vec2d_t vec2d_product(size_t n, ...) {
-    va_list args;
-    va_start(args, n);
-    vec2d_t product = vec2d_splat(1);
-    for (size_t i = 0; i < n; ++i) {
-        vec2d_t v = va_arg(args, vec2d_t);
-        product = vec2d_mul(product, v);
-    }
-    return product;
-}
+LINALG_DEF vec2d_t vec2d_sum(size_t n, ...);
+LINALG_DEF vec2d_t vec2d_sum_array(const vec2d_t *xs, size_t n);
+LINALG_DEF vec2d_t vec2d_product(size_t n, ...);
+LINALG_DEF vec2d_t vec2d_product_array(const vec2d_t *xs, size_t n);
 
-LINALG_DEF double vec2d_dot(vec2d_t a, vec2d_t b) {
+LINALG_INLINE double vec2d_dot(vec2d_t a, vec2d_t b) {
     return a.x * b.x + a.y * b.y;
 }
 
-LINALG_DEF double vec2d_cross(vec2d_t a, vec2d_t b) {
+LINALG_INLINE double vec2d_cross(vec2d_t a, vec2d_t b) {
     return a.x * b.y - a.y * b.x;
 }
 
-LINALG_DEF double vec2d_sqrlen(vec2d_t v) { return vec2d_dot(v, v); }
+LINALG_INLINE double vec2d_sqrlen(vec2d_t v) { return vec2d_dot(v, v); }
 
-LINALG_DEF double vec2d_1norm(vec2d_t v) {
+LINALG_INLINE double vec2d_1norm(vec2d_t v) {
     v = vec2d_abs(v);
     double norm = 0;
     norm += v.x;
@@ -1122,15 +1960,15 @@ LINALG_DEF double vec2d_1norm(vec2d_t v) {
     return norm;
 }
 
-LINALG_DEF double vec2d_2norm(vec2d_t v) { return sqrt(vec2d_sqrlen(v)); }
+LINALG_INLINE double vec2d_2norm(vec2d_t v) { return sqrt(vec2d_sqrlen(v)); }
 
-LINALG_DEF vec2d_t vec2d_unit(vec2d_t v) {
+LINALG_INLINE vec2d_t vec2d_unit(vec2d_t v) {
     return vec2d_div(v, vec2d_splat(vec2d_2norm(v)));
 }
 
-LINALG_DEF vec2d_t vec2d_norm(vec2d_t v) { return vec2d_unit(v); }
+LINALG_INLINE vec2d_t vec2d_norm(vec2d_t v) { return vec2d_unit(v); }
 
-LINALG_DEF _Bool vec2d_eq(vec2d_t a, vec2d_t b, double epsilon) {
+LINALG_INLINE _Bool vec2d_eq(vec2d_t a, vec2d_t b, double epsilon) {
     if (fabs(b.x - a.x) > epsilon) {
         return 0;
     }
@@ -1140,7 +1978,7 @@ LINALG_DEF _Bool vec2d_eq(vec2d_t a, vec2d_t b, double epsilon) {
     return 1;
 }
 
-LINALG_DEF vec2d_t vec2d_reflect(vec2d_t v, vec2d_t n) {
+LINALG_INLINE vec2d_t vec2d_reflect(vec2d_t v, vec2d_t n) {
     vec2d_t result = n;
     result = vec2d_mul(result, vec2d_splat(vec2d_dot(v, n)));
     result = vec2d_mul(result, vec2d_splat(2));
@@ -1148,18 +1986,18 @@ LINALG_DEF vec2d_t vec2d_reflect(vec2d_t v, vec2d_t n) {
     return result;
 }
 
-LINALG_DEF vec2d_t vec2d_direction(vec2d_t a, vec2d_t b) {
+LINALG_INLINE vec2d_t vec2d_direction(vec2d_t a, vec2d_t b) {
     vec2d_t delta = vec2d_sub(b, a);
     return vec2d_unit(delta);
 }
 
-LINALG_DEF double vec2d_angle_between(vec2d_t a, vec2d_t b) {
+LINALG_INLINE double vec2d_angle_between(vec2d_t a, vec2d_t b) {
     vec2d_t a_unit = vec2d_unit(a);
     vec2d_t b_unit = vec2d_unit(b);
     return acos(vec2d_dot(a_unit, b_unit));
 }
 
-LINALG_DEF mat2d_t mat2d_mul(mat2d_t A, mat2d_t B) {
+LINALG_INLINE mat2d_t mat2d_mul(mat2d_t A, mat2d_t B) {
     mat2d_t result;
     result._11 = A._11 * B._11 + A._12 * B._21;
     result._12 = A._11 * B._12 + A._12 * B._22;
@@ -1168,123 +2006,254 @@ LINALG_DEF mat2d_t mat2d_mul(mat2d_t A, mat2d_t B) {
     return result;
 }
 
-LINALG_DEF mat2d_t mat2d_nmul(size_t n, ...) {
-    va_list args;
-    va_start(args, n);
-    mat2d_t product = mat2d_I();
-    for (size_t i = 0; i < n; ++i) {
-        mat2d_t A = va_arg(args, mat2d_t);
-        product = mat2d_mul(product, A);
-    }
-    return product;
+LINALG_INLINE void mat2d_mul_to(mat2d_t *restrict out, const mat2d_t *A,
+                                const mat2d_t *B) {
+    out->_11 = A->_11 * B->_11 + A->_12 * B->_21;
+    out->_12 = A->_11 * B->_12 + A->_12 * B->_22;
+    out->_21 = A->_21 * B->_11 + A->_22 * B->_21;
+    out->_22 = A->_21 * B->_12 + A->_22 * B->_22;
 }
 
-LINALG_DEF vec2d_t mat2d_mul_vec(mat2d_t M, vec2d_t v) {
+LINALG_DEF mat2d_t mat2d_nmul(size_t n, ...);
+LINALG_DEF mat2d_t mat2d_mul_chain(const mat2d_t *Ms, size_t n);
+
+LINALG_INLINE vec2d_t mat2d_mul_vec(mat2d_t M, vec2d_t v) {
     vec2d_t result;
     result.x = vec2d_dot(M.v[0], v);
     result.y = vec2d_dot(M.v[1], v);
     return result;
 }
 
-LINALG_DEF mat2d_t mat2d_hadamard(mat2d_t A, mat2d_t B) {
+LINALG_INLINE void mat2d_mul_vec_to(vec2d_t *restrict out, const mat2d_t *M,
+                                    const vec2d_t *v) {
+    out->x = M->_11 * v->x + M->_12 * v->y;
+    out->y = M->_21 * v->x + M->_22 * v->y;
+}
+
+LINALG_INLINE mat2d_t mat2d_hadamard(mat2d_t A, mat2d_t B) {
     A.e[0] *= B.e[0];
     A.e[1] *= B.e[1];
+    A.e[2] *= B.e[2];
+    A.e[3] *= B.e[3];
     return A;
 }
 
-LINALG_DEF mat2d_t mat2d_rotate(mat2d_t A, double angle) {
-    A._11 *= cos(angle);
-    A._12 *= -sin(angle);
-    A._21 *= sin(angle);
-    A._22 *= cos(angle);
+LINALG_INLINE void mat2d_hadamard_to(mat2d_t *restrict out, const mat2d_t *A,
+                                     const mat2d_t *B) {
+    out->e[0] = A->e[0] * B->e[0];
+    out->e[1] = A->e[1] * B->e[1];
+    out->e[2] = A->e[2] * B->e[2];
+    out->e[3] = A->e[3] * B->e[3];
+}
+
+LINALG_INLINE mat2d_t mat2d_rotate(mat2d_t A, double angle) {
+    const double c = cos(angle);
+    const double s = sin(angle);
+    A._11 *= c;
+    A._12 *= -s;
+    A._21 *= s;
+    A._22 *= c;
     return A;
 }
 
-LINALG_DEF vec2i_t vec2i_add(vec2i_t a, vec2i_t b) {
+LINALG_INLINE void mat2d_rotate_to(mat2d_t *restrict out, const mat2d_t *A,
+                                   double angle) {
+    const double c = cos(angle);
+    const double s = sin(angle);
+    *out = *A;
+    out->_11 *= c;
+    out->_12 *= -s;
+    out->_21 *= s;
+    out->_22 *= c;
+}
+
+LINALG_INLINE void mat2d_rotate_assign(mat2d_t *A, double angle) {
+    const double c = cos(angle);
+    const double s = sin(angle);
+    A->_11 *= c;
+    A->_12 *= -s;
+    A->_21 *= s;
+    A->_22 *= c;
+}
+
+LINALG_DEF void mat2d_transform_array(const mat2d_t *M,
+                                      const vec2d_t *restrict in,
+                                      vec2d_t *restrict out, size_t n);
+
+LINALG_INLINE mat2d_t mat2d_transpose(mat2d_t M) {
+    mat2d_t T;
+    T._11 = M._11;
+    T._12 = M._21;
+    T._21 = M._12;
+    T._22 = M._22;
+    return T;
+}
+
+LINALG_INLINE double mat2d_det(mat2d_t M) {
+    return M._11 * M._22 - M._12 * M._21;
+}
+
+LINALG_INLINE mat2d_t mat2d_inverse(mat2d_t M) {
+    mat2d_t result;
+    const double inv_det = 1 / mat2d_det(M);
+    result._11 = M._22 * inv_det;
+    result._12 = -M._12 * inv_det;
+    result._21 = -M._21 * inv_det;
+    result._22 = M._11 * inv_det;
+    return result;
+}
+
+LINALG_DEF void mat2d_inverse_array(const mat2d_t *restrict in,
+                                    mat2d_t *restrict out, size_t n);
+
+LINALG_INLINE vec2i_t vec2i_add(vec2i_t a, vec2i_t b) {
     a.x += b.x;
     a.y += b.y;
     return a;
 }
 
-LINALG_DEF vec2i_t vec2i_sub(vec2i_t a, vec2i_t b) {
+LINALG_INLINE void vec2i_add_to(vec2i_t *restrict out, const vec2i_t *a,
+                                const vec2i_t *b) {
+    out->x = a->x + b->x;
+    out->y = a->y + b->y;
+}
+
+LINALG_INLINE void vec2i_add_assign(vec2i_t *a, vec2i_t b) {
+    a->x += b.x;
+    a->y += b.y;
+}
+
+LINALG_INLINE vec2i_t vec2i_sub(vec2i_t a, vec2i_t b) {
     a.x -= b.x;
     a.y -= b.y;
     return a;
 }
 
-LINALG_DEF vec2i_t vec2i_mul(vec2i_t a, vec2i_t b) {
+LINALG_INLINE void vec2i_sub_to(vec2i_t *restrict out, const vec2i_t *a,
+                                const vec2i_t *b) {
+    out->x = a->x - b->x;
+    out->y = a->y - b->y;
+}
+
+LINALG_INLINE void vec2i_sub_assign(vec2i_t *a, vec2i_t b) {
+    a->x -= b.x;
+    a->y -= b.y;
+}
+
+LINALG_INLINE vec2i_t vec2i_mul(vec2i_t a, vec2i_t b) {
     a.x *= b.x;
     a.y *= b.y;
     return a;
 }
 
-LINALG_DEF vec2i_t vec2i_div(vec2i_t a, vec2i_t b) {
+LINALG_INLINE void vec2i_mul_to(vec2i_t *restrict out, const vec2i_t *a,
+                                const vec2i_t *b) {
+    out->x = a->x * b->x;
+    out->y = a->y * b->y;
+}
+
+LINALG_INLINE void vec2i_mul_assign(vec2i_t *a, vec2i_t b) {
+    a->x *= b.x;
+    a->y *= b.y;
+}
+
+LINALG_INLINE vec2i_t vec2i_div(vec2i_t a, vec2i_t b) {
     a.x /= b.x;
     a.y /= b.y;
     return a;
 }
 
-LINALG_DEF vec2i_t vec2i_mod(vec2i_t a, vec2i_t b) {
+LINALG_INLINE void vec2i_div_to(vec2i_t *restrict out, const vec2i_t *a,
+                                const vec2i_t *b) {
+    out->x = a->x / b->x;
+    out->y = a->y / b->y;
+}
+
+LINALG_INLINE void vec2i_div_assign(vec2i_t *a, vec2i_t b) {
+    a->x /= b.x;
+    a->y /= b.y;
+}
+
+LINALG_INLINE vec2i_t vec2i_mod(vec2i_t a, vec2i_t b) {
     a.x %= b.x;
     a.y %= b.y;
     return a;
 }
 
-LINALG_DEF vec2i_t vec2i_min(vec2i_t a, vec2i_t b) {
+LINALG_INLINE void vec2i_mod_to(vec2i_t *restrict out, const vec2i_t *a,
+                                const vec2i_t *b) {
+    out->x = a->x % b->x;
+    out->y = a->y % b->y;
+}
+
+LINALG_INLINE void vec2i_mod_assign(vec2i_t *a, vec2i_t b) {
+    a->x %= b.x;
+    a->y %= b.y;
+}
+
+LINALG_INLINE vec2i_t vec2i_min(vec2i_t a, vec2i_t b) {
     a.x = mini(a.x, b.x);
     a.y = mini(a.y, b.y);
     return a;
 }
 
-LINALG_DEF vec2i_t vec2i_max(vec2i_t a, vec2i_t b) {
+LINALG_INLINE void vec2i_min_to(vec2i_t *restrict out, const vec2i_t *a,
+                                const vec2i_t *b) {
+    out->x = mini(a->x, b->x);
+    out->y = mini(a->y, b->y);
+}
+
+LINALG_INLINE vec2i_t vec2i_max(vec2i_t a, vec2i_t b) {
     a.x = maxi(a.x, b.x);
     a.y = maxi(a.y, b.y);
     return a;
 }
 
-LINALG_DEF vec2i_t vec2i_clamp(vec2i_t v, vec2i_t min, vec2i_t max) {
+LINALG_INLINE void vec2i_max_to(vec2i_t *restrict out, const vec2i_t *a,
+                                const vec2i_t *b) {
+    out->x = maxi(a->x, b->x);
+    out->y = maxi(a->y, b->y);
+}
+
+LINALG_INLINE vec2i_t vec2i_clamp(vec2i_t v, vec2i_t min, vec2i_t max) {
     v.x = clampi(v.x, min.x, max.x);
     v.y = clampi(v.y, min.y, max.y);
     return v;
 }
 
-LINALG_DEF vec2i_t vec2i_abs(vec2i_t v) {
+LINALG_INLINE void vec2i_clamp_to(vec2i_t *restrict out, const vec2i_t *v,
+                                  const vec2i_t *min, const vec2i_t *max) {
+    out->x = clampi(v->x, min->x, max->x);
+    out->y = clampi(v->y, min->y, max->y);
+}
+
+LINALG_INLINE vec2i_t vec2i_abs(vec2i_t v) {
     v.x = absi(v.x);
     v.y = absi(v.y);
     return v;
 }
 
-LINALG_DEF vec2i_t vec2i_sum(size_t n, ...) {
-    va_list args;
-    va_start(args, n);
-    vec2i_t sum = {0};
-    for (size_t i = 0; i < n; ++i) {
-        vec2i_t v = va_arg(args, vec2i_t);
-        sum = vec2i_add(sum, v);
-    }
-    return sum;
+LINALG_INLINE void vec2i_abs_to(vec2i_t *restrict out, const vec2i_t *v) {
+    out->x = absi(v->x);
+    out->y = absi(v->y);
 }
 
-LINALG_DEF vec2i_t vec2i_product(size_t n, ...) {
-    va_list args;
-    va_start(args, n);
-    vec2i_t product = vec2i_splat(1);
-    for (size_t i = 0; i < n; ++i) {
-        vec2i_t v = va_arg(args, vec2i_t);
-        product = vec2i_mul(product, v);
-    }
-    return product;
-}
+LINALG_DEF vec2i_t vec2i_sum(size_t n, ...);
+LINALG_DEF vec2i_t vec2i_sum_array(const vec2i_t *xs, size_t n);
+LINALG_DEF vec2i_t vec2i_product(size_t n, ...);
+LINALG_DEF vec2i_t vec2i_product_array(const vec2i_t *xs, size_t n);
 
-LINALG_DEF int vec2i_dot(vec2i_t a, vec2i_t b) { return a.x * b.x + a.y * b.y; }
+LINALG_INLINE int vec2i_dot(vec2i_t a, vec2i_t b) {
+    return a.x * b.x + a.y * b.y;
+}
 
-LINALG_DEF int vec2i_cross(vec2i_t a, vec2i_t b) {
+LINALG_INLINE int vec2i_cross(vec2i_t a, vec2i_t b) {
     return a.x * b.y - a.y * b.x;
 }
 
-LINALG_DEF int vec2i_sqrlen(vec2i_t v) { return vec2i_dot(v, v); }
+LINALG_INLINE int vec2i_sqrlen(vec2i_t v) { return vec2i_dot(v, v); }
 
-LINALG_DEF int vec2i_1norm(vec2i_t v) {
+LINALG_INLINE int vec2i_1norm(vec2i_t v) {
     v = vec2i_abs(v);
     int norm = 0;
     norm += v.x;
@@ -1292,7 +2261,7 @@ LINALG_DEF int vec2i_1norm(vec2i_t v) {
     return norm;
 }
 
-LINALG_DEF vec2i_t vec2i_reflect(vec2i_t v, vec2i_t n) {
+LINALG_INLINE vec2i_t vec2i_reflect(vec2i_t v, vec2i_t n) {
     vec2i_t result = n;
     result = vec2i_mul(result, vec2i_splat(vec2i_dot(v, n)));
     result = vec2i_mul(result, vec2i_splat(2));
@@ -1300,7 +2269,7 @@ LINALG_DEF vec2i_t vec2i_reflect(vec2i_t v, vec2i_t n) {
     return result;
 }
 
-LINALG_DEF mat2i_t mat2i_mul(mat2i_t A, mat2i_t B) {
+LINALG_INLINE mat2i_t mat2i_mul(mat2i_t A, mat2i_t B) {
     mat2i_t result;
     result._11 = A._11 * B._11 + A._12 * B._21;
     result._12 = A._11 * B._12 + A._12 * B._22;
@@ -1309,118 +2278,203 @@ LINALG_DEF mat2i_t mat2i_mul(mat2i_t A, mat2i_t B) {
     return result;
 }
 
-LINALG_DEF mat2i_t mat2i_nmul(size_t n, ...) {
-    va_list args;
-    va_start(args, n);
-    mat2i_t product = mat2i_I();
-    for (size_t i = 0; i < n; ++i) {
-        mat2i_t A = va_arg(args, mat2i_t);
-        product = mat2i_mul(product, A);
-    }
-    return product;
+LINALG_INLINE void mat2i_mul_to(mat2i_t *restrict out, const mat2i_t *A,
+                                const mat2i_t *B) {
+    out->_11 = A->_11 * B->_11 + A->_12 * B->_21;
+    out->_12 = A->_11 * B->_12 + A->_12 * B->_22;
+    out->_21 = A->_21 * B->_11 + A->_22 * B->_21;
+    out->_22 = A->_21 * B->_12 + A->_22 * B->_22;
 }
 
-LINALG_DEF vec2i_t mat2i_mul_vec(mat2i_t M, vec2i_t v) {
+LINALG_DEF mat2i_t mat2i_nmul(size_t n, ...);
+LINALG_DEF mat2i_t mat2i_mul_chain(const mat2i_t *Ms, size_t n);
+
+LINALG_INLINE vec2i_t mat2i_mul_vec(mat2i_t M, vec2i_t v) {
     vec2i_t result;
     result.x = vec2i_dot(M.v[0], v);
     result.y = vec2i_dot(M.v[1], v);
     return result;
 }
 
-LINALG_DEF mat2i_t mat2i_hadamard(mat2i_t A, mat2i_t B) {
+LINALG_INLINE void mat2i_mul_vec_to(vec2i_t *restrict out, const mat2i_t *M,
+                                    const vec2i_t *v) {
+    out->x = M->_11 * v->x + M->_12 * v->y;
+    out->y = M->_21 * v->x + M->_22 * v->y;
+}
+
+LINALG_INLINE mat2i_t mat2i_hadamard(mat2i_t A, mat2i_t B) {
     A.e[0] *= B.e[0];
     A.e[1] *= B.e[1];
+    A.e[2] *= B.e[2];
+    A.e[3] *= B.e[3];
     return A;
 }
 
-LINALG_DEF vec2u_t vec2u_add(vec2u_t a, vec2u_t b) {
+LINALG_INLINE void mat2i_hadamard_to(mat2i_t *restrict out, const mat2i_t *A,
+                                     const mat2i_t *B) {
+    out->e[0] = A->e[0] * B->e[0];
+    out->e[1] = A->e[1] * B->e[1];
+    out->e[2] = A->e[2] * B->e[2];
+    out->e[3] = A->e[3] * B->e[3];
+}
+
+LINALG_DEF void mat2i_transform_array(const mat2i_t *M,
+                                      const vec2i_t *restrict in,
+                                      vec2i_t *restrict out, size_t n);
+
+LINALG_INLINE mat2i_t mat2i_transpose(mat2i_t M) {
+    mat2i_t T;
+    T._11 = M._11;
+    T._12 = M._21;
+    T._21 = M._12;
+    T._22 = M._22;
+    return T;
+}
+
+LINALG_INLINE vec2u_t vec2u_add(vec2u_t a, vec2u_t b) {
     a.x += b.x;
     a.y += b.y;
     return a;
 }
 
-LINALG_DEF vec2u_t vec2u_sub(vec2u_t a, vec2u_t b) {
+LINALG_INLINE void vec2u_add_to(vec2u_t *restrict out, const vec2u_t *a,
+                                const vec2u_t *b) {
+    out->x = a->x + b->x;
+    out->y = a->y + b->y;
+}
+
+LINALG_INLINE void vec2u_add_assign(vec2u_t *a, vec2u_t b) {
+    a->x += b.x;
+    a->y += b.y;
+}
+
+LINALG_INLINE vec2u_t vec2u_sub(vec2u_t a, vec2u_t b) {
     a.x -= b.x;
     a.y -= b.y;
     return a;
 }
 
-LINALG_DEF vec2u_t vec2u_mul(vec2u_t a, vec2u_t b) {
+LINALG_INLINE void vec2u_sub_to(vec2u_t *restrict out, const vec2u_t *a,
+                                const vec2u_t *b) {
+    out->x = a->x - b->x;
+    out->y = a->y - b->y;
+}
+
+LINALG_INLINE void vec2u_sub_assign(vec2u_t *a, vec2u_t b) {
+    a->x -= b.x;
+    a->y -= b.y;
+}
+
+LINALG_INLINE vec2u_t vec2u_mul(vec2u_t a, vec2u_t b) {
     a.x *= b.x;
     a.y *= b.y;
     return a;
 }
 
-LINALG_DEF vec2u_t vec2u_div(vec2u_t a, vec2u_t b) {
+LINALG_INLINE void vec2u_mul_to(vec2u_t *restrict out, const vec2u_t *a,
+                                const vec2u_t *b) {
+    out->x = a->x * b->x;
+    out->y = a->y * b->y;
+}
+
+LINALG_INLINE void vec2u_mul_assign(vec2u_t *a, vec2u_t b) {
+    a->x *= b.x;
+    a->y *= b.y;
+}
+
+LINALG_INLINE vec2u_t vec2u_div(vec2u_t a, vec2u_t b) {
     a.x /= b.x;
     a.y /= b.y;
     return a;
 }
 
-LINALG_DEF vec2u_t vec2u_mod(vec2u_t a, vec2u_t b) {
+LINALG_INLINE void vec2u_div_to(vec2u_t *restrict out, const vec2u_t *a,
+                                const vec2u_t *b) {
+    out->x = a->x / b->x;
+    out->y = a->y / b->y;
+}
+
+LINALG_INLINE void vec2u_div_assign(vec2u_t *a, vec2u_t b) {
+    a->x /= b.x;
+    a->y /= b.y;
+}
+
+LINALG_INLINE vec2u_t vec2u_mod(vec2u_t a, vec2u_t b) {
     a.x %= b.x;
     a.y %= b.y;
     return a;
 }
 
-LINALG_DEF vec2u_t vec2u_min(vec2u_t a, vec2u_t b) {
+LINALG_INLINE void vec2u_mod_to(vec2u_t *restrict out, const vec2u_t *a,
+                                const vec2u_t *b) {
+    out->x = a->x % b->x;
+    out->y = a->y % b->y;
+}
+
+LINALG_INLINE void vec2u_mod_assign(vec2u_t *a, vec2u_t b) {
+    a->x %= b.x;
+    a->y %= b.y;
+}
+
+LINALG_INLINE vec2u_t vec2u_min(vec2u_t a, vec2u_t b) {
     a.x = minu(a.x, b.x);
     a.y = minu(a.y, b.y);
     return a;
 }
 
-LINALG_DEF vec2u_t vec2u_max(vec2u_t a, vec2u_t b) {
+LINALG_INLINE void vec2u_min_to(vec2u_t *restrict out, const vec2u_t *a,
+                                const vec2u_t *b) {
+    out->x = minu(a->x, b->x);
+    out->y = minu(a->y, b->y);
+}
+
+LINALG_INLINE vec2u_t vec2u_max(vec2u_t a, vec2u_t b) {
     a.x = maxu(a.x, b.x);
     a.y = maxu(a.y, b.y);
     return a;
 }
 
-LINALG_DEF vec2u_t vec2u_clamp(vec2u_t v, vec2u_t min, vec2u_t max) {
+LINALG_INLINE void vec2u_max_to(vec2u_t *restrict out, const vec2u_t *a,
+                                const vec2u_t *b) {
+    out->x = maxu(a->x, b->x);
+    out->y = maxu(a->y, b->y);
+}
+
+LINALG_INLINE vec2u_t vec2u_clamp(vec2u_t v, vec2u_t min, vec2u_t max) {
     v.x = clampu(v.x, min.x, max.x);
     v.y = clampu(v.y, min.y, max.y);
     return v;
 }
 
-LINALG_DEF vec2u_t vec2u_sum(size_t n, ...) {
-    va_list args;
-    va_start(args, n);
-    vec2u_t sum = {0};
-    for (size_t i = 0; i < n; ++i) {
-        vec2u_t v = va_arg(args, vec2u_t);
-        sum = vec2u_add(sum, v);
-    }
-    return sum;
+LINALG_INLINE void vec2u_clamp_to(vec2u_t *restrict out, const vec2u_t *v,
+                                  const vec2u_t *min, const vec2u_t *max) {
+    out->x = clampu(v->x, min->x, max->x);
+    out->y = clampu(v->y, min->y, max->y);
 }
 
-LINALG_DEF vec2u_t vec2u_product(size_t n, ...) {
-    va_list args;
-    va_start(args, n);
-    vec2u_t product = vec2u_splat(1);
-    for (size_t i = 0; i < n; ++i) {
-        vec2u_t v = va_arg(args, vec2u_t);
-        product = vec2u_mul(product, v);
-    }
-    return product;
-}
+LINALG_DEF vec2u_t vec2u_sum(size_t n, ...);
+LINALG_DEF vec2u_t vec2u_sum_array(const vec2u_t *xs, size_t n);
+LINALG_DEF vec2u_t vec2u_product(size_t n, ...);
+LINALG_DEF vec2u_t vec2u_product_array(const vec2u_t *xs, size_t n);
 
-LINALG_DEF unsigned int vec2u_dot(vec2u_t a, vec2u_t b) {
+LINALG_INLINE unsigned int vec2u_dot(vec2u_t a, vec2u_t b) {
     return a.x * b.x + a.y * b.y;
 }
 
-LINALG_DEF unsigned int vec2u_cross(vec2u_t a, vec2u_t b) {
+LINALG_INLINE unsigned int vec2u_cross(vec2u_t a, vec2u_t b) {
     return a.x * b.y - a.y * b.x;
 }
 
-LINALG_DEF unsigned int vec2u_sqrlen(vec2u_t v) { return vec2u_dot(v, v); }
+LINALG_INLINE unsigned int vec2u_sqrlen(vec2u_t v) { return vec2u_dot(v, v); }
 
-LINALG_DEF unsigned int vec2u_1norm(vec2u_t v) {
+LINALG_INLINE unsigned int vec2u_1norm(vec2u_t v) {
     unsigned int norm = 0;
     norm += v.x;
     norm += v.y;
     return norm;
 }
 
-LINALG_DEF vec2u_t vec2u_reflect(vec2u_t v, vec2u_t n) {
+LINALG_INLINE vec2u_t vec2u_reflect(vec2u_t v, vec2u_t n) {
     vec2u_t result = n;
     result = vec2u_mul(result, vec2u_splat(vec2u_dot(v, n)));
     result = vec2u_mul(result, vec2u_splat(2));
@@ -1428,7 +2482,7 @@ LINALG_DEF vec2u_t vec2u_reflect(vec2u_t v, vec2u_t n) {
     return result;
 }
 
-LINALG_DEF mat2u_t mat2u_mul(mat2u_t A, mat2u_t B) {
+LINALG_INLINE mat2u_t mat2u_mul(mat2u_t A, mat2u_t B) {
     mat2u_t result;
     result._11 = A._11 * B._11 + A._12 * B._21;
     result._12 = A._11 * B._12 + A._12 * B._22;
@@ -1437,151 +2491,274 @@ LINALG_DEF mat2u_t mat2u_mul(mat2u_t A, mat2u_t B) {
     return result;
 }
 
-LINALG_DEF mat2u_t mat2u_nmul(size_t n, ...) {
-    va_list args;
-    va_start(args, n);
-    mat2u_t product = mat2u_I();
-    for (size_t i = 0; i < n; ++i) {
-        mat2u_t A = va_arg(args, mat2u_t);
-        product = mat2u_mul(product, A);
-    }
-    return product;
+LINALG_INLINE void mat2u_mul_to(mat2u_t *restrict out, const mat2u_t *A,
+                                const mat2u_t *B) {
+    out->_11 = A->_11 * B->_11 + A->_12 * B->_21;
+    out->_12 = A->_11 * B->_12 + A->_12 * B->_22;
+    out->_21 = A->_21 * B->_11 + A->_22 * B->_21;
+    out->_22 = A->_21 * B->_12 + A->_22 * B->_22;
 }
 
-LINALG_DEF vec2u_t mat2u_mul_vec(mat2u_t M, vec2u_t v) {
+LINALG_DEF mat2u_t mat2u_nmul(size_t n, ...);
+LINALG_DEF mat2u_t mat2u_mul_chain(const mat2u_t *Ms, size_t n);
+
+LINALG_INLINE vec2u_t mat2u_mul_vec(mat2u_t M, vec2u_t v) {
     vec2u_t result;
     result.x = vec2u_dot(M.v[0], v);
     result.y = vec2u_dot(M.v[1], v);
     return result;
 }
 
-LINALG_DEF mat2u_t mat2u_hadamard(mat2u_t A, mat2u_t B) {
+LINALG_INLINE void mat2u_mul_vec_to(vec2u_t *restrict out, const mat2u_t *M,
+                                    const vec2u_t *v) {
+    out->x = M->_11 * v->x + M->_12 * v->y;
+    out->y = M->_21 * v->x + M->_22 * v->y;
+}
+
+LINALG_INLINE mat2u_t mat2u_hadamard(mat2u_t A, mat2u_t B) {
     A.e[0] *= B.e[0];
     A.e[1] *= B.e[1];
+    A.e[2] *= B.e[2];
+    A.e[3] *= B.e[3];
     return A;
 }
 
-LINALG_DEF vec3f_t vec3f_add(vec3f_t a, vec3f_t b) {
-    a.x += b.x;
-    a.y += b.y;
-    a.z += b.z;
-    return a;
+LINALG_INLINE void mat2u_hadamard_to(mat2u_t *restrict out, const mat2u_t *A,
+                                     const mat2u_t *B) {
+    out->e[0] = A->e[0] * B->e[0];
+    out->e[1] = A->e[1] * B->e[1];
+    out->e[2] = A->e[2] * B->e[2];
+    out->e[3] = A->e[3] * B->e[3];
 }
 
-LINALG_DEF vec3f_t vec3f_sub(vec3f_t a, vec3f_t b) {
-    a.x -= b.x;
+LINALG_DEF void mat2u_transform_array(const mat2u_t *M,
+                                      const vec2u_t *restrict in,
+                                      vec2u_t *restrict out, size_t n);
+
+LINALG_INLINE mat2u_t mat2u_transpose(mat2u_t M) {
+    mat2u_t T;
+    T._11 = M._11;
+    T._12 = M._21;
+    T._21 = M._12;
+    T._22 = M._22;
+    return T;
+}
+
+LINALG_INLINE vec3f_t vec3f_add(vec3f_t a, vec3f_t b) {
+    a.x += b.x;
+    a.y += b.y;
+    a.z += b.z;
+    return a;
+}
+
+LINALG_INLINE void vec3f_add_to(vec3f_t *restrict out, const vec3f_t *a,
+                                const vec3f_t *b) {
+    out->x = a->x + b->x;
+    out->y = a->y + b->y;
+    out->z = a->z + b->z;
+}
+
+LINALG_INLINE void vec3f_add_assign(vec3f_t *a, vec3f_t b) {
+    a->x += b.x;
+    a->y += b.y;
+    a->z += b.z;
+}
+
+LINALG_INLINE vec3f_t vec3f_sub(vec3f_t a, vec3f_t b) {
+    a.x -= b.x;
     a.y -= b.y;
     a.z -= b.z;
     return a;
 }
 
-LINALG_DEF vec3f_t vec3f_mul(vec3f_t a, vec3f_t b) {
+LINALG_INLINE void vec3f_sub_to(vec3f_t *restrict out, const vec3f_t *a,
+                                const vec3f_t *b) {
+    out->x = a->x - b->x;
+    out->y = a->y - b->y;
+    out->z = a->z - b->z;
+}
+
+LINALG_INLINE void vec3f_sub_assign(vec3f_t *a, vec3f_t b) {
+    a->x -= b.x;
+    a->y -= b.y;
+    a->z -= b.z;
+}
+
+LINALG_INLINE vec3f_t vec3f_mul(vec3f_t a, vec3f_t b) {
     a.x *= b.x;
     a.y *= b.y;
     a.z *= b.z;
     return a;
 }
 
-LINALG_DEF vec3f_t vec3f_div(vec3f_t a, vec3f_t b) {
+LINALG_INLINE void vec3f_mul_to(vec3f_t *restrict out, const vec3f_t *a,
+                                const vec3f_t *b) {
+    out->x = a->x * b->x;
+    out->y = a->y * b->y;
+    out->z = a->z * b->z;
+}
+
+LINALG_INLINE void vec3f_mul_assign(vec3f_t *a, vec3f_t b) {
+    a->x *= b.x;
+    a->y *= b.y;
+    a->z *= b.z;
+}
+
+LINALG_INLINE vec3f_t vec3f_div(vec3f_t a, vec3f_t b) {
     a.x /= b.x;
     a.y /= b.y;
     a.z /= b.z;
     return a;
 }
 
-LINALG_DEF vec3f_t vec3f_mod(vec3f_t a, vec3f_t b) {
+LINALG_INLINE void vec3f_div_to(vec3f_t *restrict out, const vec3f_t *a,
+                                const vec3f_t *b) {
+    out->x = a->x / b->x;
+    out->y = a->y / b->y;
+    out->z = a->z / b->z;
+}
+
+LINALG_INLINE void vec3f_div_assign(vec3f_t *a, vec3f_t b) {
+    a->x /= b.x;
+    a->y /= b.y;
+    a->z /= b.z;
+}
+
+LINALG_INLINE vec3f_t vec3f_mod(vec3f_t a, vec3f_t b) {
     a.x = fmodf(a.x, b.x);
     a.y = fmodf(a.y, b.y);
     a.z = fmodf(a.z, b.z);
     return a;
 }
 
-LINALG_DEF vec3f_t vec3f_min(vec3f_t a, vec3f_t b) {
+LINALG_INLINE void vec3f_mod_to(vec3f_t *restrict out, const vec3f_t *a,
+                                const vec3f_t *b) {
+    out->x = fmodf(a->x, b->x);
+    out->y = fmodf(a->y, b->y);
+    out->z = fmodf(a->z, b->z);
+}
+
+LINALG_INLINE void vec3f_mod_assign(vec3f_t *a, vec3f_t b) {
+    a->x = fmodf(a->x, b.x);
+    a->y = fmodf(a->y, b.y);
+    a->z = fmodf(a->z, b.z);
+}
+
+LINALG_INLINE vec3f_t vec3f_min(vec3f_t a, vec3f_t b) {
     a.x = minf(a.x, b.x);
     a.y = minf(a.y, b.y);
     a.z = minf(a.z, b.z);
     return a;
 }
 
-LINALG_DEF vec3f_t vec3f_max(vec3f_t a, vec3f_t b) {
+LINALG_INLINE void vec3f_min_to(vec3f_t *restrict out, const vec3f_t *a,
+                                const vec3f_t *b) {
+    out->x = minf(a->x, b->x);
+    out->y = minf(a->y, b->y);
+    out->z = minf(a->z, b->z);
+}
+
+LINALG_INLINE vec3f_t vec3f_max(vec3f_t a, vec3f_t b) {
     a.x = maxf(a.x, b.x);
     a.y = maxf(a.y, b.y);
     a.z = maxf(a.z, b.z);
     return a;
 }
 
-LINALG_DEF vec3f_t vec3f_floor(vec3f_t v) {
+LINALG_INLINE void vec3f_max_to(vec3f_t *restrict out, const vec3f_t *a,
+                                const vec3f_t *b) {
+    out->x = maxf(a->x, b->x);
+    out->y = maxf(a->y, b->y);
+    out->z = maxf(a->z, b->z);
+}
+
+LINALG_INLINE vec3f_t vec3f_floor(vec3f_t v) {
     v.x = floorf(v.x);
     v.y = floorf(v.y);
     v.z = floorf(v.z);
     return v;
 }
 
-LINALG_DEF vec3f_t vec3f_ceil(vec3f_t v) {
+LINALG_INLINE void vec3f_floor_to(vec3f_t *restrict out, const vec3f_t *v) {
+    out->x = floorf(v->x);
+    out->y = floorf(v->y);
+    out->z = floorf(v->z);
+}
+
+LINALG_INLINE vec3f_t vec3f_ceil(vec3f_t v) {
     v.x = ceilf(v.x);
     v.y = ceilf(v.y);
     v.z = ceilf(v.z);
     return v;
 }
 
-LINALG_DEF vec3f_t vec3f_clamp(vec3f_t v, vec3f_t min, vec3f_t max) {
+LINALG_INLINE void vec3f_ceil_to(vec3f_t *restrict out, const vec3f_t *v) {
+    out->x = ceilf(v->x);
+    out->y = ceilf(v->y);
+    out->z = ceilf(v->z);
+}
+
+LINALG_INLINE vec3f_t vec3f_clamp(vec3f_t v, vec3f_t min, vec3f_t max) {
     v.x = clampf(v.x, min.x, max.x);
     v.y = clampf(v.y, min.y, max.y);
     v.z = clampf(v.z, min.z, max.z);
     return v;
 }
 
-LINALG_DEF vec3f_t vec3f_abs(vec3f_t v) {
+LINALG_INLINE void vec3f_clamp_to(vec3f_t *restrict out, const vec3f_t *v,
+                                  const vec3f_t *min, const vec3f_t *max) {
+    out->x = clampf(v->x, min->x, max->x);
+    out->y = clampf(v->y, min->y, max->y);
+    out->z = clampf(v->z, min->z, max->z);
+}
+
+LINALG_INLINE vec3f_t vec3f_abs(vec3f_t v) {
     v.x = fabsf(v.x);
     v.y = fabsf(v.y);
     v.z = fabsf(v.z);
     return v;
 }
 
-LINALG_DEF vec3f_t vec3f_lerp(vec3f_t a, vec3f_t b, vec3f_t t) {
+LINALG_INLINE void vec3f_abs_to(vec3f_t *restrict out, const vec3f_t *v) {
+    out->x = fabsf(v->x);
+    out->y = fabsf(v->y);
+    out->z = fabsf(v->z);
+}
+
+LINALG_INLINE vec3f_t vec3f_lerp(vec3f_t a, vec3f_t b, vec3f_t t) {
     a.x = lerpf(a.x, b.x, t.x);
     a.y = lerpf(a.y, b.y, t.y);
     a.z = lerpf(a.z, b.z, t.z);
     return a;
 }
 
-LINALG_DEF vec3f_t vec3f_sum(size_t n, ...) {
-    va_list args;
-    va_start(args, n);
-    vec3f_t sum = {0};
-    for (size_t i = 0; i < n; ++i) {
-        vec3f_t v = va_arg(args, vec3f_t);
-        sum = vec3f_add(sum, v);
-    }
-    return sum;
+LINALG_INLINE void vec3f_lerp_to(vec3f_t *restrict out, const vec3f_t *a,
+                                 const vec3f_t *b, const vec3f_t *t) {
+    out->x = lerpf(a->x, b->x, t->x);
+    out->y = lerpf(a->y, b->y, t->y);
+    out->z = lerpf(a->z, b->z, t->z);
 }
 
-LINALG_DEF vec3f_t vec3f_product(size_t n, ...) {
-    va_list args;
-    va_start(args, n);
-    vec3f_t product = vec3f_splat(1);
-    for (size_t i = 0; i < n; ++i) {
-        vec3f_t v = va_arg(args, vec3f_t);
-        product = vec3f_mul(product, v);
-    }
-    return product;
-}
+LINALG_DEF vec3f_t vec3f_sum(size_t n, ...);
+LINALG_DEF vec3f_t vec3f_sum_array(const vec3f_t *xs, size_t n);
+LINALG_DEF vec3f_t vec3f_product(size_t n, ...);
+LINALG_DEF vec3f_t vec3f_product_array(const vec3f_t *xs, size_t n);
 
-LINALG_DEF float vec3f_dot(vec3f_t a, vec3f_t b) {
+LINALG_INLINE float vec3f_dot(vec3f_t a, vec3f_t b) {
     return a.x * b.x + a.y * b.y + a.z * b.z;
 }
 
-LINALG_DEF vec3f_t vec3f_cross(vec3f_t a, vec3f_t b) {
+LINALG_INLINE vec3f_t vec3f_cross(vec3f_t a, vec3f_t b) {
     vec3f_t result = {0};
     result.x = a.y * b.z - a.z * b.y;
-    result.y = a.z * b.x - a.z * b.x;
+    result.y = a.z * b.x - a.x * b.z;
     result.z = a.x * b.y - a.y * b.x;
     return result;
 }
 
-LINALG_DEF float vec3f_sqrlen(vec3f_t v) { return vec3f_dot(v, v); }
+LINALG_INLINE float vec3f_sqrlen(vec3f_t v) { return vec3f_dot(v, v); }
 
-LINALG_DEF float vec3f_1norm(vec3f_t v) {
+LINALG_INLINE float vec3f_1norm(vec3f_t v) {
     v = vec3f_abs(v);
     float norm = 0;
     norm += v.x;
@@ -1590,15 +2767,19 @@ LINALG_DEF float vec3f_1norm(vec3f_t v) {
     return norm;
 }
 
-LINALG_DEF float vec3f_2norm(vec3f_t v) { return sqrtf(vec3f_sqrlen(v)); }
+LINALG_INLINE float vec3f_2norm(vec3f_t v) { return sqrtf(vec3f_sqrlen(v)); }
 
-LINALG_DEF vec3f_t vec3f_unit(vec3f_t v) {
+LINALG_INLINE vec3f_t vec3f_unit(vec3f_t v) {
     return vec3f_div(v, vec3f_splat(vec3f_2norm(v)));
 }
 
-LINALG_DEF vec3f_t vec3f_norm(vec3f_t v) { return vec3f_unit(v); }
+LINALG_INLINE vec3f_t vec3f_norm(vec3f_t v) { return vec3f_unit(v); }
+
+LINALG_INLINE vec3f_t vec3f_unit_fast(vec3f_t v) {
+    return vec3f_mul(v, vec3f_splat(rsqrtf_fast(vec3f_sqrlen(v))));
+}
 
-LINALG_DEF _Bool vec3f_eq(vec3f_t a, vec3f_t b, float epsilon) {
+LINALG_INLINE _Bool vec3f_eq(vec3f_t a, vec3f_t b, float epsilon) {
     if (fabsf(b.x - a.x) > epsilon) {
         return 0;
     }
@@ -1611,7 +2792,7 @@ LINALG_DEF _Bool vec3f_eq(vec3f_t a, vec3f_t b, float epsilon) {
     return 1;
 }
 
-LINALG_DEF vec3f_t vec3f_reflect(vec3f_t v, vec3f_t n) {
+LINALG_INLINE vec3f_t vec3f_reflect(vec3f_t v, vec3f_t n) {
     vec3f_t result = n;
     result = vec3f_mul(result, vec3f_splat(vec3f_dot(v, n)));
     result = vec3f_mul(result, vec3f_splat(2));
@@ -1619,18 +2800,26 @@ LINALG_DEF vec3f_t vec3f_reflect(vec3f_t v, vec3f_t n) {
     return result;
 }
 
-LINALG_DEF vec3f_t vec3f_direction(vec3f_t a, vec3f_t b) {
+LINALG_INLINE vec3f_t vec3f_direction(vec3f_t a, vec3f_t b) {
     vec3f_t delta = vec3f_sub(b, a);
     return vec3f_unit(delta);
 }
 
-LINALG_DEF float vec3f_angle_between(vec3f_t a, vec3f_t b) {
+LINALG_INLINE float vec3f_angle_between(vec3f_t a, vec3f_t b) {
     vec3f_t a_unit = vec3f_unit(a);
     vec3f_t b_unit = vec3f_unit(b);
     return acosf(vec3f_dot(a_unit, b_unit));
 }
 
-LINALG_DEF mat3f_t mat3f_mul(mat3f_t A, mat3f_t B) {
+LINALG_INLINE float vec3f_angle_between_fast(vec3f_t a, vec3f_t b) {
+    float cos_angle = vec3f_dot(a,
+                                b) *
+                                    rsqrtf_fast(vec3f_sqrlen(a) *
+                                                vec3f_sqrlen(b));
+    return acosf_fast(clampf(cos_angle, -1, 1));
+}
+
+LINALG_INLINE mat3f_t mat3f_mul(mat3f_t A, mat3f_t B) {
     mat3f_t result;
     result._11 = A._11 * B._11 + A._12 * B._21 + A._13 * B._31;
     result._12 = A._11 * B._12 + A._12 * B._22 + A._13 * B._32;
@@ -1644,18 +2833,23 @@ LINALG_DEF mat3f_t mat3f_mul(mat3f_t A, mat3f_t B) {
     return result;
 }
 
-LINALG_DEF mat3f_t mat3f_nmul(size_t n, ...) {
-    va_list args;
-    va_start(args, n);
-    mat3f_t product = mat3f_I();
-    for (size_t i = 0; i < n; ++i) {
-        mat3f_t A = va_arg(args, mat3f_t);
-        product = mat3f_mul(product, A);
-    }
-    return product;
+LINALG_INLINE void mat3f_mul_to(mat3f_t *restrict out, const mat3f_t *A,
+                                const mat3f_t *B) {
+    out->_11 = A->_11 * B->_11 + A->_12 * B->_21 + A->_13 * B->_31;
+    out->_12 = A->_11 * B->_12 + A->_12 * B->_22 + A->_13 * B->_32;
+    out->_13 = A->_11 * B->_13 + A->_12 * B->_23 + A->_13 * B->_33;
+    out->_21 = A->_21 * B->_11 + A->_22 * B->_21 + A->_23 * B->_31;
+    out->_22 = A->_21 * B->_12 + A->_22 * B->_22 + A->_23 * B->_32;
+    out->_23 = A->_21 * B->_13 + A->_22 * B->_23 + A->_23 * B->_33;
+    out->_31 = A->_31 * B->_11 + A->_32 * B->_21 + A->_33 * B->_31;
+    out->_32 = A->_31 * B->_12 + A->_32 * B->_22 + A->_33 * B->_32;
+    out->_33 = A->_31 * B->_13 + A->_32 * B->_23 + A->_33 * B->_33;
 }
 
-LINALG_DEF vec3f_t mat3f_mul_vec(mat3f_t M, vec3f_t v) {
+LINALG_DEF mat3f_t mat3f_nmul(size_t n, ...);
+LINALG_DEF mat3f_t mat3f_mul_chain(const mat3f_t *Ms, size_t n);
+
+LINALG_INLINE vec3f_t mat3f_mul_vec(mat3f_t M, vec3f_t v) {
     vec3f_t result;
     result.x = vec3f_dot(M.v[0], v);
     result.y = vec3f_dot(M.v[1], v);
@@ -1663,144 +2857,374 @@ LINALG_DEF vec3f_t mat3f_mul_vec(mat3f_t M, vec3f_t v) {
     return result;
 }
 
-LINALG_DEF mat3f_t mat3f_hadamard(mat3f_t A, mat3f_t B) {
+LINALG_INLINE void mat3f_mul_vec_to(vec3f_t *restrict out, const mat3f_t *M,
+                                    const vec3f_t *v) {
+    out->x = M->_11 * v->x + M->_12 * v->y + M->_13 * v->z;
+    out->y = M->_21 * v->x + M->_22 * v->y + M->_23 * v->z;
+    out->z = M->_31 * v->x + M->_32 * v->y + M->_33 * v->z;
+}
+
+LINALG_INLINE mat3f_t mat3f_hadamard(mat3f_t A, mat3f_t B) {
     A.e[0] *= B.e[0];
     A.e[1] *= B.e[1];
     A.e[2] *= B.e[2];
+    A.e[3] *= B.e[3];
+    A.e[4] *= B.e[4];
+    A.e[5] *= B.e[5];
+    A.e[6] *= B.e[6];
+    A.e[7] *= B.e[7];
+    A.e[8] *= B.e[8];
+    return A;
+}
+
+LINALG_INLINE void mat3f_hadamard_to(mat3f_t *restrict out, const mat3f_t *A,
+                                     const mat3f_t *B) {
+    out->e[0] = A->e[0] * B->e[0];
+    out->e[1] = A->e[1] * B->e[1];
+    out->e[2] = A->e[2] * B->e[2];
+    out->e[3] = A->e[3] * B->e[3];
+    out->e[4] = A->e[4] * B->e[4];
+    out->e[5] = A->e[5] * B->e[5];
+    out->e[6] = A->e[6] * B->e[6];
+    out->e[7] = A->e[7] * B->e[7];
+    out->e[8] = A->e[8] * B->e[8];
+}
+
+LINALG_INLINE mat3f_t mat3f_rotate(mat3f_t A, rotate_axis_s axis, float angle) {
+    const float c = cosf(angle);
+    const float s = sinf(angle);
+    size_t i = (axis + 1) % 3;
+    size_t j = (axis + 2) % 3;
+    A.M[i][i] *= c;
+    A.M[i][j] *= -s;
+    A.M[j][i] *= s;
+    A.M[j][j] *= c;
     return A;
 }
 
-LINALG_DEF mat3f_t mat3f_rotate(mat3f_t A, rotate_axis_s axis, float angle) {
+LINALG_INLINE mat3f_t mat3f_rotate_fast(mat3f_t A, rotate_axis_s axis,
+                                        float angle) {
+    float c, s;
+    sincosf_fast(angle, &s, &c);
     size_t i = (axis + 1) % 3;
     size_t j = (axis + 2) % 3;
-    A.M[i][i] *= cosf(angle);
-    A.M[i][j] *= -sinf(angle);
-    A.M[j][i] *= sinf(angle);
-    A.M[j][j] *= cosf(angle);
+    A.M[i][i] *= c;
+    A.M[i][j] *= -s;
+    A.M[j][i] *= s;
+    A.M[j][j] *= c;
     return A;
 }
 
-LINALG_DEF vec3d_t vec3d_add(vec3d_t a, vec3d_t b) {
+LINALG_INLINE void mat3f_rotate_to(mat3f_t *restrict out, const mat3f_t *A,
+                                   rotate_axis_s axis, float angle) {
+    const float c = cosf(angle);
+    const float s = sinf(angle);
+    *out = *A;
+    size_t i = (axis + 1) % 3;
+    size_t j = (axis + 2) % 3;
+    out->M[i][i] *= c;
+    out->M[i][j] *= -s;
+    out->M[j][i] *= s;
+    out->M[j][j] *= c;
+}
+
+LINALG_INLINE void mat3f_rotate_fast_to(mat3f_t *restrict out, const mat3f_t *A,
+                                        rotate_axis_s axis, float angle) {
+    float c, s;
+    sincosf_fast(angle, &s, &c);
+    *out = *A;
+    size_t i = (axis + 1) % 3;
+    size_t j = (axis + 2) % 3;
+    out->M[i][i] *= c;
+    out->M[i][j] *= -s;
+    out->M[j][i] *= s;
+    out->M[j][j] *= c;
+}
+
+LINALG_INLINE void mat3f_rotate_assign(mat3f_t *A, rotate_axis_s axis,
+                                       float angle) {
+    const float c = cosf(angle);
+    const float s = sinf(angle);
+    size_t i = (axis + 1) % 3;
+    size_t j = (axis + 2) % 3;
+    A->M[i][i] *= c;
+    A->M[i][j] *= -s;
+    A->M[j][i] *= s;
+    A->M[j][j] *= c;
+}
+
+LINALG_INLINE void mat3f_rotate_fast_assign(mat3f_t *A, rotate_axis_s axis,
+                                            float angle) {
+    float c, s;
+    sincosf_fast(angle, &s, &c);
+    size_t i = (axis + 1) % 3;
+    size_t j = (axis + 2) % 3;
+    A->M[i][i] *= c;
+    A->M[i][j] *= -s;
+    A->M[j][i] *= s;
+    A->M[j][j] *= c;
+}
+
+LINALG_DEF void mat3f_transform_array(const mat3f_t *M,
+                                      const vec3f_t *restrict in,
+                                      vec3f_t *restrict out, size_t n);
+
+LINALG_INLINE mat3f_t mat3f_transpose(mat3f_t M) {
+    mat3f_t T;
+    T._11 = M._11;
+    T._12 = M._21;
+    T._13 = M._31;
+    T._21 = M._12;
+    T._22 = M._22;
+    T._23 = M._32;
+    T._31 = M._13;
+    T._32 = M._23;
+    T._33 = M._33;
+    return T;
+}
+
+LINALG_INLINE float mat3f_det(mat3f_t M) {
+    return M._11 * (M._22 * M._33 - M._23 * M._32) + M._12 *
+           (M._23 * M._31 - M._21 * M._33) + M._13 *
+               (M._21 * M._32 - M._22 * M._31);
+}
+
+LINALG_INLINE mat3f_t mat3f_inverse(mat3f_t M) {
+    mat3f_t result;
+    const float c11 = (M._22 * M._33 - M._23 * M._32);
+    const float c12 = (M._23 * M._31 - M._21 * M._33);
+    const float c13 = (M._21 * M._32 - M._22 * M._31);
+    const float inv_det = 1 / (M._11 * c11 + M._12 * c12 + M._13 * c13);
+    result._11 = c11 * inv_det;
+    result._21 = c12 * inv_det;
+    result._31 = c13 * inv_det;
+    result._12 = (M._32 * M._13 - M._33 * M._12) * inv_det;
+    result._22 = (M._33 * M._11 - M._31 * M._13) * inv_det;
+    result._32 = (M._31 * M._12 - M._32 * M._11) * inv_det;
+    result._13 = (M._12 * M._23 - M._13 * M._22) * inv_det;
+    result._23 = (M._13 * M._21 - M._11 * M._23) * inv_det;
+    result._33 = (M._11 * M._22 - M._12 * M._21) * inv_det;
+    return result;
+}
+
+LINALG_DEF void mat3f_inverse_array(const mat3f_t *restrict in,
+                                    mat3f_t *restrict out, size_t n);
+
+LINALG_INLINE vec3d_t vec3d_add(vec3d_t a, vec3d_t b) {
     a.x += b.x;
     a.y += b.y;
     a.z += b.z;
     return a;
 }
 
-LINALG_DEF vec3d_t vec3d_sub(vec3d_t a, vec3d_t b) {
+LINALG_INLINE void vec3d_add_to(vec3d_t *restrict out, const vec3d_t *a,
+                                const vec3d_t *b) {
+    out->x = a->x + b->x;
+    out->y = a->y + b->y;
+    out->z = a->z + b->z;
+}
+
+LINALG_INLINE void vec3d_add_assign(vec3d_t *a, vec3d_t b) {
+    a->x += b.x;
+    a->y += b.y;
+    a->z += b.z;
+}
+
+LINALG_INLINE vec3d_t vec3d_sub(vec3d_t a, vec3d_t b) {
     a.x -= b.x;
     a.y -= b.y;
     a.z -= b.z;
     return a;
 }
 
-LINALG_DEF vec3d_t vec3d_mul(vec3d_t a, vec3d_t b) {
+LINALG_INLINE void vec3d_sub_to(vec3d_t *restrict out, const vec3d_t *a,
+                                const vec3d_t *b) {
+    out->x = a->x - b->x;
+    out->y = a->y - b->y;
+    out->z = a->z - b->z;
+}
+
+LINALG_INLINE void vec3d_sub_assign(vec3d_t *a, vec3d_t b) {
+    a->x -= b.x;
+    a->y -= b.y;
+    a->z -= b.z;
+}
+
+LINALG_INLINE vec3d_t vec3d_mul(vec3d_t a, vec3d_t b) {
     a.x *= b.x;
     a.y *= b.y;
     a.z *= b.z;
     return a;
 }
 
-LINALG_DEF vec3d_t vec3d_div(vec3d_t a, vec3d_t b) {
+LINALG_INLINE void vec3d_mul_to(vec3d_t *restrict out, const vec3d_t *a,
+                                const vec3d_t *b) {
+    out->x = a->x * b->x;
+    out->y = a->y * b->y;
+    out->z = a->z * b->z;
+}
+
+LINALG_INLINE void vec3d_mul_assign(vec3d_t *a, vec3d_t b) {
+    a->x *= b.x;
+    a->y *= b.y;
+    a->z *= b.z;
+}
+
+LINALG_INLINE vec3d_t vec3d_div(vec3d_t a, vec3d_t b) {
     a.x /= b.x;
     a.y /= b.y;
     a.z /= b.z;
     return a;
 }
 
-LINALG_DEF vec3d_t vec3d_mod(vec3d_t a, vec3d_t b) {
+LINALG_INLINE void vec3d_div_to(vec3d_t *restrict out, const vec3d_t *a,
+                                const vec3d_t *b) {
+    out->x = a->x / b->x;
+    out->y = a->y / b->y;
+    out->z = a->z / b->z;
+}
+
+LINALG_INLINE void vec3d_div_assign(vec3d_t *a, vec3d_t b) {
+    a->x /= b.x;
+    a->y /= b.y;
+    a->z /= b.z;
+}
+
+LINALG_INLINE vec3d_t vec3d_mod(vec3d_t a, vec3d_t b) {
     a.x = fmod(a.x, b.x);
     a.y = fmod(a.y, b.y);
     a.z = fmod(a.z, b.z);
     return a;
 }
 
-LINALG_DEF vec3d_t vec3d_min(vec3d_t a, vec3d_t b) {
+LINALG_INLINE void vec3d_mod_to(vec3d_t *restrict out, const vec3d_t *a,
+                                const vec3d_t *b) {
+    out->x = fmod(a->x, b->x);
+    out->y = fmod(a->y, b->y);
+    out->z = fmod(a->z, b->z);
+}
+
+LINALG_INLINE void vec3d_mod_assign(vec3d_t *a, vec3d_t b) {
+    a->x = fmod(a->x, b.x);
+    a->y = fmod(a->y, b.y);
+    a->z = fmod(a->z, b.z);
+}
+
+LINALG_INLINE vec3d_t vec3d_min(vec3d_t a, vec3d_t b) {
     a.x = mind(a.x, b.x);
     a.y = mind(a.y, b.y);
     a.z = mind(a.z, b.z);
     return a;
 }
 
-LINALG_DEF vec3d_t vec3d_max(vec3d_t a, vec3d_t b) {
+LINALG_INLINE void vec3d_min_to(vec3d_t *restrict out, const vec3d_t *a,
+                                const vec3d_t *b) {
+    out->x = mind(a->x, b->x);
+    out->y = mind(a->y, b->y);
+    out->z = mind(a->z, b->z);
+}
+
+LINALG_INLINE vec3d_t vec3d_max(vec3d_t a, vec3d_t b) {
     a.x = maxd(a.x, b.x);
     a.y = maxd(a.y, b.y);
     a.z = maxd(a.z, b.z);
     return a;
 }
 
-LINALG_DEF vec3d_t vec3d_floor(vec3d_t v) {
+LINALG_INLINE void vec3d_max_to(vec3d_t *restrict out, const vec3d_t *a,
+                                const vec3d_t *b) {
+    out->x = maxd(a->x, b->x);
+    out->y = maxd(a->y, b->y);
+    out->z = maxd(a->z, b->z);
+}
+
+LINALG_INLINE vec3d_t vec3d_floor(vec3d_t v) {
     v.x = floor(v.x);
     v.y = floor(v.y);
     v.z = floor(v.z);
     return v;
 }
 
-LINALG_DEF vec3d_t vec3d_ceil(vec3d_t v) {
+LINALG_INLINE void vec3d_floor_to(vec3d_t *restrict out, const vec3d_t *v) {
+    out->x = floor(v->x);
+    out->y = floor(v->y);
+    out->z = floor(v->z);
+}
+
+LINALG_INLINE vec3d_t vec3d_ceil(vec3d_t v) {
     v.x = ceil(v.x);
     v.y = ceil(v.y);
     v.z = ceil(v.z);
     return v;
 }
 
-LINALG_DEF vec3d_t vec3d_clamp(vec3d_t v, vec3d_t min, vec3d_t max) {
+LINALG_INLINE void vec3d_ceil_to(vec3d_t *restrict out, const vec3d_t *v) {
+    out->x = ceil(v->x);
+    out->y = ceil(v->y);
+    out->z = ceil(v->z);
+}
+
+LINALG_INLINE vec3d_t vec3d_clamp(vec3d_t v, vec3d_t min, vec3d_t max) {
     v.x = clampd(v.x, min.x, max.x);
     v.y = clampd(v.y, min.y, max.y);
     v.z = clampd(v.z, min.z, max.z);
     return v;
 }
 
-LINALG_DEF vec3d_t vec3d_abs(vec3d_t v) {
+LINALG_INLINE void vec3d_clamp_to(vec3d_t *restrict out, const vec3d_t *v,
+                                  const vec3d_t *min, const vec3d_t *max) {
+    out->x = clampd(v->x, min->x, max->x);
+    out->y = clampd(v->y, min->y, max->y);
+    out->z = clampd(v->z, min->z, max->z);
+}
+
+LINALG_INLINE vec3d_t vec3d_abs(vec3d_t v) {
     v.x = fabs(v.x);
     v.y = fabs(v.y);
     v.z = fabs(v.z);
     return v;
 }
 
-LINALG_DEF vec3d_t vec3d_lerp(vec3d_t a, vec3d_t b, vec3d_t t) {
+LINALG_INLINE void vec3d_abs_to(vec3d_t *restrict out, const vec3d_t *v) {
+    out->x = fabs(v->x);
+    out->y = fabs(v->y);
+    out->z = fabs(v->z);
+}
+
+LINALG_INLINE vec3d_t vec3d_lerp(vec3d_t a, vec3d_t b, vec3d_t t) {
     a.x = lerpd(a.x, b.x, t.x);
     a.y = lerpd(a.y, b.y, t.y);
     a.z = lerpd(a.z, b.z, t.z);
     return a;
 }
 
-LINALG_DEF vec3d_t vec3d_sum(size_t n, ...) {
-    va_list args;
-    va_start(args, n);
-    vec3d_t sum = {0};
-    for (size_t i = 0; i < n; ++i) {
-        vec3d_t v = va_arg(args, vec3d_t);
-        sum = vec3d_add(sum, v);
-    }
-    return sum;
+LINALG_INLINE void vec3d_lerp_to(vec3d_t *restrict out, const vec3d_t *a,
+                                 const vec3d_t *b, const vec3d_t *t) {
+    out->x = lerpd(a->x, b->x, t->x);
+    out->y = lerpd(a->y, b->y, t->y);
+    out->z = lerpd(a->z, b->z, t->z);
 }
 
-LINALG_DEF vec3d_t vec3d_product(size_t n, ...) {
-    va_list args;
-    va_start(args, n);
-    vec3d_t product = vec3d_splat(1);
-    for (size_t i = 0; i < n; ++i) {
-        vec3d_t v = va_arg(args, vec3d_t);
-        product = vec3d_mul(product, v);
-    }
-    return product;
-}
+LINALG_DEF vec3d_t vec3d_sum(size_t n, ...);
+LINALG_DEF vec3d_t vec3d_sum_array(const vec3d_t *xs, size_t n);
+LINALG_DEF vec3d_t vec3d_product(size_t n, ...);
+LINALG_DEF vec3d_t vec3d_product_array(const vec3d_t *xs, size_t n);
 
-LINALG_DEF double vec3d_dot(vec3d_t a, vec3d_t b) {
+LINALG_INLINE double vec3d_dot(vec3d_t a, vec3d_t b) {
     return a.x * b.x + a.y * b.y + a.z * b.z;
 }
 
-LINALG_DEF vec3d_t vec3d_cross(vec3d_t a, vec3d_t b) {
+LINALG_INLINE vec3d_t vec3d_cross(vec3d_t a, vec3d_t b) {
     vec3d_t result = {0};
     result.x = a.y * b.z - a.z * b.y;
-    result.y = a.z * b.x - a.z * b.x;
+    result.y = a.z * b.x - a.x * b.z;
     result.z = a.x * b.y - a.y * b.x;
     return result;
 }
 
-LINALG_DEF double vec3d_sqrlen(vec3d_t v) { return vec3d_dot(v, v); }
+LINALG_INLINE double vec3d_sqrlen(vec3d_t v) { return vec3d_dot(v, v); }
 
-LINALG_DEF double vec3d_1norm(vec3d_t v) {
+LINALG_INLINE double vec3d_1norm(vec3d_t v) {
     v = vec3d_abs(v);
     double norm = 0;
     norm += v.x;
@@ -1809,15 +3233,15 @@ LINALG_DEF double vec3d_1norm(vec3d_t v) {
     return norm;
 }
 
-LINALG_DEF double vec3d_2norm(vec3d_t v) { return sqrt(vec3d_sqrlen(v)); }
+LINALG_INLINE double vec3d_2norm(vec3d_t v) { return sqrt(vec3d_sqrlen(v)); }
 
-LINALG_DEF vec3d_t vec3d_unit(vec3d_t v) {
+LINALG_INLINE vec3d_t vec3d_unit(vec3d_t v) {
     return vec3d_div(v, vec3d_splat(vec3d_2norm(v)));
 }
 
-LINALG_DEF vec3d_t vec3d_norm(vec3d_t v) { return vec3d_unit(v); }
+LINALG_INLINE vec3d_t vec3d_norm(vec3d_t v) { return vec3d_unit(v); }
 
-LINALG_DEF _Bool vec3d_eq(vec3d_t a, vec3d_t b, double epsilon) {
+LINALG_INLINE _Bool vec3d_eq(vec3d_t a, vec3d_t b, double epsilon) {
     if (fabs(b.x - a.x) > epsilon) {
         return 0;
     }
@@ -1830,7 +3254,7 @@ LINALG_DEF _Bool vec3d_eq(vec3d_t a, vec3d_t b, double epsilon) {
     return 1;
 }
 
-LINALG_DEF vec3d_t vec3d_reflect(vec3d_t v, vec3d_t n) {
+LINALG_INLINE vec3d_t vec3d_reflect(vec3d_t v, vec3d_t n) {
     vec3d_t result = n;
     result = vec3d_mul(result, vec3d_splat(vec3d_dot(v, n)));
     result = vec3d_mul(result, vec3d_splat(2));
@@ -1838,18 +3262,18 @@ LINALG_DEF vec3d_t vec3d_reflect(vec3d_t v, vec3d_t n) {
     return result;
 }
 
-LINALG_DEF vec3d_t vec3d_direction(vec3d_t a, vec3d_t b) {
+LINALG_INLINE vec3d_t vec3d_direction(vec3d_t a, vec3d_t b) {
     vec3d_t delta = vec3d_sub(b, a);
     return vec3d_unit(delta);
 }
 
-LINALG_DEF double vec3d_angle_between(vec3d_t a, vec3d_t b) {
+LINALG_INLINE double vec3d_angle_between(vec3d_t a, vec3d_t b) {
     vec3d_t a_unit = vec3d_unit(a);
     vec3d_t b_unit = vec3d_unit(b);
     return acos(vec3d_dot(a_unit, b_unit));
 }
 
-LINALG_DEF mat3d_t mat3d_mul(mat3d_t A, mat3d_t B) {
+LINALG_INLINE mat3d_t mat3d_mul(mat3d_t A, mat3d_t B) {
     mat3d_t result;
     result._11 = A._11 * B._11 + A._12 * B._21 + A._13 * B._31;
     result._12 = A._11 * B._12 + A._12 * B._22 + A._13 * B._32;
@@ -1863,18 +3287,23 @@ LINALG_DEF mat3d_t mat3d_mul(mat3d_t A, mat3d_t B) {
     return result;
 }
 
-LINALG_DEF mat3d_t mat3d_nmul(size_t n, ...) {
-    va_list args;
-    va_start(args, n);
-    mat3d_t product = mat3d_I();
-    for (size_t i = 0; i < n; ++i) {
-        mat3d_t A = va_arg(args, mat3d_t);
-        product = mat3d_mul(product, A);
-    }
-    return product;
+LINALG_INLINE void mat3d_mul_to(mat3d_t *restrict out, const mat3d_t *A,
+                                const mat3d_t *B) {
+    out->_11 = A->_11 * B->_11 + A->_12 * B->_21 + A->_13 * B->_31;
+    out->_12 = A->_11 * B->_12 + A->_12 * B->_22 + A->_13 * B->_32;
+    out->_13 = A->_11 * B->_13 + A->_12 * B->_23 + A->_13 * B->_33;
+    out->_21 = A->_21 * B->_11 + A->_22 * B->_21 + A->_23 * B->_31;
+    out->_22 = A->_21 * B->_12 + A->_22 * B->_22 + A->_23 * B->_32;
+    out->_23 = A->_21 * B->_13 + A->_22 * B->_23 + A->_23 * B->_33;
+    out->_31 = A->_31 * B->_11 + A->_32 * B->_21 + A->_33 * B->_31;
+    out->_32 = A->_31 * B->_12 + A->_32 * B->_22 + A->_33 * B->_32;
+    out->_33 = A->_31 * B->_13 + A->_32 * B->_23 + A->_33 * B->_33;
 }
 
-LINALG_DEF vec3d_t mat3d_mul_vec(mat3d_t M, vec3d_t v) {
+LINALG_DEF mat3d_t mat3d_nmul(size_t n, ...);
+LINALG_DEF mat3d_t mat3d_mul_chain(const mat3d_t *Ms, size_t n);
+
+LINALG_INLINE vec3d_t mat3d_mul_vec(mat3d_t M, vec3d_t v) {
     vec3d_t result;
     result.x = vec3d_dot(M.v[0], v);
     result.y = vec3d_dot(M.v[1], v);
@@ -1882,123 +3311,297 @@ LINALG_DEF vec3d_t mat3d_mul_vec(mat3d_t M, vec3d_t v) {
     return result;
 }
 
-LINALG_DEF mat3d_t mat3d_hadamard(mat3d_t A, mat3d_t B) {
+LINALG_INLINE void mat3d_mul_vec_to(vec3d_t *restrict out, const mat3d_t *M,
+                                    const vec3d_t *v) {
+    out->x = M->_11 * v->x + M->_12 * v->y + M->_13 * v->z;
+    out->y = M->_21 * v->x + M->_22 * v->y + M->_23 * v->z;
+    out->z = M->_31 * v->x + M->_32 * v->y + M->_33 * v->z;
+}
+
+LINALG_INLINE mat3d_t mat3d_hadamard(mat3d_t A, mat3d_t B) {
     A.e[0] *= B.e[0];
     A.e[1] *= B.e[1];
     A.e[2] *= B.e[2];
+    A.e[3] *= B.e[3];
+    A.e[4] *= B.e[4];
+    A.e[5] *= B.e[5];
+    A.e[6] *= B.e[6];
+    A.e[7] *= B.e[7];
+    A.e[8] *= B.e[8];
     return A;
 }
 
-LINALG_DEF mat3d_t mat3d_rotate(mat3d_t A, rotate_axis_s axis, double angle) {
+LINALG_INLINE void mat3d_hadamard_to(mat3d_t *restrict out, const mat3d_t *A,
+                                     const mat3d_t *B) {
+    out->e[0] = A->e[0] * B->e[0];
+    out->e[1] = A->e[1] * B->e[1];
+    out->e[2] = A->e[2] * B->e[2];
+    out->e[3] = A->e[3] * B->e[3];
+    out->e[4] = A->e[4] * B->e[4];
+    out->e[5] = A->e[5] * B->e[5];
+    out->e[6] = A->e[6] * B->e[6];
+    out->e[7] = A->e[7] * B->e[7];
+    out->e[8] = A->e[8] * B->e[8];
+}
+
+LINALG_INLINE mat3d_t mat3d_rotate(mat3d_t A, rotate_axis_s axis,
+                                   double angle) {
+    const double c = cos(angle);
+    const double s = sin(angle);
     size_t i = (axis + 1) % 3;
     size_t j = (axis + 2) % 3;
-    A.M[i][i] *= cos(angle);
-    A.M[i][j] *= -sin(angle);
-    A.M[j][i] *= sin(angle);
-    A.M[j][j] *= cos(angle);
+    A.M[i][i] *= c;
+    A.M[i][j] *= -s;
+    A.M[j][i] *= s;
+    A.M[j][j] *= c;
     return A;
 }
 
-LINALG_DEF vec3i_t vec3i_add(vec3i_t a, vec3i_t b) {
+LINALG_INLINE void mat3d_rotate_to(mat3d_t *restrict out, const mat3d_t *A,
+                                   rotate_axis_s axis, double angle) {
+    const double c = cos(angle);
+    const double s = sin(angle);
+    *out = *A;
+    size_t i = (axis + 1) % 3;
+    size_t j = (axis + 2) % 3;
+    out->M[i][i] *= c;
+    out->M[i][j] *= -s;
+    out->M[j][i] *= s;
+    out->M[j][j] *= c;
+}
+
+LINALG_INLINE void mat3d_rotate_assign(mat3d_t *A, rotate_axis_s axis,
+                                       double angle) {
+    const double c = cos(angle);
+    const double s = sin(angle);
+    size_t i = (axis + 1) % 3;
+    size_t j = (axis + 2) % 3;
+    A->M[i][i] *= c;
+    A->M[i][j] *= -s;
+    A->M[j][i] *= s;
+    A->M[j][j] *= c;
+}
+
+LINALG_DEF void mat3d_transform_array(const mat3d_t *M,
+                                      const vec3d_t *restrict in,
+                                      vec3d_t *restrict out, size_t n);
+
+LINALG_INLINE mat3d_t mat3d_transpose(mat3d_t M) {
+    mat3d_t T;
+    T._11 = M._11;
+    T._12 = M._21;
+    T._13 = M._31;
+    T._21 = M._12;
+    T._22 = M._22;
+    T._23 = M._32;
+    T._31 = M._13;
+    T._32 = M._23;
+    T._33 = M._33;
+    return T;
+}
+
+LINALG_INLINE double mat3d_det(mat3d_t M) {
+    return M._11 * (M._22 * M._33 - M._23 * M._32) + M._12 *
+           (M._23 * M._31 - M._21 * M._33) + M._13 *
+               (M._21 * M._32 - M._22 * M._31);
+}
+
+LINALG_INLINE mat3d_t mat3d_inverse(mat3d_t M) {
+    mat3d_t result;
+    const double c11 = (M._22 * M._33 - M._23 * M._32);
+    const double c12 = (M._23 * M._31 - M._21 * M._33);
+    const double c13 = (M._21 * M._32 - M._22 * M._31);
+    const double inv_det = 1 / (M._11 * c11 + M._12 * c12 + M._13 * c13);
+    result._11 = c11 * inv_det;
+    result._21 = c12 * inv_det;
+    result._31 = c13 * inv_det;
+    result._12 = (M._32 * M._13 - M._33 * M._12) * inv_det;
+    result._22 = (M._33 * M._11 - M._31 * M._13) * inv_det;
+    result._32 = (M._31 * M._12 - M._32 * M._11) * inv_det;
+    result._13 = (M._12 * M._23 - M._13 * M._22) * inv_det;
+    result._23 = (M._13 * M._21 - M._11 * M._23) * inv_det;
+    result._33 = (M._11 * M._22 - M._12 * M._21) * inv_det;
+    return result;
+}
+
+LINALG_DEF void mat3d_inverse_array(const mat3d_t *restrict in,
+                                    mat3d_t *restrict out, size_t n);
+
+LINALG_INLINE vec3i_t vec3i_add(vec3i_t a, vec3i_t b) {
     a.x += b.x;
     a.y += b.y;
     a.z += b.z;
     return a;
 }
 
-LINALG_DEF vec3i_t vec3i_sub(vec3i_t a, vec3i_t b) {
+LINALG_INLINE void vec3i_add_to(vec3i_t *restrict out, const vec3i_t *a,
+                                const vec3i_t *b) {
+    out->x = a->x + b->x;
+    out->y = a->y + b->y;
+    out->z = a->z + b->z;
+}
+
+LINALG_INLINE void vec3i_add_assign(vec3i_t *a, vec3i_t b) {
+    a->x += b.x;
+    a->y += b.y;
+    a->z += b.z;
+}
+
+LINALG_INLINE vec3i_t vec3i_sub(vec3i_t a, vec3i_t b) {
     a.x -= b.x;
     a.y -= b.y;
     a.z -= b.z;
     return a;
 }
 
-LINALG_DEF vec3i_t vec3i_mul(vec3i_t a, vec3i_t b) {
+LINALG_INLINE void vec3i_sub_to(vec3i_t *restrict out, const vec3i_t *a,
+                                const vec3i_t *b) {
+    out->x = a->x - b->x;
+    out->y = a->y - b->y;
+    out->z = a->z - b->z;
+}
+
+LINALG_INLINE void vec3i_sub_assign(vec3i_t *a, vec3i_t b) {
+    a->x -= b.x;
+    a->y -= b.y;
+    a->z -= b.z;
+}
+
+LINALG_INLINE vec3i_t vec3i_mul(vec3i_t a, vec3i_t b) {
     a.x *= b.x;
     a.y *= b.y;
     a.z *= b.z;
     return a;
 }
 
-LINALG_DEF vec3i_t vec3i_div(vec3i_t a, vec3i_t b) {
+LINALG_INLINE void vec3i_mul_to(vec3i_t *restrict out, const vec3i_t *a,
+                                const vec3i_t *b) {
+    out->x = a->x * b->x;
+    out->y = a->y * b->y;
+    out->z = a->z * b->z;
+}
+
+LINALG_INLINE void vec3i_mul_assign(vec3i_t *a, vec3i_t b) {
+    a->x *= b.x;
+    a->y *= b.y;
+    a->z *= b.z;
+}
+
+LINALG_INLINE vec3i_t vec3i_div(vec3i_t a, vec3i_t b) {
     a.x /= b.x;
     a.y /= b.y;
     a.z /= b.z;
     return a;
 }
 
-LINALG_DEF vec3i_t vec3i_mod(vec3i_t a, vec3i_t b) {
+LINALG_INLINE void vec3i_div_to(vec3i_t *restrict out, const vec3i_t *a,
+                                const vec3i_t *b) {
+    out->x = a->x / b->x;
+    out->y = a->y / b->y;
+    out->z = a->z / b->z;
+}
+
+LINALG_INLINE void vec3i_div_assign(vec3i_t *a, vec3i_t b) {
+    a->x /= b.x;
+    a->y /= b.y;
+    a->z /= b.z;
+}
+
+LINALG_INLINE vec3i_t vec3i_mod(vec3i_t a, vec3i_t b) {
     a.x %= b.x;
     a.y %= b.y;
     a.z %= b.z;
     return a;
 }
 
-LINALG_DEF vec3i_t vec3i_min(vec3i_t a, vec3i_t b) {
+LINALG_INLINE void vec3i_mod_to(vec3i_t *restrict out, const vec3i_t *a,
+                                const vec3i_t *b) {
+    out->x = a->x % b->x;
+    out->y = a->y % b->y;
+    out->z = a->z % b->z;
+}
+
+LINALG_INLINE void vec3i_mod_assign(vec3i_t *a, vec3i_t b) {
+    a->x %= b.x;
+    a->y %= b.y;
+    a->z %= b.z;
+}
+
+LINALG_INLINE vec3i_t vec3i_min(vec3i_t a, vec3i_t b) {
     a.x = mini(a.x, b.x);
     a.y = mini(a.y, b.y);
     a.z = mini(a.z, b.z);
     return a;
 }
 
-LINALG_DEF vec3i_t vec3i_max(vec3i_t a, vec3i_t b) {
+LINALG_INLINE void vec3i_min_to(vec3i_t *restrict out, const vec3i_t *a,
+                                const vec3i_t *b) {
+    out->x = mini(a->x, b->x);
+    out->y = mini(a->y, b->y);
+    out->z = mini(a->z, b->z);
+}
+
+LINALG_INLINE vec3i_t vec3i_max(vec3i_t a, vec3i_t b) {
     a.x = maxi(a.x, b.x);
     a.y = maxi(a.y, b.y);
     a.z = maxi(a.z, b.z);
     return a;
 }
 
-LINALG_DEF vec3i_t vec3i_clamp(vec3i_t v, vec3i_t min, vec3i_t max) {
+LINALG_INLINE void vec3i_max_to(vec3i_t *restrict out, const vec3i_t *a,
+                                const vec3i_t *b) {
+    out->x = maxi(a->x, b->x);
+    out->y = maxi(a->y, b->y);
+    out->z = maxi(a->z, b->z);
+}
+
+LINALG_INLINE vec3i_t vec3i_clamp(vec3i_t v, vec3i_t min, vec3i_t max) {
     v.x = clampi(v.x, min.x, max.x);
     v.y = clampi(v.y, min.y, max.y);
     v.z = clampi(v.z, min.z, max.z);
     return v;
 }
 
-LINALG_DEF vec3i_t vec3i_abs(vec3i_t v) {
+LINALG_INLINE void vec3i_clamp_to(vec3i_t *restrict out, const vec3i_t *v,
+                                  const vec3i_t *min, const vec3i_t *max) {
+    out->x = clampi(v->x, min->x, max->x);
+    out->y = clampi(v->y, min->y, max->y);
+    out->z = clampi(v->z, min->z, max->z);
+}
+
+LINALG_INLINE vec3i_t vec3i_abs(vec3i_t v) {
     v.x = absi(v.x);
     v.y = absi(v.y);
     v.z = absi(v.z);
     return v;
 }
 
-LINALG_DEF vec3i_t vec3i_sum(size_t n, ...) {
-    va_list args;
-    va_start(args, n);
-    vec3i_t sum = {0};
-    for (size_t i = 0; i < n; ++i) {
-        vec3i_t v = va_arg(args, vec3i_t);
-        sum = vec3i_add(sum, v);
-    }
-    return sum;
+LINALG_INLINE void vec3i_abs_to(vec3i_t *restrict out, const vec3i_t *v) {
+    out->x = absi(v->x);
+    out->y = absi(v->y);
+    out->z = absi(v->z);
 }
 
-LINALG_DEF vec3i_t vec3i_product(size_t n, ...) {
-    va_list args;
-    va_start(args, n);
-    vec3i_t product = vec3i_splat(1);
-    for (size_t i = 0; i < n; ++i) {
-        vec3i_t v = va_arg(args, vec3i_t);
-        product = vec3i_mul(product, v);
-    }
-    return product;
-}
+LINALG_DEF vec3i_t vec3i_sum(size_t n, ...);
+LINALG_DEF vec3i_t vec3i_sum_array(const vec3i_t *xs, size_t n);
+LINALG_DEF vec3i_t vec3i_product(size_t n, ...);
+LINALG_DEF vec3i_t vec3i_product_array(const vec3i_t *xs, size_t n);
 
-LINALG_DEF int vec3i_dot(vec3i_t a, vec3i_t b) {
+LINALG_INLINE int vec3i_dot(vec3i_t a, vec3i_t b) {
     return a.x * b.x + a.y * b.y + a.z * b.z;
 }
 
-LINALG_DEF vec3i_t vec3i_cross(vec3i_t a, vec3i_t b) {
+LINALG_INLINE vec3i_t vec3i_cross(vec3i_t a, vec3i_t b) {
     vec3i_t result = {0};
     result.x = a.y * b.z - a.z * b.y;
-    result.y = a.z * b.x - a.z * b.x;
+    result.y = a.z * b.x - a.x * b.z;
     result.z = a.x * b.y - a.y * b.x;
     return result;
 }
 
-LINALG_DEF int vec3i_sqrlen(vec3i_t v) { return vec3i_dot(v, v); }
+LINALG_INLINE int vec3i_sqrlen(vec3i_t v) { return vec3i_dot(v, v); }
 
-LINALG_DEF int vec3i_1norm(vec3i_t v) {
+LINALG_INLINE int vec3i_1norm(vec3i_t v) {
     v = vec3i_abs(v);
     int norm = 0;
     norm += v.x;
@@ -2007,7 +3610,7 @@ LINALG_DEF int vec3i_1norm(vec3i_t v) {
     return norm;
 }
 
-LINALG_DEF vec3i_t vec3i_reflect(vec3i_t v, vec3i_t n) {
+LINALG_INLINE vec3i_t vec3i_reflect(vec3i_t v, vec3i_t n) {
     vec3i_t result = n;
     result = vec3i_mul(result, vec3i_splat(vec3i_dot(v, n)));
     result = vec3i_mul(result, vec3i_splat(2));
@@ -2015,7 +3618,7 @@ LINALG_DEF vec3i_t vec3i_reflect(vec3i_t v, vec3i_t n) {
     return result;
 }
 
-LINALG_DEF mat3i_t mat3i_mul(mat3i_t A, mat3i_t B) {
+LINALG_INLINE mat3i_t mat3i_mul(mat3i_t A, mat3i_t B) {
     mat3i_t result;
     result._11 = A._11 * B._11 + A._12 * B._21 + A._13 * B._31;
     result._12 = A._11 * B._12 + A._12 * B._22 + A._13 * B._32;
@@ -2029,18 +3632,23 @@ LINALG_DEF mat3i_t mat3i_mul(mat3i_t A, mat3i_t B) {
     return result;
 }
 
-LINALG_DEF mat3i_t mat3i_nmul(size_t n, ...) {
-    va_list args;
-    va_start(args, n);
-    mat3i_t product = mat3i_I();
-    for (size_t i = 0; i < n; ++i) {
-        mat3i_t A = va_arg(args, mat3i_t);
-        product = mat3i_mul(product, A);
-    }
-    return product;
+LINALG_INLINE void mat3i_mul_to(mat3i_t *restrict out, const mat3i_t *A,
+                                const mat3i_t *B) {
+    out->_11 = A->_11 * B->_11 + A->_12 * B->_21 + A->_13 * B->_31;
+    out->_12 = A->_11 * B->_12 + A->_12 * B->_22 + A->_13 * B->_32;
+    out->_13 = A->_11 * B->_13 + A->_12 * B->_23 + A->_13 * B->_33;
+    out->_21 = A->_21 * B->_11 + A->_22 * B->_21 + A->_23 * B->_31;
+    out->_22 = A->_21 * B->_12 + A->_22 * B->_22 + A->_23 * B->_32;
+    out->_23 = A->_21 * B->_13 + A->_22 * B->_23 + A->_23 * B->_33;
+    out->_31 = A->_31 * B->_11 + A->_32 * B->_21 + A->_33 * B->_31;
+    out->_32 = A->_31 * B->_12 + A->_32 * B->_22 + A->_33 * B->_32;
+    out->_33 = A->_31 * B->_13 + A->_32 * B->_23 + A->_33 * B->_33;
 }
 
-LINALG_DEF vec3i_t mat3i_mul_vec(mat3i_t M, vec3i_t v) {
+LINALG_DEF mat3i_t mat3i_nmul(size_t n, ...);
+LINALG_DEF mat3i_t mat3i_mul_chain(const mat3i_t *Ms, size_t n);
+
+LINALG_INLINE vec3i_t mat3i_mul_vec(mat3i_t M, vec3i_t v) {
     vec3i_t result;
     result.x = vec3i_dot(M.v[0], v);
     result.y = vec3i_dot(M.v[1], v);
@@ -2048,106 +3656,219 @@ LINALG_DEF vec3i_t mat3i_mul_vec(mat3i_t M, vec3i_t v) {
     return result;
 }
 
-LINALG_DEF mat3i_t mat3i_hadamard(mat3i_t A, mat3i_t B) {
+LINALG_INLINE void mat3i_mul_vec_to(vec3i_t *restrict out, const mat3i_t *M,
+                                    const vec3i_t *v) {
+    out->x = M->_11 * v->x + M->_12 * v->y + M->_13 * v->z;
+    out->y = M->_21 * v->x + M->_22 * v->y + M->_23 * v->z;
+    out->z = M->_31 * v->x + M->_32 * v->y + M->_33 * v->z;
+}
+
+LINALG_INLINE mat3i_t mat3i_hadamard(mat3i_t A, mat3i_t B) {
     A.e[0] *= B.e[0];
     A.e[1] *= B.e[1];
     A.e[2] *= B.e[2];
+    A.e[3] *= B.e[3];
+    A.e[4] *= B.e[4];
+    A.e[5] *= B.e[5];
+    A.e[6] *= B.e[6];
+    A.e[7] *= B.e[7];
+    A.e[8] *= B.e[8];
     return A;
 }
 
-LINALG_DEF vec3u_t vec3u_add(vec3u_t a, vec3u_t b) {
+LINALG_INLINE void mat3i_hadamard_to(mat3i_t *restrict out, const mat3i_t *A,
+                                     const mat3i_t *B) {
+    out->e[0] = A->e[0] * B->e[0];
+    out->e[1] = A->e[1] * B->e[1];
+    out->e[2] = A->e[2] * B->e[2];
+    out->e[3] = A->e[3] * B->e[3];
+    out->e[4] = A->e[4] * B->e[4];
+    out->e[5] = A->e[5] * B->e[5];
+    out->e[6] = A->e[6] * B->e[6];
+    out->e[7] = A->e[7] * B->e[7];
+    out->e[8] = A->e[8] * B->e[8];
+}
+
+LINALG_DEF void mat3i_transform_array(const mat3i_t *M,
+                                      const vec3i_t *restrict in,
+                                      vec3i_t *restrict out, size_t n);
+
+LINALG_INLINE mat3i_t mat3i_transpose(mat3i_t M) {
+    mat3i_t T;
+    T._11 = M._11;
+    T._12 = M._21;
+    T._13 = M._31;
+    T._21 = M._12;
+    T._22 = M._22;
+    T._23 = M._32;
+    T._31 = M._13;
+    T._32 = M._23;
+    T._33 = M._33;
+    return T;
+}
+
+LINALG_INLINE vec3u_t vec3u_add(vec3u_t a, vec3u_t b) {
     a.x += b.x;
     a.y += b.y;
     a.z += b.z;
     return a;
 }
 
-LINALG_DEF vec3u_t vec3u_sub(vec3u_t a, vec3u_t b) {
-    a.x -= b.x;
-    a.y -= b.y;
-    a.z -= b.z;
+LINALG_INLINE void vec3u_add_to(vec3u_t *restrict out, const vec3u_t *a,
+                                const vec3u_t *b) {
+    out->x = a->x + b->x;
+    out->y = a->y + b->y;
+    out->z = a->z + b->z;
+}
+
+LINALG_INLINE void vec3u_add_assign(vec3u_t *a, vec3u_t b) {
+    a->x += b.x;
+    a->y += b.y;
+    a->z += b.z;
+}
+
+LINALG_INLINE vec3u_t vec3u_sub(vec3u_t a, vec3u_t b) {
+    a.x -= b.x;
+    a.y -= b.y;
+    a.z -= b.z;
     return a;
 }
 
-LINALG_DEF vec3u_t vec3u_mul(vec3u_t a, vec3u_t b) {
+LINALG_INLINE void vec3u_sub_to(vec3u_t *restrict out, const vec3u_t *a,
+                                const vec3u_t *b) {
+    out->x = a->x - b->x;
+    out->y = a->y - b->y;
+    out->z = a->z - b->z;
+}
+
+LINALG_INLINE void vec3u_sub_assign(vec3u_t *a, vec3u_t b) {
+    a->x -= b.x;
+    a->y -= b.y;
+    a->z -= b.z;
+}
+
+LINALG_INLINE vec3u_t vec3u_mul(vec3u_t a, vec3u_t b) {
     a.x *= b.x;
     a.y *= b.y;
     a.z *= b.z;
     return a;
 }
 
-LINALG_DEF vec3u_t vec3u_div(vec3u_t a, vec3u_t b) {
+LINALG_INLINE void vec3u_mul_to(vec3u_t *restrict out, const vec3u_t *a,
+                                const vec3u_t *b) {
+    out->x = a->x * b->x;
+    out->y = a->y * b->y;
+    out->z = a->z * b->z;
+}
+
+LINALG_INLINE void vec3u_mul_assign(vec3u_t *a, vec3u_t b) {
+    a->x *= b.x;
+    a->y *= b.y;
+    a->z *= b.z;
+}
+
+LINALG_INLINE vec3u_t vec3u_div(vec3u_t a, vec3u_t b) {
     a.x /= b.x;
     a.y /= b.y;
     a.z /= b.z;
     return a;
 }
 
-LINALG_DEF vec3u_t vec3u_mod(vec3u_t a, vec3u_t b) {
+LINALG_INLINE void vec3u_div_to(vec3u_t *restrict out, const vec3u_t *a,
+                                const vec3u_t *b) {
+    out->x = a->x / b->x;
+    out->y = a->y / b->y;
+    out->z = a->z / b->z;
+}
+
+LINALG_INLINE void vec3u_div_assign(vec3u_t *a, vec3u_t b) {
+    a->x /= b.x;
+    a->y /= b.y;
+    a->z /= b.z;
+}
+
+LINALG_INLINE vec3u_t vec3u_mod(vec3u_t a, vec3u_t b) {
     a.x %= b.x;
     a.y %= b.y;
     a.z %= b.z;
     return a;
 }
 
-LINALG_DEF vec3u_t vec3u_min(vec3u_t a, vec3u_t b) {
+LINALG_INLINE void vec3u_mod_to(vec3u_t *restrict out, const vec3u_t *a,
+                                const vec3u_t *b) {
+    out->x = a->x % b->x;
+    out->y = a->y % b->y;
+    out->z = a->z % b->z;
+}
+
+LINALG_INLINE void vec3u_mod_assign(vec3u_t *a, vec3u_t b) {
+    a->x %= b.x;
+    a->y %= b.y;
+    a->z %= b.z;
+}
+
+LINALG_INLINE vec3u_t vec3u_min(vec3u_t a, vec3u_t b) {
     a.x = minu(a.x, b.x);
     a.y = minu(a.y, b.y);
     a.z = minu(a.z, b.z);
     return a;
 }
 
-LINALG_DEF vec3u_t vec3u_max(vec3u_t a, vec3u_t b) {
+LINALG_INLINE void vec3u_min_to(vec3u_t *restrict out, const vec3u_t *a,
+                                const vec3u_t *b) {
+    out->x = minu(a->x, b->x);
+    out->y = minu(a->y, b->y);
+    out->z = minu(a->z, b->z);
+}
+
+LINALG_INLINE vec3u_t vec3u_max(vec3u_t a, vec3u_t b) {
     a.x = maxu(a.x, b.x);
     a.y = maxu(a.y, b.y);
     a.z = maxu(a.z, b.z);
     return a;
 }
 
-LINALG_DEF vec3u_t vec3u_clamp(vec3u_t v, vec3u_t min, vec3u_t max) {
+LINALG_INLINE void vec3u_max_to(vec3u_t *restrict out, const vec3u_t *a,
+                                const vec3u_t *b) {
+    out->x = maxu(a->x, b->x);
+    out->y = maxu(a->y, b->y);
+    out->z = maxu(a->z, b->z);
+}
+
+LINALG_INLINE vec3u_t vec3u_clamp(vec3u_t v, vec3u_t min, vec3u_t max) {
     v.x = clampu(v.x, min.x, max.x);
     v.y = clampu(v.y, min.y, max.y);
     v.z = clampu(v.z, min.z, max.z);
     return v;
 }
 
-LINALG_DEF vec3u_t vec3u_sum(size_t n, ...) {
-    va_list args;
-    va_start(args, n);
-    vec3u_t sum = {0};
-    for (size_t i = 0; i < n; ++i) {
-        vec3u_t v = va_arg(args, vec3u_t);
-        sum = vec3u_add(sum, v);
-    }
-    return sum;
+LINALG_INLINE void vec3u_clamp_to(vec3u_t *restrict out, const vec3u_t *v,
+                                  const vec3u_t *min, const vec3u_t *max) {
+    out->x = clampu(v->x, min->x, max->x);
+    out->y = clampu(v->y, min->y, max->y);
+    out->z = clampu(v->z, min->z, max->z);
 }
 
-LINALG_DEF vec3u_t vec3u_product(size_t n, ...) {
-    va_list args;
-    va_start(args, n);
-    vec3u_t product = vec3u_splat(1);
-    for (size_t i = 0; i < n; ++i) {
-        vec3u_t v = va_arg(args, vec3u_t);
-        product = vec3u_mul(product, v);
-    }
-    return product;
-}
+LINALG_DEF vec3u_t vec3u_sum(size_t n, ...);
+LINALG_DEF vec3u_t vec3u_sum_array(const vec3u_t *xs, size_t n);
+LINALG_DEF vec3u_t vec3u_product(size_t n, ...);
+LINALG_DEF vec3u_t vec3u_product_array(const vec3u_t *xs, size_t n);
 
-LINALG_DEF unsigned int vec3u_dot(vec3u_t a, vec3u_t b) {
+LINALG_INLINE unsigned int vec3u_dot(vec3u_t a, vec3u_t b) {
     return a.x * b.x + a.y * b.y + a.z * b.z;
 }
 
-LINALG_DEF vec3u_t vec3u_cross(vec3u_t a, vec3u_t b) {
+LINALG_INLINE vec3u_t vec3u_cross(vec3u_t a, vec3u_t b) {
     vec3u_t result = {0};
     result.x = a.y * b.z - a.z * b.y;
-    result.y = a.z * b.x - a.z * b.x;
+    result.y = a.z * b.x - a.x * b.z;
     result.z = a.x * b.y - a.y * b.x;
     return result;
 }
 
-LINALG_DEF unsigned int vec3u_sqrlen(vec3u_t v) { return vec3u_dot(v, v); }
+LINALG_INLINE unsigned int vec3u_sqrlen(vec3u_t v) { return vec3u_dot(v, v); }
 
-LINALG_DEF unsigned int vec3u_1norm(vec3u_t v) {
+LINALG_INLINE unsigned int vec3u_1norm(vec3u_t v) {
     unsigned int norm = 0;
     norm += v.x;
     norm += v.y;
@@ -2155,7 +3876,7 @@ LINALG_DEF unsigned int vec3u_1norm(vec3u_t v) {
     return norm;
 }
 
-LINALG_DEF vec3u_t vec3u_reflect(vec3u_t v, vec3u_t n) {
+LINALG_INLINE vec3u_t vec3u_reflect(vec3u_t v, vec3u_t n) {
     vec3u_t result = n;
     result = vec3u_mul(result, vec3u_splat(vec3u_dot(v, n)));
     result = vec3u_mul(result, vec3u_splat(2));
@@ -2163,7 +3884,7 @@ LINALG_DEF vec3u_t vec3u_reflect(vec3u_t v, vec3u_t n) {
     return result;
 }
 
-LINALG_DEF mat3u_t mat3u_mul(mat3u_t A, mat3u_t B) {
+LINALG_INLINE mat3u_t mat3u_mul(mat3u_t A, mat3u_t B) {
     mat3u_t result;
     result._11 = A._11 * B._11 + A._12 * B._21 + A._13 * B._31;
     result._12 = A._11 * B._12 + A._12 * B._22 + A._13 * B._32;
@@ -2177,18 +3898,23 @@ LINALG_DEF mat3u_t mat3u_mul(mat3u_t A, mat3u_t B) {
     return result;
 }
 
-LINALG_DEF mat3u_t mat3u_nmul(size_t n, ...) {
-    va_list args;
-    va_start(args, n);
-    mat3u_t product = mat3u_I();
-    for (size_t i = 0; i < n; ++i) {
-        mat3u_t A = va_arg(args, mat3u_t);
-        product = mat3u_mul(product, A);
-    }
-    return product;
+LINALG_INLINE void mat3u_mul_to(mat3u_t *restrict out, const mat3u_t *A,
+                                const mat3u_t *B) {
+    out->_11 = A->_11 * B->_11 + A->_12 * B->_21 + A->_13 * B->_31;
+    out->_12 = A->_11 * B->_12 + A->_12 * B->_22 + A->_13 * B->_32;
+    out->_13 = A->_11 * B->_13 + A->_12 * B->_23 + A->_13 * B->_33;
+    out->_21 = A->_21 * B->_11 + A->_22 * B->_21 + A->_23 * B->_31;
+    out->_22 = A->_21 * B->_12 + A->_22 * B->_22 + A->_23 * B->_32;
+    out->_23 = A->_21 * B->_13 + A->_22 * B->_23 + A->_23 * B->_33;
+    out->_31 = A->_31 * B->_11 + A->_32 * B->_21 + A->_33 * B->_31;
+    out->_32 = A->_31 * B->_12 + A->_32 * B->_22 + A->_33 * B->_32;
+    out->_33 = A->_31 * B->_13 + A->_32 * B->_23 + A->_33 * B->_33;
 }
 
-LINALG_DEF vec3u_t mat3u_mul_vec(mat3u_t M, vec3u_t v) {
+LINALG_DEF mat3u_t mat3u_nmul(size_t n, ...);
+LINALG_DEF mat3u_t mat3u_mul_chain(const mat3u_t *Ms, size_t n);
+
+LINALG_INLINE vec3u_t mat3u_mul_vec(mat3u_t M, vec3u_t v) {
     vec3u_t result;
     result.x = vec3u_dot(M.v[0], v);
     result.y = vec3u_dot(M.v[1], v);
@@ -2196,46 +3922,198 @@ LINALG_DEF vec3u_t mat3u_mul_vec(mat3u_t M, vec3u_t v) {
     return result;
 }
 
-LINALG_DEF mat3u_t mat3u_hadamard(mat3u_t A, mat3u_t B) {
+LINALG_INLINE void mat3u_mul_vec_to(vec3u_t *restrict out, const mat3u_t *M,
+                                    const vec3u_t *v) {
+    out->x = M->_11 * v->x + M->_12 * v->y + M->_13 * v->z;
+    out->y = M->_21 * v->x + M->_22 * v->y + M->_23 * v->z;
+    out->z = M->_31 * v->x + M->_32 * v->y + M->_33 * v->z;
+}
+
+LINALG_INLINE mat3u_t mat3u_hadamard(mat3u_t A, mat3u_t B) {
     A.e[0] *= B.e[0];
     A.e[1] *= B.e[1];
     A.e[2] *= B.e[2];
+    A.e[3] *= B.e[3];
+    A.e[4] *= B.e[4];
+    A.e[5] *= B.e[5];
+    A.e[6] *= B.e[6];
+    A.e[7] *= B.e[7];
+    A.e[8] *= B.e[8];
     return A;
 }
 
-LINALG_DEF vec4f_t vec4f_add(vec4f_t a, vec4f_t b) {
+LINALG_INLINE void mat3u_hadamard_to(mat3u_t *restrict out, const mat3u_t *A,
+                                     const mat3u_t *B) {
+    out->e[0] = A->e[0] * B->e[0];
+    out->e[1] = A->e[1] * B->e[1];
+    out->e[2] = A->e[2] * B->e[2];
+    out->e[3] = A->e[3] * B->e[3];
+    out->e[4] = A->e[4] * B->e[4];
+    out->e[5] = A->e[5] * B->e[5];
+    out->e[6] = A->e[6] * B->e[6];
+    out->e[7] = A->e[7] * B->e[7];
+    out->e[8] = A->e[8] * B->e[8];
+}
+
+LINALG_DEF void mat3u_transform_array(const mat3u_t *M,
+                                      const vec3u_t *restrict in,
+                                      vec3u_t *restrict out, size_t n);
+
+LINALG_INLINE mat3u_t mat3u_transpose(mat3u_t M) {
+    mat3u_t T;
+    T._11 = M._11;
+    T._12 = M._21;
+    T._13 = M._31;
+    T._21 = M._12;
+    T._22 = M._22;
+    T._23 = M._32;
+    T._31 = M._13;
+    T._32 = M._23;
+    T._33 = M._33;
+    return T;
+}
+
+LINALG_INLINE vec4f_t vec4f_add(vec4f_t a, vec4f_t b) {
+#ifdef LINALG_SIMD
+    a.m = _mm_add_ps(a.m, b.m);
+#else
     a.x += b.x;
     a.y += b.y;
     a.z += b.z;
     a.w += b.w;
+#endif // LINALG_SIMD
     return a;
 }
 
-LINALG_DEF vec4f_t vec4f_sub(vec4f_t a, vec4f_t b) {
+LINALG_INLINE void vec4f_add_to(vec4f_t *restrict out, const vec4f_t *a,
+                                const vec4f_t *b) {
+#ifdef LINALG_SIMD
+    out->m = _mm_add_ps(a->m, b->m);
+#else
+    out->x = a->x + b->x;
+    out->y = a->y + b->y;
+    out->z = a->z + b->z;
+    out->w = a->w + b->w;
+#endif // LINALG_SIMD
+}
+
+LINALG_INLINE void vec4f_add_assign(vec4f_t *a, vec4f_t b) {
+#ifdef LINALG_SIMD
+    a->m = _mm_add_ps(a->m, b.m);
+#else
+    a->x += b.x;
+    a->y += b.y;
+    a->z += b.z;
+    a->w += b.w;
+#endif // LINALG_SIMD
+}
+
+LINALG_INLINE vec4f_t vec4f_sub(vec4f_t a, vec4f_t b) {
+#ifdef LINALG_SIMD
+    a.m = _mm_sub_ps(a.m, b.m);
+#else
     a.x -= b.x;
     a.y -= b.y;
     a.z -= b.z;
     a.w -= b.w;
+#endif // LINALG_SIMD
     return a;
 }
 
-LINALG_DEF vec4f_t vec4f_mul(vec4f_t a, vec4f_t b) {
+LINALG_INLINE void vec4f_sub_to(vec4f_t *restrict out, const vec4f_t *a,
+                                const vec4f_t *b) {
+#ifdef LINALG_SIMD
+    out->m = _mm_sub_ps(a->m, b->m);
+#else
+    out->x = a->x - b->x;
+    out->y = a->y - b->y;
+    out->z = a->z - b->z;
+    out->w = a->w - b->w;
+#endif // LINALG_SIMD
+}
+
+LINALG_INLINE void vec4f_sub_assign(vec4f_t *a, vec4f_t b) {
+#ifdef LINALG_SIMD
+    a->m = _mm_sub_ps(a->m, b.m);
+#else
+    a->x -= b.x;
+    a->y -= b.y;
+    a->z -= b.z;
+    a->w -= b.w;
+#endif // LINALG_SIMD
+}
+
+LINALG_INLINE vec4f_t vec4f_mul(vec4f_t a, vec4f_t b) {
+#ifdef LINALG_SIMD
+    a.m = _mm_mul_ps(a.m, b.m);
+#else
     a.x *= b.x;
     a.y *= b.y;
     a.z *= b.z;
     a.w *= b.w;
+#endif // LINALG_SIMD
     return a;
 }
 
-LINALG_DEF vec4f_t vec4f_div(vec4f_t a, vec4f_t b) {
+LINALG_INLINE void vec4f_mul_to(vec4f_t *restrict out, const vec4f_t *a,
+                                const vec4f_t *b) {
+#ifdef LINALG_SIMD
+    out->m = _mm_mul_ps(a->m, b->m);
+#else
+    out->x = a->x * b->x;
+    out->y = a->y * b->y;
+    out->z = a->z * b->z;
+    out->w = a->w * b->w;
+#endif // LINALG_SIMD
+}
+
+LINALG_INLINE void vec4f_mul_assign(vec4f_t *a, vec4f_t b) {
+#ifdef LINALG_SIMD
+    a->m = _mm_mul_ps(a->m, b.m);
+#else
+    a->x *= b.x;
+    a->y *= b.y;
+    a->z *= b.z;
+    a->w *= b.w;
+#endif // LINALG_SIMD
+}
+
+LINALG_INLINE vec4f_t vec4f_div(vec4f_t a, vec4f_t b) {
+#ifdef LINALG_SIMD
+    a.m = _mm_div_ps(a.m, b.m);
+#else
     a.x /= b.x;
     a.y /= b.y;
     a.z /= b.z;
     a.w /= b.w;
+#endif // LINALG_SIMD
     return a;
 }
 
-LINALG_DEF vec4f_t vec4f_mod(vec4f_t a, vec4f_t b) {
+LINALG_INLINE void vec4f_div_to(vec4f_t *restrict out, const vec4f_t *a,
+                                const vec4f_t *b) {
+#ifdef LINALG_SIMD
+    out->m = _mm_div_ps(a->m, b->m);
+#else
+    out->x = a->x / b->x;
+    out->y = a->y / b->y;
+    out->z = a->z / b->z;
+    out->w = a->w / b->w;
+#endif // LINALG_SIMD
+}
+
+LINALG_INLINE void vec4f_div_assign(vec4f_t *a, vec4f_t b) {
+#ifdef LINALG_SIMD
+    a->m = _mm_div_ps(a->m, b.m);
+#else
+    a->x /= b.x;
+    a->y /= b.y;
+    a->z /= b.z;
+    a->w /= b.w;
+#endif // LINALG_SIMD
+}
+
+LINALG_INLINE vec4f_t vec4f_mod(vec4f_t a, vec4f_t b) {
     a.x = fmodf(a.x, b.x);
     a.y = fmodf(a.y, b.y);
     a.z = fmodf(a.z, b.z);
@@ -2243,7 +4121,22 @@ LINALG_DEF vec4f_t vec4f_mod(vec4f_t a, vec4f_t b) {
     return a;
 }
 
-LINALG_DEF vec4f_t vec4f_min(vec4f_t a, vec4f_t b) {
+LINALG_INLINE void vec4f_mod_to(vec4f_t *restrict out, const vec4f_t *a,
+                                const vec4f_t *b) {
+    out->x = fmodf(a->x, b->x);
+    out->y = fmodf(a->y, b->y);
+    out->z = fmodf(a->z, b->z);
+    out->w = fmodf(a->w, b->w);
+}
+
+LINALG_INLINE void vec4f_mod_assign(vec4f_t *a, vec4f_t b) {
+    a->x = fmodf(a->x, b.x);
+    a->y = fmodf(a->y, b.y);
+    a->z = fmodf(a->z, b.z);
+    a->w = fmodf(a->w, b.w);
+}
+
+LINALG_INLINE vec4f_t vec4f_min(vec4f_t a, vec4f_t b) {
     a.x = minf(a.x, b.x);
     a.y = minf(a.y, b.y);
     a.z = minf(a.z, b.z);
@@ -2251,7 +4144,15 @@ LINALG_DEF vec4f_t vec4f_min(vec4f_t a, vec4f_t b) {
     return a;
 }
 
-LINALG_DEF vec4f_t vec4f_max(vec4f_t a, vec4f_t b) {
+LINALG_INLINE void vec4f_min_to(vec4f_t *restrict out, const vec4f_t *a,
+                                const vec4f_t *b) {
+    out->x = minf(a->x, b->x);
+    out->y = minf(a->y, b->y);
+    out->z = minf(a->z, b->z);
+    out->w = minf(a->w, b->w);
+}
+
+LINALG_INLINE vec4f_t vec4f_max(vec4f_t a, vec4f_t b) {
     a.x = maxf(a.x, b.x);
     a.y = maxf(a.y, b.y);
     a.z = maxf(a.z, b.z);
@@ -2259,7 +4160,15 @@ LINALG_DEF vec4f_t vec4f_max(vec4f_t a, vec4f_t b) {
     return a;
 }
 
-LINALG_DEF vec4f_t vec4f_floor(vec4f_t v) {
+LINALG_INLINE void vec4f_max_to(vec4f_t *restrict out, const vec4f_t *a,
+                                const vec4f_t *b) {
+    out->x = maxf(a->x, b->x);
+    out->y = maxf(a->y, b->y);
+    out->z = maxf(a->z, b->z);
+    out->w = maxf(a->w, b->w);
+}
+
+LINALG_INLINE vec4f_t vec4f_floor(vec4f_t v) {
     v.x = floorf(v.x);
     v.y = floorf(v.y);
     v.z = floorf(v.z);
@@ -2267,7 +4176,14 @@ LINALG_DEF vec4f_t vec4f_floor(vec4f_t v) {
     return v;
 }
 
-LINALG_DEF vec4f_t vec4f_ceil(vec4f_t v) {
+LINALG_INLINE void vec4f_floor_to(vec4f_t *restrict out, const vec4f_t *v) {
+    out->x = floorf(v->x);
+    out->y = floorf(v->y);
+    out->z = floorf(v->z);
+    out->w = floorf(v->w);
+}
+
+LINALG_INLINE vec4f_t vec4f_ceil(vec4f_t v) {
     v.x = ceilf(v.x);
     v.y = ceilf(v.y);
     v.z = ceilf(v.z);
@@ -2275,7 +4191,14 @@ LINALG_DEF vec4f_t vec4f_ceil(vec4f_t v) {
     return v;
 }
 
-LINALG_DEF vec4f_t vec4f_clamp(vec4f_t v, vec4f_t min, vec4f_t max) {
+LINALG_INLINE void vec4f_ceil_to(vec4f_t *restrict out, const vec4f_t *v) {
+    out->x = ceilf(v->x);
+    out->y = ceilf(v->y);
+    out->z = ceilf(v->z);
+    out->w = ceilf(v->w);
+}
+
+LINALG_INLINE vec4f_t vec4f_clamp(vec4f_t v, vec4f_t min, vec4f_t max) {
     v.x = clampf(v.x, min.x, max.x);
     v.y = clampf(v.y, min.y, max.y);
     v.z = clampf(v.z, min.z, max.z);
@@ -2283,7 +4206,15 @@ LINALG_DEF vec4f_t vec4f_clamp(vec4f_t v, vec4f_t min, vec4f_t max) {
     return v;
 }
 
-LINALG_DEF vec4f_t vec4f_abs(vec4f_t v) {
+LINALG_INLINE void vec4f_clamp_to(vec4f_t *restrict out, const vec4f_t *v,
+                                  const vec4f_t *min, const vec4f_t *max) {
+    out->x = clampf(v->x, min->x, max->x);
+    out->y = clampf(v->y, min->y, max->y);
+    out->z = clampf(v->z, min->z, max->z);
+    out->w = clampf(v->w, min->w, max->w);
+}
+
+LINALG_INLINE vec4f_t vec4f_abs(vec4f_t v) {
     v.x = fabsf(v.x);
     v.y = fabsf(v.y);
     v.z = fabsf(v.z);
@@ -2291,7 +4222,14 @@ LINALG_DEF vec4f_t vec4f_abs(vec4f_t v) {
     return v;
 }
 
-LINALG_DEF vec4f_t vec4f_lerp(vec4f_t a, vec4f_t b, vec4f_t t) {
+LINALG_INLINE void vec4f_abs_to(vec4f_t *restrict out, const vec4f_t *v) {
+    out->x = fabsf(v->x);
+    out->y = fabsf(v->y);
+    out->z = fabsf(v->z);
+    out->w = fabsf(v->w);
+}
+
+LINALG_INLINE vec4f_t vec4f_lerp(vec4f_t a, vec4f_t b, vec4f_t t) {
     a.x = lerpf(a.x, b.x, t.x);
     a.y = lerpf(a.y, b.y, t.y);
     a.z = lerpf(a.z, b.z, t.z);
@@ -2299,35 +4237,33 @@ LINALG_DEF vec4f_t vec4f_lerp(vec4f_t a, vec4f_t b, vec4f_t t) {
     return a;
 }
 
-LINALG_DEF vec4f_t vec4f_sum(size_t n, ...) {
-    va_list args;
-    va_start(args, n);
-    vec4f_t sum = {0};
-    for (size_t i = 0; i < n; ++i) {
-        vec4f_t v = va_arg(args, vec4f_t);
-        sum = vec4f_add(sum, v);
-    }
-    return sum;
+LINALG_INLINE void vec4f_lerp_to(vec4f_t *restrict out, const vec4f_t *a,
+                                 const vec4f_t *b, const vec4f_t *t) {
+    out->x = lerpf(a->x, b->x, t->x);
+    out->y = lerpf(a->y, b->y, t->y);
+    out->z = lerpf(a->z, b->z, t->z);
+    out->w = lerpf(a->w, b->w, t->w);
 }
 
-LINALG_DEF vec4f_t vec4f_product(size_t n, ...) {
-    va_list args;
-    va_start(args, n);
-    vec4f_t product = vec4f_splat(1);
-    for (size_t i = 0; i < n; ++i) {
-        vec4f_t v = va_arg(args, vec4f_t);
-        product = vec4f_mul(product, v);
-    }
-    return product;
-}
+LINALG_DEF vec4f_t vec4f_sum(size_t n, ...);
+LINALG_DEF vec4f_t vec4f_sum_array(const vec4f_t *xs, size_t n);
+LINALG_DEF vec4f_t vec4f_product(size_t n, ...);
+LINALG_DEF vec4f_t vec4f_product_array(const vec4f_t *xs, size_t n);
 
-LINALG_DEF float vec4f_dot(vec4f_t a, vec4f_t b) {
+LINALG_INLINE float vec4f_dot(vec4f_t a, vec4f_t b) {
+#ifdef LINALG_SIMD
+    __m128 p = _mm_mul_ps(a.m, b.m);
+    p = _mm_add_ps(p, _mm_movehl_ps(p, p));
+    p = _mm_add_ss(p, _mm_shuffle_ps(p, p, 0x55));
+    return _mm_cvtss_f32(p);
+#else
     return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w;
+#endif // LINALG_SIMD
 }
 
-LINALG_DEF float vec4f_sqrlen(vec4f_t v) { return vec4f_dot(v, v); }
+LINALG_INLINE float vec4f_sqrlen(vec4f_t v) { return vec4f_dot(v, v); }
 
-LINALG_DEF float vec4f_1norm(vec4f_t v) {
+LINALG_INLINE float vec4f_1norm(vec4f_t v) {
     v = vec4f_abs(v);
     float norm = 0;
     norm += v.x;
@@ -2337,15 +4273,26 @@ LINALG_DEF float vec4f_1norm(vec4f_t v) {
     return norm;
 }
 
-LINALG_DEF float vec4f_2norm(vec4f_t v) { return sqrtf(vec4f_sqrlen(v)); }
+LINALG_INLINE float vec4f_2norm(vec4f_t v) { return sqrtf(vec4f_sqrlen(v)); }
 
-LINALG_DEF vec4f_t vec4f_unit(vec4f_t v) {
+LINALG_INLINE vec4f_t vec4f_unit(vec4f_t v) {
     return vec4f_div(v, vec4f_splat(vec4f_2norm(v)));
 }
 
-LINALG_DEF vec4f_t vec4f_norm(vec4f_t v) { return vec4f_unit(v); }
+LINALG_INLINE vec4f_t vec4f_norm(vec4f_t v) { return vec4f_unit(v); }
+
+LINALG_INLINE vec4f_t vec4f_unit_fast(vec4f_t v) {
+#ifdef LINALG_SIMD
+    __m128 sq = _mm_mul_ps(v.m, v.m);
+    sq = _mm_add_ps(sq, _mm_shuffle_ps(sq, sq, _MM_SHUFFLE(2, 3, 0, 1)));
+    sq = _mm_add_ps(sq, _mm_shuffle_ps(sq, sq, _MM_SHUFFLE(1, 0, 3, 2)));
+    return (vec4f_t){.m = _mm_mul_ps(v.m, rsqrtf_fast_ps(sq))};
+#else
+    return vec4f_mul(v, vec4f_splat(rsqrtf_fast(vec4f_sqrlen(v))));
+#endif // LINALG_SIMD
+}
 
-LINALG_DEF _Bool vec4f_eq(vec4f_t a, vec4f_t b, float epsilon) {
+LINALG_INLINE _Bool vec4f_eq(vec4f_t a, vec4f_t b, float epsilon) {
     if (fabsf(b.x - a.x) > epsilon) {
         return 0;
     }
@@ -2361,7 +4308,7 @@ LINALG_DEF _Bool vec4f_eq(vec4f_t a, vec4f_t b, float epsilon) {
     return 1;
 }
 
-LINALG_DEF vec4f_t vec4f_reflect(vec4f_t v, vec4f_t n) {
+LINALG_INLINE vec4f_t vec4f_reflect(vec4f_t v, vec4f_t n) {
     vec4f_t result = n;
     result = vec4f_mul(result, vec4f_splat(vec4f_dot(v, n)));
     result = vec4f_mul(result, vec4f_splat(2));
@@ -2369,71 +4316,219 @@ LINALG_DEF vec4f_t vec4f_reflect(vec4f_t v, vec4f_t n) {
     return result;
 }
 
-LINALG_DEF vec4f_t vec4f_direction(vec4f_t a, vec4f_t b) {
+LINALG_INLINE vec4f_t vec4f_direction(vec4f_t a, vec4f_t b) {
     vec4f_t delta = vec4f_sub(b, a);
     return vec4f_unit(delta);
 }
 
-LINALG_DEF mat4f_t mat4f_mul(mat4f_t A, mat4f_t B) {
-    mat4f_t result;
-    result._11 = A._11 * B._11 + A._12 * B._21 + A._13 * B._31 + A._14 * B._41;
-    result._12 = A._11 * B._12 + A._12 * B._22 + A._13 * B._32 + A._14 * B._42;
-    result._13 = A._11 * B._13 + A._12 * B._23 + A._13 * B._33 + A._14 * B._43;
-    result._14 = A._11 * B._14 + A._12 * B._24 + A._13 * B._34 + A._14 * B._44;
-    result._21 = A._21 * B._11 + A._22 * B._21 + A._23 * B._31 + A._24 * B._41;
-    result._22 = A._21 * B._12 + A._22 * B._22 + A._23 * B._32 + A._24 * B._42;
-    result._23 = A._21 * B._13 + A._22 * B._23 + A._23 * B._33 + A._24 * B._43;
-    result._24 = A._21 * B._14 + A._22 * B._24 + A._23 * B._34 + A._24 * B._44;
-    result._31 = A._31 * B._11 + A._32 * B._21 + A._33 * B._31 + A._34 * B._41;
-    result._32 = A._31 * B._12 + A._32 * B._22 + A._33 * B._32 + A._34 * B._42;
-    result._33 = A._31 * B._13 + A._32 * B._23 + A._33 * B._33 + A._34 * B._43;
-    result._34 = A._31 * B._14 + A._32 * B._24 + A._33 * B._34 + A._34 * B._44;
-    result._41 = A._41 * B._11 + A._42 * B._21 + A._43 * B._31 + A._44 * B._41;
-    result._42 = A._41 * B._12 + A._42 * B._22 + A._43 * B._32 + A._44 * B._42;
-    result._43 = A._41 * B._13 + A._42 * B._23 + A._43 * B._33 + A._44 * B._43;
-    result._44 = A._41 * B._14 + A._42 * B._24 + A._43 * B._34 + A._44 * B._44;
-    return result;
-}
-
-LINALG_DEF mat4f_t mat4f_nmul(size_t n, ...) {
-    va_list args;
-    va_start(args, n);
-    mat4f_t product = mat4f_I();
-    for (size_t i = 0; i < n; ++i) {
-        mat4f_t A = va_arg(args, mat4f_t);
-        product = mat4f_mul(product, A);
-    }
-    return product;
-}
+LINALG_DEF mat4f_t mat4f_mul(mat4f_t A, mat4f_t B);
+LINALG_DEF void mat4f_mul_to(mat4f_t *restrict out, const mat4f_t *A,
+                             const mat4f_t *B);
+LINALG_DEF mat4f_t mat4f_nmul(size_t n, ...);
+LINALG_DEF mat4f_t mat4f_mul_chain(const mat4f_t *Ms, size_t n);
 
-LINALG_DEF vec4f_t mat4f_mul_vec(mat4f_t M, vec4f_t v) {
+LINALG_INLINE vec4f_t mat4f_mul_vec(mat4f_t M, vec4f_t v) {
     vec4f_t result;
+#ifdef LINALG_SIMD
+    __m128 p0 = _mm_mul_ps(M.m[0], v.m);
+    __m128 p1 = _mm_mul_ps(M.m[1], v.m);
+    __m128 p2 = _mm_mul_ps(M.m[2], v.m);
+    __m128 p3 = _mm_mul_ps(M.m[3], v.m);
+    _MM_TRANSPOSE4_PS(p0, p1, p2, p3);
+    result.m = _mm_add_ps(_mm_add_ps(p0, p1), _mm_add_ps(p2, p3));
+#else
     result.x = vec4f_dot(M.v[0], v);
     result.y = vec4f_dot(M.v[1], v);
     result.z = vec4f_dot(M.v[2], v);
     result.w = vec4f_dot(M.v[3], v);
+#endif // LINALG_SIMD
     return result;
 }
 
-LINALG_DEF mat4f_t mat4f_hadamard(mat4f_t A, mat4f_t B) {
+LINALG_INLINE void mat4f_mul_vec_to(vec4f_t *restrict out, const mat4f_t *M,
+                                    const vec4f_t *v) {
+#ifdef LINALG_SIMD
+    __m128 p0 = _mm_mul_ps(M->m[0], v->m);
+    __m128 p1 = _mm_mul_ps(M->m[1], v->m);
+    __m128 p2 = _mm_mul_ps(M->m[2], v->m);
+    __m128 p3 = _mm_mul_ps(M->m[3], v->m);
+    _MM_TRANSPOSE4_PS(p0, p1, p2, p3);
+    out->m = _mm_add_ps(_mm_add_ps(p0, p1), _mm_add_ps(p2, p3));
+#else
+    out->x = M->_11 * v->x + M->_12 * v->y + M->_13 * v->z + M->_14 * v->w;
+    out->y = M->_21 * v->x + M->_22 * v->y + M->_23 * v->z + M->_24 * v->w;
+    out->z = M->_31 * v->x + M->_32 * v->y + M->_33 * v->z + M->_34 * v->w;
+    out->w = M->_41 * v->x + M->_42 * v->y + M->_43 * v->z + M->_44 * v->w;
+#endif // LINALG_SIMD
+}
+
+LINALG_INLINE mat4f_t mat4f_hadamard(mat4f_t A, mat4f_t B) {
     A.e[0] *= B.e[0];
     A.e[1] *= B.e[1];
     A.e[2] *= B.e[2];
     A.e[3] *= B.e[3];
+    A.e[4] *= B.e[4];
+    A.e[5] *= B.e[5];
+    A.e[6] *= B.e[6];
+    A.e[7] *= B.e[7];
+    A.e[8] *= B.e[8];
+    A.e[9] *= B.e[9];
+    A.e[10] *= B.e[10];
+    A.e[11] *= B.e[11];
+    A.e[12] *= B.e[12];
+    A.e[13] *= B.e[13];
+    A.e[14] *= B.e[14];
+    A.e[15] *= B.e[15];
+    return A;
+}
+
+LINALG_INLINE void mat4f_hadamard_to(mat4f_t *restrict out, const mat4f_t *A,
+                                     const mat4f_t *B) {
+    out->e[0] = A->e[0] * B->e[0];
+    out->e[1] = A->e[1] * B->e[1];
+    out->e[2] = A->e[2] * B->e[2];
+    out->e[3] = A->e[3] * B->e[3];
+    out->e[4] = A->e[4] * B->e[4];
+    out->e[5] = A->e[5] * B->e[5];
+    out->e[6] = A->e[6] * B->e[6];
+    out->e[7] = A->e[7] * B->e[7];
+    out->e[8] = A->e[8] * B->e[8];
+    out->e[9] = A->e[9] * B->e[9];
+    out->e[10] = A->e[10] * B->e[10];
+    out->e[11] = A->e[11] * B->e[11];
+    out->e[12] = A->e[12] * B->e[12];
+    out->e[13] = A->e[13] * B->e[13];
+    out->e[14] = A->e[14] * B->e[14];
+    out->e[15] = A->e[15] * B->e[15];
+}
+
+LINALG_INLINE mat4f_t mat4f_rotate(mat4f_t A, rotate_axis_s axis, float angle) {
+    const float c = cosf(angle);
+    const float s = sinf(angle);
+    size_t i = (axis + 1) % 3;
+    size_t j = (axis + 2) % 3;
+    A.M[i][i] *= c;
+    A.M[i][j] *= -s;
+    A.M[j][i] *= s;
+    A.M[j][j] *= c;
     return A;
 }
 
-LINALG_DEF mat4f_t mat4f_rotate(mat4f_t A, rotate_axis_s axis, float angle) {
+LINALG_INLINE mat4f_t mat4f_rotate_fast(mat4f_t A, rotate_axis_s axis,
+                                        float angle) {
+    float c, s;
+    sincosf_fast(angle, &s, &c);
     size_t i = (axis + 1) % 3;
     size_t j = (axis + 2) % 3;
-    A.M[i][i] *= cosf(angle);
-    A.M[i][j] *= -sinf(angle);
-    A.M[j][i] *= sinf(angle);
-    A.M[j][j] *= cosf(angle);
+    A.M[i][i] *= c;
+    A.M[i][j] *= -s;
+    A.M[j][i] *= s;
+    A.M[j][j] *= c;
     return A;
 }
 
-LINALG_DEF vec4d_t vec4d_add(vec4d_t a, vec4d_t b) {
+LINALG_INLINE void mat4f_rotate_to(mat4f_t *restrict out, const mat4f_t *A,
+                                   rotate_axis_s axis, float angle) {
+    const float c = cosf(angle);
+    const float s = sinf(angle);
+    *out = *A;
+    size_t i = (axis + 1) % 3;
+    size_t j = (axis + 2) % 3;
+    out->M[i][i] *= c;
+    out->M[i][j] *= -s;
+    out->M[j][i] *= s;
+    out->M[j][j] *= c;
+}
+
+LINALG_INLINE void mat4f_rotate_fast_to(mat4f_t *restrict out, const mat4f_t *A,
+                                        rotate_axis_s axis, float angle) {
+    float c, s;
+    sincosf_fast(angle, &s, &c);
+    *out = *A;
+    size_t i = (axis + 1) % 3;
+    size_t j = (axis + 2) % 3;
+    out->M[i][i] *= c;
+    out->M[i][j] *= -s;
+    out->M[j][i] *= s;
+    out->M[j][j] *= c;
+}
+
+LINALG_INLINE void mat4f_rotate_assign(mat4f_t *A, rotate_axis_s axis,
+                                       float angle) {
+    const float c = cosf(angle);
+    const float s = sinf(angle);
+    size_t i = (axis + 1) % 3;
+    size_t j = (axis + 2) % 3;
+    A->M[i][i] *= c;
+    A->M[i][j] *= -s;
+    A->M[j][i] *= s;
+    A->M[j][j] *= c;
+}
+
+LINALG_INLINE void mat4f_rotate_fast_assign(mat4f_t *A, rotate_axis_s axis,
+                                            float angle) {
+    float c, s;
+    sincosf_fast(angle, &s, &c);
+    size_t i = (axis + 1) % 3;
+    size_t j = (axis + 2) % 3;
+    A->M[i][i] *= c;
+    A->M[i][j] *= -s;
+    A->M[j][i] *= s;
+    A->M[j][j] *= c;
+}
+
+LINALG_DEF void mat4f_transform_array(const mat4f_t *M,
+                                      const vec4f_t *restrict in,
+                                      vec4f_t *restrict out, size_t n);
+LINALG_DEF mat4f_t mat4f_transpose(mat4f_t M);
+
+LINALG_INLINE float mat4f_det(mat4f_t M) {
+    const float s0 = M._11 * M._22 - M._21 * M._12;
+    const float s1 = M._11 * M._23 - M._21 * M._13;
+    const float s2 = M._11 * M._24 - M._21 * M._14;
+    const float s3 = M._12 * M._23 - M._22 * M._13;
+    const float s4 = M._12 * M._24 - M._22 * M._14;
+    const float s5 = M._13 * M._24 - M._23 * M._14;
+    const float c0 = M._31 * M._42 - M._41 * M._32;
+    const float c1 = M._31 * M._43 - M._41 * M._33;
+    const float c2 = M._31 * M._44 - M._41 * M._34;
+    const float c3 = M._32 * M._43 - M._42 * M._33;
+    const float c4 = M._32 * M._44 - M._42 * M._34;
+    const float c5 = M._33 * M._44 - M._43 * M._34;
+    return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+}
+
+#ifdef LINALG_SIMD
+LINALG_INLINE __m128 linalg_mat2_mul_ps(__m128 A, __m128 B) {
+    const __m128 A_1032 = _mm_shuffle_ps(A, A, _MM_SHUFFLE(2, 3, 0, 1));
+    const __m128 B_0303 = _mm_shuffle_ps(B, B, _MM_SHUFFLE(3, 0, 3, 0));
+    const __m128 B_2121 = _mm_shuffle_ps(B, B, _MM_SHUFFLE(1, 2, 1, 2));
+    return _mm_add_ps(_mm_mul_ps(A, B_0303), _mm_mul_ps(A_1032, B_2121));
+}
+
+LINALG_INLINE __m128 linalg_mat2_adj_mul_ps(__m128 A, __m128 B) {
+    const __m128 A_3300 = _mm_shuffle_ps(A, A, _MM_SHUFFLE(0, 0, 3, 3));
+    const __m128 A_1122 = _mm_shuffle_ps(A, A, _MM_SHUFFLE(2, 2, 1, 1));
+    const __m128 B_2301 = _mm_shuffle_ps(B, B, _MM_SHUFFLE(1, 0, 3, 2));
+    return _mm_sub_ps(_mm_mul_ps(A_3300, B), _mm_mul_ps(A_1122, B_2301));
+}
+
+LINALG_INLINE __m128 linalg_mat2_mul_adj_ps(__m128 A, __m128 B) {
+    const __m128 A_1032 = _mm_shuffle_ps(A, A, _MM_SHUFFLE(2, 3, 0, 1));
+    const __m128 B_3030 = _mm_shuffle_ps(B, B, _MM_SHUFFLE(0, 3, 0, 3));
+    const __m128 B_2121 = _mm_shuffle_ps(B, B, _MM_SHUFFLE(1, 2, 1, 2));
+    return _mm_sub_ps(_mm_mul_ps(A, B_3030), _mm_mul_ps(A_1032, B_2121));
+}
+#endif // LINALG_SIMD
+
+LINALG_DEF mat4f_t mat4f_inverse(mat4f_t M);
+LINALG_DEF mat4f_t mat4f_inverse_affine(mat4f_t M);
+LINALG_DEF void mat4f_inverse_array(const mat4f_t *restrict in,
+                                    mat4f_t *restrict out, size_t n);
+LINALG_DEF void mat4f_inverse_affine_array(const mat4f_t *restrict in,
+                                           mat4f_t *restrict out, size_t n);
+
+LINALG_INLINE vec4d_t vec4d_add(vec4d_t a, vec4d_t b) {
     a.x += b.x;
     a.y += b.y;
     a.z += b.z;
@@ -2441,7 +4536,22 @@ LINALG_DEF vec4d_t vec4d_add(vec4d_t a, vec4d_t b) {
     return a;
 }
 
-LINALG_DEF vec4d_t vec4d_sub(vec4d_t a, vec4d_t b) {
+LINALG_INLINE void vec4d_add_to(vec4d_t *restrict out, const vec4d_t *a,
+                                const vec4d_t *b) {
+    out->x = a->x + b->x;
+    out->y = a->y + b->y;
+    out->z = a->z + b->z;
+    out->w = a->w + b->w;
+}
+
+LINALG_INLINE void vec4d_add_assign(vec4d_t *a, vec4d_t b) {
+    a->x += b.x;
+    a->y += b.y;
+    a->z += b.z;
+    a->w += b.w;
+}
+
+LINALG_INLINE vec4d_t vec4d_sub(vec4d_t a, vec4d_t b) {
     a.x -= b.x;
     a.y -= b.y;
     a.z -= b.z;
@@ -2449,7 +4559,22 @@ LINALG_DEF vec4d_t vec4d_sub(vec4d_t a, vec4d_t b) {
     return a;
 }
 
-LINALG_DEF vec4d_t vec4d_mul(vec4d_t a, vec4d_t b) {
+LINALG_INLINE void vec4d_sub_to(vec4d_t *restrict out, const vec4d_t *a,
+                                const vec4d_t *b) {
+    out->x = a->x - b->x;
+    out->y = a->y - b->y;
+    out->z = a->z - b->z;
+    out->w = a->w - b->w;
+}
+
+LINALG_INLINE void vec4d_sub_assign(vec4d_t *a, vec4d_t b) {
+    a->x -= b.x;
+    a->y -= b.y;
+    a->z -= b.z;
+    a->w -= b.w;
+}
+
+LINALG_INLINE vec4d_t vec4d_mul(vec4d_t a, vec4d_t b) {
     a.x *= b.x;
     a.y *= b.y;
     a.z *= b.z;
@@ -2457,7 +4582,22 @@ LINALG_DEF vec4d_t vec4d_mul(vec4d_t a, vec4d_t b) {
     return a;
 }
 
-LINALG_DEF vec4d_t vec4d_div(vec4d_t a, vec4d_t b) {
+LINALG_INLINE void vec4d_mul_to(vec4d_t *restrict out, const vec4d_t *a,
+                                const vec4d_t *b) {
+    out->x = a->x * b->x;
+    out->y = a->y * b->y;
+    out->z = a->z * b->z;
+    out->w = a->w * b->w;
+}
+
+LINALG_INLINE void vec4d_mul_assign(vec4d_t *a, vec4d_t b) {
+    a->x *= b.x;
+    a->y *= b.y;
+    a->z *= b.z;
+    a->w *= b.w;
+}
+
+LINALG_INLINE vec4d_t vec4d_div(vec4d_t a, vec4d_t b) {
     a.x /= b.x;
     a.y /= b.y;
     a.z /= b.z;
@@ -2465,7 +4605,22 @@ LINALG_DEF vec4d_t vec4d_div(vec4d_t a, vec4d_t b) {
     return a;
 }
 
-LINALG_DEF vec4d_t vec4d_mod(vec4d_t a, vec4d_t b) {
+LINALG_INLINE void vec4d_div_to(vec4d_t *restrict out, const vec4d_t *a,
+                                const vec4d_t *b) {
+    out->x = a->x / b->x;
+    out->y = a->y / b->y;
+    out->z = a->z / b->z;
+    out->w = a->w / b->w;
+}
+
+LINALG_INLINE void vec4d_div_assign(vec4d_t *a, vec4d_t b) {
+    a->x /= b.x;
+    a->y /= b.y;
+    a->z /= b.z;
+    a->w /= b.w;
+}
+
+LINALG_INLINE vec4d_t vec4d_mod(vec4d_t a, vec4d_t b) {
     a.x = fmod(a.x, b.x);
     a.y = fmod(a.y, b.y);
     a.z = fmod(a.z, b.z);
@@ -2473,7 +4628,22 @@ LINALG_DEF vec4d_t vec4d_mod(vec4d_t a, vec4d_t b) {
     return a;
 }
 
-LINALG_DEF vec4d_t vec4d_min(vec4d_t a, vec4d_t b) {
+LINALG_INLINE void vec4d_mod_to(vec4d_t *restrict out, const vec4d_t *a,
+                                const vec4d_t *b) {
+    out->x = fmod(a->x, b->x);
+    out->y = fmod(a->y, b->y);
+    out->z = fmod(a->z, b->z);
+    out->w = fmod(a->w, b->w);
+}
+
+LINALG_INLINE void vec4d_mod_assign(vec4d_t *a, vec4d_t b) {
+    a->x = fmod(a->x, b.x);
+    a->y = fmod(a->y, b.y);
+    a->z = fmod(a->z, b.z);
+    a->w = fmod(a->w, b.w);
+}
+
+LINALG_INLINE vec4d_t vec4d_min(vec4d_t a, vec4d_t b) {
     a.x = mind(a.x, b.x);
     a.y = mind(a.y, b.y);
     a.z = mind(a.z, b.z);
@@ -2481,7 +4651,15 @@ LINALG_DEF vec4d_t vec4d_min(vec4d_t a, vec4d_t b) {
     return a;
 }
 
-LINALG_DEF vec4d_t vec4d_max(vec4d_t a, vec4d_t b) {
+LINALG_INLINE void vec4d_min_to(vec4d_t *restrict out, const vec4d_t *a,
+                                const vec4d_t *b) {
+    out->x = mind(a->x, b->x);
+    out->y = mind(a->y, b->y);
+    out->z = mind(a->z, b->z);
+    out->w = mind(a->w, b->w);
+}
+
+LINALG_INLINE vec4d_t vec4d_max(vec4d_t a, vec4d_t b) {
     a.x = maxd(a.x, b.x);
     a.y = maxd(a.y, b.y);
     a.z = maxd(a.z, b.z);
@@ -2489,7 +4667,15 @@ LINALG_DEF vec4d_t vec4d_max(vec4d_t a, vec4d_t b) {
     return a;
 }
 
-LINALG_DEF vec4d_t vec4d_floor(vec4d_t v) {
+LINALG_INLINE void vec4d_max_to(vec4d_t *restrict out, const vec4d_t *a,
+                                const vec4d_t *b) {
+    out->x = maxd(a->x, b->x);
+    out->y = maxd(a->y, b->y);
+    out->z = maxd(a->z, b->z);
+    out->w = maxd(a->w, b->w);
+}
+
+LINALG_INLINE vec4d_t vec4d_floor(vec4d_t v) {
     v.x = floor(v.x);
     v.y = floor(v.y);
     v.z = floor(v.z);
@@ -2497,7 +4683,14 @@ LINALG_DEF vec4d_t vec4d_floor(vec4d_t v) {
     return v;
 }
 
-LINALG_DEF vec4d_t vec4d_ceil(vec4d_t v) {
+LINALG_INLINE void vec4d_floor_to(vec4d_t *restrict out, const vec4d_t *v) {
+    out->x = floor(v->x);
+    out->y = floor(v->y);
+    out->z = floor(v->z);
+    out->w = floor(v->w);
+}
+
+LINALG_INLINE vec4d_t vec4d_ceil(vec4d_t v) {
     v.x = ceil(v.x);
     v.y = ceil(v.y);
     v.z = ceil(v.z);
@@ -2505,7 +4698,14 @@ LINALG_DEF vec4d_t vec4d_ceil(vec4d_t v) {
     return v;
 }
 
-LINALG_DEF vec4d_t vec4d_clamp(vec4d_t v, vec4d_t min, vec4d_t max) {
+LINALG_INLINE void vec4d_ceil_to(vec4d_t *restrict out, const vec4d_t *v) {
+    out->x = ceil(v->x);
+    out->y = ceil(v->y);
+    out->z = ceil(v->z);
+    out->w = ceil(v->w);
+}
+
+LINALG_INLINE vec4d_t vec4d_clamp(vec4d_t v, vec4d_t min, vec4d_t max) {
     v.x = clampd(v.x, min.x, max.x);
     v.y = clampd(v.y, min.y, max.y);
     v.z = clampd(v.z, min.z, max.z);
@@ -2513,7 +4713,15 @@ LINALG_DEF vec4d_t vec4d_clamp(vec4d_t v, vec4d_t min, vec4d_t max) {
     return v;
 }
 
-LINALG_DEF vec4d_t vec4d_abs(vec4d_t v) {
+LINALG_INLINE void vec4d_clamp_to(vec4d_t *restrict out, const vec4d_t *v,
+                                  const vec4d_t *min, const vec4d_t *max) {
+    out->x = clampd(v->x, min->x, max->x);
+    out->y = clampd(v->y, min->y, max->y);
+    out->z = clampd(v->z, min->z, max->z);
+    out->w = clampd(v->w, min->w, max->w);
+}
+
+LINALG_INLINE vec4d_t vec4d_abs(vec4d_t v) {
     v.x = fabs(v.x);
     v.y = fabs(v.y);
     v.z = fabs(v.z);
@@ -2521,7 +4729,14 @@ LINALG_DEF vec4d_t vec4d_abs(vec4d_t v) {
     return v;
 }
 
-LINALG_DEF vec4d_t vec4d_lerp(vec4d_t a, vec4d_t b, vec4d_t t) {
+LINALG_INLINE void vec4d_abs_to(vec4d_t *restrict out, const vec4d_t *v) {
+    out->x = fabs(v->x);
+    out->y = fabs(v->y);
+    out->z = fabs(v->z);
+    out->w = fabs(v->w);
+}
+
+LINALG_INLINE vec4d_t vec4d_lerp(vec4d_t a, vec4d_t b, vec4d_t t) {
     a.x = lerpd(a.x, b.x, t.x);
     a.y = lerpd(a.y, b.y, t.y);
     a.z = lerpd(a.z, b.z, t.z);
@@ -2529,35 +4744,26 @@ LINALG_DEF vec4d_t vec4d_lerp(vec4d_t a, vec4d_t b, vec4d_t t) {
     return a;
 }
 
-LINALG_DEF vec4d_t vec4d_sum(size_t n, ...) {
-    va_list args;
-    va_start(args, n);
-    vec4d_t sum = {0};
-    for (size_t i = 0; i < n; ++i) {
-        vec4d_t v = va_arg(args, vec4d_t);
-        sum = vec4d_add(sum, v);
-    }
-    return sum;
+LINALG_INLINE void vec4d_lerp_to(vec4d_t *restrict out, const vec4d_t *a,
+                                 const vec4d_t *b, const vec4d_t *t) {
+    out->x = lerpd(a->x, b->x, t->x);
+    out->y = lerpd(a->y, b->y, t->y);
+    out->z = lerpd(a->z, b->z, t->z);
+    out->w = lerpd(a->w, b->w, t->w);
 }
 
-LINALG_DEF vec4d_t vec4d_product(size_t n, ...) {
-    va_list args;
-    va_start(args, n);
-    vec4d_t product = vec4d_splat(1);
-    for (size_t i = 0; i < n; ++i) {
-        vec4d_t v = va_arg(args, vec4d_t);
-        product = vec4d_mul(product, v);
-    }
-    return product;
-}
+LINALG_DEF vec4d_t vec4d_sum(size_t n, ...);
+LINALG_DEF vec4d_t vec4d_sum_array(const vec4d_t *xs, size_t n);
+LINALG_DEF vec4d_t vec4d_product(size_t n, ...);
+LINALG_DEF vec4d_t vec4d_product_array(const vec4d_t *xs, size_t n);
 
-LINALG_DEF double vec4d_dot(vec4d_t a, vec4d_t b) {
+LINALG_INLINE double vec4d_dot(vec4d_t a, vec4d_t b) {
     return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w;
 }
 
-LINALG_DEF double vec4d_sqrlen(vec4d_t v) { return vec4d_dot(v, v); }
+LINALG_INLINE double vec4d_sqrlen(vec4d_t v) { return vec4d_dot(v, v); }
 
-LINALG_DEF double vec4d_1norm(vec4d_t v) {
+LINALG_INLINE double vec4d_1norm(vec4d_t v) {
     v = vec4d_abs(v);
     double norm = 0;
     norm += v.x;
@@ -2567,15 +4773,15 @@ LINALG_DEF double vec4d_1norm(vec4d_t v) {
     return norm;
 }
 
-LINALG_DEF double vec4d_2norm(vec4d_t v) { return sqrt(vec4d_sqrlen(v)); }
+LINALG_INLINE double vec4d_2norm(vec4d_t v) { return sqrt(vec4d_sqrlen(v)); }
 
-LINALG_DEF vec4d_t vec4d_unit(vec4d_t v) {
+LINALG_INLINE vec4d_t vec4d_unit(vec4d_t v) {
     return vec4d_div(v, vec4d_splat(vec4d_2norm(v)));
 }
 
-LINALG_DEF vec4d_t vec4d_norm(vec4d_t v) { return vec4d_unit(v); }
+LINALG_INLINE vec4d_t vec4d_norm(vec4d_t v) { return vec4d_unit(v); }
 
-LINALG_DEF _Bool vec4d_eq(vec4d_t a, vec4d_t b, double epsilon) {
+LINALG_INLINE _Bool vec4d_eq(vec4d_t a, vec4d_t b, double epsilon) {
     if (fabs(b.x - a.x) > epsilon) {
         return 0;
     }
@@ -2591,7 +4797,7 @@ LINALG_DEF _Bool vec4d_eq(vec4d_t a, vec4d_t b, double epsilon) {
     return 1;
 }
 
-LINALG_DEF vec4d_t vec4d_reflect(vec4d_t v, vec4d_t n) {
+LINALG_INLINE vec4d_t vec4d_reflect(vec4d_t v, vec4d_t n) {
     vec4d_t result = n;
     result = vec4d_mul(result, vec4d_splat(vec4d_dot(v, n)));
     result = vec4d_mul(result, vec4d_splat(2));
@@ -2599,12 +4805,12 @@ LINALG_DEF vec4d_t vec4d_reflect(vec4d_t v, vec4d_t n) {
     return result;
 }
 
-LINALG_DEF vec4d_t vec4d_direction(vec4d_t a, vec4d_t b) {
+LINALG_INLINE vec4d_t vec4d_direction(vec4d_t a, vec4d_t b) {
     vec4d_t delta = vec4d_sub(b, a);
     return vec4d_unit(delta);
 }
 
-LINALG_DEF mat4d_t mat4d_mul(mat4d_t A, mat4d_t B) {
+LINALG_INLINE mat4d_t mat4d_mul(mat4d_t A, mat4d_t B) {
     mat4d_t result;
     result._11 = A._11 * B._11 + A._12 * B._21 + A._13 * B._31 + A._14 * B._41;
     result._12 = A._11 * B._12 + A._12 * B._22 + A._13 * B._32 + A._14 * B._42;
@@ -2625,18 +4831,46 @@ LINALG_DEF mat4d_t mat4d_mul(mat4d_t A, mat4d_t B) {
     return result;
 }
 
-LINALG_DEF mat4d_t mat4d_nmul(size_t n, ...) {
-    va_list args;
-    va_start(args, n);
-    mat4d_t product = mat4d_I();
-    for (size_t i = 0; i < n; ++i) {
-        mat4d_t A = va_arg(args, mat4d_t);
-        product = mat4d_mul(product, A);
-    }
-    return product;
-}
-
-LINALG_DEF vec4d_t mat4d_mul_vec(mat4d_t M, vec4d_t v) {
+LINALG_INLINE void mat4d_mul_to(mat4d_t *restrict out, const mat4d_t *A,
+                                const mat4d_t *B) {
+    out->_11 = A->_11 * B->_11 + A->_12 * B->_21 + A->_13 * B->_31 + A->_14 *
+               B->_41;
+    out->_12 = A->_11 * B->_12 + A->_12 * B->_22 + A->_13 * B->_32 + A->_14 *
+               B->_42;
+    out->_13 = A->_11 * B->_13 + A->_12 * B->_23 + A->_13 * B->_33 + A->_14 *
+               B->_43;
+    out->_14 = A->_11 * B->_14 + A->_12 * B->_24 + A->_13 * B->_34 + A->_14 *
+               B->_44;
+    out->_21 = A->_21 * B->_11 + A->_22 * B->_21 + A->_23 * B->_31 + A->_24 *
+               B->_41;
+    out->_22 = A->_21 * B->_12 + A->_22 * B->_22 + A->_23 * B->_32 + A->_24 *
+               B->_42;
+    out->_23 = A->_21 * B->_13 + A->_22 * B->_23 + A->_23 * B->_33 + A->_24 *
+               B->_43;
+    out->_24 = A->_21 * B->_14 + A->_22 * B->_24 + A->_23 * B->_34 + A->_24 *
+               B->_44;
+    out->_31 = A->_31 * B->_11 + A->_32 * B->_21 + A->_33 * B->_31 + A->_34 *
+               B->_41;
+    out->_32 = A->_31 * B->_12 + A->_32 * B->_22 + A->_33 * B->_32 + A->_34 *
+               B->_42;
+    out->_33 = A->_31 * B->_13 + A->_32 * B->_23 + A->_33 * B->_33 + A->_34 *
+               B->_43;
+    out->_34 = A->_31 * B->_14 + A->_32 * B->_24 + A->_33 * B->_34 + A->_34 *
+               B->_44;
+    out->_41 = A->_41 * B->_11 + A->_42 * B->_21 + A->_43 * B->_31 + A->_44 *
+               B->_41;
+    out->_42 = A->_41 * B->_12 + A->_42 * B->_22 + A->_43 * B->_32 + A->_44 *
+               B->_42;
+    out->_43 = A->_41 * B->_13 + A->_42 * B->_23 + A->_43 * B->_33 + A->_44 *
+               B->_43;
+    out->_44 = A->_41 * B->_14 + A->_42 * B->_24 + A->_43 * B->_34 + A->_44 *
+               B->_44;
+}
+
+LINALG_DEF mat4d_t mat4d_nmul(size_t n, ...);
+LINALG_DEF mat4d_t mat4d_mul_chain(const mat4d_t *Ms, size_t n);
+
+LINALG_INLINE vec4d_t mat4d_mul_vec(mat4d_t M, vec4d_t v) {
     vec4d_t result;
     result.x = vec4d_dot(M.v[0], v);
     result.y = vec4d_dot(M.v[1], v);
@@ -2645,25 +4879,160 @@ LINALG_DEF vec4d_t mat4d_mul_vec(mat4d_t M, vec4d_t v) {
     return result;
 }
 
-LINALG_DEF mat4d_t mat4d_hadamard(mat4d_t A, mat4d_t B) {
+LINALG_INLINE void mat4d_mul_vec_to(vec4d_t *restrict out, const mat4d_t *M,
+                                    const vec4d_t *v) {
+    out->x = M->_11 * v->x + M->_12 * v->y + M->_13 * v->z + M->_14 * v->w;
+    out->y = M->_21 * v->x + M->_22 * v->y + M->_23 * v->z + M->_24 * v->w;
+    out->z = M->_31 * v->x + M->_32 * v->y + M->_33 * v->z + M->_34 * v->w;
+    out->w = M->_41 * v->x + M->_42 * v->y + M->_43 * v->z + M->_44 * v->w;
+}
+
+LINALG_INLINE mat4d_t mat4d_hadamard(mat4d_t A, mat4d_t B) {
     A.e[0] *= B.e[0];
     A.e[1] *= B.e[1];
     A.e[2] *= B.e[2];
     A.e[3] *= B.e[3];
+    A.e[4] *= B.e[4];
+    A.e[5] *= B.e[5];
+    A.e[6] *= B.e[6];
+    A.e[7] *= B.e[7];
+    A.e[8] *= B.e[8];
+    A.e[9] *= B.e[9];
+    A.e[10] *= B.e[10];
+    A.e[11] *= B.e[11];
+    A.e[12] *= B.e[12];
+    A.e[13] *= B.e[13];
+    A.e[14] *= B.e[14];
+    A.e[15] *= B.e[15];
     return A;
 }
 
-LINALG_DEF mat4d_t mat4d_rotate(mat4d_t A, rotate_axis_s axis, double angle) {
+LINALG_INLINE void mat4d_hadamard_to(mat4d_t *restrict out, const mat4d_t *A,
+                                     const mat4d_t *B) {
+    out->e[0] = A->e[0] * B->e[0];
+    out->e[1] = A->e[1] * B->e[1];
+    out->e[2] = A->e[2] * B->e[2];
+    out->e[3] = A->e[3] * B->e[3];
+    out->e[4] = A->e[4] * B->e[4];
+    out->e[5] = A->e[5] * B->e[5];
+    out->e[6] = A->e[6] * B->e[6];
+    out->e[7] = A->e[7] * B->e[7];
+    out->e[8] = A->e[8] * B->e[8];
+    out->e[9] = A->e[9] * B->e[9];
+    out->e[10] = A->e[10] * B->e[10];
+    out->e[11] = A->e[11] * B->e[11];
+    out->e[12] = A->e[12] * B->e[12];
+    out->e[13] = A->e[13] * B->e[13];
+    out->e[14] = A->e[14] * B->e[14];
+    out->e[15] = A->e[15] * B->e[15];
+}
+
+LINALG_INLINE mat4d_t mat4d_rotate(mat4d_t A, rotate_axis_s axis,
+                                   double angle) {
+    const double c = cos(angle);
+    const double s = sin(angle);
     size_t i = (axis + 1) % 3;
     size_t j = (axis + 2) % 3;
-    A.M[i][i] *= cos(angle);
-    A.M[i][j] *= -sin(angle);
-    A.M[j][i] *= sin(angle);
-    A.M[j][j] *= cos(angle);
+    A.M[i][i] *= c;
+    A.M[i][j] *= -s;
+    A.M[j][i] *= s;
+    A.M[j][j] *= c;
     return A;
 }
 
-LINALG_DEF vec4i_t vec4i_add(vec4i_t a, vec4i_t b) {
+LINALG_INLINE void mat4d_rotate_to(mat4d_t *restrict out, const mat4d_t *A,
+                                   rotate_axis_s axis, double angle) {
+    const double c = cos(angle);
+    const double s = sin(angle);
+    *out = *A;
+    size_t i = (axis + 1) % 3;
+    size_t j = (axis + 2) % 3;
+    out->M[i][i] *= c;
+    out->M[i][j] *= -s;
+    out->M[j][i] *= s;
+    out->M[j][j] *= c;
+}
+
+LINALG_INLINE void mat4d_rotate_assign(mat4d_t *A, rotate_axis_s axis,
+                                       double angle) {
+    const double c = cos(angle);
+    const double s = sin(angle);
+    size_t i = (axis + 1) % 3;
+    size_t j = (axis + 2) % 3;
+    A->M[i][i] *= c;
+    A->M[i][j] *= -s;
+    A->M[j][i] *= s;
+    A->M[j][j] *= c;
+}
+
+LINALG_DEF void mat4d_transform_array(const mat4d_t *M,
+                                      const vec4d_t *restrict in,
+                                      vec4d_t *restrict out, size_t n);
+
+LINALG_INLINE mat4d_t mat4d_transpose(mat4d_t M) {
+    mat4d_t T;
+    T._11 = M._11;
+    T._12 = M._21;
+    T._13 = M._31;
+    T._14 = M._41;
+    T._21 = M._12;
+    T._22 = M._22;
+    T._23 = M._32;
+    T._24 = M._42;
+    T._31 = M._13;
+    T._32 = M._23;
+    T._33 = M._33;
+    T._34 = M._43;
+    T._41 = M._14;
+    T._42 = M._24;
+    T._43 = M._34;
+    T._44 = M._44;
+    return T;
+}
+
+LINALG_INLINE double mat4d_det(mat4d_t M) {
+    const double s0 = M._11 * M._22 - M._21 * M._12;
+    const double s1 = M._11 * M._23 - M._21 * M._13;
+    const double s2 = M._11 * M._24 - M._21 * M._14;
+    const double s3 = M._12 * M._23 - M._22 * M._13;
+    const double s4 = M._12 * M._24 - M._22 * M._14;
+    const double s5 = M._13 * M._24 - M._23 * M._14;
+    const double c0 = M._31 * M._42 - M._41 * M._32;
+    const double c1 = M._31 * M._43 - M._41 * M._33;
+    const double c2 = M._31 * M._44 - M._41 * M._34;
+    const double c3 = M._32 * M._43 - M._42 * M._33;
+    const double c4 = M._32 * M._44 - M._42 * M._34;
+    const double c5 = M._33 * M._44 - M._43 * M._34;
+    return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+}
+
+LINALG_DEF mat4d_t mat4d_inverse(mat4d_t M);
+
+LINALG_INLINE mat4d_t mat4d_inverse_affine(mat4d_t M) {
+    mat4d_t result;
+    result._11 = M._11;
+    result._12 = M._21;
+    result._13 = M._31;
+    result._14 = -(M._11 * M._14 + M._21 * M._24 + M._31 * M._34);
+    result._21 = M._12;
+    result._22 = M._22;
+    result._23 = M._32;
+    result._24 = -(M._12 * M._14 + M._22 * M._24 + M._32 * M._34);
+    result._31 = M._13;
+    result._32 = M._23;
+    result._33 = M._33;
+    result._34 = -(M._13 * M._14 + M._23 * M._24 + M._33 * M._34);
+    result._41 = result._42 = result._43 = 0;
+    result._44 = 1;
+    return result;
+}
+
+LINALG_DEF void mat4d_inverse_array(const mat4d_t *restrict in,
+                                    mat4d_t *restrict out, size_t n);
+LINALG_DEF void mat4d_inverse_affine_array(const mat4d_t *restrict in,
+                                           mat4d_t *restrict out, size_t n);
+
+LINALG_INLINE vec4i_t vec4i_add(vec4i_t a, vec4i_t b) {
     a.x += b.x;
     a.y += b.y;
     a.z += b.z;
@@ -2671,7 +5040,22 @@ LINALG_DEF vec4i_t vec4i_add(vec4i_t a, vec4i_t b) {
     return a;
 }
 
-LINALG_DEF vec4i_t vec4i_sub(vec4i_t a, vec4i_t b) {
+LINALG_INLINE void vec4i_add_to(vec4i_t *restrict out, const vec4i_t *a,
+                                const vec4i_t *b) {
+    out->x = a->x + b->x;
+    out->y = a->y + b->y;
+    out->z = a->z + b->z;
+    out->w = a->w + b->w;
+}
+
+LINALG_INLINE void vec4i_add_assign(vec4i_t *a, vec4i_t b) {
+    a->x += b.x;
+    a->y += b.y;
+    a->z += b.z;
+    a->w += b.w;
+}
+
+LINALG_INLINE vec4i_t vec4i_sub(vec4i_t a, vec4i_t b) {
     a.x -= b.x;
     a.y -= b.y;
     a.z -= b.z;
@@ -2679,7 +5063,22 @@ LINALG_DEF vec4i_t vec4i_sub(vec4i_t a, vec4i_t b) {
     return a;
 }
 
-LINALG_DEF vec4i_t vec4i_mul(vec4i_t a, vec4i_t b) {
+LINALG_INLINE void vec4i_sub_to(vec4i_t *restrict out, const vec4i_t *a,
+                                const vec4i_t *b) {
+    out->x = a->x - b->x;
+    out->y = a->y - b->y;
+    out->z = a->z - b->z;
+    out->w = a->w - b->w;
+}
+
+LINALG_INLINE void vec4i_sub_assign(vec4i_t *a, vec4i_t b) {
+    a->x -= b.x;
+    a->y -= b.y;
+    a->z -= b.z;
+    a->w -= b.w;
+}
+
+LINALG_INLINE vec4i_t vec4i_mul(vec4i_t a, vec4i_t b) {
     a.x *= b.x;
     a.y *= b.y;
     a.z *= b.z;
@@ -2687,7 +5086,22 @@ LINALG_DEF vec4i_t vec4i_mul(vec4i_t a, vec4i_t b) {
     return a;
 }
 
-LINALG_DEF vec4i_t vec4i_div(vec4i_t a, vec4i_t b) {
+LINALG_INLINE void vec4i_mul_to(vec4i_t *restrict out, const vec4i_t *a,
+                                const vec4i_t *b) {
+    out->x = a->x * b->x;
+    out->y = a->y * b->y;
+    out->z = a->z * b->z;
+    out->w = a->w * b->w;
+}
+
+LINALG_INLINE void vec4i_mul_assign(vec4i_t *a, vec4i_t b) {
+    a->x *= b.x;
+    a->y *= b.y;
+    a->z *= b.z;
+    a->w *= b.w;
+}
+
+LINALG_INLINE vec4i_t vec4i_div(vec4i_t a, vec4i_t b) {
     a.x /= b.x;
     a.y /= b.y;
     a.z /= b.z;
@@ -2695,7 +5109,22 @@ LINALG_DEF vec4i_t vec4i_div(vec4i_t a, vec4i_t b) {
     return a;
 }
 
-LINALG_DEF vec4i_t vec4i_mod(vec4i_t a, vec4i_t b) {
+LINALG_INLINE void vec4i_div_to(vec4i_t *restrict out, const vec4i_t *a,
+                                const vec4i_t *b) {
+    out->x = a->x / b->x;
+    out->y = a->y / b->y;
+    out->z = a->z / b->z;
+    out->w = a->w / b->w;
+}
+
+LINALG_INLINE void vec4i_div_assign(vec4i_t *a, vec4i_t b) {
+    a->x /= b.x;
+    a->y /= b.y;
+    a->z /= b.z;
+    a->w /= b.w;
+}
+
+LINALG_INLINE vec4i_t vec4i_mod(vec4i_t a, vec4i_t b) {
     a.x %= b.x;
     a.y %= b.y;
     a.z %= b.z;
@@ -2703,7 +5132,22 @@ LINALG_DEF vec4i_t vec4i_mod(vec4i_t a, vec4i_t b) {
     return a;
 }
 
-LINALG_DEF vec4i_t vec4i_min(vec4i_t a, vec4i_t b) {
+LINALG_INLINE void vec4i_mod_to(vec4i_t *restrict out, const vec4i_t *a,
+                                const vec4i_t *b) {
+    out->x = a->x % b->x;
+    out->y = a->y % b->y;
+    out->z = a->z % b->z;
+    out->w = a->w % b->w;
+}
+
+LINALG_INLINE void vec4i_mod_assign(vec4i_t *a, vec4i_t b) {
+    a->x %= b.x;
+    a->y %= b.y;
+    a->z %= b.z;
+    a->w %= b.w;
+}
+
+LINALG_INLINE vec4i_t vec4i_min(vec4i_t a, vec4i_t b) {
     a.x = mini(a.x, b.x);
     a.y = mini(a.y, b.y);
     a.z = mini(a.z, b.z);
@@ -2711,7 +5155,15 @@ LINALG_DEF vec4i_t vec4i_min(vec4i_t a, vec4i_t b) {
     return a;
 }
 
-LINALG_DEF vec4i_t vec4i_max(vec4i_t a, vec4i_t b) {
+LINALG_INLINE void vec4i_min_to(vec4i_t *restrict out, const vec4i_t *a,
+                                const vec4i_t *b) {
+    out->x = mini(a->x, b->x);
+    out->y = mini(a->y, b->y);
+    out->z = mini(a->z, b->z);
+    out->w = mini(a->w, b->w);
+}
+
+LINALG_INLINE vec4i_t vec4i_max(vec4i_t a, vec4i_t b) {
     a.x = maxi(a.x, b.x);
     a.y = maxi(a.y, b.y);
     a.z = maxi(a.z, b.z);
@@ -2719,7 +5171,15 @@ LINALG_DEF vec4i_t vec4i_max(vec4i_t a, vec4i_t b) {
     return a;
 }
 
-LINALG_DEF vec4i_t vec4i_clamp(vec4i_t v, vec4i_t min, vec4i_t max) {
+LINALG_INLINE void vec4i_max_to(vec4i_t *restrict out, const vec4i_t *a,
+                                const vec4i_t *b) {
+    out->x = maxi(a->x, b->x);
+    out->y = maxi(a->y, b->y);
+    out->z = maxi(a->z, b->z);
+    out->w = maxi(a->w, b->w);
+}
+
+LINALG_INLINE vec4i_t vec4i_clamp(vec4i_t v, vec4i_t min, vec4i_t max) {
     v.x = clampi(v.x, min.x, max.x);
     v.y = clampi(v.y, min.y, max.y);
     v.z = clampi(v.z, min.z, max.z);
@@ -2727,7 +5187,15 @@ LINALG_DEF vec4i_t vec4i_clamp(vec4i_t v, vec4i_t min, vec4i_t max) {
     return v;
 }
 
-LINALG_DEF vec4i_t vec4i_abs(vec4i_t v) {
+LINALG_INLINE void vec4i_clamp_to(vec4i_t *restrict out, const vec4i_t *v,
+                                  const vec4i_t *min, const vec4i_t *max) {
+    out->x = clampi(v->x, min->x, max->x);
+    out->y = clampi(v->y, min->y, max->y);
+    out->z = clampi(v->z, min->z, max->z);
+    out->w = clampi(v->w, min->w, max->w);
+}
+
+LINALG_INLINE vec4i_t vec4i_abs(vec4i_t v) {
     v.x = absi(v.x);
     v.y = absi(v.y);
     v.z = absi(v.z);
@@ -2735,35 +5203,25 @@ LINALG_DEF vec4i_t vec4i_abs(vec4i_t v) {
     return v;
 }
 
-LINALG_DEF vec4i_t vec4i_sum(size_t n, ...) {
-    va_list args;
-    va_start(args, n);
-    vec4i_t sum = {0};
-    for (size_t i = 0; i < n; ++i) {
-        vec4i_t v = va_arg(args, vec4i_t);
-        sum = vec4i_add(sum, v);
-    }
-    return sum;
+LINALG_INLINE void vec4i_abs_to(vec4i_t *restrict out, const vec4i_t *v) {
+    out->x = absi(v->x);
+    out->y = absi(v->y);
+    out->z = absi(v->z);
+    out->w = absi(v->w);
 }
 
-LINALG_DEF vec4i_t vec4i_product(size_t n, ...) {
-    va_list args;
-    va_start(args, n);
-    vec4i_t product = vec4i_splat(1);
-    for (size_t i = 0; i < n; ++i) {
-        vec4i_t v = va_arg(args, vec4i_t);
-        product = vec4i_mul(product, v);
-    }
-    return product;
-}
+LINALG_DEF vec4i_t vec4i_sum(size_t n, ...);
+LINALG_DEF vec4i_t vec4i_sum_array(const vec4i_t *xs, size_t n);
+LINALG_DEF vec4i_t vec4i_product(size_t n, ...);
+LINALG_DEF vec4i_t vec4i_product_array(const vec4i_t *xs, size_t n);
 
-LINALG_DEF int vec4i_dot(vec4i_t a, vec4i_t b) {
+LINALG_INLINE int vec4i_dot(vec4i_t a, vec4i_t b) {
     return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w;
 }
 
-LINALG_DEF int vec4i_sqrlen(vec4i_t v) { return vec4i_dot(v, v); }
+LINALG_INLINE int vec4i_sqrlen(vec4i_t v) { return vec4i_dot(v, v); }
 
-LINALG_DEF int vec4i_1norm(vec4i_t v) {
+LINALG_INLINE int vec4i_1norm(vec4i_t v) {
     v = vec4i_abs(v);
     int norm = 0;
     norm += v.x;
@@ -2773,7 +5231,7 @@ LINALG_DEF int vec4i_1norm(vec4i_t v) {
     return norm;
 }
 
-LINALG_DEF vec4i_t vec4i_reflect(vec4i_t v, vec4i_t n) {
+LINALG_INLINE vec4i_t vec4i_reflect(vec4i_t v, vec4i_t n) {
     vec4i_t result = n;
     result = vec4i_mul(result, vec4i_splat(vec4i_dot(v, n)));
     result = vec4i_mul(result, vec4i_splat(2));
@@ -2781,7 +5239,7 @@ LINALG_DEF vec4i_t vec4i_reflect(vec4i_t v, vec4i_t n) {
     return result;
 }
 
-LINALG_DEF mat4i_t mat4i_mul(mat4i_t A, mat4i_t B) {
+LINALG_INLINE mat4i_t mat4i_mul(mat4i_t A, mat4i_t B) {
     mat4i_t result;
     result._11 = A._11 * B._11 + A._12 * B._21 + A._13 * B._31 + A._14 * B._41;
     result._12 = A._11 * B._12 + A._12 * B._22 + A._13 * B._32 + A._14 * B._42;
@@ -2802,18 +5260,46 @@ LINALG_DEF mat4i_t mat4i_mul(mat4i_t A, mat4i_t B) {
     return result;
 }
 
-LINALG_DEF mat4i_t mat4i_nmul(size_t n, ...) {
-    va_list args;
-    va_start(args, n);
-    mat4i_t product = mat4i_I();
-    for (size_t i = 0; i < n; ++i) {
-        mat4i_t A = va_arg(args, mat4i_t);
-        product = mat4i_mul(product, A);
-    }
-    return product;
-}
-
-LINALG_DEF vec4i_t mat4i_mul_vec(mat4i_t M, vec4i_t v) {
+LINALG_INLINE void mat4i_mul_to(mat4i_t *restrict out, const mat4i_t *A,
+                                const mat4i_t *B) {
+    out->_11 = A->_11 * B->_11 + A->_12 * B->_21 + A->_13 * B->_31 + A->_14 *
+               B->_41;
+    out->_12 = A->_11 * B->_12 + A->_12 * B->_22 + A->_13 * B->_32 + A->_14 *
+               B->_42;
+    out->_13 = A->_11 * B->_13 + A->_12 * B->_23 + A->_13 * B->_33 + A->_14 *
+               B->_43;
+    out->_14 = A->_11 * B->_14 + A->_12 * B->_24 + A->_13 * B->_34 + A->_14 *
+               B->_44;
+    out->_21 = A->_21 * B->_11 + A->_22 * B->_21 + A->_23 * B->_31 + A->_24 *
+               B->_41;
+    out->_22 = A->_21 * B->_12 + A->_22 * B->_22 + A->_23 * B->_32 + A->_24 *
+               B->_42;
+    out->_23 = A->_21 * B->_13 + A->_22 * B->_23 + A->_23 * B->_33 + A->_24 *
+               B->_43;
+    out->_24 = A->_21 * B->_14 + A->_22 * B->_24 + A->_23 * B->_34 + A->_24 *
+               B->_44;
+    out->_31 = A->_31 * B->_11 + A->_32 * B->_21 + A->_33 * B->_31 + A->_34 *
+               B->_41;
+    out->_32 = A->_31 * B->_12 + A->_32 * B->_22 + A->_33 * B->_32 + A->_34 *
+               B->_42;
+    out->_33 = A->_31 * B->_13 + A->_32 * B->_23 + A->_33 * B->_33 + A->_34 *
+               B->_43;
+    out->_34 = A->_31 * B->_14 + A->_32 * B->_24 + A->_33 * B->_34 + A->_34 *
+               B->_44;
+    out->_41 = A->_41 * B->_11 + A->_42 * B->_21 + A->_43 * B->_31 + A->_44 *
+               B->_41;
+    out->_42 = A->_41 * B->_12 + A->_42 * B->_22 + A->_43 * B->_32 + A->_44 *
+               B->_42;
+    out->_43 = A->_41 * B->_13 + A->_42 * B->_23 + A->_43 * B->_33 + A->_44 *
+               B->_43;
+    out->_44 = A->_41 * B->_14 + A->_42 * B->_24 + A->_43 * B->_34 + A->_44 *
+               B->_44;
+}
+
+LINALG_DEF mat4i_t mat4i_nmul(size_t n, ...);
+LINALG_DEF mat4i_t mat4i_mul_chain(const mat4i_t *Ms, size_t n);
+
+LINALG_INLINE vec4i_t mat4i_mul_vec(mat4i_t M, vec4i_t v) {
     vec4i_t result;
     result.x = vec4i_dot(M.v[0], v);
     result.y = vec4i_dot(M.v[1], v);
@@ -2822,15 +5308,80 @@ LINALG_DEF vec4i_t mat4i_mul_vec(mat4i_t M, vec4i_t v) {
     return result;
 }
 
-LINALG_DEF mat4i_t mat4i_hadamard(mat4i_t A, mat4i_t B) {
+LINALG_INLINE void mat4i_mul_vec_to(vec4i_t *restrict out, const mat4i_t *M,
+                                    const vec4i_t *v) {
+    out->x = M->_11 * v->x + M->_12 * v->y + M->_13 * v->z + M->_14 * v->w;
+    out->y = M->_21 * v->x + M->_22 * v->y + M->_23 * v->z + M->_24 * v->w;
+    out->z = M->_31 * v->x + M->_32 * v->y + M->_33 * v->z + M->_34 * v->w;
+    out->w = M->_41 * v->x + M->_42 * v->y + M->_43 * v->z + M->_44 * v->w;
+}
+
+LINALG_INLINE mat4i_t mat4i_hadamard(mat4i_t A, mat4i_t B) {
     A.e[0] *= B.e[0];
     A.e[1] *= B.e[1];
     A.e[2] *= B.e[2];
     A.e[3] *= B.e[3];
+    A.e[4] *= B.e[4];
+    A.e[5] *= B.e[5];
+    A.e[6] *= B.e[6];
+    A.e[7] *= B.e[7];
+    A.e[8] *= B.e[8];
+    A.e[9] *= B.e[9];
+    A.e[10] *= B.e[10];
+    A.e[11] *= B.e[11];
+    A.e[12] *= B.e[12];
+    A.e[13] *= B.e[13];
+    A.e[14] *= B.e[14];
+    A.e[15] *= B.e[15];
     return A;
 }
 
-LINALG_DEF vec4u_t vec4u_add(vec4u_t a, vec4u_t b) {
+LINALG_INLINE void mat4i_hadamard_to(mat4i_t *restrict out, const mat4i_t *A,
+                                     const mat4i_t *B) {
+    out->e[0] = A->e[0] * B->e[0];
+    out->e[1] = A->e[1] * B->e[1];
+    out->e[2] = A->e[2] * B->e[2];
+    out->e[3] = A->e[3] * B->e[3];
+    out->e[4] = A->e[4] * B->e[4];
+    out->e[5] = A->e[5] * B->e[5];
+    out->e[6] = A->e[6] * B->e[6];
+    out->e[7] = A->e[7] * B->e[7];
+    out->e[8] = A->e[8] * B->e[8];
+    out->e[9] = A->e[9] * B->e[9];
+    out->e[10] = A->e[10] * B->e[10];
+    out->e[11] = A->e[11] * B->e[11];
+    out->e[12] = A->e[12] * B->e[12];
+    out->e[13] = A->e[13] * B->e[13];
+    out->e[14] = A->e[14] * B->e[14];
+    out->e[15] = A->e[15] * B->e[15];
+}
+
+LINALG_DEF void mat4i_transform_array(const mat4i_t *M,
+                                      const vec4i_t *restrict in,
+                                      vec4i_t *restrict out, size_t n);
+
+LINALG_INLINE mat4i_t mat4i_transpose(mat4i_t M) {
+    mat4i_t T;
+    T._11 = M._11;
+    T._12 = M._21;
+    T._13 = M._31;
+    T._14 = M._41;
+    T._21 = M._12;
+    T._22 = M._22;
+    T._23 = M._32;
+    T._24 = M._42;
+    T._31 = M._13;
+    T._32 = M._23;
+    T._33 = M._33;
+    T._34 = M._43;
+    T._41 = M._14;
+    T._42 = M._24;
+    T._43 = M._34;
+    T._44 = M._44;
+    return T;
+}
+
+LINALG_INLINE vec4u_t vec4u_add(vec4u_t a, vec4u_t b) {
     a.x += b.x;
     a.y += b.y;
     a.z += b.z;
@@ -2838,7 +5389,22 @@ LINALG_DEF vec4u_t vec4u_add(vec4u_t a, vec4u_t b) {
     return a;
 }
 
-LINALG_DEF vec4u_t vec4u_sub(vec4u_t a, vec4u_t b) {
+LINALG_INLINE void vec4u_add_to(vec4u_t *restrict out, const vec4u_t *a,
+                                const vec4u_t *b) {
+    out->x = a->x + b->x;
+    out->y = a->y + b->y;
+    out->z = a->z + b->z;
+    out->w = a->w + b->w;
+}
+
+LINALG_INLINE void vec4u_add_assign(vec4u_t *a, vec4u_t b) {
+    a->x += b.x;
+    a->y += b.y;
+    a->z += b.z;
+    a->w += b.w;
+}
+
+LINALG_INLINE vec4u_t vec4u_sub(vec4u_t a, vec4u_t b) {
     a.x -= b.x;
     a.y -= b.y;
     a.z -= b.z;
@@ -2846,7 +5412,22 @@ LINALG_DEF vec4u_t vec4u_sub(vec4u_t a, vec4u_t b) {
     return a;
 }
 
-LINALG_DEF vec4u_t vec4u_mul(vec4u_t a, vec4u_t b) {
+LINALG_INLINE void vec4u_sub_to(vec4u_t *restrict out, const vec4u_t *a,
+                                const vec4u_t *b) {
+    out->x = a->x - b->x;
+    out->y = a->y - b->y;
+    out->z = a->z - b->z;
+    out->w = a->w - b->w;
+}
+
+LINALG_INLINE void vec4u_sub_assign(vec4u_t *a, vec4u_t b) {
+    a->x -= b.x;
+    a->y -= b.y;
+    a->z -= b.z;
+    a->w -= b.w;
+}
+
+LINALG_INLINE vec4u_t vec4u_mul(vec4u_t a, vec4u_t b) {
     a.x *= b.x;
     a.y *= b.y;
     a.z *= b.z;
@@ -2854,7 +5435,22 @@ LINALG_DEF vec4u_t vec4u_mul(vec4u_t a, vec4u_t b) {
     return a;
 }
 
-LINALG_DEF vec4u_t vec4u_div(vec4u_t a, vec4u_t b) {
+LINALG_INLINE void vec4u_mul_to(vec4u_t *restrict out, const vec4u_t *a,
+                                const vec4u_t *b) {
+    out->x = a->x * b->x;
+    out->y = a->y * b->y;
+    out->z = a->z * b->z;
+    out->w = a->w * b->w;
+}
+
+LINALG_INLINE void vec4u_mul_assign(vec4u_t *a, vec4u_t b) {
+    a->x *= b.x;
+    a->y *= b.y;
+    a->z *= b.z;
+    a->w *= b.w;
+}
+
+LINALG_INLINE vec4u_t vec4u_div(vec4u_t a, vec4u_t b) {
     a.x /= b.x;
     a.y /= b.y;
     a.z /= b.z;
@@ -2862,7 +5458,22 @@ LINALG_DEF vec4u_t vec4u_div(vec4u_t a, vec4u_t b) {
     return a;
 }
 
-LINALG_DEF vec4u_t vec4u_mod(vec4u_t a, vec4u_t b) {
+LINALG_INLINE void vec4u_div_to(vec4u_t *restrict out, const vec4u_t *a,
+                                const vec4u_t *b) {
+    out->x = a->x / b->x;
+    out->y = a->y / b->y;
+    out->z = a->z / b->z;
+    out->w = a->w / b->w;
+}
+
+LINALG_INLINE void vec4u_div_assign(vec4u_t *a, vec4u_t b) {
+    a->x /= b.x;
+    a->y /= b.y;
+    a->z /= b.z;
+    a->w /= b.w;
+}
+
+LINALG_INLINE vec4u_t vec4u_mod(vec4u_t a, vec4u_t b) {
     a.x %= b.x;
     a.y %= b.y;
     a.z %= b.z;
@@ -2870,7 +5481,22 @@ LINALG_DEF vec4u_t vec4u_mod(vec4u_t a, vec4u_t b) {
     return a;
 }
 
-LINALG_DEF vec4u_t vec4u_min(vec4u_t a, vec4u_t b) {
+LINALG_INLINE void vec4u_mod_to(vec4u_t *restrict out, const vec4u_t *a,
+                                const vec4u_t *b) {
+    out->x = a->x % b->x;
+    out->y = a->y % b->y;
+    out->z = a->z % b->z;
+    out->w = a->w % b->w;
+}
+
+LINALG_INLINE void vec4u_mod_assign(vec4u_t *a, vec4u_t b) {
+    a->x %= b.x;
+    a->y %= b.y;
+    a->z %= b.z;
+    a->w %= b.w;
+}
+
+LINALG_INLINE vec4u_t vec4u_min(vec4u_t a, vec4u_t b) {
     a.x = minu(a.x, b.x);
     a.y = minu(a.y, b.y);
     a.z = minu(a.z, b.z);
@@ -2878,7 +5504,15 @@ LINALG_DEF vec4u_t vec4u_min(vec4u_t a, vec4u_t b) {
     return a;
 }
 
-LINALG_DEF vec4u_t vec4u_max(vec4u_t a, vec4u_t b) {
+LINALG_INLINE void vec4u_min_to(vec4u_t *restrict out, const vec4u_t *a,
+                                const vec4u_t *b) {
+    out->x = minu(a->x, b->x);
+    out->y = minu(a->y, b->y);
+    out->z = minu(a->z, b->z);
+    out->w = minu(a->w, b->w);
+}
+
+LINALG_INLINE vec4u_t vec4u_max(vec4u_t a, vec4u_t b) {
     a.x = maxu(a.x, b.x);
     a.y = maxu(a.y, b.y);
     a.z = maxu(a.z, b.z);
@@ -2886,7 +5520,15 @@ LINALG_DEF vec4u_t vec4u_max(vec4u_t a, vec4u_t b) {
     return a;
 }
 
-LINALG_DEF vec4u_t vec4u_clamp(vec4u_t v, vec4u_t min, vec4u_t max) {
+LINALG_INLINE void vec4u_max_to(vec4u_t *restrict out, const vec4u_t *a,
+                                const vec4u_t *b) {
+    out->x = maxu(a->x, b->x);
+    out->y = maxu(a->y, b->y);
+    out->z = maxu(a->z, b->z);
+    out->w = maxu(a->w, b->w);
+}
+
+LINALG_INLINE vec4u_t vec4u_clamp(vec4u_t v, vec4u_t min, vec4u_t max) {
     v.x = clampu(v.x, min.x, max.x);
     v.y = clampu(v.y, min.y, max.y);
     v.z = clampu(v.z, min.z, max.z);
@@ -2894,35 +5536,26 @@ LINALG_DEF vec4u_t vec4u_clamp(vec4u_t v, vec4u_t min, vec4u_t max) {
     return v;
 }
 
-LINALG_DEF vec4u_t vec4u_sum(size_t n, ...) {
-    va_list args;
-    va_start(args, n);
-    vec4u_t sum = {0};
-    for (size_t i = 0; i < n; ++i) {
-        vec4u_t v = va_arg(args, vec4u_t);
-        sum = vec4u_add(sum, v);
-    }
-    return sum;
+LINALG_INLINE void vec4u_clamp_to(vec4u_t *restrict out, const vec4u_t *v,
+                                  const vec4u_t *min, const vec4u_t *max) {
+    out->x = clampu(v->x, min->x, max->x);
+    out->y = clampu(v->y, min->y, max->y);
+    out->z = clampu(v->z, min->z, max->z);
+    out->w = clampu(v->w, min->w, max->w);
 }
 
-LINALG_DEF vec4u_t vec4u_product(size_t n, ...) {
-    va_list args;
-    va_start(args, n);
-    vec4u_t product = vec4u_splat(1);
-    for (size_t i = 0; i < n; ++i) {
-        vec4u_t v = va_arg(args, vec4u_t);
-        product = vec4u_mul(product, v);
-    }
-    return product;
-}
+LINALG_DEF vec4u_t vec4u_sum(size_t n, ...);
+LINALG_DEF vec4u_t vec4u_sum_array(const vec4u_t *xs, size_t n);
+LINALG_DEF vec4u_t vec4u_product(size_t n, ...);
+LINALG_DEF vec4u_t vec4u_product_array(const vec4u_t *xs, size_t n);
 
-LINALG_DEF unsigned int vec4u_dot(vec4u_t a, vec4u_t b) {
+LINALG_INLINE unsigned int vec4u_dot(vec4u_t a, vec4u_t b) {
     return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w;
 }
 
-LINALG_DEF unsigned int vec4u_sqrlen(vec4u_t v) { return vec4u_dot(v, v); }
+LINALG_INLINE unsigned int vec4u_sqrlen(vec4u_t v) { return vec4u_dot(v, v); }
 
-LINALG_DEF unsigned int vec4u_1norm(vec4u_t v) {
+LINALG_INLINE unsigned int vec4u_1norm(vec4u_t v) {
     unsigned int norm = 0;
     norm += v.x;
     norm += v.y;
@@ -2931,7 +5564,7 @@ LINALG_DEF unsigned int vec4u_1norm(vec4u_t v) {
     return norm;
 }
 
-LINALG_DEF vec4u_t vec4u_reflect(vec4u_t v, vec4u_t n) {
+LINALG_INLINE vec4u_t vec4u_reflect(vec4u_t v, vec4u_t n) {
     vec4u_t result = n;
     result = vec4u_mul(result, vec4u_splat(vec4u_dot(v, n)));
     result = vec4u_mul(result, vec4u_splat(2));
@@ -2939,7 +5572,7 @@ LINALG_DEF vec4u_t vec4u_reflect(vec4u_t v, vec4u_t n) {
     return result;
 }
 
-LINALG_DEF mat4u_t mat4u_mul(mat4u_t A, mat4u_t B) {
+LINALG_INLINE mat4u_t mat4u_mul(mat4u_t A, mat4u_t B) {
     mat4u_t result;
     result._11 = A._11 * B._11 + A._12 * B._21 + A._13 * B._31 + A._14 * B._41;
     result._12 = A._11 * B._12 + A._12 * B._22 + A._13 * B._32 + A._14 * B._42;
@@ -2960,18 +5593,46 @@ LINALG_DEF mat4u_t mat4u_mul(mat4u_t A, mat4u_t B) {
     return result;
 }
 
-LINALG_DEF mat4u_t mat4u_nmul(size_t n, ...) {
-    va_list args;
-    va_start(args, n);
-    mat4u_t product = mat4u_I();
-    for (size_t i = 0; i < n; ++i) {
-        mat4u_t A = va_arg(args, mat4u_t);
-        product = mat4u_mul(product, A);
-    }
-    return product;
-}
-
-LINALG_DEF vec4u_t mat4u_mul_vec(mat4u_t M, vec4u_t v) {
+LINALG_INLINE void mat4u_mul_to(mat4u_t *restrict out, const mat4u_t *A,
+                                const mat4u_t *B) {
+    out->_11 = A->_11 * B->_11 + A->_12 * B->_21 + A->_13 * B->_31 + A->_14 *
+               B->_41;
+    out->_12 = A->_11 * B->_12 + A->_12 * B->_22 + A->_13 * B->_32 + A->_14 *
+               B->_42;
+    out->_13 = A->_11 * B->_13 + A->_12 * B->_23 + A->_13 * B->_33 + A->_14 *
+               B->_43;
+    out->_14 = A->_11 * B->_14 + A->_12 * B->_24 + A->_13 * B->_34 + A->_14 *
+               B->_44;
+    out->_21 = A->_21 * B->_11 + A->_22 * B->_21 + A->_23 * B->_31 + A->_24 *
+               B->_41;
+    out->_22 = A->_21 * B->_12 + A->_22 * B->_22 + A->_23 * B->_32 + A->_24 *
+               B->_42;
+    out->_23 = A->_21 * B->_13 + A->_22 * B->_23 + A->_23 * B->_33 + A->_24 *
+               B->_43;
+    out->_24 = A->_21 * B->_14 + A->_22 * B->_24 + A->_23 * B->_34 + A->_24 *
+               B->_44;
+    out->_31 = A->_31 * B->_11 + A->_32 * B->_21 + A->_33 * B->_31 + A->_34 *
+               B->_41;
+    out->_32 = A->_31 * B->_12 + A->_32 * B->_22 + A->_33 * B->_32 + A->_34 *
+               B->_42;
+    out->_33 = A->_31 * B->_13 + A->_32 * B->_23 + A->_33 * B->_33 + A->_34 *
+               B->_43;
+    out->_34 = A->_31 * B->_14 + A->_32 * B->_24 + A->_33 * B->_34 + A->_34 *
+               B->_44;
+    out->_41 = A->_41 * B->_11 + A->_42 * B->_21 + A->_43 * B->_31 + A->_44 *
+               B->_41;
+    out->_42 = A->_41 * B->_12 + A->_42 * B->_22 + A->_43 * B->_32 + A->_44 *
+               B->_42;
+    out->_43 = A->_41 * B->_13 + A->_42 * B->_23 + A->_43 * B->_33 + A->_44 *
+               B->_43;
+    out->_44 = A->_41 * B->_14 + A->_42 * B->_24 + A->_43 * B->_34 + A->_44 *
+               B->_44;
+}
+
+LINALG_DEF mat4u_t mat4u_nmul(size_t n, ...);
+LINALG_DEF mat4u_t mat4u_mul_chain(const mat4u_t *Ms, size_t n);
+
+LINALG_INLINE vec4u_t mat4u_mul_vec(mat4u_t M, vec4u_t v) {
     vec4u_t result;
     result.x = vec4u_dot(M.v[0], v);
     result.y = vec4u_dot(M.v[1], v);
@@ -2980,12 +5641,8551 @@ LINALG_DEF vec4u_t mat4u_mul_vec(mat4u_t M, vec4u_t v) {
     return result;
 }
 
-LINALG_DEF mat4u_t mat4u_hadamard(mat4u_t A, mat4u_t B) {
+LINALG_INLINE void mat4u_mul_vec_to(vec4u_t *restrict out, const mat4u_t *M,
+                                    const vec4u_t *v) {
+    out->x = M->_11 * v->x + M->_12 * v->y + M->_13 * v->z + M->_14 * v->w;
+    out->y = M->_21 * v->x + M->_22 * v->y + M->_23 * v->z + M->_24 * v->w;
+    out->z = M->_31 * v->x + M->_32 * v->y + M->_33 * v->z + M->_34 * v->w;
+    out->w = M->_41 * v->x + M->_42 * v->y + M->_43 * v->z + M->_44 * v->w;
+}
+
+LINALG_INLINE mat4u_t mat4u_hadamard(mat4u_t A, mat4u_t B) {
     A.e[0] *= B.e[0];
     A.e[1] *= B.e[1];
     A.e[2] *= B.e[2];
     A.e[3] *= B.e[3];
+    A.e[4] *= B.e[4];
+    A.e[5] *= B.e[5];
+    A.e[6] *= B.e[6];
+    A.e[7] *= B.e[7];
+    A.e[8] *= B.e[8];
+    A.e[9] *= B.e[9];
+    A.e[10] *= B.e[10];
+    A.e[11] *= B.e[11];
+    A.e[12] *= B.e[12];
+    A.e[13] *= B.e[13];
+    A.e[14] *= B.e[14];
+    A.e[15] *= B.e[15];
     return A;
 }
 
+LINALG_INLINE void mat4u_hadamard_to(mat4u_t *restrict out, const mat4u_t *A,
+                                     const mat4u_t *B) {
+    out->e[0] = A->e[0] * B->e[0];
+    out->e[1] = A->e[1] * B->e[1];
+    out->e[2] = A->e[2] * B->e[2];
+    out->e[3] = A->e[3] * B->e[3];
+    out->e[4] = A->e[4] * B->e[4];
+    out->e[5] = A->e[5] * B->e[5];
+    out->e[6] = A->e[6] * B->e[6];
+    out->e[7] = A->e[7] * B->e[7];
+    out->e[8] = A->e[8] * B->e[8];
+    out->e[9] = A->e[9] * B->e[9];
+    out->e[10] = A->e[10] * B->e[10];
+    out->e[11] = A->e[11] * B->e[11];
+    out->e[12] = A->e[12] * B->e[12];
+    out->e[13] = A->e[13] * B->e[13];
+    out->e[14] = A->e[14] * B->e[14];
+    out->e[15] = A->e[15] * B->e[15];
+}
+
+LINALG_DEF void mat4u_transform_array(const mat4u_t *M,
+                                      const vec4u_t *restrict in,
+                                      vec4u_t *restrict out, size_t n);
+
+LINALG_INLINE mat4u_t mat4u_transpose(mat4u_t M) {
+    mat4u_t T;
+    T._11 = M._11;
+    T._12 = M._21;
+    T._13 = M._31;
+    T._14 = M._41;
+    T._21 = M._12;
+    T._22 = M._22;
+    T._23 = M._32;
+    T._24 = M._42;
+    T._31 = M._13;
+    T._32 = M._23;
+    T._33 = M._33;
+    T._34 = M._43;
+    T._41 = M._14;
+    T._42 = M._24;
+    T._43 = M._34;
+    T._44 = M._44;
+    return T;
+}
+
+LINALG_INLINE mat2x3f_t mat2x3f_zero(void) {
+    mat2x3f_t M = {0};
+    return M;
+}
+
+LINALG_INLINE mat2x3f_t mat2x3f_I(void) {
+    mat2x3f_t M = {0};
+    M._11 = 1;
+    M._22 = 1;
+    return M;
+}
+
+LINALG_INLINE vec2f_t mat2x3f_mul_vec(mat2x3f_t M, vec3f_t v) {
+    vec2f_t result;
+    result.e[0] = M._11 * v.e[0] + M._12 * v.e[1] + M._13 * v.e[2];
+    result.e[1] = M._21 * v.e[0] + M._22 * v.e[1] + M._23 * v.e[2];
+    return result;
+}
+
+LINALG_INLINE mat3x2f_t mat2x3f_transpose(mat2x3f_t M) {
+    mat3x2f_t result;
+    result._11 = M._11;
+    result._21 = M._12;
+    result._31 = M._13;
+    result._12 = M._21;
+    result._22 = M._22;
+    result._32 = M._23;
+    return result;
+}
+
+LINALG_INLINE mat2x3f_t mat2x3f_from_mat3f(mat3f_t M) {
+    mat2x3f_t result;
+    result._11 = M._11;
+    result._12 = M._12;
+    result._13 = M._13;
+    result._21 = M._21;
+    result._22 = M._22;
+    result._23 = M._23;
+    return result;
+}
+
+LINALG_INLINE mat3f_t mat2x3f_to_mat3f(mat2x3f_t M) {
+    mat3f_t result = {0};
+    result._11 = M._11;
+    result._12 = M._12;
+    result._13 = M._13;
+    result._21 = M._21;
+    result._22 = M._22;
+    result._23 = M._23;
+    result._33 = 1;
+    return result;
+}
+
+LINALG_INLINE mat2x3f_t mat2x3f_mul_affine(mat2x3f_t A, mat2x3f_t B) {
+    mat2x3f_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21;
+    result._12 = A._11 * B._12 + A._12 * B._22;
+    result._13 = A._11 * B._13 + A._12 * B._23 + A._13;
+    result._21 = A._21 * B._11 + A._22 * B._21;
+    result._22 = A._21 * B._12 + A._22 * B._22;
+    result._23 = A._21 * B._13 + A._22 * B._23 + A._23;
+    return result;
+}
+
+LINALG_INLINE vec2f_t mat2x3f_transform_affine(mat2x3f_t M, vec2f_t p) {
+    vec2f_t result;
+    result.e[0] = M._11 * p.e[0] + M._12 * p.e[1] + M._13;
+    result.e[1] = M._21 * p.e[0] + M._22 * p.e[1] + M._23;
+    return result;
+}
+
+LINALG_DEF void mat2x3f_transform_affine_array(const mat2x3f_t *M,
+                                               const vec2f_t *restrict in,
+                                               vec2f_t *restrict out, size_t n);
+
+LINALG_INLINE mat2x4f_t mat2x4f_zero(void) {
+    mat2x4f_t M = {0};
+    return M;
+}
+
+LINALG_INLINE mat2x4f_t mat2x4f_I(void) {
+    mat2x4f_t M = {0};
+    M._11 = 1;
+    M._22 = 1;
+    return M;
+}
+
+LINALG_INLINE vec2f_t mat2x4f_mul_vec(mat2x4f_t M, vec4f_t v) {
+    vec2f_t result;
+    result.e[0] = M._11 * v.e[0] + M._12 * v.e[1] + M._13 * v.e[2] + M._14 *
+                  v.e[3];
+    result.e[1] = M._21 * v.e[0] + M._22 * v.e[1] + M._23 * v.e[2] + M._24 *
+                  v.e[3];
+    return result;
+}
+
+LINALG_INLINE mat4x2f_t mat2x4f_transpose(mat2x4f_t M) {
+    mat4x2f_t result;
+    result._11 = M._11;
+    result._21 = M._12;
+    result._31 = M._13;
+    result._41 = M._14;
+    result._12 = M._21;
+    result._22 = M._22;
+    result._32 = M._23;
+    result._42 = M._24;
+    return result;
+}
+
+LINALG_INLINE mat2x3f_t mat2f_mul_mat2x3f(mat2f_t A, mat2x3f_t B) {
+    mat2x3f_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21;
+    result._12 = A._11 * B._12 + A._12 * B._22;
+    result._13 = A._11 * B._13 + A._12 * B._23;
+    result._21 = A._21 * B._11 + A._22 * B._21;
+    result._22 = A._21 * B._12 + A._22 * B._22;
+    result._23 = A._21 * B._13 + A._22 * B._23;
+    return result;
+}
+
+LINALG_INLINE mat2x4f_t mat2f_mul_mat2x4f(mat2f_t A, mat2x4f_t B) {
+    mat2x4f_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21;
+    result._12 = A._11 * B._12 + A._12 * B._22;
+    result._13 = A._11 * B._13 + A._12 * B._23;
+    result._14 = A._11 * B._14 + A._12 * B._24;
+    result._21 = A._21 * B._11 + A._22 * B._21;
+    result._22 = A._21 * B._12 + A._22 * B._22;
+    result._23 = A._21 * B._13 + A._22 * B._23;
+    result._24 = A._21 * B._14 + A._22 * B._24;
+    return result;
+}
+
+LINALG_INLINE mat2f_t mat2x3f_mul_mat3x2f(mat2x3f_t A, mat3x2f_t B) {
+    mat2f_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21 + A._13 * B._31;
+    result._12 = A._11 * B._12 + A._12 * B._22 + A._13 * B._32;
+    result._21 = A._21 * B._11 + A._22 * B._21 + A._23 * B._31;
+    result._22 = A._21 * B._12 + A._22 * B._22 + A._23 * B._32;
+    return result;
+}
+
+LINALG_INLINE mat2x3f_t mat2x3f_mul_mat3f(mat2x3f_t A, mat3f_t B) {
+    mat2x3f_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21 + A._13 * B._31;
+    result._12 = A._11 * B._12 + A._12 * B._22 + A._13 * B._32;
+    result._13 = A._11 * B._13 + A._12 * B._23 + A._13 * B._33;
+    result._21 = A._21 * B._11 + A._22 * B._21 + A._23 * B._31;
+    result._22 = A._21 * B._12 + A._22 * B._22 + A._23 * B._32;
+    result._23 = A._21 * B._13 + A._22 * B._23 + A._23 * B._33;
+    return result;
+}
+
+LINALG_INLINE mat2x4f_t mat2x3f_mul_mat3x4f(mat2x3f_t A, mat3x4f_t B) {
+    mat2x4f_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21 + A._13 * B._31;
+    result._12 = A._11 * B._12 + A._12 * B._22 + A._13 * B._32;
+    result._13 = A._11 * B._13 + A._12 * B._23 + A._13 * B._33;
+    result._14 = A._11 * B._14 + A._12 * B._24 + A._13 * B._34;
+    result._21 = A._21 * B._11 + A._22 * B._21 + A._23 * B._31;
+    result._22 = A._21 * B._12 + A._22 * B._22 + A._23 * B._32;
+    result._23 = A._21 * B._13 + A._22 * B._23 + A._23 * B._33;
+    result._24 = A._21 * B._14 + A._22 * B._24 + A._23 * B._34;
+    return result;
+}
+
+LINALG_INLINE mat2f_t mat2x4f_mul_mat4x2f(mat2x4f_t A, mat4x2f_t B) {
+    mat2f_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21 + A._13 * B._31 + A._14 * B._41;
+    result._12 = A._11 * B._12 + A._12 * B._22 + A._13 * B._32 + A._14 * B._42;
+    result._21 = A._21 * B._11 + A._22 * B._21 + A._23 * B._31 + A._24 * B._41;
+    result._22 = A._21 * B._12 + A._22 * B._22 + A._23 * B._32 + A._24 * B._42;
+    return result;
+}
+
+LINALG_INLINE mat2x3f_t mat2x4f_mul_mat4x3f(mat2x4f_t A, mat4x3f_t B) {
+    mat2x3f_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21 + A._13 * B._31 + A._14 * B._41;
+    result._12 = A._11 * B._12 + A._12 * B._22 + A._13 * B._32 + A._14 * B._42;
+    result._13 = A._11 * B._13 + A._12 * B._23 + A._13 * B._33 + A._14 * B._43;
+    result._21 = A._21 * B._11 + A._22 * B._21 + A._23 * B._31 + A._24 * B._41;
+    result._22 = A._21 * B._12 + A._22 * B._22 + A._23 * B._32 + A._24 * B._42;
+    result._23 = A._21 * B._13 + A._22 * B._23 + A._23 * B._33 + A._24 * B._43;
+    return result;
+}
+
+LINALG_INLINE mat2x4f_t mat2x4f_mul_mat4f(mat2x4f_t A, mat4f_t B) {
+    mat2x4f_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21 + A._13 * B._31 + A._14 * B._41;
+    result._12 = A._11 * B._12 + A._12 * B._22 + A._13 * B._32 + A._14 * B._42;
+    result._13 = A._11 * B._13 + A._12 * B._23 + A._13 * B._33 + A._14 * B._43;
+    result._14 = A._11 * B._14 + A._12 * B._24 + A._13 * B._34 + A._14 * B._44;
+    result._21 = A._21 * B._11 + A._22 * B._21 + A._23 * B._31 + A._24 * B._41;
+    result._22 = A._21 * B._12 + A._22 * B._22 + A._23 * B._32 + A._24 * B._42;
+    result._23 = A._21 * B._13 + A._22 * B._23 + A._23 * B._33 + A._24 * B._43;
+    result._24 = A._21 * B._14 + A._22 * B._24 + A._23 * B._34 + A._24 * B._44;
+    return result;
+}
+
+LINALG_INLINE mat2x3d_t mat2x3d_zero(void) {
+    mat2x3d_t M = {0};
+    return M;
+}
+
+LINALG_INLINE mat2x3d_t mat2x3d_I(void) {
+    mat2x3d_t M = {0};
+    M._11 = 1;
+    M._22 = 1;
+    return M;
+}
+
+LINALG_INLINE vec2d_t mat2x3d_mul_vec(mat2x3d_t M, vec3d_t v) {
+    vec2d_t result;
+    result.e[0] = M._11 * v.e[0] + M._12 * v.e[1] + M._13 * v.e[2];
+    result.e[1] = M._21 * v.e[0] + M._22 * v.e[1] + M._23 * v.e[2];
+    return result;
+}
+
+LINALG_INLINE mat3x2d_t mat2x3d_transpose(mat2x3d_t M) {
+    mat3x2d_t result;
+    result._11 = M._11;
+    result._21 = M._12;
+    result._31 = M._13;
+    result._12 = M._21;
+    result._22 = M._22;
+    result._32 = M._23;
+    return result;
+}
+
+LINALG_INLINE mat2x3d_t mat2x3d_from_mat3d(mat3d_t M) {
+    mat2x3d_t result;
+    result._11 = M._11;
+    result._12 = M._12;
+    result._13 = M._13;
+    result._21 = M._21;
+    result._22 = M._22;
+    result._23 = M._23;
+    return result;
+}
+
+LINALG_INLINE mat3d_t mat2x3d_to_mat3d(mat2x3d_t M) {
+    mat3d_t result = {0};
+    result._11 = M._11;
+    result._12 = M._12;
+    result._13 = M._13;
+    result._21 = M._21;
+    result._22 = M._22;
+    result._23 = M._23;
+    result._33 = 1;
+    return result;
+}
+
+LINALG_INLINE mat2x3d_t mat2x3d_mul_affine(mat2x3d_t A, mat2x3d_t B) {
+    mat2x3d_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21;
+    result._12 = A._11 * B._12 + A._12 * B._22;
+    result._13 = A._11 * B._13 + A._12 * B._23 + A._13;
+    result._21 = A._21 * B._11 + A._22 * B._21;
+    result._22 = A._21 * B._12 + A._22 * B._22;
+    result._23 = A._21 * B._13 + A._22 * B._23 + A._23;
+    return result;
+}
+
+LINALG_INLINE vec2d_t mat2x3d_transform_affine(mat2x3d_t M, vec2d_t p) {
+    vec2d_t result;
+    result.e[0] = M._11 * p.e[0] + M._12 * p.e[1] + M._13;
+    result.e[1] = M._21 * p.e[0] + M._22 * p.e[1] + M._23;
+    return result;
+}
+
+LINALG_DEF void mat2x3d_transform_affine_array(const mat2x3d_t *M,
+                                               const vec2d_t *restrict in,
+                                               vec2d_t *restrict out, size_t n);
+
+LINALG_INLINE mat2x4d_t mat2x4d_zero(void) {
+    mat2x4d_t M = {0};
+    return M;
+}
+
+LINALG_INLINE mat2x4d_t mat2x4d_I(void) {
+    mat2x4d_t M = {0};
+    M._11 = 1;
+    M._22 = 1;
+    return M;
+}
+
+LINALG_INLINE vec2d_t mat2x4d_mul_vec(mat2x4d_t M, vec4d_t v) {
+    vec2d_t result;
+    result.e[0] = M._11 * v.e[0] + M._12 * v.e[1] + M._13 * v.e[2] + M._14 *
+                  v.e[3];
+    result.e[1] = M._21 * v.e[0] + M._22 * v.e[1] + M._23 * v.e[2] + M._24 *
+                  v.e[3];
+    return result;
+}
+
+LINALG_INLINE mat4x2d_t mat2x4d_transpose(mat2x4d_t M) {
+    mat4x2d_t result;
+    result._11 = M._11;
+    result._21 = M._12;
+    result._31 = M._13;
+    result._41 = M._14;
+    result._12 = M._21;
+    result._22 = M._22;
+    result._32 = M._23;
+    result._42 = M._24;
+    return result;
+}
+
+LINALG_INLINE mat2x3d_t mat2d_mul_mat2x3d(mat2d_t A, mat2x3d_t B) {
+    mat2x3d_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21;
+    result._12 = A._11 * B._12 + A._12 * B._22;
+    result._13 = A._11 * B._13 + A._12 * B._23;
+    result._21 = A._21 * B._11 + A._22 * B._21;
+    result._22 = A._21 * B._12 + A._22 * B._22;
+    result._23 = A._21 * B._13 + A._22 * B._23;
+    return result;
+}
+
+LINALG_INLINE mat2x4d_t mat2d_mul_mat2x4d(mat2d_t A, mat2x4d_t B) {
+    mat2x4d_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21;
+    result._12 = A._11 * B._12 + A._12 * B._22;
+    result._13 = A._11 * B._13 + A._12 * B._23;
+    result._14 = A._11 * B._14 + A._12 * B._24;
+    result._21 = A._21 * B._11 + A._22 * B._21;
+    result._22 = A._21 * B._12 + A._22 * B._22;
+    result._23 = A._21 * B._13 + A._22 * B._23;
+    result._24 = A._21 * B._14 + A._22 * B._24;
+    return result;
+}
+
+LINALG_INLINE mat2d_t mat2x3d_mul_mat3x2d(mat2x3d_t A, mat3x2d_t B) {
+    mat2d_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21 + A._13 * B._31;
+    result._12 = A._11 * B._12 + A._12 * B._22 + A._13 * B._32;
+    result._21 = A._21 * B._11 + A._22 * B._21 + A._23 * B._31;
+    result._22 = A._21 * B._12 + A._22 * B._22 + A._23 * B._32;
+    return result;
+}
+
+LINALG_INLINE mat2x3d_t mat2x3d_mul_mat3d(mat2x3d_t A, mat3d_t B) {
+    mat2x3d_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21 + A._13 * B._31;
+    result._12 = A._11 * B._12 + A._12 * B._22 + A._13 * B._32;
+    result._13 = A._11 * B._13 + A._12 * B._23 + A._13 * B._33;
+    result._21 = A._21 * B._11 + A._22 * B._21 + A._23 * B._31;
+    result._22 = A._21 * B._12 + A._22 * B._22 + A._23 * B._32;
+    result._23 = A._21 * B._13 + A._22 * B._23 + A._23 * B._33;
+    return result;
+}
+
+LINALG_INLINE mat2x4d_t mat2x3d_mul_mat3x4d(mat2x3d_t A, mat3x4d_t B) {
+    mat2x4d_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21 + A._13 * B._31;
+    result._12 = A._11 * B._12 + A._12 * B._22 + A._13 * B._32;
+    result._13 = A._11 * B._13 + A._12 * B._23 + A._13 * B._33;
+    result._14 = A._11 * B._14 + A._12 * B._24 + A._13 * B._34;
+    result._21 = A._21 * B._11 + A._22 * B._21 + A._23 * B._31;
+    result._22 = A._21 * B._12 + A._22 * B._22 + A._23 * B._32;
+    result._23 = A._21 * B._13 + A._22 * B._23 + A._23 * B._33;
+    result._24 = A._21 * B._14 + A._22 * B._24 + A._23 * B._34;
+    return result;
+}
+
+LINALG_INLINE mat2d_t mat2x4d_mul_mat4x2d(mat2x4d_t A, mat4x2d_t B) {
+    mat2d_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21 + A._13 * B._31 + A._14 * B._41;
+    result._12 = A._11 * B._12 + A._12 * B._22 + A._13 * B._32 + A._14 * B._42;
+    result._21 = A._21 * B._11 + A._22 * B._21 + A._23 * B._31 + A._24 * B._41;
+    result._22 = A._21 * B._12 + A._22 * B._22 + A._23 * B._32 + A._24 * B._42;
+    return result;
+}
+
+LINALG_INLINE mat2x3d_t mat2x4d_mul_mat4x3d(mat2x4d_t A, mat4x3d_t B) {
+    mat2x3d_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21 + A._13 * B._31 + A._14 * B._41;
+    result._12 = A._11 * B._12 + A._12 * B._22 + A._13 * B._32 + A._14 * B._42;
+    result._13 = A._11 * B._13 + A._12 * B._23 + A._13 * B._33 + A._14 * B._43;
+    result._21 = A._21 * B._11 + A._22 * B._21 + A._23 * B._31 + A._24 * B._41;
+    result._22 = A._21 * B._12 + A._22 * B._22 + A._23 * B._32 + A._24 * B._42;
+    result._23 = A._21 * B._13 + A._22 * B._23 + A._23 * B._33 + A._24 * B._43;
+    return result;
+}
+
+LINALG_INLINE mat2x4d_t mat2x4d_mul_mat4d(mat2x4d_t A, mat4d_t B) {
+    mat2x4d_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21 + A._13 * B._31 + A._14 * B._41;
+    result._12 = A._11 * B._12 + A._12 * B._22 + A._13 * B._32 + A._14 * B._42;
+    result._13 = A._11 * B._13 + A._12 * B._23 + A._13 * B._33 + A._14 * B._43;
+    result._14 = A._11 * B._14 + A._12 * B._24 + A._13 * B._34 + A._14 * B._44;
+    result._21 = A._21 * B._11 + A._22 * B._21 + A._23 * B._31 + A._24 * B._41;
+    result._22 = A._21 * B._12 + A._22 * B._22 + A._23 * B._32 + A._24 * B._42;
+    result._23 = A._21 * B._13 + A._22 * B._23 + A._23 * B._33 + A._24 * B._43;
+    result._24 = A._21 * B._14 + A._22 * B._24 + A._23 * B._34 + A._24 * B._44;
+    return result;
+}
+
+LINALG_INLINE mat2x3i_t mat2x3i_zero(void) {
+    mat2x3i_t M = {0};
+    return M;
+}
+
+LINALG_INLINE mat2x3i_t mat2x3i_I(void) {
+    mat2x3i_t M = {0};
+    M._11 = 1;
+    M._22 = 1;
+    return M;
+}
+
+LINALG_INLINE vec2i_t mat2x3i_mul_vec(mat2x3i_t M, vec3i_t v) {
+    vec2i_t result;
+    result.e[0] = M._11 * v.e[0] + M._12 * v.e[1] + M._13 * v.e[2];
+    result.e[1] = M._21 * v.e[0] + M._22 * v.e[1] + M._23 * v.e[2];
+    return result;
+}
+
+LINALG_INLINE mat3x2i_t mat2x3i_transpose(mat2x3i_t M) {
+    mat3x2i_t result;
+    result._11 = M._11;
+    result._21 = M._12;
+    result._31 = M._13;
+    result._12 = M._21;
+    result._22 = M._22;
+    result._32 = M._23;
+    return result;
+}
+
+LINALG_INLINE mat2x3i_t mat2x3i_from_mat3i(mat3i_t M) {
+    mat2x3i_t result;
+    result._11 = M._11;
+    result._12 = M._12;
+    result._13 = M._13;
+    result._21 = M._21;
+    result._22 = M._22;
+    result._23 = M._23;
+    return result;
+}
+
+LINALG_INLINE mat3i_t mat2x3i_to_mat3i(mat2x3i_t M) {
+    mat3i_t result = {0};
+    result._11 = M._11;
+    result._12 = M._12;
+    result._13 = M._13;
+    result._21 = M._21;
+    result._22 = M._22;
+    result._23 = M._23;
+    result._33 = 1;
+    return result;
+}
+
+LINALG_INLINE mat2x3i_t mat2x3i_mul_affine(mat2x3i_t A, mat2x3i_t B) {
+    mat2x3i_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21;
+    result._12 = A._11 * B._12 + A._12 * B._22;
+    result._13 = A._11 * B._13 + A._12 * B._23 + A._13;
+    result._21 = A._21 * B._11 + A._22 * B._21;
+    result._22 = A._21 * B._12 + A._22 * B._22;
+    result._23 = A._21 * B._13 + A._22 * B._23 + A._23;
+    return result;
+}
+
+LINALG_INLINE vec2i_t mat2x3i_transform_affine(mat2x3i_t M, vec2i_t p) {
+    vec2i_t result;
+    result.e[0] = M._11 * p.e[0] + M._12 * p.e[1] + M._13;
+    result.e[1] = M._21 * p.e[0] + M._22 * p.e[1] + M._23;
+    return result;
+}
+
+LINALG_DEF void mat2x3i_transform_affine_array(const mat2x3i_t *M,
+                                               const vec2i_t *restrict in,
+                                               vec2i_t *restrict out, size_t n);
+
+LINALG_INLINE mat2x4i_t mat2x4i_zero(void) {
+    mat2x4i_t M = {0};
+    return M;
+}
+
+LINALG_INLINE mat2x4i_t mat2x4i_I(void) {
+    mat2x4i_t M = {0};
+    M._11 = 1;
+    M._22 = 1;
+    return M;
+}
+
+LINALG_INLINE vec2i_t mat2x4i_mul_vec(mat2x4i_t M, vec4i_t v) {
+    vec2i_t result;
+    result.e[0] = M._11 * v.e[0] + M._12 * v.e[1] + M._13 * v.e[2] + M._14 *
+                  v.e[3];
+    result.e[1] = M._21 * v.e[0] + M._22 * v.e[1] + M._23 * v.e[2] + M._24 *
+                  v.e[3];
+    return result;
+}
+
+LINALG_INLINE mat4x2i_t mat2x4i_transpose(mat2x4i_t M) {
+    mat4x2i_t result;
+    result._11 = M._11;
+    result._21 = M._12;
+    result._31 = M._13;
+    result._41 = M._14;
+    result._12 = M._21;
+    result._22 = M._22;
+    result._32 = M._23;
+    result._42 = M._24;
+    return result;
+}
+
+LINALG_INLINE mat2x3i_t mat2i_mul_mat2x3i(mat2i_t A, mat2x3i_t B) {
+    mat2x3i_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21;
+    result._12 = A._11 * B._12 + A._12 * B._22;
+    result._13 = A._11 * B._13 + A._12 * B._23;
+    result._21 = A._21 * B._11 + A._22 * B._21;
+    result._22 = A._21 * B._12 + A._22 * B._22;
+    result._23 = A._21 * B._13 + A._22 * B._23;
+    return result;
+}
+
+LINALG_INLINE mat2x4i_t mat2i_mul_mat2x4i(mat2i_t A, mat2x4i_t B) {
+    mat2x4i_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21;
+    result._12 = A._11 * B._12 + A._12 * B._22;
+    result._13 = A._11 * B._13 + A._12 * B._23;
+    result._14 = A._11 * B._14 + A._12 * B._24;
+    result._21 = A._21 * B._11 + A._22 * B._21;
+    result._22 = A._21 * B._12 + A._22 * B._22;
+    result._23 = A._21 * B._13 + A._22 * B._23;
+    result._24 = A._21 * B._14 + A._22 * B._24;
+    return result;
+}
+
+LINALG_INLINE mat2i_t mat2x3i_mul_mat3x2i(mat2x3i_t A, mat3x2i_t B) {
+    mat2i_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21 + A._13 * B._31;
+    result._12 = A._11 * B._12 + A._12 * B._22 + A._13 * B._32;
+    result._21 = A._21 * B._11 + A._22 * B._21 + A._23 * B._31;
+    result._22 = A._21 * B._12 + A._22 * B._22 + A._23 * B._32;
+    return result;
+}
+
+LINALG_INLINE mat2x3i_t mat2x3i_mul_mat3i(mat2x3i_t A, mat3i_t B) {
+    mat2x3i_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21 + A._13 * B._31;
+    result._12 = A._11 * B._12 + A._12 * B._22 + A._13 * B._32;
+    result._13 = A._11 * B._13 + A._12 * B._23 + A._13 * B._33;
+    result._21 = A._21 * B._11 + A._22 * B._21 + A._23 * B._31;
+    result._22 = A._21 * B._12 + A._22 * B._22 + A._23 * B._32;
+    result._23 = A._21 * B._13 + A._22 * B._23 + A._23 * B._33;
+    return result;
+}
+
+LINALG_INLINE mat2x4i_t mat2x3i_mul_mat3x4i(mat2x3i_t A, mat3x4i_t B) {
+    mat2x4i_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21 + A._13 * B._31;
+    result._12 = A._11 * B._12 + A._12 * B._22 + A._13 * B._32;
+    result._13 = A._11 * B._13 + A._12 * B._23 + A._13 * B._33;
+    result._14 = A._11 * B._14 + A._12 * B._24 + A._13 * B._34;
+    result._21 = A._21 * B._11 + A._22 * B._21 + A._23 * B._31;
+    result._22 = A._21 * B._12 + A._22 * B._22 + A._23 * B._32;
+    result._23 = A._21 * B._13 + A._22 * B._23 + A._23 * B._33;
+    result._24 = A._21 * B._14 + A._22 * B._24 + A._23 * B._34;
+    return result;
+}
+
+LINALG_INLINE mat2i_t mat2x4i_mul_mat4x2i(mat2x4i_t A, mat4x2i_t B) {
+    mat2i_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21 + A._13 * B._31 + A._14 * B._41;
+    result._12 = A._11 * B._12 + A._12 * B._22 + A._13 * B._32 + A._14 * B._42;
+    result._21 = A._21 * B._11 + A._22 * B._21 + A._23 * B._31 + A._24 * B._41;
+    result._22 = A._21 * B._12 + A._22 * B._22 + A._23 * B._32 + A._24 * B._42;
+    return result;
+}
+
+LINALG_INLINE mat2x3i_t mat2x4i_mul_mat4x3i(mat2x4i_t A, mat4x3i_t B) {
+    mat2x3i_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21 + A._13 * B._31 + A._14 * B._41;
+    result._12 = A._11 * B._12 + A._12 * B._22 + A._13 * B._32 + A._14 * B._42;
+    result._13 = A._11 * B._13 + A._12 * B._23 + A._13 * B._33 + A._14 * B._43;
+    result._21 = A._21 * B._11 + A._22 * B._21 + A._23 * B._31 + A._24 * B._41;
+    result._22 = A._21 * B._12 + A._22 * B._22 + A._23 * B._32 + A._24 * B._42;
+    result._23 = A._21 * B._13 + A._22 * B._23 + A._23 * B._33 + A._24 * B._43;
+    return result;
+}
+
+LINALG_INLINE mat2x4i_t mat2x4i_mul_mat4i(mat2x4i_t A, mat4i_t B) {
+    mat2x4i_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21 + A._13 * B._31 + A._14 * B._41;
+    result._12 = A._11 * B._12 + A._12 * B._22 + A._13 * B._32 + A._14 * B._42;
+    result._13 = A._11 * B._13 + A._12 * B._23 + A._13 * B._33 + A._14 * B._43;
+    result._14 = A._11 * B._14 + A._12 * B._24 + A._13 * B._34 + A._14 * B._44;
+    result._21 = A._21 * B._11 + A._22 * B._21 + A._23 * B._31 + A._24 * B._41;
+    result._22 = A._21 * B._12 + A._22 * B._22 + A._23 * B._32 + A._24 * B._42;
+    result._23 = A._21 * B._13 + A._22 * B._23 + A._23 * B._33 + A._24 * B._43;
+    result._24 = A._21 * B._14 + A._22 * B._24 + A._23 * B._34 + A._24 * B._44;
+    return result;
+}
+
+LINALG_INLINE mat2x3u_t mat2x3u_zero(void) {
+    mat2x3u_t M = {0};
+    return M;
+}
+
+LINALG_INLINE mat2x3u_t mat2x3u_I(void) {
+    mat2x3u_t M = {0};
+    M._11 = 1;
+    M._22 = 1;
+    return M;
+}
+
+LINALG_INLINE vec2u_t mat2x3u_mul_vec(mat2x3u_t M, vec3u_t v) {
+    vec2u_t result;
+    result.e[0] = M._11 * v.e[0] + M._12 * v.e[1] + M._13 * v.e[2];
+    result.e[1] = M._21 * v.e[0] + M._22 * v.e[1] + M._23 * v.e[2];
+    return result;
+}
+
+LINALG_INLINE mat3x2u_t mat2x3u_transpose(mat2x3u_t M) {
+    mat3x2u_t result;
+    result._11 = M._11;
+    result._21 = M._12;
+    result._31 = M._13;
+    result._12 = M._21;
+    result._22 = M._22;
+    result._32 = M._23;
+    return result;
+}
+
+LINALG_INLINE mat2x3u_t mat2x3u_from_mat3u(mat3u_t M) {
+    mat2x3u_t result;
+    result._11 = M._11;
+    result._12 = M._12;
+    result._13 = M._13;
+    result._21 = M._21;
+    result._22 = M._22;
+    result._23 = M._23;
+    return result;
+}
+
+LINALG_INLINE mat3u_t mat2x3u_to_mat3u(mat2x3u_t M) {
+    mat3u_t result = {0};
+    result._11 = M._11;
+    result._12 = M._12;
+    result._13 = M._13;
+    result._21 = M._21;
+    result._22 = M._22;
+    result._23 = M._23;
+    result._33 = 1;
+    return result;
+}
+
+LINALG_INLINE mat2x3u_t mat2x3u_mul_affine(mat2x3u_t A, mat2x3u_t B) {
+    mat2x3u_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21;
+    result._12 = A._11 * B._12 + A._12 * B._22;
+    result._13 = A._11 * B._13 + A._12 * B._23 + A._13;
+    result._21 = A._21 * B._11 + A._22 * B._21;
+    result._22 = A._21 * B._12 + A._22 * B._22;
+    result._23 = A._21 * B._13 + A._22 * B._23 + A._23;
+    return result;
+}
+
+LINALG_INLINE vec2u_t mat2x3u_transform_affine(mat2x3u_t M, vec2u_t p) {
+    vec2u_t result;
+    result.e[0] = M._11 * p.e[0] + M._12 * p.e[1] + M._13;
+    result.e[1] = M._21 * p.e[0] + M._22 * p.e[1] + M._23;
+    return result;
+}
+
+LINALG_DEF void mat2x3u_transform_affine_array(const mat2x3u_t *M,
+                                               const vec2u_t *restrict in,
+                                               vec2u_t *restrict out, size_t n);
+
+LINALG_INLINE mat2x4u_t mat2x4u_zero(void) {
+    mat2x4u_t M = {0};
+    return M;
+}
+
+LINALG_INLINE mat2x4u_t mat2x4u_I(void) {
+    mat2x4u_t M = {0};
+    M._11 = 1;
+    M._22 = 1;
+    return M;
+}
+
+LINALG_INLINE vec2u_t mat2x4u_mul_vec(mat2x4u_t M, vec4u_t v) {
+    vec2u_t result;
+    result.e[0] = M._11 * v.e[0] + M._12 * v.e[1] + M._13 * v.e[2] + M._14 *
+                  v.e[3];
+    result.e[1] = M._21 * v.e[0] + M._22 * v.e[1] + M._23 * v.e[2] + M._24 *
+                  v.e[3];
+    return result;
+}
+
+LINALG_INLINE mat4x2u_t mat2x4u_transpose(mat2x4u_t M) {
+    mat4x2u_t result;
+    result._11 = M._11;
+    result._21 = M._12;
+    result._31 = M._13;
+    result._41 = M._14;
+    result._12 = M._21;
+    result._22 = M._22;
+    result._32 = M._23;
+    result._42 = M._24;
+    return result;
+}
+
+LINALG_INLINE mat2x3u_t mat2u_mul_mat2x3u(mat2u_t A, mat2x3u_t B) {
+    mat2x3u_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21;
+    result._12 = A._11 * B._12 + A._12 * B._22;
+    result._13 = A._11 * B._13 + A._12 * B._23;
+    result._21 = A._21 * B._11 + A._22 * B._21;
+    result._22 = A._21 * B._12 + A._22 * B._22;
+    result._23 = A._21 * B._13 + A._22 * B._23;
+    return result;
+}
+
+LINALG_INLINE mat2x4u_t mat2u_mul_mat2x4u(mat2u_t A, mat2x4u_t B) {
+    mat2x4u_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21;
+    result._12 = A._11 * B._12 + A._12 * B._22;
+    result._13 = A._11 * B._13 + A._12 * B._23;
+    result._14 = A._11 * B._14 + A._12 * B._24;
+    result._21 = A._21 * B._11 + A._22 * B._21;
+    result._22 = A._21 * B._12 + A._22 * B._22;
+    result._23 = A._21 * B._13 + A._22 * B._23;
+    result._24 = A._21 * B._14 + A._22 * B._24;
+    return result;
+}
+
+LINALG_INLINE mat2u_t mat2x3u_mul_mat3x2u(mat2x3u_t A, mat3x2u_t B) {
+    mat2u_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21 + A._13 * B._31;
+    result._12 = A._11 * B._12 + A._12 * B._22 + A._13 * B._32;
+    result._21 = A._21 * B._11 + A._22 * B._21 + A._23 * B._31;
+    result._22 = A._21 * B._12 + A._22 * B._22 + A._23 * B._32;
+    return result;
+}
+
+LINALG_INLINE mat2x3u_t mat2x3u_mul_mat3u(mat2x3u_t A, mat3u_t B) {
+    mat2x3u_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21 + A._13 * B._31;
+    result._12 = A._11 * B._12 + A._12 * B._22 + A._13 * B._32;
+    result._13 = A._11 * B._13 + A._12 * B._23 + A._13 * B._33;
+    result._21 = A._21 * B._11 + A._22 * B._21 + A._23 * B._31;
+    result._22 = A._21 * B._12 + A._22 * B._22 + A._23 * B._32;
+    result._23 = A._21 * B._13 + A._22 * B._23 + A._23 * B._33;
+    return result;
+}
+
+LINALG_INLINE mat2x4u_t mat2x3u_mul_mat3x4u(mat2x3u_t A, mat3x4u_t B) {
+    mat2x4u_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21 + A._13 * B._31;
+    result._12 = A._11 * B._12 + A._12 * B._22 + A._13 * B._32;
+    result._13 = A._11 * B._13 + A._12 * B._23 + A._13 * B._33;
+    result._14 = A._11 * B._14 + A._12 * B._24 + A._13 * B._34;
+    result._21 = A._21 * B._11 + A._22 * B._21 + A._23 * B._31;
+    result._22 = A._21 * B._12 + A._22 * B._22 + A._23 * B._32;
+    result._23 = A._21 * B._13 + A._22 * B._23 + A._23 * B._33;
+    result._24 = A._21 * B._14 + A._22 * B._24 + A._23 * B._34;
+    return result;
+}
+
+LINALG_INLINE mat2u_t mat2x4u_mul_mat4x2u(mat2x4u_t A, mat4x2u_t B) {
+    mat2u_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21 + A._13 * B._31 + A._14 * B._41;
+    result._12 = A._11 * B._12 + A._12 * B._22 + A._13 * B._32 + A._14 * B._42;
+    result._21 = A._21 * B._11 + A._22 * B._21 + A._23 * B._31 + A._24 * B._41;
+    result._22 = A._21 * B._12 + A._22 * B._22 + A._23 * B._32 + A._24 * B._42;
+    return result;
+}
+
+LINALG_INLINE mat2x3u_t mat2x4u_mul_mat4x3u(mat2x4u_t A, mat4x3u_t B) {
+    mat2x3u_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21 + A._13 * B._31 + A._14 * B._41;
+    result._12 = A._11 * B._12 + A._12 * B._22 + A._13 * B._32 + A._14 * B._42;
+    result._13 = A._11 * B._13 + A._12 * B._23 + A._13 * B._33 + A._14 * B._43;
+    result._21 = A._21 * B._11 + A._22 * B._21 + A._23 * B._31 + A._24 * B._41;
+    result._22 = A._21 * B._12 + A._22 * B._22 + A._23 * B._32 + A._24 * B._42;
+    result._23 = A._21 * B._13 + A._22 * B._23 + A._23 * B._33 + A._24 * B._43;
+    return result;
+}
+
+LINALG_INLINE mat2x4u_t mat2x4u_mul_mat4u(mat2x4u_t A, mat4u_t B) {
+    mat2x4u_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21 + A._13 * B._31 + A._14 * B._41;
+    result._12 = A._11 * B._12 + A._12 * B._22 + A._13 * B._32 + A._14 * B._42;
+    result._13 = A._11 * B._13 + A._12 * B._23 + A._13 * B._33 + A._14 * B._43;
+    result._14 = A._11 * B._14 + A._12 * B._24 + A._13 * B._34 + A._14 * B._44;
+    result._21 = A._21 * B._11 + A._22 * B._21 + A._23 * B._31 + A._24 * B._41;
+    result._22 = A._21 * B._12 + A._22 * B._22 + A._23 * B._32 + A._24 * B._42;
+    result._23 = A._21 * B._13 + A._22 * B._23 + A._23 * B._33 + A._24 * B._43;
+    result._24 = A._21 * B._14 + A._22 * B._24 + A._23 * B._34 + A._24 * B._44;
+    return result;
+}
+
+LINALG_INLINE mat3x2f_t mat3x2f_zero(void) {
+    mat3x2f_t M = {0};
+    return M;
+}
+
+LINALG_INLINE mat3x2f_t mat3x2f_I(void) {
+    mat3x2f_t M = {0};
+    M._11 = 1;
+    M._22 = 1;
+    return M;
+}
+
+LINALG_INLINE vec3f_t mat3x2f_mul_vec(mat3x2f_t M, vec2f_t v) {
+    vec3f_t result;
+    result.e[0] = M._11 * v.e[0] + M._12 * v.e[1];
+    result.e[1] = M._21 * v.e[0] + M._22 * v.e[1];
+    result.e[2] = M._31 * v.e[0] + M._32 * v.e[1];
+    return result;
+}
+
+LINALG_INLINE mat2x3f_t mat3x2f_transpose(mat3x2f_t M) {
+    mat2x3f_t result;
+    result._11 = M._11;
+    result._21 = M._12;
+    result._12 = M._21;
+    result._22 = M._22;
+    result._13 = M._31;
+    result._23 = M._32;
+    return result;
+}
+
+LINALG_INLINE mat3x4f_t mat3x4f_zero(void) {
+    mat3x4f_t M = {0};
+    return M;
+}
+
+LINALG_INLINE mat3x4f_t mat3x4f_I(void) {
+    mat3x4f_t M = {0};
+    M._11 = 1;
+    M._22 = 1;
+    M._33 = 1;
+    return M;
+}
+
+LINALG_INLINE vec3f_t mat3x4f_mul_vec(mat3x4f_t M, vec4f_t v) {
+    vec3f_t result;
+    result.e[0] = M._11 * v.e[0] + M._12 * v.e[1] + M._13 * v.e[2] + M._14 *
+                  v.e[3];
+    result.e[1] = M._21 * v.e[0] + M._22 * v.e[1] + M._23 * v.e[2] + M._24 *
+                  v.e[3];
+    result.e[2] = M._31 * v.e[0] + M._32 * v.e[1] + M._33 * v.e[2] + M._34 *
+                  v.e[3];
+    return result;
+}
+
+LINALG_INLINE mat4x3f_t mat3x4f_transpose(mat3x4f_t M) {
+    mat4x3f_t result;
+    result._11 = M._11;
+    result._21 = M._12;
+    result._31 = M._13;
+    result._41 = M._14;
+    result._12 = M._21;
+    result._22 = M._22;
+    result._32 = M._23;
+    result._42 = M._24;
+    result._13 = M._31;
+    result._23 = M._32;
+    result._33 = M._33;
+    result._43 = M._34;
+    return result;
+}
+
+LINALG_INLINE mat3x4f_t mat3x4f_from_mat4f(mat4f_t M) {
+    mat3x4f_t result;
+    result._11 = M._11;
+    result._12 = M._12;
+    result._13 = M._13;
+    result._14 = M._14;
+    result._21 = M._21;
+    result._22 = M._22;
+    result._23 = M._23;
+    result._24 = M._24;
+    result._31 = M._31;
+    result._32 = M._32;
+    result._33 = M._33;
+    result._34 = M._34;
+    return result;
+}
+
+LINALG_INLINE mat4f_t mat3x4f_to_mat4f(mat3x4f_t M) {
+    mat4f_t result = {0};
+    result._11 = M._11;
+    result._12 = M._12;
+    result._13 = M._13;
+    result._14 = M._14;
+    result._21 = M._21;
+    result._22 = M._22;
+    result._23 = M._23;
+    result._24 = M._24;
+    result._31 = M._31;
+    result._32 = M._32;
+    result._33 = M._33;
+    result._34 = M._34;
+    result._44 = 1;
+    return result;
+}
+
+LINALG_DEF mat3x4f_t mat3x4f_mul_affine(mat3x4f_t A, mat3x4f_t B);
+
+LINALG_INLINE vec3f_t mat3x4f_transform_affine(mat3x4f_t M, vec3f_t p) {
+    vec3f_t result;
+    result.e[0] = M._11 * p.e[0] + M._12 * p.e[1] + M._13 * p.e[2] + M._14;
+    result.e[1] = M._21 * p.e[0] + M._22 * p.e[1] + M._23 * p.e[2] + M._24;
+    result.e[2] = M._31 * p.e[0] + M._32 * p.e[1] + M._33 * p.e[2] + M._34;
+    return result;
+}
+
+LINALG_DEF void mat3x4f_transform_affine_array(const mat3x4f_t *M,
+                                               const vec3f_t *restrict in,
+                                               vec3f_t *restrict out, size_t n);
+
+LINALG_INLINE mat3x2f_t mat3x2f_mul_mat2f(mat3x2f_t A, mat2f_t B) {
+    mat3x2f_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21;
+    result._12 = A._11 * B._12 + A._12 * B._22;
+    result._21 = A._21 * B._11 + A._22 * B._21;
+    result._22 = A._21 * B._12 + A._22 * B._22;
+    result._31 = A._31 * B._11 + A._32 * B._21;
+    result._32 = A._31 * B._12 + A._32 * B._22;
+    return result;
+}
+
+LINALG_INLINE mat3f_t mat3x2f_mul_mat2x3f(mat3x2f_t A, mat2x3f_t B) {
+    mat3f_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21;
+    result._12 = A._11 * B._12 + A._12 * B._22;
+    result._13 = A._11 * B._13 + A._12 * B._23;
+    result._21 = A._21 * B._11 + A._22 * B._21;
+    result._22 = A._21 * B._12 + A._22 * B._22;
+    result._23 = A._21 * B._13 + A._22 * B._23;
+    result._31 = A._31 * B._11 + A._32 * B._21;
+    result._32 = A._31 * B._12 + A._32 * B._22;
+    result._33 = A._31 * B._13 + A._32 * B._23;
+    return result;
+}
+
+LINALG_INLINE mat3x4f_t mat3x2f_mul_mat2x4f(mat3x2f_t A, mat2x4f_t B) {
+    mat3x4f_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21;
+    result._12 = A._11 * B._12 + A._12 * B._22;
+    result._13 = A._11 * B._13 + A._12 * B._23;
+    result._14 = A._11 * B._14 + A._12 * B._24;
+    result._21 = A._21 * B._11 + A._22 * B._21;
+    result._22 = A._21 * B._12 + A._22 * B._22;
+    result._23 = A._21 * B._13 + A._22 * B._23;
+    result._24 = A._21 * B._14 + A._22 * B._24;
+    result._31 = A._31 * B._11 + A._32 * B._21;
+    result._32 = A._31 * B._12 + A._32 * B._22;
+    result._33 = A._31 * B._13 + A._32 * B._23;
+    result._34 = A._31 * B._14 + A._32 * B._24;
+    return result;
+}
+
+LINALG_INLINE mat3x2f_t mat3f_mul_mat3x2f(mat3f_t A, mat3x2f_t B) {
+    mat3x2f_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21 + A._13 * B._31;
+    result._12 = A._11 * B._12 + A._12 * B._22 + A._13 * B._32;
+    result._21 = A._21 * B._11 + A._22 * B._21 + A._23 * B._31;
+    result._22 = A._21 * B._12 + A._22 * B._22 + A._23 * B._32;
+    result._31 = A._31 * B._11 + A._32 * B._21 + A._33 * B._31;
+    result._32 = A._31 * B._12 + A._32 * B._22 + A._33 * B._32;
+    return result;
+}
+
+LINALG_INLINE mat3x4f_t mat3f_mul_mat3x4f(mat3f_t A, mat3x4f_t B) {
+    mat3x4f_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21 + A._13 * B._31;
+    result._12 = A._11 * B._12 + A._12 * B._22 + A._13 * B._32;
+    result._13 = A._11 * B._13 + A._12 * B._23 + A._13 * B._33;
+    result._14 = A._11 * B._14 + A._12 * B._24 + A._13 * B._34;
+    result._21 = A._21 * B._11 + A._22 * B._21 + A._23 * B._31;
+    result._22 = A._21 * B._12 + A._22 * B._22 + A._23 * B._32;
+    result._23 = A._21 * B._13 + A._22 * B._23 + A._23 * B._33;
+    result._24 = A._21 * B._14 + A._22 * B._24 + A._23 * B._34;
+    result._31 = A._31 * B._11 + A._32 * B._21 + A._33 * B._31;
+    result._32 = A._31 * B._12 + A._32 * B._22 + A._33 * B._32;
+    result._33 = A._31 * B._13 + A._32 * B._23 + A._33 * B._33;
+    result._34 = A._31 * B._14 + A._32 * B._24 + A._33 * B._34;
+    return result;
+}
+
+LINALG_INLINE mat3x2f_t mat3x4f_mul_mat4x2f(mat3x4f_t A, mat4x2f_t B) {
+    mat3x2f_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21 + A._13 * B._31 + A._14 * B._41;
+    result._12 = A._11 * B._12 + A._12 * B._22 + A._13 * B._32 + A._14 * B._42;
+    result._21 = A._21 * B._11 + A._22 * B._21 + A._23 * B._31 + A._24 * B._41;
+    result._22 = A._21 * B._12 + A._22 * B._22 + A._23 * B._32 + A._24 * B._42;
+    result._31 = A._31 * B._11 + A._32 * B._21 + A._33 * B._31 + A._34 * B._41;
+    result._32 = A._31 * B._12 + A._32 * B._22 + A._33 * B._32 + A._34 * B._42;
+    return result;
+}
+
+LINALG_INLINE mat3f_t mat3x4f_mul_mat4x3f(mat3x4f_t A, mat4x3f_t B) {
+    mat3f_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21 + A._13 * B._31 + A._14 * B._41;
+    result._12 = A._11 * B._12 + A._12 * B._22 + A._13 * B._32 + A._14 * B._42;
+    result._13 = A._11 * B._13 + A._12 * B._23 + A._13 * B._33 + A._14 * B._43;
+    result._21 = A._21 * B._11 + A._22 * B._21 + A._23 * B._31 + A._24 * B._41;
+    result._22 = A._21 * B._12 + A._22 * B._22 + A._23 * B._32 + A._24 * B._42;
+    result._23 = A._21 * B._13 + A._22 * B._23 + A._23 * B._33 + A._24 * B._43;
+    result._31 = A._31 * B._11 + A._32 * B._21 + A._33 * B._31 + A._34 * B._41;
+    result._32 = A._31 * B._12 + A._32 * B._22 + A._33 * B._32 + A._34 * B._42;
+    result._33 = A._31 * B._13 + A._32 * B._23 + A._33 * B._33 + A._34 * B._43;
+    return result;
+}
+
+LINALG_INLINE mat3x4f_t mat3x4f_mul_mat4f(mat3x4f_t A, mat4f_t B) {
+    mat3x4f_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21 + A._13 * B._31 + A._14 * B._41;
+    result._12 = A._11 * B._12 + A._12 * B._22 + A._13 * B._32 + A._14 * B._42;
+    result._13 = A._11 * B._13 + A._12 * B._23 + A._13 * B._33 + A._14 * B._43;
+    result._14 = A._11 * B._14 + A._12 * B._24 + A._13 * B._34 + A._14 * B._44;
+    result._21 = A._21 * B._11 + A._22 * B._21 + A._23 * B._31 + A._24 * B._41;
+    result._22 = A._21 * B._12 + A._22 * B._22 + A._23 * B._32 + A._24 * B._42;
+    result._23 = A._21 * B._13 + A._22 * B._23 + A._23 * B._33 + A._24 * B._43;
+    result._24 = A._21 * B._14 + A._22 * B._24 + A._23 * B._34 + A._24 * B._44;
+    result._31 = A._31 * B._11 + A._32 * B._21 + A._33 * B._31 + A._34 * B._41;
+    result._32 = A._31 * B._12 + A._32 * B._22 + A._33 * B._32 + A._34 * B._42;
+    result._33 = A._31 * B._13 + A._32 * B._23 + A._33 * B._33 + A._34 * B._43;
+    result._34 = A._31 * B._14 + A._32 * B._24 + A._33 * B._34 + A._34 * B._44;
+    return result;
+}
+
+LINALG_INLINE mat3x2d_t mat3x2d_zero(void) {
+    mat3x2d_t M = {0};
+    return M;
+}
+
+LINALG_INLINE mat3x2d_t mat3x2d_I(void) {
+    mat3x2d_t M = {0};
+    M._11 = 1;
+    M._22 = 1;
+    return M;
+}
+
+LINALG_INLINE vec3d_t mat3x2d_mul_vec(mat3x2d_t M, vec2d_t v) {
+    vec3d_t result;
+    result.e[0] = M._11 * v.e[0] + M._12 * v.e[1];
+    result.e[1] = M._21 * v.e[0] + M._22 * v.e[1];
+    result.e[2] = M._31 * v.e[0] + M._32 * v.e[1];
+    return result;
+}
+
+LINALG_INLINE mat2x3d_t mat3x2d_transpose(mat3x2d_t M) {
+    mat2x3d_t result;
+    result._11 = M._11;
+    result._21 = M._12;
+    result._12 = M._21;
+    result._22 = M._22;
+    result._13 = M._31;
+    result._23 = M._32;
+    return result;
+}
+
+LINALG_INLINE mat3x4d_t mat3x4d_zero(void) {
+    mat3x4d_t M = {0};
+    return M;
+}
+
+LINALG_INLINE mat3x4d_t mat3x4d_I(void) {
+    mat3x4d_t M = {0};
+    M._11 = 1;
+    M._22 = 1;
+    M._33 = 1;
+    return M;
+}
+
+LINALG_INLINE vec3d_t mat3x4d_mul_vec(mat3x4d_t M, vec4d_t v) {
+    vec3d_t result;
+    result.e[0] = M._11 * v.e[0] + M._12 * v.e[1] + M._13 * v.e[2] + M._14 *
+                  v.e[3];
+    result.e[1] = M._21 * v.e[0] + M._22 * v.e[1] + M._23 * v.e[2] + M._24 *
+                  v.e[3];
+    result.e[2] = M._31 * v.e[0] + M._32 * v.e[1] + M._33 * v.e[2] + M._34 *
+                  v.e[3];
+    return result;
+}
+
+LINALG_INLINE mat4x3d_t mat3x4d_transpose(mat3x4d_t M) {
+    mat4x3d_t result;
+    result._11 = M._11;
+    result._21 = M._12;
+    result._31 = M._13;
+    result._41 = M._14;
+    result._12 = M._21;
+    result._22 = M._22;
+    result._32 = M._23;
+    result._42 = M._24;
+    result._13 = M._31;
+    result._23 = M._32;
+    result._33 = M._33;
+    result._43 = M._34;
+    return result;
+}
+
+LINALG_INLINE mat3x4d_t mat3x4d_from_mat4d(mat4d_t M) {
+    mat3x4d_t result;
+    result._11 = M._11;
+    result._12 = M._12;
+    result._13 = M._13;
+    result._14 = M._14;
+    result._21 = M._21;
+    result._22 = M._22;
+    result._23 = M._23;
+    result._24 = M._24;
+    result._31 = M._31;
+    result._32 = M._32;
+    result._33 = M._33;
+    result._34 = M._34;
+    return result;
+}
+
+LINALG_INLINE mat4d_t mat3x4d_to_mat4d(mat3x4d_t M) {
+    mat4d_t result = {0};
+    result._11 = M._11;
+    result._12 = M._12;
+    result._13 = M._13;
+    result._14 = M._14;
+    result._21 = M._21;
+    result._22 = M._22;
+    result._23 = M._23;
+    result._24 = M._24;
+    result._31 = M._31;
+    result._32 = M._32;
+    result._33 = M._33;
+    result._34 = M._34;
+    result._44 = 1;
+    return result;
+}
+
+LINALG_INLINE mat3x4d_t mat3x4d_mul_affine(mat3x4d_t A, mat3x4d_t B) {
+    mat3x4d_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21 + A._13 * B._31;
+    result._12 = A._11 * B._12 + A._12 * B._22 + A._13 * B._32;
+    result._13 = A._11 * B._13 + A._12 * B._23 + A._13 * B._33;
+    result._14 = A._11 * B._14 + A._12 * B._24 + A._13 * B._34 + A._14;
+    result._21 = A._21 * B._11 + A._22 * B._21 + A._23 * B._31;
+    result._22 = A._21 * B._12 + A._22 * B._22 + A._23 * B._32;
+    result._23 = A._21 * B._13 + A._22 * B._23 + A._23 * B._33;
+    result._24 = A._21 * B._14 + A._22 * B._24 + A._23 * B._34 + A._24;
+    result._31 = A._31 * B._11 + A._32 * B._21 + A._33 * B._31;
+    result._32 = A._31 * B._12 + A._32 * B._22 + A._33 * B._32;
+    result._33 = A._31 * B._13 + A._32 * B._23 + A._33 * B._33;
+    result._34 = A._31 * B._14 + A._32 * B._24 + A._33 * B._34 + A._34;
+    return result;
+}
+
+LINALG_INLINE vec3d_t mat3x4d_transform_affine(mat3x4d_t M, vec3d_t p) {
+    vec3d_t result;
+    result.e[0] = M._11 * p.e[0] + M._12 * p.e[1] + M._13 * p.e[2] + M._14;
+    result.e[1] = M._21 * p.e[0] + M._22 * p.e[1] + M._23 * p.e[2] + M._24;
+    result.e[2] = M._31 * p.e[0] + M._32 * p.e[1] + M._33 * p.e[2] + M._34;
+    return result;
+}
+
+LINALG_DEF void mat3x4d_transform_affine_array(const mat3x4d_t *M,
+                                               const vec3d_t *restrict in,
+                                               vec3d_t *restrict out, size_t n);
+
+LINALG_INLINE mat3x2d_t mat3x2d_mul_mat2d(mat3x2d_t A, mat2d_t B) {
+    mat3x2d_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21;
+    result._12 = A._11 * B._12 + A._12 * B._22;
+    result._21 = A._21 * B._11 + A._22 * B._21;
+    result._22 = A._21 * B._12 + A._22 * B._22;
+    result._31 = A._31 * B._11 + A._32 * B._21;
+    result._32 = A._31 * B._12 + A._32 * B._22;
+    return result;
+}
+
+LINALG_INLINE mat3d_t mat3x2d_mul_mat2x3d(mat3x2d_t A, mat2x3d_t B) {
+    mat3d_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21;
+    result._12 = A._11 * B._12 + A._12 * B._22;
+    result._13 = A._11 * B._13 + A._12 * B._23;
+    result._21 = A._21 * B._11 + A._22 * B._21;
+    result._22 = A._21 * B._12 + A._22 * B._22;
+    result._23 = A._21 * B._13 + A._22 * B._23;
+    result._31 = A._31 * B._11 + A._32 * B._21;
+    result._32 = A._31 * B._12 + A._32 * B._22;
+    result._33 = A._31 * B._13 + A._32 * B._23;
+    return result;
+}
+
+LINALG_INLINE mat3x4d_t mat3x2d_mul_mat2x4d(mat3x2d_t A, mat2x4d_t B) {
+    mat3x4d_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21;
+    result._12 = A._11 * B._12 + A._12 * B._22;
+    result._13 = A._11 * B._13 + A._12 * B._23;
+    result._14 = A._11 * B._14 + A._12 * B._24;
+    result._21 = A._21 * B._11 + A._22 * B._21;
+    result._22 = A._21 * B._12 + A._22 * B._22;
+    result._23 = A._21 * B._13 + A._22 * B._23;
+    result._24 = A._21 * B._14 + A._22 * B._24;
+    result._31 = A._31 * B._11 + A._32 * B._21;
+    result._32 = A._31 * B._12 + A._32 * B._22;
+    result._33 = A._31 * B._13 + A._32 * B._23;
+    result._34 = A._31 * B._14 + A._32 * B._24;
+    return result;
+}
+
+LINALG_INLINE mat3x2d_t mat3d_mul_mat3x2d(mat3d_t A, mat3x2d_t B) {
+    mat3x2d_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21 + A._13 * B._31;
+    result._12 = A._11 * B._12 + A._12 * B._22 + A._13 * B._32;
+    result._21 = A._21 * B._11 + A._22 * B._21 + A._23 * B._31;
+    result._22 = A._21 * B._12 + A._22 * B._22 + A._23 * B._32;
+    result._31 = A._31 * B._11 + A._32 * B._21 + A._33 * B._31;
+    result._32 = A._31 * B._12 + A._32 * B._22 + A._33 * B._32;
+    return result;
+}
+
+LINALG_INLINE mat3x4d_t mat3d_mul_mat3x4d(mat3d_t A, mat3x4d_t B) {
+    mat3x4d_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21 + A._13 * B._31;
+    result._12 = A._11 * B._12 + A._12 * B._22 + A._13 * B._32;
+    result._13 = A._11 * B._13 + A._12 * B._23 + A._13 * B._33;
+    result._14 = A._11 * B._14 + A._12 * B._24 + A._13 * B._34;
+    result._21 = A._21 * B._11 + A._22 * B._21 + A._23 * B._31;
+    result._22 = A._21 * B._12 + A._22 * B._22 + A._23 * B._32;
+    result._23 = A._21 * B._13 + A._22 * B._23 + A._23 * B._33;
+    result._24 = A._21 * B._14 + A._22 * B._24 + A._23 * B._34;
+    result._31 = A._31 * B._11 + A._32 * B._21 + A._33 * B._31;
+    result._32 = A._31 * B._12 + A._32 * B._22 + A._33 * B._32;
+    result._33 = A._31 * B._13 + A._32 * B._23 + A._33 * B._33;
+    result._34 = A._31 * B._14 + A._32 * B._24 + A._33 * B._34;
+    return result;
+}
+
+LINALG_INLINE mat3x2d_t mat3x4d_mul_mat4x2d(mat3x4d_t A, mat4x2d_t B) {
+    mat3x2d_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21 + A._13 * B._31 + A._14 * B._41;
+    result._12 = A._11 * B._12 + A._12 * B._22 + A._13 * B._32 + A._14 * B._42;
+    result._21 = A._21 * B._11 + A._22 * B._21 + A._23 * B._31 + A._24 * B._41;
+    result._22 = A._21 * B._12 + A._22 * B._22 + A._23 * B._32 + A._24 * B._42;
+    result._31 = A._31 * B._11 + A._32 * B._21 + A._33 * B._31 + A._34 * B._41;
+    result._32 = A._31 * B._12 + A._32 * B._22 + A._33 * B._32 + A._34 * B._42;
+    return result;
+}
+
+LINALG_INLINE mat3d_t mat3x4d_mul_mat4x3d(mat3x4d_t A, mat4x3d_t B) {
+    mat3d_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21 + A._13 * B._31 + A._14 * B._41;
+    result._12 = A._11 * B._12 + A._12 * B._22 + A._13 * B._32 + A._14 * B._42;
+    result._13 = A._11 * B._13 + A._12 * B._23 + A._13 * B._33 + A._14 * B._43;
+    result._21 = A._21 * B._11 + A._22 * B._21 + A._23 * B._31 + A._24 * B._41;
+    result._22 = A._21 * B._12 + A._22 * B._22 + A._23 * B._32 + A._24 * B._42;
+    result._23 = A._21 * B._13 + A._22 * B._23 + A._23 * B._33 + A._24 * B._43;
+    result._31 = A._31 * B._11 + A._32 * B._21 + A._33 * B._31 + A._34 * B._41;
+    result._32 = A._31 * B._12 + A._32 * B._22 + A._33 * B._32 + A._34 * B._42;
+    result._33 = A._31 * B._13 + A._32 * B._23 + A._33 * B._33 + A._34 * B._43;
+    return result;
+}
+
+LINALG_INLINE mat3x4d_t mat3x4d_mul_mat4d(mat3x4d_t A, mat4d_t B) {
+    mat3x4d_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21 + A._13 * B._31 + A._14 * B._41;
+    result._12 = A._11 * B._12 + A._12 * B._22 + A._13 * B._32 + A._14 * B._42;
+    result._13 = A._11 * B._13 + A._12 * B._23 + A._13 * B._33 + A._14 * B._43;
+    result._14 = A._11 * B._14 + A._12 * B._24 + A._13 * B._34 + A._14 * B._44;
+    result._21 = A._21 * B._11 + A._22 * B._21 + A._23 * B._31 + A._24 * B._41;
+    result._22 = A._21 * B._12 + A._22 * B._22 + A._23 * B._32 + A._24 * B._42;
+    result._23 = A._21 * B._13 + A._22 * B._23 + A._23 * B._33 + A._24 * B._43;
+    result._24 = A._21 * B._14 + A._22 * B._24 + A._23 * B._34 + A._24 * B._44;
+    result._31 = A._31 * B._11 + A._32 * B._21 + A._33 * B._31 + A._34 * B._41;
+    result._32 = A._31 * B._12 + A._32 * B._22 + A._33 * B._32 + A._34 * B._42;
+    result._33 = A._31 * B._13 + A._32 * B._23 + A._33 * B._33 + A._34 * B._43;
+    result._34 = A._31 * B._14 + A._32 * B._24 + A._33 * B._34 + A._34 * B._44;
+    return result;
+}
+
+LINALG_INLINE mat3x2i_t mat3x2i_zero(void) {
+    mat3x2i_t M = {0};
+    return M;
+}
+
+LINALG_INLINE mat3x2i_t mat3x2i_I(void) {
+    mat3x2i_t M = {0};
+    M._11 = 1;
+    M._22 = 1;
+    return M;
+}
+
+LINALG_INLINE vec3i_t mat3x2i_mul_vec(mat3x2i_t M, vec2i_t v) {
+    vec3i_t result;
+    result.e[0] = M._11 * v.e[0] + M._12 * v.e[1];
+    result.e[1] = M._21 * v.e[0] + M._22 * v.e[1];
+    result.e[2] = M._31 * v.e[0] + M._32 * v.e[1];
+    return result;
+}
+
+LINALG_INLINE mat2x3i_t mat3x2i_transpose(mat3x2i_t M) {
+    mat2x3i_t result;
+    result._11 = M._11;
+    result._21 = M._12;
+    result._12 = M._21;
+    result._22 = M._22;
+    result._13 = M._31;
+    result._23 = M._32;
+    return result;
+}
+
+LINALG_INLINE mat3x4i_t mat3x4i_zero(void) {
+    mat3x4i_t M = {0};
+    return M;
+}
+
+LINALG_INLINE mat3x4i_t mat3x4i_I(void) {
+    mat3x4i_t M = {0};
+    M._11 = 1;
+    M._22 = 1;
+    M._33 = 1;
+    return M;
+}
+
+LINALG_INLINE vec3i_t mat3x4i_mul_vec(mat3x4i_t M, vec4i_t v) {
+    vec3i_t result;
+    result.e[0] = M._11 * v.e[0] + M._12 * v.e[1] + M._13 * v.e[2] + M._14 *
+                  v.e[3];
+    result.e[1] = M._21 * v.e[0] + M._22 * v.e[1] + M._23 * v.e[2] + M._24 *
+                  v.e[3];
+    result.e[2] = M._31 * v.e[0] + M._32 * v.e[1] + M._33 * v.e[2] + M._34 *
+                  v.e[3];
+    return result;
+}
+
+LINALG_INLINE mat4x3i_t mat3x4i_transpose(mat3x4i_t M) {
+    mat4x3i_t result;
+    result._11 = M._11;
+    result._21 = M._12;
+    result._31 = M._13;
+    result._41 = M._14;
+    result._12 = M._21;
+    result._22 = M._22;
+    result._32 = M._23;
+    result._42 = M._24;
+    result._13 = M._31;
+    result._23 = M._32;
+    result._33 = M._33;
+    result._43 = M._34;
+    return result;
+}
+
+LINALG_INLINE mat3x4i_t mat3x4i_from_mat4i(mat4i_t M) {
+    mat3x4i_t result;
+    result._11 = M._11;
+    result._12 = M._12;
+    result._13 = M._13;
+    result._14 = M._14;
+    result._21 = M._21;
+    result._22 = M._22;
+    result._23 = M._23;
+    result._24 = M._24;
+    result._31 = M._31;
+    result._32 = M._32;
+    result._33 = M._33;
+    result._34 = M._34;
+    return result;
+}
+
+LINALG_INLINE mat4i_t mat3x4i_to_mat4i(mat3x4i_t M) {
+    mat4i_t result = {0};
+    result._11 = M._11;
+    result._12 = M._12;
+    result._13 = M._13;
+    result._14 = M._14;
+    result._21 = M._21;
+    result._22 = M._22;
+    result._23 = M._23;
+    result._24 = M._24;
+    result._31 = M._31;
+    result._32 = M._32;
+    result._33 = M._33;
+    result._34 = M._34;
+    result._44 = 1;
+    return result;
+}
+
+LINALG_INLINE mat3x4i_t mat3x4i_mul_affine(mat3x4i_t A, mat3x4i_t B) {
+    mat3x4i_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21 + A._13 * B._31;
+    result._12 = A._11 * B._12 + A._12 * B._22 + A._13 * B._32;
+    result._13 = A._11 * B._13 + A._12 * B._23 + A._13 * B._33;
+    result._14 = A._11 * B._14 + A._12 * B._24 + A._13 * B._34 + A._14;
+    result._21 = A._21 * B._11 + A._22 * B._21 + A._23 * B._31;
+    result._22 = A._21 * B._12 + A._22 * B._22 + A._23 * B._32;
+    result._23 = A._21 * B._13 + A._22 * B._23 + A._23 * B._33;
+    result._24 = A._21 * B._14 + A._22 * B._24 + A._23 * B._34 + A._24;
+    result._31 = A._31 * B._11 + A._32 * B._21 + A._33 * B._31;
+    result._32 = A._31 * B._12 + A._32 * B._22 + A._33 * B._32;
+    result._33 = A._31 * B._13 + A._32 * B._23 + A._33 * B._33;
+    result._34 = A._31 * B._14 + A._32 * B._24 + A._33 * B._34 + A._34;
+    return result;
+}
+
+LINALG_INLINE vec3i_t mat3x4i_transform_affine(mat3x4i_t M, vec3i_t p) {
+    vec3i_t result;
+    result.e[0] = M._11 * p.e[0] + M._12 * p.e[1] + M._13 * p.e[2] + M._14;
+    result.e[1] = M._21 * p.e[0] + M._22 * p.e[1] + M._23 * p.e[2] + M._24;
+    result.e[2] = M._31 * p.e[0] + M._32 * p.e[1] + M._33 * p.e[2] + M._34;
+    return result;
+}
+
+LINALG_DEF void mat3x4i_transform_affine_array(const mat3x4i_t *M,
+                                               const vec3i_t *restrict in,
+                                               vec3i_t *restrict out, size_t n);
+
+LINALG_INLINE mat3x2i_t mat3x2i_mul_mat2i(mat3x2i_t A, mat2i_t B) {
+    mat3x2i_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21;
+    result._12 = A._11 * B._12 + A._12 * B._22;
+    result._21 = A._21 * B._11 + A._22 * B._21;
+    result._22 = A._21 * B._12 + A._22 * B._22;
+    result._31 = A._31 * B._11 + A._32 * B._21;
+    result._32 = A._31 * B._12 + A._32 * B._22;
+    return result;
+}
+
+LINALG_INLINE mat3i_t mat3x2i_mul_mat2x3i(mat3x2i_t A, mat2x3i_t B) {
+    mat3i_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21;
+    result._12 = A._11 * B._12 + A._12 * B._22;
+    result._13 = A._11 * B._13 + A._12 * B._23;
+    result._21 = A._21 * B._11 + A._22 * B._21;
+    result._22 = A._21 * B._12 + A._22 * B._22;
+    result._23 = A._21 * B._13 + A._22 * B._23;
+    result._31 = A._31 * B._11 + A._32 * B._21;
+    result._32 = A._31 * B._12 + A._32 * B._22;
+    result._33 = A._31 * B._13 + A._32 * B._23;
+    return result;
+}
+
+LINALG_INLINE mat3x4i_t mat3x2i_mul_mat2x4i(mat3x2i_t A, mat2x4i_t B) {
+    mat3x4i_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21;
+    result._12 = A._11 * B._12 + A._12 * B._22;
+    result._13 = A._11 * B._13 + A._12 * B._23;
+    result._14 = A._11 * B._14 + A._12 * B._24;
+    result._21 = A._21 * B._11 + A._22 * B._21;
+    result._22 = A._21 * B._12 + A._22 * B._22;
+    result._23 = A._21 * B._13 + A._22 * B._23;
+    result._24 = A._21 * B._14 + A._22 * B._24;
+    result._31 = A._31 * B._11 + A._32 * B._21;
+    result._32 = A._31 * B._12 + A._32 * B._22;
+    result._33 = A._31 * B._13 + A._32 * B._23;
+    result._34 = A._31 * B._14 + A._32 * B._24;
+    return result;
+}
+
+LINALG_INLINE mat3x2i_t mat3i_mul_mat3x2i(mat3i_t A, mat3x2i_t B) {
+    mat3x2i_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21 + A._13 * B._31;
+    result._12 = A._11 * B._12 + A._12 * B._22 + A._13 * B._32;
+    result._21 = A._21 * B._11 + A._22 * B._21 + A._23 * B._31;
+    result._22 = A._21 * B._12 + A._22 * B._22 + A._23 * B._32;
+    result._31 = A._31 * B._11 + A._32 * B._21 + A._33 * B._31;
+    result._32 = A._31 * B._12 + A._32 * B._22 + A._33 * B._32;
+    return result;
+}
+
+LINALG_INLINE mat3x4i_t mat3i_mul_mat3x4i(mat3i_t A, mat3x4i_t B) {
+    mat3x4i_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21 + A._13 * B._31;
+    result._12 = A._11 * B._12 + A._12 * B._22 + A._13 * B._32;
+    result._13 = A._11 * B._13 + A._12 * B._23 + A._13 * B._33;
+    result._14 = A._11 * B._14 + A._12 * B._24 + A._13 * B._34;
+    result._21 = A._21 * B._11 + A._22 * B._21 + A._23 * B._31;
+    result._22 = A._21 * B._12 + A._22 * B._22 + A._23 * B._32;
+    result._23 = A._21 * B._13 + A._22 * B._23 + A._23 * B._33;
+    result._24 = A._21 * B._14 + A._22 * B._24 + A._23 * B._34;
+    result._31 = A._31 * B._11 + A._32 * B._21 + A._33 * B._31;
+    result._32 = A._31 * B._12 + A._32 * B._22 + A._33 * B._32;
+    result._33 = A._31 * B._13 + A._32 * B._23 + A._33 * B._33;
+    result._34 = A._31 * B._14 + A._32 * B._24 + A._33 * B._34;
+    return result;
+}
+
+LINALG_INLINE mat3x2i_t mat3x4i_mul_mat4x2i(mat3x4i_t A, mat4x2i_t B) {
+    mat3x2i_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21 + A._13 * B._31 + A._14 * B._41;
+    result._12 = A._11 * B._12 + A._12 * B._22 + A._13 * B._32 + A._14 * B._42;
+    result._21 = A._21 * B._11 + A._22 * B._21 + A._23 * B._31 + A._24 * B._41;
+    result._22 = A._21 * B._12 + A._22 * B._22 + A._23 * B._32 + A._24 * B._42;
+    result._31 = A._31 * B._11 + A._32 * B._21 + A._33 * B._31 + A._34 * B._41;
+    result._32 = A._31 * B._12 + A._32 * B._22 + A._33 * B._32 + A._34 * B._42;
+    return result;
+}
+
+LINALG_INLINE mat3i_t mat3x4i_mul_mat4x3i(mat3x4i_t A, mat4x3i_t B) {
+    mat3i_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21 + A._13 * B._31 + A._14 * B._41;
+    result._12 = A._11 * B._12 + A._12 * B._22 + A._13 * B._32 + A._14 * B._42;
+    result._13 = A._11 * B._13 + A._12 * B._23 + A._13 * B._33 + A._14 * B._43;
+    result._21 = A._21 * B._11 + A._22 * B._21 + A._23 * B._31 + A._24 * B._41;
+    result._22 = A._21 * B._12 + A._22 * B._22 + A._23 * B._32 + A._24 * B._42;
+    result._23 = A._21 * B._13 + A._22 * B._23 + A._23 * B._33 + A._24 * B._43;
+    result._31 = A._31 * B._11 + A._32 * B._21 + A._33 * B._31 + A._34 * B._41;
+    result._32 = A._31 * B._12 + A._32 * B._22 + A._33 * B._32 + A._34 * B._42;
+    result._33 = A._31 * B._13 + A._32 * B._23 + A._33 * B._33 + A._34 * B._43;
+    return result;
+}
+
+LINALG_INLINE mat3x4i_t mat3x4i_mul_mat4i(mat3x4i_t A, mat4i_t B) {
+    mat3x4i_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21 + A._13 * B._31 + A._14 * B._41;
+    result._12 = A._11 * B._12 + A._12 * B._22 + A._13 * B._32 + A._14 * B._42;
+    result._13 = A._11 * B._13 + A._12 * B._23 + A._13 * B._33 + A._14 * B._43;
+    result._14 = A._11 * B._14 + A._12 * B._24 + A._13 * B._34 + A._14 * B._44;
+    result._21 = A._21 * B._11 + A._22 * B._21 + A._23 * B._31 + A._24 * B._41;
+    result._22 = A._21 * B._12 + A._22 * B._22 + A._23 * B._32 + A._24 * B._42;
+    result._23 = A._21 * B._13 + A._22 * B._23 + A._23 * B._33 + A._24 * B._43;
+    result._24 = A._21 * B._14 + A._22 * B._24 + A._23 * B._34 + A._24 * B._44;
+    result._31 = A._31 * B._11 + A._32 * B._21 + A._33 * B._31 + A._34 * B._41;
+    result._32 = A._31 * B._12 + A._32 * B._22 + A._33 * B._32 + A._34 * B._42;
+    result._33 = A._31 * B._13 + A._32 * B._23 + A._33 * B._33 + A._34 * B._43;
+    result._34 = A._31 * B._14 + A._32 * B._24 + A._33 * B._34 + A._34 * B._44;
+    return result;
+}
+
+LINALG_INLINE mat3x2u_t mat3x2u_zero(void) {
+    mat3x2u_t M = {0};
+    return M;
+}
+
+LINALG_INLINE mat3x2u_t mat3x2u_I(void) {
+    mat3x2u_t M = {0};
+    M._11 = 1;
+    M._22 = 1;
+    return M;
+}
+
+LINALG_INLINE vec3u_t mat3x2u_mul_vec(mat3x2u_t M, vec2u_t v) {
+    vec3u_t result;
+    result.e[0] = M._11 * v.e[0] + M._12 * v.e[1];
+    result.e[1] = M._21 * v.e[0] + M._22 * v.e[1];
+    result.e[2] = M._31 * v.e[0] + M._32 * v.e[1];
+    return result;
+}
+
+LINALG_INLINE mat2x3u_t mat3x2u_transpose(mat3x2u_t M) {
+    mat2x3u_t result;
+    result._11 = M._11;
+    result._21 = M._12;
+    result._12 = M._21;
+    result._22 = M._22;
+    result._13 = M._31;
+    result._23 = M._32;
+    return result;
+}
+
+LINALG_INLINE mat3x4u_t mat3x4u_zero(void) {
+    mat3x4u_t M = {0};
+    return M;
+}
+
+LINALG_INLINE mat3x4u_t mat3x4u_I(void) {
+    mat3x4u_t M = {0};
+    M._11 = 1;
+    M._22 = 1;
+    M._33 = 1;
+    return M;
+}
+
+LINALG_INLINE vec3u_t mat3x4u_mul_vec(mat3x4u_t M, vec4u_t v) {
+    vec3u_t result;
+    result.e[0] = M._11 * v.e[0] + M._12 * v.e[1] + M._13 * v.e[2] + M._14 *
+                  v.e[3];
+    result.e[1] = M._21 * v.e[0] + M._22 * v.e[1] + M._23 * v.e[2] + M._24 *
+                  v.e[3];
+    result.e[2] = M._31 * v.e[0] + M._32 * v.e[1] + M._33 * v.e[2] + M._34 *
+                  v.e[3];
+    return result;
+}
+
+LINALG_INLINE mat4x3u_t mat3x4u_transpose(mat3x4u_t M) {
+    mat4x3u_t result;
+    result._11 = M._11;
+    result._21 = M._12;
+    result._31 = M._13;
+    result._41 = M._14;
+    result._12 = M._21;
+    result._22 = M._22;
+    result._32 = M._23;
+    result._42 = M._24;
+    result._13 = M._31;
+    result._23 = M._32;
+    result._33 = M._33;
+    result._43 = M._34;
+    return result;
+}
+
+LINALG_INLINE mat3x4u_t mat3x4u_from_mat4u(mat4u_t M) {
+    mat3x4u_t result;
+    result._11 = M._11;
+    result._12 = M._12;
+    result._13 = M._13;
+    result._14 = M._14;
+    result._21 = M._21;
+    result._22 = M._22;
+    result._23 = M._23;
+    result._24 = M._24;
+    result._31 = M._31;
+    result._32 = M._32;
+    result._33 = M._33;
+    result._34 = M._34;
+    return result;
+}
+
+LINALG_INLINE mat4u_t mat3x4u_to_mat4u(mat3x4u_t M) {
+    mat4u_t result = {0};
+    result._11 = M._11;
+    result._12 = M._12;
+    result._13 = M._13;
+    result._14 = M._14;
+    result._21 = M._21;
+    result._22 = M._22;
+    result._23 = M._23;
+    result._24 = M._24;
+    result._31 = M._31;
+    result._32 = M._32;
+    result._33 = M._33;
+    result._34 = M._34;
+    result._44 = 1;
+    return result;
+}
+
+LINALG_INLINE mat3x4u_t mat3x4u_mul_affine(mat3x4u_t A, mat3x4u_t B) {
+    mat3x4u_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21 + A._13 * B._31;
+    result._12 = A._11 * B._12 + A._12 * B._22 + A._13 * B._32;
+    result._13 = A._11 * B._13 + A._12 * B._23 + A._13 * B._33;
+    result._14 = A._11 * B._14 + A._12 * B._24 + A._13 * B._34 + A._14;
+    result._21 = A._21 * B._11 + A._22 * B._21 + A._23 * B._31;
+    result._22 = A._21 * B._12 + A._22 * B._22 + A._23 * B._32;
+    result._23 = A._21 * B._13 + A._22 * B._23 + A._23 * B._33;
+    result._24 = A._21 * B._14 + A._22 * B._24 + A._23 * B._34 + A._24;
+    result._31 = A._31 * B._11 + A._32 * B._21 + A._33 * B._31;
+    result._32 = A._31 * B._12 + A._32 * B._22 + A._33 * B._32;
+    result._33 = A._31 * B._13 + A._32 * B._23 + A._33 * B._33;
+    result._34 = A._31 * B._14 + A._32 * B._24 + A._33 * B._34 + A._34;
+    return result;
+}
+
+LINALG_INLINE vec3u_t mat3x4u_transform_affine(mat3x4u_t M, vec3u_t p) {
+    vec3u_t result;
+    result.e[0] = M._11 * p.e[0] + M._12 * p.e[1] + M._13 * p.e[2] + M._14;
+    result.e[1] = M._21 * p.e[0] + M._22 * p.e[1] + M._23 * p.e[2] + M._24;
+    result.e[2] = M._31 * p.e[0] + M._32 * p.e[1] + M._33 * p.e[2] + M._34;
+    return result;
+}
+
+LINALG_DEF void mat3x4u_transform_affine_array(const mat3x4u_t *M,
+                                               const vec3u_t *restrict in,
+                                               vec3u_t *restrict out, size_t n);
+
+LINALG_INLINE mat3x2u_t mat3x2u_mul_mat2u(mat3x2u_t A, mat2u_t B) {
+    mat3x2u_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21;
+    result._12 = A._11 * B._12 + A._12 * B._22;
+    result._21 = A._21 * B._11 + A._22 * B._21;
+    result._22 = A._21 * B._12 + A._22 * B._22;
+    result._31 = A._31 * B._11 + A._32 * B._21;
+    result._32 = A._31 * B._12 + A._32 * B._22;
+    return result;
+}
+
+LINALG_INLINE mat3u_t mat3x2u_mul_mat2x3u(mat3x2u_t A, mat2x3u_t B) {
+    mat3u_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21;
+    result._12 = A._11 * B._12 + A._12 * B._22;
+    result._13 = A._11 * B._13 + A._12 * B._23;
+    result._21 = A._21 * B._11 + A._22 * B._21;
+    result._22 = A._21 * B._12 + A._22 * B._22;
+    result._23 = A._21 * B._13 + A._22 * B._23;
+    result._31 = A._31 * B._11 + A._32 * B._21;
+    result._32 = A._31 * B._12 + A._32 * B._22;
+    result._33 = A._31 * B._13 + A._32 * B._23;
+    return result;
+}
+
+LINALG_INLINE mat3x4u_t mat3x2u_mul_mat2x4u(mat3x2u_t A, mat2x4u_t B) {
+    mat3x4u_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21;
+    result._12 = A._11 * B._12 + A._12 * B._22;
+    result._13 = A._11 * B._13 + A._12 * B._23;
+    result._14 = A._11 * B._14 + A._12 * B._24;
+    result._21 = A._21 * B._11 + A._22 * B._21;
+    result._22 = A._21 * B._12 + A._22 * B._22;
+    result._23 = A._21 * B._13 + A._22 * B._23;
+    result._24 = A._21 * B._14 + A._22 * B._24;
+    result._31 = A._31 * B._11 + A._32 * B._21;
+    result._32 = A._31 * B._12 + A._32 * B._22;
+    result._33 = A._31 * B._13 + A._32 * B._23;
+    result._34 = A._31 * B._14 + A._32 * B._24;
+    return result;
+}
+
+LINALG_INLINE mat3x2u_t mat3u_mul_mat3x2u(mat3u_t A, mat3x2u_t B) {
+    mat3x2u_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21 + A._13 * B._31;
+    result._12 = A._11 * B._12 + A._12 * B._22 + A._13 * B._32;
+    result._21 = A._21 * B._11 + A._22 * B._21 + A._23 * B._31;
+    result._22 = A._21 * B._12 + A._22 * B._22 + A._23 * B._32;
+    result._31 = A._31 * B._11 + A._32 * B._21 + A._33 * B._31;
+    result._32 = A._31 * B._12 + A._32 * B._22 + A._33 * B._32;
+    return result;
+}
+
+LINALG_INLINE mat3x4u_t mat3u_mul_mat3x4u(mat3u_t A, mat3x4u_t B) {
+    mat3x4u_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21 + A._13 * B._31;
+    result._12 = A._11 * B._12 + A._12 * B._22 + A._13 * B._32;
+    result._13 = A._11 * B._13 + A._12 * B._23 + A._13 * B._33;
+    result._14 = A._11 * B._14 + A._12 * B._24 + A._13 * B._34;
+    result._21 = A._21 * B._11 + A._22 * B._21 + A._23 * B._31;
+    result._22 = A._21 * B._12 + A._22 * B._22 + A._23 * B._32;
+    result._23 = A._21 * B._13 + A._22 * B._23 + A._23 * B._33;
+    result._24 = A._21 * B._14 + A._22 * B._24 + A._23 * B._34;
+    result._31 = A._31 * B._11 + A._32 * B._21 + A._33 * B._31;
+    result._32 = A._31 * B._12 + A._32 * B._22 + A._33 * B._32;
+    result._33 = A._31 * B._13 + A._32 * B._23 + A._33 * B._33;
+    result._34 = A._31 * B._14 + A._32 * B._24 + A._33 * B._34;
+    return result;
+}
+
+LINALG_INLINE mat3x2u_t mat3x4u_mul_mat4x2u(mat3x4u_t A, mat4x2u_t B) {
+    mat3x2u_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21 + A._13 * B._31 + A._14 * B._41;
+    result._12 = A._11 * B._12 + A._12 * B._22 + A._13 * B._32 + A._14 * B._42;
+    result._21 = A._21 * B._11 + A._22 * B._21 + A._23 * B._31 + A._24 * B._41;
+    result._22 = A._21 * B._12 + A._22 * B._22 + A._23 * B._32 + A._24 * B._42;
+    result._31 = A._31 * B._11 + A._32 * B._21 + A._33 * B._31 + A._34 * B._41;
+    result._32 = A._31 * B._12 + A._32 * B._22 + A._33 * B._32 + A._34 * B._42;
+    return result;
+}
+
+LINALG_INLINE mat3u_t mat3x4u_mul_mat4x3u(mat3x4u_t A, mat4x3u_t B) {
+    mat3u_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21 + A._13 * B._31 + A._14 * B._41;
+    result._12 = A._11 * B._12 + A._12 * B._22 + A._13 * B._32 + A._14 * B._42;
+    result._13 = A._11 * B._13 + A._12 * B._23 + A._13 * B._33 + A._14 * B._43;
+    result._21 = A._21 * B._11 + A._22 * B._21 + A._23 * B._31 + A._24 * B._41;
+    result._22 = A._21 * B._12 + A._22 * B._22 + A._23 * B._32 + A._24 * B._42;
+    result._23 = A._21 * B._13 + A._22 * B._23 + A._23 * B._33 + A._24 * B._43;
+    result._31 = A._31 * B._11 + A._32 * B._21 + A._33 * B._31 + A._34 * B._41;
+    result._32 = A._31 * B._12 + A._32 * B._22 + A._33 * B._32 + A._34 * B._42;
+    result._33 = A._31 * B._13 + A._32 * B._23 + A._33 * B._33 + A._34 * B._43;
+    return result;
+}
+
+LINALG_INLINE mat3x4u_t mat3x4u_mul_mat4u(mat3x4u_t A, mat4u_t B) {
+    mat3x4u_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21 + A._13 * B._31 + A._14 * B._41;
+    result._12 = A._11 * B._12 + A._12 * B._22 + A._13 * B._32 + A._14 * B._42;
+    result._13 = A._11 * B._13 + A._12 * B._23 + A._13 * B._33 + A._14 * B._43;
+    result._14 = A._11 * B._14 + A._12 * B._24 + A._13 * B._34 + A._14 * B._44;
+    result._21 = A._21 * B._11 + A._22 * B._21 + A._23 * B._31 + A._24 * B._41;
+    result._22 = A._21 * B._12 + A._22 * B._22 + A._23 * B._32 + A._24 * B._42;
+    result._23 = A._21 * B._13 + A._22 * B._23 + A._23 * B._33 + A._24 * B._43;
+    result._24 = A._21 * B._14 + A._22 * B._24 + A._23 * B._34 + A._24 * B._44;
+    result._31 = A._31 * B._11 + A._32 * B._21 + A._33 * B._31 + A._34 * B._41;
+    result._32 = A._31 * B._12 + A._32 * B._22 + A._33 * B._32 + A._34 * B._42;
+    result._33 = A._31 * B._13 + A._32 * B._23 + A._33 * B._33 + A._34 * B._43;
+    result._34 = A._31 * B._14 + A._32 * B._24 + A._33 * B._34 + A._34 * B._44;
+    return result;
+}
+
+LINALG_INLINE mat4x2f_t mat4x2f_zero(void) {
+    mat4x2f_t M = {0};
+    return M;
+}
+
+LINALG_INLINE mat4x2f_t mat4x2f_I(void) {
+    mat4x2f_t M = {0};
+    M._11 = 1;
+    M._22 = 1;
+    return M;
+}
+
+LINALG_INLINE vec4f_t mat4x2f_mul_vec(mat4x2f_t M, vec2f_t v) {
+    vec4f_t result;
+    result.e[0] = M._11 * v.e[0] + M._12 * v.e[1];
+    result.e[1] = M._21 * v.e[0] + M._22 * v.e[1];
+    result.e[2] = M._31 * v.e[0] + M._32 * v.e[1];
+    result.e[3] = M._41 * v.e[0] + M._42 * v.e[1];
+    return result;
+}
+
+LINALG_INLINE mat2x4f_t mat4x2f_transpose(mat4x2f_t M) {
+    mat2x4f_t result;
+    result._11 = M._11;
+    result._21 = M._12;
+    result._12 = M._21;
+    result._22 = M._22;
+    result._13 = M._31;
+    result._23 = M._32;
+    result._14 = M._41;
+    result._24 = M._42;
+    return result;
+}
+
+LINALG_INLINE mat4x3f_t mat4x3f_zero(void) {
+    mat4x3f_t M = {0};
+    return M;
+}
+
+LINALG_INLINE mat4x3f_t mat4x3f_I(void) {
+    mat4x3f_t M = {0};
+    M._11 = 1;
+    M._22 = 1;
+    M._33 = 1;
+    return M;
+}
+
+LINALG_INLINE vec4f_t mat4x3f_mul_vec(mat4x3f_t M, vec3f_t v) {
+    vec4f_t result;
+    result.e[0] = M._11 * v.e[0] + M._12 * v.e[1] + M._13 * v.e[2];
+    result.e[1] = M._21 * v.e[0] + M._22 * v.e[1] + M._23 * v.e[2];
+    result.e[2] = M._31 * v.e[0] + M._32 * v.e[1] + M._33 * v.e[2];
+    result.e[3] = M._41 * v.e[0] + M._42 * v.e[1] + M._43 * v.e[2];
+    return result;
+}
+
+LINALG_INLINE mat3x4f_t mat4x3f_transpose(mat4x3f_t M) {
+    mat3x4f_t result;
+    result._11 = M._11;
+    result._21 = M._12;
+    result._31 = M._13;
+    result._12 = M._21;
+    result._22 = M._22;
+    result._32 = M._23;
+    result._13 = M._31;
+    result._23 = M._32;
+    result._33 = M._33;
+    result._14 = M._41;
+    result._24 = M._42;
+    result._34 = M._43;
+    return result;
+}
+
+LINALG_INLINE mat4x2f_t mat4x2f_mul_mat2f(mat4x2f_t A, mat2f_t B) {
+    mat4x2f_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21;
+    result._12 = A._11 * B._12 + A._12 * B._22;
+    result._21 = A._21 * B._11 + A._22 * B._21;
+    result._22 = A._21 * B._12 + A._22 * B._22;
+    result._31 = A._31 * B._11 + A._32 * B._21;
+    result._32 = A._31 * B._12 + A._32 * B._22;
+    result._41 = A._41 * B._11 + A._42 * B._21;
+    result._42 = A._41 * B._12 + A._42 * B._22;
+    return result;
+}
+
+LINALG_INLINE mat4x3f_t mat4x2f_mul_mat2x3f(mat4x2f_t A, mat2x3f_t B) {
+    mat4x3f_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21;
+    result._12 = A._11 * B._12 + A._12 * B._22;
+    result._13 = A._11 * B._13 + A._12 * B._23;
+    result._21 = A._21 * B._11 + A._22 * B._21;
+    result._22 = A._21 * B._12 + A._22 * B._22;
+    result._23 = A._21 * B._13 + A._22 * B._23;
+    result._31 = A._31 * B._11 + A._32 * B._21;
+    result._32 = A._31 * B._12 + A._32 * B._22;
+    result._33 = A._31 * B._13 + A._32 * B._23;
+    result._41 = A._41 * B._11 + A._42 * B._21;
+    result._42 = A._41 * B._12 + A._42 * B._22;
+    result._43 = A._41 * B._13 + A._42 * B._23;
+    return result;
+}
+
+LINALG_INLINE mat4f_t mat4x2f_mul_mat2x4f(mat4x2f_t A, mat2x4f_t B) {
+    mat4f_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21;
+    result._12 = A._11 * B._12 + A._12 * B._22;
+    result._13 = A._11 * B._13 + A._12 * B._23;
+    result._14 = A._11 * B._14 + A._12 * B._24;
+    result._21 = A._21 * B._11 + A._22 * B._21;
+    result._22 = A._21 * B._12 + A._22 * B._22;
+    result._23 = A._21 * B._13 + A._22 * B._23;
+    result._24 = A._21 * B._14 + A._22 * B._24;
+    result._31 = A._31 * B._11 + A._32 * B._21;
+    result._32 = A._31 * B._12 + A._32 * B._22;
+    result._33 = A._31 * B._13 + A._32 * B._23;
+    result._34 = A._31 * B._14 + A._32 * B._24;
+    result._41 = A._41 * B._11 + A._42 * B._21;
+    result._42 = A._41 * B._12 + A._42 * B._22;
+    result._43 = A._41 * B._13 + A._42 * B._23;
+    result._44 = A._41 * B._14 + A._42 * B._24;
+    return result;
+}
+
+LINALG_INLINE mat4x2f_t mat4x3f_mul_mat3x2f(mat4x3f_t A, mat3x2f_t B) {
+    mat4x2f_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21 + A._13 * B._31;
+    result._12 = A._11 * B._12 + A._12 * B._22 + A._13 * B._32;
+    result._21 = A._21 * B._11 + A._22 * B._21 + A._23 * B._31;
+    result._22 = A._21 * B._12 + A._22 * B._22 + A._23 * B._32;
+    result._31 = A._31 * B._11 + A._32 * B._21 + A._33 * B._31;
+    result._32 = A._31 * B._12 + A._32 * B._22 + A._33 * B._32;
+    result._41 = A._41 * B._11 + A._42 * B._21 + A._43 * B._31;
+    result._42 = A._41 * B._12 + A._42 * B._22 + A._43 * B._32;
+    return result;
+}
+
+LINALG_INLINE mat4x3f_t mat4x3f_mul_mat3f(mat4x3f_t A, mat3f_t B) {
+    mat4x3f_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21 + A._13 * B._31;
+    result._12 = A._11 * B._12 + A._12 * B._22 + A._13 * B._32;
+    result._13 = A._11 * B._13 + A._12 * B._23 + A._13 * B._33;
+    result._21 = A._21 * B._11 + A._22 * B._21 + A._23 * B._31;
+    result._22 = A._21 * B._12 + A._22 * B._22 + A._23 * B._32;
+    result._23 = A._21 * B._13 + A._22 * B._23 + A._23 * B._33;
+    result._31 = A._31 * B._11 + A._32 * B._21 + A._33 * B._31;
+    result._32 = A._31 * B._12 + A._32 * B._22 + A._33 * B._32;
+    result._33 = A._31 * B._13 + A._32 * B._23 + A._33 * B._33;
+    result._41 = A._41 * B._11 + A._42 * B._21 + A._43 * B._31;
+    result._42 = A._41 * B._12 + A._42 * B._22 + A._43 * B._32;
+    result._43 = A._41 * B._13 + A._42 * B._23 + A._43 * B._33;
+    return result;
+}
+
+LINALG_INLINE mat4f_t mat4x3f_mul_mat3x4f(mat4x3f_t A, mat3x4f_t B) {
+    mat4f_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21 + A._13 * B._31;
+    result._12 = A._11 * B._12 + A._12 * B._22 + A._13 * B._32;
+    result._13 = A._11 * B._13 + A._12 * B._23 + A._13 * B._33;
+    result._14 = A._11 * B._14 + A._12 * B._24 + A._13 * B._34;
+    result._21 = A._21 * B._11 + A._22 * B._21 + A._23 * B._31;
+    result._22 = A._21 * B._12 + A._22 * B._22 + A._23 * B._32;
+    result._23 = A._21 * B._13 + A._22 * B._23 + A._23 * B._33;
+    result._24 = A._21 * B._14 + A._22 * B._24 + A._23 * B._34;
+    result._31 = A._31 * B._11 + A._32 * B._21 + A._33 * B._31;
+    result._32 = A._31 * B._12 + A._32 * B._22 + A._33 * B._32;
+    result._33 = A._31 * B._13 + A._32 * B._23 + A._33 * B._33;
+    result._34 = A._31 * B._14 + A._32 * B._24 + A._33 * B._34;
+    result._41 = A._41 * B._11 + A._42 * B._21 + A._43 * B._31;
+    result._42 = A._41 * B._12 + A._42 * B._22 + A._43 * B._32;
+    result._43 = A._41 * B._13 + A._42 * B._23 + A._43 * B._33;
+    result._44 = A._41 * B._14 + A._42 * B._24 + A._43 * B._34;
+    return result;
+}
+
+LINALG_INLINE mat4x2f_t mat4f_mul_mat4x2f(mat4f_t A, mat4x2f_t B) {
+    mat4x2f_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21 + A._13 * B._31 + A._14 * B._41;
+    result._12 = A._11 * B._12 + A._12 * B._22 + A._13 * B._32 + A._14 * B._42;
+    result._21 = A._21 * B._11 + A._22 * B._21 + A._23 * B._31 + A._24 * B._41;
+    result._22 = A._21 * B._12 + A._22 * B._22 + A._23 * B._32 + A._24 * B._42;
+    result._31 = A._31 * B._11 + A._32 * B._21 + A._33 * B._31 + A._34 * B._41;
+    result._32 = A._31 * B._12 + A._32 * B._22 + A._33 * B._32 + A._34 * B._42;
+    result._41 = A._41 * B._11 + A._42 * B._21 + A._43 * B._31 + A._44 * B._41;
+    result._42 = A._41 * B._12 + A._42 * B._22 + A._43 * B._32 + A._44 * B._42;
+    return result;
+}
+
+LINALG_INLINE mat4x3f_t mat4f_mul_mat4x3f(mat4f_t A, mat4x3f_t B) {
+    mat4x3f_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21 + A._13 * B._31 + A._14 * B._41;
+    result._12 = A._11 * B._12 + A._12 * B._22 + A._13 * B._32 + A._14 * B._42;
+    result._13 = A._11 * B._13 + A._12 * B._23 + A._13 * B._33 + A._14 * B._43;
+    result._21 = A._21 * B._11 + A._22 * B._21 + A._23 * B._31 + A._24 * B._41;
+    result._22 = A._21 * B._12 + A._22 * B._22 + A._23 * B._32 + A._24 * B._42;
+    result._23 = A._21 * B._13 + A._22 * B._23 + A._23 * B._33 + A._24 * B._43;
+    result._31 = A._31 * B._11 + A._32 * B._21 + A._33 * B._31 + A._34 * B._41;
+    result._32 = A._31 * B._12 + A._32 * B._22 + A._33 * B._32 + A._34 * B._42;
+    result._33 = A._31 * B._13 + A._32 * B._23 + A._33 * B._33 + A._34 * B._43;
+    result._41 = A._41 * B._11 + A._42 * B._21 + A._43 * B._31 + A._44 * B._41;
+    result._42 = A._41 * B._12 + A._42 * B._22 + A._43 * B._32 + A._44 * B._42;
+    result._43 = A._41 * B._13 + A._42 * B._23 + A._43 * B._33 + A._44 * B._43;
+    return result;
+}
+
+LINALG_INLINE mat4x2d_t mat4x2d_zero(void) {
+    mat4x2d_t M = {0};
+    return M;
+}
+
+LINALG_INLINE mat4x2d_t mat4x2d_I(void) {
+    mat4x2d_t M = {0};
+    M._11 = 1;
+    M._22 = 1;
+    return M;
+}
+
+LINALG_INLINE vec4d_t mat4x2d_mul_vec(mat4x2d_t M, vec2d_t v) {
+    vec4d_t result;
+    result.e[0] = M._11 * v.e[0] + M._12 * v.e[1];
+    result.e[1] = M._21 * v.e[0] + M._22 * v.e[1];
+    result.e[2] = M._31 * v.e[0] + M._32 * v.e[1];
+    result.e[3] = M._41 * v.e[0] + M._42 * v.e[1];
+    return result;
+}
+
+LINALG_INLINE mat2x4d_t mat4x2d_transpose(mat4x2d_t M) {
+    mat2x4d_t result;
+    result._11 = M._11;
+    result._21 = M._12;
+    result._12 = M._21;
+    result._22 = M._22;
+    result._13 = M._31;
+    result._23 = M._32;
+    result._14 = M._41;
+    result._24 = M._42;
+    return result;
+}
+
+LINALG_INLINE mat4x3d_t mat4x3d_zero(void) {
+    mat4x3d_t M = {0};
+    return M;
+}
+
+LINALG_INLINE mat4x3d_t mat4x3d_I(void) {
+    mat4x3d_t M = {0};
+    M._11 = 1;
+    M._22 = 1;
+    M._33 = 1;
+    return M;
+}
+
+LINALG_INLINE vec4d_t mat4x3d_mul_vec(mat4x3d_t M, vec3d_t v) {
+    vec4d_t result;
+    result.e[0] = M._11 * v.e[0] + M._12 * v.e[1] + M._13 * v.e[2];
+    result.e[1] = M._21 * v.e[0] + M._22 * v.e[1] + M._23 * v.e[2];
+    result.e[2] = M._31 * v.e[0] + M._32 * v.e[1] + M._33 * v.e[2];
+    result.e[3] = M._41 * v.e[0] + M._42 * v.e[1] + M._43 * v.e[2];
+    return result;
+}
+
+LINALG_INLINE mat3x4d_t mat4x3d_transpose(mat4x3d_t M) {
+    mat3x4d_t result;
+    result._11 = M._11;
+    result._21 = M._12;
+    result._31 = M._13;
+    result._12 = M._21;
+    result._22 = M._22;
+    result._32 = M._23;
+    result._13 = M._31;
+    result._23 = M._32;
+    result._33 = M._33;
+    result._14 = M._41;
+    result._24 = M._42;
+    result._34 = M._43;
+    return result;
+}
+
+LINALG_INLINE mat4x2d_t mat4x2d_mul_mat2d(mat4x2d_t A, mat2d_t B) {
+    mat4x2d_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21;
+    result._12 = A._11 * B._12 + A._12 * B._22;
+    result._21 = A._21 * B._11 + A._22 * B._21;
+    result._22 = A._21 * B._12 + A._22 * B._22;
+    result._31 = A._31 * B._11 + A._32 * B._21;
+    result._32 = A._31 * B._12 + A._32 * B._22;
+    result._41 = A._41 * B._11 + A._42 * B._21;
+    result._42 = A._41 * B._12 + A._42 * B._22;
+    return result;
+}
+
+LINALG_INLINE mat4x3d_t mat4x2d_mul_mat2x3d(mat4x2d_t A, mat2x3d_t B) {
+    mat4x3d_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21;
+    result._12 = A._11 * B._12 + A._12 * B._22;
+    result._13 = A._11 * B._13 + A._12 * B._23;
+    result._21 = A._21 * B._11 + A._22 * B._21;
+    result._22 = A._21 * B._12 + A._22 * B._22;
+    result._23 = A._21 * B._13 + A._22 * B._23;
+    result._31 = A._31 * B._11 + A._32 * B._21;
+    result._32 = A._31 * B._12 + A._32 * B._22;
+    result._33 = A._31 * B._13 + A._32 * B._23;
+    result._41 = A._41 * B._11 + A._42 * B._21;
+    result._42 = A._41 * B._12 + A._42 * B._22;
+    result._43 = A._41 * B._13 + A._42 * B._23;
+    return result;
+}
+
+LINALG_INLINE mat4d_t mat4x2d_mul_mat2x4d(mat4x2d_t A, mat2x4d_t B) {
+    mat4d_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21;
+    result._12 = A._11 * B._12 + A._12 * B._22;
+    result._13 = A._11 * B._13 + A._12 * B._23;
+    result._14 = A._11 * B._14 + A._12 * B._24;
+    result._21 = A._21 * B._11 + A._22 * B._21;
+    result._22 = A._21 * B._12 + A._22 * B._22;
+    result._23 = A._21 * B._13 + A._22 * B._23;
+    result._24 = A._21 * B._14 + A._22 * B._24;
+    result._31 = A._31 * B._11 + A._32 * B._21;
+    result._32 = A._31 * B._12 + A._32 * B._22;
+    result._33 = A._31 * B._13 + A._32 * B._23;
+    result._34 = A._31 * B._14 + A._32 * B._24;
+    result._41 = A._41 * B._11 + A._42 * B._21;
+    result._42 = A._41 * B._12 + A._42 * B._22;
+    result._43 = A._41 * B._13 + A._42 * B._23;
+    result._44 = A._41 * B._14 + A._42 * B._24;
+    return result;
+}
+
+LINALG_INLINE mat4x2d_t mat4x3d_mul_mat3x2d(mat4x3d_t A, mat3x2d_t B) {
+    mat4x2d_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21 + A._13 * B._31;
+    result._12 = A._11 * B._12 + A._12 * B._22 + A._13 * B._32;
+    result._21 = A._21 * B._11 + A._22 * B._21 + A._23 * B._31;
+    result._22 = A._21 * B._12 + A._22 * B._22 + A._23 * B._32;
+    result._31 = A._31 * B._11 + A._32 * B._21 + A._33 * B._31;
+    result._32 = A._31 * B._12 + A._32 * B._22 + A._33 * B._32;
+    result._41 = A._41 * B._11 + A._42 * B._21 + A._43 * B._31;
+    result._42 = A._41 * B._12 + A._42 * B._22 + A._43 * B._32;
+    return result;
+}
+
+LINALG_INLINE mat4x3d_t mat4x3d_mul_mat3d(mat4x3d_t A, mat3d_t B) {
+    mat4x3d_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21 + A._13 * B._31;
+    result._12 = A._11 * B._12 + A._12 * B._22 + A._13 * B._32;
+    result._13 = A._11 * B._13 + A._12 * B._23 + A._13 * B._33;
+    result._21 = A._21 * B._11 + A._22 * B._21 + A._23 * B._31;
+    result._22 = A._21 * B._12 + A._22 * B._22 + A._23 * B._32;
+    result._23 = A._21 * B._13 + A._22 * B._23 + A._23 * B._33;
+    result._31 = A._31 * B._11 + A._32 * B._21 + A._33 * B._31;
+    result._32 = A._31 * B._12 + A._32 * B._22 + A._33 * B._32;
+    result._33 = A._31 * B._13 + A._32 * B._23 + A._33 * B._33;
+    result._41 = A._41 * B._11 + A._42 * B._21 + A._43 * B._31;
+    result._42 = A._41 * B._12 + A._42 * B._22 + A._43 * B._32;
+    result._43 = A._41 * B._13 + A._42 * B._23 + A._43 * B._33;
+    return result;
+}
+
+LINALG_INLINE mat4d_t mat4x3d_mul_mat3x4d(mat4x3d_t A, mat3x4d_t B) {
+    mat4d_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21 + A._13 * B._31;
+    result._12 = A._11 * B._12 + A._12 * B._22 + A._13 * B._32;
+    result._13 = A._11 * B._13 + A._12 * B._23 + A._13 * B._33;
+    result._14 = A._11 * B._14 + A._12 * B._24 + A._13 * B._34;
+    result._21 = A._21 * B._11 + A._22 * B._21 + A._23 * B._31;
+    result._22 = A._21 * B._12 + A._22 * B._22 + A._23 * B._32;
+    result._23 = A._21 * B._13 + A._22 * B._23 + A._23 * B._33;
+    result._24 = A._21 * B._14 + A._22 * B._24 + A._23 * B._34;
+    result._31 = A._31 * B._11 + A._32 * B._21 + A._33 * B._31;
+    result._32 = A._31 * B._12 + A._32 * B._22 + A._33 * B._32;
+    result._33 = A._31 * B._13 + A._32 * B._23 + A._33 * B._33;
+    result._34 = A._31 * B._14 + A._32 * B._24 + A._33 * B._34;
+    result._41 = A._41 * B._11 + A._42 * B._21 + A._43 * B._31;
+    result._42 = A._41 * B._12 + A._42 * B._22 + A._43 * B._32;
+    result._43 = A._41 * B._13 + A._42 * B._23 + A._43 * B._33;
+    result._44 = A._41 * B._14 + A._42 * B._24 + A._43 * B._34;
+    return result;
+}
+
+LINALG_INLINE mat4x2d_t mat4d_mul_mat4x2d(mat4d_t A, mat4x2d_t B) {
+    mat4x2d_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21 + A._13 * B._31 + A._14 * B._41;
+    result._12 = A._11 * B._12 + A._12 * B._22 + A._13 * B._32 + A._14 * B._42;
+    result._21 = A._21 * B._11 + A._22 * B._21 + A._23 * B._31 + A._24 * B._41;
+    result._22 = A._21 * B._12 + A._22 * B._22 + A._23 * B._32 + A._24 * B._42;
+    result._31 = A._31 * B._11 + A._32 * B._21 + A._33 * B._31 + A._34 * B._41;
+    result._32 = A._31 * B._12 + A._32 * B._22 + A._33 * B._32 + A._34 * B._42;
+    result._41 = A._41 * B._11 + A._42 * B._21 + A._43 * B._31 + A._44 * B._41;
+    result._42 = A._41 * B._12 + A._42 * B._22 + A._43 * B._32 + A._44 * B._42;
+    return result;
+}
+
+LINALG_INLINE mat4x3d_t mat4d_mul_mat4x3d(mat4d_t A, mat4x3d_t B) {
+    mat4x3d_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21 + A._13 * B._31 + A._14 * B._41;
+    result._12 = A._11 * B._12 + A._12 * B._22 + A._13 * B._32 + A._14 * B._42;
+    result._13 = A._11 * B._13 + A._12 * B._23 + A._13 * B._33 + A._14 * B._43;
+    result._21 = A._21 * B._11 + A._22 * B._21 + A._23 * B._31 + A._24 * B._41;
+    result._22 = A._21 * B._12 + A._22 * B._22 + A._23 * B._32 + A._24 * B._42;
+    result._23 = A._21 * B._13 + A._22 * B._23 + A._23 * B._33 + A._24 * B._43;
+    result._31 = A._31 * B._11 + A._32 * B._21 + A._33 * B._31 + A._34 * B._41;
+    result._32 = A._31 * B._12 + A._32 * B._22 + A._33 * B._32 + A._34 * B._42;
+    result._33 = A._31 * B._13 + A._32 * B._23 + A._33 * B._33 + A._34 * B._43;
+    result._41 = A._41 * B._11 + A._42 * B._21 + A._43 * B._31 + A._44 * B._41;
+    result._42 = A._41 * B._12 + A._42 * B._22 + A._43 * B._32 + A._44 * B._42;
+    result._43 = A._41 * B._13 + A._42 * B._23 + A._43 * B._33 + A._44 * B._43;
+    return result;
+}
+
+LINALG_INLINE mat4x2i_t mat4x2i_zero(void) {
+    mat4x2i_t M = {0};
+    return M;
+}
+
+LINALG_INLINE mat4x2i_t mat4x2i_I(void) {
+    mat4x2i_t M = {0};
+    M._11 = 1;
+    M._22 = 1;
+    return M;
+}
+
+LINALG_INLINE vec4i_t mat4x2i_mul_vec(mat4x2i_t M, vec2i_t v) {
+    vec4i_t result;
+    result.e[0] = M._11 * v.e[0] + M._12 * v.e[1];
+    result.e[1] = M._21 * v.e[0] + M._22 * v.e[1];
+    result.e[2] = M._31 * v.e[0] + M._32 * v.e[1];
+    result.e[3] = M._41 * v.e[0] + M._42 * v.e[1];
+    return result;
+}
+
+LINALG_INLINE mat2x4i_t mat4x2i_transpose(mat4x2i_t M) {
+    mat2x4i_t result;
+    result._11 = M._11;
+    result._21 = M._12;
+    result._12 = M._21;
+    result._22 = M._22;
+    result._13 = M._31;
+    result._23 = M._32;
+    result._14 = M._41;
+    result._24 = M._42;
+    return result;
+}
+
+LINALG_INLINE mat4x3i_t mat4x3i_zero(void) {
+    mat4x3i_t M = {0};
+    return M;
+}
+
+LINALG_INLINE mat4x3i_t mat4x3i_I(void) {
+    mat4x3i_t M = {0};
+    M._11 = 1;
+    M._22 = 1;
+    M._33 = 1;
+    return M;
+}
+
+LINALG_INLINE vec4i_t mat4x3i_mul_vec(mat4x3i_t M, vec3i_t v) {
+    vec4i_t result;
+    result.e[0] = M._11 * v.e[0] + M._12 * v.e[1] + M._13 * v.e[2];
+    result.e[1] = M._21 * v.e[0] + M._22 * v.e[1] + M._23 * v.e[2];
+    result.e[2] = M._31 * v.e[0] + M._32 * v.e[1] + M._33 * v.e[2];
+    result.e[3] = M._41 * v.e[0] + M._42 * v.e[1] + M._43 * v.e[2];
+    return result;
+}
+
+LINALG_INLINE mat3x4i_t mat4x3i_transpose(mat4x3i_t M) {
+    mat3x4i_t result;
+    result._11 = M._11;
+    result._21 = M._12;
+    result._31 = M._13;
+    result._12 = M._21;
+    result._22 = M._22;
+    result._32 = M._23;
+    result._13 = M._31;
+    result._23 = M._32;
+    result._33 = M._33;
+    result._14 = M._41;
+    result._24 = M._42;
+    result._34 = M._43;
+    return result;
+}
+
+LINALG_INLINE mat4x2i_t mat4x2i_mul_mat2i(mat4x2i_t A, mat2i_t B) {
+    mat4x2i_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21;
+    result._12 = A._11 * B._12 + A._12 * B._22;
+    result._21 = A._21 * B._11 + A._22 * B._21;
+    result._22 = A._21 * B._12 + A._22 * B._22;
+    result._31 = A._31 * B._11 + A._32 * B._21;
+    result._32 = A._31 * B._12 + A._32 * B._22;
+    result._41 = A._41 * B._11 + A._42 * B._21;
+    result._42 = A._41 * B._12 + A._42 * B._22;
+    return result;
+}
+
+LINALG_INLINE mat4x3i_t mat4x2i_mul_mat2x3i(mat4x2i_t A, mat2x3i_t B) {
+    mat4x3i_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21;
+    result._12 = A._11 * B._12 + A._12 * B._22;
+    result._13 = A._11 * B._13 + A._12 * B._23;
+    result._21 = A._21 * B._11 + A._22 * B._21;
+    result._22 = A._21 * B._12 + A._22 * B._22;
+    result._23 = A._21 * B._13 + A._22 * B._23;
+    result._31 = A._31 * B._11 + A._32 * B._21;
+    result._32 = A._31 * B._12 + A._32 * B._22;
+    result._33 = A._31 * B._13 + A._32 * B._23;
+    result._41 = A._41 * B._11 + A._42 * B._21;
+    result._42 = A._41 * B._12 + A._42 * B._22;
+    result._43 = A._41 * B._13 + A._42 * B._23;
+    return result;
+}
+
+LINALG_INLINE mat4i_t mat4x2i_mul_mat2x4i(mat4x2i_t A, mat2x4i_t B) {
+    mat4i_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21;
+    result._12 = A._11 * B._12 + A._12 * B._22;
+    result._13 = A._11 * B._13 + A._12 * B._23;
+    result._14 = A._11 * B._14 + A._12 * B._24;
+    result._21 = A._21 * B._11 + A._22 * B._21;
+    result._22 = A._21 * B._12 + A._22 * B._22;
+    result._23 = A._21 * B._13 + A._22 * B._23;
+    result._24 = A._21 * B._14 + A._22 * B._24;
+    result._31 = A._31 * B._11 + A._32 * B._21;
+    result._32 = A._31 * B._12 + A._32 * B._22;
+    result._33 = A._31 * B._13 + A._32 * B._23;
+    result._34 = A._31 * B._14 + A._32 * B._24;
+    result._41 = A._41 * B._11 + A._42 * B._21;
+    result._42 = A._41 * B._12 + A._42 * B._22;
+    result._43 = A._41 * B._13 + A._42 * B._23;
+    result._44 = A._41 * B._14 + A._42 * B._24;
+    return result;
+}
+
+LINALG_INLINE mat4x2i_t mat4x3i_mul_mat3x2i(mat4x3i_t A, mat3x2i_t B) {
+    mat4x2i_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21 + A._13 * B._31;
+    result._12 = A._11 * B._12 + A._12 * B._22 + A._13 * B._32;
+    result._21 = A._21 * B._11 + A._22 * B._21 + A._23 * B._31;
+    result._22 = A._21 * B._12 + A._22 * B._22 + A._23 * B._32;
+    result._31 = A._31 * B._11 + A._32 * B._21 + A._33 * B._31;
+    result._32 = A._31 * B._12 + A._32 * B._22 + A._33 * B._32;
+    result._41 = A._41 * B._11 + A._42 * B._21 + A._43 * B._31;
+    result._42 = A._41 * B._12 + A._42 * B._22 + A._43 * B._32;
+    return result;
+}
+
+LINALG_INLINE mat4x3i_t mat4x3i_mul_mat3i(mat4x3i_t A, mat3i_t B) {
+    mat4x3i_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21 + A._13 * B._31;
+    result._12 = A._11 * B._12 + A._12 * B._22 + A._13 * B._32;
+    result._13 = A._11 * B._13 + A._12 * B._23 + A._13 * B._33;
+    result._21 = A._21 * B._11 + A._22 * B._21 + A._23 * B._31;
+    result._22 = A._21 * B._12 + A._22 * B._22 + A._23 * B._32;
+    result._23 = A._21 * B._13 + A._22 * B._23 + A._23 * B._33;
+    result._31 = A._31 * B._11 + A._32 * B._21 + A._33 * B._31;
+    result._32 = A._31 * B._12 + A._32 * B._22 + A._33 * B._32;
+    result._33 = A._31 * B._13 + A._32 * B._23 + A._33 * B._33;
+    result._41 = A._41 * B._11 + A._42 * B._21 + A._43 * B._31;
+    result._42 = A._41 * B._12 + A._42 * B._22 + A._43 * B._32;
+    result._43 = A._41 * B._13 + A._42 * B._23 + A._43 * B._33;
+    return result;
+}
+
+LINALG_INLINE mat4i_t mat4x3i_mul_mat3x4i(mat4x3i_t A, mat3x4i_t B) {
+    mat4i_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21 + A._13 * B._31;
+    result._12 = A._11 * B._12 + A._12 * B._22 + A._13 * B._32;
+    result._13 = A._11 * B._13 + A._12 * B._23 + A._13 * B._33;
+    result._14 = A._11 * B._14 + A._12 * B._24 + A._13 * B._34;
+    result._21 = A._21 * B._11 + A._22 * B._21 + A._23 * B._31;
+    result._22 = A._21 * B._12 + A._22 * B._22 + A._23 * B._32;
+    result._23 = A._21 * B._13 + A._22 * B._23 + A._23 * B._33;
+    result._24 = A._21 * B._14 + A._22 * B._24 + A._23 * B._34;
+    result._31 = A._31 * B._11 + A._32 * B._21 + A._33 * B._31;
+    result._32 = A._31 * B._12 + A._32 * B._22 + A._33 * B._32;
+    result._33 = A._31 * B._13 + A._32 * B._23 + A._33 * B._33;
+    result._34 = A._31 * B._14 + A._32 * B._24 + A._33 * B._34;
+    result._41 = A._41 * B._11 + A._42 * B._21 + A._43 * B._31;
+    result._42 = A._41 * B._12 + A._42 * B._22 + A._43 * B._32;
+    result._43 = A._41 * B._13 + A._42 * B._23 + A._43 * B._33;
+    result._44 = A._41 * B._14 + A._42 * B._24 + A._43 * B._34;
+    return result;
+}
+
+LINALG_INLINE mat4x2i_t mat4i_mul_mat4x2i(mat4i_t A, mat4x2i_t B) {
+    mat4x2i_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21 + A._13 * B._31 + A._14 * B._41;
+    result._12 = A._11 * B._12 + A._12 * B._22 + A._13 * B._32 + A._14 * B._42;
+    result._21 = A._21 * B._11 + A._22 * B._21 + A._23 * B._31 + A._24 * B._41;
+    result._22 = A._21 * B._12 + A._22 * B._22 + A._23 * B._32 + A._24 * B._42;
+    result._31 = A._31 * B._11 + A._32 * B._21 + A._33 * B._31 + A._34 * B._41;
+    result._32 = A._31 * B._12 + A._32 * B._22 + A._33 * B._32 + A._34 * B._42;
+    result._41 = A._41 * B._11 + A._42 * B._21 + A._43 * B._31 + A._44 * B._41;
+    result._42 = A._41 * B._12 + A._42 * B._22 + A._43 * B._32 + A._44 * B._42;
+    return result;
+}
+
+LINALG_INLINE mat4x3i_t mat4i_mul_mat4x3i(mat4i_t A, mat4x3i_t B) {
+    mat4x3i_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21 + A._13 * B._31 + A._14 * B._41;
+    result._12 = A._11 * B._12 + A._12 * B._22 + A._13 * B._32 + A._14 * B._42;
+    result._13 = A._11 * B._13 + A._12 * B._23 + A._13 * B._33 + A._14 * B._43;
+    result._21 = A._21 * B._11 + A._22 * B._21 + A._23 * B._31 + A._24 * B._41;
+    result._22 = A._21 * B._12 + A._22 * B._22 + A._23 * B._32 + A._24 * B._42;
+    result._23 = A._21 * B._13 + A._22 * B._23 + A._23 * B._33 + A._24 * B._43;
+    result._31 = A._31 * B._11 + A._32 * B._21 + A._33 * B._31 + A._34 * B._41;
+    result._32 = A._31 * B._12 + A._32 * B._22 + A._33 * B._32 + A._34 * B._42;
+    result._33 = A._31 * B._13 + A._32 * B._23 + A._33 * B._33 + A._34 * B._43;
+    result._41 = A._41 * B._11 + A._42 * B._21 + A._43 * B._31 + A._44 * B._41;
+    result._42 = A._41 * B._12 + A._42 * B._22 + A._43 * B._32 + A._44 * B._42;
+    result._43 = A._41 * B._13 + A._42 * B._23 + A._43 * B._33 + A._44 * B._43;
+    return result;
+}
+
+LINALG_INLINE mat4x2u_t mat4x2u_zero(void) {
+    mat4x2u_t M = {0};
+    return M;
+}
+
+LINALG_INLINE mat4x2u_t mat4x2u_I(void) {
+    mat4x2u_t M = {0};
+    M._11 = 1;
+    M._22 = 1;
+    return M;
+}
+
+LINALG_INLINE vec4u_t mat4x2u_mul_vec(mat4x2u_t M, vec2u_t v) {
+    vec4u_t result;
+    result.e[0] = M._11 * v.e[0] + M._12 * v.e[1];
+    result.e[1] = M._21 * v.e[0] + M._22 * v.e[1];
+    result.e[2] = M._31 * v.e[0] + M._32 * v.e[1];
+    result.e[3] = M._41 * v.e[0] + M._42 * v.e[1];
+    return result;
+}
+
+LINALG_INLINE mat2x4u_t mat4x2u_transpose(mat4x2u_t M) {
+    mat2x4u_t result;
+    result._11 = M._11;
+    result._21 = M._12;
+    result._12 = M._21;
+    result._22 = M._22;
+    result._13 = M._31;
+    result._23 = M._32;
+    result._14 = M._41;
+    result._24 = M._42;
+    return result;
+}
+
+LINALG_INLINE mat4x3u_t mat4x3u_zero(void) {
+    mat4x3u_t M = {0};
+    return M;
+}
+
+LINALG_INLINE mat4x3u_t mat4x3u_I(void) {
+    mat4x3u_t M = {0};
+    M._11 = 1;
+    M._22 = 1;
+    M._33 = 1;
+    return M;
+}
+
+LINALG_INLINE vec4u_t mat4x3u_mul_vec(mat4x3u_t M, vec3u_t v) {
+    vec4u_t result;
+    result.e[0] = M._11 * v.e[0] + M._12 * v.e[1] + M._13 * v.e[2];
+    result.e[1] = M._21 * v.e[0] + M._22 * v.e[1] + M._23 * v.e[2];
+    result.e[2] = M._31 * v.e[0] + M._32 * v.e[1] + M._33 * v.e[2];
+    result.e[3] = M._41 * v.e[0] + M._42 * v.e[1] + M._43 * v.e[2];
+    return result;
+}
+
+LINALG_INLINE mat3x4u_t mat4x3u_transpose(mat4x3u_t M) {
+    mat3x4u_t result;
+    result._11 = M._11;
+    result._21 = M._12;
+    result._31 = M._13;
+    result._12 = M._21;
+    result._22 = M._22;
+    result._32 = M._23;
+    result._13 = M._31;
+    result._23 = M._32;
+    result._33 = M._33;
+    result._14 = M._41;
+    result._24 = M._42;
+    result._34 = M._43;
+    return result;
+}
+
+LINALG_INLINE mat4x2u_t mat4x2u_mul_mat2u(mat4x2u_t A, mat2u_t B) {
+    mat4x2u_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21;
+    result._12 = A._11 * B._12 + A._12 * B._22;
+    result._21 = A._21 * B._11 + A._22 * B._21;
+    result._22 = A._21 * B._12 + A._22 * B._22;
+    result._31 = A._31 * B._11 + A._32 * B._21;
+    result._32 = A._31 * B._12 + A._32 * B._22;
+    result._41 = A._41 * B._11 + A._42 * B._21;
+    result._42 = A._41 * B._12 + A._42 * B._22;
+    return result;
+}
+
+LINALG_INLINE mat4x3u_t mat4x2u_mul_mat2x3u(mat4x2u_t A, mat2x3u_t B) {
+    mat4x3u_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21;
+    result._12 = A._11 * B._12 + A._12 * B._22;
+    result._13 = A._11 * B._13 + A._12 * B._23;
+    result._21 = A._21 * B._11 + A._22 * B._21;
+    result._22 = A._21 * B._12 + A._22 * B._22;
+    result._23 = A._21 * B._13 + A._22 * B._23;
+    result._31 = A._31 * B._11 + A._32 * B._21;
+    result._32 = A._31 * B._12 + A._32 * B._22;
+    result._33 = A._31 * B._13 + A._32 * B._23;
+    result._41 = A._41 * B._11 + A._42 * B._21;
+    result._42 = A._41 * B._12 + A._42 * B._22;
+    result._43 = A._41 * B._13 + A._42 * B._23;
+    return result;
+}
+
+LINALG_INLINE mat4u_t mat4x2u_mul_mat2x4u(mat4x2u_t A, mat2x4u_t B) {
+    mat4u_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21;
+    result._12 = A._11 * B._12 + A._12 * B._22;
+    result._13 = A._11 * B._13 + A._12 * B._23;
+    result._14 = A._11 * B._14 + A._12 * B._24;
+    result._21 = A._21 * B._11 + A._22 * B._21;
+    result._22 = A._21 * B._12 + A._22 * B._22;
+    result._23 = A._21 * B._13 + A._22 * B._23;
+    result._24 = A._21 * B._14 + A._22 * B._24;
+    result._31 = A._31 * B._11 + A._32 * B._21;
+    result._32 = A._31 * B._12 + A._32 * B._22;
+    result._33 = A._31 * B._13 + A._32 * B._23;
+    result._34 = A._31 * B._14 + A._32 * B._24;
+    result._41 = A._41 * B._11 + A._42 * B._21;
+    result._42 = A._41 * B._12 + A._42 * B._22;
+    result._43 = A._41 * B._13 + A._42 * B._23;
+    result._44 = A._41 * B._14 + A._42 * B._24;
+    return result;
+}
+
+LINALG_INLINE mat4x2u_t mat4x3u_mul_mat3x2u(mat4x3u_t A, mat3x2u_t B) {
+    mat4x2u_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21 + A._13 * B._31;
+    result._12 = A._11 * B._12 + A._12 * B._22 + A._13 * B._32;
+    result._21 = A._21 * B._11 + A._22 * B._21 + A._23 * B._31;
+    result._22 = A._21 * B._12 + A._22 * B._22 + A._23 * B._32;
+    result._31 = A._31 * B._11 + A._32 * B._21 + A._33 * B._31;
+    result._32 = A._31 * B._12 + A._32 * B._22 + A._33 * B._32;
+    result._41 = A._41 * B._11 + A._42 * B._21 + A._43 * B._31;
+    result._42 = A._41 * B._12 + A._42 * B._22 + A._43 * B._32;
+    return result;
+}
+
+LINALG_INLINE mat4x3u_t mat4x3u_mul_mat3u(mat4x3u_t A, mat3u_t B) {
+    mat4x3u_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21 + A._13 * B._31;
+    result._12 = A._11 * B._12 + A._12 * B._22 + A._13 * B._32;
+    result._13 = A._11 * B._13 + A._12 * B._23 + A._13 * B._33;
+    result._21 = A._21 * B._11 + A._22 * B._21 + A._23 * B._31;
+    result._22 = A._21 * B._12 + A._22 * B._22 + A._23 * B._32;
+    result._23 = A._21 * B._13 + A._22 * B._23 + A._23 * B._33;
+    result._31 = A._31 * B._11 + A._32 * B._21 + A._33 * B._31;
+    result._32 = A._31 * B._12 + A._32 * B._22 + A._33 * B._32;
+    result._33 = A._31 * B._13 + A._32 * B._23 + A._33 * B._33;
+    result._41 = A._41 * B._11 + A._42 * B._21 + A._43 * B._31;
+    result._42 = A._41 * B._12 + A._42 * B._22 + A._43 * B._32;
+    result._43 = A._41 * B._13 + A._42 * B._23 + A._43 * B._33;
+    return result;
+}
+
+LINALG_INLINE mat4u_t mat4x3u_mul_mat3x4u(mat4x3u_t A, mat3x4u_t B) {
+    mat4u_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21 + A._13 * B._31;
+    result._12 = A._11 * B._12 + A._12 * B._22 + A._13 * B._32;
+    result._13 = A._11 * B._13 + A._12 * B._23 + A._13 * B._33;
+    result._14 = A._11 * B._14 + A._12 * B._24 + A._13 * B._34;
+    result._21 = A._21 * B._11 + A._22 * B._21 + A._23 * B._31;
+    result._22 = A._21 * B._12 + A._22 * B._22 + A._23 * B._32;
+    result._23 = A._21 * B._13 + A._22 * B._23 + A._23 * B._33;
+    result._24 = A._21 * B._14 + A._22 * B._24 + A._23 * B._34;
+    result._31 = A._31 * B._11 + A._32 * B._21 + A._33 * B._31;
+    result._32 = A._31 * B._12 + A._32 * B._22 + A._33 * B._32;
+    result._33 = A._31 * B._13 + A._32 * B._23 + A._33 * B._33;
+    result._34 = A._31 * B._14 + A._32 * B._24 + A._33 * B._34;
+    result._41 = A._41 * B._11 + A._42 * B._21 + A._43 * B._31;
+    result._42 = A._41 * B._12 + A._42 * B._22 + A._43 * B._32;
+    result._43 = A._41 * B._13 + A._42 * B._23 + A._43 * B._33;
+    result._44 = A._41 * B._14 + A._42 * B._24 + A._43 * B._34;
+    return result;
+}
+
+LINALG_INLINE mat4x2u_t mat4u_mul_mat4x2u(mat4u_t A, mat4x2u_t B) {
+    mat4x2u_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21 + A._13 * B._31 + A._14 * B._41;
+    result._12 = A._11 * B._12 + A._12 * B._22 + A._13 * B._32 + A._14 * B._42;
+    result._21 = A._21 * B._11 + A._22 * B._21 + A._23 * B._31 + A._24 * B._41;
+    result._22 = A._21 * B._12 + A._22 * B._22 + A._23 * B._32 + A._24 * B._42;
+    result._31 = A._31 * B._11 + A._32 * B._21 + A._33 * B._31 + A._34 * B._41;
+    result._32 = A._31 * B._12 + A._32 * B._22 + A._33 * B._32 + A._34 * B._42;
+    result._41 = A._41 * B._11 + A._42 * B._21 + A._43 * B._31 + A._44 * B._41;
+    result._42 = A._41 * B._12 + A._42 * B._22 + A._43 * B._32 + A._44 * B._42;
+    return result;
+}
+
+LINALG_INLINE mat4x3u_t mat4u_mul_mat4x3u(mat4u_t A, mat4x3u_t B) {
+    mat4x3u_t result;
+    result._11 = A._11 * B._11 + A._12 * B._21 + A._13 * B._31 + A._14 * B._41;
+    result._12 = A._11 * B._12 + A._12 * B._22 + A._13 * B._32 + A._14 * B._42;
+    result._13 = A._11 * B._13 + A._12 * B._23 + A._13 * B._33 + A._14 * B._43;
+    result._21 = A._21 * B._11 + A._22 * B._21 + A._23 * B._31 + A._24 * B._41;
+    result._22 = A._21 * B._12 + A._22 * B._22 + A._23 * B._32 + A._24 * B._42;
+    result._23 = A._21 * B._13 + A._22 * B._23 + A._23 * B._33 + A._24 * B._43;
+    result._31 = A._31 * B._11 + A._32 * B._21 + A._33 * B._31 + A._34 * B._41;
+    result._32 = A._31 * B._12 + A._32 * B._22 + A._33 * B._32 + A._34 * B._42;
+    result._33 = A._31 * B._13 + A._32 * B._23 + A._33 * B._33 + A._34 * B._43;
+    result._41 = A._41 * B._11 + A._42 * B._21 + A._43 * B._31 + A._44 * B._41;
+    result._42 = A._41 * B._12 + A._42 * B._22 + A._43 * B._32 + A._44 * B._42;
+    result._43 = A._41 * B._13 + A._42 * B._23 + A._43 * B._33 + A._44 * B._43;
+    return result;
+}
+
+LINALG_INLINE quatf_t quatf(float x, float y, float z, float w) {
+    return (quatf_t){.x = x, .y = y, .z = z, .w = w};
+}
+
+LINALG_INLINE quatf_t quatf_identity(void) { return quatf(0, 0, 0, 1); }
+
+LINALG_INLINE quatf_t quatf_from_axis_angle(vec3f_t axis, float angle) {
+    float s = sinf(0.5f * angle);
+    return quatf(axis.x * s, axis.y * s, axis.z * s, cosf(0.5f * angle));
+}
+
+LINALG_INLINE quatf_t quatf_mul(quatf_t a, quatf_t b) {
+#ifdef LINALG_SIMD
+    const __m128 a_m = a.v.m, b_m = b.v.m;
+    const __m128 a_w = _mm_shuffle_ps(a_m, a_m, _MM_SHUFFLE(3, 3, 3, 3));
+    __m128 result = _mm_mul_ps(a_w, b_m);
+    const __m128 a_x = _mm_shuffle_ps(a_m, a_m, _MM_SHUFFLE(0, 0, 0, 0));
+    __m128 b_wzyx = _mm_shuffle_ps(b_m, b_m, _MM_SHUFFLE(0, 1, 2, 3));
+    b_wzyx = _mm_xor_ps(b_wzyx, _mm_setr_ps(0.0f, -0.0f, 0.0f, -0.0f));
+    result = linalg_madd_ps(a_x, b_wzyx, result);
+    const __m128 a_y = _mm_shuffle_ps(a_m, a_m, _MM_SHUFFLE(1, 1, 1, 1));
+    __m128 b_zwxy = _mm_shuffle_ps(b_m, b_m, _MM_SHUFFLE(1, 0, 3, 2));
+    b_zwxy = _mm_xor_ps(b_zwxy, _mm_setr_ps(0.0f, 0.0f, -0.0f, -0.0f));
+    result = linalg_madd_ps(a_y, b_zwxy, result);
+    const __m128 a_z = _mm_shuffle_ps(a_m, a_m, _MM_SHUFFLE(2, 2, 2, 2));
+    __m128 b_yxwz = _mm_shuffle_ps(b_m, b_m, _MM_SHUFFLE(2, 3, 0, 1));
+    b_yxwz = _mm_xor_ps(b_yxwz, _mm_setr_ps(-0.0f, 0.0f, 0.0f, -0.0f));
+    result = linalg_madd_ps(a_z, b_yxwz, result);
+    return (quatf_t){.v.m = result};
+#else
+    return quatf(a.w * b.x + a.x * b.w + a.y * b.z - a.z * b.y,
+                 a.w * b.y - a.x * b.z + a.y * b.w + a.z * b.x,
+                 a.w * b.z + a.x * b.y - a.y * b.x + a.z * b.w,
+                 a.w * b.w - a.x * b.x - a.y * b.y - a.z * b.z);
+#endif // LINALG_SIMD
+}
+
+LINALG_INLINE quatf_t quatf_conjugate(quatf_t q) {
+    return quatf(-q.x, -q.y, -q.z, q.w);
+}
+
+LINALG_INLINE quatf_t quatf_inverse(quatf_t q) {
+    float inv_sqrlen = 1 / vec4f_sqrlen(q.v);
+    return quatf(-q.x * inv_sqrlen, -q.y * inv_sqrlen, -q.z * inv_sqrlen,
+                 q.w * inv_sqrlen);
+}
+
+LINALG_INLINE quatf_t quatf_normalize(quatf_t q) {
+    return (quatf_t){.v = vec4f_unit(q.v)};
+}
+
+LINALG_DEF quatf_t quatf_nlerp(quatf_t a, quatf_t b, float t);
+LINALG_DEF quatf_t quatf_slerp(quatf_t a, quatf_t b, float t);
+
+LINALG_INLINE vec3f_t quatf_rotate_vec(quatf_t q, vec3f_t v) {
+    float tx = 2 * (q.y * v.z - q.z * v.y);
+    float ty = 2 * (q.z * v.x - q.x * v.z);
+    float tz = 2 * (q.x * v.y - q.y * v.x);
+    vec3f_t result;
+    result.x = v.x + q.w * tx + (q.y * tz - q.z * ty);
+    result.y = v.y + q.w * ty + (q.z * tx - q.x * tz);
+    result.z = v.z + q.w * tz + (q.x * ty - q.y * tx);
+    return result;
+}
+
+LINALG_INLINE mat3f_t quatf_to_mat3(quatf_t q) {
+    float x2 = q.x + q.x, y2 = q.y + q.y, z2 = q.z + q.z;
+    float xx = q.x * x2, yy = q.y * y2, zz = q.z * z2;
+    float xy = q.x * y2, xz = q.x * z2, yz = q.y * z2;
+    float wx = q.w * x2, wy = q.w * y2, wz = q.w * z2;
+    mat3f_t R = {0};
+    R._11 = 1 - (yy + zz);
+    R._12 = xy - wz;
+    R._13 = xz + wy;
+    R._21 = xy + wz;
+    R._22 = 1 - (xx + zz);
+    R._23 = yz - wx;
+    R._31 = xz - wy;
+    R._32 = yz + wx;
+    R._33 = 1 - (xx + yy);
+    return R;
+}
+
+LINALG_INLINE mat4f_t quatf_to_mat4(quatf_t q) {
+    float x2 = q.x + q.x, y2 = q.y + q.y, z2 = q.z + q.z;
+    float xx = q.x * x2, yy = q.y * y2, zz = q.z * z2;
+    float xy = q.x * y2, xz = q.x * z2, yz = q.y * z2;
+    float wx = q.w * x2, wy = q.w * y2, wz = q.w * z2;
+    mat4f_t R = {0};
+    R._11 = 1 - (yy + zz);
+    R._12 = xy - wz;
+    R._13 = xz + wy;
+    R._21 = xy + wz;
+    R._22 = 1 - (xx + zz);
+    R._23 = yz - wx;
+    R._31 = xz - wy;
+    R._32 = yz + wx;
+    R._33 = 1 - (xx + yy);
+    R._44 = 1;
+    return R;
+}
+
+LINALG_INLINE quatf_t quatf_from_mat3(mat3f_t R) {
+    float trace = R._11 + R._22 + R._33;
+    if (trace > 0) {
+        float s = 2 * sqrtf(trace + 1);
+        return quatf((R._32 - R._23) / s, (R._13 - R._31) / s,
+                     (R._21 - R._12) / s, 0.25f * s);
+    }
+    if (R._11 > R._22 && R._11 > R._33) {
+        float s = 2 * sqrtf(1 + R._11 - R._22 - R._33);
+        return quatf(0.25f * s, (R._12 + R._21) / s, (R._13 + R._31) / s,
+                     (R._32 - R._23) / s);
+    }
+    if (R._22 > R._33) {
+        float s = 2 * sqrtf(1 + R._22 - R._11 - R._33);
+        return quatf((R._12 + R._21) / s, 0.25f * s, (R._23 + R._32) / s,
+                     (R._13 - R._31) / s);
+    }
+    float s = 2 * sqrtf(1 + R._33 - R._11 - R._22);
+    return quatf((R._13 + R._31) / s, (R._23 + R._32) / s, 0.25f * s,
+                 (R._21 - R._12) / s);
+}
+
+LINALG_INLINE quatf_t quatf_from_mat4(mat4f_t R) {
+    float trace = R._11 + R._22 + R._33;
+    if (trace > 0) {
+        float s = 2 * sqrtf(trace + 1);
+        return quatf((R._32 - R._23) / s, (R._13 - R._31) / s,
+                     (R._21 - R._12) / s, 0.25f * s);
+    }
+    if (R._11 > R._22 && R._11 > R._33) {
+        float s = 2 * sqrtf(1 + R._11 - R._22 - R._33);
+        return quatf(0.25f * s, (R._12 + R._21) / s, (R._13 + R._31) / s,
+                     (R._32 - R._23) / s);
+    }
+    if (R._22 > R._33) {
+        float s = 2 * sqrtf(1 + R._22 - R._11 - R._33);
+        return quatf((R._12 + R._21) / s, 0.25f * s, (R._23 + R._32) / s,
+                     (R._13 - R._31) / s);
+    }
+    float s = 2 * sqrtf(1 + R._33 - R._11 - R._22);
+    return quatf((R._13 + R._31) / s, (R._23 + R._32) / s, 0.25f * s,
+                 (R._21 - R._12) / s);
+}
+
+LINALG_INLINE quatd_t quatd(double x, double y, double z, double w) {
+    return (quatd_t){.x = x, .y = y, .z = z, .w = w};
+}
+
+LINALG_INLINE quatd_t quatd_identity(void) { return quatd(0, 0, 0, 1); }
+
+LINALG_INLINE quatd_t quatd_from_axis_angle(vec3d_t axis, double angle) {
+    double s = sin(0.5 * angle);
+    return quatd(axis.x * s, axis.y * s, axis.z * s, cos(0.5 * angle));
+}
+
+LINALG_INLINE quatd_t quatd_mul(quatd_t a, quatd_t b) {
+    return quatd(a.w * b.x + a.x * b.w + a.y * b.z - a.z * b.y,
+                 a.w * b.y - a.x * b.z + a.y * b.w + a.z * b.x,
+                 a.w * b.z + a.x * b.y - a.y * b.x + a.z * b.w,
+                 a.w * b.w - a.x * b.x - a.y * b.y - a.z * b.z);
+}
+
+LINALG_INLINE quatd_t quatd_conjugate(quatd_t q) {
+    return quatd(-q.x, -q.y, -q.z, q.w);
+}
+
+LINALG_INLINE quatd_t quatd_inverse(quatd_t q) {
+    double inv_sqrlen = 1 / vec4d_sqrlen(q.v);
+    return quatd(-q.x * inv_sqrlen, -q.y * inv_sqrlen, -q.z * inv_sqrlen,
+                 q.w * inv_sqrlen);
+}
+
+LINALG_INLINE quatd_t quatd_normalize(quatd_t q) {
+    return (quatd_t){.v = vec4d_unit(q.v)};
+}
+
+LINALG_DEF quatd_t quatd_nlerp(quatd_t a, quatd_t b, double t);
+LINALG_DEF quatd_t quatd_slerp(quatd_t a, quatd_t b, double t);
+
+LINALG_INLINE vec3d_t quatd_rotate_vec(quatd_t q, vec3d_t v) {
+    double tx = 2 * (q.y * v.z - q.z * v.y);
+    double ty = 2 * (q.z * v.x - q.x * v.z);
+    double tz = 2 * (q.x * v.y - q.y * v.x);
+    vec3d_t result;
+    result.x = v.x + q.w * tx + (q.y * tz - q.z * ty);
+    result.y = v.y + q.w * ty + (q.z * tx - q.x * tz);
+    result.z = v.z + q.w * tz + (q.x * ty - q.y * tx);
+    return result;
+}
+
+LINALG_INLINE mat3d_t quatd_to_mat3(quatd_t q) {
+    double x2 = q.x + q.x, y2 = q.y + q.y, z2 = q.z + q.z;
+    double xx = q.x * x2, yy = q.y * y2, zz = q.z * z2;
+    double xy = q.x * y2, xz = q.x * z2, yz = q.y * z2;
+    double wx = q.w * x2, wy = q.w * y2, wz = q.w * z2;
+    mat3d_t R = {0};
+    R._11 = 1 - (yy + zz);
+    R._12 = xy - wz;
+    R._13 = xz + wy;
+    R._21 = xy + wz;
+    R._22 = 1 - (xx + zz);
+    R._23 = yz - wx;
+    R._31 = xz - wy;
+    R._32 = yz + wx;
+    R._33 = 1 - (xx + yy);
+    return R;
+}
+
+LINALG_INLINE mat4d_t quatd_to_mat4(quatd_t q) {
+    double x2 = q.x + q.x, y2 = q.y + q.y, z2 = q.z + q.z;
+    double xx = q.x * x2, yy = q.y * y2, zz = q.z * z2;
+    double xy = q.x * y2, xz = q.x * z2, yz = q.y * z2;
+    double wx = q.w * x2, wy = q.w * y2, wz = q.w * z2;
+    mat4d_t R = {0};
+    R._11 = 1 - (yy + zz);
+    R._12 = xy - wz;
+    R._13 = xz + wy;
+    R._21 = xy + wz;
+    R._22 = 1 - (xx + zz);
+    R._23 = yz - wx;
+    R._31 = xz - wy;
+    R._32 = yz + wx;
+    R._33 = 1 - (xx + yy);
+    R._44 = 1;
+    return R;
+}
+
+LINALG_INLINE quatd_t quatd_from_mat3(mat3d_t R) {
+    double trace = R._11 + R._22 + R._33;
+    if (trace > 0) {
+        double s = 2 * sqrt(trace + 1);
+        return quatd((R._32 - R._23) / s, (R._13 - R._31) / s,
+                     (R._21 - R._12) / s, 0.25 * s);
+    }
+    if (R._11 > R._22 && R._11 > R._33) {
+        double s = 2 * sqrt(1 + R._11 - R._22 - R._33);
+        return quatd(0.25 * s, (R._12 + R._21) / s, (R._13 + R._31) / s,
+                     (R._32 - R._23) / s);
+    }
+    if (R._22 > R._33) {
+        double s = 2 * sqrt(1 + R._22 - R._11 - R._33);
+        return quatd((R._12 + R._21) / s, 0.25 * s, (R._23 + R._32) / s,
+                     (R._13 - R._31) / s);
+    }
+    double s = 2 * sqrt(1 + R._33 - R._11 - R._22);
+    return quatd((R._13 + R._31) / s, (R._23 + R._32) / s, 0.25 * s,
+                 (R._21 - R._12) / s);
+}
+
+LINALG_INLINE quatd_t quatd_from_mat4(mat4d_t R) {
+    double trace = R._11 + R._22 + R._33;
+    if (trace > 0) {
+        double s = 2 * sqrt(trace + 1);
+        return quatd((R._32 - R._23) / s, (R._13 - R._31) / s,
+                     (R._21 - R._12) / s, 0.25 * s);
+    }
+    if (R._11 > R._22 && R._11 > R._33) {
+        double s = 2 * sqrt(1 + R._11 - R._22 - R._33);
+        return quatd(0.25 * s, (R._12 + R._21) / s, (R._13 + R._31) / s,
+                     (R._32 - R._23) / s);
+    }
+    if (R._22 > R._33) {
+        double s = 2 * sqrt(1 + R._22 - R._11 - R._33);
+        return quatd((R._12 + R._21) / s, 0.25 * s, (R._23 + R._32) / s,
+                     (R._13 - R._31) / s);
+    }
+    double s = 2 * sqrt(1 + R._33 - R._11 - R._22);
+    return quatd((R._13 + R._31) / s, (R._23 + R._32) / s, 0.25 * s,
+                 (R._21 - R._12) / s);
+}
+
+LINALG_DEF void vec2f_soa_from_aos(vec2f_soa_t out, const vec2f_t *restrict in);
+LINALG_DEF void vec2f_soa_to_aos(vec2f_t *restrict out, vec2f_soa_t in);
+LINALG_DEF void vec2f_soa_add(vec2f_soa_t out, vec2f_soa_t a, vec2f_soa_t b);
+LINALG_DEF void vec2f_soa_sub(vec2f_soa_t out, vec2f_soa_t a, vec2f_soa_t b);
+LINALG_DEF void vec2f_soa_mul(vec2f_soa_t out, vec2f_soa_t a, vec2f_soa_t b);
+LINALG_DEF void vec2f_soa_div(vec2f_soa_t out, vec2f_soa_t a, vec2f_soa_t b);
+LINALG_DEF void vec2f_soa_mod(vec2f_soa_t out, vec2f_soa_t a, vec2f_soa_t b);
+LINALG_DEF void vec2f_soa_min(vec2f_soa_t out, vec2f_soa_t a, vec2f_soa_t b);
+LINALG_DEF void vec2f_soa_max(vec2f_soa_t out, vec2f_soa_t a, vec2f_soa_t b);
+LINALG_DEF void vec2f_soa_floor(vec2f_soa_t out, vec2f_soa_t v);
+LINALG_DEF void vec2f_soa_ceil(vec2f_soa_t out, vec2f_soa_t v);
+LINALG_DEF void vec2f_soa_clamp(vec2f_soa_t out, vec2f_soa_t v, vec2f_soa_t min,
+                                vec2f_soa_t max);
+LINALG_DEF void vec2f_soa_abs(vec2f_soa_t out, vec2f_soa_t v);
+LINALG_DEF void vec2f_soa_lerp(vec2f_soa_t out, vec2f_soa_t a, vec2f_soa_t b,
+                               vec2f_soa_t t);
+LINALG_DEF void vec2f_soa_dot(float *out, vec2f_soa_t a, vec2f_soa_t b);
+LINALG_DEF void vec2f_soa_2norm(float *out, vec2f_soa_t v);
+LINALG_DEF void vec2f_soa_unit(vec2f_soa_t out, vec2f_soa_t v);
+LINALG_DEF void mat2f_mul_vec_soa(vec2f_soa_t out, mat2f_t M, vec2f_soa_t v);
+LINALG_DEF void vec2d_soa_from_aos(vec2d_soa_t out, const vec2d_t *restrict in);
+LINALG_DEF void vec2d_soa_to_aos(vec2d_t *restrict out, vec2d_soa_t in);
+LINALG_DEF void vec2d_soa_add(vec2d_soa_t out, vec2d_soa_t a, vec2d_soa_t b);
+LINALG_DEF void vec2d_soa_sub(vec2d_soa_t out, vec2d_soa_t a, vec2d_soa_t b);
+LINALG_DEF void vec2d_soa_mul(vec2d_soa_t out, vec2d_soa_t a, vec2d_soa_t b);
+LINALG_DEF void vec2d_soa_div(vec2d_soa_t out, vec2d_soa_t a, vec2d_soa_t b);
+LINALG_DEF void vec2d_soa_mod(vec2d_soa_t out, vec2d_soa_t a, vec2d_soa_t b);
+LINALG_DEF void vec2d_soa_min(vec2d_soa_t out, vec2d_soa_t a, vec2d_soa_t b);
+LINALG_DEF void vec2d_soa_max(vec2d_soa_t out, vec2d_soa_t a, vec2d_soa_t b);
+LINALG_DEF void vec2d_soa_floor(vec2d_soa_t out, vec2d_soa_t v);
+LINALG_DEF void vec2d_soa_ceil(vec2d_soa_t out, vec2d_soa_t v);
+LINALG_DEF void vec2d_soa_clamp(vec2d_soa_t out, vec2d_soa_t v, vec2d_soa_t min,
+                                vec2d_soa_t max);
+LINALG_DEF void vec2d_soa_abs(vec2d_soa_t out, vec2d_soa_t v);
+LINALG_DEF void vec2d_soa_lerp(vec2d_soa_t out, vec2d_soa_t a, vec2d_soa_t b,
+                               vec2d_soa_t t);
+LINALG_DEF void vec2d_soa_dot(double *out, vec2d_soa_t a, vec2d_soa_t b);
+LINALG_DEF void vec2d_soa_2norm(double *out, vec2d_soa_t v);
+LINALG_DEF void vec2d_soa_unit(vec2d_soa_t out, vec2d_soa_t v);
+LINALG_DEF void mat2d_mul_vec_soa(vec2d_soa_t out, mat2d_t M, vec2d_soa_t v);
+LINALG_DEF void vec2i_soa_from_aos(vec2i_soa_t out, const vec2i_t *restrict in);
+LINALG_DEF void vec2i_soa_to_aos(vec2i_t *restrict out, vec2i_soa_t in);
+LINALG_DEF void vec2i_soa_add(vec2i_soa_t out, vec2i_soa_t a, vec2i_soa_t b);
+LINALG_DEF void vec2i_soa_sub(vec2i_soa_t out, vec2i_soa_t a, vec2i_soa_t b);
+LINALG_DEF void vec2i_soa_mul(vec2i_soa_t out, vec2i_soa_t a, vec2i_soa_t b);
+LINALG_DEF void vec2i_soa_div(vec2i_soa_t out, vec2i_soa_t a, vec2i_soa_t b);
+LINALG_DEF void vec2i_soa_mod(vec2i_soa_t out, vec2i_soa_t a, vec2i_soa_t b);
+LINALG_DEF void vec2i_soa_min(vec2i_soa_t out, vec2i_soa_t a, vec2i_soa_t b);
+LINALG_DEF void vec2i_soa_max(vec2i_soa_t out, vec2i_soa_t a, vec2i_soa_t b);
+LINALG_DEF void vec2i_soa_clamp(vec2i_soa_t out, vec2i_soa_t v, vec2i_soa_t min,
+                                vec2i_soa_t max);
+LINALG_DEF void vec2i_soa_abs(vec2i_soa_t out, vec2i_soa_t v);
+LINALG_DEF void vec2i_soa_dot(int *out, vec2i_soa_t a, vec2i_soa_t b);
+LINALG_DEF void mat2i_mul_vec_soa(vec2i_soa_t out, mat2i_t M, vec2i_soa_t v);
+LINALG_DEF void vec2u_soa_from_aos(vec2u_soa_t out, const vec2u_t *restrict in);
+LINALG_DEF void vec2u_soa_to_aos(vec2u_t *restrict out, vec2u_soa_t in);
+LINALG_DEF void vec2u_soa_add(vec2u_soa_t out, vec2u_soa_t a, vec2u_soa_t b);
+LINALG_DEF void vec2u_soa_sub(vec2u_soa_t out, vec2u_soa_t a, vec2u_soa_t b);
+LINALG_DEF void vec2u_soa_mul(vec2u_soa_t out, vec2u_soa_t a, vec2u_soa_t b);
+LINALG_DEF void vec2u_soa_div(vec2u_soa_t out, vec2u_soa_t a, vec2u_soa_t b);
+LINALG_DEF void vec2u_soa_mod(vec2u_soa_t out, vec2u_soa_t a, vec2u_soa_t b);
+LINALG_DEF void vec2u_soa_min(vec2u_soa_t out, vec2u_soa_t a, vec2u_soa_t b);
+LINALG_DEF void vec2u_soa_max(vec2u_soa_t out, vec2u_soa_t a, vec2u_soa_t b);
+LINALG_DEF void vec2u_soa_clamp(vec2u_soa_t out, vec2u_soa_t v, vec2u_soa_t min,
+                                vec2u_soa_t max);
+LINALG_DEF void vec2u_soa_dot(unsigned int *out, vec2u_soa_t a, vec2u_soa_t b);
+LINALG_DEF void mat2u_mul_vec_soa(vec2u_soa_t out, mat2u_t M, vec2u_soa_t v);
+LINALG_DEF void vec3f_soa_from_aos(vec3f_soa_t out, const vec3f_t *restrict in);
+LINALG_DEF void vec3f_soa_to_aos(vec3f_t *restrict out, vec3f_soa_t in);
+LINALG_DEF void vec3f_soa_add(vec3f_soa_t out, vec3f_soa_t a, vec3f_soa_t b);
+LINALG_DEF void vec3f_soa_sub(vec3f_soa_t out, vec3f_soa_t a, vec3f_soa_t b);
+LINALG_DEF void vec3f_soa_mul(vec3f_soa_t out, vec3f_soa_t a, vec3f_soa_t b);
+LINALG_DEF void vec3f_soa_div(vec3f_soa_t out, vec3f_soa_t a, vec3f_soa_t b);
+LINALG_DEF void vec3f_soa_mod(vec3f_soa_t out, vec3f_soa_t a, vec3f_soa_t b);
+LINALG_DEF void vec3f_soa_min(vec3f_soa_t out, vec3f_soa_t a, vec3f_soa_t b);
+LINALG_DEF void vec3f_soa_max(vec3f_soa_t out, vec3f_soa_t a, vec3f_soa_t b);
+LINALG_DEF void vec3f_soa_floor(vec3f_soa_t out, vec3f_soa_t v);
+LINALG_DEF void vec3f_soa_ceil(vec3f_soa_t out, vec3f_soa_t v);
+LINALG_DEF void vec3f_soa_clamp(vec3f_soa_t out, vec3f_soa_t v, vec3f_soa_t min,
+                                vec3f_soa_t max);
+LINALG_DEF void vec3f_soa_abs(vec3f_soa_t out, vec3f_soa_t v);
+LINALG_DEF void vec3f_soa_lerp(vec3f_soa_t out, vec3f_soa_t a, vec3f_soa_t b,
+                               vec3f_soa_t t);
+LINALG_DEF void vec3f_soa_dot(float *out, vec3f_soa_t a, vec3f_soa_t b);
+LINALG_DEF void vec3f_soa_2norm(float *out, vec3f_soa_t v);
+LINALG_DEF void vec3f_soa_unit(vec3f_soa_t out, vec3f_soa_t v);
+LINALG_DEF void mat3f_mul_vec_soa(vec3f_soa_t out, mat3f_t M, vec3f_soa_t v);
+LINALG_DEF void vec3d_soa_from_aos(vec3d_soa_t out, const vec3d_t *restrict in);
+LINALG_DEF void vec3d_soa_to_aos(vec3d_t *restrict out, vec3d_soa_t in);
+LINALG_DEF void vec3d_soa_add(vec3d_soa_t out, vec3d_soa_t a, vec3d_soa_t b);
+LINALG_DEF void vec3d_soa_sub(vec3d_soa_t out, vec3d_soa_t a, vec3d_soa_t b);
+LINALG_DEF void vec3d_soa_mul(vec3d_soa_t out, vec3d_soa_t a, vec3d_soa_t b);
+LINALG_DEF void vec3d_soa_div(vec3d_soa_t out, vec3d_soa_t a, vec3d_soa_t b);
+LINALG_DEF void vec3d_soa_mod(vec3d_soa_t out, vec3d_soa_t a, vec3d_soa_t b);
+LINALG_DEF void vec3d_soa_min(vec3d_soa_t out, vec3d_soa_t a, vec3d_soa_t b);
+LINALG_DEF void vec3d_soa_max(vec3d_soa_t out, vec3d_soa_t a, vec3d_soa_t b);
+LINALG_DEF void vec3d_soa_floor(vec3d_soa_t out, vec3d_soa_t v);
+LINALG_DEF void vec3d_soa_ceil(vec3d_soa_t out, vec3d_soa_t v);
+LINALG_DEF void vec3d_soa_clamp(vec3d_soa_t out, vec3d_soa_t v, vec3d_soa_t min,
+                                vec3d_soa_t max);
+LINALG_DEF void vec3d_soa_abs(vec3d_soa_t out, vec3d_soa_t v);
+LINALG_DEF void vec3d_soa_lerp(vec3d_soa_t out, vec3d_soa_t a, vec3d_soa_t b,
+                               vec3d_soa_t t);
+LINALG_DEF void vec3d_soa_dot(double *out, vec3d_soa_t a, vec3d_soa_t b);
+LINALG_DEF void vec3d_soa_2norm(double *out, vec3d_soa_t v);
+LINALG_DEF void vec3d_soa_unit(vec3d_soa_t out, vec3d_soa_t v);
+LINALG_DEF void mat3d_mul_vec_soa(vec3d_soa_t out, mat3d_t M, vec3d_soa_t v);
+LINALG_DEF void vec3i_soa_from_aos(vec3i_soa_t out, const vec3i_t *restrict in);
+LINALG_DEF void vec3i_soa_to_aos(vec3i_t *restrict out, vec3i_soa_t in);
+LINALG_DEF void vec3i_soa_add(vec3i_soa_t out, vec3i_soa_t a, vec3i_soa_t b);
+LINALG_DEF void vec3i_soa_sub(vec3i_soa_t out, vec3i_soa_t a, vec3i_soa_t b);
+LINALG_DEF void vec3i_soa_mul(vec3i_soa_t out, vec3i_soa_t a, vec3i_soa_t b);
+LINALG_DEF void vec3i_soa_div(vec3i_soa_t out, vec3i_soa_t a, vec3i_soa_t b);
+LINALG_DEF void vec3i_soa_mod(vec3i_soa_t out, vec3i_soa_t a, vec3i_soa_t b);
+LINALG_DEF void vec3i_soa_min(vec3i_soa_t out, vec3i_soa_t a, vec3i_soa_t b);
+LINALG_DEF void vec3i_soa_max(vec3i_soa_t out, vec3i_soa_t a, vec3i_soa_t b);
+LINALG_DEF void vec3i_soa_clamp(vec3i_soa_t out, vec3i_soa_t v, vec3i_soa_t min,
+                                vec3i_soa_t max);
+LINALG_DEF void vec3i_soa_abs(vec3i_soa_t out, vec3i_soa_t v);
+LINALG_DEF void vec3i_soa_dot(int *out, vec3i_soa_t a, vec3i_soa_t b);
+LINALG_DEF void mat3i_mul_vec_soa(vec3i_soa_t out, mat3i_t M, vec3i_soa_t v);
+LINALG_DEF void vec3u_soa_from_aos(vec3u_soa_t out, const vec3u_t *restrict in);
+LINALG_DEF void vec3u_soa_to_aos(vec3u_t *restrict out, vec3u_soa_t in);
+LINALG_DEF void vec3u_soa_add(vec3u_soa_t out, vec3u_soa_t a, vec3u_soa_t b);
+LINALG_DEF void vec3u_soa_sub(vec3u_soa_t out, vec3u_soa_t a, vec3u_soa_t b);
+LINALG_DEF void vec3u_soa_mul(vec3u_soa_t out, vec3u_soa_t a, vec3u_soa_t b);
+LINALG_DEF void vec3u_soa_div(vec3u_soa_t out, vec3u_soa_t a, vec3u_soa_t b);
+LINALG_DEF void vec3u_soa_mod(vec3u_soa_t out, vec3u_soa_t a, vec3u_soa_t b);
+LINALG_DEF void vec3u_soa_min(vec3u_soa_t out, vec3u_soa_t a, vec3u_soa_t b);
+LINALG_DEF void vec3u_soa_max(vec3u_soa_t out, vec3u_soa_t a, vec3u_soa_t b);
+LINALG_DEF void vec3u_soa_clamp(vec3u_soa_t out, vec3u_soa_t v, vec3u_soa_t min,
+                                vec3u_soa_t max);
+LINALG_DEF void vec3u_soa_dot(unsigned int *out, vec3u_soa_t a, vec3u_soa_t b);
+LINALG_DEF void mat3u_mul_vec_soa(vec3u_soa_t out, mat3u_t M, vec3u_soa_t v);
+LINALG_DEF void vec4f_soa_from_aos(vec4f_soa_t out, const vec4f_t *restrict in);
+LINALG_DEF void vec4f_soa_to_aos(vec4f_t *restrict out, vec4f_soa_t in);
+LINALG_DEF void vec4f_soa_add(vec4f_soa_t out, vec4f_soa_t a, vec4f_soa_t b);
+LINALG_DEF void vec4f_soa_sub(vec4f_soa_t out, vec4f_soa_t a, vec4f_soa_t b);
+LINALG_DEF void vec4f_soa_mul(vec4f_soa_t out, vec4f_soa_t a, vec4f_soa_t b);
+LINALG_DEF void vec4f_soa_div(vec4f_soa_t out, vec4f_soa_t a, vec4f_soa_t b);
+LINALG_DEF void vec4f_soa_mod(vec4f_soa_t out, vec4f_soa_t a, vec4f_soa_t b);
+LINALG_DEF void vec4f_soa_min(vec4f_soa_t out, vec4f_soa_t a, vec4f_soa_t b);
+LINALG_DEF void vec4f_soa_max(vec4f_soa_t out, vec4f_soa_t a, vec4f_soa_t b);
+LINALG_DEF void vec4f_soa_floor(vec4f_soa_t out, vec4f_soa_t v);
+LINALG_DEF void vec4f_soa_ceil(vec4f_soa_t out, vec4f_soa_t v);
+LINALG_DEF void vec4f_soa_clamp(vec4f_soa_t out, vec4f_soa_t v, vec4f_soa_t min,
+                                vec4f_soa_t max);
+LINALG_DEF void vec4f_soa_abs(vec4f_soa_t out, vec4f_soa_t v);
+LINALG_DEF void vec4f_soa_lerp(vec4f_soa_t out, vec4f_soa_t a, vec4f_soa_t b,
+                               vec4f_soa_t t);
+LINALG_DEF void vec4f_soa_dot(float *out, vec4f_soa_t a, vec4f_soa_t b);
+LINALG_DEF void vec4f_soa_2norm(float *out, vec4f_soa_t v);
+LINALG_DEF void vec4f_soa_unit(vec4f_soa_t out, vec4f_soa_t v);
+LINALG_DEF void mat4f_mul_vec_soa(vec4f_soa_t out, mat4f_t M, vec4f_soa_t v);
+LINALG_DEF void vec4d_soa_from_aos(vec4d_soa_t out, const vec4d_t *restrict in);
+LINALG_DEF void vec4d_soa_to_aos(vec4d_t *restrict out, vec4d_soa_t in);
+LINALG_DEF void vec4d_soa_add(vec4d_soa_t out, vec4d_soa_t a, vec4d_soa_t b);
+LINALG_DEF void vec4d_soa_sub(vec4d_soa_t out, vec4d_soa_t a, vec4d_soa_t b);
+LINALG_DEF void vec4d_soa_mul(vec4d_soa_t out, vec4d_soa_t a, vec4d_soa_t b);
+LINALG_DEF void vec4d_soa_div(vec4d_soa_t out, vec4d_soa_t a, vec4d_soa_t b);
+LINALG_DEF void vec4d_soa_mod(vec4d_soa_t out, vec4d_soa_t a, vec4d_soa_t b);
+LINALG_DEF void vec4d_soa_min(vec4d_soa_t out, vec4d_soa_t a, vec4d_soa_t b);
+LINALG_DEF void vec4d_soa_max(vec4d_soa_t out, vec4d_soa_t a, vec4d_soa_t b);
+LINALG_DEF void vec4d_soa_floor(vec4d_soa_t out, vec4d_soa_t v);
+LINALG_DEF void vec4d_soa_ceil(vec4d_soa_t out, vec4d_soa_t v);
+LINALG_DEF void vec4d_soa_clamp(vec4d_soa_t out, vec4d_soa_t v, vec4d_soa_t min,
+                                vec4d_soa_t max);
+LINALG_DEF void vec4d_soa_abs(vec4d_soa_t out, vec4d_soa_t v);
+LINALG_DEF void vec4d_soa_lerp(vec4d_soa_t out, vec4d_soa_t a, vec4d_soa_t b,
+                               vec4d_soa_t t);
+LINALG_DEF void vec4d_soa_dot(double *out, vec4d_soa_t a, vec4d_soa_t b);
+LINALG_DEF void vec4d_soa_2norm(double *out, vec4d_soa_t v);
+LINALG_DEF void vec4d_soa_unit(vec4d_soa_t out, vec4d_soa_t v);
+LINALG_DEF void mat4d_mul_vec_soa(vec4d_soa_t out, mat4d_t M, vec4d_soa_t v);
+LINALG_DEF void vec4i_soa_from_aos(vec4i_soa_t out, const vec4i_t *restrict in);
+LINALG_DEF void vec4i_soa_to_aos(vec4i_t *restrict out, vec4i_soa_t in);
+LINALG_DEF void vec4i_soa_add(vec4i_soa_t out, vec4i_soa_t a, vec4i_soa_t b);
+LINALG_DEF void vec4i_soa_sub(vec4i_soa_t out, vec4i_soa_t a, vec4i_soa_t b);
+LINALG_DEF void vec4i_soa_mul(vec4i_soa_t out, vec4i_soa_t a, vec4i_soa_t b);
+LINALG_DEF void vec4i_soa_div(vec4i_soa_t out, vec4i_soa_t a, vec4i_soa_t b);
+LINALG_DEF void vec4i_soa_mod(vec4i_soa_t out, vec4i_soa_t a, vec4i_soa_t b);
+LINALG_DEF void vec4i_soa_min(vec4i_soa_t out, vec4i_soa_t a, vec4i_soa_t b);
+LINALG_DEF void vec4i_soa_max(vec4i_soa_t out, vec4i_soa_t a, vec4i_soa_t b);
+LINALG_DEF void vec4i_soa_clamp(vec4i_soa_t out, vec4i_soa_t v, vec4i_soa_t min,
+                                vec4i_soa_t max);
+LINALG_DEF void vec4i_soa_abs(vec4i_soa_t out, vec4i_soa_t v);
+LINALG_DEF void vec4i_soa_dot(int *out, vec4i_soa_t a, vec4i_soa_t b);
+LINALG_DEF void mat4i_mul_vec_soa(vec4i_soa_t out, mat4i_t M, vec4i_soa_t v);
+LINALG_DEF void vec4u_soa_from_aos(vec4u_soa_t out, const vec4u_t *restrict in);
+LINALG_DEF void vec4u_soa_to_aos(vec4u_t *restrict out, vec4u_soa_t in);
+LINALG_DEF void vec4u_soa_add(vec4u_soa_t out, vec4u_soa_t a, vec4u_soa_t b);
+LINALG_DEF void vec4u_soa_sub(vec4u_soa_t out, vec4u_soa_t a, vec4u_soa_t b);
+LINALG_DEF void vec4u_soa_mul(vec4u_soa_t out, vec4u_soa_t a, vec4u_soa_t b);
+LINALG_DEF void vec4u_soa_div(vec4u_soa_t out, vec4u_soa_t a, vec4u_soa_t b);
+LINALG_DEF void vec4u_soa_mod(vec4u_soa_t out, vec4u_soa_t a, vec4u_soa_t b);
+LINALG_DEF void vec4u_soa_min(vec4u_soa_t out, vec4u_soa_t a, vec4u_soa_t b);
+LINALG_DEF void vec4u_soa_max(vec4u_soa_t out, vec4u_soa_t a, vec4u_soa_t b);
+LINALG_DEF void vec4u_soa_clamp(vec4u_soa_t out, vec4u_soa_t v, vec4u_soa_t min,
+                                vec4u_soa_t max);
+LINALG_DEF void vec4u_soa_dot(unsigned int *out, vec4u_soa_t a, vec4u_soa_t b);
+LINALG_DEF void mat4u_mul_vec_soa(vec4u_soa_t out, mat4u_t M, vec4u_soa_t v);
+
+LINALG_INLINE vec2f_t vec2h_to_vec2f(vec2h_t v) {
+    return vec2f(linalg_half_to_float(v.x), linalg_half_to_float(v.y));
+}
+
+LINALG_INLINE vec2h_t vec2h_from_vec2f(vec2f_t v) {
+    vec2h_t h;
+    h.x = linalg_float_to_half(v.x);
+    h.y = linalg_float_to_half(v.y);
+    return h;
+}
+
+LINALG_DEF void vec2h_to_vec2f_array(const vec2h_t *restrict in,
+                                     vec2f_t *restrict out, size_t n);
+LINALG_DEF void vec2h_from_vec2f_array(const vec2f_t *restrict in,
+                                       vec2h_t *restrict out, size_t n);
+LINALG_DEF void mat2f_transform_array_h(const mat2f_t *M,
+                                        const vec2h_t *restrict in,
+                                        vec2h_t *restrict out, size_t n);
+
+LINALG_INLINE vec3f_t vec3h_to_vec3f(vec3h_t v) {
+    return vec3f(linalg_half_to_float(v.x), linalg_half_to_float(v.y),
+                 linalg_half_to_float(v.z));
+}
+
+LINALG_INLINE vec3h_t vec3h_from_vec3f(vec3f_t v) {
+    vec3h_t h;
+    h.x = linalg_float_to_half(v.x);
+    h.y = linalg_float_to_half(v.y);
+    h.z = linalg_float_to_half(v.z);
+    return h;
+}
+
+LINALG_DEF void vec3h_to_vec3f_array(const vec3h_t *restrict in,
+                                     vec3f_t *restrict out, size_t n);
+LINALG_DEF void vec3h_from_vec3f_array(const vec3f_t *restrict in,
+                                       vec3h_t *restrict out, size_t n);
+LINALG_DEF void mat3f_transform_array_h(const mat3f_t *M,
+                                        const vec3h_t *restrict in,
+                                        vec3h_t *restrict out, size_t n);
+
+LINALG_INLINE vec4f_t vec4h_to_vec4f(vec4h_t v) {
+    return vec4f(linalg_half_to_float(v.x), linalg_half_to_float(v.y),
+                 linalg_half_to_float(v.z), linalg_half_to_float(v.w));
+}
+
+LINALG_INLINE vec4h_t vec4h_from_vec4f(vec4f_t v) {
+    vec4h_t h;
+    h.x = linalg_float_to_half(v.x);
+    h.y = linalg_float_to_half(v.y);
+    h.z = linalg_float_to_half(v.z);
+    h.w = linalg_float_to_half(v.w);
+    return h;
+}
+
+LINALG_DEF void vec4h_to_vec4f_array(const vec4h_t *restrict in,
+                                     vec4f_t *restrict out, size_t n);
+LINALG_DEF void vec4h_from_vec4f_array(const vec4f_t *restrict in,
+                                       vec4h_t *restrict out, size_t n);
+LINALG_DEF void mat4f_transform_array_h(const mat4f_t *M,
+                                        const vec4h_t *restrict in,
+                                        vec4h_t *restrict out, size_t n);
+
+#ifdef LINALG_IMPLEMENTATION
+
+LINALG_DEF vec2f_t vec2f_sum(size_t n, ...) {
+    va_list args;
+    va_start(args, n);
+    vec2f_t sum = {0};
+    for (size_t i = 0; i < n; ++i) {
+        vec2f_t v = va_arg(args, vec2f_t);
+        sum = vec2f_add(sum, v);
+    }
+    va_end(args);
+    return sum;
+}
+
+LINALG_DEF vec2f_t vec2f_sum_array(const vec2f_t *xs, size_t n) {
+    if (n <= LINALG_PAIRWISE_BLOCK) {
+        vec2f_t sum = {0};
+        for (size_t i = 0; i < n; ++i) {
+            vec2f_add_assign(&sum, xs[i]);
+        }
+        return sum;
+    }
+    size_t half = n / 2;
+    vec2f_t lhs = vec2f_sum_array(xs, half);
+    vec2f_t rhs = vec2f_sum_array(xs + half, n - half);
+    vec2f_add_assign(&lhs, rhs);
+    return lhs;
+}
+
+LINALG_DEF vec2f_t vec2f_product(size_t n, ...) {
+    va_list args;
+    va_start(args, n);
+    vec2f_t product = vec2f_splat(1);
+    for (size_t i = 0; i < n; ++i) {
+        vec2f_t v = va_arg(args, vec2f_t);
+        product = vec2f_mul(product, v);
+    }
+    va_end(args);
+    return product;
+}
+
+LINALG_DEF vec2f_t vec2f_product_array(const vec2f_t *xs, size_t n) {
+    if (n <= LINALG_PAIRWISE_BLOCK) {
+        vec2f_t product = vec2f_splat(1);
+        for (size_t i = 0; i < n; ++i) {
+            vec2f_mul_assign(&product, xs[i]);
+        }
+        return product;
+    }
+    size_t half = n / 2;
+    vec2f_t lhs = vec2f_product_array(xs, half);
+    vec2f_t rhs = vec2f_product_array(xs + half, n - half);
+    vec2f_mul_assign(&lhs, rhs);
+    return lhs;
+}
+
+LINALG_DEF mat2f_t mat2f_nmul(size_t n, ...) {
+    va_list args;
+    va_start(args, n);
+    mat2f_t product = mat2f_I();
+    for (size_t i = 0; i < n; ++i) {
+        mat2f_t A = va_arg(args, mat2f_t);
+        product = mat2f_mul(product, A);
+    }
+    va_end(args);
+    return product;
+}
+
+LINALG_DEF mat2f_t mat2f_mul_chain(const mat2f_t *Ms, size_t n) {
+    if (n == 0) {
+        return mat2f_I();
+    }
+    if (n == 1) {
+        return Ms[0];
+    }
+    size_t half = n / 2;
+    mat2f_t lhs = mat2f_mul_chain(Ms, half);
+    mat2f_t rhs = mat2f_mul_chain(Ms + half, n - half);
+    mat2f_t product;
+    mat2f_mul_to(&product, &lhs, &rhs);
+    return product;
+}
+
+LINALG_DEF void mat2f_transform_array(const mat2f_t *M,
+                                      const vec2f_t *restrict in,
+                                      vec2f_t *restrict out, size_t n) {
+    size_t i = 0;
+    const float m11 = M->_11;
+    const float m12 = M->_12;
+    const float m21 = M->_21;
+    const float m22 = M->_22;
+    for (; i + 4 <= n; i += 4) {
+        const float v0_0 = in[i].e[0];
+        const float v0_1 = in[i].e[1];
+        out[i].e[0] = m11 * v0_0 + m12 * v0_1;
+        out[i].e[1] = m21 * v0_0 + m22 * v0_1;
+        const float v1_0 = in[i + 1].e[0];
+        const float v1_1 = in[i + 1].e[1];
+        out[i + 1].e[0] = m11 * v1_0 + m12 * v1_1;
+        out[i + 1].e[1] = m21 * v1_0 + m22 * v1_1;
+        const float v2_0 = in[i + 2].e[0];
+        const float v2_1 = in[i + 2].e[1];
+        out[i + 2].e[0] = m11 * v2_0 + m12 * v2_1;
+        out[i + 2].e[1] = m21 * v2_0 + m22 * v2_1;
+        const float v3_0 = in[i + 3].e[0];
+        const float v3_1 = in[i + 3].e[1];
+        out[i + 3].e[0] = m11 * v3_0 + m12 * v3_1;
+        out[i + 3].e[1] = m21 * v3_0 + m22 * v3_1;
+    }
+    for (; i < n; ++i) {
+        const float v0_0 = in[i].e[0];
+        const float v0_1 = in[i].e[1];
+        out[i].e[0] = m11 * v0_0 + m12 * v0_1;
+        out[i].e[1] = m21 * v0_0 + m22 * v0_1;
+    }
+}
+
+LINALG_DEF void mat2f_inverse_array(const mat2f_t *restrict in,
+                                    mat2f_t *restrict out, size_t n) {
+    for (size_t i = 0; i < n; ++i) {
+        out[i] = mat2f_inverse(in[i]);
+    }
+}
+
+LINALG_DEF vec2d_t vec2d_sum(size_t n, ...) {
+    va_list args;
+    va_start(args, n);
+    vec2d_t sum = {0};
+    for (size_t i = 0; i < n; ++i) {
+        vec2d_t v = va_arg(args, vec2d_t);
+        sum = vec2d_add(sum, v);
+    }
+    va_end(args);
+    return sum;
+}
+
+LINALG_DEF vec2d_t vec2d_sum_array(const vec2d_t *xs, size_t n) {
+    if (n <= LINALG_PAIRWISE_BLOCK) {
+        vec2d_t sum = {0};
+        for (size_t i = 0; i < n; ++i) {
+            vec2d_add_assign(&sum, xs[i]);
+        }
+        return sum;
+    }
+    size_t half = n / 2;
+    vec2d_t lhs = vec2d_sum_array(xs, half);
+    vec2d_t rhs = vec2d_sum_array(xs + half, n - half);
+    vec2d_add_assign(&lhs, rhs);
+    return lhs;
+}
+
+LINALG_DEF vec2d_t vec2d_product(size_t n, ...) {
+    va_list args;
+    va_start(args, n);
+    vec2d_t product = vec2d_splat(1);
+    for (size_t i = 0; i < n; ++i) {
+        vec2d_t v = va_arg(args, vec2d_t);
+        product = vec2d_mul(product, v);
+    }
+    va_end(args);
+    return product;
+}
+
+LINALG_DEF vec2d_t vec2d_product_array(const vec2d_t *xs, size_t n) {
+    if (n <= LINALG_PAIRWISE_BLOCK) {
+        vec2d_t product = vec2d_splat(1);
+        for (size_t i = 0; i < n; ++i) {
+            vec2d_mul_assign(&product, xs[i]);
+        }
+        return product;
+    }
+    size_t half = n / 2;
+    vec2d_t lhs = vec2d_product_array(xs, half);
+    vec2d_t rhs = vec2d_product_array(xs + half, n - half);
+    vec2d_mul_assign(&lhs, rhs);
+    return lhs;
+}
+
+LINALG_DEF mat2d_t mat2d_nmul(size_t n, ...) {
+    va_list args;
+    va_start(args, n);
+    mat2d_t product = mat2d_I();
+    for (size_t i = 0; i < n; ++i) {
+        mat2d_t A = va_arg(args, mat2d_t);
+        product = mat2d_mul(product, A);
+    }
+    va_end(args);
+    return product;
+}
+
+LINALG_DEF mat2d_t mat2d_mul_chain(const mat2d_t *Ms, size_t n) {
+    if (n == 0) {
+        return mat2d_I();
+    }
+    if (n == 1) {
+        return Ms[0];
+    }
+    size_t half = n / 2;
+    mat2d_t lhs = mat2d_mul_chain(Ms, half);
+    mat2d_t rhs = mat2d_mul_chain(Ms + half, n - half);
+    mat2d_t product;
+    mat2d_mul_to(&product, &lhs, &rhs);
+    return product;
+}
+
+LINALG_DEF void mat2d_transform_array(const mat2d_t *M,
+                                      const vec2d_t *restrict in,
+                                      vec2d_t *restrict out, size_t n) {
+    size_t i = 0;
+    const double m11 = M->_11;
+    const double m12 = M->_12;
+    const double m21 = M->_21;
+    const double m22 = M->_22;
+    for (; i + 4 <= n; i += 4) {
+        const double v0_0 = in[i].e[0];
+        const double v0_1 = in[i].e[1];
+        out[i].e[0] = m11 * v0_0 + m12 * v0_1;
+        out[i].e[1] = m21 * v0_0 + m22 * v0_1;
+        const double v1_0 = in[i + 1].e[0];
+        const double v1_1 = in[i + 1].e[1];
+        out[i + 1].e[0] = m11 * v1_0 + m12 * v1_1;
+        out[i + 1].e[1] = m21 * v1_0 + m22 * v1_1;
+        const double v2_0 = in[i + 2].e[0];
+        const double v2_1 = in[i + 2].e[1];
+        out[i + 2].e[0] = m11 * v2_0 + m12 * v2_1;
+        out[i + 2].e[1] = m21 * v2_0 + m22 * v2_1;
+        const double v3_0 = in[i + 3].e[0];
+        const double v3_1 = in[i + 3].e[1];
+        out[i + 3].e[0] = m11 * v3_0 + m12 * v3_1;
+        out[i + 3].e[1] = m21 * v3_0 + m22 * v3_1;
+    }
+    for (; i < n; ++i) {
+        const double v0_0 = in[i].e[0];
+        const double v0_1 = in[i].e[1];
+        out[i].e[0] = m11 * v0_0 + m12 * v0_1;
+        out[i].e[1] = m21 * v0_0 + m22 * v0_1;
+    }
+}
+
+LINALG_DEF void mat2d_inverse_array(const mat2d_t *restrict in,
+                                    mat2d_t *restrict out, size_t n) {
+    for (size_t i = 0; i < n; ++i) {
+        out[i] = mat2d_inverse(in[i]);
+    }
+}
+
+LINALG_DEF vec2i_t vec2i_sum(size_t n, ...) {
+    va_list args;
+    va_start(args, n);
+    vec2i_t sum = {0};
+    for (size_t i = 0; i < n; ++i) {
+        vec2i_t v = va_arg(args, vec2i_t);
+        sum = vec2i_add(sum, v);
+    }
+    va_end(args);
+    return sum;
+}
+
+LINALG_DEF vec2i_t vec2i_sum_array(const vec2i_t *xs, size_t n) {
+    if (n <= LINALG_PAIRWISE_BLOCK) {
+        vec2i_t sum = {0};
+        for (size_t i = 0; i < n; ++i) {
+            vec2i_add_assign(&sum, xs[i]);
+        }
+        return sum;
+    }
+    size_t half = n / 2;
+    vec2i_t lhs = vec2i_sum_array(xs, half);
+    vec2i_t rhs = vec2i_sum_array(xs + half, n - half);
+    vec2i_add_assign(&lhs, rhs);
+    return lhs;
+}
+
+LINALG_DEF vec2i_t vec2i_product(size_t n, ...) {
+    va_list args;
+    va_start(args, n);
+    vec2i_t product = vec2i_splat(1);
+    for (size_t i = 0; i < n; ++i) {
+        vec2i_t v = va_arg(args, vec2i_t);
+        product = vec2i_mul(product, v);
+    }
+    va_end(args);
+    return product;
+}
+
+LINALG_DEF vec2i_t vec2i_product_array(const vec2i_t *xs, size_t n) {
+    if (n <= LINALG_PAIRWISE_BLOCK) {
+        vec2i_t product = vec2i_splat(1);
+        for (size_t i = 0; i < n; ++i) {
+            vec2i_mul_assign(&product, xs[i]);
+        }
+        return product;
+    }
+    size_t half = n / 2;
+    vec2i_t lhs = vec2i_product_array(xs, half);
+    vec2i_t rhs = vec2i_product_array(xs + half, n - half);
+    vec2i_mul_assign(&lhs, rhs);
+    return lhs;
+}
+
+LINALG_DEF mat2i_t mat2i_nmul(size_t n, ...) {
+    va_list args;
+    va_start(args, n);
+    mat2i_t product = mat2i_I();
+    for (size_t i = 0; i < n; ++i) {
+        mat2i_t A = va_arg(args, mat2i_t);
+        product = mat2i_mul(product, A);
+    }
+    va_end(args);
+    return product;
+}
+
+LINALG_DEF mat2i_t mat2i_mul_chain(const mat2i_t *Ms, size_t n) {
+    if (n == 0) {
+        return mat2i_I();
+    }
+    if (n == 1) {
+        return Ms[0];
+    }
+    size_t half = n / 2;
+    mat2i_t lhs = mat2i_mul_chain(Ms, half);
+    mat2i_t rhs = mat2i_mul_chain(Ms + half, n - half);
+    mat2i_t product;
+    mat2i_mul_to(&product, &lhs, &rhs);
+    return product;
+}
+
+LINALG_DEF void mat2i_transform_array(const mat2i_t *M,
+                                      const vec2i_t *restrict in,
+                                      vec2i_t *restrict out, size_t n) {
+    size_t i = 0;
+    const int m11 = M->_11;
+    const int m12 = M->_12;
+    const int m21 = M->_21;
+    const int m22 = M->_22;
+    for (; i + 4 <= n; i += 4) {
+        const int v0_0 = in[i].e[0];
+        const int v0_1 = in[i].e[1];
+        out[i].e[0] = m11 * v0_0 + m12 * v0_1;
+        out[i].e[1] = m21 * v0_0 + m22 * v0_1;
+        const int v1_0 = in[i + 1].e[0];
+        const int v1_1 = in[i + 1].e[1];
+        out[i + 1].e[0] = m11 * v1_0 + m12 * v1_1;
+        out[i + 1].e[1] = m21 * v1_0 + m22 * v1_1;
+        const int v2_0 = in[i + 2].e[0];
+        const int v2_1 = in[i + 2].e[1];
+        out[i + 2].e[0] = m11 * v2_0 + m12 * v2_1;
+        out[i + 2].e[1] = m21 * v2_0 + m22 * v2_1;
+        const int v3_0 = in[i + 3].e[0];
+        const int v3_1 = in[i + 3].e[1];
+        out[i + 3].e[0] = m11 * v3_0 + m12 * v3_1;
+        out[i + 3].e[1] = m21 * v3_0 + m22 * v3_1;
+    }
+    for (; i < n; ++i) {
+        const int v0_0 = in[i].e[0];
+        const int v0_1 = in[i].e[1];
+        out[i].e[0] = m11 * v0_0 + m12 * v0_1;
+        out[i].e[1] = m21 * v0_0 + m22 * v0_1;
+    }
+}
+
+LINALG_DEF vec2u_t vec2u_sum(size_t n, ...) {
+    va_list args;
+    va_start(args, n);
+    vec2u_t sum = {0};
+    for (size_t i = 0; i < n; ++i) {
+        vec2u_t v = va_arg(args, vec2u_t);
+        sum = vec2u_add(sum, v);
+    }
+    va_end(args);
+    return sum;
+}
+
+LINALG_DEF vec2u_t vec2u_sum_array(const vec2u_t *xs, size_t n) {
+    if (n <= LINALG_PAIRWISE_BLOCK) {
+        vec2u_t sum = {0};
+        for (size_t i = 0; i < n; ++i) {
+            vec2u_add_assign(&sum, xs[i]);
+        }
+        return sum;
+    }
+    size_t half = n / 2;
+    vec2u_t lhs = vec2u_sum_array(xs, half);
+    vec2u_t rhs = vec2u_sum_array(xs + half, n - half);
+    vec2u_add_assign(&lhs, rhs);
+    return lhs;
+}
+
+LINALG_DEF vec2u_t vec2u_product(size_t n, ...) {
+    va_list args;
+    va_start(args, n);
+    vec2u_t product = vec2u_splat(1);
+    for (size_t i = 0; i < n; ++i) {
+        vec2u_t v = va_arg(args, vec2u_t);
+        product = vec2u_mul(product, v);
+    }
+    va_end(args);
+    return product;
+}
+
+LINALG_DEF vec2u_t vec2u_product_array(const vec2u_t *xs, size_t n) {
+    if (n <= LINALG_PAIRWISE_BLOCK) {
+        vec2u_t product = vec2u_splat(1);
+        for (size_t i = 0; i < n; ++i) {
+            vec2u_mul_assign(&product, xs[i]);
+        }
+        return product;
+    }
+    size_t half = n / 2;
+    vec2u_t lhs = vec2u_product_array(xs, half);
+    vec2u_t rhs = vec2u_product_array(xs + half, n - half);
+    vec2u_mul_assign(&lhs, rhs);
+    return lhs;
+}
+
+LINALG_DEF mat2u_t mat2u_nmul(size_t n, ...) {
+    va_list args;
+    va_start(args, n);
+    mat2u_t product = mat2u_I();
+    for (size_t i = 0; i < n; ++i) {
+        mat2u_t A = va_arg(args, mat2u_t);
+        product = mat2u_mul(product, A);
+    }
+    va_end(args);
+    return product;
+}
+
+LINALG_DEF mat2u_t mat2u_mul_chain(const mat2u_t *Ms, size_t n) {
+    if (n == 0) {
+        return mat2u_I();
+    }
+    if (n == 1) {
+        return Ms[0];
+    }
+    size_t half = n / 2;
+    mat2u_t lhs = mat2u_mul_chain(Ms, half);
+    mat2u_t rhs = mat2u_mul_chain(Ms + half, n - half);
+    mat2u_t product;
+    mat2u_mul_to(&product, &lhs, &rhs);
+    return product;
+}
+
+LINALG_DEF void mat2u_transform_array(const mat2u_t *M,
+                                      const vec2u_t *restrict in,
+                                      vec2u_t *restrict out, size_t n) {
+    size_t i = 0;
+    const unsigned int m11 = M->_11;
+    const unsigned int m12 = M->_12;
+    const unsigned int m21 = M->_21;
+    const unsigned int m22 = M->_22;
+    for (; i + 4 <= n; i += 4) {
+        const unsigned int v0_0 = in[i].e[0];
+        const unsigned int v0_1 = in[i].e[1];
+        out[i].e[0] = m11 * v0_0 + m12 * v0_1;
+        out[i].e[1] = m21 * v0_0 + m22 * v0_1;
+        const unsigned int v1_0 = in[i + 1].e[0];
+        const unsigned int v1_1 = in[i + 1].e[1];
+        out[i + 1].e[0] = m11 * v1_0 + m12 * v1_1;
+        out[i + 1].e[1] = m21 * v1_0 + m22 * v1_1;
+        const unsigned int v2_0 = in[i + 2].e[0];
+        const unsigned int v2_1 = in[i + 2].e[1];
+        out[i + 2].e[0] = m11 * v2_0 + m12 * v2_1;
+        out[i + 2].e[1] = m21 * v2_0 + m22 * v2_1;
+        const unsigned int v3_0 = in[i + 3].e[0];
+        const unsigned int v3_1 = in[i + 3].e[1];
+        out[i + 3].e[0] = m11 * v3_0 + m12 * v3_1;
+        out[i + 3].e[1] = m21 * v3_0 + m22 * v3_1;
+    }
+    for (; i < n; ++i) {
+        const unsigned int v0_0 = in[i].e[0];
+        const unsigned int v0_1 = in[i].e[1];
+        out[i].e[0] = m11 * v0_0 + m12 * v0_1;
+        out[i].e[1] = m21 * v0_0 + m22 * v0_1;
+    }
+}
+
+LINALG_DEF vec3f_t vec3f_sum(size_t n, ...) {
+    va_list args;
+    va_start(args, n);
+    vec3f_t sum = {0};
+    for (size_t i = 0; i < n; ++i) {
+        vec3f_t v = va_arg(args, vec3f_t);
+        sum = vec3f_add(sum, v);
+    }
+    va_end(args);
+    return sum;
+}
+
+LINALG_DEF vec3f_t vec3f_sum_array(const vec3f_t *xs, size_t n) {
+    if (n <= LINALG_PAIRWISE_BLOCK) {
+        vec3f_t sum = {0};
+        for (size_t i = 0; i < n; ++i) {
+            vec3f_add_assign(&sum, xs[i]);
+        }
+        return sum;
+    }
+    size_t half = n / 2;
+    vec3f_t lhs = vec3f_sum_array(xs, half);
+    vec3f_t rhs = vec3f_sum_array(xs + half, n - half);
+    vec3f_add_assign(&lhs, rhs);
+    return lhs;
+}
+
+LINALG_DEF vec3f_t vec3f_product(size_t n, ...) {
+    va_list args;
+    va_start(args, n);
+    vec3f_t product = vec3f_splat(1);
+    for (size_t i = 0; i < n; ++i) {
+        vec3f_t v = va_arg(args, vec3f_t);
+        product = vec3f_mul(product, v);
+    }
+    va_end(args);
+    return product;
+}
+
+LINALG_DEF vec3f_t vec3f_product_array(const vec3f_t *xs, size_t n) {
+    if (n <= LINALG_PAIRWISE_BLOCK) {
+        vec3f_t product = vec3f_splat(1);
+        for (size_t i = 0; i < n; ++i) {
+            vec3f_mul_assign(&product, xs[i]);
+        }
+        return product;
+    }
+    size_t half = n / 2;
+    vec3f_t lhs = vec3f_product_array(xs, half);
+    vec3f_t rhs = vec3f_product_array(xs + half, n - half);
+    vec3f_mul_assign(&lhs, rhs);
+    return lhs;
+}
+
+LINALG_DEF mat3f_t mat3f_nmul(size_t n, ...) {
+    va_list args;
+    va_start(args, n);
+    mat3f_t product = mat3f_I();
+    for (size_t i = 0; i < n; ++i) {
+        mat3f_t A = va_arg(args, mat3f_t);
+        product = mat3f_mul(product, A);
+    }
+    va_end(args);
+    return product;
+}
+
+LINALG_DEF mat3f_t mat3f_mul_chain(const mat3f_t *Ms, size_t n) {
+    if (n == 0) {
+        return mat3f_I();
+    }
+    if (n == 1) {
+        return Ms[0];
+    }
+    size_t half = n / 2;
+    mat3f_t lhs = mat3f_mul_chain(Ms, half);
+    mat3f_t rhs = mat3f_mul_chain(Ms + half, n - half);
+    mat3f_t product;
+    mat3f_mul_to(&product, &lhs, &rhs);
+    return product;
+}
+
+LINALG_DEF void mat3f_transform_array(const mat3f_t *M,
+                                      const vec3f_t *restrict in,
+                                      vec3f_t *restrict out, size_t n) {
+    size_t i = 0;
+    const float m11 = M->_11;
+    const float m12 = M->_12;
+    const float m13 = M->_13;
+    const float m21 = M->_21;
+    const float m22 = M->_22;
+    const float m23 = M->_23;
+    const float m31 = M->_31;
+    const float m32 = M->_32;
+    const float m33 = M->_33;
+    for (; i + 4 <= n; i += 4) {
+        const float v0_0 = in[i].e[0];
+        const float v0_1 = in[i].e[1];
+        const float v0_2 = in[i].e[2];
+        out[i].e[0] = m11 * v0_0 + m12 * v0_1 + m13 * v0_2;
+        out[i].e[1] = m21 * v0_0 + m22 * v0_1 + m23 * v0_2;
+        out[i].e[2] = m31 * v0_0 + m32 * v0_1 + m33 * v0_2;
+        const float v1_0 = in[i + 1].e[0];
+        const float v1_1 = in[i + 1].e[1];
+        const float v1_2 = in[i + 1].e[2];
+        out[i + 1].e[0] = m11 * v1_0 + m12 * v1_1 + m13 * v1_2;
+        out[i + 1].e[1] = m21 * v1_0 + m22 * v1_1 + m23 * v1_2;
+        out[i + 1].e[2] = m31 * v1_0 + m32 * v1_1 + m33 * v1_2;
+        const float v2_0 = in[i + 2].e[0];
+        const float v2_1 = in[i + 2].e[1];
+        const float v2_2 = in[i + 2].e[2];
+        out[i + 2].e[0] = m11 * v2_0 + m12 * v2_1 + m13 * v2_2;
+        out[i + 2].e[1] = m21 * v2_0 + m22 * v2_1 + m23 * v2_2;
+        out[i + 2].e[2] = m31 * v2_0 + m32 * v2_1 + m33 * v2_2;
+        const float v3_0 = in[i + 3].e[0];
+        const float v3_1 = in[i + 3].e[1];
+        const float v3_2 = in[i + 3].e[2];
+        out[i + 3].e[0] = m11 * v3_0 + m12 * v3_1 + m13 * v3_2;
+        out[i + 3].e[1] = m21 * v3_0 + m22 * v3_1 + m23 * v3_2;
+        out[i + 3].e[2] = m31 * v3_0 + m32 * v3_1 + m33 * v3_2;
+    }
+    for (; i < n; ++i) {
+        const float v0_0 = in[i].e[0];
+        const float v0_1 = in[i].e[1];
+        const float v0_2 = in[i].e[2];
+        out[i].e[0] = m11 * v0_0 + m12 * v0_1 + m13 * v0_2;
+        out[i].e[1] = m21 * v0_0 + m22 * v0_1 + m23 * v0_2;
+        out[i].e[2] = m31 * v0_0 + m32 * v0_1 + m33 * v0_2;
+    }
+}
+
+LINALG_DEF void mat3f_inverse_array(const mat3f_t *restrict in,
+                                    mat3f_t *restrict out, size_t n) {
+    for (size_t i = 0; i < n; ++i) {
+        out[i] = mat3f_inverse(in[i]);
+    }
+}
+
+LINALG_DEF vec3d_t vec3d_sum(size_t n, ...) {
+    va_list args;
+    va_start(args, n);
+    vec3d_t sum = {0};
+    for (size_t i = 0; i < n; ++i) {
+        vec3d_t v = va_arg(args, vec3d_t);
+        sum = vec3d_add(sum, v);
+    }
+    va_end(args);
+    return sum;
+}
+
+LINALG_DEF vec3d_t vec3d_sum_array(const vec3d_t *xs, size_t n) {
+    if (n <= LINALG_PAIRWISE_BLOCK) {
+        vec3d_t sum = {0};
+        for (size_t i = 0; i < n; ++i) {
+            vec3d_add_assign(&sum, xs[i]);
+        }
+        return sum;
+    }
+    size_t half = n / 2;
+    vec3d_t lhs = vec3d_sum_array(xs, half);
+    vec3d_t rhs = vec3d_sum_array(xs + half, n - half);
+    vec3d_add_assign(&lhs, rhs);
+    return lhs;
+}
+
+LINALG_DEF vec3d_t vec3d_product(size_t n, ...) {
+    va_list args;
+    va_start(args, n);
+    vec3d_t product = vec3d_splat(1);
+    for (size_t i = 0; i < n; ++i) {
+        vec3d_t v = va_arg(args, vec3d_t);
+        product = vec3d_mul(product, v);
+    }
+    va_end(args);
+    return product;
+}
+
+LINALG_DEF vec3d_t vec3d_product_array(const vec3d_t *xs, size_t n) {
+    if (n <= LINALG_PAIRWISE_BLOCK) {
+        vec3d_t product = vec3d_splat(1);
+        for (size_t i = 0; i < n; ++i) {
+            vec3d_mul_assign(&product, xs[i]);
+        }
+        return product;
+    }
+    size_t half = n / 2;
+    vec3d_t lhs = vec3d_product_array(xs, half);
+    vec3d_t rhs = vec3d_product_array(xs + half, n - half);
+    vec3d_mul_assign(&lhs, rhs);
+    return lhs;
+}
+
+LINALG_DEF mat3d_t mat3d_nmul(size_t n, ...) {
+    va_list args;
+    va_start(args, n);
+    mat3d_t product = mat3d_I();
+    for (size_t i = 0; i < n; ++i) {
+        mat3d_t A = va_arg(args, mat3d_t);
+        product = mat3d_mul(product, A);
+    }
+    va_end(args);
+    return product;
+}
+
+LINALG_DEF mat3d_t mat3d_mul_chain(const mat3d_t *Ms, size_t n) {
+    if (n == 0) {
+        return mat3d_I();
+    }
+    if (n == 1) {
+        return Ms[0];
+    }
+    size_t half = n / 2;
+    mat3d_t lhs = mat3d_mul_chain(Ms, half);
+    mat3d_t rhs = mat3d_mul_chain(Ms + half, n - half);
+    mat3d_t product;
+    mat3d_mul_to(&product, &lhs, &rhs);
+    return product;
+}
+
+LINALG_DEF void mat3d_transform_array(const mat3d_t *M,
+                                      const vec3d_t *restrict in,
+                                      vec3d_t *restrict out, size_t n) {
+    size_t i = 0;
+    const double m11 = M->_11;
+    const double m12 = M->_12;
+    const double m13 = M->_13;
+    const double m21 = M->_21;
+    const double m22 = M->_22;
+    const double m23 = M->_23;
+    const double m31 = M->_31;
+    const double m32 = M->_32;
+    const double m33 = M->_33;
+    for (; i + 4 <= n; i += 4) {
+        const double v0_0 = in[i].e[0];
+        const double v0_1 = in[i].e[1];
+        const double v0_2 = in[i].e[2];
+        out[i].e[0] = m11 * v0_0 + m12 * v0_1 + m13 * v0_2;
+        out[i].e[1] = m21 * v0_0 + m22 * v0_1 + m23 * v0_2;
+        out[i].e[2] = m31 * v0_0 + m32 * v0_1 + m33 * v0_2;
+        const double v1_0 = in[i + 1].e[0];
+        const double v1_1 = in[i + 1].e[1];
+        const double v1_2 = in[i + 1].e[2];
+        out[i + 1].e[0] = m11 * v1_0 + m12 * v1_1 + m13 * v1_2;
+        out[i + 1].e[1] = m21 * v1_0 + m22 * v1_1 + m23 * v1_2;
+        out[i + 1].e[2] = m31 * v1_0 + m32 * v1_1 + m33 * v1_2;
+        const double v2_0 = in[i + 2].e[0];
+        const double v2_1 = in[i + 2].e[1];
+        const double v2_2 = in[i + 2].e[2];
+        out[i + 2].e[0] = m11 * v2_0 + m12 * v2_1 + m13 * v2_2;
+        out[i + 2].e[1] = m21 * v2_0 + m22 * v2_1 + m23 * v2_2;
+        out[i + 2].e[2] = m31 * v2_0 + m32 * v2_1 + m33 * v2_2;
+        const double v3_0 = in[i + 3].e[0];
+        const double v3_1 = in[i + 3].e[1];
+        const double v3_2 = in[i + 3].e[2];
+        out[i + 3].e[0] = m11 * v3_0 + m12 * v3_1 + m13 * v3_2;
+        out[i + 3].e[1] = m21 * v3_0 + m22 * v3_1 + m23 * v3_2;
+        out[i + 3].e[2] = m31 * v3_0 + m32 * v3_1 + m33 * v3_2;
+    }
+    for (; i < n; ++i) {
+        const double v0_0 = in[i].e[0];
+        const double v0_1 = in[i].e[1];
+        const double v0_2 = in[i].e[2];
+        out[i].e[0] = m11 * v0_0 + m12 * v0_1 + m13 * v0_2;
+        out[i].e[1] = m21 * v0_0 + m22 * v0_1 + m23 * v0_2;
+        out[i].e[2] = m31 * v0_0 + m32 * v0_1 + m33 * v0_2;
+    }
+}
+
+LINALG_DEF void mat3d_inverse_array(const mat3d_t *restrict in,
+                                    mat3d_t *restrict out, size_t n) {
+    for (size_t i = 0; i < n; ++i) {
+        out[i] = mat3d_inverse(in[i]);
+    }
+}
+
+LINALG_DEF vec3i_t vec3i_sum(size_t n, ...) {
+    va_list args;
+    va_start(args, n);
+    vec3i_t sum = {0};
+    for (size_t i = 0; i < n; ++i) {
+        vec3i_t v = va_arg(args, vec3i_t);
+        sum = vec3i_add(sum, v);
+    }
+    va_end(args);
+    return sum;
+}
+
+LINALG_DEF vec3i_t vec3i_sum_array(const vec3i_t *xs, size_t n) {
+    if (n <= LINALG_PAIRWISE_BLOCK) {
+        vec3i_t sum = {0};
+        for (size_t i = 0; i < n; ++i) {
+            vec3i_add_assign(&sum, xs[i]);
+        }
+        return sum;
+    }
+    size_t half = n / 2;
+    vec3i_t lhs = vec3i_sum_array(xs, half);
+    vec3i_t rhs = vec3i_sum_array(xs + half, n - half);
+    vec3i_add_assign(&lhs, rhs);
+    return lhs;
+}
+
+LINALG_DEF vec3i_t vec3i_product(size_t n, ...) {
+    va_list args;
+    va_start(args, n);
+    vec3i_t product = vec3i_splat(1);
+    for (size_t i = 0; i < n; ++i) {
+        vec3i_t v = va_arg(args, vec3i_t);
+        product = vec3i_mul(product, v);
+    }
+    va_end(args);
+    return product;
+}
+
+LINALG_DEF vec3i_t vec3i_product_array(const vec3i_t *xs, size_t n) {
+    if (n <= LINALG_PAIRWISE_BLOCK) {
+        vec3i_t product = vec3i_splat(1);
+        for (size_t i = 0; i < n; ++i) {
+            vec3i_mul_assign(&product, xs[i]);
+        }
+        return product;
+    }
+    size_t half = n / 2;
+    vec3i_t lhs = vec3i_product_array(xs, half);
+    vec3i_t rhs = vec3i_product_array(xs + half, n - half);
+    vec3i_mul_assign(&lhs, rhs);
+    return lhs;
+}
+
+LINALG_DEF mat3i_t mat3i_nmul(size_t n, ...) {
+    va_list args;
+    va_start(args, n);
+    mat3i_t product = mat3i_I();
+    for (size_t i = 0; i < n; ++i) {
+        mat3i_t A = va_arg(args, mat3i_t);
+        product = mat3i_mul(product, A);
+    }
+    va_end(args);
+    return product;
+}
+
+LINALG_DEF mat3i_t mat3i_mul_chain(const mat3i_t *Ms, size_t n) {
+    if (n == 0) {
+        return mat3i_I();
+    }
+    if (n == 1) {
+        return Ms[0];
+    }
+    size_t half = n / 2;
+    mat3i_t lhs = mat3i_mul_chain(Ms, half);
+    mat3i_t rhs = mat3i_mul_chain(Ms + half, n - half);
+    mat3i_t product;
+    mat3i_mul_to(&product, &lhs, &rhs);
+    return product;
+}
+
+LINALG_DEF void mat3i_transform_array(const mat3i_t *M,
+                                      const vec3i_t *restrict in,
+                                      vec3i_t *restrict out, size_t n) {
+    size_t i = 0;
+    const int m11 = M->_11;
+    const int m12 = M->_12;
+    const int m13 = M->_13;
+    const int m21 = M->_21;
+    const int m22 = M->_22;
+    const int m23 = M->_23;
+    const int m31 = M->_31;
+    const int m32 = M->_32;
+    const int m33 = M->_33;
+    for (; i + 4 <= n; i += 4) {
+        const int v0_0 = in[i].e[0];
+        const int v0_1 = in[i].e[1];
+        const int v0_2 = in[i].e[2];
+        out[i].e[0] = m11 * v0_0 + m12 * v0_1 + m13 * v0_2;
+        out[i].e[1] = m21 * v0_0 + m22 * v0_1 + m23 * v0_2;
+        out[i].e[2] = m31 * v0_0 + m32 * v0_1 + m33 * v0_2;
+        const int v1_0 = in[i + 1].e[0];
+        const int v1_1 = in[i + 1].e[1];
+        const int v1_2 = in[i + 1].e[2];
+        out[i + 1].e[0] = m11 * v1_0 + m12 * v1_1 + m13 * v1_2;
+        out[i + 1].e[1] = m21 * v1_0 + m22 * v1_1 + m23 * v1_2;
+        out[i + 1].e[2] = m31 * v1_0 + m32 * v1_1 + m33 * v1_2;
+        const int v2_0 = in[i + 2].e[0];
+        const int v2_1 = in[i + 2].e[1];
+        const int v2_2 = in[i + 2].e[2];
+        out[i + 2].e[0] = m11 * v2_0 + m12 * v2_1 + m13 * v2_2;
+        out[i + 2].e[1] = m21 * v2_0 + m22 * v2_1 + m23 * v2_2;
+        out[i + 2].e[2] = m31 * v2_0 + m32 * v2_1 + m33 * v2_2;
+        const int v3_0 = in[i + 3].e[0];
+        const int v3_1 = in[i + 3].e[1];
+        const int v3_2 = in[i + 3].e[2];
+        out[i + 3].e[0] = m11 * v3_0 + m12 * v3_1 + m13 * v3_2;
+        out[i + 3].e[1] = m21 * v3_0 + m22 * v3_1 + m23 * v3_2;
+        out[i + 3].e[2] = m31 * v3_0 + m32 * v3_1 + m33 * v3_2;
+    }
+    for (; i < n; ++i) {
+        const int v0_0 = in[i].e[0];
+        const int v0_1 = in[i].e[1];
+        const int v0_2 = in[i].e[2];
+        out[i].e[0] = m11 * v0_0 + m12 * v0_1 + m13 * v0_2;
+        out[i].e[1] = m21 * v0_0 + m22 * v0_1 + m23 * v0_2;
+        out[i].e[2] = m31 * v0_0 + m32 * v0_1 + m33 * v0_2;
+    }
+}
+
+LINALG_DEF vec3u_t vec3u_sum(size_t n, ...) {
+    va_list args;
+    va_start(args, n);
+    vec3u_t sum = {0};
+    for (size_t i = 0; i < n; ++i) {
+        vec3u_t v = va_arg(args, vec3u_t);
+        sum = vec3u_add(sum, v);
+    }
+    va_end(args);
+    return sum;
+}
+
+LINALG_DEF vec3u_t vec3u_sum_array(const vec3u_t *xs, size_t n) {
+    if (n <= LINALG_PAIRWISE_BLOCK) {
+        vec3u_t sum = {0};
+        for (size_t i = 0; i < n; ++i) {
+            vec3u_add_assign(&sum, xs[i]);
+        }
+        return sum;
+    }
+    size_t half = n / 2;
+    vec3u_t lhs = vec3u_sum_array(xs, half);
+    vec3u_t rhs = vec3u_sum_array(xs + half, n - half);
+    vec3u_add_assign(&lhs, rhs);
+    return lhs;
+}
+
+LINALG_DEF vec3u_t vec3u_product(size_t n, ...) {
+    va_list args;
+    va_start(args, n);
+    vec3u_t product = vec3u_splat(1);
+    for (size_t i = 0; i < n; ++i) {
+        vec3u_t v = va_arg(args, vec3u_t);
+        product = vec3u_mul(product, v);
+    }
+    va_end(args);
+    return product;
+}
+
+LINALG_DEF vec3u_t vec3u_product_array(const vec3u_t *xs, size_t n) {
+    if (n <= LINALG_PAIRWISE_BLOCK) {
+        vec3u_t product = vec3u_splat(1);
+        for (size_t i = 0; i < n; ++i) {
+            vec3u_mul_assign(&product, xs[i]);
+        }
+        return product;
+    }
+    size_t half = n / 2;
+    vec3u_t lhs = vec3u_product_array(xs, half);
+    vec3u_t rhs = vec3u_product_array(xs + half, n - half);
+    vec3u_mul_assign(&lhs, rhs);
+    return lhs;
+}
+
+LINALG_DEF mat3u_t mat3u_nmul(size_t n, ...) {
+    va_list args;
+    va_start(args, n);
+    mat3u_t product = mat3u_I();
+    for (size_t i = 0; i < n; ++i) {
+        mat3u_t A = va_arg(args, mat3u_t);
+        product = mat3u_mul(product, A);
+    }
+    va_end(args);
+    return product;
+}
+
+LINALG_DEF mat3u_t mat3u_mul_chain(const mat3u_t *Ms, size_t n) {
+    if (n == 0) {
+        return mat3u_I();
+    }
+    if (n == 1) {
+        return Ms[0];
+    }
+    size_t half = n / 2;
+    mat3u_t lhs = mat3u_mul_chain(Ms, half);
+    mat3u_t rhs = mat3u_mul_chain(Ms + half, n - half);
+    mat3u_t product;
+    mat3u_mul_to(&product, &lhs, &rhs);
+    return product;
+}
+
+LINALG_DEF void mat3u_transform_array(const mat3u_t *M,
+                                      const vec3u_t *restrict in,
+                                      vec3u_t *restrict out, size_t n) {
+    size_t i = 0;
+    const unsigned int m11 = M->_11;
+    const unsigned int m12 = M->_12;
+    const unsigned int m13 = M->_13;
+    const unsigned int m21 = M->_21;
+    const unsigned int m22 = M->_22;
+    const unsigned int m23 = M->_23;
+    const unsigned int m31 = M->_31;
+    const unsigned int m32 = M->_32;
+    const unsigned int m33 = M->_33;
+    for (; i + 4 <= n; i += 4) {
+        const unsigned int v0_0 = in[i].e[0];
+        const unsigned int v0_1 = in[i].e[1];
+        const unsigned int v0_2 = in[i].e[2];
+        out[i].e[0] = m11 * v0_0 + m12 * v0_1 + m13 * v0_2;
+        out[i].e[1] = m21 * v0_0 + m22 * v0_1 + m23 * v0_2;
+        out[i].e[2] = m31 * v0_0 + m32 * v0_1 + m33 * v0_2;
+        const unsigned int v1_0 = in[i + 1].e[0];
+        const unsigned int v1_1 = in[i + 1].e[1];
+        const unsigned int v1_2 = in[i + 1].e[2];
+        out[i + 1].e[0] = m11 * v1_0 + m12 * v1_1 + m13 * v1_2;
+        out[i + 1].e[1] = m21 * v1_0 + m22 * v1_1 + m23 * v1_2;
+        out[i + 1].e[2] = m31 * v1_0 + m32 * v1_1 + m33 * v1_2;
+        const unsigned int v2_0 = in[i + 2].e[0];
+        const unsigned int v2_1 = in[i + 2].e[1];
+        const unsigned int v2_2 = in[i + 2].e[2];
+        out[i + 2].e[0] = m11 * v2_0 + m12 * v2_1 + m13 * v2_2;
+        out[i + 2].e[1] = m21 * v2_0 + m22 * v2_1 + m23 * v2_2;
+        out[i + 2].e[2] = m31 * v2_0 + m32 * v2_1 + m33 * v2_2;
+        const unsigned int v3_0 = in[i + 3].e[0];
+        const unsigned int v3_1 = in[i + 3].e[1];
+        const unsigned int v3_2 = in[i + 3].e[2];
+        out[i + 3].e[0] = m11 * v3_0 + m12 * v3_1 + m13 * v3_2;
+        out[i + 3].e[1] = m21 * v3_0 + m22 * v3_1 + m23 * v3_2;
+        out[i + 3].e[2] = m31 * v3_0 + m32 * v3_1 + m33 * v3_2;
+    }
+    for (; i < n; ++i) {
+        const unsigned int v0_0 = in[i].e[0];
+        const unsigned int v0_1 = in[i].e[1];
+        const unsigned int v0_2 = in[i].e[2];
+        out[i].e[0] = m11 * v0_0 + m12 * v0_1 + m13 * v0_2;
+        out[i].e[1] = m21 * v0_0 + m22 * v0_1 + m23 * v0_2;
+        out[i].e[2] = m31 * v0_0 + m32 * v0_1 + m33 * v0_2;
+    }
+}
+
+LINALG_DEF vec4f_t vec4f_sum(size_t n, ...) {
+    va_list args;
+    va_start(args, n);
+    vec4f_t sum = {0};
+    for (size_t i = 0; i < n; ++i) {
+        vec4f_t v = va_arg(args, vec4f_t);
+        sum = vec4f_add(sum, v);
+    }
+    va_end(args);
+    return sum;
+}
+
+LINALG_DEF vec4f_t vec4f_sum_array(const vec4f_t *xs, size_t n) {
+    if (n <= LINALG_PAIRWISE_BLOCK) {
+        vec4f_t sum = {0};
+        for (size_t i = 0; i < n; ++i) {
+            vec4f_add_assign(&sum, xs[i]);
+        }
+        return sum;
+    }
+    size_t half = n / 2;
+    vec4f_t lhs = vec4f_sum_array(xs, half);
+    vec4f_t rhs = vec4f_sum_array(xs + half, n - half);
+    vec4f_add_assign(&lhs, rhs);
+    return lhs;
+}
+
+LINALG_DEF vec4f_t vec4f_product(size_t n, ...) {
+    va_list args;
+    va_start(args, n);
+    vec4f_t product = vec4f_splat(1);
+    for (size_t i = 0; i < n; ++i) {
+        vec4f_t v = va_arg(args, vec4f_t);
+        product = vec4f_mul(product, v);
+    }
+    va_end(args);
+    return product;
+}
+
+LINALG_DEF vec4f_t vec4f_product_array(const vec4f_t *xs, size_t n) {
+    if (n <= LINALG_PAIRWISE_BLOCK) {
+        vec4f_t product = vec4f_splat(1);
+        for (size_t i = 0; i < n; ++i) {
+            vec4f_mul_assign(&product, xs[i]);
+        }
+        return product;
+    }
+    size_t half = n / 2;
+    vec4f_t lhs = vec4f_product_array(xs, half);
+    vec4f_t rhs = vec4f_product_array(xs + half, n - half);
+    vec4f_mul_assign(&lhs, rhs);
+    return lhs;
+}
+
+LINALG_DEF mat4f_t mat4f_mul(mat4f_t A, mat4f_t B) {
+    mat4f_t result;
+#ifdef LINALG_SIMD
+    result.m[0] = _mm_mul_ps(_mm_set1_ps(A._11), B.m[0]);
+    result.m[0] = linalg_madd_ps(_mm_set1_ps(A._12), B.m[1], result.m[0]);
+    result.m[0] = linalg_madd_ps(_mm_set1_ps(A._13), B.m[2], result.m[0]);
+    result.m[0] = linalg_madd_ps(_mm_set1_ps(A._14), B.m[3], result.m[0]);
+    result.m[1] = _mm_mul_ps(_mm_set1_ps(A._21), B.m[0]);
+    result.m[1] = linalg_madd_ps(_mm_set1_ps(A._22), B.m[1], result.m[1]);
+    result.m[1] = linalg_madd_ps(_mm_set1_ps(A._23), B.m[2], result.m[1]);
+    result.m[1] = linalg_madd_ps(_mm_set1_ps(A._24), B.m[3], result.m[1]);
+    result.m[2] = _mm_mul_ps(_mm_set1_ps(A._31), B.m[0]);
+    result.m[2] = linalg_madd_ps(_mm_set1_ps(A._32), B.m[1], result.m[2]);
+    result.m[2] = linalg_madd_ps(_mm_set1_ps(A._33), B.m[2], result.m[2]);
+    result.m[2] = linalg_madd_ps(_mm_set1_ps(A._34), B.m[3], result.m[2]);
+    result.m[3] = _mm_mul_ps(_mm_set1_ps(A._41), B.m[0]);
+    result.m[3] = linalg_madd_ps(_mm_set1_ps(A._42), B.m[1], result.m[3]);
+    result.m[3] = linalg_madd_ps(_mm_set1_ps(A._43), B.m[2], result.m[3]);
+    result.m[3] = linalg_madd_ps(_mm_set1_ps(A._44), B.m[3], result.m[3]);
+#else
+    result._11 = A._11 * B._11 + A._12 * B._21 + A._13 * B._31 + A._14 * B._41;
+    result._12 = A._11 * B._12 + A._12 * B._22 + A._13 * B._32 + A._14 * B._42;
+    result._13 = A._11 * B._13 + A._12 * B._23 + A._13 * B._33 + A._14 * B._43;
+    result._14 = A._11 * B._14 + A._12 * B._24 + A._13 * B._34 + A._14 * B._44;
+    result._21 = A._21 * B._11 + A._22 * B._21 + A._23 * B._31 + A._24 * B._41;
+    result._22 = A._21 * B._12 + A._22 * B._22 + A._23 * B._32 + A._24 * B._42;
+    result._23 = A._21 * B._13 + A._22 * B._23 + A._23 * B._33 + A._24 * B._43;
+    result._24 = A._21 * B._14 + A._22 * B._24 + A._23 * B._34 + A._24 * B._44;
+    result._31 = A._31 * B._11 + A._32 * B._21 + A._33 * B._31 + A._34 * B._41;
+    result._32 = A._31 * B._12 + A._32 * B._22 + A._33 * B._32 + A._34 * B._42;
+    result._33 = A._31 * B._13 + A._32 * B._23 + A._33 * B._33 + A._34 * B._43;
+    result._34 = A._31 * B._14 + A._32 * B._24 + A._33 * B._34 + A._34 * B._44;
+    result._41 = A._41 * B._11 + A._42 * B._21 + A._43 * B._31 + A._44 * B._41;
+    result._42 = A._41 * B._12 + A._42 * B._22 + A._43 * B._32 + A._44 * B._42;
+    result._43 = A._41 * B._13 + A._42 * B._23 + A._43 * B._33 + A._44 * B._43;
+    result._44 = A._41 * B._14 + A._42 * B._24 + A._43 * B._34 + A._44 * B._44;
+#endif // LINALG_SIMD
+    return result;
+}
+
+LINALG_DEF void mat4f_mul_to(mat4f_t *restrict out, const mat4f_t *A,
+                             const mat4f_t *B) {
+#ifdef LINALG_SIMD
+    __m128 r0 = _mm_mul_ps(_mm_set1_ps(A->_11), B->m[0]);
+    r0 = linalg_madd_ps(_mm_set1_ps(A->_12), B->m[1], r0);
+    r0 = linalg_madd_ps(_mm_set1_ps(A->_13), B->m[2], r0);
+    r0 = linalg_madd_ps(_mm_set1_ps(A->_14), B->m[3], r0);
+    __m128 r1 = _mm_mul_ps(_mm_set1_ps(A->_21), B->m[0]);
+    r1 = linalg_madd_ps(_mm_set1_ps(A->_22), B->m[1], r1);
+    r1 = linalg_madd_ps(_mm_set1_ps(A->_23), B->m[2], r1);
+    r1 = linalg_madd_ps(_mm_set1_ps(A->_24), B->m[3], r1);
+    __m128 r2 = _mm_mul_ps(_mm_set1_ps(A->_31), B->m[0]);
+    r2 = linalg_madd_ps(_mm_set1_ps(A->_32), B->m[1], r2);
+    r2 = linalg_madd_ps(_mm_set1_ps(A->_33), B->m[2], r2);
+    r2 = linalg_madd_ps(_mm_set1_ps(A->_34), B->m[3], r2);
+    __m128 r3 = _mm_mul_ps(_mm_set1_ps(A->_41), B->m[0]);
+    r3 = linalg_madd_ps(_mm_set1_ps(A->_42), B->m[1], r3);
+    r3 = linalg_madd_ps(_mm_set1_ps(A->_43), B->m[2], r3);
+    r3 = linalg_madd_ps(_mm_set1_ps(A->_44), B->m[3], r3);
+    out->m[0] = r0;
+    out->m[1] = r1;
+    out->m[2] = r2;
+    out->m[3] = r3;
+#else
+    out->_11 = A->_11 * B->_11 + A->_12 * B->_21 + A->_13 * B->_31 + A->_14 *
+               B->_41;
+    out->_12 = A->_11 * B->_12 + A->_12 * B->_22 + A->_13 * B->_32 + A->_14 *
+               B->_42;
+    out->_13 = A->_11 * B->_13 + A->_12 * B->_23 + A->_13 * B->_33 + A->_14 *
+               B->_43;
+    out->_14 = A->_11 * B->_14 + A->_12 * B->_24 + A->_13 * B->_34 + A->_14 *
+               B->_44;
+    out->_21 = A->_21 * B->_11 + A->_22 * B->_21 + A->_23 * B->_31 + A->_24 *
+               B->_41;
+    out->_22 = A->_21 * B->_12 + A->_22 * B->_22 + A->_23 * B->_32 + A->_24 *
+               B->_42;
+    out->_23 = A->_21 * B->_13 + A->_22 * B->_23 + A->_23 * B->_33 + A->_24 *
+               B->_43;
+    out->_24 = A->_21 * B->_14 + A->_22 * B->_24 + A->_23 * B->_34 + A->_24 *
+               B->_44;
+    out->_31 = A->_31 * B->_11 + A->_32 * B->_21 + A->_33 * B->_31 + A->_34 *
+               B->_41;
+    out->_32 = A->_31 * B->_12 + A->_32 * B->_22 + A->_33 * B->_32 + A->_34 *
+               B->_42;
+    out->_33 = A->_31 * B->_13 + A->_32 * B->_23 + A->_33 * B->_33 + A->_34 *
+               B->_43;
+    out->_34 = A->_31 * B->_14 + A->_32 * B->_24 + A->_33 * B->_34 + A->_34 *
+               B->_44;
+    out->_41 = A->_41 * B->_11 + A->_42 * B->_21 + A->_43 * B->_31 + A->_44 *
+               B->_41;
+    out->_42 = A->_41 * B->_12 + A->_42 * B->_22 + A->_43 * B->_32 + A->_44 *
+               B->_42;
+    out->_43 = A->_41 * B->_13 + A->_42 * B->_23 + A->_43 * B->_33 + A->_44 *
+               B->_43;
+    out->_44 = A->_41 * B->_14 + A->_42 * B->_24 + A->_43 * B->_34 + A->_44 *
+               B->_44;
+#endif // LINALG_SIMD
+}
+
+LINALG_DEF mat4f_t mat4f_nmul(size_t n, ...) {
+    va_list args;
+    va_start(args, n);
+    mat4f_t product = mat4f_I();
+    for (size_t i = 0; i < n; ++i) {
+        mat4f_t A = va_arg(args, mat4f_t);
+        product = mat4f_mul(product, A);
+    }
+    va_end(args);
+    return product;
+}
+
+LINALG_DEF mat4f_t mat4f_mul_chain(const mat4f_t *Ms, size_t n) {
+    if (n == 0) {
+        return mat4f_I();
+    }
+    if (n == 1) {
+        return Ms[0];
+    }
+    size_t half = n / 2;
+    mat4f_t lhs = mat4f_mul_chain(Ms, half);
+    mat4f_t rhs = mat4f_mul_chain(Ms + half, n - half);
+    mat4f_t product;
+    mat4f_mul_to(&product, &lhs, &rhs);
+    return product;
+}
+
+LINALG_DEF void mat4f_transform_array(const mat4f_t *M,
+                                      const vec4f_t *restrict in,
+                                      vec4f_t *restrict out, size_t n) {
+    size_t i = 0;
+#ifdef LINALG_SIMD
+    __m128 c0 = M->m[0];
+    __m128 c1 = M->m[1];
+    __m128 c2 = M->m[2];
+    __m128 c3 = M->m[3];
+    _MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+    for (; i + 4 <= n; i += 4) {
+        __m128 v0 = in[i].m;
+        __m128 r0 = _mm_mul_ps(c0, _mm_shuffle_ps(v0, v0, 0x00));
+        r0 = linalg_madd_ps(c1, _mm_shuffle_ps(v0, v0, 0x55), r0);
+        r0 = linalg_madd_ps(c2, _mm_shuffle_ps(v0, v0, 0xAA), r0);
+        r0 = linalg_madd_ps(c3, _mm_shuffle_ps(v0, v0, 0xFF), r0);
+        __m128 v1 = in[i + 1].m;
+        __m128 r1 = _mm_mul_ps(c0, _mm_shuffle_ps(v1, v1, 0x00));
+        r1 = linalg_madd_ps(c1, _mm_shuffle_ps(v1, v1, 0x55), r1);
+        r1 = linalg_madd_ps(c2, _mm_shuffle_ps(v1, v1, 0xAA), r1);
+        r1 = linalg_madd_ps(c3, _mm_shuffle_ps(v1, v1, 0xFF), r1);
+        __m128 v2 = in[i + 2].m;
+        __m128 r2 = _mm_mul_ps(c0, _mm_shuffle_ps(v2, v2, 0x00));
+        r2 = linalg_madd_ps(c1, _mm_shuffle_ps(v2, v2, 0x55), r2);
+        r2 = linalg_madd_ps(c2, _mm_shuffle_ps(v2, v2, 0xAA), r2);
+        r2 = linalg_madd_ps(c3, _mm_shuffle_ps(v2, v2, 0xFF), r2);
+        __m128 v3 = in[i + 3].m;
+        __m128 r3 = _mm_mul_ps(c0, _mm_shuffle_ps(v3, v3, 0x00));
+        r3 = linalg_madd_ps(c1, _mm_shuffle_ps(v3, v3, 0x55), r3);
+        r3 = linalg_madd_ps(c2, _mm_shuffle_ps(v3, v3, 0xAA), r3);
+        r3 = linalg_madd_ps(c3, _mm_shuffle_ps(v3, v3, 0xFF), r3);
+        out[i].m = r0;
+        out[i + 1].m = r1;
+        out[i + 2].m = r2;
+        out[i + 3].m = r3;
+    }
+    for (; i < n; ++i) {
+        out[i] = mat4f_mul_vec(*M, in[i]);
+    }
+#else
+    const float m11 = M->_11;
+    const float m12 = M->_12;
+    const float m13 = M->_13;
+    const float m14 = M->_14;
+    const float m21 = M->_21;
+    const float m22 = M->_22;
+    const float m23 = M->_23;
+    const float m24 = M->_24;
+    const float m31 = M->_31;
+    const float m32 = M->_32;
+    const float m33 = M->_33;
+    const float m34 = M->_34;
+    const float m41 = M->_41;
+    const float m42 = M->_42;
+    const float m43 = M->_43;
+    const float m44 = M->_44;
+    for (; i + 4 <= n; i += 4) {
+        const float v0_0 = in[i].e[0];
+        const float v0_1 = in[i].e[1];
+        const float v0_2 = in[i].e[2];
+        const float v0_3 = in[i].e[3];
+        out[i].e[0] = m11 * v0_0 + m12 * v0_1 + m13 * v0_2 + m14 * v0_3;
+        out[i].e[1] = m21 * v0_0 + m22 * v0_1 + m23 * v0_2 + m24 * v0_3;
+        out[i].e[2] = m31 * v0_0 + m32 * v0_1 + m33 * v0_2 + m34 * v0_3;
+        out[i].e[3] = m41 * v0_0 + m42 * v0_1 + m43 * v0_2 + m44 * v0_3;
+        const float v1_0 = in[i + 1].e[0];
+        const float v1_1 = in[i + 1].e[1];
+        const float v1_2 = in[i + 1].e[2];
+        const float v1_3 = in[i + 1].e[3];
+        out[i + 1].e[0] = m11 * v1_0 + m12 * v1_1 + m13 * v1_2 + m14 * v1_3;
+        out[i + 1].e[1] = m21 * v1_0 + m22 * v1_1 + m23 * v1_2 + m24 * v1_3;
+        out[i + 1].e[2] = m31 * v1_0 + m32 * v1_1 + m33 * v1_2 + m34 * v1_3;
+        out[i + 1].e[3] = m41 * v1_0 + m42 * v1_1 + m43 * v1_2 + m44 * v1_3;
+        const float v2_0 = in[i + 2].e[0];
+        const float v2_1 = in[i + 2].e[1];
+        const float v2_2 = in[i + 2].e[2];
+        const float v2_3 = in[i + 2].e[3];
+        out[i + 2].e[0] = m11 * v2_0 + m12 * v2_1 + m13 * v2_2 + m14 * v2_3;
+        out[i + 2].e[1] = m21 * v2_0 + m22 * v2_1 + m23 * v2_2 + m24 * v2_3;
+        out[i + 2].e[2] = m31 * v2_0 + m32 * v2_1 + m33 * v2_2 + m34 * v2_3;
+        out[i + 2].e[3] = m41 * v2_0 + m42 * v2_1 + m43 * v2_2 + m44 * v2_3;
+        const float v3_0 = in[i + 3].e[0];
+        const float v3_1 = in[i + 3].e[1];
+        const float v3_2 = in[i + 3].e[2];
+        const float v3_3 = in[i + 3].e[3];
+        out[i + 3].e[0] = m11 * v3_0 + m12 * v3_1 + m13 * v3_2 + m14 * v3_3;
+        out[i + 3].e[1] = m21 * v3_0 + m22 * v3_1 + m23 * v3_2 + m24 * v3_3;
+        out[i + 3].e[2] = m31 * v3_0 + m32 * v3_1 + m33 * v3_2 + m34 * v3_3;
+        out[i + 3].e[3] = m41 * v3_0 + m42 * v3_1 + m43 * v3_2 + m44 * v3_3;
+    }
+    for (; i < n; ++i) {
+        const float v0_0 = in[i].e[0];
+        const float v0_1 = in[i].e[1];
+        const float v0_2 = in[i].e[2];
+        const float v0_3 = in[i].e[3];
+        out[i].e[0] = m11 * v0_0 + m12 * v0_1 + m13 * v0_2 + m14 * v0_3;
+        out[i].e[1] = m21 * v0_0 + m22 * v0_1 + m23 * v0_2 + m24 * v0_3;
+        out[i].e[2] = m31 * v0_0 + m32 * v0_1 + m33 * v0_2 + m34 * v0_3;
+        out[i].e[3] = m41 * v0_0 + m42 * v0_1 + m43 * v0_2 + m44 * v0_3;
+    }
+#endif // LINALG_SIMD
+}
+
+LINALG_DEF mat4f_t mat4f_transpose(mat4f_t M) {
+#ifdef LINALG_SIMD
+    _MM_TRANSPOSE4_PS(M.m[0], M.m[1], M.m[2], M.m[3]);
+    return M;
+#else
+    mat4f_t T;
+    T._11 = M._11;
+    T._12 = M._21;
+    T._13 = M._31;
+    T._14 = M._41;
+    T._21 = M._12;
+    T._22 = M._22;
+    T._23 = M._32;
+    T._24 = M._42;
+    T._31 = M._13;
+    T._32 = M._23;
+    T._33 = M._33;
+    T._34 = M._43;
+    T._41 = M._14;
+    T._42 = M._24;
+    T._43 = M._34;
+    T._44 = M._44;
+    return T;
+#endif // LINALG_SIMD
+}
+
+LINALG_DEF mat4f_t mat4f_inverse(mat4f_t M) {
+#ifdef LINALG_SIMD
+    const __m128 m0 = M.m[0];
+    const __m128 m1 = M.m[1];
+    const __m128 m2 = M.m[2];
+    const __m128 m3 = M.m[3];
+    const __m128 A = _mm_movelh_ps(m0, m1);
+    const __m128 B = _mm_movehl_ps(m1, m0);
+    const __m128 C = _mm_movelh_ps(m2, m3);
+    const __m128 D = _mm_movehl_ps(m3, m2);
+    const __m128 even_02 = _mm_shuffle_ps(m0, m2, _MM_SHUFFLE(2, 0, 2, 0));
+    const __m128 odd_02 = _mm_shuffle_ps(m0, m2, _MM_SHUFFLE(3, 1, 3, 1));
+    const __m128 even_13 = _mm_shuffle_ps(m1, m3, _MM_SHUFFLE(2, 0, 2, 0));
+    const __m128 odd_13 = _mm_shuffle_ps(m1, m3, _MM_SHUFFLE(3, 1, 3, 1));
+    const __m128 dets = _mm_sub_ps(_mm_mul_ps(even_02, odd_13),
+                                   _mm_mul_ps(odd_02, even_13));
+    const __m128 det_A = _mm_shuffle_ps(dets, dets, _MM_SHUFFLE(0, 0, 0, 0));
+    const __m128 det_B = _mm_shuffle_ps(dets, dets, _MM_SHUFFLE(1, 1, 1, 1));
+    const __m128 det_C = _mm_shuffle_ps(dets, dets, _MM_SHUFFLE(2, 2, 2, 2));
+    const __m128 det_D = _mm_shuffle_ps(dets, dets, _MM_SHUFFLE(3, 3, 3, 3));
+    const __m128 AB = linalg_mat2_adj_mul_ps(A, B);
+    const __m128 DC = linalg_mat2_adj_mul_ps(D, C);
+    __m128 X = _mm_sub_ps(_mm_mul_ps(det_D, A), linalg_mat2_mul_ps(B, DC));
+    __m128 Y = _mm_sub_ps(_mm_mul_ps(det_B, C), linalg_mat2_mul_adj_ps(D, AB));
+    __m128 Z = _mm_sub_ps(_mm_mul_ps(det_C, B), linalg_mat2_mul_adj_ps(A, DC));
+    __m128 W = _mm_sub_ps(_mm_mul_ps(det_A, D), linalg_mat2_mul_ps(C, AB));
+    const __m128 DC_0213 = _mm_shuffle_ps(DC, DC, _MM_SHUFFLE(3, 1, 2, 0));
+    const __m128 tr = _mm_mul_ps(AB, DC_0213);
+    const __m128 tr_2301 = _mm_shuffle_ps(tr, tr, _MM_SHUFFLE(1, 0, 3, 2));
+    const __m128 tr2 = _mm_add_ps(tr, tr_2301);
+    const __m128 tr2_1032 = _mm_shuffle_ps(tr2, tr2, _MM_SHUFFLE(2, 3, 0, 1));
+    const __m128 trace = _mm_add_ps(tr2, tr2_1032);
+    __m128 det = _mm_mul_ps(det_A, det_D);
+    det = _mm_add_ps(det, _mm_mul_ps(det_B, det_C));
+    det = _mm_sub_ps(det, trace);
+    const __m128 inv_det = _mm_div_ps(_mm_setr_ps(1, -1, -1, 1), det);
+    X = _mm_mul_ps(X, inv_det);
+    Y = _mm_mul_ps(Y, inv_det);
+    Z = _mm_mul_ps(Z, inv_det);
+    W = _mm_mul_ps(W, inv_det);
+    mat4f_t result;
+    result.m[0] = _mm_shuffle_ps(X, Y, _MM_SHUFFLE(1, 3, 1, 3));
+    result.m[1] = _mm_shuffle_ps(X, Y, _MM_SHUFFLE(0, 2, 0, 2));
+    result.m[2] = _mm_shuffle_ps(Z, W, _MM_SHUFFLE(1, 3, 1, 3));
+    result.m[3] = _mm_shuffle_ps(Z, W, _MM_SHUFFLE(0, 2, 0, 2));
+    return result;
+#else
+    mat4f_t result;
+    const float s0 = M._11 * M._22 - M._21 * M._12;
+    const float s1 = M._11 * M._23 - M._21 * M._13;
+    const float s2 = M._11 * M._24 - M._21 * M._14;
+    const float s3 = M._12 * M._23 - M._22 * M._13;
+    const float s4 = M._12 * M._24 - M._22 * M._14;
+    const float s5 = M._13 * M._24 - M._23 * M._14;
+    const float c0 = M._31 * M._42 - M._41 * M._32;
+    const float c1 = M._31 * M._43 - M._41 * M._33;
+    const float c2 = M._31 * M._44 - M._41 * M._34;
+    const float c3 = M._32 * M._43 - M._42 * M._33;
+    const float c4 = M._32 * M._44 - M._42 * M._34;
+    const float c5 = M._33 * M._44 - M._43 * M._34;
+    float det = s0 * c5 - s1 * c4 + s2 * c3;
+    det += s3 * c2 - s4 * c1 + s5 * c0;
+    const float inv_det = 1 / det;
+    result._11 = (M._22 * c5 - M._23 * c4 + M._24 * c3) * inv_det;
+    result._12 = (-M._12 * c5 + M._13 * c4 - M._14 * c3) * inv_det;
+    result._13 = (M._42 * s5 - M._43 * s4 + M._44 * s3) * inv_det;
+    result._14 = (-M._32 * s5 + M._33 * s4 - M._34 * s3) * inv_det;
+    result._21 = (-M._21 * c5 + M._23 * c2 - M._24 * c1) * inv_det;
+    result._22 = (M._11 * c5 - M._13 * c2 + M._14 * c1) * inv_det;
+    result._23 = (-M._41 * s5 + M._43 * s2 - M._44 * s1) * inv_det;
+    result._24 = (M._31 * s5 - M._33 * s2 + M._34 * s1) * inv_det;
+    result._31 = (M._21 * c4 - M._22 * c2 + M._24 * c0) * inv_det;
+    result._32 = (-M._11 * c4 + M._12 * c2 - M._14 * c0) * inv_det;
+    result._33 = (M._41 * s4 - M._42 * s2 + M._44 * s0) * inv_det;
+    result._34 = (-M._31 * s4 + M._32 * s2 - M._34 * s0) * inv_det;
+    result._41 = (-M._21 * c3 + M._22 * c1 - M._23 * c0) * inv_det;
+    result._42 = (M._11 * c3 - M._12 * c1 + M._13 * c0) * inv_det;
+    result._43 = (-M._41 * s3 + M._42 * s1 - M._43 * s0) * inv_det;
+    result._44 = (M._31 * s3 - M._32 * s1 + M._33 * s0) * inv_det;
+    return result;
+#endif // LINALG_SIMD
+}
+
+LINALG_DEF mat4f_t mat4f_inverse_affine(mat4f_t M) {
+#ifdef LINALG_SIMD
+    const __m128 mask = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+    __m128 r0 = _mm_and_ps(M.m[0], mask);
+    __m128 r1 = _mm_and_ps(M.m[1], mask);
+    __m128 r2 = _mm_and_ps(M.m[2], mask);
+    __m128 t = _mm_setr_ps(0, 0, 0, 1);
+    t = _mm_sub_ps(t, _mm_mul_ps(r0, _mm_shuffle_ps(M.m[0], M.m[0],
+                                                    _MM_SHUFFLE(3, 3, 3, 3))));
+    t = _mm_sub_ps(t, _mm_mul_ps(r1, _mm_shuffle_ps(M.m[1], M.m[1],
+                                                    _MM_SHUFFLE(3, 3, 3, 3))));
+    t = _mm_sub_ps(t, _mm_mul_ps(r2, _mm_shuffle_ps(M.m[2], M.m[2],
+                                                    _MM_SHUFFLE(3, 3, 3, 3))));
+    _MM_TRANSPOSE4_PS(r0, r1, r2, t);
+    return (mat4f_t){.m = {r0, r1, r2, t}};
+#else
+    mat4f_t result;
+    result._11 = M._11;
+    result._12 = M._21;
+    result._13 = M._31;
+    result._14 = -(M._11 * M._14 + M._21 * M._24 + M._31 * M._34);
+    result._21 = M._12;
+    result._22 = M._22;
+    result._23 = M._32;
+    result._24 = -(M._12 * M._14 + M._22 * M._24 + M._32 * M._34);
+    result._31 = M._13;
+    result._32 = M._23;
+    result._33 = M._33;
+    result._34 = -(M._13 * M._14 + M._23 * M._24 + M._33 * M._34);
+    result._41 = result._42 = result._43 = 0;
+    result._44 = 1;
+    return result;
+#endif // LINALG_SIMD
+}
+
+LINALG_DEF void mat4f_inverse_array(const mat4f_t *restrict in,
+                                    mat4f_t *restrict out, size_t n) {
+    for (size_t i = 0; i < n; ++i) {
+        out[i] = mat4f_inverse(in[i]);
+    }
+}
+
+LINALG_DEF void mat4f_inverse_affine_array(const mat4f_t *restrict in,
+                                           mat4f_t *restrict out, size_t n) {
+    for (size_t i = 0; i < n; ++i) {
+        out[i] = mat4f_inverse_affine(in[i]);
+    }
+}
+
+LINALG_DEF vec4d_t vec4d_sum(size_t n, ...) {
+    va_list args;
+    va_start(args, n);
+    vec4d_t sum = {0};
+    for (size_t i = 0; i < n; ++i) {
+        vec4d_t v = va_arg(args, vec4d_t);
+        sum = vec4d_add(sum, v);
+    }
+    va_end(args);
+    return sum;
+}
+
+LINALG_DEF vec4d_t vec4d_sum_array(const vec4d_t *xs, size_t n) {
+    if (n <= LINALG_PAIRWISE_BLOCK) {
+        vec4d_t sum = {0};
+        for (size_t i = 0; i < n; ++i) {
+            vec4d_add_assign(&sum, xs[i]);
+        }
+        return sum;
+    }
+    size_t half = n / 2;
+    vec4d_t lhs = vec4d_sum_array(xs, half);
+    vec4d_t rhs = vec4d_sum_array(xs + half, n - half);
+    vec4d_add_assign(&lhs, rhs);
+    return lhs;
+}
+
+LINALG_DEF vec4d_t vec4d_product(size_t n, ...) {
+    va_list args;
+    va_start(args, n);
+    vec4d_t product = vec4d_splat(1);
+    for (size_t i = 0; i < n; ++i) {
+        vec4d_t v = va_arg(args, vec4d_t);
+        product = vec4d_mul(product, v);
+    }
+    va_end(args);
+    return product;
+}
+
+LINALG_DEF vec4d_t vec4d_product_array(const vec4d_t *xs, size_t n) {
+    if (n <= LINALG_PAIRWISE_BLOCK) {
+        vec4d_t product = vec4d_splat(1);
+        for (size_t i = 0; i < n; ++i) {
+            vec4d_mul_assign(&product, xs[i]);
+        }
+        return product;
+    }
+    size_t half = n / 2;
+    vec4d_t lhs = vec4d_product_array(xs, half);
+    vec4d_t rhs = vec4d_product_array(xs + half, n - half);
+    vec4d_mul_assign(&lhs, rhs);
+    return lhs;
+}
+
+LINALG_DEF mat4d_t mat4d_nmul(size_t n, ...) {
+    va_list args;
+    va_start(args, n);
+    mat4d_t product = mat4d_I();
+    for (size_t i = 0; i < n; ++i) {
+        mat4d_t A = va_arg(args, mat4d_t);
+        product = mat4d_mul(product, A);
+    }
+    va_end(args);
+    return product;
+}
+
+LINALG_DEF mat4d_t mat4d_mul_chain(const mat4d_t *Ms, size_t n) {
+    if (n == 0) {
+        return mat4d_I();
+    }
+    if (n == 1) {
+        return Ms[0];
+    }
+    size_t half = n / 2;
+    mat4d_t lhs = mat4d_mul_chain(Ms, half);
+    mat4d_t rhs = mat4d_mul_chain(Ms + half, n - half);
+    mat4d_t product;
+    mat4d_mul_to(&product, &lhs, &rhs);
+    return product;
+}
+
+LINALG_DEF void mat4d_transform_array(const mat4d_t *M,
+                                      const vec4d_t *restrict in,
+                                      vec4d_t *restrict out, size_t n) {
+    size_t i = 0;
+    const double m11 = M->_11;
+    const double m12 = M->_12;
+    const double m13 = M->_13;
+    const double m14 = M->_14;
+    const double m21 = M->_21;
+    const double m22 = M->_22;
+    const double m23 = M->_23;
+    const double m24 = M->_24;
+    const double m31 = M->_31;
+    const double m32 = M->_32;
+    const double m33 = M->_33;
+    const double m34 = M->_34;
+    const double m41 = M->_41;
+    const double m42 = M->_42;
+    const double m43 = M->_43;
+    const double m44 = M->_44;
+    for (; i + 4 <= n; i += 4) {
+        const double v0_0 = in[i].e[0];
+        const double v0_1 = in[i].e[1];
+        const double v0_2 = in[i].e[2];
+        const double v0_3 = in[i].e[3];
+        out[i].e[0] = m11 * v0_0 + m12 * v0_1 + m13 * v0_2 + m14 * v0_3;
+        out[i].e[1] = m21 * v0_0 + m22 * v0_1 + m23 * v0_2 + m24 * v0_3;
+        out[i].e[2] = m31 * v0_0 + m32 * v0_1 + m33 * v0_2 + m34 * v0_3;
+        out[i].e[3] = m41 * v0_0 + m42 * v0_1 + m43 * v0_2 + m44 * v0_3;
+        const double v1_0 = in[i + 1].e[0];
+        const double v1_1 = in[i + 1].e[1];
+        const double v1_2 = in[i + 1].e[2];
+        const double v1_3 = in[i + 1].e[3];
+        out[i + 1].e[0] = m11 * v1_0 + m12 * v1_1 + m13 * v1_2 + m14 * v1_3;
+        out[i + 1].e[1] = m21 * v1_0 + m22 * v1_1 + m23 * v1_2 + m24 * v1_3;
+        out[i + 1].e[2] = m31 * v1_0 + m32 * v1_1 + m33 * v1_2 + m34 * v1_3;
+        out[i + 1].e[3] = m41 * v1_0 + m42 * v1_1 + m43 * v1_2 + m44 * v1_3;
+        const double v2_0 = in[i + 2].e[0];
+        const double v2_1 = in[i + 2].e[1];
+        const double v2_2 = in[i + 2].e[2];
+        const double v2_3 = in[i + 2].e[3];
+        out[i + 2].e[0] = m11 * v2_0 + m12 * v2_1 + m13 * v2_2 + m14 * v2_3;
+        out[i + 2].e[1] = m21 * v2_0 + m22 * v2_1 + m23 * v2_2 + m24 * v2_3;
+        out[i + 2].e[2] = m31 * v2_0 + m32 * v2_1 + m33 * v2_2 + m34 * v2_3;
+        out[i + 2].e[3] = m41 * v2_0 + m42 * v2_1 + m43 * v2_2 + m44 * v2_3;
+        const double v3_0 = in[i + 3].e[0];
+        const double v3_1 = in[i + 3].e[1];
+        const double v3_2 = in[i + 3].e[2];
+        const double v3_3 = in[i + 3].e[3];
+        out[i + 3].e[0] = m11 * v3_0 + m12 * v3_1 + m13 * v3_2 + m14 * v3_3;
+        out[i + 3].e[1] = m21 * v3_0 + m22 * v3_1 + m23 * v3_2 + m24 * v3_3;
+        out[i + 3].e[2] = m31 * v3_0 + m32 * v3_1 + m33 * v3_2 + m34 * v3_3;
+        out[i + 3].e[3] = m41 * v3_0 + m42 * v3_1 + m43 * v3_2 + m44 * v3_3;
+    }
+    for (; i < n; ++i) {
+        const double v0_0 = in[i].e[0];
+        const double v0_1 = in[i].e[1];
+        const double v0_2 = in[i].e[2];
+        const double v0_3 = in[i].e[3];
+        out[i].e[0] = m11 * v0_0 + m12 * v0_1 + m13 * v0_2 + m14 * v0_3;
+        out[i].e[1] = m21 * v0_0 + m22 * v0_1 + m23 * v0_2 + m24 * v0_3;
+        out[i].e[2] = m31 * v0_0 + m32 * v0_1 + m33 * v0_2 + m34 * v0_3;
+        out[i].e[3] = m41 * v0_0 + m42 * v0_1 + m43 * v0_2 + m44 * v0_3;
+    }
+}
+
+LINALG_DEF mat4d_t mat4d_inverse(mat4d_t M) {
+    mat4d_t result;
+    const double s0 = M._11 * M._22 - M._21 * M._12;
+    const double s1 = M._11 * M._23 - M._21 * M._13;
+    const double s2 = M._11 * M._24 - M._21 * M._14;
+    const double s3 = M._12 * M._23 - M._22 * M._13;
+    const double s4 = M._12 * M._24 - M._22 * M._14;
+    const double s5 = M._13 * M._24 - M._23 * M._14;
+    const double c0 = M._31 * M._42 - M._41 * M._32;
+    const double c1 = M._31 * M._43 - M._41 * M._33;
+    const double c2 = M._31 * M._44 - M._41 * M._34;
+    const double c3 = M._32 * M._43 - M._42 * M._33;
+    const double c4 = M._32 * M._44 - M._42 * M._34;
+    const double c5 = M._33 * M._44 - M._43 * M._34;
+    double det = s0 * c5 - s1 * c4 + s2 * c3;
+    det += s3 * c2 - s4 * c1 + s5 * c0;
+    const double inv_det = 1 / det;
+    result._11 = (M._22 * c5 - M._23 * c4 + M._24 * c3) * inv_det;
+    result._12 = (-M._12 * c5 + M._13 * c4 - M._14 * c3) * inv_det;
+    result._13 = (M._42 * s5 - M._43 * s4 + M._44 * s3) * inv_det;
+    result._14 = (-M._32 * s5 + M._33 * s4 - M._34 * s3) * inv_det;
+    result._21 = (-M._21 * c5 + M._23 * c2 - M._24 * c1) * inv_det;
+    result._22 = (M._11 * c5 - M._13 * c2 + M._14 * c1) * inv_det;
+    result._23 = (-M._41 * s5 + M._43 * s2 - M._44 * s1) * inv_det;
+    result._24 = (M._31 * s5 - M._33 * s2 + M._34 * s1) * inv_det;
+    result._31 = (M._21 * c4 - M._22 * c2 + M._24 * c0) * inv_det;
+    result._32 = (-M._11 * c4 + M._12 * c2 - M._14 * c0) * inv_det;
+    result._33 = (M._41 * s4 - M._42 * s2 + M._44 * s0) * inv_det;
+    result._34 = (-M._31 * s4 + M._32 * s2 - M._34 * s0) * inv_det;
+    result._41 = (-M._21 * c3 + M._22 * c1 - M._23 * c0) * inv_det;
+    result._42 = (M._11 * c3 - M._12 * c1 + M._13 * c0) * inv_det;
+    result._43 = (-M._41 * s3 + M._42 * s1 - M._43 * s0) * inv_det;
+    result._44 = (M._31 * s3 - M._32 * s1 + M._33 * s0) * inv_det;
+    return result;
+}
+
+LINALG_DEF void mat4d_inverse_array(const mat4d_t *restrict in,
+                                    mat4d_t *restrict out, size_t n) {
+    for (size_t i = 0; i < n; ++i) {
+        out[i] = mat4d_inverse(in[i]);
+    }
+}
+
+LINALG_DEF void mat4d_inverse_affine_array(const mat4d_t *restrict in,
+                                           mat4d_t *restrict out, size_t n) {
+    for (size_t i = 0; i < n; ++i) {
+        out[i] = mat4d_inverse_affine(in[i]);
+    }
+}
+
+LINALG_DEF vec4i_t vec4i_sum(size_t n, ...) {
+    va_list args;
+    va_start(args, n);
+    vec4i_t sum = {0};
+    for (size_t i = 0; i < n; ++i) {
+        vec4i_t v = va_arg(args, vec4i_t);
+        sum = vec4i_add(sum, v);
+    }
+    va_end(args);
+    return sum;
+}
+
+LINALG_DEF vec4i_t vec4i_sum_array(const vec4i_t *xs, size_t n) {
+    if (n <= LINALG_PAIRWISE_BLOCK) {
+        vec4i_t sum = {0};
+        for (size_t i = 0; i < n; ++i) {
+            vec4i_add_assign(&sum, xs[i]);
+        }
+        return sum;
+    }
+    size_t half = n / 2;
+    vec4i_t lhs = vec4i_sum_array(xs, half);
+    vec4i_t rhs = vec4i_sum_array(xs + half, n - half);
+    vec4i_add_assign(&lhs, rhs);
+    return lhs;
+}
+
+LINALG_DEF vec4i_t vec4i_product(size_t n, ...) {
+    va_list args;
+    va_start(args, n);
+    vec4i_t product = vec4i_splat(1);
+    for (size_t i = 0; i < n; ++i) {
+        vec4i_t v = va_arg(args, vec4i_t);
+        product = vec4i_mul(product, v);
+    }
+    va_end(args);
+    return product;
+}
+
+LINALG_DEF vec4i_t vec4i_product_array(const vec4i_t *xs, size_t n) {
+    if (n <= LINALG_PAIRWISE_BLOCK) {
+        vec4i_t product = vec4i_splat(1);
+        for (size_t i = 0; i < n; ++i) {
+            vec4i_mul_assign(&product, xs[i]);
+        }
+        return product;
+    }
+    size_t half = n / 2;
+    vec4i_t lhs = vec4i_product_array(xs, half);
+    vec4i_t rhs = vec4i_product_array(xs + half, n - half);
+    vec4i_mul_assign(&lhs, rhs);
+    return lhs;
+}
+
+LINALG_DEF mat4i_t mat4i_nmul(size_t n, ...) {
+    va_list args;
+    va_start(args, n);
+    mat4i_t product = mat4i_I();
+    for (size_t i = 0; i < n; ++i) {
+        mat4i_t A = va_arg(args, mat4i_t);
+        product = mat4i_mul(product, A);
+    }
+    va_end(args);
+    return product;
+}
+
+LINALG_DEF mat4i_t mat4i_mul_chain(const mat4i_t *Ms, size_t n) {
+    if (n == 0) {
+        return mat4i_I();
+    }
+    if (n == 1) {
+        return Ms[0];
+    }
+    size_t half = n / 2;
+    mat4i_t lhs = mat4i_mul_chain(Ms, half);
+    mat4i_t rhs = mat4i_mul_chain(Ms + half, n - half);
+    mat4i_t product;
+    mat4i_mul_to(&product, &lhs, &rhs);
+    return product;
+}
+
+LINALG_DEF void mat4i_transform_array(const mat4i_t *M,
+                                      const vec4i_t *restrict in,
+                                      vec4i_t *restrict out, size_t n) {
+    size_t i = 0;
+    const int m11 = M->_11;
+    const int m12 = M->_12;
+    const int m13 = M->_13;
+    const int m14 = M->_14;
+    const int m21 = M->_21;
+    const int m22 = M->_22;
+    const int m23 = M->_23;
+    const int m24 = M->_24;
+    const int m31 = M->_31;
+    const int m32 = M->_32;
+    const int m33 = M->_33;
+    const int m34 = M->_34;
+    const int m41 = M->_41;
+    const int m42 = M->_42;
+    const int m43 = M->_43;
+    const int m44 = M->_44;
+    for (; i + 4 <= n; i += 4) {
+        const int v0_0 = in[i].e[0];
+        const int v0_1 = in[i].e[1];
+        const int v0_2 = in[i].e[2];
+        const int v0_3 = in[i].e[3];
+        out[i].e[0] = m11 * v0_0 + m12 * v0_1 + m13 * v0_2 + m14 * v0_3;
+        out[i].e[1] = m21 * v0_0 + m22 * v0_1 + m23 * v0_2 + m24 * v0_3;
+        out[i].e[2] = m31 * v0_0 + m32 * v0_1 + m33 * v0_2 + m34 * v0_3;
+        out[i].e[3] = m41 * v0_0 + m42 * v0_1 + m43 * v0_2 + m44 * v0_3;
+        const int v1_0 = in[i + 1].e[0];
+        const int v1_1 = in[i + 1].e[1];
+        const int v1_2 = in[i + 1].e[2];
+        const int v1_3 = in[i + 1].e[3];
+        out[i + 1].e[0] = m11 * v1_0 + m12 * v1_1 + m13 * v1_2 + m14 * v1_3;
+        out[i + 1].e[1] = m21 * v1_0 + m22 * v1_1 + m23 * v1_2 + m24 * v1_3;
+        out[i + 1].e[2] = m31 * v1_0 + m32 * v1_1 + m33 * v1_2 + m34 * v1_3;
+        out[i + 1].e[3] = m41 * v1_0 + m42 * v1_1 + m43 * v1_2 + m44 * v1_3;
+        const int v2_0 = in[i + 2].e[0];
+        const int v2_1 = in[i + 2].e[1];
+        const int v2_2 = in[i + 2].e[2];
+        const int v2_3 = in[i + 2].e[3];
+        out[i + 2].e[0] = m11 * v2_0 + m12 * v2_1 + m13 * v2_2 + m14 * v2_3;
+        out[i + 2].e[1] = m21 * v2_0 + m22 * v2_1 + m23 * v2_2 + m24 * v2_3;
+        out[i + 2].e[2] = m31 * v2_0 + m32 * v2_1 + m33 * v2_2 + m34 * v2_3;
+        out[i + 2].e[3] = m41 * v2_0 + m42 * v2_1 + m43 * v2_2 + m44 * v2_3;
+        const int v3_0 = in[i + 3].e[0];
+        const int v3_1 = in[i + 3].e[1];
+        const int v3_2 = in[i + 3].e[2];
+        const int v3_3 = in[i + 3].e[3];
+        out[i + 3].e[0] = m11 * v3_0 + m12 * v3_1 + m13 * v3_2 + m14 * v3_3;
+        out[i + 3].e[1] = m21 * v3_0 + m22 * v3_1 + m23 * v3_2 + m24 * v3_3;
+        out[i + 3].e[2] = m31 * v3_0 + m32 * v3_1 + m33 * v3_2 + m34 * v3_3;
+        out[i + 3].e[3] = m41 * v3_0 + m42 * v3_1 + m43 * v3_2 + m44 * v3_3;
+    }
+    for (; i < n; ++i) {
+        const int v0_0 = in[i].e[0];
+        const int v0_1 = in[i].e[1];
+        const int v0_2 = in[i].e[2];
+        const int v0_3 = in[i].e[3];
+        out[i].e[0] = m11 * v0_0 + m12 * v0_1 + m13 * v0_2 + m14 * v0_3;
+        out[i].e[1] = m21 * v0_0 + m22 * v0_1 + m23 * v0_2 + m24 * v0_3;
+        out[i].e[2] = m31 * v0_0 + m32 * v0_1 + m33 * v0_2 + m34 * v0_3;
+        out[i].e[3] = m41 * v0_0 + m42 * v0_1 + m43 * v0_2 + m44 * v0_3;
+    }
+}
+
+LINALG_DEF vec4u_t vec4u_sum(size_t n, ...) {
+    va_list args;
+    va_start(args, n);
+    vec4u_t sum = {0};
+    for (size_t i = 0; i < n; ++i) {
+        vec4u_t v = va_arg(args, vec4u_t);
+        sum = vec4u_add(sum, v);
+    }
+    va_end(args);
+    return sum;
+}
+
+LINALG_DEF vec4u_t vec4u_sum_array(const vec4u_t *xs, size_t n) {
+    if (n <= LINALG_PAIRWISE_BLOCK) {
+        vec4u_t sum = {0};
+        for (size_t i = 0; i < n; ++i) {
+            vec4u_add_assign(&sum, xs[i]);
+        }
+        return sum;
+    }
+    size_t half = n / 2;
+    vec4u_t lhs = vec4u_sum_array(xs, half);
+    vec4u_t rhs = vec4u_sum_array(xs + half, n - half);
+    vec4u_add_assign(&lhs, rhs);
+    return lhs;
+}
+
+LINALG_DEF vec4u_t vec4u_product(size_t n, ...) {
+    va_list args;
+    va_start(args, n);
+    vec4u_t product = vec4u_splat(1);
+    for (size_t i = 0; i < n; ++i) {
+        vec4u_t v = va_arg(args, vec4u_t);
+        product = vec4u_mul(product, v);
+    }
+    va_end(args);
+    return product;
+}
+
+LINALG_DEF vec4u_t vec4u_product_array(const vec4u_t *xs, size_t n) {
+    if (n <= LINALG_PAIRWISE_BLOCK) {
+        vec4u_t product = vec4u_splat(1);
+        for (size_t i = 0; i < n; ++i) {
+            vec4u_mul_assign(&product, xs[i]);
+        }
+        return product;
+    }
+    size_t half = n / 2;
+    vec4u_t lhs = vec4u_product_array(xs, half);
+    vec4u_t rhs = vec4u_product_array(xs + half, n - half);
+    vec4u_mul_assign(&lhs, rhs);
+    return lhs;
+}
+
+LINALG_DEF mat4u_t mat4u_nmul(size_t n, ...) {
+    va_list args;
+    va_start(args, n);
+    mat4u_t product = mat4u_I();
+    for (size_t i = 0; i < n; ++i) {
+        mat4u_t A = va_arg(args, mat4u_t);
+        product = mat4u_mul(product, A);
+    }
+    va_end(args);
+    return product;
+}
+
+LINALG_DEF mat4u_t mat4u_mul_chain(const mat4u_t *Ms, size_t n) {
+    if (n == 0) {
+        return mat4u_I();
+    }
+    if (n == 1) {
+        return Ms[0];
+    }
+    size_t half = n / 2;
+    mat4u_t lhs = mat4u_mul_chain(Ms, half);
+    mat4u_t rhs = mat4u_mul_chain(Ms + half, n - half);
+    mat4u_t product;
+    mat4u_mul_to(&product, &lhs, &rhs);
+    return product;
+}
+
+LINALG_DEF void mat4u_transform_array(const mat4u_t *M,
+                                      const vec4u_t *restrict in,
+                                      vec4u_t *restrict out, size_t n) {
+    size_t i = 0;
+    const unsigned int m11 = M->_11;
+    const unsigned int m12 = M->_12;
+    const unsigned int m13 = M->_13;
+    const unsigned int m14 = M->_14;
+    const unsigned int m21 = M->_21;
+    const unsigned int m22 = M->_22;
+    const unsigned int m23 = M->_23;
+    const unsigned int m24 = M->_24;
+    const unsigned int m31 = M->_31;
+    const unsigned int m32 = M->_32;
+    const unsigned int m33 = M->_33;
+    const unsigned int m34 = M->_34;
+    const unsigned int m41 = M->_41;
+    const unsigned int m42 = M->_42;
+    const unsigned int m43 = M->_43;
+    const unsigned int m44 = M->_44;
+    for (; i + 4 <= n; i += 4) {
+        const unsigned int v0_0 = in[i].e[0];
+        const unsigned int v0_1 = in[i].e[1];
+        const unsigned int v0_2 = in[i].e[2];
+        const unsigned int v0_3 = in[i].e[3];
+        out[i].e[0] = m11 * v0_0 + m12 * v0_1 + m13 * v0_2 + m14 * v0_3;
+        out[i].e[1] = m21 * v0_0 + m22 * v0_1 + m23 * v0_2 + m24 * v0_3;
+        out[i].e[2] = m31 * v0_0 + m32 * v0_1 + m33 * v0_2 + m34 * v0_3;
+        out[i].e[3] = m41 * v0_0 + m42 * v0_1 + m43 * v0_2 + m44 * v0_3;
+        const unsigned int v1_0 = in[i + 1].e[0];
+        const unsigned int v1_1 = in[i + 1].e[1];
+        const unsigned int v1_2 = in[i + 1].e[2];
+        const unsigned int v1_3 = in[i + 1].e[3];
+        out[i + 1].e[0] = m11 * v1_0 + m12 * v1_1 + m13 * v1_2 + m14 * v1_3;
+        out[i + 1].e[1] = m21 * v1_0 + m22 * v1_1 + m23 * v1_2 + m24 * v1_3;
+        out[i + 1].e[2] = m31 * v1_0 + m32 * v1_1 + m33 * v1_2 + m34 * v1_3;
+        out[i + 1].e[3] = m41 * v1_0 + m42 * v1_1 + m43 * v1_2 + m44 * v1_3;
+        const unsigned int v2_0 = in[i + 2].e[0];
+        const unsigned int v2_1 = in[i + 2].e[1];
+        const unsigned int v2_2 = in[i + 2].e[2];
+        const unsigned int v2_3 = in[i + 2].e[3];
+        out[i + 2].e[0] = m11 * v2_0 + m12 * v2_1 + m13 * v2_2 + m14 * v2_3;
+        out[i + 2].e[1] = m21 * v2_0 + m22 * v2_1 + m23 * v2_2 + m24 * v2_3;
+        out[i + 2].e[2] = m31 * v2_0 + m32 * v2_1 + m33 * v2_2 + m34 * v2_3;
+        out[i + 2].e[3] = m41 * v2_0 + m42 * v2_1 + m43 * v2_2 + m44 * v2_3;
+        const unsigned int v3_0 = in[i + 3].e[0];
+        const unsigned int v3_1 = in[i + 3].e[1];
+        const unsigned int v3_2 = in[i + 3].e[2];
+        const unsigned int v3_3 = in[i + 3].e[3];
+        out[i + 3].e[0] = m11 * v3_0 + m12 * v3_1 + m13 * v3_2 + m14 * v3_3;
+        out[i + 3].e[1] = m21 * v3_0 + m22 * v3_1 + m23 * v3_2 + m24 * v3_3;
+        out[i + 3].e[2] = m31 * v3_0 + m32 * v3_1 + m33 * v3_2 + m34 * v3_3;
+        out[i + 3].e[3] = m41 * v3_0 + m42 * v3_1 + m43 * v3_2 + m44 * v3_3;
+    }
+    for (; i < n; ++i) {
+        const unsigned int v0_0 = in[i].e[0];
+        const unsigned int v0_1 = in[i].e[1];
+        const unsigned int v0_2 = in[i].e[2];
+        const unsigned int v0_3 = in[i].e[3];
+        out[i].e[0] = m11 * v0_0 + m12 * v0_1 + m13 * v0_2 + m14 * v0_3;
+        out[i].e[1] = m21 * v0_0 + m22 * v0_1 + m23 * v0_2 + m24 * v0_3;
+        out[i].e[2] = m31 * v0_0 + m32 * v0_1 + m33 * v0_2 + m34 * v0_3;
+        out[i].e[3] = m41 * v0_0 + m42 * v0_1 + m43 * v0_2 + m44 * v0_3;
+    }
+}
+
+LINALG_DEF void mat2x3f_transform_affine_array(const mat2x3f_t *M,
+                                               const vec2f_t *restrict in,
+                                               vec2f_t *restrict out,
+                                               size_t n) {
+    const float m11 = M->_11;
+    const float m12 = M->_12;
+    const float m13 = M->_13;
+    const float m21 = M->_21;
+    const float m22 = M->_22;
+    const float m23 = M->_23;
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        const float v0_0 = in[i].e[0];
+        const float v0_1 = in[i].e[1];
+        out[i].e[0] = m11 * v0_0 + m12 * v0_1 + m13;
+        out[i].e[1] = m21 * v0_0 + m22 * v0_1 + m23;
+        const float v1_0 = in[i + 1].e[0];
+        const float v1_1 = in[i + 1].e[1];
+        out[i + 1].e[0] = m11 * v1_0 + m12 * v1_1 + m13;
+        out[i + 1].e[1] = m21 * v1_0 + m22 * v1_1 + m23;
+        const float v2_0 = in[i + 2].e[0];
+        const float v2_1 = in[i + 2].e[1];
+        out[i + 2].e[0] = m11 * v2_0 + m12 * v2_1 + m13;
+        out[i + 2].e[1] = m21 * v2_0 + m22 * v2_1 + m23;
+        const float v3_0 = in[i + 3].e[0];
+        const float v3_1 = in[i + 3].e[1];
+        out[i + 3].e[0] = m11 * v3_0 + m12 * v3_1 + m13;
+        out[i + 3].e[1] = m21 * v3_0 + m22 * v3_1 + m23;
+    }
+    for (; i < n; ++i) {
+        const float v0_0 = in[i].e[0];
+        const float v0_1 = in[i].e[1];
+        out[i].e[0] = m11 * v0_0 + m12 * v0_1 + m13;
+        out[i].e[1] = m21 * v0_0 + m22 * v0_1 + m23;
+    }
+}
+
+LINALG_DEF void mat2x3d_transform_affine_array(const mat2x3d_t *M,
+                                               const vec2d_t *restrict in,
+                                               vec2d_t *restrict out,
+                                               size_t n) {
+    const double m11 = M->_11;
+    const double m12 = M->_12;
+    const double m13 = M->_13;
+    const double m21 = M->_21;
+    const double m22 = M->_22;
+    const double m23 = M->_23;
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        const double v0_0 = in[i].e[0];
+        const double v0_1 = in[i].e[1];
+        out[i].e[0] = m11 * v0_0 + m12 * v0_1 + m13;
+        out[i].e[1] = m21 * v0_0 + m22 * v0_1 + m23;
+        const double v1_0 = in[i + 1].e[0];
+        const double v1_1 = in[i + 1].e[1];
+        out[i + 1].e[0] = m11 * v1_0 + m12 * v1_1 + m13;
+        out[i + 1].e[1] = m21 * v1_0 + m22 * v1_1 + m23;
+        const double v2_0 = in[i + 2].e[0];
+        const double v2_1 = in[i + 2].e[1];
+        out[i + 2].e[0] = m11 * v2_0 + m12 * v2_1 + m13;
+        out[i + 2].e[1] = m21 * v2_0 + m22 * v2_1 + m23;
+        const double v3_0 = in[i + 3].e[0];
+        const double v3_1 = in[i + 3].e[1];
+        out[i + 3].e[0] = m11 * v3_0 + m12 * v3_1 + m13;
+        out[i + 3].e[1] = m21 * v3_0 + m22 * v3_1 + m23;
+    }
+    for (; i < n; ++i) {
+        const double v0_0 = in[i].e[0];
+        const double v0_1 = in[i].e[1];
+        out[i].e[0] = m11 * v0_0 + m12 * v0_1 + m13;
+        out[i].e[1] = m21 * v0_0 + m22 * v0_1 + m23;
+    }
+}
+
+LINALG_DEF void mat2x3i_transform_affine_array(const mat2x3i_t *M,
+                                               const vec2i_t *restrict in,
+                                               vec2i_t *restrict out,
+                                               size_t n) {
+    const int m11 = M->_11;
+    const int m12 = M->_12;
+    const int m13 = M->_13;
+    const int m21 = M->_21;
+    const int m22 = M->_22;
+    const int m23 = M->_23;
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        const int v0_0 = in[i].e[0];
+        const int v0_1 = in[i].e[1];
+        out[i].e[0] = m11 * v0_0 + m12 * v0_1 + m13;
+        out[i].e[1] = m21 * v0_0 + m22 * v0_1 + m23;
+        const int v1_0 = in[i + 1].e[0];
+        const int v1_1 = in[i + 1].e[1];
+        out[i + 1].e[0] = m11 * v1_0 + m12 * v1_1 + m13;
+        out[i + 1].e[1] = m21 * v1_0 + m22 * v1_1 + m23;
+        const int v2_0 = in[i + 2].e[0];
+        const int v2_1 = in[i + 2].e[1];
+        out[i + 2].e[0] = m11 * v2_0 + m12 * v2_1 + m13;
+        out[i + 2].e[1] = m21 * v2_0 + m22 * v2_1 + m23;
+        const int v3_0 = in[i + 3].e[0];
+        const int v3_1 = in[i + 3].e[1];
+        out[i + 3].e[0] = m11 * v3_0 + m12 * v3_1 + m13;
+        out[i + 3].e[1] = m21 * v3_0 + m22 * v3_1 + m23;
+    }
+    for (; i < n; ++i) {
+        const int v0_0 = in[i].e[0];
+        const int v0_1 = in[i].e[1];
+        out[i].e[0] = m11 * v0_0 + m12 * v0_1 + m13;
+        out[i].e[1] = m21 * v0_0 + m22 * v0_1 + m23;
+    }
+}
+
+LINALG_DEF void mat2x3u_transform_affine_array(const mat2x3u_t *M,
+                                               const vec2u_t *restrict in,
+                                               vec2u_t *restrict out,
+                                               size_t n) {
+    const unsigned int m11 = M->_11;
+    const unsigned int m12 = M->_12;
+    const unsigned int m13 = M->_13;
+    const unsigned int m21 = M->_21;
+    const unsigned int m22 = M->_22;
+    const unsigned int m23 = M->_23;
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        const unsigned int v0_0 = in[i].e[0];
+        const unsigned int v0_1 = in[i].e[1];
+        out[i].e[0] = m11 * v0_0 + m12 * v0_1 + m13;
+        out[i].e[1] = m21 * v0_0 + m22 * v0_1 + m23;
+        const unsigned int v1_0 = in[i + 1].e[0];
+        const unsigned int v1_1 = in[i + 1].e[1];
+        out[i + 1].e[0] = m11 * v1_0 + m12 * v1_1 + m13;
+        out[i + 1].e[1] = m21 * v1_0 + m22 * v1_1 + m23;
+        const unsigned int v2_0 = in[i + 2].e[0];
+        const unsigned int v2_1 = in[i + 2].e[1];
+        out[i + 2].e[0] = m11 * v2_0 + m12 * v2_1 + m13;
+        out[i + 2].e[1] = m21 * v2_0 + m22 * v2_1 + m23;
+        const unsigned int v3_0 = in[i + 3].e[0];
+        const unsigned int v3_1 = in[i + 3].e[1];
+        out[i + 3].e[0] = m11 * v3_0 + m12 * v3_1 + m13;
+        out[i + 3].e[1] = m21 * v3_0 + m22 * v3_1 + m23;
+    }
+    for (; i < n; ++i) {
+        const unsigned int v0_0 = in[i].e[0];
+        const unsigned int v0_1 = in[i].e[1];
+        out[i].e[0] = m11 * v0_0 + m12 * v0_1 + m13;
+        out[i].e[1] = m21 * v0_0 + m22 * v0_1 + m23;
+    }
+}
+
+LINALG_DEF mat3x4f_t mat3x4f_mul_affine(mat3x4f_t A, mat3x4f_t B) {
+    mat3x4f_t result;
+#ifdef LINALG_SIMD
+    result.v[0].m = _mm_set_ps(A._14, 0, 0, 0);
+    result.v[0].m = linalg_madd_ps(_mm_set1_ps(A._11), B.v[0].m, result.v[0].m);
+    result.v[0].m = linalg_madd_ps(_mm_set1_ps(A._12), B.v[1].m, result.v[0].m);
+    result.v[0].m = linalg_madd_ps(_mm_set1_ps(A._13), B.v[2].m, result.v[0].m);
+    result.v[1].m = _mm_set_ps(A._24, 0, 0, 0);
+    result.v[1].m = linalg_madd_ps(_mm_set1_ps(A._21), B.v[0].m, result.v[1].m);
+    result.v[1].m = linalg_madd_ps(_mm_set1_ps(A._22), B.v[1].m, result.v[1].m);
+    result.v[1].m = linalg_madd_ps(_mm_set1_ps(A._23), B.v[2].m, result.v[1].m);
+    result.v[2].m = _mm_set_ps(A._34, 0, 0, 0);
+    result.v[2].m = linalg_madd_ps(_mm_set1_ps(A._31), B.v[0].m, result.v[2].m);
+    result.v[2].m = linalg_madd_ps(_mm_set1_ps(A._32), B.v[1].m, result.v[2].m);
+    result.v[2].m = linalg_madd_ps(_mm_set1_ps(A._33), B.v[2].m, result.v[2].m);
+#else
+    result._11 = A._11 * B._11 + A._12 * B._21 + A._13 * B._31;
+    result._12 = A._11 * B._12 + A._12 * B._22 + A._13 * B._32;
+    result._13 = A._11 * B._13 + A._12 * B._23 + A._13 * B._33;
+    result._14 = A._11 * B._14 + A._12 * B._24 + A._13 * B._34 + A._14;
+    result._21 = A._21 * B._11 + A._22 * B._21 + A._23 * B._31;
+    result._22 = A._21 * B._12 + A._22 * B._22 + A._23 * B._32;
+    result._23 = A._21 * B._13 + A._22 * B._23 + A._23 * B._33;
+    result._24 = A._21 * B._14 + A._22 * B._24 + A._23 * B._34 + A._24;
+    result._31 = A._31 * B._11 + A._32 * B._21 + A._33 * B._31;
+    result._32 = A._31 * B._12 + A._32 * B._22 + A._33 * B._32;
+    result._33 = A._31 * B._13 + A._32 * B._23 + A._33 * B._33;
+    result._34 = A._31 * B._14 + A._32 * B._24 + A._33 * B._34 + A._34;
+#endif // LINALG_SIMD
+    return result;
+}
+
+LINALG_DEF void mat3x4f_transform_affine_array(const mat3x4f_t *M,
+                                               const vec3f_t *restrict in,
+                                               vec3f_t *restrict out,
+                                               size_t n) {
+#ifdef LINALG_SIMD
+    __m128 c0 = M->v[0].m;
+    __m128 c1 = M->v[1].m;
+    __m128 c2 = M->v[2].m;
+    __m128 c3 = _mm_setzero_ps();
+    _MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+    size_t i = 0;
+    for (; i + 4 < n; i += 4) {
+        __m128 r0 = c3;
+        r0 = linalg_madd_ps(c0, _mm_set1_ps(in[i].e[0]), r0);
+        r0 = linalg_madd_ps(c1, _mm_set1_ps(in[i].e[1]), r0);
+        r0 = linalg_madd_ps(c2, _mm_set1_ps(in[i].e[2]), r0);
+        __m128 r1 = c3;
+        r1 = linalg_madd_ps(c0, _mm_set1_ps(in[i + 1].e[0]), r1);
+        r1 = linalg_madd_ps(c1, _mm_set1_ps(in[i + 1].e[1]), r1);
+        r1 = linalg_madd_ps(c2, _mm_set1_ps(in[i + 1].e[2]), r1);
+        __m128 r2 = c3;
+        r2 = linalg_madd_ps(c0, _mm_set1_ps(in[i + 2].e[0]), r2);
+        r2 = linalg_madd_ps(c1, _mm_set1_ps(in[i + 2].e[1]), r2);
+        r2 = linalg_madd_ps(c2, _mm_set1_ps(in[i + 2].e[2]), r2);
+        __m128 r3 = c3;
+        r3 = linalg_madd_ps(c0, _mm_set1_ps(in[i + 3].e[0]), r3);
+        r3 = linalg_madd_ps(c1, _mm_set1_ps(in[i + 3].e[1]), r3);
+        r3 = linalg_madd_ps(c2, _mm_set1_ps(in[i + 3].e[2]), r3);
+        _mm_storeu_ps(out[i].e, r0);
+        _mm_storeu_ps(out[i + 1].e, r1);
+        _mm_storeu_ps(out[i + 2].e, r2);
+        _mm_storeu_ps(out[i + 3].e, r3);
+    }
+    for (; i < n; ++i) {
+        out[i] = mat3x4f_transform_affine(*M, in[i]);
+    }
+#else
+    const float m11 = M->_11;
+    const float m12 = M->_12;
+    const float m13 = M->_13;
+    const float m14 = M->_14;
+    const float m21 = M->_21;
+    const float m22 = M->_22;
+    const float m23 = M->_23;
+    const float m24 = M->_24;
+    const float m31 = M->_31;
+    const float m32 = M->_32;
+    const float m33 = M->_33;
+    const float m34 = M->_34;
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        const float v0_0 = in[i].e[0];
+        const float v0_1 = in[i].e[1];
+        const float v0_2 = in[i].e[2];
+        out[i].e[0] = m11 * v0_0 + m12 * v0_1 + m13 * v0_2 + m14;
+        out[i].e[1] = m21 * v0_0 + m22 * v0_1 + m23 * v0_2 + m24;
+        out[i].e[2] = m31 * v0_0 + m32 * v0_1 + m33 * v0_2 + m34;
+        const float v1_0 = in[i + 1].e[0];
+        const float v1_1 = in[i + 1].e[1];
+        const float v1_2 = in[i + 1].e[2];
+        out[i + 1].e[0] = m11 * v1_0 + m12 * v1_1 + m13 * v1_2 + m14;
+        out[i + 1].e[1] = m21 * v1_0 + m22 * v1_1 + m23 * v1_2 + m24;
+        out[i + 1].e[2] = m31 * v1_0 + m32 * v1_1 + m33 * v1_2 + m34;
+        const float v2_0 = in[i + 2].e[0];
+        const float v2_1 = in[i + 2].e[1];
+        const float v2_2 = in[i + 2].e[2];
+        out[i + 2].e[0] = m11 * v2_0 + m12 * v2_1 + m13 * v2_2 + m14;
+        out[i + 2].e[1] = m21 * v2_0 + m22 * v2_1 + m23 * v2_2 + m24;
+        out[i + 2].e[2] = m31 * v2_0 + m32 * v2_1 + m33 * v2_2 + m34;
+        const float v3_0 = in[i + 3].e[0];
+        const float v3_1 = in[i + 3].e[1];
+        const float v3_2 = in[i + 3].e[2];
+        out[i + 3].e[0] = m11 * v3_0 + m12 * v3_1 + m13 * v3_2 + m14;
+        out[i + 3].e[1] = m21 * v3_0 + m22 * v3_1 + m23 * v3_2 + m24;
+        out[i + 3].e[2] = m31 * v3_0 + m32 * v3_1 + m33 * v3_2 + m34;
+    }
+    for (; i < n; ++i) {
+        const float v0_0 = in[i].e[0];
+        const float v0_1 = in[i].e[1];
+        const float v0_2 = in[i].e[2];
+        out[i].e[0] = m11 * v0_0 + m12 * v0_1 + m13 * v0_2 + m14;
+        out[i].e[1] = m21 * v0_0 + m22 * v0_1 + m23 * v0_2 + m24;
+        out[i].e[2] = m31 * v0_0 + m32 * v0_1 + m33 * v0_2 + m34;
+    }
+#endif // LINALG_SIMD
+}
+
+LINALG_DEF void mat3x4d_transform_affine_array(const mat3x4d_t *M,
+                                               const vec3d_t *restrict in,
+                                               vec3d_t *restrict out,
+                                               size_t n) {
+    const double m11 = M->_11;
+    const double m12 = M->_12;
+    const double m13 = M->_13;
+    const double m14 = M->_14;
+    const double m21 = M->_21;
+    const double m22 = M->_22;
+    const double m23 = M->_23;
+    const double m24 = M->_24;
+    const double m31 = M->_31;
+    const double m32 = M->_32;
+    const double m33 = M->_33;
+    const double m34 = M->_34;
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        const double v0_0 = in[i].e[0];
+        const double v0_1 = in[i].e[1];
+        const double v0_2 = in[i].e[2];
+        out[i].e[0] = m11 * v0_0 + m12 * v0_1 + m13 * v0_2 + m14;
+        out[i].e[1] = m21 * v0_0 + m22 * v0_1 + m23 * v0_2 + m24;
+        out[i].e[2] = m31 * v0_0 + m32 * v0_1 + m33 * v0_2 + m34;
+        const double v1_0 = in[i + 1].e[0];
+        const double v1_1 = in[i + 1].e[1];
+        const double v1_2 = in[i + 1].e[2];
+        out[i + 1].e[0] = m11 * v1_0 + m12 * v1_1 + m13 * v1_2 + m14;
+        out[i + 1].e[1] = m21 * v1_0 + m22 * v1_1 + m23 * v1_2 + m24;
+        out[i + 1].e[2] = m31 * v1_0 + m32 * v1_1 + m33 * v1_2 + m34;
+        const double v2_0 = in[i + 2].e[0];
+        const double v2_1 = in[i + 2].e[1];
+        const double v2_2 = in[i + 2].e[2];
+        out[i + 2].e[0] = m11 * v2_0 + m12 * v2_1 + m13 * v2_2 + m14;
+        out[i + 2].e[1] = m21 * v2_0 + m22 * v2_1 + m23 * v2_2 + m24;
+        out[i + 2].e[2] = m31 * v2_0 + m32 * v2_1 + m33 * v2_2 + m34;
+        const double v3_0 = in[i + 3].e[0];
+        const double v3_1 = in[i + 3].e[1];
+        const double v3_2 = in[i + 3].e[2];
+        out[i + 3].e[0] = m11 * v3_0 + m12 * v3_1 + m13 * v3_2 + m14;
+        out[i + 3].e[1] = m21 * v3_0 + m22 * v3_1 + m23 * v3_2 + m24;
+        out[i + 3].e[2] = m31 * v3_0 + m32 * v3_1 + m33 * v3_2 + m34;
+    }
+    for (; i < n; ++i) {
+        const double v0_0 = in[i].e[0];
+        const double v0_1 = in[i].e[1];
+        const double v0_2 = in[i].e[2];
+        out[i].e[0] = m11 * v0_0 + m12 * v0_1 + m13 * v0_2 + m14;
+        out[i].e[1] = m21 * v0_0 + m22 * v0_1 + m23 * v0_2 + m24;
+        out[i].e[2] = m31 * v0_0 + m32 * v0_1 + m33 * v0_2 + m34;
+    }
+}
+
+LINALG_DEF void mat3x4i_transform_affine_array(const mat3x4i_t *M,
+                                               const vec3i_t *restrict in,
+                                               vec3i_t *restrict out,
+                                               size_t n) {
+    const int m11 = M->_11;
+    const int m12 = M->_12;
+    const int m13 = M->_13;
+    const int m14 = M->_14;
+    const int m21 = M->_21;
+    const int m22 = M->_22;
+    const int m23 = M->_23;
+    const int m24 = M->_24;
+    const int m31 = M->_31;
+    const int m32 = M->_32;
+    const int m33 = M->_33;
+    const int m34 = M->_34;
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        const int v0_0 = in[i].e[0];
+        const int v0_1 = in[i].e[1];
+        const int v0_2 = in[i].e[2];
+        out[i].e[0] = m11 * v0_0 + m12 * v0_1 + m13 * v0_2 + m14;
+        out[i].e[1] = m21 * v0_0 + m22 * v0_1 + m23 * v0_2 + m24;
+        out[i].e[2] = m31 * v0_0 + m32 * v0_1 + m33 * v0_2 + m34;
+        const int v1_0 = in[i + 1].e[0];
+        const int v1_1 = in[i + 1].e[1];
+        const int v1_2 = in[i + 1].e[2];
+        out[i + 1].e[0] = m11 * v1_0 + m12 * v1_1 + m13 * v1_2 + m14;
+        out[i + 1].e[1] = m21 * v1_0 + m22 * v1_1 + m23 * v1_2 + m24;
+        out[i + 1].e[2] = m31 * v1_0 + m32 * v1_1 + m33 * v1_2 + m34;
+        const int v2_0 = in[i + 2].e[0];
+        const int v2_1 = in[i + 2].e[1];
+        const int v2_2 = in[i + 2].e[2];
+        out[i + 2].e[0] = m11 * v2_0 + m12 * v2_1 + m13 * v2_2 + m14;
+        out[i + 2].e[1] = m21 * v2_0 + m22 * v2_1 + m23 * v2_2 + m24;
+        out[i + 2].e[2] = m31 * v2_0 + m32 * v2_1 + m33 * v2_2 + m34;
+        const int v3_0 = in[i + 3].e[0];
+        const int v3_1 = in[i + 3].e[1];
+        const int v3_2 = in[i + 3].e[2];
+        out[i + 3].e[0] = m11 * v3_0 + m12 * v3_1 + m13 * v3_2 + m14;
+        out[i + 3].e[1] = m21 * v3_0 + m22 * v3_1 + m23 * v3_2 + m24;
+        out[i + 3].e[2] = m31 * v3_0 + m32 * v3_1 + m33 * v3_2 + m34;
+    }
+    for (; i < n; ++i) {
+        const int v0_0 = in[i].e[0];
+        const int v0_1 = in[i].e[1];
+        const int v0_2 = in[i].e[2];
+        out[i].e[0] = m11 * v0_0 + m12 * v0_1 + m13 * v0_2 + m14;
+        out[i].e[1] = m21 * v0_0 + m22 * v0_1 + m23 * v0_2 + m24;
+        out[i].e[2] = m31 * v0_0 + m32 * v0_1 + m33 * v0_2 + m34;
+    }
+}
+
+LINALG_DEF void mat3x4u_transform_affine_array(const mat3x4u_t *M,
+                                               const vec3u_t *restrict in,
+                                               vec3u_t *restrict out,
+                                               size_t n) {
+    const unsigned int m11 = M->_11;
+    const unsigned int m12 = M->_12;
+    const unsigned int m13 = M->_13;
+    const unsigned int m14 = M->_14;
+    const unsigned int m21 = M->_21;
+    const unsigned int m22 = M->_22;
+    const unsigned int m23 = M->_23;
+    const unsigned int m24 = M->_24;
+    const unsigned int m31 = M->_31;
+    const unsigned int m32 = M->_32;
+    const unsigned int m33 = M->_33;
+    const unsigned int m34 = M->_34;
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        const unsigned int v0_0 = in[i].e[0];
+        const unsigned int v0_1 = in[i].e[1];
+        const unsigned int v0_2 = in[i].e[2];
+        out[i].e[0] = m11 * v0_0 + m12 * v0_1 + m13 * v0_2 + m14;
+        out[i].e[1] = m21 * v0_0 + m22 * v0_1 + m23 * v0_2 + m24;
+        out[i].e[2] = m31 * v0_0 + m32 * v0_1 + m33 * v0_2 + m34;
+        const unsigned int v1_0 = in[i + 1].e[0];
+        const unsigned int v1_1 = in[i + 1].e[1];
+        const unsigned int v1_2 = in[i + 1].e[2];
+        out[i + 1].e[0] = m11 * v1_0 + m12 * v1_1 + m13 * v1_2 + m14;
+        out[i + 1].e[1] = m21 * v1_0 + m22 * v1_1 + m23 * v1_2 + m24;
+        out[i + 1].e[2] = m31 * v1_0 + m32 * v1_1 + m33 * v1_2 + m34;
+        const unsigned int v2_0 = in[i + 2].e[0];
+        const unsigned int v2_1 = in[i + 2].e[1];
+        const unsigned int v2_2 = in[i + 2].e[2];
+        out[i + 2].e[0] = m11 * v2_0 + m12 * v2_1 + m13 * v2_2 + m14;
+        out[i + 2].e[1] = m21 * v2_0 + m22 * v2_1 + m23 * v2_2 + m24;
+        out[i + 2].e[2] = m31 * v2_0 + m32 * v2_1 + m33 * v2_2 + m34;
+        const unsigned int v3_0 = in[i + 3].e[0];
+        const unsigned int v3_1 = in[i + 3].e[1];
+        const unsigned int v3_2 = in[i + 3].e[2];
+        out[i + 3].e[0] = m11 * v3_0 + m12 * v3_1 + m13 * v3_2 + m14;
+        out[i + 3].e[1] = m21 * v3_0 + m22 * v3_1 + m23 * v3_2 + m24;
+        out[i + 3].e[2] = m31 * v3_0 + m32 * v3_1 + m33 * v3_2 + m34;
+    }
+    for (; i < n; ++i) {
+        const unsigned int v0_0 = in[i].e[0];
+        const unsigned int v0_1 = in[i].e[1];
+        const unsigned int v0_2 = in[i].e[2];
+        out[i].e[0] = m11 * v0_0 + m12 * v0_1 + m13 * v0_2 + m14;
+        out[i].e[1] = m21 * v0_0 + m22 * v0_1 + m23 * v0_2 + m24;
+        out[i].e[2] = m31 * v0_0 + m32 * v0_1 + m33 * v0_2 + m34;
+    }
+}
+
+LINALG_DEF quatf_t quatf_nlerp(quatf_t a, quatf_t b, float t) {
+    float wb = vec4f_dot(a.v, b.v) < 0 ? -t : t;
+    quatf_t q;
+    for (size_t i = 0; i < 4; ++i) {
+        q.e[i] = (1 - t) * a.e[i] + wb * b.e[i];
+    }
+    return quatf_normalize(q);
+}
+
+LINALG_DEF quatf_t quatf_slerp(quatf_t a, quatf_t b, float t) {
+    float cos_theta = vec4f_dot(a.v, b.v);
+    float sign = 1;
+    if (cos_theta < 0) {
+        cos_theta = -cos_theta;
+        sign = -1;
+    }
+    if (cos_theta > 0.9995f) {
+        return quatf_nlerp(a, b, t);
+    }
+    float theta = acosf(cos_theta);
+    float inv_sin_theta = 1 / sinf(theta);
+    float wa = sinf((1 - t) * theta) * inv_sin_theta;
+    float wb = sign * sinf(t * theta) * inv_sin_theta;
+    quatf_t q;
+    for (size_t i = 0; i < 4; ++i) {
+        q.e[i] = wa * a.e[i] + wb * b.e[i];
+    }
+    return q;
+}
+
+LINALG_DEF quatd_t quatd_nlerp(quatd_t a, quatd_t b, double t) {
+    double wb = vec4d_dot(a.v, b.v) < 0 ? -t : t;
+    quatd_t q;
+    for (size_t i = 0; i < 4; ++i) {
+        q.e[i] = (1 - t) * a.e[i] + wb * b.e[i];
+    }
+    return quatd_normalize(q);
+}
+
+LINALG_DEF quatd_t quatd_slerp(quatd_t a, quatd_t b, double t) {
+    double cos_theta = vec4d_dot(a.v, b.v);
+    double sign = 1;
+    if (cos_theta < 0) {
+        cos_theta = -cos_theta;
+        sign = -1;
+    }
+    if (cos_theta > 0.9995) {
+        return quatd_nlerp(a, b, t);
+    }
+    double theta = acos(cos_theta);
+    double inv_sin_theta = 1 / sin(theta);
+    double wa = sin((1 - t) * theta) * inv_sin_theta;
+    double wb = sign * sin(t * theta) * inv_sin_theta;
+    quatd_t q;
+    for (size_t i = 0; i < 4; ++i) {
+        q.e[i] = wa * a.e[i] + wb * b.e[i];
+    }
+    return q;
+}
+
+LINALG_DEF void vec2f_soa_from_aos(vec2f_soa_t out,
+                                   const vec2f_t *restrict in) {
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = in[i].e[0];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = in[i].e[1];
+    }
+}
+
+LINALG_DEF void vec2f_soa_to_aos(vec2f_t *restrict out, vec2f_soa_t in) {
+    for (size_t i = 0; i < in.n; ++i) {
+        out[i].e[0] = in.x[i];
+    }
+    for (size_t i = 0; i < in.n; ++i) {
+        out[i].e[1] = in.y[i];
+    }
+}
+
+LINALG_DEF void vec2f_soa_add(vec2f_soa_t out, vec2f_soa_t a, vec2f_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = a.x[i] + b.x[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = a.y[i] + b.y[i];
+    }
+}
+
+LINALG_DEF void vec2f_soa_sub(vec2f_soa_t out, vec2f_soa_t a, vec2f_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = a.x[i] - b.x[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = a.y[i] - b.y[i];
+    }
+}
+
+LINALG_DEF void vec2f_soa_mul(vec2f_soa_t out, vec2f_soa_t a, vec2f_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = a.x[i] * b.x[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = a.y[i] * b.y[i];
+    }
+}
+
+LINALG_DEF void vec2f_soa_div(vec2f_soa_t out, vec2f_soa_t a, vec2f_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = a.x[i] / b.x[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = a.y[i] / b.y[i];
+    }
+}
+
+LINALG_DEF void vec2f_soa_mod(vec2f_soa_t out, vec2f_soa_t a, vec2f_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = fmodf(a.x[i], b.x[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = fmodf(a.y[i], b.y[i]);
+    }
+}
+
+LINALG_DEF void vec2f_soa_min(vec2f_soa_t out, vec2f_soa_t a, vec2f_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = minf(a.x[i], b.x[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = minf(a.y[i], b.y[i]);
+    }
+}
+
+LINALG_DEF void vec2f_soa_max(vec2f_soa_t out, vec2f_soa_t a, vec2f_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = maxf(a.x[i], b.x[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = maxf(a.y[i], b.y[i]);
+    }
+}
+
+LINALG_DEF void vec2f_soa_floor(vec2f_soa_t out, vec2f_soa_t v) {
+    assert(v.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = floorf(v.x[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = floorf(v.y[i]);
+    }
+}
+
+LINALG_DEF void vec2f_soa_ceil(vec2f_soa_t out, vec2f_soa_t v) {
+    assert(v.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = ceilf(v.x[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = ceilf(v.y[i]);
+    }
+}
+
+LINALG_DEF void vec2f_soa_clamp(vec2f_soa_t out, vec2f_soa_t v, vec2f_soa_t min,
+                                vec2f_soa_t max) {
+    assert(v.n == out.n && min.n == out.n && max.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = clampf(v.x[i], min.x[i], max.x[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = clampf(v.y[i], min.y[i], max.y[i]);
+    }
+}
+
+LINALG_DEF void vec2f_soa_abs(vec2f_soa_t out, vec2f_soa_t v) {
+    assert(v.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = fabsf(v.x[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = fabsf(v.y[i]);
+    }
+}
+
+LINALG_DEF void vec2f_soa_lerp(vec2f_soa_t out, vec2f_soa_t a, vec2f_soa_t b,
+                               vec2f_soa_t t) {
+    assert(a.n == out.n && b.n == out.n && t.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = lerpf(a.x[i], b.x[i], t.x[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = lerpf(a.y[i], b.y[i], t.y[i]);
+    }
+}
+
+LINALG_DEF void vec2f_soa_dot(float *out, vec2f_soa_t a, vec2f_soa_t b) {
+    assert(a.n == b.n);
+    for (size_t i = 0; i < a.n; ++i) {
+        out[i] = a.x[i] * b.x[i] + a.y[i] * b.y[i];
+    }
+}
+
+LINALG_DEF void vec2f_soa_2norm(float *out, vec2f_soa_t v) {
+    for (size_t i = 0; i < v.n; ++i) {
+        out[i] = sqrtf(v.x[i] * v.x[i] + v.y[i] * v.y[i]);
+    }
+}
+
+LINALG_DEF void vec2f_soa_unit(vec2f_soa_t out, vec2f_soa_t v) {
+    assert(v.n == out.n);
+    for (size_t i = 0; i < v.n; ++i) {
+        float len = sqrtf(v.x[i] * v.x[i] + v.y[i] * v.y[i]);
+        out.x[i] = v.x[i] / len;
+        out.y[i] = v.y[i] / len;
+    }
+}
+
+LINALG_DEF void mat2f_mul_vec_soa(vec2f_soa_t out, mat2f_t M, vec2f_soa_t v) {
+    assert(v.n == out.n);
+    const float m11 = M._11;
+    const float m12 = M._12;
+    const float m21 = M._21;
+    const float m22 = M._22;
+    for (size_t i = 0; i < v.n; ++i) {
+        const float x = v.x[i];
+        const float y = v.y[i];
+        out.x[i] = m11 * x + m12 * y;
+        out.y[i] = m21 * x + m22 * y;
+    }
+}
+
+LINALG_DEF void vec2d_soa_from_aos(vec2d_soa_t out,
+                                   const vec2d_t *restrict in) {
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = in[i].e[0];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = in[i].e[1];
+    }
+}
+
+LINALG_DEF void vec2d_soa_to_aos(vec2d_t *restrict out, vec2d_soa_t in) {
+    for (size_t i = 0; i < in.n; ++i) {
+        out[i].e[0] = in.x[i];
+    }
+    for (size_t i = 0; i < in.n; ++i) {
+        out[i].e[1] = in.y[i];
+    }
+}
+
+LINALG_DEF void vec2d_soa_add(vec2d_soa_t out, vec2d_soa_t a, vec2d_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = a.x[i] + b.x[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = a.y[i] + b.y[i];
+    }
+}
+
+LINALG_DEF void vec2d_soa_sub(vec2d_soa_t out, vec2d_soa_t a, vec2d_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = a.x[i] - b.x[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = a.y[i] - b.y[i];
+    }
+}
+
+LINALG_DEF void vec2d_soa_mul(vec2d_soa_t out, vec2d_soa_t a, vec2d_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = a.x[i] * b.x[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = a.y[i] * b.y[i];
+    }
+}
+
+LINALG_DEF void vec2d_soa_div(vec2d_soa_t out, vec2d_soa_t a, vec2d_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = a.x[i] / b.x[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = a.y[i] / b.y[i];
+    }
+}
+
+LINALG_DEF void vec2d_soa_mod(vec2d_soa_t out, vec2d_soa_t a, vec2d_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = fmod(a.x[i], b.x[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = fmod(a.y[i], b.y[i]);
+    }
+}
+
+LINALG_DEF void vec2d_soa_min(vec2d_soa_t out, vec2d_soa_t a, vec2d_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = mind(a.x[i], b.x[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = mind(a.y[i], b.y[i]);
+    }
+}
+
+LINALG_DEF void vec2d_soa_max(vec2d_soa_t out, vec2d_soa_t a, vec2d_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = maxd(a.x[i], b.x[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = maxd(a.y[i], b.y[i]);
+    }
+}
+
+LINALG_DEF void vec2d_soa_floor(vec2d_soa_t out, vec2d_soa_t v) {
+    assert(v.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = floor(v.x[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = floor(v.y[i]);
+    }
+}
+
+LINALG_DEF void vec2d_soa_ceil(vec2d_soa_t out, vec2d_soa_t v) {
+    assert(v.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = ceil(v.x[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = ceil(v.y[i]);
+    }
+}
+
+LINALG_DEF void vec2d_soa_clamp(vec2d_soa_t out, vec2d_soa_t v, vec2d_soa_t min,
+                                vec2d_soa_t max) {
+    assert(v.n == out.n && min.n == out.n && max.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = clampd(v.x[i], min.x[i], max.x[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = clampd(v.y[i], min.y[i], max.y[i]);
+    }
+}
+
+LINALG_DEF void vec2d_soa_abs(vec2d_soa_t out, vec2d_soa_t v) {
+    assert(v.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = fabs(v.x[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = fabs(v.y[i]);
+    }
+}
+
+LINALG_DEF void vec2d_soa_lerp(vec2d_soa_t out, vec2d_soa_t a, vec2d_soa_t b,
+                               vec2d_soa_t t) {
+    assert(a.n == out.n && b.n == out.n && t.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = lerpd(a.x[i], b.x[i], t.x[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = lerpd(a.y[i], b.y[i], t.y[i]);
+    }
+}
+
+LINALG_DEF void vec2d_soa_dot(double *out, vec2d_soa_t a, vec2d_soa_t b) {
+    assert(a.n == b.n);
+    for (size_t i = 0; i < a.n; ++i) {
+        out[i] = a.x[i] * b.x[i] + a.y[i] * b.y[i];
+    }
+}
+
+LINALG_DEF void vec2d_soa_2norm(double *out, vec2d_soa_t v) {
+    for (size_t i = 0; i < v.n; ++i) {
+        out[i] = sqrt(v.x[i] * v.x[i] + v.y[i] * v.y[i]);
+    }
+}
+
+LINALG_DEF void vec2d_soa_unit(vec2d_soa_t out, vec2d_soa_t v) {
+    assert(v.n == out.n);
+    for (size_t i = 0; i < v.n; ++i) {
+        double len = sqrt(v.x[i] * v.x[i] + v.y[i] * v.y[i]);
+        out.x[i] = v.x[i] / len;
+        out.y[i] = v.y[i] / len;
+    }
+}
+
+LINALG_DEF void mat2d_mul_vec_soa(vec2d_soa_t out, mat2d_t M, vec2d_soa_t v) {
+    assert(v.n == out.n);
+    const double m11 = M._11;
+    const double m12 = M._12;
+    const double m21 = M._21;
+    const double m22 = M._22;
+    for (size_t i = 0; i < v.n; ++i) {
+        const double x = v.x[i];
+        const double y = v.y[i];
+        out.x[i] = m11 * x + m12 * y;
+        out.y[i] = m21 * x + m22 * y;
+    }
+}
+
+LINALG_DEF void vec2i_soa_from_aos(vec2i_soa_t out,
+                                   const vec2i_t *restrict in) {
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = in[i].e[0];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = in[i].e[1];
+    }
+}
+
+LINALG_DEF void vec2i_soa_to_aos(vec2i_t *restrict out, vec2i_soa_t in) {
+    for (size_t i = 0; i < in.n; ++i) {
+        out[i].e[0] = in.x[i];
+    }
+    for (size_t i = 0; i < in.n; ++i) {
+        out[i].e[1] = in.y[i];
+    }
+}
+
+LINALG_DEF void vec2i_soa_add(vec2i_soa_t out, vec2i_soa_t a, vec2i_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = a.x[i] + b.x[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = a.y[i] + b.y[i];
+    }
+}
+
+LINALG_DEF void vec2i_soa_sub(vec2i_soa_t out, vec2i_soa_t a, vec2i_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = a.x[i] - b.x[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = a.y[i] - b.y[i];
+    }
+}
+
+LINALG_DEF void vec2i_soa_mul(vec2i_soa_t out, vec2i_soa_t a, vec2i_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = a.x[i] * b.x[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = a.y[i] * b.y[i];
+    }
+}
+
+LINALG_DEF void vec2i_soa_div(vec2i_soa_t out, vec2i_soa_t a, vec2i_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = a.x[i] / b.x[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = a.y[i] / b.y[i];
+    }
+}
+
+LINALG_DEF void vec2i_soa_mod(vec2i_soa_t out, vec2i_soa_t a, vec2i_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = a.x[i] % b.x[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = a.y[i] % b.y[i];
+    }
+}
+
+LINALG_DEF void vec2i_soa_min(vec2i_soa_t out, vec2i_soa_t a, vec2i_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = mini(a.x[i], b.x[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = mini(a.y[i], b.y[i]);
+    }
+}
+
+LINALG_DEF void vec2i_soa_max(vec2i_soa_t out, vec2i_soa_t a, vec2i_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = maxi(a.x[i], b.x[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = maxi(a.y[i], b.y[i]);
+    }
+}
+
+LINALG_DEF void vec2i_soa_clamp(vec2i_soa_t out, vec2i_soa_t v, vec2i_soa_t min,
+                                vec2i_soa_t max) {
+    assert(v.n == out.n && min.n == out.n && max.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = clampi(v.x[i], min.x[i], max.x[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = clampi(v.y[i], min.y[i], max.y[i]);
+    }
+}
+
+LINALG_DEF void vec2i_soa_abs(vec2i_soa_t out, vec2i_soa_t v) {
+    assert(v.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = absi(v.x[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = absi(v.y[i]);
+    }
+}
+
+LINALG_DEF void vec2i_soa_dot(int *out, vec2i_soa_t a, vec2i_soa_t b) {
+    assert(a.n == b.n);
+    for (size_t i = 0; i < a.n; ++i) {
+        out[i] = a.x[i] * b.x[i] + a.y[i] * b.y[i];
+    }
+}
+
+LINALG_DEF void mat2i_mul_vec_soa(vec2i_soa_t out, mat2i_t M, vec2i_soa_t v) {
+    assert(v.n == out.n);
+    const int m11 = M._11;
+    const int m12 = M._12;
+    const int m21 = M._21;
+    const int m22 = M._22;
+    for (size_t i = 0; i < v.n; ++i) {
+        const int x = v.x[i];
+        const int y = v.y[i];
+        out.x[i] = m11 * x + m12 * y;
+        out.y[i] = m21 * x + m22 * y;
+    }
+}
+
+LINALG_DEF void vec2u_soa_from_aos(vec2u_soa_t out,
+                                   const vec2u_t *restrict in) {
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = in[i].e[0];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = in[i].e[1];
+    }
+}
+
+LINALG_DEF void vec2u_soa_to_aos(vec2u_t *restrict out, vec2u_soa_t in) {
+    for (size_t i = 0; i < in.n; ++i) {
+        out[i].e[0] = in.x[i];
+    }
+    for (size_t i = 0; i < in.n; ++i) {
+        out[i].e[1] = in.y[i];
+    }
+}
+
+LINALG_DEF void vec2u_soa_add(vec2u_soa_t out, vec2u_soa_t a, vec2u_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = a.x[i] + b.x[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = a.y[i] + b.y[i];
+    }
+}
+
+LINALG_DEF void vec2u_soa_sub(vec2u_soa_t out, vec2u_soa_t a, vec2u_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = a.x[i] - b.x[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = a.y[i] - b.y[i];
+    }
+}
+
+LINALG_DEF void vec2u_soa_mul(vec2u_soa_t out, vec2u_soa_t a, vec2u_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = a.x[i] * b.x[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = a.y[i] * b.y[i];
+    }
+}
+
+LINALG_DEF void vec2u_soa_div(vec2u_soa_t out, vec2u_soa_t a, vec2u_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = a.x[i] / b.x[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = a.y[i] / b.y[i];
+    }
+}
+
+LINALG_DEF void vec2u_soa_mod(vec2u_soa_t out, vec2u_soa_t a, vec2u_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = a.x[i] % b.x[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = a.y[i] % b.y[i];
+    }
+}
+
+LINALG_DEF void vec2u_soa_min(vec2u_soa_t out, vec2u_soa_t a, vec2u_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = minu(a.x[i], b.x[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = minu(a.y[i], b.y[i]);
+    }
+}
+
+LINALG_DEF void vec2u_soa_max(vec2u_soa_t out, vec2u_soa_t a, vec2u_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = maxu(a.x[i], b.x[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = maxu(a.y[i], b.y[i]);
+    }
+}
+
+LINALG_DEF void vec2u_soa_clamp(vec2u_soa_t out, vec2u_soa_t v, vec2u_soa_t min,
+                                vec2u_soa_t max) {
+    assert(v.n == out.n && min.n == out.n && max.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = clampu(v.x[i], min.x[i], max.x[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = clampu(v.y[i], min.y[i], max.y[i]);
+    }
+}
+
+LINALG_DEF void vec2u_soa_dot(unsigned int *out, vec2u_soa_t a, vec2u_soa_t b) {
+    assert(a.n == b.n);
+    for (size_t i = 0; i < a.n; ++i) {
+        out[i] = a.x[i] * b.x[i] + a.y[i] * b.y[i];
+    }
+}
+
+LINALG_DEF void mat2u_mul_vec_soa(vec2u_soa_t out, mat2u_t M, vec2u_soa_t v) {
+    assert(v.n == out.n);
+    const unsigned int m11 = M._11;
+    const unsigned int m12 = M._12;
+    const unsigned int m21 = M._21;
+    const unsigned int m22 = M._22;
+    for (size_t i = 0; i < v.n; ++i) {
+        const unsigned int x = v.x[i];
+        const unsigned int y = v.y[i];
+        out.x[i] = m11 * x + m12 * y;
+        out.y[i] = m21 * x + m22 * y;
+    }
+}
+
+LINALG_DEF void vec3f_soa_from_aos(vec3f_soa_t out,
+                                   const vec3f_t *restrict in) {
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = in[i].e[0];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = in[i].e[1];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = in[i].e[2];
+    }
+}
+
+LINALG_DEF void vec3f_soa_to_aos(vec3f_t *restrict out, vec3f_soa_t in) {
+    for (size_t i = 0; i < in.n; ++i) {
+        out[i].e[0] = in.x[i];
+    }
+    for (size_t i = 0; i < in.n; ++i) {
+        out[i].e[1] = in.y[i];
+    }
+    for (size_t i = 0; i < in.n; ++i) {
+        out[i].e[2] = in.z[i];
+    }
+}
+
+LINALG_DEF void vec3f_soa_add(vec3f_soa_t out, vec3f_soa_t a, vec3f_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = a.x[i] + b.x[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = a.y[i] + b.y[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = a.z[i] + b.z[i];
+    }
+}
+
+LINALG_DEF void vec3f_soa_sub(vec3f_soa_t out, vec3f_soa_t a, vec3f_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = a.x[i] - b.x[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = a.y[i] - b.y[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = a.z[i] - b.z[i];
+    }
+}
+
+LINALG_DEF void vec3f_soa_mul(vec3f_soa_t out, vec3f_soa_t a, vec3f_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = a.x[i] * b.x[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = a.y[i] * b.y[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = a.z[i] * b.z[i];
+    }
+}
+
+LINALG_DEF void vec3f_soa_div(vec3f_soa_t out, vec3f_soa_t a, vec3f_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = a.x[i] / b.x[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = a.y[i] / b.y[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = a.z[i] / b.z[i];
+    }
+}
+
+LINALG_DEF void vec3f_soa_mod(vec3f_soa_t out, vec3f_soa_t a, vec3f_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = fmodf(a.x[i], b.x[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = fmodf(a.y[i], b.y[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = fmodf(a.z[i], b.z[i]);
+    }
+}
+
+LINALG_DEF void vec3f_soa_min(vec3f_soa_t out, vec3f_soa_t a, vec3f_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = minf(a.x[i], b.x[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = minf(a.y[i], b.y[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = minf(a.z[i], b.z[i]);
+    }
+}
+
+LINALG_DEF void vec3f_soa_max(vec3f_soa_t out, vec3f_soa_t a, vec3f_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = maxf(a.x[i], b.x[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = maxf(a.y[i], b.y[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = maxf(a.z[i], b.z[i]);
+    }
+}
+
+LINALG_DEF void vec3f_soa_floor(vec3f_soa_t out, vec3f_soa_t v) {
+    assert(v.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = floorf(v.x[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = floorf(v.y[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = floorf(v.z[i]);
+    }
+}
+
+LINALG_DEF void vec3f_soa_ceil(vec3f_soa_t out, vec3f_soa_t v) {
+    assert(v.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = ceilf(v.x[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = ceilf(v.y[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = ceilf(v.z[i]);
+    }
+}
+
+LINALG_DEF void vec3f_soa_clamp(vec3f_soa_t out, vec3f_soa_t v, vec3f_soa_t min,
+                                vec3f_soa_t max) {
+    assert(v.n == out.n && min.n == out.n && max.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = clampf(v.x[i], min.x[i], max.x[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = clampf(v.y[i], min.y[i], max.y[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = clampf(v.z[i], min.z[i], max.z[i]);
+    }
+}
+
+LINALG_DEF void vec3f_soa_abs(vec3f_soa_t out, vec3f_soa_t v) {
+    assert(v.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = fabsf(v.x[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = fabsf(v.y[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = fabsf(v.z[i]);
+    }
+}
+
+LINALG_DEF void vec3f_soa_lerp(vec3f_soa_t out, vec3f_soa_t a, vec3f_soa_t b,
+                               vec3f_soa_t t) {
+    assert(a.n == out.n && b.n == out.n && t.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = lerpf(a.x[i], b.x[i], t.x[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = lerpf(a.y[i], b.y[i], t.y[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = lerpf(a.z[i], b.z[i], t.z[i]);
+    }
+}
+
+LINALG_DEF void vec3f_soa_dot(float *out, vec3f_soa_t a, vec3f_soa_t b) {
+    assert(a.n == b.n);
+    for (size_t i = 0; i < a.n; ++i) {
+        out[i] = a.x[i] * b.x[i] + a.y[i] * b.y[i] + a.z[i] * b.z[i];
+    }
+}
+
+LINALG_DEF void vec3f_soa_2norm(float *out, vec3f_soa_t v) {
+    for (size_t i = 0; i < v.n; ++i) {
+        out[i] = sqrtf(v.x[i] * v.x[i] + v.y[i] * v.y[i] + v.z[i] * v.z[i]);
+    }
+}
+
+LINALG_DEF void vec3f_soa_unit(vec3f_soa_t out, vec3f_soa_t v) {
+    assert(v.n == out.n);
+    for (size_t i = 0; i < v.n; ++i) {
+        float len = sqrtf(v.x[i] * v.x[i] + v.y[i] * v.y[i] + v.z[i] * v.z[i]);
+        out.x[i] = v.x[i] / len;
+        out.y[i] = v.y[i] / len;
+        out.z[i] = v.z[i] / len;
+    }
+}
+
+LINALG_DEF void mat3f_mul_vec_soa(vec3f_soa_t out, mat3f_t M, vec3f_soa_t v) {
+    assert(v.n == out.n);
+    const float m11 = M._11;
+    const float m12 = M._12;
+    const float m13 = M._13;
+    const float m21 = M._21;
+    const float m22 = M._22;
+    const float m23 = M._23;
+    const float m31 = M._31;
+    const float m32 = M._32;
+    const float m33 = M._33;
+    for (size_t i = 0; i < v.n; ++i) {
+        const float x = v.x[i];
+        const float y = v.y[i];
+        const float z = v.z[i];
+        out.x[i] = m11 * x + m12 * y + m13 * z;
+        out.y[i] = m21 * x + m22 * y + m23 * z;
+        out.z[i] = m31 * x + m32 * y + m33 * z;
+    }
+}
+
+LINALG_DEF void vec3d_soa_from_aos(vec3d_soa_t out,
+                                   const vec3d_t *restrict in) {
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = in[i].e[0];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = in[i].e[1];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = in[i].e[2];
+    }
+}
+
+LINALG_DEF void vec3d_soa_to_aos(vec3d_t *restrict out, vec3d_soa_t in) {
+    for (size_t i = 0; i < in.n; ++i) {
+        out[i].e[0] = in.x[i];
+    }
+    for (size_t i = 0; i < in.n; ++i) {
+        out[i].e[1] = in.y[i];
+    }
+    for (size_t i = 0; i < in.n; ++i) {
+        out[i].e[2] = in.z[i];
+    }
+}
+
+LINALG_DEF void vec3d_soa_add(vec3d_soa_t out, vec3d_soa_t a, vec3d_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = a.x[i] + b.x[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = a.y[i] + b.y[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = a.z[i] + b.z[i];
+    }
+}
+
+LINALG_DEF void vec3d_soa_sub(vec3d_soa_t out, vec3d_soa_t a, vec3d_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = a.x[i] - b.x[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = a.y[i] - b.y[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = a.z[i] - b.z[i];
+    }
+}
+
+LINALG_DEF void vec3d_soa_mul(vec3d_soa_t out, vec3d_soa_t a, vec3d_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = a.x[i] * b.x[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = a.y[i] * b.y[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = a.z[i] * b.z[i];
+    }
+}
+
+LINALG_DEF void vec3d_soa_div(vec3d_soa_t out, vec3d_soa_t a, vec3d_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = a.x[i] / b.x[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = a.y[i] / b.y[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = a.z[i] / b.z[i];
+    }
+}
+
+LINALG_DEF void vec3d_soa_mod(vec3d_soa_t out, vec3d_soa_t a, vec3d_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = fmod(a.x[i], b.x[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = fmod(a.y[i], b.y[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = fmod(a.z[i], b.z[i]);
+    }
+}
+
+LINALG_DEF void vec3d_soa_min(vec3d_soa_t out, vec3d_soa_t a, vec3d_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = mind(a.x[i], b.x[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = mind(a.y[i], b.y[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = mind(a.z[i], b.z[i]);
+    }
+}
+
+LINALG_DEF void vec3d_soa_max(vec3d_soa_t out, vec3d_soa_t a, vec3d_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = maxd(a.x[i], b.x[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = maxd(a.y[i], b.y[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = maxd(a.z[i], b.z[i]);
+    }
+}
+
+LINALG_DEF void vec3d_soa_floor(vec3d_soa_t out, vec3d_soa_t v) {
+    assert(v.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = floor(v.x[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = floor(v.y[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = floor(v.z[i]);
+    }
+}
+
+LINALG_DEF void vec3d_soa_ceil(vec3d_soa_t out, vec3d_soa_t v) {
+    assert(v.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = ceil(v.x[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = ceil(v.y[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = ceil(v.z[i]);
+    }
+}
+
+LINALG_DEF void vec3d_soa_clamp(vec3d_soa_t out, vec3d_soa_t v, vec3d_soa_t min,
+                                vec3d_soa_t max) {
+    assert(v.n == out.n && min.n == out.n && max.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = clampd(v.x[i], min.x[i], max.x[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = clampd(v.y[i], min.y[i], max.y[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = clampd(v.z[i], min.z[i], max.z[i]);
+    }
+}
+
+LINALG_DEF void vec3d_soa_abs(vec3d_soa_t out, vec3d_soa_t v) {
+    assert(v.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = fabs(v.x[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = fabs(v.y[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = fabs(v.z[i]);
+    }
+}
+
+LINALG_DEF void vec3d_soa_lerp(vec3d_soa_t out, vec3d_soa_t a, vec3d_soa_t b,
+                               vec3d_soa_t t) {
+    assert(a.n == out.n && b.n == out.n && t.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = lerpd(a.x[i], b.x[i], t.x[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = lerpd(a.y[i], b.y[i], t.y[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = lerpd(a.z[i], b.z[i], t.z[i]);
+    }
+}
+
+LINALG_DEF void vec3d_soa_dot(double *out, vec3d_soa_t a, vec3d_soa_t b) {
+    assert(a.n == b.n);
+    for (size_t i = 0; i < a.n; ++i) {
+        out[i] = a.x[i] * b.x[i] + a.y[i] * b.y[i] + a.z[i] * b.z[i];
+    }
+}
+
+LINALG_DEF void vec3d_soa_2norm(double *out, vec3d_soa_t v) {
+    for (size_t i = 0; i < v.n; ++i) {
+        out[i] = sqrt(v.x[i] * v.x[i] + v.y[i] * v.y[i] + v.z[i] * v.z[i]);
+    }
+}
+
+LINALG_DEF void vec3d_soa_unit(vec3d_soa_t out, vec3d_soa_t v) {
+    assert(v.n == out.n);
+    for (size_t i = 0; i < v.n; ++i) {
+        double len = sqrt(v.x[i] * v.x[i] + v.y[i] * v.y[i] + v.z[i] * v.z[i]);
+        out.x[i] = v.x[i] / len;
+        out.y[i] = v.y[i] / len;
+        out.z[i] = v.z[i] / len;
+    }
+}
+
+LINALG_DEF void mat3d_mul_vec_soa(vec3d_soa_t out, mat3d_t M, vec3d_soa_t v) {
+    assert(v.n == out.n);
+    const double m11 = M._11;
+    const double m12 = M._12;
+    const double m13 = M._13;
+    const double m21 = M._21;
+    const double m22 = M._22;
+    const double m23 = M._23;
+    const double m31 = M._31;
+    const double m32 = M._32;
+    const double m33 = M._33;
+    for (size_t i = 0; i < v.n; ++i) {
+        const double x = v.x[i];
+        const double y = v.y[i];
+        const double z = v.z[i];
+        out.x[i] = m11 * x + m12 * y + m13 * z;
+        out.y[i] = m21 * x + m22 * y + m23 * z;
+        out.z[i] = m31 * x + m32 * y + m33 * z;
+    }
+}
+
+LINALG_DEF void vec3i_soa_from_aos(vec3i_soa_t out,
+                                   const vec3i_t *restrict in) {
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = in[i].e[0];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = in[i].e[1];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = in[i].e[2];
+    }
+}
+
+LINALG_DEF void vec3i_soa_to_aos(vec3i_t *restrict out, vec3i_soa_t in) {
+    for (size_t i = 0; i < in.n; ++i) {
+        out[i].e[0] = in.x[i];
+    }
+    for (size_t i = 0; i < in.n; ++i) {
+        out[i].e[1] = in.y[i];
+    }
+    for (size_t i = 0; i < in.n; ++i) {
+        out[i].e[2] = in.z[i];
+    }
+}
+
+LINALG_DEF void vec3i_soa_add(vec3i_soa_t out, vec3i_soa_t a, vec3i_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = a.x[i] + b.x[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = a.y[i] + b.y[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = a.z[i] + b.z[i];
+    }
+}
+
+LINALG_DEF void vec3i_soa_sub(vec3i_soa_t out, vec3i_soa_t a, vec3i_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = a.x[i] - b.x[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = a.y[i] - b.y[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = a.z[i] - b.z[i];
+    }
+}
+
+LINALG_DEF void vec3i_soa_mul(vec3i_soa_t out, vec3i_soa_t a, vec3i_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = a.x[i] * b.x[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = a.y[i] * b.y[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = a.z[i] * b.z[i];
+    }
+}
+
+LINALG_DEF void vec3i_soa_div(vec3i_soa_t out, vec3i_soa_t a, vec3i_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = a.x[i] / b.x[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = a.y[i] / b.y[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = a.z[i] / b.z[i];
+    }
+}
+
+LINALG_DEF void vec3i_soa_mod(vec3i_soa_t out, vec3i_soa_t a, vec3i_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = a.x[i] % b.x[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = a.y[i] % b.y[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = a.z[i] % b.z[i];
+    }
+}
+
+LINALG_DEF void vec3i_soa_min(vec3i_soa_t out, vec3i_soa_t a, vec3i_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = mini(a.x[i], b.x[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = mini(a.y[i], b.y[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = mini(a.z[i], b.z[i]);
+    }
+}
+
+LINALG_DEF void vec3i_soa_max(vec3i_soa_t out, vec3i_soa_t a, vec3i_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = maxi(a.x[i], b.x[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = maxi(a.y[i], b.y[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = maxi(a.z[i], b.z[i]);
+    }
+}
+
+LINALG_DEF void vec3i_soa_clamp(vec3i_soa_t out, vec3i_soa_t v, vec3i_soa_t min,
+                                vec3i_soa_t max) {
+    assert(v.n == out.n && min.n == out.n && max.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = clampi(v.x[i], min.x[i], max.x[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = clampi(v.y[i], min.y[i], max.y[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = clampi(v.z[i], min.z[i], max.z[i]);
+    }
+}
+
+LINALG_DEF void vec3i_soa_abs(vec3i_soa_t out, vec3i_soa_t v) {
+    assert(v.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = absi(v.x[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = absi(v.y[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = absi(v.z[i]);
+    }
+}
+
+LINALG_DEF void vec3i_soa_dot(int *out, vec3i_soa_t a, vec3i_soa_t b) {
+    assert(a.n == b.n);
+    for (size_t i = 0; i < a.n; ++i) {
+        out[i] = a.x[i] * b.x[i] + a.y[i] * b.y[i] + a.z[i] * b.z[i];
+    }
+}
+
+LINALG_DEF void mat3i_mul_vec_soa(vec3i_soa_t out, mat3i_t M, vec3i_soa_t v) {
+    assert(v.n == out.n);
+    const int m11 = M._11;
+    const int m12 = M._12;
+    const int m13 = M._13;
+    const int m21 = M._21;
+    const int m22 = M._22;
+    const int m23 = M._23;
+    const int m31 = M._31;
+    const int m32 = M._32;
+    const int m33 = M._33;
+    for (size_t i = 0; i < v.n; ++i) {
+        const int x = v.x[i];
+        const int y = v.y[i];
+        const int z = v.z[i];
+        out.x[i] = m11 * x + m12 * y + m13 * z;
+        out.y[i] = m21 * x + m22 * y + m23 * z;
+        out.z[i] = m31 * x + m32 * y + m33 * z;
+    }
+}
+
+LINALG_DEF void vec3u_soa_from_aos(vec3u_soa_t out,
+                                   const vec3u_t *restrict in) {
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = in[i].e[0];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = in[i].e[1];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = in[i].e[2];
+    }
+}
+
+LINALG_DEF void vec3u_soa_to_aos(vec3u_t *restrict out, vec3u_soa_t in) {
+    for (size_t i = 0; i < in.n; ++i) {
+        out[i].e[0] = in.x[i];
+    }
+    for (size_t i = 0; i < in.n; ++i) {
+        out[i].e[1] = in.y[i];
+    }
+    for (size_t i = 0; i < in.n; ++i) {
+        out[i].e[2] = in.z[i];
+    }
+}
+
+LINALG_DEF void vec3u_soa_add(vec3u_soa_t out, vec3u_soa_t a, vec3u_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = a.x[i] + b.x[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = a.y[i] + b.y[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = a.z[i] + b.z[i];
+    }
+}
+
+LINALG_DEF void vec3u_soa_sub(vec3u_soa_t out, vec3u_soa_t a, vec3u_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = a.x[i] - b.x[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = a.y[i] - b.y[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = a.z[i] - b.z[i];
+    }
+}
+
+LINALG_DEF void vec3u_soa_mul(vec3u_soa_t out, vec3u_soa_t a, vec3u_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = a.x[i] * b.x[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = a.y[i] * b.y[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = a.z[i] * b.z[i];
+    }
+}
+
+LINALG_DEF void vec3u_soa_div(vec3u_soa_t out, vec3u_soa_t a, vec3u_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = a.x[i] / b.x[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = a.y[i] / b.y[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = a.z[i] / b.z[i];
+    }
+}
+
+LINALG_DEF void vec3u_soa_mod(vec3u_soa_t out, vec3u_soa_t a, vec3u_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = a.x[i] % b.x[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = a.y[i] % b.y[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = a.z[i] % b.z[i];
+    }
+}
+
+LINALG_DEF void vec3u_soa_min(vec3u_soa_t out, vec3u_soa_t a, vec3u_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = minu(a.x[i], b.x[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = minu(a.y[i], b.y[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = minu(a.z[i], b.z[i]);
+    }
+}
+
+LINALG_DEF void vec3u_soa_max(vec3u_soa_t out, vec3u_soa_t a, vec3u_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = maxu(a.x[i], b.x[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = maxu(a.y[i], b.y[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = maxu(a.z[i], b.z[i]);
+    }
+}
+
+LINALG_DEF void vec3u_soa_clamp(vec3u_soa_t out, vec3u_soa_t v, vec3u_soa_t min,
+                                vec3u_soa_t max) {
+    assert(v.n == out.n && min.n == out.n && max.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = clampu(v.x[i], min.x[i], max.x[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = clampu(v.y[i], min.y[i], max.y[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = clampu(v.z[i], min.z[i], max.z[i]);
+    }
+}
+
+LINALG_DEF void vec3u_soa_dot(unsigned int *out, vec3u_soa_t a, vec3u_soa_t b) {
+    assert(a.n == b.n);
+    for (size_t i = 0; i < a.n; ++i) {
+        out[i] = a.x[i] * b.x[i] + a.y[i] * b.y[i] + a.z[i] * b.z[i];
+    }
+}
+
+LINALG_DEF void mat3u_mul_vec_soa(vec3u_soa_t out, mat3u_t M, vec3u_soa_t v) {
+    assert(v.n == out.n);
+    const unsigned int m11 = M._11;
+    const unsigned int m12 = M._12;
+    const unsigned int m13 = M._13;
+    const unsigned int m21 = M._21;
+    const unsigned int m22 = M._22;
+    const unsigned int m23 = M._23;
+    const unsigned int m31 = M._31;
+    const unsigned int m32 = M._32;
+    const unsigned int m33 = M._33;
+    for (size_t i = 0; i < v.n; ++i) {
+        const unsigned int x = v.x[i];
+        const unsigned int y = v.y[i];
+        const unsigned int z = v.z[i];
+        out.x[i] = m11 * x + m12 * y + m13 * z;
+        out.y[i] = m21 * x + m22 * y + m23 * z;
+        out.z[i] = m31 * x + m32 * y + m33 * z;
+    }
+}
+
+LINALG_DEF void vec4f_soa_from_aos(vec4f_soa_t out,
+                                   const vec4f_t *restrict in) {
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = in[i].e[0];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = in[i].e[1];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = in[i].e[2];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.w[i] = in[i].e[3];
+    }
+}
+
+LINALG_DEF void vec4f_soa_to_aos(vec4f_t *restrict out, vec4f_soa_t in) {
+    for (size_t i = 0; i < in.n; ++i) {
+        out[i].e[0] = in.x[i];
+    }
+    for (size_t i = 0; i < in.n; ++i) {
+        out[i].e[1] = in.y[i];
+    }
+    for (size_t i = 0; i < in.n; ++i) {
+        out[i].e[2] = in.z[i];
+    }
+    for (size_t i = 0; i < in.n; ++i) {
+        out[i].e[3] = in.w[i];
+    }
+}
+
+LINALG_DEF void vec4f_soa_add(vec4f_soa_t out, vec4f_soa_t a, vec4f_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = a.x[i] + b.x[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = a.y[i] + b.y[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = a.z[i] + b.z[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.w[i] = a.w[i] + b.w[i];
+    }
+}
+
+LINALG_DEF void vec4f_soa_sub(vec4f_soa_t out, vec4f_soa_t a, vec4f_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = a.x[i] - b.x[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = a.y[i] - b.y[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = a.z[i] - b.z[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.w[i] = a.w[i] - b.w[i];
+    }
+}
+
+LINALG_DEF void vec4f_soa_mul(vec4f_soa_t out, vec4f_soa_t a, vec4f_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = a.x[i] * b.x[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = a.y[i] * b.y[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = a.z[i] * b.z[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.w[i] = a.w[i] * b.w[i];
+    }
+}
+
+LINALG_DEF void vec4f_soa_div(vec4f_soa_t out, vec4f_soa_t a, vec4f_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = a.x[i] / b.x[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = a.y[i] / b.y[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = a.z[i] / b.z[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.w[i] = a.w[i] / b.w[i];
+    }
+}
+
+LINALG_DEF void vec4f_soa_mod(vec4f_soa_t out, vec4f_soa_t a, vec4f_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = fmodf(a.x[i], b.x[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = fmodf(a.y[i], b.y[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = fmodf(a.z[i], b.z[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.w[i] = fmodf(a.w[i], b.w[i]);
+    }
+}
+
+LINALG_DEF void vec4f_soa_min(vec4f_soa_t out, vec4f_soa_t a, vec4f_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = minf(a.x[i], b.x[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = minf(a.y[i], b.y[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = minf(a.z[i], b.z[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.w[i] = minf(a.w[i], b.w[i]);
+    }
+}
+
+LINALG_DEF void vec4f_soa_max(vec4f_soa_t out, vec4f_soa_t a, vec4f_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = maxf(a.x[i], b.x[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = maxf(a.y[i], b.y[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = maxf(a.z[i], b.z[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.w[i] = maxf(a.w[i], b.w[i]);
+    }
+}
+
+LINALG_DEF void vec4f_soa_floor(vec4f_soa_t out, vec4f_soa_t v) {
+    assert(v.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = floorf(v.x[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = floorf(v.y[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = floorf(v.z[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.w[i] = floorf(v.w[i]);
+    }
+}
+
+LINALG_DEF void vec4f_soa_ceil(vec4f_soa_t out, vec4f_soa_t v) {
+    assert(v.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = ceilf(v.x[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = ceilf(v.y[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = ceilf(v.z[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.w[i] = ceilf(v.w[i]);
+    }
+}
+
+LINALG_DEF void vec4f_soa_clamp(vec4f_soa_t out, vec4f_soa_t v, vec4f_soa_t min,
+                                vec4f_soa_t max) {
+    assert(v.n == out.n && min.n == out.n && max.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = clampf(v.x[i], min.x[i], max.x[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = clampf(v.y[i], min.y[i], max.y[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = clampf(v.z[i], min.z[i], max.z[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.w[i] = clampf(v.w[i], min.w[i], max.w[i]);
+    }
+}
+
+LINALG_DEF void vec4f_soa_abs(vec4f_soa_t out, vec4f_soa_t v) {
+    assert(v.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = fabsf(v.x[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = fabsf(v.y[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = fabsf(v.z[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.w[i] = fabsf(v.w[i]);
+    }
+}
+
+LINALG_DEF void vec4f_soa_lerp(vec4f_soa_t out, vec4f_soa_t a, vec4f_soa_t b,
+                               vec4f_soa_t t) {
+    assert(a.n == out.n && b.n == out.n && t.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = lerpf(a.x[i], b.x[i], t.x[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = lerpf(a.y[i], b.y[i], t.y[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = lerpf(a.z[i], b.z[i], t.z[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.w[i] = lerpf(a.w[i], b.w[i], t.w[i]);
+    }
+}
+
+LINALG_DEF void vec4f_soa_dot(float *out, vec4f_soa_t a, vec4f_soa_t b) {
+    assert(a.n == b.n);
+    for (size_t i = 0; i < a.n; ++i) {
+        out[i] = a.x[i] * b.x[i] + a.y[i] * b.y[i] + a.z[i] * b.z[i] + a.w[i] *
+                 b.w[i];
+    }
+}
+
+LINALG_DEF void vec4f_soa_2norm(float *out, vec4f_soa_t v) {
+    for (size_t i = 0; i < v.n; ++i) {
+        out[i] = sqrtf(v.x[i] * v.x[i] + v.y[i] * v.y[i] + v.z[i] * v.z[i] +
+                       v.w[i] * v.w[i]);
+    }
+}
+
+LINALG_DEF void vec4f_soa_unit(vec4f_soa_t out, vec4f_soa_t v) {
+    assert(v.n == out.n);
+    for (size_t i = 0; i < v.n; ++i) {
+        float len = sqrtf(v.x[i] * v.x[i] + v.y[i] * v.y[i] + v.z[i] * v.z[i] +
+                          v.w[i] * v.w[i]);
+        out.x[i] = v.x[i] / len;
+        out.y[i] = v.y[i] / len;
+        out.z[i] = v.z[i] / len;
+        out.w[i] = v.w[i] / len;
+    }
+}
+
+LINALG_DEF void mat4f_mul_vec_soa(vec4f_soa_t out, mat4f_t M, vec4f_soa_t v) {
+    assert(v.n == out.n);
+    const float m11 = M._11;
+    const float m12 = M._12;
+    const float m13 = M._13;
+    const float m14 = M._14;
+    const float m21 = M._21;
+    const float m22 = M._22;
+    const float m23 = M._23;
+    const float m24 = M._24;
+    const float m31 = M._31;
+    const float m32 = M._32;
+    const float m33 = M._33;
+    const float m34 = M._34;
+    const float m41 = M._41;
+    const float m42 = M._42;
+    const float m43 = M._43;
+    const float m44 = M._44;
+    for (size_t i = 0; i < v.n; ++i) {
+        const float x = v.x[i];
+        const float y = v.y[i];
+        const float z = v.z[i];
+        const float w = v.w[i];
+        out.x[i] = m11 * x + m12 * y + m13 * z + m14 * w;
+        out.y[i] = m21 * x + m22 * y + m23 * z + m24 * w;
+        out.z[i] = m31 * x + m32 * y + m33 * z + m34 * w;
+        out.w[i] = m41 * x + m42 * y + m43 * z + m44 * w;
+    }
+}
+
+LINALG_DEF void vec4d_soa_from_aos(vec4d_soa_t out,
+                                   const vec4d_t *restrict in) {
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = in[i].e[0];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = in[i].e[1];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = in[i].e[2];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.w[i] = in[i].e[3];
+    }
+}
+
+LINALG_DEF void vec4d_soa_to_aos(vec4d_t *restrict out, vec4d_soa_t in) {
+    for (size_t i = 0; i < in.n; ++i) {
+        out[i].e[0] = in.x[i];
+    }
+    for (size_t i = 0; i < in.n; ++i) {
+        out[i].e[1] = in.y[i];
+    }
+    for (size_t i = 0; i < in.n; ++i) {
+        out[i].e[2] = in.z[i];
+    }
+    for (size_t i = 0; i < in.n; ++i) {
+        out[i].e[3] = in.w[i];
+    }
+}
+
+LINALG_DEF void vec4d_soa_add(vec4d_soa_t out, vec4d_soa_t a, vec4d_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = a.x[i] + b.x[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = a.y[i] + b.y[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = a.z[i] + b.z[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.w[i] = a.w[i] + b.w[i];
+    }
+}
+
+LINALG_DEF void vec4d_soa_sub(vec4d_soa_t out, vec4d_soa_t a, vec4d_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = a.x[i] - b.x[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = a.y[i] - b.y[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = a.z[i] - b.z[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.w[i] = a.w[i] - b.w[i];
+    }
+}
+
+LINALG_DEF void vec4d_soa_mul(vec4d_soa_t out, vec4d_soa_t a, vec4d_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = a.x[i] * b.x[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = a.y[i] * b.y[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = a.z[i] * b.z[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.w[i] = a.w[i] * b.w[i];
+    }
+}
+
+LINALG_DEF void vec4d_soa_div(vec4d_soa_t out, vec4d_soa_t a, vec4d_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = a.x[i] / b.x[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = a.y[i] / b.y[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = a.z[i] / b.z[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.w[i] = a.w[i] / b.w[i];
+    }
+}
+
+LINALG_DEF void vec4d_soa_mod(vec4d_soa_t out, vec4d_soa_t a, vec4d_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = fmod(a.x[i], b.x[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = fmod(a.y[i], b.y[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = fmod(a.z[i], b.z[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.w[i] = fmod(a.w[i], b.w[i]);
+    }
+}
+
+LINALG_DEF void vec4d_soa_min(vec4d_soa_t out, vec4d_soa_t a, vec4d_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = mind(a.x[i], b.x[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = mind(a.y[i], b.y[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = mind(a.z[i], b.z[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.w[i] = mind(a.w[i], b.w[i]);
+    }
+}
+
+LINALG_DEF void vec4d_soa_max(vec4d_soa_t out, vec4d_soa_t a, vec4d_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = maxd(a.x[i], b.x[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = maxd(a.y[i], b.y[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = maxd(a.z[i], b.z[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.w[i] = maxd(a.w[i], b.w[i]);
+    }
+}
+
+LINALG_DEF void vec4d_soa_floor(vec4d_soa_t out, vec4d_soa_t v) {
+    assert(v.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = floor(v.x[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = floor(v.y[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = floor(v.z[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.w[i] = floor(v.w[i]);
+    }
+}
+
+LINALG_DEF void vec4d_soa_ceil(vec4d_soa_t out, vec4d_soa_t v) {
+    assert(v.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = ceil(v.x[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = ceil(v.y[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = ceil(v.z[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.w[i] = ceil(v.w[i]);
+    }
+}
+
+LINALG_DEF void vec4d_soa_clamp(vec4d_soa_t out, vec4d_soa_t v, vec4d_soa_t min,
+                                vec4d_soa_t max) {
+    assert(v.n == out.n && min.n == out.n && max.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = clampd(v.x[i], min.x[i], max.x[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = clampd(v.y[i], min.y[i], max.y[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = clampd(v.z[i], min.z[i], max.z[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.w[i] = clampd(v.w[i], min.w[i], max.w[i]);
+    }
+}
+
+LINALG_DEF void vec4d_soa_abs(vec4d_soa_t out, vec4d_soa_t v) {
+    assert(v.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = fabs(v.x[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = fabs(v.y[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = fabs(v.z[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.w[i] = fabs(v.w[i]);
+    }
+}
+
+LINALG_DEF void vec4d_soa_lerp(vec4d_soa_t out, vec4d_soa_t a, vec4d_soa_t b,
+                               vec4d_soa_t t) {
+    assert(a.n == out.n && b.n == out.n && t.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = lerpd(a.x[i], b.x[i], t.x[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = lerpd(a.y[i], b.y[i], t.y[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = lerpd(a.z[i], b.z[i], t.z[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.w[i] = lerpd(a.w[i], b.w[i], t.w[i]);
+    }
+}
+
+LINALG_DEF void vec4d_soa_dot(double *out, vec4d_soa_t a, vec4d_soa_t b) {
+    assert(a.n == b.n);
+    for (size_t i = 0; i < a.n; ++i) {
+        out[i] = a.x[i] * b.x[i] + a.y[i] * b.y[i] + a.z[i] * b.z[i] + a.w[i] *
+                 b.w[i];
+    }
+}
+
+LINALG_DEF void vec4d_soa_2norm(double *out, vec4d_soa_t v) {
+    for (size_t i = 0; i < v.n; ++i) {
+        out[i] = sqrt(v.x[i] * v.x[i] + v.y[i] * v.y[i] + v.z[i] * v.z[i] +
+                      v.w[i] * v.w[i]);
+    }
+}
+
+LINALG_DEF void vec4d_soa_unit(vec4d_soa_t out, vec4d_soa_t v) {
+    assert(v.n == out.n);
+    for (size_t i = 0; i < v.n; ++i) {
+        double len = sqrt(v.x[i] * v.x[i] + v.y[i] * v.y[i] + v.z[i] * v.z[i] +
+                          v.w[i] * v.w[i]);
+        out.x[i] = v.x[i] / len;
+        out.y[i] = v.y[i] / len;
+        out.z[i] = v.z[i] / len;
+        out.w[i] = v.w[i] / len;
+    }
+}
+
+LINALG_DEF void mat4d_mul_vec_soa(vec4d_soa_t out, mat4d_t M, vec4d_soa_t v) {
+    assert(v.n == out.n);
+    const double m11 = M._11;
+    const double m12 = M._12;
+    const double m13 = M._13;
+    const double m14 = M._14;
+    const double m21 = M._21;
+    const double m22 = M._22;
+    const double m23 = M._23;
+    const double m24 = M._24;
+    const double m31 = M._31;
+    const double m32 = M._32;
+    const double m33 = M._33;
+    const double m34 = M._34;
+    const double m41 = M._41;
+    const double m42 = M._42;
+    const double m43 = M._43;
+    const double m44 = M._44;
+    for (size_t i = 0; i < v.n; ++i) {
+        const double x = v.x[i];
+        const double y = v.y[i];
+        const double z = v.z[i];
+        const double w = v.w[i];
+        out.x[i] = m11 * x + m12 * y + m13 * z + m14 * w;
+        out.y[i] = m21 * x + m22 * y + m23 * z + m24 * w;
+        out.z[i] = m31 * x + m32 * y + m33 * z + m34 * w;
+        out.w[i] = m41 * x + m42 * y + m43 * z + m44 * w;
+    }
+}
+
+LINALG_DEF void vec4i_soa_from_aos(vec4i_soa_t out,
+                                   const vec4i_t *restrict in) {
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = in[i].e[0];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = in[i].e[1];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = in[i].e[2];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.w[i] = in[i].e[3];
+    }
+}
+
+LINALG_DEF void vec4i_soa_to_aos(vec4i_t *restrict out, vec4i_soa_t in) {
+    for (size_t i = 0; i < in.n; ++i) {
+        out[i].e[0] = in.x[i];
+    }
+    for (size_t i = 0; i < in.n; ++i) {
+        out[i].e[1] = in.y[i];
+    }
+    for (size_t i = 0; i < in.n; ++i) {
+        out[i].e[2] = in.z[i];
+    }
+    for (size_t i = 0; i < in.n; ++i) {
+        out[i].e[3] = in.w[i];
+    }
+}
+
+LINALG_DEF void vec4i_soa_add(vec4i_soa_t out, vec4i_soa_t a, vec4i_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = a.x[i] + b.x[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = a.y[i] + b.y[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = a.z[i] + b.z[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.w[i] = a.w[i] + b.w[i];
+    }
+}
+
+LINALG_DEF void vec4i_soa_sub(vec4i_soa_t out, vec4i_soa_t a, vec4i_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = a.x[i] - b.x[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = a.y[i] - b.y[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = a.z[i] - b.z[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.w[i] = a.w[i] - b.w[i];
+    }
+}
+
+LINALG_DEF void vec4i_soa_mul(vec4i_soa_t out, vec4i_soa_t a, vec4i_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = a.x[i] * b.x[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = a.y[i] * b.y[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = a.z[i] * b.z[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.w[i] = a.w[i] * b.w[i];
+    }
+}
+
+LINALG_DEF void vec4i_soa_div(vec4i_soa_t out, vec4i_soa_t a, vec4i_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = a.x[i] / b.x[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = a.y[i] / b.y[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = a.z[i] / b.z[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.w[i] = a.w[i] / b.w[i];
+    }
+}
+
+LINALG_DEF void vec4i_soa_mod(vec4i_soa_t out, vec4i_soa_t a, vec4i_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = a.x[i] % b.x[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = a.y[i] % b.y[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = a.z[i] % b.z[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.w[i] = a.w[i] % b.w[i];
+    }
+}
+
+LINALG_DEF void vec4i_soa_min(vec4i_soa_t out, vec4i_soa_t a, vec4i_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = mini(a.x[i], b.x[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = mini(a.y[i], b.y[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = mini(a.z[i], b.z[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.w[i] = mini(a.w[i], b.w[i]);
+    }
+}
+
+LINALG_DEF void vec4i_soa_max(vec4i_soa_t out, vec4i_soa_t a, vec4i_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = maxi(a.x[i], b.x[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = maxi(a.y[i], b.y[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = maxi(a.z[i], b.z[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.w[i] = maxi(a.w[i], b.w[i]);
+    }
+}
+
+LINALG_DEF void vec4i_soa_clamp(vec4i_soa_t out, vec4i_soa_t v, vec4i_soa_t min,
+                                vec4i_soa_t max) {
+    assert(v.n == out.n && min.n == out.n && max.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = clampi(v.x[i], min.x[i], max.x[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = clampi(v.y[i], min.y[i], max.y[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = clampi(v.z[i], min.z[i], max.z[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.w[i] = clampi(v.w[i], min.w[i], max.w[i]);
+    }
+}
+
+LINALG_DEF void vec4i_soa_abs(vec4i_soa_t out, vec4i_soa_t v) {
+    assert(v.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = absi(v.x[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = absi(v.y[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = absi(v.z[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.w[i] = absi(v.w[i]);
+    }
+}
+
+LINALG_DEF void vec4i_soa_dot(int *out, vec4i_soa_t a, vec4i_soa_t b) {
+    assert(a.n == b.n);
+    for (size_t i = 0; i < a.n; ++i) {
+        out[i] = a.x[i] * b.x[i] + a.y[i] * b.y[i] + a.z[i] * b.z[i] + a.w[i] *
+                 b.w[i];
+    }
+}
+
+LINALG_DEF void mat4i_mul_vec_soa(vec4i_soa_t out, mat4i_t M, vec4i_soa_t v) {
+    assert(v.n == out.n);
+    const int m11 = M._11;
+    const int m12 = M._12;
+    const int m13 = M._13;
+    const int m14 = M._14;
+    const int m21 = M._21;
+    const int m22 = M._22;
+    const int m23 = M._23;
+    const int m24 = M._24;
+    const int m31 = M._31;
+    const int m32 = M._32;
+    const int m33 = M._33;
+    const int m34 = M._34;
+    const int m41 = M._41;
+    const int m42 = M._42;
+    const int m43 = M._43;
+    const int m44 = M._44;
+    for (size_t i = 0; i < v.n; ++i) {
+        const int x = v.x[i];
+        const int y = v.y[i];
+        const int z = v.z[i];
+        const int w = v.w[i];
+        out.x[i] = m11 * x + m12 * y + m13 * z + m14 * w;
+        out.y[i] = m21 * x + m22 * y + m23 * z + m24 * w;
+        out.z[i] = m31 * x + m32 * y + m33 * z + m34 * w;
+        out.w[i] = m41 * x + m42 * y + m43 * z + m44 * w;
+    }
+}
+
+LINALG_DEF void vec4u_soa_from_aos(vec4u_soa_t out,
+                                   const vec4u_t *restrict in) {
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = in[i].e[0];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = in[i].e[1];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = in[i].e[2];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.w[i] = in[i].e[3];
+    }
+}
+
+LINALG_DEF void vec4u_soa_to_aos(vec4u_t *restrict out, vec4u_soa_t in) {
+    for (size_t i = 0; i < in.n; ++i) {
+        out[i].e[0] = in.x[i];
+    }
+    for (size_t i = 0; i < in.n; ++i) {
+        out[i].e[1] = in.y[i];
+    }
+    for (size_t i = 0; i < in.n; ++i) {
+        out[i].e[2] = in.z[i];
+    }
+    for (size_t i = 0; i < in.n; ++i) {
+        out[i].e[3] = in.w[i];
+    }
+}
+
+LINALG_DEF void vec4u_soa_add(vec4u_soa_t out, vec4u_soa_t a, vec4u_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = a.x[i] + b.x[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = a.y[i] + b.y[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = a.z[i] + b.z[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.w[i] = a.w[i] + b.w[i];
+    }
+}
+
+LINALG_DEF void vec4u_soa_sub(vec4u_soa_t out, vec4u_soa_t a, vec4u_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = a.x[i] - b.x[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = a.y[i] - b.y[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = a.z[i] - b.z[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.w[i] = a.w[i] - b.w[i];
+    }
+}
+
+LINALG_DEF void vec4u_soa_mul(vec4u_soa_t out, vec4u_soa_t a, vec4u_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = a.x[i] * b.x[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = a.y[i] * b.y[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = a.z[i] * b.z[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.w[i] = a.w[i] * b.w[i];
+    }
+}
+
+LINALG_DEF void vec4u_soa_div(vec4u_soa_t out, vec4u_soa_t a, vec4u_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = a.x[i] / b.x[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = a.y[i] / b.y[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = a.z[i] / b.z[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.w[i] = a.w[i] / b.w[i];
+    }
+}
+
+LINALG_DEF void vec4u_soa_mod(vec4u_soa_t out, vec4u_soa_t a, vec4u_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = a.x[i] % b.x[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = a.y[i] % b.y[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = a.z[i] % b.z[i];
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.w[i] = a.w[i] % b.w[i];
+    }
+}
+
+LINALG_DEF void vec4u_soa_min(vec4u_soa_t out, vec4u_soa_t a, vec4u_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = minu(a.x[i], b.x[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = minu(a.y[i], b.y[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = minu(a.z[i], b.z[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.w[i] = minu(a.w[i], b.w[i]);
+    }
+}
+
+LINALG_DEF void vec4u_soa_max(vec4u_soa_t out, vec4u_soa_t a, vec4u_soa_t b) {
+    assert(a.n == out.n && b.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = maxu(a.x[i], b.x[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = maxu(a.y[i], b.y[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = maxu(a.z[i], b.z[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.w[i] = maxu(a.w[i], b.w[i]);
+    }
+}
+
+LINALG_DEF void vec4u_soa_clamp(vec4u_soa_t out, vec4u_soa_t v, vec4u_soa_t min,
+                                vec4u_soa_t max) {
+    assert(v.n == out.n && min.n == out.n && max.n == out.n);
+    for (size_t i = 0; i < out.n; ++i) {
+        out.x[i] = clampu(v.x[i], min.x[i], max.x[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.y[i] = clampu(v.y[i], min.y[i], max.y[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.z[i] = clampu(v.z[i], min.z[i], max.z[i]);
+    }
+    for (size_t i = 0; i < out.n; ++i) {
+        out.w[i] = clampu(v.w[i], min.w[i], max.w[i]);
+    }
+}
+
+LINALG_DEF void vec4u_soa_dot(unsigned int *out, vec4u_soa_t a, vec4u_soa_t b) {
+    assert(a.n == b.n);
+    for (size_t i = 0; i < a.n; ++i) {
+        out[i] = a.x[i] * b.x[i] + a.y[i] * b.y[i] + a.z[i] * b.z[i] + a.w[i] *
+                 b.w[i];
+    }
+}
+
+LINALG_DEF void mat4u_mul_vec_soa(vec4u_soa_t out, mat4u_t M, vec4u_soa_t v) {
+    assert(v.n == out.n);
+    const unsigned int m11 = M._11;
+    const unsigned int m12 = M._12;
+    const unsigned int m13 = M._13;
+    const unsigned int m14 = M._14;
+    const unsigned int m21 = M._21;
+    const unsigned int m22 = M._22;
+    const unsigned int m23 = M._23;
+    const unsigned int m24 = M._24;
+    const unsigned int m31 = M._31;
+    const unsigned int m32 = M._32;
+    const unsigned int m33 = M._33;
+    const unsigned int m34 = M._34;
+    const unsigned int m41 = M._41;
+    const unsigned int m42 = M._42;
+    const unsigned int m43 = M._43;
+    const unsigned int m44 = M._44;
+    for (size_t i = 0; i < v.n; ++i) {
+        const unsigned int x = v.x[i];
+        const unsigned int y = v.y[i];
+        const unsigned int z = v.z[i];
+        const unsigned int w = v.w[i];
+        out.x[i] = m11 * x + m12 * y + m13 * z + m14 * w;
+        out.y[i] = m21 * x + m22 * y + m23 * z + m24 * w;
+        out.z[i] = m31 * x + m32 * y + m33 * z + m34 * w;
+        out.w[i] = m41 * x + m42 * y + m43 * z + m44 * w;
+    }
+}
+
+LINALG_DEF void vec2h_to_vec2f_array(const vec2h_t *restrict in,
+                                     vec2f_t *restrict out, size_t n) {
+    const half_t *src = (const half_t *)in;
+    float *dst = (float *)out;
+    size_t count = 2 * n, i = 0;
+#if defined(LINALG_SIMD) && defined(__AVX512F__)
+    for (; i + 16 <= count; i += 16) {
+        __m256i x = _mm256_loadu_si256((const __m256i *)(src + i));
+        __m512 f = _mm512_cvtph_ps(x);
+        _mm512_storeu_ps(dst + i, f);
+    }
+#endif // LINALG_SIMD && __AVX512F__
+#if defined(LINALG_SIMD) && defined(__F16C__)
+    for (; i + 8 <= count; i += 8) {
+        __m128i x = _mm_loadu_si128((const __m128i *)(src + i));
+        __m256 f = _mm256_cvtph_ps(x);
+        _mm256_storeu_ps(dst + i, f);
+    }
+#endif // LINALG_SIMD && __F16C__
+    for (; i < count; ++i) {
+        dst[i] = linalg_half_to_float(src[i]);
+    }
+}
+
+LINALG_DEF void vec2h_from_vec2f_array(const vec2f_t *restrict in,
+                                       vec2h_t *restrict out, size_t n) {
+    const float *src = (const float *)in;
+    half_t *dst = (half_t *)out;
+    size_t count = 2 * n, i = 0;
+#if defined(LINALG_SIMD) && defined(__AVX512F__)
+    for (; i + 16 <= count; i += 16) {
+        __m512 x = _mm512_loadu_ps(src + i);
+        __m256i h = _mm512_cvtps_ph(x, _MM_FROUND_TO_NEAREST_INT);
+        _mm256_storeu_si256((__m256i *)(dst + i), h);
+    }
+#endif // LINALG_SIMD && __AVX512F__
+#if defined(LINALG_SIMD) && defined(__F16C__)
+    for (; i + 8 <= count; i += 8) {
+        __m256 x = _mm256_loadu_ps(src + i);
+        __m128i h = _mm256_cvtps_ph(x, _MM_FROUND_TO_NEAREST_INT);
+        _mm_storeu_si128((__m128i *)(dst + i), h);
+    }
+#endif // LINALG_SIMD && __F16C__
+    for (; i < count; ++i) {
+        dst[i] = linalg_float_to_half(src[i]);
+    }
+}
+
+LINALG_DEF void mat2f_transform_array_h(const mat2f_t *M,
+                                        const vec2h_t *restrict in,
+                                        vec2h_t *restrict out, size_t n) {
+    vec2f_t block_in[LINALG_HALF_BLOCK], block_out[LINALG_HALF_BLOCK];
+    for (size_t i = 0; i < n; i += LINALG_HALF_BLOCK) {
+        size_t m = n - i < LINALG_HALF_BLOCK ? n - i : LINALG_HALF_BLOCK;
+        vec2h_to_vec2f_array(in + i, block_in, m);
+        mat2f_transform_array(M, block_in, block_out, m);
+        vec2h_from_vec2f_array(block_out, out + i, m);
+    }
+}
+
+LINALG_DEF void vec3h_to_vec3f_array(const vec3h_t *restrict in,
+                                     vec3f_t *restrict out, size_t n) {
+    const half_t *src = (const half_t *)in;
+    float *dst = (float *)out;
+    size_t count = 3 * n, i = 0;
+#if defined(LINALG_SIMD) && defined(__AVX512F__)
+    for (; i + 16 <= count; i += 16) {
+        __m256i x = _mm256_loadu_si256((const __m256i *)(src + i));
+        __m512 f = _mm512_cvtph_ps(x);
+        _mm512_storeu_ps(dst + i, f);
+    }
+#endif // LINALG_SIMD && __AVX512F__
+#if defined(LINALG_SIMD) && defined(__F16C__)
+    for (; i + 8 <= count; i += 8) {
+        __m128i x = _mm_loadu_si128((const __m128i *)(src + i));
+        __m256 f = _mm256_cvtph_ps(x);
+        _mm256_storeu_ps(dst + i, f);
+    }
+#endif // LINALG_SIMD && __F16C__
+    for (; i < count; ++i) {
+        dst[i] = linalg_half_to_float(src[i]);
+    }
+}
+
+LINALG_DEF void vec3h_from_vec3f_array(const vec3f_t *restrict in,
+                                       vec3h_t *restrict out, size_t n) {
+    const float *src = (const float *)in;
+    half_t *dst = (half_t *)out;
+    size_t count = 3 * n, i = 0;
+#if defined(LINALG_SIMD) && defined(__AVX512F__)
+    for (; i + 16 <= count; i += 16) {
+        __m512 x = _mm512_loadu_ps(src + i);
+        __m256i h = _mm512_cvtps_ph(x, _MM_FROUND_TO_NEAREST_INT);
+        _mm256_storeu_si256((__m256i *)(dst + i), h);
+    }
+#endif // LINALG_SIMD && __AVX512F__
+#if defined(LINALG_SIMD) && defined(__F16C__)
+    for (; i + 8 <= count; i += 8) {
+        __m256 x = _mm256_loadu_ps(src + i);
+        __m128i h = _mm256_cvtps_ph(x, _MM_FROUND_TO_NEAREST_INT);
+        _mm_storeu_si128((__m128i *)(dst + i), h);
+    }
+#endif // LINALG_SIMD && __F16C__
+    for (; i < count; ++i) {
+        dst[i] = linalg_float_to_half(src[i]);
+    }
+}
+
+LINALG_DEF void mat3f_transform_array_h(const mat3f_t *M,
+                                        const vec3h_t *restrict in,
+                                        vec3h_t *restrict out, size_t n) {
+    vec3f_t block_in[LINALG_HALF_BLOCK], block_out[LINALG_HALF_BLOCK];
+    for (size_t i = 0; i < n; i += LINALG_HALF_BLOCK) {
+        size_t m = n - i < LINALG_HALF_BLOCK ? n - i : LINALG_HALF_BLOCK;
+        vec3h_to_vec3f_array(in + i, block_in, m);
+        mat3f_transform_array(M, block_in, block_out, m);
+        vec3h_from_vec3f_array(block_out, out + i, m);
+    }
+}
+
+LINALG_DEF void vec4h_to_vec4f_array(const vec4h_t *restrict in,
+                                     vec4f_t *restrict out, size_t n) {
+    const half_t *src = (const half_t *)in;
+    float *dst = (float *)out;
+    size_t count = 4 * n, i = 0;
+#if defined(LINALG_SIMD) && defined(__AVX512F__)
+    for (; i + 16 <= count; i += 16) {
+        __m256i x = _mm256_loadu_si256((const __m256i *)(src + i));
+        __m512 f = _mm512_cvtph_ps(x);
+        _mm512_storeu_ps(dst + i, f);
+    }
+#endif // LINALG_SIMD && __AVX512F__
+#if defined(LINALG_SIMD) && defined(__F16C__)
+    for (; i + 8 <= count; i += 8) {
+        __m128i x = _mm_loadu_si128((const __m128i *)(src + i));
+        __m256 f = _mm256_cvtph_ps(x);
+        _mm256_storeu_ps(dst + i, f);
+    }
+#endif // LINALG_SIMD && __F16C__
+    for (; i < count; ++i) {
+        dst[i] = linalg_half_to_float(src[i]);
+    }
+}
+
+LINALG_DEF void vec4h_from_vec4f_array(const vec4f_t *restrict in,
+                                       vec4h_t *restrict out, size_t n) {
+    const float *src = (const float *)in;
+    half_t *dst = (half_t *)out;
+    size_t count = 4 * n, i = 0;
+#if defined(LINALG_SIMD) && defined(__AVX512F__)
+    for (; i + 16 <= count; i += 16) {
+        __m512 x = _mm512_loadu_ps(src + i);
+        __m256i h = _mm512_cvtps_ph(x, _MM_FROUND_TO_NEAREST_INT);
+        _mm256_storeu_si256((__m256i *)(dst + i), h);
+    }
+#endif // LINALG_SIMD && __AVX512F__
+#if defined(LINALG_SIMD) && defined(__F16C__)
+    for (; i + 8 <= count; i += 8) {
+        __m256 x = _mm256_loadu_ps(src + i);
+        __m128i h = _mm256_cvtps_ph(x, _MM_FROUND_TO_NEAREST_INT);
+        _mm_storeu_si128((__m128i *)(dst + i), h);
+    }
+#endif // LINALG_SIMD && __F16C__
+    for (; i < count; ++i) {
+        dst[i] = linalg_float_to_half(src[i]);
+    }
+}
+
+LINALG_DEF void mat4f_transform_array_h(const mat4f_t *M,
+                                        const vec4h_t *restrict in,
+                                        vec4h_t *restrict out, size_t n) {
+    vec4f_t block_in[LINALG_HALF_BLOCK], block_out[LINALG_HALF_BLOCK];
+    for (size_t i = 0; i < n; i += LINALG_HALF_BLOCK) {
+        size_t m = n - i < LINALG_HALF_BLOCK ? n - i : LINALG_HALF_BLOCK;
+        vec4h_to_vec4f_array(in + i, block_in, m);
+        mat4f_transform_array(M, block_in, block_out, m);
+        vec4h_from_vec4f_array(block_out, out + i, m);
+    }
+}
+
+#endif // LINALG_IMPLEMENTATION
+
+/* Type-generic front end, resolved at compile time from the type of the first
+ * argument:
+ *
+ *     typedef vec3f_t vec_t; // Or vec3d_t: the calls below follow.
+ *     vec_t n = la_unit(la_cross(la_sub(b, a), la_sub(c, a)));
+ *     la_transform(&M, in, out, count);
+ *
+ * `la_mul` is component-wise for vectors, and the matrix (or quaternion)
+ * product otherwise: `la_mul(M, v)` is `matN<t>_mul_vec`.
+ */
+#define la_add(a, b)                                                           \
+    _Generic((a),                                                              \
+        vec2f_t: vec2f_add,                                                    \
+        vec2d_t: vec2d_add,                                                    \
+        vec2i_t: vec2i_add,                                                    \
+        vec2u_t: vec2u_add,                                                    \
+        vec3f_t: vec3f_add,                                                    \
+        vec3d_t: vec3d_add,                                                    \
+        vec3i_t: vec3i_add,                                                    \
+        vec3u_t: vec3u_add,                                                    \
+        vec4f_t: vec4f_add,                                                    \
+        vec4d_t: vec4d_add,                                                    \
+        vec4i_t: vec4i_add,                                                    \
+        vec4u_t: vec4u_add)(a, b)
+
+#define la_sub(a, b)                                                           \
+    _Generic((a),                                                              \
+        vec2f_t: vec2f_sub,                                                    \
+        vec2d_t: vec2d_sub,                                                    \
+        vec2i_t: vec2i_sub,                                                    \
+        vec2u_t: vec2u_sub,                                                    \
+        vec3f_t: vec3f_sub,                                                    \
+        vec3d_t: vec3d_sub,                                                    \
+        vec3i_t: vec3i_sub,                                                    \
+        vec3u_t: vec3u_sub,                                                    \
+        vec4f_t: vec4f_sub,                                                    \
+        vec4d_t: vec4d_sub,                                                    \
+        vec4i_t: vec4i_sub,                                                    \
+        vec4u_t: vec4u_sub)(a, b)
+
+#define la_mul(a, b)                                                           \
+    _Generic((a),                                                              \
+        vec2f_t: vec2f_mul,                                                    \
+        vec2d_t: vec2d_mul,                                                    \
+        vec2i_t: vec2i_mul,                                                    \
+        vec2u_t: vec2u_mul,                                                    \
+        vec3f_t: vec3f_mul,                                                    \
+        vec3d_t: vec3d_mul,                                                    \
+        vec3i_t: vec3i_mul,                                                    \
+        vec3u_t: vec3u_mul,                                                    \
+        vec4f_t: vec4f_mul,                                                    \
+        vec4d_t: vec4d_mul,                                                    \
+        vec4i_t: vec4i_mul,                                                    \
+        vec4u_t: vec4u_mul,                                                    \
+        mat2f_t: _Generic((b),                                                 \
+            mat2f_t: mat2f_mul,                                                \
+            mat2x3f_t: mat2f_mul_mat2x3f,                                      \
+            mat2x4f_t: mat2f_mul_mat2x4f,                                      \
+            default: mat2f_mul_vec),                                           \
+        mat2d_t: _Generic((b),                                                 \
+            mat2d_t: mat2d_mul,                                                \
+            mat2x3d_t: mat2d_mul_mat2x3d,                                      \
+            mat2x4d_t: mat2d_mul_mat2x4d,                                      \
+            default: mat2d_mul_vec),                                           \
+        mat2i_t: _Generic((b),                                                 \
+            mat2i_t: mat2i_mul,                                                \
+            mat2x3i_t: mat2i_mul_mat2x3i,                                      \
+            mat2x4i_t: mat2i_mul_mat2x4i,                                      \
+            default: mat2i_mul_vec),                                           \
+        mat2u_t: _Generic((b),                                                 \
+            mat2u_t: mat2u_mul,                                                \
+            mat2x3u_t: mat2u_mul_mat2x3u,                                      \
+            mat2x4u_t: mat2u_mul_mat2x4u,                                      \
+            default: mat2u_mul_vec),                                           \
+        mat2x3f_t: _Generic((b),                                               \
+            mat3x2f_t: mat2x3f_mul_mat3x2f,                                    \
+            mat3f_t: mat2x3f_mul_mat3f,                                        \
+            mat3x4f_t: mat2x3f_mul_mat3x4f,                                    \
+            default: mat2x3f_mul_vec),                                         \
+        mat2x3d_t: _Generic((b),                                               \
+            mat3x2d_t: mat2x3d_mul_mat3x2d,                                    \
+            mat3d_t: mat2x3d_mul_mat3d,                                        \
+            mat3x4d_t: mat2x3d_mul_mat3x4d,                                    \
+            default: mat2x3d_mul_vec),                                         \
+        mat2x3i_t: _Generic((b),                                               \
+            mat3x2i_t: mat2x3i_mul_mat3x2i,                                    \
+            mat3i_t: mat2x3i_mul_mat3i,                                        \
+            mat3x4i_t: mat2x3i_mul_mat3x4i,                                    \
+            default: mat2x3i_mul_vec),                                         \
+        mat2x3u_t: _Generic((b),                                               \
+            mat3x2u_t: mat2x3u_mul_mat3x2u,                                    \
+            mat3u_t: mat2x3u_mul_mat3u,                                        \
+            mat3x4u_t: mat2x3u_mul_mat3x4u,                                    \
+            default: mat2x3u_mul_vec),                                         \
+        mat2x4f_t: _Generic((b),                                               \
+            mat4x2f_t: mat2x4f_mul_mat4x2f,                                    \
+            mat4x3f_t: mat2x4f_mul_mat4x3f,                                    \
+            mat4f_t: mat2x4f_mul_mat4f,                                        \
+            default: mat2x4f_mul_vec),                                         \
+        mat2x4d_t: _Generic((b),                                               \
+            mat4x2d_t: mat2x4d_mul_mat4x2d,                                    \
+            mat4x3d_t: mat2x4d_mul_mat4x3d,                                    \
+            mat4d_t: mat2x4d_mul_mat4d,                                        \
+            default: mat2x4d_mul_vec),                                         \
+        mat2x4i_t: _Generic((b),                                               \
+            mat4x2i_t: mat2x4i_mul_mat4x2i,                                    \
+            mat4x3i_t: mat2x4i_mul_mat4x3i,                                    \
+            mat4i_t: mat2x4i_mul_mat4i,                                        \
+            default: mat2x4i_mul_vec),                                         \
+        mat2x4u_t: _Generic((b),                                               \
+            mat4x2u_t: mat2x4u_mul_mat4x2u,                                    \
+            mat4x3u_t: mat2x4u_mul_mat4x3u,                                    \
+            mat4u_t: mat2x4u_mul_mat4u,                                        \
+            default: mat2x4u_mul_vec),                                         \
+        mat3x2f_t: _Generic((b),                                               \
+            mat2f_t: mat3x2f_mul_mat2f,                                        \
+            mat2x3f_t: mat3x2f_mul_mat2x3f,                                    \
+            mat2x4f_t: mat3x2f_mul_mat2x4f,                                    \
+            default: mat3x2f_mul_vec),                                         \
+        mat3x2d_t: _Generic((b),                                               \
+            mat2d_t: mat3x2d_mul_mat2d,                                        \
+            mat2x3d_t: mat3x2d_mul_mat2x3d,                                    \
+            mat2x4d_t: mat3x2d_mul_mat2x4d,                                    \
+            default: mat3x2d_mul_vec),                                         \
+        mat3x2i_t: _Generic((b),                                               \
+            mat2i_t: mat3x2i_mul_mat2i,                                        \
+            mat2x3i_t: mat3x2i_mul_mat2x3i,                                    \
+            mat2x4i_t: mat3x2i_mul_mat2x4i,                                    \
+            default: mat3x2i_mul_vec),                                         \
+        mat3x2u_t: _Generic((b),                                               \
+            mat2u_t: mat3x2u_mul_mat2u,                                        \
+            mat2x3u_t: mat3x2u_mul_mat2x3u,                                    \
+            mat2x4u_t: mat3x2u_mul_mat2x4u,                                    \
+            default: mat3x2u_mul_vec),                                         \
+        mat3f_t: _Generic((b),                                                 \
+            mat3x2f_t: mat3f_mul_mat3x2f,                                      \
+            mat3f_t: mat3f_mul,                                                \
+            mat3x4f_t: mat3f_mul_mat3x4f,                                      \
+            default: mat3f_mul_vec),                                           \
+        mat3d_t: _Generic((b),                                                 \
+            mat3x2d_t: mat3d_mul_mat3x2d,                                      \
+            mat3d_t: mat3d_mul,                                                \
+            mat3x4d_t: mat3d_mul_mat3x4d,                                      \
+            default: mat3d_mul_vec),                                           \
+        mat3i_t: _Generic((b),                                                 \
+            mat3x2i_t: mat3i_mul_mat3x2i,                                      \
+            mat3i_t: mat3i_mul,                                                \
+            mat3x4i_t: mat3i_mul_mat3x4i,                                      \
+            default: mat3i_mul_vec),                                           \
+        mat3u_t: _Generic((b),                                                 \
+            mat3x2u_t: mat3u_mul_mat3x2u,                                      \
+            mat3u_t: mat3u_mul,                                                \
+            mat3x4u_t: mat3u_mul_mat3x4u,                                      \
+            default: mat3u_mul_vec),                                           \
+        mat3x4f_t: _Generic((b),                                               \
+            mat4x2f_t: mat3x4f_mul_mat4x2f,                                    \
+            mat4x3f_t: mat3x4f_mul_mat4x3f,                                    \
+            mat4f_t: mat3x4f_mul_mat4f,                                        \
+            default: mat3x4f_mul_vec),                                         \
+        mat3x4d_t: _Generic((b),                                               \
+            mat4x2d_t: mat3x4d_mul_mat4x2d,                                    \
+            mat4x3d_t: mat3x4d_mul_mat4x3d,                                    \
+            mat4d_t: mat3x4d_mul_mat4d,                                        \
+            default: mat3x4d_mul_vec),                                         \
+        mat3x4i_t: _Generic((b),                                               \
+            mat4x2i_t: mat3x4i_mul_mat4x2i,                                    \
+            mat4x3i_t: mat3x4i_mul_mat4x3i,                                    \
+            mat4i_t: mat3x4i_mul_mat4i,                                        \
+            default: mat3x4i_mul_vec),                                         \
+        mat3x4u_t: _Generic((b),                                               \
+            mat4x2u_t: mat3x4u_mul_mat4x2u,                                    \
+            mat4x3u_t: mat3x4u_mul_mat4x3u,                                    \
+            mat4u_t: mat3x4u_mul_mat4u,                                        \
+            default: mat3x4u_mul_vec),                                         \
+        mat4x2f_t: _Generic((b),                                               \
+            mat2f_t: mat4x2f_mul_mat2f,                                        \
+            mat2x3f_t: mat4x2f_mul_mat2x3f,                                    \
+            mat2x4f_t: mat4x2f_mul_mat2x4f,                                    \
+            default: mat4x2f_mul_vec),                                         \
+        mat4x2d_t: _Generic((b),                                               \
+            mat2d_t: mat4x2d_mul_mat2d,                                        \
+            mat2x3d_t: mat4x2d_mul_mat2x3d,                                    \
+            mat2x4d_t: mat4x2d_mul_mat2x4d,                                    \
+            default: mat4x2d_mul_vec),                                         \
+        mat4x2i_t: _Generic((b),                                               \
+            mat2i_t: mat4x2i_mul_mat2i,                                        \
+            mat2x3i_t: mat4x2i_mul_mat2x3i,                                    \
+            mat2x4i_t: mat4x2i_mul_mat2x4i,                                    \
+            default: mat4x2i_mul_vec),                                         \
+        mat4x2u_t: _Generic((b),                                               \
+            mat2u_t: mat4x2u_mul_mat2u,                                        \
+            mat2x3u_t: mat4x2u_mul_mat2x3u,                                    \
+            mat2x4u_t: mat4x2u_mul_mat2x4u,                                    \
+            default: mat4x2u_mul_vec),                                         \
+        mat4x3f_t: _Generic((b),                                               \
+            mat3x2f_t: mat4x3f_mul_mat3x2f,                                    \
+            mat3f_t: mat4x3f_mul_mat3f,                                        \
+            mat3x4f_t: mat4x3f_mul_mat3x4f,                                    \
+            default: mat4x3f_mul_vec),                                         \
+        mat4x3d_t: _Generic((b),                                               \
+            mat3x2d_t: mat4x3d_mul_mat3x2d,                                    \
+            mat3d_t: mat4x3d_mul_mat3d,                                        \
+            mat3x4d_t: mat4x3d_mul_mat3x4d,                                    \
+            default: mat4x3d_mul_vec),                                         \
+        mat4x3i_t: _Generic((b),                                               \
+            mat3x2i_t: mat4x3i_mul_mat3x2i,                                    \
+            mat3i_t: mat4x3i_mul_mat3i,                                        \
+            mat3x4i_t: mat4x3i_mul_mat3x4i,                                    \
+            default: mat4x3i_mul_vec),                                         \
+        mat4x3u_t: _Generic((b),                                               \
+            mat3x2u_t: mat4x3u_mul_mat3x2u,                                    \
+            mat3u_t: mat4x3u_mul_mat3u,                                        \
+            mat3x4u_t: mat4x3u_mul_mat3x4u,                                    \
+            default: mat4x3u_mul_vec),                                         \
+        mat4f_t: _Generic((b),                                                 \
+            mat4x2f_t: mat4f_mul_mat4x2f,                                      \
+            mat4x3f_t: mat4f_mul_mat4x3f,                                      \
+            mat4f_t: mat4f_mul,                                                \
+            default: mat4f_mul_vec),                                           \
+        mat4d_t: _Generic((b),                                                 \
+            mat4x2d_t: mat4d_mul_mat4x2d,                                      \
+            mat4x3d_t: mat4d_mul_mat4x3d,                                      \
+            mat4d_t: mat4d_mul,                                                \
+            default: mat4d_mul_vec),                                           \
+        mat4i_t: _Generic((b),                                                 \
+            mat4x2i_t: mat4i_mul_mat4x2i,                                      \
+            mat4x3i_t: mat4i_mul_mat4x3i,                                      \
+            mat4i_t: mat4i_mul,                                                \
+            default: mat4i_mul_vec),                                           \
+        mat4u_t: _Generic((b),                                                 \
+            mat4x2u_t: mat4u_mul_mat4x2u,                                      \
+            mat4x3u_t: mat4u_mul_mat4x3u,                                      \
+            mat4u_t: mat4u_mul,                                                \
+            default: mat4u_mul_vec),                                           \
+        quatf_t: quatf_mul,                                                    \
+        quatd_t: quatd_mul)(a, b)
+
+#define la_div(a, b)                                                           \
+    _Generic((a),                                                              \
+        vec2f_t: vec2f_div,                                                    \
+        vec2d_t: vec2d_div,                                                    \
+        vec2i_t: vec2i_div,                                                    \
+        vec2u_t: vec2u_div,                                                    \
+        vec3f_t: vec3f_div,                                                    \
+        vec3d_t: vec3d_div,                                                    \
+        vec3i_t: vec3i_div,                                                    \
+        vec3u_t: vec3u_div,                                                    \
+        vec4f_t: vec4f_div,                                                    \
+        vec4d_t: vec4d_div,                                                    \
+        vec4i_t: vec4i_div,                                                    \
+        vec4u_t: vec4u_div)(a, b)
+
+#define la_dot(a, b)                                                           \
+    _Generic((a),                                                              \
+        vec2f_t: vec2f_dot,                                                    \
+        vec2d_t: vec2d_dot,                                                    \
+        vec2i_t: vec2i_dot,                                                    \
+        vec2u_t: vec2u_dot,                                                    \
+        vec3f_t: vec3f_dot,                                                    \
+        vec3d_t: vec3d_dot,                                                    \
+        vec3i_t: vec3i_dot,                                                    \
+        vec3u_t: vec3u_dot,                                                    \
+        vec4f_t: vec4f_dot,                                                    \
+        vec4d_t: vec4d_dot,                                                    \
+        vec4i_t: vec4i_dot,                                                    \
+        vec4u_t: vec4u_dot)(a, b)
+
+#define la_cross(a, b)                                                         \
+    _Generic((a),                                                              \
+        vec2f_t: vec2f_cross,                                                  \
+        vec2d_t: vec2d_cross,                                                  \
+        vec2i_t: vec2i_cross,                                                  \
+        vec2u_t: vec2u_cross,                                                  \
+        vec3f_t: vec3f_cross,                                                  \
+        vec3d_t: vec3d_cross,                                                  \
+        vec3i_t: vec3i_cross,                                                  \
+        vec3u_t: vec3u_cross)(a, b)
+
+#define la_length(v)                                                           \
+    _Generic((v),                                                              \
+        vec2f_t: vec2f_2norm,                                                  \
+        vec2d_t: vec2d_2norm,                                                  \
+        vec3f_t: vec3f_2norm,                                                  \
+        vec3d_t: vec3d_2norm,                                                  \
+        vec4f_t: vec4f_2norm,                                                  \
+        vec4d_t: vec4d_2norm)(v)
+
+#define la_unit(v)                                                             \
+    _Generic((v),                                                              \
+        vec2f_t: vec2f_unit,                                                   \
+        vec2d_t: vec2d_unit,                                                   \
+        vec3f_t: vec3f_unit,                                                   \
+        vec3d_t: vec3d_unit,                                                   \
+        vec4f_t: vec4f_unit,                                                   \
+        vec4d_t: vec4d_unit)(v)
+
+#define la_transpose(M)                                                        \
+    _Generic((M),                                                              \
+        mat2f_t: mat2f_transpose,                                              \
+        mat2d_t: mat2d_transpose,                                              \
+        mat2i_t: mat2i_transpose,                                              \
+        mat2u_t: mat2u_transpose,                                              \
+        mat2x3f_t: mat2x3f_transpose,                                          \
+        mat2x3d_t: mat2x3d_transpose,                                          \
+        mat2x3i_t: mat2x3i_transpose,                                          \
+        mat2x3u_t: mat2x3u_transpose,                                          \
+        mat2x4f_t: mat2x4f_transpose,                                          \
+        mat2x4d_t: mat2x4d_transpose,                                          \
+        mat2x4i_t: mat2x4i_transpose,                                          \
+        mat2x4u_t: mat2x4u_transpose,                                          \
+        mat3x2f_t: mat3x2f_transpose,                                          \
+        mat3x2d_t: mat3x2d_transpose,                                          \
+        mat3x2i_t: mat3x2i_transpose,                                          \
+        mat3x2u_t: mat3x2u_transpose,                                          \
+        mat3f_t: mat3f_transpose,                                              \
+        mat3d_t: mat3d_transpose,                                              \
+        mat3i_t: mat3i_transpose,                                              \
+        mat3u_t: mat3u_transpose,                                              \
+        mat3x4f_t: mat3x4f_transpose,                                          \
+        mat3x4d_t: mat3x4d_transpose,                                          \
+        mat3x4i_t: mat3x4i_transpose,                                          \
+        mat3x4u_t: mat3x4u_transpose,                                          \
+        mat4x2f_t: mat4x2f_transpose,                                          \
+        mat4x2d_t: mat4x2d_transpose,                                          \
+        mat4x2i_t: mat4x2i_transpose,                                          \
+        mat4x2u_t: mat4x2u_transpose,                                          \
+        mat4x3f_t: mat4x3f_transpose,                                          \
+        mat4x3d_t: mat4x3d_transpose,                                          \
+        mat4x3i_t: mat4x3i_transpose,                                          \
+        mat4x3u_t: mat4x3u_transpose,                                          \
+        mat4f_t: mat4f_transpose,                                              \
+        mat4d_t: mat4d_transpose,                                              \
+        mat4i_t: mat4i_transpose,                                              \
+        mat4u_t: mat4u_transpose)(M)
+
+#define la_inverse(M)                                                          \
+    _Generic((M),                                                              \
+        mat2f_t: mat2f_inverse,                                                \
+        mat2d_t: mat2d_inverse,                                                \
+        mat3f_t: mat3f_inverse,                                                \
+        mat3d_t: mat3d_inverse,                                                \
+        mat4f_t: mat4f_inverse,                                                \
+        mat4d_t: mat4d_inverse,                                                \
+        quatf_t: quatf_inverse,                                                \
+        quatd_t: quatd_inverse)(M)
+
+#define la_transform(M, in, out, n)                                            \
+    _Generic(*(M),                                                             \
+        mat2f_t: mat2f_transform_array,                                        \
+        mat2d_t: mat2d_transform_array,                                        \
+        mat2i_t: mat2i_transform_array,                                        \
+        mat2u_t: mat2u_transform_array,                                        \
+        mat2x3f_t: mat2x3f_transform_affine_array,                             \
+        mat2x3d_t: mat2x3d_transform_affine_array,                             \
+        mat2x3i_t: mat2x3i_transform_affine_array,                             \
+        mat2x3u_t: mat2x3u_transform_affine_array,                             \
+        mat3f_t: mat3f_transform_array,                                        \
+        mat3d_t: mat3d_transform_array,                                        \
+        mat3i_t: mat3i_transform_array,                                        \
+        mat3u_t: mat3u_transform_array,                                        \
+        mat3x4f_t: mat3x4f_transform_affine_array,                             \
+        mat3x4d_t: mat3x4d_transform_affine_array,                             \
+        mat3x4i_t: mat3x4i_transform_affine_array,                             \
+        mat3x4u_t: mat3x4u_transform_affine_array,                             \
+        mat4f_t: mat4f_transform_array,                                        \
+        mat4d_t: mat4d_transform_array,                                        \
+        mat4i_t: mat4i_transform_array,                                        \
+        mat4u_t: mat4u_transform_array)(M, in, out, n)
+
 #endif // LINALG_H
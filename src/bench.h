@@ -0,0 +1,166 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+/* Minimal micro-benchmark harness.
+ *
+ * A benchmark case is a function running its kernel `reps` times, where one
+ * run performs `ops` operations (e.g. one call per element of a batch). Each
+ * case is calibrated so that a sample lasts at least BENCH_MIN_SAMPLE_NS, is
+ * warmed up, then timed BENCH_SAMPLES times. Results are reported per
+ * operation as one CSV line:
+ *
+ *     label,group,function,dim,type,ops,ns_median,ns_p99,cycles_median,mops
+ *
+ * where `label` identifies the run (e.g. the compiler flags), so that the
+ * output of several runs can be concatenated and compared.
+ */
+
+#ifndef _DEFAULT_SOURCE
+#define _DEFAULT_SOURCE // clock_gettime() and CLOCK_MONOTONIC
+#endif                  // _DEFAULT_SOURCE
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define BENCH_HAS_TSC
+#endif
+
+#ifndef BENCH_DEF
+#define BENCH_DEF static inline
+#endif // BENCH_DEF
+
+#ifndef BENCH_SAMPLES
+#define BENCH_SAMPLES 101
+#endif // BENCH_SAMPLES
+
+#ifndef BENCH_WARMUP_SAMPLES
+#define BENCH_WARMUP_SAMPLES 5
+#endif // BENCH_WARMUP_SAMPLES
+
+#ifndef BENCH_MIN_SAMPLE_NS
+#define BENCH_MIN_SAMPLE_NS 10000
+#endif // BENCH_MIN_SAMPLE_NS
+
+#ifndef BENCH_LABEL
+#define BENCH_LABEL "default"
+#endif // BENCH_LABEL
+
+// Forces the compiler to assume that memory is read and written, so results
+// stored by a kernel are not optimized away.
+#define BENCH_CLOBBER() __asm__ volatile("" : : : "memory")
+
+typedef void (*bench_fn_t)(size_t reps);
+
+typedef struct {
+    const char *group;
+    const char *function;
+    size_t dim;
+    const char *type;
+    size_t ops; // Operations performed by one repetition.
+    bench_fn_t fn;
+} bench_case_t;
+
+typedef struct {
+    double ns_median;
+    double ns_p99;
+    double cycles_median;
+} bench_result_t;
+
+BENCH_DEF unsigned long long bench_now_ns(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (unsigned long long)now.tv_sec * 1000000000ULL +
+           (unsigned long long)now.tv_nsec;
+}
+
+// NOTE: the time stamp counter ticks at a constant (nominal) rate on recent
+// x86 processors, so these are reference cycles rather than core cycles.
+BENCH_DEF unsigned long long bench_cycles(void) {
+#ifdef BENCH_HAS_TSC
+    return __rdtsc();
+#else
+    return 0;
+#endif // BENCH_HAS_TSC
+}
+
+BENCH_DEF void bench_sort(double *xs, size_t n) {
+    for (size_t i = 1; i < n; ++i) {
+        double x = xs[i];
+        size_t j = i;
+        for (; j > 0 && xs[j - 1] > x; --j) {
+            xs[j] = xs[j - 1];
+        }
+        xs[j] = x;
+    }
+}
+
+BENCH_DEF bench_result_t bench_measure(const bench_case_t *bench) {
+    // Calibrate the number of repetitions per sample.
+    size_t reps = 1;
+    for (;;) {
+        unsigned long long start = bench_now_ns();
+        bench->fn(reps);
+        if (bench_now_ns() - start >= BENCH_MIN_SAMPLE_NS) {
+            break;
+        }
+        reps *= 2;
+    }
+    for (size_t i = 0; i < BENCH_WARMUP_SAMPLES; ++i) {
+        bench->fn(reps);
+    }
+
+    double ns[BENCH_SAMPLES];
+    double cycles[BENCH_SAMPLES];
+    double ops = (double)(reps * bench->ops);
+    for (size_t i = 0; i < BENCH_SAMPLES; ++i) {
+        unsigned long long start_ns = bench_now_ns();
+        unsigned long long start_cycles = bench_cycles();
+        bench->fn(reps);
+        unsigned long long end_cycles = bench_cycles();
+        unsigned long long end_ns = bench_now_ns();
+        ns[i] = (double)(end_ns - start_ns) / ops;
+        cycles[i] = (double)(end_cycles - start_cycles) / ops;
+    }
+    bench_sort(ns, BENCH_SAMPLES);
+    bench_sort(cycles, BENCH_SAMPLES);
+
+    size_t p99 = (BENCH_SAMPLES * 99 + 99) / 100 - 1; // ceil(0.99 * n) - 1
+    return (bench_result_t){
+        .ns_median = ns[BENCH_SAMPLES / 2],
+        .ns_p99 = ns[p99],
+        .cycles_median = cycles[BENCH_SAMPLES / 2],
+    };
+}
+
+BENCH_DEF void bench_print_header(FILE *stream) {
+    fprintf(stream, "label,group,function,dim,type,ops,ns_median,ns_p99,"
+                    "cycles_median,mops\n");
+}
+
+BENCH_DEF void bench_print_result(FILE *stream, const bench_case_t *bench,
+                                  bench_result_t result) {
+    fprintf(stream, "%s,%s,%s,%zu,%s,%zu,%.3f,%.3f,%.2f,%.2f\n", BENCH_LABEL,
+            bench->group, bench->function, bench->dim, bench->type, bench->ops,
+            result.ns_median, result.ns_p99, result.cycles_median,
+            1e3 / result.ns_median);
+}
+
+// Runs every case whose function name contains `filter` (NULL runs them all)
+// and prints the results as CSV.
+BENCH_DEF void bench_run(const bench_case_t *benches, size_t n,
+                         const char *filter, FILE *stream) {
+    bench_print_header(stream);
+    for (size_t i = 0; i < n; ++i) {
+        if (filter != NULL && strstr(benches[i].function, filter) == NULL) {
+            continue;
+        }
+        bench_result_t result = bench_measure(&benches[i]);
+        bench_print_result(stream, &benches[i], result);
+        fflush(stream);
+    }
+}
+
+#endif // BENCH_H
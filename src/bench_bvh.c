@@ -0,0 +1,192 @@
+/* Benchmark of `linalg_bvh.h`, in the CSV format of `bench.h`: one operation
+ * is one ray (or query point, or triangle for the builds), so the `mops`
+ * column is in millions of rays per second.
+ *
+ * The scene is a bumpy sphere (a displaced latitude-longitude grid) in a
+ * cloud of small triangles. Primary rays come from a pinhole camera in front
+ * of it, random rays from random points inside the scene, and the closest
+ * point queries from points near the surface of the sphere.
+ *
+ * Usage: bench_bvh [function name filter]
+ */
+
+#include "bench.h"
+#define LINALG_IMPLEMENTATION
+#include "linalg_bvh.h"
+
+#define BENCH_GRID 256                // Sphere of 2 * 256 * 256 triangles.
+#define BENCH_CLOUD (4 * 1024)        // Small triangles around the sphere.
+#define BENCH_TRIANGLES (2 * BENCH_GRID * BENCH_GRID + BENCH_CLOUD)
+#define BENCH_RAYS (128 * 128)        // Rays per repetition.
+#define BENCH_BRUTE_FORCE_RAYS 4
+
+static vec3f_t bench_vertices[3 * BENCH_TRIANGLES];
+static linalg_bvh_ray_t bench_primary[BENCH_RAYS], bench_random[BENCH_RAYS];
+static vec3f_t bench_points[BENCH_RAYS];
+static linalg_bvh_t bench_bvh;
+static varia_arena_t bench_arena, bench_build_arena;
+static thread_pool_t bench_pool;
+static volatile uint32_t bench_sink;
+
+static uint32_t bench_rng = 1;
+
+static float bench_random_float(float min, float max) {
+    bench_rng = bench_rng * 1664525u + 1013904223u;
+    return min + (max - min) * (float)(bench_rng >> 8) / (float)(1 << 24);
+}
+
+static vec3f_t bench_random_vec3f(float min, float max) {
+    float x = bench_random_float(min, max);
+    float y = bench_random_float(min, max);
+    return vec3f(x, y, bench_random_float(min, max));
+}
+
+static vec3f_t bench_sphere_point(size_t i, size_t j) {
+    float theta = pi_f * (float)i / BENCH_GRID;
+    float phi = 2 * pi_f * (float)j / BENCH_GRID;
+    float r = 1 + 0.05f * sinf(8 * theta) * cosf(6 * phi);
+    return vec3f(r * sinf(theta) * cosf(phi), r * cosf(theta),
+                 r * sinf(theta) * sinf(phi));
+}
+
+static void bench_init(void) {
+    vec3f_t *v = bench_vertices;
+    for (size_t i = 0; i < BENCH_GRID; ++i) {
+        for (size_t j = 0; j < BENCH_GRID; ++j) {
+            vec3f_t a = bench_sphere_point(i, j);
+            vec3f_t b = bench_sphere_point(i + 1, j);
+            vec3f_t c = bench_sphere_point(i + 1, j + 1);
+            vec3f_t d = bench_sphere_point(i, j + 1);
+            *v++ = a, *v++ = b, *v++ = c;
+            *v++ = a, *v++ = c, *v++ = d;
+        }
+    }
+    for (size_t i = 0; i < BENCH_CLOUD; ++i) {
+        vec3f_t center = bench_random_vec3f(-3, 3);
+        for (size_t j = 0; j < 3; ++j) {
+            *v++ = vec3f_add(center, bench_random_vec3f(-0.05f, 0.05f));
+        }
+    }
+
+    for (size_t y = 0; y < 128; ++y) {
+        for (size_t x = 0; x < 128; ++x) {
+            vec3f_t direction =
+                vec3f((float)x / 64 - 1, (float)y / 64 - 1, 1.5f);
+            bench_primary[y * 128 + x] = (linalg_bvh_ray_t){
+                vec3f(0, 0, -4), vec3f_unit(direction), INFINITY};
+        }
+    }
+    for (size_t i = 0; i < BENCH_RAYS; ++i) {
+        bench_random[i] = (linalg_bvh_ray_t){
+            bench_random_vec3f(-3, 3), vec3f_unit(bench_random_vec3f(-1, 1)),
+            INFINITY};
+        vec3f_t p = bench_sphere_point(i % BENCH_GRID, i / BENCH_GRID * 4);
+        bench_points[i] = vec3f_add(p, bench_random_vec3f(-0.2f, 0.2f));
+    }
+
+    if (!thread_pool_init(&bench_pool, 0)) {
+        fprintf(stderr, "Could not start the thread pool.\n");
+        exit(1);
+    }
+    linalg_bvh_build(&bench_bvh, &bench_arena, &bench_pool, bench_vertices,
+                     BENCH_TRIANGLES);
+}
+
+static void bench_build(size_t reps) {
+    for (size_t rep = 0; rep < reps; ++rep) {
+        linalg_bvh_t bvh;
+        linalg_bvh_build(&bvh, &bench_build_arena, NULL, bench_vertices,
+                         BENCH_TRIANGLES);
+        bench_sink = (uint32_t)bvh.num_nodes;
+        varia_arena_reset(&bench_build_arena);
+    }
+}
+
+static void bench_build_parallel(size_t reps) {
+    for (size_t rep = 0; rep < reps; ++rep) {
+        linalg_bvh_t bvh;
+        linalg_bvh_build(&bvh, &bench_build_arena, &bench_pool,
+                         bench_vertices, BENCH_TRIANGLES);
+        bench_sink = (uint32_t)bvh.num_nodes;
+        varia_arena_reset(&bench_build_arena);
+    }
+}
+
+static void bench_intersect(const linalg_bvh_ray_t *rays, size_t reps) {
+    for (size_t rep = 0; rep < reps; ++rep) {
+        uint32_t sum = 0;
+        for (size_t i = 0; i < BENCH_RAYS; ++i) {
+            linalg_bvh_hit_t hit;
+            linalg_bvh_intersect(&bench_bvh, rays[i], &hit);
+            sum += hit.triangle;
+        }
+        bench_sink = sum;
+    }
+}
+
+static void bench_intersect_primary(size_t reps) {
+    bench_intersect(bench_primary, reps);
+}
+
+static void bench_intersect_random(size_t reps) {
+    bench_intersect(bench_random, reps);
+}
+
+static void bench_closest_point(size_t reps) {
+    for (size_t rep = 0; rep < reps; ++rep) {
+        uint32_t sum = 0;
+        for (size_t i = 0; i < BENCH_RAYS; ++i) {
+            linalg_bvh_closest_t closest;
+            linalg_bvh_closest_point(&bench_bvh, bench_points[i], INFINITY,
+                                     &closest);
+            sum += closest.triangle;
+        }
+        bench_sink = sum;
+    }
+}
+
+// The loop the BVH replaces.
+static void bench_brute_force(size_t reps) {
+    for (size_t rep = 0; rep < reps; ++rep) {
+        uint32_t sum = 0;
+        for (size_t i = 0; i < BENCH_BRUTE_FORCE_RAYS; ++i) {
+            linalg_bvh_ray_t ray = bench_primary[i * BENCH_RAYS / 4 + 64];
+            float best = INFINITY;
+            for (size_t j = 0; j < BENCH_TRIANGLES; ++j) {
+                const vec3f_t *v = &bench_vertices[3 * j];
+                float t, u, w;
+                if (linalg_ray_triangle(ray.origin, ray.direction, v[0], v[1],
+                                        v[2], &t, &u, &w) &&
+                    t >= 0 && t < best) {
+                    best = t;
+                    sum = (uint32_t)j;
+                }
+            }
+        }
+        bench_sink = sum;
+    }
+}
+
+static const bench_case_t benches[] = {
+    {"bvh", "linalg_bvh_build", 3, "float", BENCH_TRIANGLES, bench_build},
+    {"bvh", "linalg_bvh_build_parallel", 3, "float", BENCH_TRIANGLES,
+     bench_build_parallel},
+    {"bvh", "linalg_bvh_intersect_primary", 3, "float", BENCH_RAYS,
+     bench_intersect_primary},
+    {"bvh", "linalg_bvh_intersect_random", 3, "float", BENCH_RAYS,
+     bench_intersect_random},
+    {"bvh", "linalg_bvh_closest_point", 3, "float", BENCH_RAYS,
+     bench_closest_point},
+    {"bvh", "brute_force_intersect", 3, "float", BENCH_BRUTE_FORCE_RAYS,
+     bench_brute_force},
+};
+
+int main(int argc, char **argv) {
+    bench_init();
+    const char *filter = argc > 1 ? argv[1] : NULL;
+    bench_run(benches, sizeof(benches) / sizeof(benches[0]), filter, stdout);
+    thread_pool_free(&bench_pool);
+    varia_arena_free(&bench_arena);
+    varia_arena_free(&bench_build_arena);
+    return 0;
+}
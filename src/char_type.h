@@ -15,6 +15,171 @@
 #define CTYPE_DEF static inline
 #endif // CTYPE_DEF
 
+#include <stddef.h>
+
+// NOTE: the bulk functions (`ct_*_buffer`, `ct_span_while`) process 32 (AVX2)
+// or 16 (SSSE3) bytes at a time. The instruction set is chosen at compile time
+// (e.g. `-march=native`); other targets use the scalar fallback.
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define CT_SIMD_WIDTH 32
+typedef __m256i ct_simd_t;
+#define ct_simd_load(ptr) _mm256_loadu_si256((const __m256i *)(ptr))
+#define ct_simd_store(ptr, v) _mm256_storeu_si256((__m256i *)(ptr), v)
+#define ct_simd_splat(byte) _mm256_set1_epi8((char)(byte))
+// NOTE: the byte shuffle looks up each 128-bit lane separately, so 16-byte
+// tables are loaded in both lanes.
+#define ct_simd_table(ptr)                                                     \
+    _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)(ptr)))
+#define ct_simd_lookup(table, index) _mm256_shuffle_epi8(table, index)
+#define ct_simd_eq(a, b) _mm256_cmpeq_epi8(a, b)
+#define ct_simd_and(a, b) _mm256_and_si256(a, b)
+#define ct_simd_andnot(a, b) _mm256_andnot_si256(a, b)
+#define ct_simd_or(a, b) _mm256_or_si256(a, b)
+#define ct_simd_sub(a, b) _mm256_sub_epi8(a, b)
+#define ct_simd_min_u8(a, b) _mm256_min_epu8(a, b)
+#define ct_simd_srli16(v, n) _mm256_srli_epi16(v, n)
+#define ct_simd_mask(v) ((unsigned)_mm256_movemask_epi8(v))
+// Interleaves the bytes of `lo` and `hi` into 16-bit lanes, in memory order.
+#define ct_simd_widen_first(lo, hi)                                            \
+    _mm256_unpacklo_epi8(_mm256_permute4x64_epi64(lo, 0xD8),                   \
+                         _mm256_permute4x64_epi64(hi, 0xD8))
+#define ct_simd_widen_second(lo, hi)                                           \
+    _mm256_unpackhi_epi8(_mm256_permute4x64_epi64(lo, 0xD8),                   \
+                         _mm256_permute4x64_epi64(hi, 0xD8))
+#elif defined(__SSSE3__)
+#include <tmmintrin.h>
+#define CT_SIMD_WIDTH 16
+typedef __m128i ct_simd_t;
+#define ct_simd_load(ptr) _mm_loadu_si128((const __m128i *)(ptr))
+#define ct_simd_store(ptr, v) _mm_storeu_si128((__m128i *)(ptr), v)
+#define ct_simd_splat(byte) _mm_set1_epi8((char)(byte))
+#define ct_simd_table(ptr) _mm_loadu_si128((const __m128i *)(ptr))
+#define ct_simd_lookup(table, index) _mm_shuffle_epi8(table, index)
+#define ct_simd_eq(a, b) _mm_cmpeq_epi8(a, b)
+#define ct_simd_and(a, b) _mm_and_si128(a, b)
+#define ct_simd_andnot(a, b) _mm_andnot_si128(a, b)
+#define ct_simd_or(a, b) _mm_or_si128(a, b)
+#define ct_simd_sub(a, b) _mm_sub_epi8(a, b)
+#define ct_simd_min_u8(a, b) _mm_min_epu8(a, b)
+#define ct_simd_srli16(v, n) _mm_srli_epi16(v, n)
+#define ct_simd_mask(v) ((unsigned)_mm_movemask_epi8(v))
+#define ct_simd_widen_first(lo, hi) _mm_unpacklo_epi8(lo, hi)
+#define ct_simd_widen_second(lo, hi) _mm_unpackhi_epi8(lo, hi)
+#endif
+
+// Character classes, as bits of a class mask. A character can be in several
+// classes, and all of them are found with a single load from `ct_class_table`.
+enum {
+    CT_CNTRL = 1 << 0,
+    CT_SPACE = 1 << 1,
+    CT_BLANK = 1 << 2,
+    CT_UPPER = 1 << 3,
+    CT_LOWER = 1 << 4,
+    CT_DIGIT = 1 << 5,
+    CT_HEX_LETTER = 1 << 6, // 'a' to 'f' and 'A' to 'F'
+    CT_PUNCT = 1 << 7,
+    CT_PRINT_SPACE = 1 << 8, // ' ' (printable, but not graphical)
+    CT_NUM_CLASSES = 9,
+
+    CT_ALPHA = CT_UPPER | CT_LOWER,
+    CT_ALNUM = CT_ALPHA | CT_DIGIT,
+    CT_XDIGIT = CT_DIGIT | CT_HEX_LETTER,
+    CT_GRAPH = CT_ALNUM | CT_PUNCT,
+    CT_PRINT = CT_GRAPH | CT_PRINT_SPACE,
+};
+
+#define CT__C CT_CNTRL
+#define CT__CS (CT_CNTRL | CT_SPACE)
+#define CT__CSB (CT_CNTRL | CT_SPACE | CT_BLANK)
+#define CT__SP (CT_SPACE | CT_BLANK | CT_PRINT_SPACE)
+#define CT__P CT_PUNCT
+#define CT__D CT_DIGIT
+#define CT__U CT_UPPER
+#define CT__UX (CT_UPPER | CT_HEX_LETTER)
+#define CT__L CT_LOWER
+#define CT__LX (CT_LOWER | CT_HEX_LETTER)
+
+// Classes of every byte. Non-ASCII bytes (0x80 to 0xFF) have no class.
+static constexpr unsigned short ct_class_table[256] = {
+    CT__C, CT__C, CT__C, CT__C, CT__C, CT__C, CT__C, CT__C,       // 0x00
+    CT__C, CT__CSB, CT__CS, CT__CS, CT__CS, CT__CS, CT__C, CT__C, // 0x08
+    CT__C, CT__C, CT__C, CT__C, CT__C, CT__C, CT__C, CT__C,       // 0x10
+    CT__C, CT__C, CT__C, CT__C, CT__C, CT__C, CT__C, CT__C,       // 0x18
+    CT__SP, CT__P, CT__P, CT__P, CT__P, CT__P, CT__P, CT__P,      // 0x20
+    CT__P, CT__P, CT__P, CT__P, CT__P, CT__P, CT__P, CT__P,       // 0x28
+    CT__D, CT__D, CT__D, CT__D, CT__D, CT__D, CT__D, CT__D,       // 0x30
+    CT__D, CT__D, CT__P, CT__P, CT__P, CT__P, CT__P, CT__P,       // 0x38
+    CT__P, CT__UX, CT__UX, CT__UX, CT__UX, CT__UX, CT__UX, CT__U, // 0x40
+    CT__U, CT__U, CT__U, CT__U, CT__U, CT__U, CT__U, CT__U,       // 0x48
+    CT__U, CT__U, CT__U, CT__U, CT__U, CT__U, CT__U, CT__U,       // 0x50
+    CT__U, CT__U, CT__U, CT__P, CT__P, CT__P, CT__P, CT__P,       // 0x58
+    CT__P, CT__LX, CT__LX, CT__LX, CT__LX, CT__LX, CT__LX, CT__L, // 0x60
+    CT__L, CT__L, CT__L, CT__L, CT__L, CT__L, CT__L, CT__L,       // 0x68
+    CT__L, CT__L, CT__L, CT__L, CT__L, CT__L, CT__L, CT__L,       // 0x70
+    CT__L, CT__L, CT__L, CT__P, CT__P, CT__P, CT__P, CT__C,       // 0x78
+};
+
+#undef CT__C
+#undef CT__CS
+#undef CT__CSB
+#undef CT__SP
+#undef CT__P
+#undef CT__D
+#undef CT__U
+#undef CT__UX
+#undef CT__L
+#undef CT__LX
+
+// The class table split by nibbles, for vectorized lookups: bit `k` of
+// `ct_nibble_table[class][lo]` is set when the character `(k << 4) | lo` is in
+// the class (only ASCII characters have classes, so `k` < 8). A byte `c` is in
+// one of several classes when the OR of their tables at `c & 0xF`, ANDed with
+// `ct_high_nibble_bits[c >> 4]`, is not zero.
+static constexpr unsigned char ct_nibble_table[CT_NUM_CLASSES][16] = {
+    {0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+     0x03, 0x03, 0x03, 0x83}, // CT_CNTRL
+    {0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01,
+     0x01, 0x01, 0x00, 0x00}, // CT_SPACE
+    {0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00}, // CT_BLANK
+    {0x20, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x10,
+     0x10, 0x10, 0x10, 0x10}, // CT_UPPER
+    {0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x40,
+     0x40, 0x40, 0x40, 0x40}, // CT_LOWER
+    {0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00}, // CT_DIGIT
+    {0x00, 0x50, 0x50, 0x50, 0x50, 0x50, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00}, // CT_HEX_LETTER
+    {0x50, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0C, 0xAC,
+     0xAC, 0xAC, 0xAC, 0x2C}, // CT_PUNCT
+    {0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+     0x00, 0x00, 0x00, 0x00}, // CT_PRINT_SPACE
+};
+
+static constexpr unsigned char ct_high_nibble_bits[16] = {
+    0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+
+// Gets the classes of a character (0 for non-ASCII characters and EOF)
+CTYPE_DEF unsigned ct_class(int c);
+
+// Checks if a character is in any of the classes of `class_mask`
+CTYPE_DEF bool ct_is(int c, unsigned class_mask);
+
+// Writes the classes of each of the `len` bytes of `buf` to `classes`
+CTYPE_DEF void ct_classify_buffer(const unsigned char *buf, size_t len,
+                                  unsigned short *classes);
+
+// Converts `len` bytes to lowercase (`out` may be `buf`)
+CTYPE_DEF void ct_to_lower_buffer(const unsigned char *buf, size_t len,
+                                  unsigned char *out);
+
+// Finds the first byte that is in none of the classes of `class_mask` (returns
+// `len` if there is none)
+CTYPE_DEF size_t ct_span_while(const unsigned char *buf, size_t len,
+                               unsigned class_mask);
+
 // Checks if a character is alphanumeric
 CTYPE_DEF bool is_alnum(int c);
 
@@ -66,33 +231,39 @@ CTYPE_DEF int to_upper(int c);
 #define CTYPE_IMPLEMENTATION
 #ifdef CTYPE_IMPLEMENTATION
 
-CTYPE_DEF bool is_alnum(int c) { return is_alpha(c) || is_digit(c); }
+CTYPE_DEF unsigned ct_class(int c) {
+    return (unsigned)c < 256 ? ct_class_table[c] : 0;
+}
+
+CTYPE_DEF bool ct_is(int c, unsigned class_mask) {
+    return (ct_class(c) & class_mask) != 0;
+}
+
+CTYPE_DEF bool is_alnum(int c) { return ct_is(c, CT_ALNUM); }
 
-CTYPE_DEF bool is_alpha(int c) { return ((unsigned)c | 0x20) - 'a' < 26; }
+CTYPE_DEF bool is_alpha(int c) { return ct_is(c, CT_ALPHA); }
 
 CTYPE_DEF bool is_ascii(int c) { return (unsigned)c < 128; }
 
-CTYPE_DEF bool is_lower(int c) { return (unsigned)c - 'a' < 26; }
+CTYPE_DEF bool is_lower(int c) { return ct_is(c, CT_LOWER); }
 
-CTYPE_DEF bool is_upper(int c) { return (unsigned)c - 'A' < 26; }
+CTYPE_DEF bool is_upper(int c) { return ct_is(c, CT_UPPER); }
 
-CTYPE_DEF bool is_digit(int c) { return (unsigned)c - '0' < 10; }
+CTYPE_DEF bool is_digit(int c) { return ct_is(c, CT_DIGIT); }
 
-CTYPE_DEF bool is_xdigit(int c) {
-    return is_digit(c) || ((unsigned)c | 0x20) - 'a' < 6;
-}
+CTYPE_DEF bool is_xdigit(int c) { return ct_is(c, CT_XDIGIT); }
 
-CTYPE_DEF bool is_ctl(int c) { return (unsigned)c < 0x20 || c == 0x7F; }
+CTYPE_DEF bool is_ctl(int c) { return ct_is(c, CT_CNTRL); }
 
-CTYPE_DEF bool is_graph(int c) { return (unsigned)c - 0x21 < 0x5E; }
+CTYPE_DEF bool is_graph(int c) { return ct_is(c, CT_GRAPH); }
 
-CTYPE_DEF bool is_space(int c) { return c == ' ' || (unsigned)c - '\t' < 5; }
+CTYPE_DEF bool is_space(int c) { return ct_is(c, CT_SPACE); }
 
-CTYPE_DEF bool is_blank(int c) { return c == ' ' || c == '\t'; }
+CTYPE_DEF bool is_blank(int c) { return ct_is(c, CT_BLANK); }
 
-CTYPE_DEF bool is_printable(int c) { return (unsigned)c - 0x20 < 0x5F; }
+CTYPE_DEF bool is_printable(int c) { return ct_is(c, CT_PRINT); }
 
-CTYPE_DEF bool is_punct(int c) { return is_graph(c) && !is_alnum(c); }
+CTYPE_DEF bool is_punct(int c) { return ct_is(c, CT_PUNCT); }
 
 CTYPE_DEF int to_ascii(int c) { return c & 0x7F; }
 
@@ -110,6 +281,98 @@ CTYPE_DEF int to_upper(int c) {
     return c;
 }
 
+#ifdef CT_SIMD_WIDTH
+// Bits of `ct_high_nibble_bits` for each byte of `block`.
+CTYPE_DEF ct_simd_t ct_simd_high_nibble_bits(ct_simd_t block) {
+    ct_simd_t high_nibbles =
+        ct_simd_and(ct_simd_srli16(block, 4), ct_simd_splat(0x0F));
+    return ct_simd_lookup(ct_simd_table(ct_high_nibble_bits), high_nibbles);
+}
+
+// 0xFF in the lanes whose byte is in the classes of the nibble table `table`,
+// 0x00 elsewhere.
+CTYPE_DEF ct_simd_t ct_simd_in_classes(ct_simd_t block, ct_simd_t table) {
+    ct_simd_t low_nibbles = ct_simd_and(block, ct_simd_splat(0x0F));
+    ct_simd_t hits = ct_simd_and(ct_simd_lookup(table, low_nibbles),
+                                 ct_simd_high_nibble_bits(block));
+    return ct_simd_andnot(ct_simd_eq(hits, ct_simd_splat(0)),
+                          ct_simd_splat(0xFF));
+}
+#endif // CT_SIMD_WIDTH
+
+CTYPE_DEF void ct_classify_buffer(const unsigned char *buf, size_t len,
+                                  unsigned short *classes) {
+    size_t i = 0;
+#ifdef CT_SIMD_WIDTH
+    for (; i + CT_SIMD_WIDTH <= len; i += CT_SIMD_WIDTH) {
+        ct_simd_t block = ct_simd_load(buf + i);
+        // Low byte: one class per bit. High byte: only CT_PRINT_SPACE (' ').
+        ct_simd_t low = ct_simd_splat(0);
+        for (unsigned bit = 0; bit < 8; ++bit) {
+            ct_simd_t table = ct_simd_table(ct_nibble_table[bit]);
+            ct_simd_t in_class = ct_simd_in_classes(block, table);
+            low = ct_simd_or(low,
+                             ct_simd_and(in_class, ct_simd_splat(1 << bit)));
+        }
+        ct_simd_t high = ct_simd_and(ct_simd_eq(block, ct_simd_splat(' ')),
+                                     ct_simd_splat(CT_PRINT_SPACE >> 8));
+        ct_simd_store(classes + i, ct_simd_widen_first(low, high));
+        ct_simd_store(classes + i + CT_SIMD_WIDTH / 2,
+                      ct_simd_widen_second(low, high));
+    }
+#endif // CT_SIMD_WIDTH
+    for (; i < len; ++i) {
+        classes[i] = ct_class_table[buf[i]];
+    }
+}
+
+CTYPE_DEF void ct_to_lower_buffer(const unsigned char *buf, size_t len,
+                                  unsigned char *out) {
+    size_t i = 0;
+#ifdef CT_SIMD_WIDTH
+    for (; i + CT_SIMD_WIDTH <= len; i += CT_SIMD_WIDTH) {
+        ct_simd_t block = ct_simd_load(buf + i);
+        // Uppercase letters: (c - 'A') <= 25, as unsigned bytes.
+        ct_simd_t shifted = ct_simd_sub(block, ct_simd_splat('A'));
+        ct_simd_t upper =
+            ct_simd_eq(ct_simd_min_u8(shifted, ct_simd_splat(25)), shifted);
+        ct_simd_t lower_bit = ct_simd_and(upper, ct_simd_splat(0x20));
+        ct_simd_store(out + i, ct_simd_or(block, lower_bit));
+    }
+#endif // CT_SIMD_WIDTH
+    for (; i < len; ++i) {
+        out[i] = (unsigned char)to_lower(buf[i]);
+    }
+}
+
+CTYPE_DEF size_t ct_span_while(const unsigned char *buf, size_t len,
+                               unsigned class_mask) {
+    size_t i = 0;
+#ifdef CT_SIMD_WIDTH
+    if (len >= CT_SIMD_WIDTH) {
+        ct_simd_t table = ct_simd_splat(0);
+        for (unsigned bit = 0; bit < CT_NUM_CLASSES; ++bit) {
+            if (class_mask & (1u << bit)) {
+                table = ct_simd_or(table, ct_simd_table(ct_nibble_table[bit]));
+            }
+        }
+        for (; i + CT_SIMD_WIDTH <= len; i += CT_SIMD_WIDTH) {
+            ct_simd_t in_classes =
+                ct_simd_in_classes(ct_simd_load(buf + i), table);
+            unsigned outside =
+                ct_simd_mask(ct_simd_eq(in_classes, ct_simd_splat(0)));
+            if (outside != 0) {
+                return i + __builtin_ctz(outside);
+            }
+        }
+    }
+#endif // CT_SIMD_WIDTH
+    while (i < len && (ct_class_table[buf[i]] & class_mask)) {
+        ++i;
+    }
+    return i;
+}
+
 #endif // CTYPE_IMPLEMENTATION
 
 #endif // CTYPE_H
@@ -0,0 +1,786 @@
+#ifndef LINALG_BVH_H
+#define LINALG_BVH_H
+
+/* Bounding volume hierarchy over triangles, for ray and closest point
+ * queries against static meshes:
+ *
+ *     varia_arena_t arena = {0};
+ *     linalg_bvh_t bvh;
+ *     linalg_bvh_build(&bvh, &arena, &pool, vertices, n); // Or pool = NULL.
+ *     linalg_bvh_hit_t hit;
+ *     if (linalg_bvh_intersect(&bvh, ray, &hit)) {
+ *         ... hit.triangle, hit.t ...
+ *     }
+ *     varia_arena_free(&arena); // Releases the BVH.
+ *
+ * `vertices` holds 3 consecutive vertices per triangle; reported triangles
+ * are indices into it. The BVH keeps its own copy of the triangles, in leaf
+ * order, so the input can be released after the build.
+ *
+ * The tree is 4-wide: a node holds the bounds of its 4 children as SoA
+ * arrays, so a ray (or a point) is tested against all of them at once, with
+ * SSE under `LINALG_SIMD`. Nodes are 128 bytes (two cache lines, 96 bytes of
+ * bounds), and stored depth first, so the first child of a node usually
+ * follows it in memory.
+ *
+ * The builder splits ranges of triangles with the surface area heuristic,
+ * evaluated on LINALG_BVH_BINS bins of the centroids along the largest axis,
+ * and fills each node by splitting its largest child until it has 4. Given a
+ * pool, the bounds of the triangles and the binning of long ranges (at least
+ * LINALG_BVH_PARALLEL_MIN triangles, the top of the tree) run on it.
+ *
+ * Both queries keep a stack of nodes ordered front to back, and skip nodes
+ * further than the best result so far.
+ */
+
+#include <float.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "../linalg.h"
+#include "thread_pool.h"
+
+#ifndef LINALG_BVH_DEF
+#define LINALG_BVH_DEF static inline
+#endif // LINALG_BVH_DEF
+
+#define LINALG_BVH_WIDTH 4
+#ifndef LINALG_BVH_BINS
+#define LINALG_BVH_BINS 16
+#endif // LINALG_BVH_BINS
+// Ranges of at most this many triangles become leaves.
+#ifndef LINALG_BVH_LEAF_SIZE
+#define LINALG_BVH_LEAF_SIZE 4
+#endif // LINALG_BVH_LEAF_SIZE
+#ifndef LINALG_BVH_PARALLEL_MIN
+#define LINALG_BVH_PARALLEL_MIN (64 * 1024)
+#endif // LINALG_BVH_PARALLEL_MIN
+#define LINALG_BVH_PARALLEL_GRAIN (16 * 1024)
+// Below this depth, ranges are split at the median instead, so the tree is
+// at most LINALG_BVH_MAX_DEPTH + 32 levels deep for 32-bit triangle indices.
+#ifndef LINALG_BVH_MAX_DEPTH
+#define LINALG_BVH_MAX_DEPTH 32
+#endif // LINALG_BVH_MAX_DEPTH
+// A node pops one entry and pushes at most LINALG_BVH_WIDTH.
+#define LINALG_BVH_STACK                                                       \
+    ((LINALG_BVH_WIDTH - 1) * (LINALG_BVH_MAX_DEPTH + 32) + 1)
+#define LINALG_BVH_NONE UINT32_MAX
+
+typedef struct {
+    // Bounds of child k: (min_x[k], min_y[k], min_z[k]) to (max_x[k], ...).
+    // NOTE: empty slots have min > max, which no ray or point query accepts.
+    _Alignas(64) float min_x[LINALG_BVH_WIDTH];
+    float min_y[LINALG_BVH_WIDTH];
+    float min_z[LINALG_BVH_WIDTH];
+    float max_x[LINALG_BVH_WIDTH];
+    float max_y[LINALG_BVH_WIDTH];
+    float max_z[LINALG_BVH_WIDTH];
+    // Node index for a node, first triangle (in leaf order) for a leaf, or
+    // LINALG_BVH_NONE for an empty slot.
+    uint32_t child[LINALG_BVH_WIDTH];
+    uint32_t count[LINALG_BVH_WIDTH]; // Triangles of a leaf, 0 otherwise.
+} linalg_bvh_node_t;
+
+static_assert(sizeof(linalg_bvh_node_t) == 128, "Padded linalg_bvh_node_t.");
+
+typedef struct {
+    linalg_bvh_node_t *nodes; // The root is `nodes[0]`.
+    size_t num_nodes;
+    vec3f_t *vertices;  // 3 per triangle, in leaf order.
+    uint32_t *indices;  // Input index of each triangle, in leaf order.
+    size_t num_triangles;
+    vec3f_t min, max; // Bounds of the mesh.
+} linalg_bvh_t;
+
+typedef struct {
+    vec3f_t origin, direction;
+    float t_max; // Only hits with 0 <= t < t_max count (may be INFINITY).
+} linalg_bvh_ray_t;
+
+typedef struct {
+    float t;    // Hit point: origin + t * direction.
+    float u, v; // Barycentric coordinates of the second and third vertices.
+    uint32_t triangle;
+} linalg_bvh_hit_t;
+
+typedef struct {
+    vec3f_t point;
+    float distance2; // Squared distance to the query point.
+    uint32_t triangle;
+} linalg_bvh_closest_t;
+
+// Build the BVH of `n` triangles (3 consecutive vertices each) in `arena`.
+LINALG_BVH_DEF void linalg_bvh_build(linalg_bvh_t *bvh, varia_arena_t *arena,
+                                     thread_pool_t *pool,
+                                     const vec3f_t *vertices, size_t n);
+// Closest hit of the ray, if any.
+LINALG_BVH_DEF bool linalg_bvh_intersect(const linalg_bvh_t *bvh,
+                                         linalg_bvh_ray_t ray,
+                                         linalg_bvh_hit_t *hit);
+// Closest point of the mesh to `p` closer than `max_distance` (may be
+// INFINITY), if any.
+LINALG_BVH_DEF bool linalg_bvh_closest_point(const linalg_bvh_t *bvh,
+                                             vec3f_t p, float max_distance,
+                                             linalg_bvh_closest_t *closest);
+// Möller-Trumbore: the ray hits triangle abc at `origin + t * direction`, at
+// barycentric coordinates (u, v) of b and c.
+LINALG_BVH_DEF bool linalg_ray_triangle(vec3f_t origin, vec3f_t direction,
+                                        vec3f_t a, vec3f_t b, vec3f_t c,
+                                        float *t, float *u, float *v);
+LINALG_BVH_DEF vec3f_t linalg_closest_point_triangle(vec3f_t p, vec3f_t a,
+                                                     vec3f_t b, vec3f_t c);
+
+LINALG_BVH_DEF bool linalg_ray_triangle(vec3f_t origin, vec3f_t direction,
+                                        vec3f_t a, vec3f_t b, vec3f_t c,
+                                        float *t, float *u, float *v) {
+    vec3f_t e1 = vec3f_sub(b, a);
+    vec3f_t e2 = vec3f_sub(c, a);
+    vec3f_t p = vec3f_cross(direction, e2);
+    float det = vec3f_dot(e1, p);
+    if (fabsf(det) < 1e-12f) {
+        return false; // Parallel to the triangle (or degenerate).
+    }
+    float inv_det = 1 / det;
+    vec3f_t s = vec3f_sub(origin, a);
+    *u = vec3f_dot(s, p) * inv_det;
+    if (*u < 0 || *u > 1) {
+        return false;
+    }
+    vec3f_t q = vec3f_cross(s, e1);
+    *v = vec3f_dot(direction, q) * inv_det;
+    if (*v < 0 || *u + *v > 1) {
+        return false;
+    }
+    *t = vec3f_dot(e2, q) * inv_det;
+    return true;
+}
+
+// See Ericson, "Real-Time Collision Detection", 5.1.5: find the Voronoi
+// region of the triangle containing `p`, and project on it.
+LINALG_BVH_DEF vec3f_t linalg_closest_point_triangle(vec3f_t p, vec3f_t a,
+                                                     vec3f_t b, vec3f_t c) {
+    vec3f_t ab = vec3f_sub(b, a);
+    vec3f_t ac = vec3f_sub(c, a);
+    vec3f_t ap = vec3f_sub(p, a);
+    float d1 = vec3f_dot(ab, ap);
+    float d2 = vec3f_dot(ac, ap);
+    if (d1 <= 0 && d2 <= 0) {
+        return a;
+    }
+    vec3f_t bp = vec3f_sub(p, b);
+    float d3 = vec3f_dot(ab, bp);
+    float d4 = vec3f_dot(ac, bp);
+    if (d3 >= 0 && d4 <= d3) {
+        return b;
+    }
+    float vc = d1 * d4 - d3 * d2;
+    if (vc <= 0 && d1 >= 0 && d3 <= 0) {
+        float v = d1 / (d1 - d3);
+        return vec3f_add(a, vec3f_mul(ab, vec3f_splat(v)));
+    }
+    vec3f_t cp = vec3f_sub(p, c);
+    float d5 = vec3f_dot(ab, cp);
+    float d6 = vec3f_dot(ac, cp);
+    if (d6 >= 0 && d5 <= d6) {
+        return c;
+    }
+    float vb = d5 * d2 - d1 * d6;
+    if (vb <= 0 && d2 >= 0 && d6 <= 0) {
+        float w = d2 / (d2 - d6);
+        return vec3f_add(a, vec3f_mul(ac, vec3f_splat(w)));
+    }
+    float va = d3 * d6 - d5 * d4;
+    if (va <= 0 && d4 - d3 >= 0 && d5 - d6 >= 0) {
+        float w = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+        return vec3f_add(b, vec3f_mul(vec3f_sub(c, b), vec3f_splat(w)));
+    }
+    float denom = 1 / (va + vb + vc);
+    float v = vb * denom;
+    float w = vc * denom;
+    return vec3f_add(a, vec3f_add(vec3f_mul(ab, vec3f_splat(v)),
+                                  vec3f_mul(ac, vec3f_splat(w))));
+}
+
+// Builder.
+
+typedef struct {
+    vec3f_t min, max;
+} linalg_bvh_box_t;
+
+typedef struct {
+    uint32_t count;
+    linalg_bvh_box_t box, centroids;
+} linalg_bvh_bin_t;
+
+// An input triangle, by its bounds.
+// NOTE: the references are partitioned, rather than indices to them, so
+// that the builder reads them sequentially.
+typedef struct {
+    linalg_bvh_box_t box;
+    vec3f_t centroid;
+    uint32_t index;
+} linalg_bvh_ref_t;
+
+typedef struct {
+    linalg_bvh_ref_t *refs; // Partitioned into the leaves.
+    linalg_bvh_node_t *nodes;
+    size_t num_nodes, capacity;
+    thread_pool_t *pool;
+    const vec3f_t *vertices;
+} linalg_bvh_builder_t;
+
+// A range of triangles `refs[begin, end)`, with its bounds and the bounds
+// of its centroids.
+typedef struct {
+    size_t begin, end;
+    linalg_bvh_box_t box, centroids;
+} linalg_bvh_range_t;
+
+LINALG_BVH_DEF linalg_bvh_box_t linalg_bvh_box_empty(void) {
+    return (linalg_bvh_box_t){vec3f_splat(FLT_MAX), vec3f_splat(-FLT_MAX)};
+}
+
+LINALG_BVH_DEF linalg_bvh_box_t linalg_bvh_box_union(linalg_bvh_box_t a,
+                                                     linalg_bvh_box_t b) {
+    return (linalg_bvh_box_t){vec3f_min(a.min, b.min), vec3f_max(a.max, b.max)};
+}
+
+LINALG_BVH_DEF linalg_bvh_box_t linalg_bvh_box_grow(linalg_bvh_box_t box,
+                                                    vec3f_t p) {
+    return (linalg_bvh_box_t){vec3f_min(box.min, p), vec3f_max(box.max, p)};
+}
+
+// Half the surface area, which is all the heuristic needs.
+LINALG_BVH_DEF float linalg_bvh_box_area(linalg_bvh_box_t box) {
+    vec3f_t d = vec3f_max(vec3f_sub(box.max, box.min), vec3f_splat(0));
+    return d.x * d.y + d.y * d.z + d.z * d.x;
+}
+
+LINALG_BVH_DEF void linalg_bvh_bounds_chunk(void *ctx, size_t begin,
+                                            size_t end,
+                                            varia_arena_t *scratch) {
+    (void)scratch;
+    linalg_bvh_builder_t *b = ctx;
+    for (size_t i = begin; i < end; ++i) {
+        const vec3f_t *v = &b->vertices[3 * i];
+        linalg_bvh_box_t box = {vec3f_min(v[0], vec3f_min(v[1], v[2])),
+                                vec3f_max(v[0], vec3f_max(v[1], v[2]))};
+        vec3f_t centroid =
+            vec3f_mul(vec3f_add(box.min, box.max), vec3f_splat(0.5f));
+        b->refs[i] = (linalg_bvh_ref_t){box, centroid, (uint32_t)i};
+    }
+}
+
+typedef struct {
+    const linalg_bvh_builder_t *b;
+    size_t begin; // Of the range, chunks are relative to it.
+    size_t axis;
+    float min, scale; // Of the centroids along the axis, see below.
+    linalg_bvh_bin_t *bins; // LINALG_BVH_BINS per chunk.
+} linalg_bvh_binning_t;
+
+LINALG_BVH_DEF size_t linalg_bvh_bin_index(const linalg_bvh_binning_t *bin,
+                                           vec3f_t centroid) {
+    float x = (centroid.e[bin->axis] - bin->min) * bin->scale;
+    // NOTE: clamped as floats, so the conversion is a single instruction.
+    return (size_t)(int)minf(maxf(x, 0), LINALG_BVH_BINS - 1);
+}
+
+LINALG_BVH_DEF void linalg_bvh_bin_chunk(void *ctx, size_t begin, size_t end,
+                                         varia_arena_t *scratch) {
+    (void)scratch;
+    linalg_bvh_binning_t *bin = ctx;
+    const linalg_bvh_builder_t *b = bin->b;
+    // Chunks are aligned with the grain, hence one set of bins per chunk.
+    linalg_bvh_bin_t *bins =
+        bin->bins + begin / LINALG_BVH_PARALLEL_GRAIN * LINALG_BVH_BINS;
+    for (size_t k = 0; k < LINALG_BVH_BINS; ++k) {
+        bins[k] = (linalg_bvh_bin_t){0, linalg_bvh_box_empty(),
+                                     linalg_bvh_box_empty()};
+    }
+    for (size_t i = bin->begin + begin; i < bin->begin + end; ++i) {
+        const linalg_bvh_ref_t *ref = &b->refs[i];
+        linalg_bvh_bin_t *dst = &bins[linalg_bvh_bin_index(bin, ref->centroid)];
+        ++dst->count;
+        dst->box = linalg_bvh_box_union(dst->box, ref->box);
+        dst->centroids = linalg_bvh_box_grow(dst->centroids, ref->centroid);
+    }
+}
+
+LINALG_BVH_DEF linalg_bvh_box_t
+linalg_bvh_range_box(const linalg_bvh_builder_t *b, size_t begin, size_t end,
+                     linalg_bvh_box_t *centroids) {
+    linalg_bvh_box_t box = linalg_bvh_box_empty();
+    *centroids = linalg_bvh_box_empty();
+    for (size_t i = begin; i < end; ++i) {
+        box = linalg_bvh_box_union(box, b->refs[i].box);
+        *centroids = linalg_bvh_box_grow(*centroids, b->refs[i].centroid);
+    }
+    return box;
+}
+
+// Reorder the refs of [begin, end) so that the `nth` one is the one it would
+// be if they were sorted by centroid along `axis`, with no greater one before
+// it and no smaller one after it.
+// NOTE: Hoare partitions, which split runs of equal centroids evenly.
+LINALG_BVH_DEF void linalg_bvh_select(linalg_bvh_ref_t *refs, size_t begin,
+                                      size_t end, size_t nth, size_t axis) {
+    size_t lo = begin, hi = end - 1; // Inclusive.
+    while (lo < hi) {
+        float pivot = refs[lo + (hi - lo) / 2].centroid.e[axis];
+        size_t i = lo, j = hi;
+        for (;;) {
+            while (refs[i].centroid.e[axis] < pivot) {
+                ++i;
+            }
+            while (refs[j].centroid.e[axis] > pivot) {
+                --j;
+            }
+            if (i >= j) {
+                break;
+            }
+            linalg_bvh_ref_t ref = refs[i];
+            refs[i++] = refs[j];
+            refs[j--] = ref;
+        }
+        // [lo, j] <= pivot <= [j + 1, hi], with lo <= j < hi.
+        if (nth <= j) {
+            hi = j;
+        } else {
+            lo = j + 1;
+        }
+    }
+}
+
+// Split `range` in two: at the median centroid along the largest axis when
+// `median`, in the middle when the centroids all coincide, and with the SAH
+// otherwise. Returns whether the split is cheaper than a leaf.
+LINALG_BVH_DEF bool linalg_bvh_split(linalg_bvh_builder_t *b,
+                                     linalg_bvh_range_t range, bool median,
+                                     linalg_bvh_range_t *left,
+                                     linalg_bvh_range_t *right) {
+    size_t n = range.end - range.begin;
+    vec3f_t extent = vec3f_sub(range.centroids.max, range.centroids.min);
+    size_t axis = extent.x >= extent.y && extent.x >= extent.z ? 0
+                  : extent.y >= extent.z                       ? 1
+                                                               : 2;
+    if (median || extent.e[axis] <= 0) {
+        size_t mid = range.begin + n / 2;
+        if (extent.e[axis] > 0) {
+            linalg_bvh_select(b->refs, range.begin, range.end, mid, axis);
+        }
+        left->begin = range.begin;
+        left->end = right->begin = mid;
+        right->end = range.end;
+        left->box = linalg_bvh_range_box(b, left->begin, left->end,
+                                         &left->centroids);
+        right->box = linalg_bvh_range_box(b, right->begin, right->end,
+                                          &right->centroids);
+        return true;
+    }
+
+    linalg_bvh_binning_t bin = {
+        .b = b,
+        .begin = range.begin,
+        .axis = axis,
+        .min = range.centroids.min.e[axis],
+        // NOTE: slightly below `BINS / extent`, so the maximum centroid
+        // falls in the last bin.
+        .scale = LINALG_BVH_BINS * (1 - 1e-6f) / extent.e[axis],
+    };
+    linalg_bvh_bin_t bins[LINALG_BVH_BINS];
+    if (b->pool != NULL && n >= LINALG_BVH_PARALLEL_MIN) {
+        size_t chunks =
+            (n + LINALG_BVH_PARALLEL_GRAIN - 1) / LINALG_BVH_PARALLEL_GRAIN;
+        varia_arena_mark_t mark = varia_temp_mark();
+        bin.bins = varia_temp_alloc(chunks * LINALG_BVH_BINS * sizeof(*bins));
+        assert(bin.bins != NULL && "Out of memory for the bins.");
+        thread_pool_parallel_for(b->pool, n, LINALG_BVH_PARALLEL_GRAIN,
+                                 linalg_bvh_bin_chunk, &bin);
+        for (size_t k = 0; k < LINALG_BVH_BINS; ++k) {
+            bins[k] = bin.bins[k];
+            for (size_t chunk = 1; chunk < chunks; ++chunk) {
+                const linalg_bvh_bin_t *src =
+                    &bin.bins[chunk * LINALG_BVH_BINS + k];
+                bins[k].count += src->count;
+                bins[k].box = linalg_bvh_box_union(bins[k].box, src->box);
+                bins[k].centroids =
+                    linalg_bvh_box_union(bins[k].centroids, src->centroids);
+            }
+        }
+        varia_temp_restore(mark);
+    } else {
+        bin.bins = bins;
+        linalg_bvh_bin_chunk(&bin, 0, n, NULL);
+    }
+
+    // Cost of the split after bin k: area * count of both sides, swept
+    // from the right first.
+    float right_cost[LINALG_BVH_BINS];
+    linalg_bvh_bin_t side = {0, linalg_bvh_box_empty(), linalg_bvh_box_empty()};
+    for (size_t k = LINALG_BVH_BINS - 1; k > 0; --k) {
+        side.count += bins[k].count;
+        side.box = linalg_bvh_box_union(side.box, bins[k].box);
+        right_cost[k] = linalg_bvh_box_area(side.box) * (float)side.count;
+    }
+    size_t best = 0;
+    float best_cost = FLT_MAX;
+    side = (linalg_bvh_bin_t){0, linalg_bvh_box_empty(),
+                              linalg_bvh_box_empty()};
+    for (size_t k = 0; k + 1 < LINALG_BVH_BINS; ++k) {
+        side.count += bins[k].count;
+        side.box = linalg_bvh_box_union(side.box, bins[k].box);
+        if (side.count == 0 || side.count == n) {
+            continue;
+        }
+        float cost = linalg_bvh_box_area(side.box) * (float)side.count +
+                     right_cost[k + 1];
+        if (cost < best_cost) {
+            best_cost = cost;
+            best = k + 1;
+        }
+    }
+
+    *left = *right = (linalg_bvh_range_t){
+        .box = linalg_bvh_box_empty(), .centroids = linalg_bvh_box_empty()};
+    for (size_t k = 0; k < LINALG_BVH_BINS; ++k) {
+        linalg_bvh_range_t *dst = k < best ? left : right;
+        dst->end += bins[k].count;
+        dst->box = linalg_bvh_box_union(dst->box, bins[k].box);
+        dst->centroids =
+            linalg_bvh_box_union(dst->centroids, bins[k].centroids);
+    }
+    size_t mid = range.begin + left->end;
+    left->begin = range.begin;
+    left->end = right->begin = mid;
+    right->end = range.end;
+    // Partition in place, with the same bin indices as above.
+    size_t i = range.begin, j = range.end;
+    while (i < j) {
+        if (linalg_bvh_bin_index(&bin, b->refs[i].centroid) < best) {
+            ++i;
+        } else {
+            linalg_bvh_ref_t ref = b->refs[i];
+            b->refs[i] = b->refs[--j];
+            b->refs[j] = ref;
+        }
+    }
+    assert(best > 0 && i == mid);
+    // NOTE: one traversal step costs about as much as one triangle test.
+    float area = linalg_bvh_box_area(range.box);
+    return area + best_cost < area * (float)n;
+}
+
+LINALG_BVH_DEF uint32_t linalg_bvh_build_node(linalg_bvh_builder_t *b,
+                                              linalg_bvh_range_t range,
+                                              size_t depth) {
+    assert(b->num_nodes < b->capacity);
+    uint32_t index = (uint32_t)b->num_nodes++;
+    bool median = depth >= LINALG_BVH_MAX_DEPTH;
+
+    // Split the child with the largest area until there are 4 of them. Small
+    // children that are better off as leaves are final.
+    linalg_bvh_range_t children[LINALG_BVH_WIDTH] = {range};
+    bool final[LINALG_BVH_WIDTH] = {0};
+    size_t num_children = 1;
+    while (num_children < LINALG_BVH_WIDTH) {
+        size_t largest = LINALG_BVH_WIDTH;
+        float largest_area = -1;
+        for (size_t k = 0; k < num_children; ++k) {
+            float area = linalg_bvh_box_area(children[k].box);
+            if (!final[k] && children[k].end - children[k].begin > 1 &&
+                area > largest_area) {
+                largest = k;
+                largest_area = area;
+            }
+        }
+        if (largest == LINALG_BVH_WIDTH) {
+            break;
+        }
+        linalg_bvh_range_t left, right;
+        bool cheaper = linalg_bvh_split(b, children[largest], median, &left,
+                                        &right);
+        size_t n = children[largest].end - children[largest].begin;
+        if (!cheaper && n <= LINALG_BVH_LEAF_SIZE && num_children > 1) {
+            // NOTE: the partition is kept, it is a valid leaf order.
+            final[largest] = true;
+            continue;
+        }
+        children[largest] = left;
+        final[largest] = false;
+        children[num_children++] = right;
+    }
+
+    // Children are built depth first, so fill the node last.
+    linalg_bvh_node_t node = {0};
+    for (size_t k = 0; k < LINALG_BVH_WIDTH; ++k) {
+        linalg_bvh_box_t box = linalg_bvh_box_empty();
+        node.child[k] = LINALG_BVH_NONE;
+        size_t n = children[k].end - children[k].begin;
+        if (k < num_children && n > 0) { // Only the root can be empty.
+            linalg_bvh_range_t child = children[k];
+            box = child.box;
+            if (n <= LINALG_BVH_LEAF_SIZE) {
+                node.child[k] = (uint32_t)child.begin;
+                node.count[k] = (uint32_t)n;
+            } else {
+                node.child[k] = linalg_bvh_build_node(b, child, depth + 1);
+            }
+        }
+        node.min_x[k] = box.min.x;
+        node.min_y[k] = box.min.y;
+        node.min_z[k] = box.min.z;
+        node.max_x[k] = box.max.x;
+        node.max_y[k] = box.max.y;
+        node.max_z[k] = box.max.z;
+    }
+    b->nodes[index] = node;
+    return index;
+}
+
+LINALG_BVH_DEF void linalg_bvh_build(linalg_bvh_t *bvh, varia_arena_t *arena,
+                                     thread_pool_t *pool,
+                                     const vec3f_t *vertices, size_t n) {
+    assert(n < LINALG_BVH_NONE && "Triangle indices are 32 bits.");
+    *bvh = (linalg_bvh_t){.num_triangles = n};
+    varia_arena_mark_t mark = varia_temp_mark();
+    // Every node has at least two children, and every leaf at least one
+    // triangle, so there are fewer nodes than triangles.
+    linalg_bvh_builder_t b = {
+        .refs = varia_temp_alloc(n * sizeof(linalg_bvh_ref_t)),
+        .nodes = varia_arena_alloc_aligned(
+            &varia_temp_arena, MAX(n, 1) * sizeof(linalg_bvh_node_t), 64),
+        .capacity = MAX(n, 1),
+        .pool = pool,
+        .vertices = vertices,
+    };
+    assert(b.refs != NULL && b.nodes != NULL &&
+           "Out of memory for the builder.");
+    if (pool != NULL && n >= LINALG_BVH_PARALLEL_MIN) {
+        thread_pool_parallel_for(pool, n, LINALG_BVH_PARALLEL_GRAIN,
+                                 linalg_bvh_bounds_chunk, &b);
+    } else {
+        linalg_bvh_bounds_chunk(&b, 0, n, NULL);
+    }
+
+    linalg_bvh_range_t root = {.begin = 0, .end = n};
+    root.box = linalg_bvh_range_box(&b, 0, n, &root.centroids);
+    linalg_bvh_build_node(&b, root, 0);
+    bvh->min = root.box.min;
+    bvh->max = root.box.max;
+
+    bvh->num_nodes = b.num_nodes;
+    bvh->nodes =
+        varia_arena_alloc_aligned(arena, b.num_nodes * sizeof(*b.nodes), 64);
+    bvh->vertices = varia_arena_alloc(arena, 3 * MAX(n, 1) * sizeof(vec3f_t));
+    bvh->indices = varia_arena_alloc(arena, MAX(n, 1) * sizeof(uint32_t));
+    assert(bvh->nodes != NULL && bvh->vertices != NULL &&
+           bvh->indices != NULL && "Out of memory for the BVH.");
+    memcpy(bvh->nodes, b.nodes, b.num_nodes * sizeof(*b.nodes));
+    for (size_t i = 0; i < n; ++i) {
+        uint32_t t = b.refs[i].index;
+        bvh->indices[i] = t;
+        bvh->vertices[3 * i] = vertices[3 * t];
+        bvh->vertices[3 * i + 1] = vertices[3 * t + 1];
+        bvh->vertices[3 * i + 2] = vertices[3 * t + 2];
+    }
+    varia_temp_restore(mark);
+}
+
+// Queries.
+
+typedef struct {
+    uint32_t node;
+    float distance; // Entry distance of the ray, or squared distance.
+} linalg_bvh_entry_t;
+
+// Push the children of `mask` (inner nodes only), furthest first.
+LINALG_BVH_DEF size_t linalg_bvh_push(linalg_bvh_entry_t *stack, size_t top,
+                                      const linalg_bvh_node_t *node,
+                                      unsigned mask, const float *distances) {
+    size_t first = top;
+    for (size_t k = 0; k < LINALG_BVH_WIDTH; ++k) {
+        if (!(mask >> k & 1) || node->count[k] != 0 ||
+            node->child[k] == LINALG_BVH_NONE) {
+            continue;
+        }
+        // Insertion sort of at most 4 entries, the nearest on top.
+        linalg_bvh_entry_t entry = {node->child[k], distances[k]};
+        size_t i = top++;
+        for (; i > first && stack[i - 1].distance < entry.distance; --i) {
+            stack[i] = stack[i - 1];
+        }
+        stack[i] = entry;
+    }
+    assert(top <= LINALG_BVH_STACK && "BVH deeper than expected.");
+    return top;
+}
+
+// Mask of the children of `node` the ray enters before `t_max`, and their
+// entry distances.
+// NOTE: `(bound - origin) * inv_direction` rather than a fused multiply-add
+// with `origin * inv_direction`, which is NaN for zero direction components.
+LINALG_BVH_DEF unsigned linalg_bvh_ray_node(const linalg_bvh_node_t *node,
+                                            vec3f_t origin,
+                                            vec3f_t inv_direction,
+                                            const bool *negative, float t_max,
+                                            float *t_near) {
+    // Slab test: the bounds are entered on the side facing the ray.
+    const float *mins[3] = {node->min_x, node->min_y, node->min_z};
+    const float *maxs[3] = {node->max_x, node->max_y, node->max_z};
+#ifdef LINALG_SIMD
+    __m128 t0 = _mm_setzero_ps();
+    __m128 t1 = _mm_set1_ps(t_max);
+    for (size_t axis = 0; axis < 3; ++axis) {
+        __m128 o = _mm_set1_ps(origin.e[axis]);
+        __m128 inv = _mm_set1_ps(inv_direction.e[axis]);
+        const float *near = negative[axis] ? maxs[axis] : mins[axis];
+        const float *far = negative[axis] ? mins[axis] : maxs[axis];
+        // NOTE: `_mm_max_ps` returns its second operand when one is NaN (a
+        // bound on the origin, with a zero direction), which ignores it.
+        t0 = _mm_max_ps(_mm_mul_ps(_mm_sub_ps(_mm_load_ps(near), o), inv), t0);
+        t1 = _mm_min_ps(_mm_mul_ps(_mm_sub_ps(_mm_load_ps(far), o), inv), t1);
+    }
+    _mm_storeu_ps(t_near, t0);
+    return (unsigned)_mm_movemask_ps(_mm_cmple_ps(t0, t1));
+#else
+    unsigned mask = 0;
+    for (size_t k = 0; k < LINALG_BVH_WIDTH; ++k) {
+        float t0 = 0, t1 = t_max;
+        for (size_t axis = 0; axis < 3; ++axis) {
+            float near = negative[axis] ? maxs[axis][k] : mins[axis][k];
+            float far = negative[axis] ? mins[axis][k] : maxs[axis][k];
+            float inv = inv_direction.e[axis];
+            float t_in = (near - origin.e[axis]) * inv;
+            float t_out = (far - origin.e[axis]) * inv;
+            t0 = t_in > t0 ? t_in : t0;
+            t1 = t_out < t1 ? t_out : t1;
+        }
+        t_near[k] = t0;
+        mask |= (unsigned)(t0 <= t1) << k;
+    }
+    return mask;
+#endif // LINALG_SIMD
+}
+
+LINALG_BVH_DEF bool linalg_bvh_intersect(const linalg_bvh_t *bvh,
+                                         linalg_bvh_ray_t ray,
+                                         linalg_bvh_hit_t *hit) {
+    if (bvh->num_triangles == 0) {
+        return false;
+    }
+    vec3f_t inv_direction = vec3f_div(vec3f_splat(1), ray.direction);
+    bool negative[3] = {inv_direction.x < 0, inv_direction.y < 0,
+                        inv_direction.z < 0};
+    hit->t = ray.t_max;
+    hit->triangle = LINALG_BVH_NONE;
+
+    linalg_bvh_entry_t stack[LINALG_BVH_STACK];
+    size_t top = 0;
+    stack[top++] = (linalg_bvh_entry_t){0, 0};
+    while (top > 0) {
+        linalg_bvh_entry_t entry = stack[--top];
+        if (entry.distance > hit->t) {
+            continue; // A closer hit was found since it was pushed.
+        }
+        const linalg_bvh_node_t *node = &bvh->nodes[entry.node];
+        float t_near[LINALG_BVH_WIDTH];
+        unsigned mask = linalg_bvh_ray_node(node, ray.origin, inv_direction,
+                                            negative, hit->t, t_near);
+        for (size_t k = 0; k < LINALG_BVH_WIDTH; ++k) {
+            if (!(mask >> k & 1) || node->count[k] == 0) {
+                continue;
+            }
+            for (uint32_t i = node->child[k];
+                 i < node->child[k] + node->count[k]; ++i) {
+                const vec3f_t *v = &bvh->vertices[3 * i];
+                float t, u, w;
+                if (linalg_ray_triangle(ray.origin, ray.direction, v[0], v[1],
+                                        v[2], &t, &u, &w) &&
+                    t >= 0 && t < hit->t) {
+                    *hit = (linalg_bvh_hit_t){t, u, w, bvh->indices[i]};
+                }
+            }
+        }
+        top = linalg_bvh_push(stack, top, node, mask, t_near);
+    }
+    return hit->triangle != LINALG_BVH_NONE;
+}
+
+// Mask of the children of `node` closer to `p` than `sqrt(max_distance2)`,
+// and their squared distances.
+LINALG_BVH_DEF unsigned linalg_bvh_point_node(const linalg_bvh_node_t *node,
+                                              vec3f_t p, float max_distance2,
+                                              float *distances2) {
+#ifdef LINALG_SIMD
+    const __m128 zero = _mm_setzero_ps();
+    __m128 d2 = zero;
+    const float *mins[3] = {node->min_x, node->min_y, node->min_z};
+    const float *maxs[3] = {node->max_x, node->max_y, node->max_z};
+    for (size_t axis = 0; axis < 3; ++axis) {
+        __m128 x = _mm_set1_ps(p.e[axis]);
+        __m128 below = _mm_sub_ps(_mm_load_ps(mins[axis]), x);
+        __m128 above = _mm_sub_ps(x, _mm_load_ps(maxs[axis]));
+        __m128 d = _mm_max_ps(_mm_max_ps(below, above), zero);
+        d2 = linalg_madd_ps(d, d, d2);
+    }
+    _mm_storeu_ps(distances2, d2);
+    return (unsigned)_mm_movemask_ps(
+        _mm_cmplt_ps(d2, _mm_set1_ps(max_distance2)));
+#else
+    unsigned mask = 0;
+    for (size_t k = 0; k < LINALG_BVH_WIDTH; ++k) {
+        vec3f_t min = vec3f(node->min_x[k], node->min_y[k], node->min_z[k]);
+        vec3f_t max = vec3f(node->max_x[k], node->max_y[k], node->max_z[k]);
+        vec3f_t d = vec3f_max(vec3f_max(vec3f_sub(min, p), vec3f_sub(p, max)),
+                              vec3f_splat(0));
+        distances2[k] = vec3f_dot(d, d);
+        mask |= (unsigned)(distances2[k] < max_distance2) << k;
+    }
+    return mask;
+#endif // LINALG_SIMD
+}
+
+LINALG_BVH_DEF bool linalg_bvh_closest_point(const linalg_bvh_t *bvh,
+                                             vec3f_t p, float max_distance,
+                                             linalg_bvh_closest_t *closest) {
+    closest->distance2 = max_distance * max_distance;
+    closest->triangle = LINALG_BVH_NONE;
+    if (bvh->num_triangles == 0) {
+        return false;
+    }
+
+    linalg_bvh_entry_t stack[LINALG_BVH_STACK];
+    size_t top = 0;
+    stack[top++] = (linalg_bvh_entry_t){0, 0};
+    while (top > 0) {
+        linalg_bvh_entry_t entry = stack[--top];
+        if (entry.distance >= closest->distance2) {
+            continue;
+        }
+        const linalg_bvh_node_t *node = &bvh->nodes[entry.node];
+        float distances2[LINALG_BVH_WIDTH];
+        unsigned mask = linalg_bvh_point_node(node, p, closest->distance2,
+                                              distances2);
+        for (size_t k = 0; k < LINALG_BVH_WIDTH; ++k) {
+            if (!(mask >> k & 1) || node->count[k] == 0) {
+                continue;
+            }
+            for (uint32_t i = node->child[k];
+                 i < node->child[k] + node->count[k]; ++i) {
+                const vec3f_t *v = &bvh->vertices[3 * i];
+                vec3f_t q = linalg_closest_point_triangle(p, v[0], v[1], v[2]);
+                vec3f_t d = vec3f_sub(q, p);
+                float distance2 = vec3f_dot(d, d);
+                if (distance2 < closest->distance2) {
+                    *closest = (linalg_bvh_closest_t){q, distance2,
+                                                      bvh->indices[i]};
+                }
+            }
+        }
+        top = linalg_bvh_push(stack, top, node, mask, distances2);
+    }
+    return closest->triangle != LINALG_BVH_NONE;
+}
+
+#endif // LINALG_BVH_H
@@ -0,0 +1,242 @@
+#ifndef LINALG_CULL_H
+#define LINALG_CULL_H
+
+/* Frustum culling of batches of bounding volumes, stored as SoA arrays:
+ *
+ *     linalg_frustum_t frustum = linalg_frustum_from_mat4f(view_proj, false);
+ *     linalg_aabb_soa_t boxes = {.center = centers, .extent = extents};
+ *     size_t n = linalg_cull_aabbs(&frustum, boxes, visible);
+ *     for (size_t i = 0; i < n; ++i) {
+ *         draw(visible[i]); // Indices of the boxes that may be visible.
+ *     }
+ *
+ * A volume is culled when it lies entirely on the outer side of one of the
+ * six planes. The test is conservative: a volume near a corner of the frustum
+ * may be reported visible although it is outside.
+ *
+ * Under `LINALG_SIMD` on targets with AVX, 8 volumes are tested against all
+ * the planes per iteration; otherwise, and for the tail of the batch, one at
+ * a time. The two paths round differently, so they may disagree on volumes
+ * touching a plane. The visible indices are written without branches, in
+ * increasing order.
+ *
+ * NOTE: requires the mat and soa groups of the generator, in single
+ * precision, for dimensions 3 and 4 (see `generate_linalg --help`).
+ */
+
+#include <stdint.h>
+
+#include "../linalg.h"
+
+#if !defined(LINALG_HAS_VEC3F_SOA) || !defined(LINALG_HAS_MAT4F)
+#error "linalg_cull.h needs vec3f_soa_t and mat4f_t in linalg.h."
+#endif
+
+#ifndef LINALG_CULL_DEF
+#define LINALG_CULL_DEF static inline
+#endif // LINALG_CULL_DEF
+
+#define LINALG_FRUSTUM_PLANES 6
+
+// Planes `(nx, ny, nz, d)` with unit normals pointing inside: a point `p` is
+// inside when `dot(n, p) + d >= 0` for every plane.
+typedef struct {
+    // Left, right, bottom, top, near, far.
+    vec4f_t planes[LINALG_FRUSTUM_PLANES];
+} linalg_frustum_t;
+
+// Axis-aligned boxes, as center and half extent (non-negative).
+typedef struct {
+    vec3f_soa_t center, extent;
+} linalg_aabb_soa_t;
+
+typedef struct {
+    vec3f_soa_t center;
+    float *radius;
+} linalg_sphere_soa_t;
+
+// Planes of the frustum of a projection (or view-projection) matrix, for
+// column vectors (`clip = M * p`), with the Gribb-Hartmann method. The clip
+// volume is `-w <= x, y <= w`, and `-w <= z <= w`, or `0 <= z <= w` when
+// `zero_to_one_depth` (Direct3D, Vulkan).
+LINALG_CULL_DEF linalg_frustum_t linalg_frustum_from_mat4f(
+    mat4f_t M, bool zero_to_one_depth);
+LINALG_CULL_DEF bool linalg_frustum_test_aabb(const linalg_frustum_t *frustum,
+                                              vec3f_t center, vec3f_t extent);
+LINALG_CULL_DEF bool linalg_frustum_test_sphere(const linalg_frustum_t *frustum,
+                                                vec3f_t center, float radius);
+// Write the indices of the visible volumes to `visible` (room for all of
+// them), and return how many there are.
+LINALG_CULL_DEF size_t linalg_cull_aabbs(const linalg_frustum_t *frustum,
+                                         linalg_aabb_soa_t boxes,
+                                         uint32_t *visible);
+LINALG_CULL_DEF size_t linalg_cull_spheres(const linalg_frustum_t *frustum,
+                                           linalg_sphere_soa_t spheres,
+                                           uint32_t *visible);
+
+LINALG_CULL_DEF linalg_frustum_t linalg_frustum_from_mat4f(
+    mat4f_t M, bool zero_to_one_depth) {
+    vec4f_t w = M.v[3];
+    linalg_frustum_t frustum = {.planes = {
+                                    vec4f_add(w, M.v[0]),
+                                    vec4f_sub(w, M.v[0]),
+                                    vec4f_add(w, M.v[1]),
+                                    vec4f_sub(w, M.v[1]),
+                                    zero_to_one_depth ? M.v[2]
+                                                      : vec4f_add(w, M.v[2]),
+                                    vec4f_sub(w, M.v[2]),
+                                }};
+    // NOTE: normalized so that the distances compare with sphere radii.
+    for (size_t i = 0; i < LINALG_FRUSTUM_PLANES; ++i) {
+        vec4f_t p = frustum.planes[i];
+        float length = sqrtf(p.x * p.x + p.y * p.y + p.z * p.z);
+        frustum.planes[i] = vec4f_mul(p, vec4f_splat(1 / length));
+    }
+    return frustum;
+}
+
+// The box is outside a plane when its corner furthest along the normal is:
+// that corner is at distance `dot(n, center) + d + dot(|n|, extent)`.
+LINALG_CULL_DEF bool linalg_frustum_test_aabb(const linalg_frustum_t *frustum,
+                                              vec3f_t center, vec3f_t extent) {
+    bool inside = true;
+    for (size_t i = 0; i < LINALG_FRUSTUM_PLANES; ++i) {
+        vec4f_t p = frustum->planes[i];
+        float distance = p.x * center.x + p.y * center.y + p.z * center.z + p.w;
+        float radius = fabsf(p.x) * extent.x + fabsf(p.y) * extent.y +
+                       fabsf(p.z) * extent.z;
+        inside &= distance + radius >= 0;
+    }
+    return inside;
+}
+
+LINALG_CULL_DEF bool linalg_frustum_test_sphere(const linalg_frustum_t *frustum,
+                                                vec3f_t center, float radius) {
+    bool inside = true;
+    for (size_t i = 0; i < LINALG_FRUSTUM_PLANES; ++i) {
+        vec4f_t p = frustum->planes[i];
+        float distance = p.x * center.x + p.y * center.y + p.z * center.z + p.w;
+        inside &= distance + radius >= 0;
+    }
+    return inside;
+}
+
+#if defined(LINALG_SIMD) && defined(__AVX__)
+// Plane components broadcast to all lanes, with the absolute values of the
+// normal for the boxes.
+typedef struct {
+    __m256 x, y, z, w, abs_x, abs_y, abs_z;
+} linalg_cull_plane_t;
+
+LINALG_CULL_DEF void linalg_cull_broadcast(const linalg_frustum_t *frustum,
+                                           linalg_cull_plane_t *planes) {
+    for (size_t i = 0; i < LINALG_FRUSTUM_PLANES; ++i) {
+        vec4f_t p = frustum->planes[i];
+        planes[i] = (linalg_cull_plane_t){
+            .x = _mm256_set1_ps(p.x),
+            .y = _mm256_set1_ps(p.y),
+            .z = _mm256_set1_ps(p.z),
+            .w = _mm256_set1_ps(p.w),
+            .abs_x = _mm256_set1_ps(fabsf(p.x)),
+            .abs_y = _mm256_set1_ps(fabsf(p.y)),
+            .abs_z = _mm256_set1_ps(fabsf(p.z)),
+        };
+    }
+}
+#endif // LINALG_SIMD && __AVX__
+
+// Append the indices `base + k` of the set bits `k` of `mask` (8 bits).
+// NOTE: every index is stored and only the visible ones are kept (the next
+// store overwrites the others), which avoids mispredicted branches.
+LINALG_CULL_DEF size_t linalg_cull_compact(uint32_t *visible, size_t count,
+                                           unsigned mask, size_t base) {
+    for (unsigned k = 0; k < 8; ++k) {
+        visible[count] = (uint32_t)(base + k);
+        count += (mask >> k) & 1;
+    }
+    return count;
+}
+
+LINALG_CULL_DEF size_t linalg_cull_aabbs(const linalg_frustum_t *frustum,
+                                         linalg_aabb_soa_t boxes,
+                                         uint32_t *visible) {
+    assert(boxes.center.n == boxes.extent.n);
+    assert(boxes.center.n <= UINT32_MAX && "Indices are 32 bits.");
+    const vec3f_soa_t c = boxes.center, e = boxes.extent;
+    size_t count = 0;
+    size_t i = 0;
+#if defined(LINALG_SIMD) && defined(__AVX__)
+    linalg_cull_plane_t planes[LINALG_FRUSTUM_PLANES];
+    linalg_cull_broadcast(frustum, planes);
+    const __m256 zero = _mm256_setzero_ps();
+    for (; i + 8 <= c.n; i += 8) {
+        __m256 cx = _mm256_loadu_ps(c.x + i);
+        __m256 cy = _mm256_loadu_ps(c.y + i);
+        __m256 cz = _mm256_loadu_ps(c.z + i);
+        __m256 ex = _mm256_loadu_ps(e.x + i);
+        __m256 ey = _mm256_loadu_ps(e.y + i);
+        __m256 ez = _mm256_loadu_ps(e.z + i);
+        __m256 inside = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+        for (size_t k = 0; k < LINALG_FRUSTUM_PLANES; ++k) {
+            const linalg_cull_plane_t *p = &planes[k];
+            __m256 distance = maths_madd_ps256(p->x, cx, p->w);
+            distance = maths_madd_ps256(p->y, cy, distance);
+            distance = maths_madd_ps256(p->z, cz, distance);
+            distance = maths_madd_ps256(p->abs_x, ex, distance);
+            distance = maths_madd_ps256(p->abs_y, ey, distance);
+            distance = maths_madd_ps256(p->abs_z, ez, distance);
+            inside = _mm256_and_ps(inside,
+                                   _mm256_cmp_ps(distance, zero, _CMP_GE_OQ));
+        }
+        count = linalg_cull_compact(visible, count,
+                                    (unsigned)_mm256_movemask_ps(inside), i);
+    }
+#endif // LINALG_SIMD && __AVX__
+    for (; i < c.n; ++i) {
+        visible[count] = (uint32_t)i;
+        count += linalg_frustum_test_aabb(frustum,
+                                          vec3f(c.x[i], c.y[i], c.z[i]),
+                                          vec3f(e.x[i], e.y[i], e.z[i]));
+    }
+    return count;
+}
+
+LINALG_CULL_DEF size_t linalg_cull_spheres(const linalg_frustum_t *frustum,
+                                           linalg_sphere_soa_t spheres,
+                                           uint32_t *visible) {
+    assert(spheres.center.n <= UINT32_MAX && "Indices are 32 bits.");
+    const vec3f_soa_t c = spheres.center;
+    const float *radius = spheres.radius;
+    size_t count = 0;
+    size_t i = 0;
+#if defined(LINALG_SIMD) && defined(__AVX__)
+    linalg_cull_plane_t planes[LINALG_FRUSTUM_PLANES];
+    linalg_cull_broadcast(frustum, planes);
+    for (; i + 8 <= c.n; i += 8) {
+        __m256 cx = _mm256_loadu_ps(c.x + i);
+        __m256 cy = _mm256_loadu_ps(c.y + i);
+        __m256 cz = _mm256_loadu_ps(c.z + i);
+        __m256 minus_r = _mm256_sub_ps(_mm256_setzero_ps(),
+                                       _mm256_loadu_ps(radius + i));
+        __m256 inside = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+        for (size_t k = 0; k < LINALG_FRUSTUM_PLANES; ++k) {
+            const linalg_cull_plane_t *p = &planes[k];
+            __m256 distance = maths_madd_ps256(p->x, cx, p->w);
+            distance = maths_madd_ps256(p->y, cy, distance);
+            distance = maths_madd_ps256(p->z, cz, distance);
+            inside = _mm256_and_ps(
+                inside, _mm256_cmp_ps(distance, minus_r, _CMP_GE_OQ));
+        }
+        count = linalg_cull_compact(visible, count,
+                                    (unsigned)_mm256_movemask_ps(inside), i);
+    }
+#endif // LINALG_SIMD && __AVX__
+    for (; i < c.n; ++i) {
+        visible[count] = (uint32_t)i;
+        count += linalg_frustum_test_sphere(
+            frustum, vec3f(c.x[i], c.y[i], c.z[i]), radius[i]);
+    }
+    return count;
+}
+
+#endif // LINALG_CULL_H
@@ -7,10 +7,17 @@
 #ifdef USE_TYPEDEFS
 #include "typedefs.h"
 #endif // USE_TYPEDEFS
+#include "thread_pool.h"
 #include "varia.h"
 #include <assert.h>
+#include <ctype.h>
+#include <errno.h>
 #include <stdarg.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
 
 #define MIN_DIM 2
 #define MAX_DIM 4
@@ -27,6 +34,7 @@ typedef enum {
     DOUBLE_T,
     INT_T,
     UINT_T,
+    HALF_T, // Storage only, see `is_storage_type()`.
     NUM_TYPES,
 } type_s;
 
@@ -37,7 +45,7 @@ typedef struct {
     const char *zero_literal;
 } type_definition_s;
 
-static_assert(NUM_TYPES == 4, "Number of types has changed.");
+static_assert(NUM_TYPES == 5, "Number of types has changed.");
 #ifdef USE_TYPEDEFS
 static type_definition_s type_definitions[NUM_TYPES] = {
     [FLOAT_T] = {.keyword = "f32",
@@ -56,6 +64,10 @@ static type_definition_s type_definitions[NUM_TYPES] = {
                 .suffix = "u",
                 .fmt = "u",
                 .zero_literal = "0U"},
+    [HALF_T] = {.keyword = "half_t",
+                .suffix = "h",
+                .fmt = "hu",
+                .zero_literal = "0"},
 };
 #else
 static type_definition_s type_definitions[NUM_TYPES] = {
@@ -75,6 +87,10 @@ static type_definition_s type_definitions[NUM_TYPES] = {
                 .suffix = "u",
                 .fmt = "u",
                 .zero_literal = "0U"},
+    [HALF_T] = {.keyword = "half_t",
+                .suffix = "h",
+                .fmt = "hu",
+                .zero_literal = "0"},
 };
 #endif // USE_TYPEDEFS
 
@@ -130,7 +146,7 @@ typedef struct {
     char *params[FN_MAX_ARITY];
 } fn_definition_s;
 
-static_assert(NUM_TYPES == 4, "Number of types has changed.");
+static_assert(NUM_TYPES == 5, "Number of types has changed.");
 static const fn_definition_s fn_definitions[] = {
     {
         .name = "min",
@@ -232,14 +248,55 @@ const char *mat_prefix_name(size_t dim, type_s type) {
     return varia_temp_sprintf("mat%zu%s", dim, type_definitions[type].suffix);
 }
 
+// Name of a vector component (`x`, `y`, ... for small vectors, `e[i]`
+// otherwise). Structure-of-arrays vectors use the same names for their streams.
+const char *vec_component_name(size_t dim, size_t component) {
+    if (dim <= 4) {
+        return varia_temp_sprintf("%c", vec_math_components[component]);
+    }
+    return varia_temp_sprintf("e[%zu]", component);
+}
+
+bool is_floating_type(type_s type) {
+    return type == FLOAT_T || type == DOUBLE_T;
+}
+
+// NOTE: storage types only have vector definitions and conversions to and
+// from single precision: data is stored compactly and widened to compute.
+bool is_storage_type(type_s type) { return type == HALF_T; }
+
+// NOTE: only 4-component single precision vectors fill exactly one SSE
+// register, so they (and the matrices made of them) are the only types with a
+// `LINALG_SIMD` variant.
+bool has_simd_variant(size_t dim, type_s type) {
+    return dim == 4 && type == FLOAT_T;
+}
+
+// NOTE: the `_fast` variants (single precision only) use the approximations
+// of `maths.h` (about 1e-6 absolute error) instead of <math.h>.
+bool has_fast_variant(type_s type) { return type == FLOAT_T; }
+
+const char *simd_op_intrinsic(op_s op) {
+    switch (op) {
+    case OP_ADD:
+        return "_mm_add_ps";
+    case OP_SUB:
+        return "_mm_sub_ps";
+    case OP_MUL:
+        return "_mm_mul_ps";
+    case OP_DIV:
+        return "_mm_div_ps";
+    default:
+        return NULL; // No packed equivalent (e.g. modulo).
+    }
+}
+
 void generate_head(FILE *restrict stream) {
-    fprintf(stream, "#ifndef LINALG_H\n");
-    fprintf(stream, "#define LINALG_H\n");
-    EMPTY_LINE(stream);
     fprintf(stream, "#include \"src/maths.h\"\n");
 #ifdef USE_TYPEDEFS
     fprintf(stream, "#include \"src/typedefs.h\"\n");
 #endif // USE_TYPEDEFS
+    fprintf(stream, "#include <assert.h>\n");
     fprintf(stream, "#include <math.h>\n");
     fprintf(stream, "#include <stdarg.h>\n");
     EMPTY_LINE(stream);
@@ -247,9 +304,53 @@ void generate_head(FILE *restrict stream) {
     fprintf(stream, "typedef unsigned long size_t;\n");
     fprintf(stream, "#endif // __STDDEF_H\n");
     EMPTY_LINE(stream);
+    // NOTE: the library is split stb-style. Small functions are always
+    // defined as `LINALG_INLINE`; the others are only declared, unless
+    // `LINALG_IMPLEMENTATION` is defined (in exactly one translation unit).
+    // Defining `LINALG_STATIC` instead gives every including translation unit
+    // its own `static` copy of the library.
+    fprintf(stream, "#ifdef LINALG_STATIC\n");
+    fprintf(stream, "#define LINALG_IMPLEMENTATION\n");
     fprintf(stream, "#ifndef LINALG_DEF\n");
     fprintf(stream, "#define LINALG_DEF static inline\n");
     fprintf(stream, "#endif // LINALG_DEF\n");
+    fprintf(stream, "#endif // LINALG_STATIC\n");
+    EMPTY_LINE(stream);
+    fprintf(stream, "#ifndef LINALG_DEF\n");
+    fprintf(stream, "#define LINALG_DEF extern\n");
+    fprintf(stream, "#endif // LINALG_DEF\n");
+    EMPTY_LINE(stream);
+    fprintf(stream, "#ifndef LINALG_INLINE\n");
+    fprintf(stream, "#if defined(__GNUC__) || defined(__clang__)\n");
+    fprintf(stream, "#define LINALG_INLINE static inline "
+                    "__attribute__((always_inline))\n");
+    fprintf(stream, "#else\n");
+    fprintf(stream, "#define LINALG_INLINE static inline\n");
+    fprintf(stream, "#endif\n");
+    fprintf(stream, "#endif // LINALG_INLINE\n");
+    EMPTY_LINE(stream);
+    // Number of elements folded linearly at the leaves of pairwise reductions.
+    fprintf(stream, "#ifndef LINALG_PAIRWISE_BLOCK\n");
+    fprintf(stream, "#define LINALG_PAIRWISE_BLOCK 8\n");
+    fprintf(stream, "#endif // LINALG_PAIRWISE_BLOCK\n");
+    EMPTY_LINE(stream);
+    // NOTE: define `LINALG_SIMD` before including this file to store `vec4f_t`
+    // and `mat4f_t` in SSE registers (16-byte aligned).
+    fprintf(stream, "#ifdef LINALG_SIMD\n");
+    fprintf(stream, "#ifndef __SSE__\n");
+    fprintf(stream, "#error \"LINALG_SIMD requires a target with SSE.\"\n");
+    fprintf(stream, "#endif // __SSE__\n");
+    fprintf(stream, "#include <immintrin.h>\n");
+    EMPTY_LINE(stream);
+    fprintf(stream, "LINALG_INLINE __m128 linalg_madd_ps(__m128 a, __m128 b, "
+                    "__m128 c) {\n");
+    fprintf(stream, "#ifdef __FMA__\n");
+    fprintf(stream, INDENT "return _mm_fmadd_ps(a, b, c);\n");
+    fprintf(stream, "#else\n");
+    fprintf(stream, INDENT "return _mm_add_ps(_mm_mul_ps(a, b), c);\n");
+    fprintf(stream, "#endif // __FMA__\n");
+    fprintf(stream, "}\n");
+    fprintf(stream, "#endif // LINALG_SIMD\n");
     EMPTY_LINE(stream);
     fprintf(stream, "typedef enum {\n");
     fprintf(stream, INDENT "AXIS_X = 0,\n");
@@ -288,6 +389,11 @@ void generate_vec_definition(FILE *restrict stream, size_t dim, type_s type) {
         fprintf(stream, "; };\n");
     }
     fprintf(stream, INDENT "%s e[%zu];\n", type_keyword, dim);
+    if (has_simd_variant(dim, type)) {
+        fprintf(stream, "#ifdef LINALG_SIMD\n");
+        fprintf(stream, INDENT "__m128 m;\n");
+        fprintf(stream, "#endif // LINALG_SIMD\n");
+    }
     fprintf(stream, "} vec%zu%s_t;\n", dim, type_definitions[type].suffix);
     EMPTY_LINE(stream);
 }
@@ -330,7 +436,7 @@ void generate_vec_scalar_constructor(FILE *restrict stream, size_t dim,
                                      type_s type) {
     const char *vec_type = vec_type_name(dim, type);
     const char *vec_splat_name = vec_fn_name(dim, type, "splat");
-    fprintf(stream, "%s %s(%s x) {\n", vec_type, vec_splat_name,
+    fprintf(stream, "LINALG_DEF %s %s(%s x) {\n", vec_type, vec_splat_name,
             type_definitions[type].keyword);
     fprintf(stream, INDENT "%s v = {{", vec_type);
     for (size_t component = 0; component < dim; ++component) {
@@ -342,7 +448,7 @@ void generate_vec_scalar_constructor(FILE *restrict stream, size_t dim,
     fprintf(stream, "}};\n");
     fprintf(stream, INDENT "return v;\n");
     fprintf(stream, "}\n");
-    fprintf(stream, "\n");
+    EMPTY_LINE(stream);
 }
 
 void generate_vec_operation(FILE *restrict stream, size_t dim, type_s type,
@@ -351,6 +457,13 @@ void generate_vec_operation(FILE *restrict stream, size_t dim, type_s type,
     const char *vec_fn = vec_fn_name(dim, type, op_definitions[op].name);
     fprintf(stream, "LINALG_DEF %s %s(", vec_type, vec_fn);
     fprintf(stream, "%s a, %s b) {\n", vec_type, vec_type);
+    const char *simd_op = simd_op_intrinsic(op);
+    bool simd = has_simd_variant(dim, type) && simd_op != NULL;
+    if (simd) {
+        fprintf(stream, "#ifdef LINALG_SIMD\n");
+        fprintf(stream, INDENT "a.m = %s(a.m, b.m);\n", simd_op);
+        fprintf(stream, "#else\n");
+    }
     if (dim <= 4) {
         for (size_t component = 0; component < dim; ++component) {
             // Modulo operator does not support floating-point types.
@@ -387,6 +500,9 @@ void generate_vec_operation(FILE *restrict stream, size_t dim, type_s type,
             }
         }
     }
+    if (simd) {
+        fprintf(stream, "#endif // LINALG_SIMD\n");
+    }
     fprintf(stream, INDENT "return a;\n");
     fprintf(stream, "}\n");
     EMPTY_LINE(stream);
@@ -406,8 +522,8 @@ void generate_vec_variadic_operation(FILE *restrict stream, size_t dim,
     if (op == VARIADIC_OP_SUM) {
         fprintf(stream, INDENT "%s_t %s = {0};\n", vec_prefix, result_name);
     } else if (op == VARIADIC_OP_PRODUCT) {
-        fprintf(stream, "%s_t %s = %s_splat(1);\n", vec_prefix, result_name,
-                vec_prefix);
+        fprintf(stream, INDENT "%s_t %s = %s_splat(1);\n", vec_prefix,
+                result_name, vec_prefix);
     } else {
         assert(0 && "TODO: Variadic operation not implemented.");
     }
@@ -417,11 +533,51 @@ void generate_vec_variadic_operation(FILE *restrict stream, size_t dim,
     fprintf(stream, INDENT INDENT "%s = %s(%s, v);\n", result_name, vec_op,
             result_name);
     fprintf(stream, INDENT "}\n");
+    fprintf(stream, INDENT "va_end(args);\n");
     fprintf(stream, INDENT "return %s;\n", result_name);
     fprintf(stream, "}\n");
     EMPTY_LINE(stream);
 }
 
+// Array counterpart of the variadic operations: the array is folded as a
+// balanced binary tree, which shortens the dependency chain (more instruction
+// level parallelism) and bounds the rounding error growth to O(log n).
+void generate_vec_array_operation(FILE *restrict stream, size_t dim,
+                                  type_s type, variadic_op_s op) {
+    const char *vec_prefix = vec_prefix_name(dim, type);
+    const char *result_name = variadic_op_definitions[op].name;
+    const char *vec_fn = vec_fn_name(
+        dim, type,
+        varia_temp_sprintf("%s_array", variadic_op_definitions[op].name));
+    const char *vec_op = vec_fn_name(dim, type, variadic_op_definitions[op].op);
+    fprintf(stream, "LINALG_DEF %s_t %s(const %s_t *xs, size_t n) {\n",
+            vec_prefix, vec_fn, vec_prefix);
+    fprintf(stream, INDENT "if (n <= LINALG_PAIRWISE_BLOCK) {\n");
+    if (op == VARIADIC_OP_SUM) {
+        fprintf(stream, INDENT INDENT "%s_t %s = {0};\n", vec_prefix,
+                result_name);
+    } else if (op == VARIADIC_OP_PRODUCT) {
+        fprintf(stream, INDENT INDENT "%s_t %s = %s_splat(1);\n", vec_prefix,
+                result_name, vec_prefix);
+    } else {
+        assert(0 && "TODO: Array operation not implemented.");
+    }
+    fprintf(stream, INDENT INDENT "for (size_t i = 0; i < n; ++i) {\n");
+    fprintf(stream, INDENT INDENT INDENT "%s_assign(&%s, xs[i]);\n", vec_op,
+            result_name);
+    fprintf(stream, INDENT INDENT "}\n");
+    fprintf(stream, INDENT INDENT "return %s;\n", result_name);
+    fprintf(stream, INDENT "}\n");
+    fprintf(stream, INDENT "size_t half = n / 2;\n");
+    fprintf(stream, INDENT "%s_t lhs = %s(xs, half);\n", vec_prefix, vec_fn);
+    fprintf(stream, INDENT "%s_t rhs = %s(xs + half, n - half);\n", vec_prefix,
+            vec_fn);
+    fprintf(stream, INDENT "%s_assign(&lhs, rhs);\n", vec_op);
+    fprintf(stream, INDENT "return lhs;\n");
+    fprintf(stream, "}\n");
+    EMPTY_LINE(stream);
+}
+
 void generate_vec_function(FILE *restrict stream, size_t dim, type_s type,
                            size_t fn_index) {
     fn_definition_s fn = fn_definitions[fn_index];
@@ -477,6 +633,16 @@ void generate_vec_dot(FILE *restrict stream, size_t dim, type_s type) {
     const char *type_keyword = type_definitions[type].keyword;
     fprintf(stream, "LINALG_DEF %s %s(%s a, %s b) {\n", type_keyword, vec_fn,
             vec_type, vec_type);
+    bool simd = has_simd_variant(dim, type);
+    if (simd) {
+        fprintf(stream, "#ifdef LINALG_SIMD\n");
+        fprintf(stream, INDENT "__m128 p = _mm_mul_ps(a.m, b.m);\n");
+        fprintf(stream, INDENT "p = _mm_add_ps(p, _mm_movehl_ps(p, p));\n");
+        fprintf(stream,
+                INDENT "p = _mm_add_ss(p, _mm_shuffle_ps(p, p, 0x55));\n");
+        fprintf(stream, INDENT "return _mm_cvtss_f32(p);\n");
+        fprintf(stream, "#else\n");
+    }
     if (dim <= 4) {
         fprintf(stream, INDENT "return ");
         for (size_t component = 0; component < dim; ++component) {
@@ -500,6 +666,9 @@ void generate_vec_dot(FILE *restrict stream, size_t dim, type_s type) {
         fprintf(stream, INDENT "}\n");
         fprintf(stream, INDENT "return result;\n");
     }
+    if (simd) {
+        fprintf(stream, "#endif // LINALG_SIMD\n");
+    }
     fprintf(stream, "}\n");
     EMPTY_LINE(stream);
 }
@@ -584,6 +753,39 @@ void generate_vec_unit(FILE *restrict stream, size_t dim, type_s type) {
     EMPTY_LINE(stream);
 }
 
+void generate_vec_unit_fast(FILE *restrict stream, size_t dim, type_s type) {
+    if (!has_fast_variant(type)) {
+        return;
+    }
+    const char *vec_type = vec_type_name(dim, type);
+    const char *vec_prefix = vec_prefix_name(dim, type);
+    fprintf(stream, "LINALG_DEF %s %s_unit_fast(%s v) {\n", vec_type,
+            vec_prefix, vec_type);
+    bool simd = has_simd_variant(dim, type);
+    if (simd) {
+        // The squared length ends up in every lane.
+        fprintf(stream, "#ifdef LINALG_SIMD\n");
+        fprintf(stream, INDENT "__m128 sq = _mm_mul_ps(v.m, v.m);\n");
+        fprintf(stream, INDENT "sq = _mm_add_ps(sq, _mm_shuffle_ps(sq, sq, "
+                               "_MM_SHUFFLE(2, 3, 0, 1)));\n");
+        fprintf(stream, INDENT "sq = _mm_add_ps(sq, _mm_shuffle_ps(sq, sq, "
+                               "_MM_SHUFFLE(1, 0, 3, 2)));\n");
+        fprintf(stream,
+                INDENT "return (%s){.m = _mm_mul_ps(v.m, "
+                       "rsqrtf_fast_ps(sq))};\n",
+                vec_type);
+        fprintf(stream, "#else\n");
+    }
+    fprintf(stream,
+            INDENT "return %s_mul(v, %s_splat(rsqrtf_fast(%s_sqrlen(v))));\n",
+            vec_prefix, vec_prefix, vec_prefix);
+    if (simd) {
+        fprintf(stream, "#endif // LINALG_SIMD\n");
+    }
+    fprintf(stream, "}\n");
+    EMPTY_LINE(stream);
+}
+
 void generate_vec_eq(FILE *restrict stream, size_t dim, type_s type) {
     if (!(type == FLOAT_T || type == DOUBLE_T)) {
         return; // TODO: implement abs for signed integer types.
@@ -661,7 +863,7 @@ void generate_vec_cross(FILE *restrict stream, size_t dim, type_s type) {
     } else {
         fprintf(stream, INDENT "%s result = {0};\n", vec_type);
         fprintf(stream, INDENT "result.x = a.y * b.z - a.z * b.y;\n");
-        fprintf(stream, INDENT "result.y = a.z * b.x - a.z * b.x;\n");
+        fprintf(stream, INDENT "result.y = a.z * b.x - a.x * b.z;\n");
         fprintf(stream, INDENT "result.z = a.x * b.y - a.y * b.x;\n");
         fprintf(stream, INDENT "return result;\n");
     }
@@ -692,6 +894,26 @@ void generate_vec_angle_between(FILE *restrict stream, size_t dim,
     EMPTY_LINE(stream);
 }
 
+void generate_vec_angle_between_fast(FILE *restrict stream, size_t dim,
+                                     type_s type) {
+    if (!(dim == 2 || dim == 3) || !has_fast_variant(type)) {
+        return;
+    }
+    const char *vec_type = vec_type_name(dim, type);
+    const char *vec_prefix = vec_prefix_name(dim, type);
+    fprintf(stream, "LINALG_DEF float %s_angle_between_fast(%s a, %s b) {\n",
+            vec_prefix, vec_type, vec_type);
+    fprintf(stream,
+            INDENT "float cos_angle = %s_dot(a, b) * rsqrtf_fast(%s_sqrlen(a) "
+                   "* %s_sqrlen(b));\n",
+            vec_prefix, vec_prefix, vec_prefix);
+    // Rounding can push the cosine slightly out of the domain of acos, and
+    // near (anti)parallel vectors it costs ~1e-3 rad, as with any acos.
+    fprintf(stream, INDENT "return acosf_fast(clampf(cos_angle, -1, 1));\n");
+    fprintf(stream, "}\n");
+    EMPTY_LINE(stream);
+}
+
 void generate_mat_definition(FILE *restrict stream, size_t dim, type_s type) {
     const char *type_keyword = type_definitions[type].keyword;
     fprintf(stream, "typedef union {\n");
@@ -710,6 +932,11 @@ void generate_mat_definition(FILE *restrict stream, size_t dim, type_s type) {
     fprintf(stream, INDENT "%s M[%zu][%zu];\n", type_keyword, dim, dim);
     fprintf(stream, INDENT "%s e[%zu * %zu];\n", type_keyword, dim, dim);
     fprintf(stream, INDENT "%s v[%zu];\n", vec_type_name(dim, type), dim);
+    if (has_simd_variant(dim, type)) {
+        fprintf(stream, "#ifdef LINALG_SIMD\n");
+        fprintf(stream, INDENT "__m128 m[%zu];\n", dim);
+        fprintf(stream, "#endif // LINALG_SIMD\n");
+    }
     fprintf(stream, "} mat%zu%s_t;\n", dim, type_definitions[type].suffix);
     EMPTY_LINE(stream);
 }
@@ -771,6 +998,24 @@ void generate_mat_mul(FILE *restrict stream, size_t dim, type_s type) {
     fprintf(stream, "LINALG_DEF %s_t %s_mul(%s_t A, %s_t B) {\n", mat_prefix,
             mat_prefix, mat_prefix, mat_prefix);
     fprintf(stream, INDENT "%s_t result;\n", mat_prefix);
+    bool simd = has_simd_variant(dim, type);
+    if (simd) {
+        // Row i of the product is a linear combination of the rows of B.
+        fprintf(stream, "#ifdef LINALG_SIMD\n");
+        for (size_t i = 0; i < dim; ++i) {
+            fprintf(stream,
+                    INDENT "result.m[%zu] = _mm_mul_ps(_mm_set1_ps(A._%zu1), "
+                           "B.m[0]);\n",
+                    i, i + 1);
+            for (size_t k = 1; k < dim; ++k) {
+                fprintf(stream,
+                        INDENT "result.m[%zu] = linalg_madd_ps(_mm_set1_ps("
+                               "A._%zu%zu), B.m[%zu], result.m[%zu]);\n",
+                        i, i + 1, k + 1, k, i);
+            }
+        }
+        fprintf(stream, "#else\n");
+    }
     for (size_t i = 0; i < dim; ++i) {
         for (size_t j = 0; j < dim; ++j) {
             fprintf(stream, INDENT "result._%zu%zu = ", i + 1, j + 1);
@@ -784,6 +1029,9 @@ void generate_mat_mul(FILE *restrict stream, size_t dim, type_s type) {
             fprintf(stream, ";\n");
         }
     }
+    if (simd) {
+        fprintf(stream, "#endif // LINALG_SIMD\n");
+    }
     fprintf(stream, INDENT "return result;\n");
     fprintf(stream, "}\n");
     EMPTY_LINE(stream);
@@ -795,6 +1043,20 @@ void generate_mat_mul_by_vec(FILE *restrict stream, size_t dim, type_s type) {
     fprintf(stream, "LINALG_DEF %s_t %s_mul_vec(%s_t M, %s_t v) {\n",
             vec_prefix, mat_prefix, mat_prefix, vec_prefix);
     fprintf(stream, INDENT "%s_t result;\n", vec_prefix);
+    bool simd = has_simd_variant(dim, type);
+    if (simd) {
+        // Transposing the four row-wise products lines up each row's terms
+        // in one lane, so three vertical adds finish all four dot products.
+        fprintf(stream, "#ifdef LINALG_SIMD\n");
+        for (size_t i = 0; i < dim; ++i) {
+            fprintf(stream, INDENT "__m128 p%zu = _mm_mul_ps(M.m[%zu], v.m);\n",
+                    i, i);
+        }
+        fprintf(stream, INDENT "_MM_TRANSPOSE4_PS(p0, p1, p2, p3);\n");
+        fprintf(stream, INDENT "result.m = _mm_add_ps(_mm_add_ps(p0, p1), "
+                               "_mm_add_ps(p2, p3));\n");
+        fprintf(stream, "#else\n");
+    }
     if (dim <= 4) {
         for (size_t component = 0; component < dim; ++component) {
             fprintf(stream, INDENT "result.%c = %s_dot(M.v[%zu], v);\n",
@@ -806,6 +1068,9 @@ void generate_mat_mul_by_vec(FILE *restrict stream, size_t dim, type_s type) {
                     component, vec_prefix, component);
         }
     }
+    if (simd) {
+        fprintf(stream, "#endif // LINALG_SIMD\n");
+    }
     fprintf(stream, INDENT "return result;\n");
     fprintf(stream, "}\n");
     EMPTY_LINE(stream);
@@ -815,7 +1080,7 @@ void generate_mat_hadamard(FILE *restrict stream, size_t dim, type_s type) {
     const char *mat_prefix = mat_prefix_name(dim, type);
     fprintf(stream, "LINALG_DEF %s_t %s_hadamard(%s_t A, %s_t B) {\n",
             mat_prefix, mat_prefix, mat_prefix, mat_prefix);
-    for (size_t component = 0; component < dim; ++component) {
+    for (size_t component = 0; component < dim * dim; ++component) {
         fprintf(stream, INDENT "A.e[%zu] *= B.e[%zu];\n", component, component);
     }
     fprintf(stream, INDENT "return A;\n");
@@ -823,8 +1088,23 @@ void generate_mat_hadamard(FILE *restrict stream, size_t dim, type_s type) {
     EMPTY_LINE(stream);
 }
 
+// Emits `c` and `s`, the cosine and sine of `angle`, computed once.
+void generate_sincos(FILE *restrict stream, type_s type, bool fast) {
+    const char *type_keyword = type_definitions[type].keyword;
+    const char *type_suffix = type == FLOAT_T ? "f" : "";
+    if (fast) {
+        fprintf(stream, INDENT "%s c, s;\n", type_keyword);
+        fprintf(stream, INDENT "sincosf_fast(angle, &s, &c);\n");
+    } else {
+        fprintf(stream, INDENT "const %s c = cos%s(angle);\n", type_keyword,
+                type_suffix);
+        fprintf(stream, INDENT "const %s s = sin%s(angle);\n", type_keyword,
+                type_suffix);
+    }
+}
+
 void generate_mat_rotation_constructor(FILE *restrict stream, size_t dim,
-                                       type_s type) {
+                                       type_s type, bool fast) {
     if (dim > 4) {
         return; // I don't see any use case for rotating high dimension
                 // matrices.
@@ -832,38 +1112,54 @@ void generate_mat_rotation_constructor(FILE *restrict stream, size_t dim,
     if (!(type == FLOAT_T || type == DOUBLE_T)) {
         return; // trigonometric functions do not support integer values.
     }
+    if (fast && !has_fast_variant(type)) {
+        return;
+    }
+    const char *suffix = fast ? "_fast" : "";
     const char *mat_prefix = mat_prefix_name(dim, type);
     const char *type_keyword = type_definitions[type].keyword;
-    const char *type_suffix = type == FLOAT_T ? "f" : "";
     if (dim == 2) {
-        fprintf(stream, "LINALG_DEF %s_t %s_R(%s angle) {\n", mat_prefix,
-                mat_prefix, type_keyword);
+        fprintf(stream, "LINALG_DEF %s_t %s_R%s(%s angle) {\n", mat_prefix,
+                mat_prefix, suffix, type_keyword);
+        generate_sincos(stream, type, fast);
         fprintf(stream, INDENT "%s_t R;\n", mat_prefix);
-        fprintf(stream, INDENT "R._11 = cos%s(angle);\n", type_suffix);
-        fprintf(stream, INDENT "R._12 = -sin%s(angle);\n", type_suffix);
-        fprintf(stream, INDENT "R._21 = sin%s(angle);\n", type_suffix);
-        fprintf(stream, INDENT "R._22 = cos%s(angle);\n", type_suffix);
+        fprintf(stream, INDENT "R._11 = c;\n");
+        fprintf(stream, INDENT "R._12 = -s;\n");
+        fprintf(stream, INDENT "R._21 = s;\n");
+        fprintf(stream, INDENT "R._22 = c;\n");
     } else {
         // NOTE: I dont't see any use case for w-axis rotation of a 4x4
         // matrix. Most of the time, the matrix the rotation is performed
         // on is a transform matrix, so a w-axis rotation does not make sense.
         fprintf(stream,
-                "LINALG_DEF %s_t %s_R(rotate_axis_s axis, %s angle) {\n",
-                mat_prefix, mat_prefix, type_keyword);
+                "LINALG_DEF %s_t %s_R%s(rotate_axis_s axis, %s angle) {\n",
+                mat_prefix, mat_prefix, suffix, type_keyword);
+        generate_sincos(stream, type, fast);
         fprintf(stream, INDENT "%s_t R = {0};\n", mat_prefix);
         fprintf(stream, INDENT "size_t i = (axis + 1) %% 3;\n");
         fprintf(stream, INDENT "size_t j = (axis + 2) %% 3;\n");
-        fprintf(stream, INDENT "R.M[i][i] = cos%s(angle);\n", type_suffix);
-        fprintf(stream, INDENT "R.M[i][j] = -sin%s(angle);\n", type_suffix);
-        fprintf(stream, INDENT "R.M[j][i] = sin%s(angle);\n", type_suffix);
-        fprintf(stream, INDENT "R.M[j][j] = cos%s(angle);\n", type_suffix);
+        fprintf(stream, INDENT "R.M[i][i] = c;\n");
+        fprintf(stream, INDENT "R.M[i][j] = -s;\n");
+        fprintf(stream, INDENT "R.M[j][i] = s;\n");
+        fprintf(stream, INDENT "R.M[j][j] = c;\n");
+        fprintf(stream, INDENT "R.M[axis][axis] = 1;\n");
+        if (dim == 4) {
+            fprintf(stream, INDENT "R.M[3][3] = 1;\n");
+        }
     }
     fprintf(stream, INDENT "return R;\n");
     fprintf(stream, "}\n");
     EMPTY_LINE(stream);
 }
 
-void generate_mat_rotate(FILE *restrict stream, size_t dim, type_s type) {
+typedef enum {
+    ROTATE_VALUE = 0, // `matN_rotate(A, ...)` returns the rotated matrix.
+    ROTATE_TO,        // `matN_rotate_to(out, &A, ...)`.
+    ROTATE_ASSIGN,    // `matN_rotate_assign(&A, ...)`.
+} rotate_form_s;
+
+void generate_mat_rotate(FILE *restrict stream, size_t dim, type_s type,
+                         bool fast, rotate_form_s form) {
     if (dim > 4) {
         return; // I don't see any use case for rotating high dimension
                 // matrices.
@@ -871,56 +1167,89 @@ void generate_mat_rotate(FILE *restrict stream, size_t dim, type_s type) {
     if (!(type == FLOAT_T || type == DOUBLE_T)) {
         return; // trigonometric functions do not support integer values.
     }
+    if (fast && !has_fast_variant(type)) {
+        return;
+    }
+    const char *suffix = fast ? "_fast" : "";
     const char *mat_prefix = mat_prefix_name(dim, type);
     const char *type_keyword = type_definitions[type].keyword;
-    const char *type_suffix = type == FLOAT_T ? "f" : "";
+    const char *axis_param = dim == 2 ? "" : "rotate_axis_s axis, ";
+    // The matrix the elements are updated in.
+    const char *target = "A.";
+    switch (form) {
+    case ROTATE_VALUE:
+        fprintf(stream, "LINALG_DEF %s_t %s_rotate%s(%s_t A, %s%s angle) {\n",
+                mat_prefix, mat_prefix, suffix, mat_prefix, axis_param,
+                type_keyword);
+        break;
+    case ROTATE_TO:
+        fprintf(stream,
+                "LINALG_DEF void %s_rotate%s_to(%s_t *restrict out, const "
+                "%s_t *A, %s%s angle) {\n",
+                mat_prefix, suffix, mat_prefix, mat_prefix, axis_param,
+                type_keyword);
+        target = "out->";
+        break;
+    case ROTATE_ASSIGN:
+        fprintf(stream,
+                "LINALG_DEF void %s_rotate%s_assign(%s_t *A, %s%s angle) {\n",
+                mat_prefix, suffix, mat_prefix, axis_param, type_keyword);
+        target = "A->";
+        break;
+    }
+    generate_sincos(stream, type, fast);
+    if (form == ROTATE_TO) {
+        fprintf(stream, INDENT "*out = *A;\n");
+    }
     if (dim == 2) {
-        fprintf(stream, "LINALG_DEF %s_t %s_rotate(%s_t A, %s angle) {\n",
-                mat_prefix, mat_prefix, mat_prefix, type_keyword);
-        fprintf(stream, INDENT "A._11 *= cos%s(angle);\n", type_suffix);
-        fprintf(stream, INDENT "A._12 *= -sin%s(angle);\n", type_suffix);
-        fprintf(stream, INDENT "A._21 *= sin%s(angle);\n", type_suffix);
-        fprintf(stream, INDENT "A._22 *= cos%s(angle);\n", type_suffix);
+        fprintf(stream, INDENT "%s_11 *= c;\n", target);
+        fprintf(stream, INDENT "%s_12 *= -s;\n", target);
+        fprintf(stream, INDENT "%s_21 *= s;\n", target);
+        fprintf(stream, INDENT "%s_22 *= c;\n", target);
     } else {
         // NOTE: I dont't see any use case for w-axis rotation of a 4x4
         // matrix. Most of the time, the matrix the rotation is performed
         // on is a transform matrix, so a w-axis rotation does not make sense.
-        fprintf(stream,
-                "LINALG_DEF %s_t %s_rotate(%s_t A, rotate_axis_s axis, %s "
-                "angle) {\n",
-                mat_prefix, mat_prefix, mat_prefix, type_keyword);
         fprintf(stream, INDENT "size_t i = (axis + 1) %% 3;\n");
         fprintf(stream, INDENT "size_t j = (axis + 2) %% 3;\n");
-        fprintf(stream, INDENT "A.M[i][i] *= cos%s(angle);\n", type_suffix);
-        fprintf(stream, INDENT "A.M[i][j] *= -sin%s(angle);\n", type_suffix);
-        fprintf(stream, INDENT "A.M[j][i] *= sin%s(angle);\n", type_suffix);
-        fprintf(stream, INDENT "A.M[j][j] *= cos%s(angle);\n", type_suffix);
+        fprintf(stream, INDENT "%sM[i][i] *= c;\n", target);
+        fprintf(stream, INDENT "%sM[i][j] *= -s;\n", target);
+        fprintf(stream, INDENT "%sM[j][i] *= s;\n", target);
+        fprintf(stream, INDENT "%sM[j][j] *= c;\n", target);
+    }
+    if (form == ROTATE_VALUE) {
+        fprintf(stream, INDENT "return A;\n");
     }
-    fprintf(stream, INDENT "return A;\n");
     fprintf(stream, "}\n");
     EMPTY_LINE(stream);
 }
 
 void generate_mat_transform_constructor(FILE *restrict stream, size_t dim,
-                                        type_s type) {
+                                        type_s type, bool fast) {
     if (dim != 4) {
         return;
     }
     if (!(type == FLOAT_T || type == DOUBLE_T)) {
         return; // trigonometric functions do not support integer values.
     }
+    if (fast && !has_fast_variant(type)) {
+        return;
+    }
+    const char *suffix = fast ? "_fast" : "";
     const char *mat_prefix = mat_prefix_name(dim, type);
     const char *type_keyword = type_definitions[type].keyword;
-    const char *type_suffix = type == FLOAT_T ? "f" : "";
-    fprintf(stream, "LINALG_DEF %s_t %s_T(rotate_axis_s axis, %s angle) {\n",
-            mat_prefix, mat_prefix, type_keyword);
+    fprintf(stream,
+            "LINALG_DEF %s_t %s_T%s(rotate_axis_s axis, %s angle) {\n",
+            mat_prefix, mat_prefix, suffix, type_keyword);
+    generate_sincos(stream, type, fast);
     fprintf(stream, INDENT "%s_t T = {0};\n", mat_prefix);
     fprintf(stream, INDENT "size_t i = (axis + 1) %% 3;\n");
     fprintf(stream, INDENT "size_t j = (axis + 2) %% 3;\n");
-    fprintf(stream, INDENT "T.M[i][i] = cos%s(angle);\n", type_suffix);
-    fprintf(stream, INDENT "T.M[i][j] = -sin%s(angle);\n", type_suffix);
-    fprintf(stream, INDENT "T.M[j][i] = sin%s(angle);\n", type_suffix);
-    fprintf(stream, INDENT "T.M[j][j] = cos%s(angle);\n", type_suffix);
+    fprintf(stream, INDENT "T.M[i][i] = c;\n");
+    fprintf(stream, INDENT "T.M[i][j] = -s;\n");
+    fprintf(stream, INDENT "T.M[j][i] = s;\n");
+    fprintf(stream, INDENT "T.M[j][j] = c;\n");
+    fprintf(stream, INDENT "T.M[axis][axis] = 1;\n");
     fprintf(stream, INDENT "T.M[3][3] = 1;\n");
     fprintf(stream, INDENT "return T;\n");
     fprintf(stream, "}\n");
@@ -934,98 +1263,3552 @@ void generate_mat_variadic_mul(FILE *restrict stream, size_t dim, type_s type) {
             mat_prefix);
     fprintf(stream, INDENT "va_list args;\n");
     fprintf(stream, INDENT "va_start(args, n);\n");
-    fprintf(stream, "%s_t %s = %s_I();\n", mat_prefix, result_name, mat_prefix);
+    fprintf(stream, INDENT "%s_t %s = %s_I();\n", mat_prefix, result_name,
+            mat_prefix);
     fprintf(stream, INDENT "for (size_t i = 0; i < n; ++i) {\n");
     fprintf(stream, INDENT INDENT "%s_t A = va_arg(args, %s_t);\n", mat_prefix,
             mat_prefix);
     fprintf(stream, INDENT INDENT "%s = %s_mul(%s, A);\n", result_name,
             mat_prefix, result_name);
     fprintf(stream, INDENT "}\n");
+    fprintf(stream, INDENT "va_end(args);\n");
     fprintf(stream, INDENT "return %s;\n", result_name);
     fprintf(stream, "}\n");
     EMPTY_LINE(stream);
 }
 
-int main() {
-    generate_head(stdout);
-    for (size_t dim = MIN_DIM; dim <= MAX_DIM; ++dim) {
-        for (size_t type = 0; type < NUM_TYPES; ++type) {
-            generate_vec_definition(stdout, dim, type);
-            generate_mat_definition(stdout, dim, type);
+// NOTE: the chain is split in balanced halves (the order of the factors is
+// kept), so the products of both halves are independent and can overlap.
+void generate_mat_mul_chain(FILE *restrict stream, size_t dim, type_s type) {
+    const char *mat_prefix = mat_prefix_name(dim, type);
+    fprintf(stream,
+            "LINALG_DEF %s_t %s_mul_chain(const %s_t *Ms, size_t n) {\n",
+            mat_prefix, mat_prefix, mat_prefix);
+    fprintf(stream, INDENT "if (n == 0) {\n");
+    fprintf(stream, INDENT INDENT "return %s_I();\n", mat_prefix);
+    fprintf(stream, INDENT "}\n");
+    fprintf(stream, INDENT "if (n == 1) {\n");
+    fprintf(stream, INDENT INDENT "return Ms[0];\n");
+    fprintf(stream, INDENT "}\n");
+    fprintf(stream, INDENT "size_t half = n / 2;\n");
+    fprintf(stream, INDENT "%s_t lhs = %s_mul_chain(Ms, half);\n", mat_prefix,
+            mat_prefix);
+    fprintf(stream, INDENT "%s_t rhs = %s_mul_chain(Ms + half, n - half);\n",
+            mat_prefix, mat_prefix);
+    fprintf(stream, INDENT "%s_t product;\n", mat_prefix);
+    fprintf(stream, INDENT "%s_mul_to(&product, &lhs, &rhs);\n", mat_prefix);
+    fprintf(stream, INDENT "return product;\n");
+    fprintf(stream, "}\n");
+    EMPTY_LINE(stream);
+}
+
+// NOTE: the pointer-based variants below mirror the by-value API without
+// copying their arguments, which matters whenever the compiler does not inline
+// the calls (e.g. `-O0` or `-Os`). The `_to` variants write their result to
+// `out`, which must not alias the inputs; the `_assign` variants update their
+// first argument in place.
+void generate_vec_operation_to(FILE *restrict stream, size_t dim, type_s type,
+                               op_s op) {
+    const char *vec_type = vec_type_name(dim, type);
+    const char *vec_fn = vec_fn_name(
+        dim, type, varia_temp_sprintf("%s_to", op_definitions[op].name));
+    fprintf(stream,
+            "LINALG_DEF void %s(%s *restrict out, const %s *a, const %s *b) "
+            "{\n",
+            vec_fn, vec_type, vec_type, vec_type);
+    const char *simd_op = simd_op_intrinsic(op);
+    bool simd = has_simd_variant(dim, type) && simd_op != NULL;
+    if (simd) {
+        fprintf(stream, "#ifdef LINALG_SIMD\n");
+        fprintf(stream, INDENT "out->m = %s(a->m, b->m);\n", simd_op);
+        fprintf(stream, "#else\n");
+    }
+    for (size_t component = 0; component < dim; ++component) {
+        const char *c = vec_component_name(dim, component);
+        // Modulo operator does not support floating-point types.
+        if (op == OP_MOD && (type == FLOAT_T || type == DOUBLE_T)) {
+            fprintf(stream, INDENT "out->%s = %s(a->%s, b->%s);\n", c,
+                    type == FLOAT_T ? "fmodf" : "fmod", c, c);
+        } else {
+            fprintf(stream, INDENT "out->%s = a->%s %c b->%s;\n", c, c,
+                    op_definitions[op].keyword[0], c);
         }
     }
+    if (simd) {
+        fprintf(stream, "#endif // LINALG_SIMD\n");
+    }
+    fprintf(stream, "}\n");
+    EMPTY_LINE(stream);
+}
 
-    // NOTES:
-    // - For matrices, I think higher dimension constructors add an
-    //   unnecessary amount of bloat in the library.
-    for (size_t dim = MIN_DIM; dim <= MAX_DIM; ++dim) {
-        for (size_t type = 0; type < NUM_TYPES; ++type) {
-            generate_vec_constructor(stdout, dim, type);
-            generate_vec_scalar_constructor(stdout, dim, type);
-            // NOTE: there are no matrix constructor with specified values
-            // generated, because the number of possible ways to specify the
-            // parameters is too high.
-            generate_mat_zero_constructor(stdout, dim, type);
-            generate_mat_identity_constructor(stdout, dim, type);
-            generate_mat_scalar_constructor(stdout, dim, type);
-            generate_mat_diag_constructor(stdout, dim, type);
-            generate_mat_rotation_constructor(stdout, dim, type);
-            generate_mat_transform_constructor(stdout, dim, type);
+void generate_vec_operation_assign(FILE *restrict stream, size_t dim,
+                                   type_s type, op_s op) {
+    const char *vec_type = vec_type_name(dim, type);
+    const char *vec_fn = vec_fn_name(
+        dim, type, varia_temp_sprintf("%s_assign", op_definitions[op].name));
+    fprintf(stream, "LINALG_DEF void %s(%s *a, %s b) {\n", vec_fn, vec_type,
+            vec_type);
+    const char *simd_op = simd_op_intrinsic(op);
+    bool simd = has_simd_variant(dim, type) && simd_op != NULL;
+    if (simd) {
+        fprintf(stream, "#ifdef LINALG_SIMD\n");
+        fprintf(stream, INDENT "a->m = %s(a->m, b.m);\n", simd_op);
+        fprintf(stream, "#else\n");
+    }
+    for (size_t component = 0; component < dim; ++component) {
+        const char *c = vec_component_name(dim, component);
+        // Modulo operator does not support floating-point types.
+        if (op == OP_MOD && (type == FLOAT_T || type == DOUBLE_T)) {
+            fprintf(stream, INDENT "a->%s = %s(a->%s, b.%s);\n", c,
+                    type == FLOAT_T ? "fmodf" : "fmod", c, c);
+        } else {
+            fprintf(stream, INDENT "a->%s %s b.%s;\n", c,
+                    op_definitions[op].keyword, c);
         }
     }
+    if (simd) {
+        fprintf(stream, "#endif // LINALG_SIMD\n");
+    }
+    fprintf(stream, "}\n");
+    EMPTY_LINE(stream);
+}
 
-    for (size_t dim = MIN_DIM; dim <= MAX_DIM; ++dim) {
-        for (size_t type = 0; type < NUM_TYPES; ++type) {
-            for (size_t op = 0; op < NUM_OPS; ++op) {
-                generate_vec_operation(stdout, dim, type, op);
+void generate_vec_function_to(FILE *restrict stream, size_t dim, type_s type,
+                              size_t fn_index) {
+    fn_definition_s fn = fn_definitions[fn_index];
+    if (fn.generic_selection[type] == NULL) {
+        return;
+    }
+    assert(fn.arity > 0);
+    const char *vec_type = vec_type_name(dim, type);
+    const char *vec_fn =
+        vec_fn_name(dim, type, varia_temp_sprintf("%s_to", fn.name));
+    fprintf(stream, "LINALG_DEF void %s(%s *restrict out", vec_fn, vec_type);
+    for (size_t param = 0; param < fn.arity; ++param) {
+        fprintf(stream, ", const %s *%s", vec_type, fn.params[param]);
+    }
+    fprintf(stream, ") {\n");
+    for (size_t component = 0; component < dim; ++component) {
+        const char *c = vec_component_name(dim, component);
+        fprintf(stream, INDENT "out->%s = %s(", c, fn.generic_selection[type]);
+        for (size_t param = 0; param < fn.arity; ++param) {
+            if (param > 0) {
+                fprintf(stream, ", ");
+            }
+            fprintf(stream, "%s->%s", fn.params[param], c);
+        }
+        fprintf(stream, ");\n");
+    }
+    fprintf(stream, "}\n");
+    EMPTY_LINE(stream);
+}
+
+void generate_mat_mul_to(FILE *restrict stream, size_t dim, type_s type) {
+    const char *mat_prefix = mat_prefix_name(dim, type);
+    fprintf(stream,
+            "LINALG_DEF void %s_mul_to(%s_t *restrict out, const %s_t *A, "
+            "const %s_t *B) {\n",
+            mat_prefix, mat_prefix, mat_prefix, mat_prefix);
+    bool simd = has_simd_variant(dim, type);
+    if (simd) {
+        fprintf(stream, "#ifdef LINALG_SIMD\n");
+        for (size_t i = 0; i < dim; ++i) {
+            fprintf(stream,
+                    INDENT "__m128 r%zu = _mm_mul_ps(_mm_set1_ps(A->_%zu1), "
+                           "B->m[0]);\n",
+                    i, i + 1);
+            for (size_t k = 1; k < dim; ++k) {
+                fprintf(stream,
+                        INDENT "r%zu = linalg_madd_ps(_mm_set1_ps(A->_%zu%zu), "
+                               "B->m[%zu], r%zu);\n",
+                        i, i + 1, k + 1, k, i);
+            }
+        }
+        for (size_t i = 0; i < dim; ++i) {
+            fprintf(stream, INDENT "out->m[%zu] = r%zu;\n", i, i);
+        }
+        fprintf(stream, "#else\n");
+    }
+    for (size_t i = 0; i < dim; ++i) {
+        for (size_t j = 0; j < dim; ++j) {
+            fprintf(stream, INDENT "out->_%zu%zu = ", i + 1, j + 1);
+            for (size_t k = 0; k < dim; ++k) {
+                if (k > 0) {
+                    fprintf(stream, " + ");
+                }
+                fprintf(stream, "A->_%zu%zu * B->_%zu%zu", i + 1, k + 1, k + 1,
+                        j + 1);
+            }
+            fprintf(stream, ";\n");
+        }
+    }
+    if (simd) {
+        fprintf(stream, "#endif // LINALG_SIMD\n");
+    }
+    fprintf(stream, "}\n");
+    EMPTY_LINE(stream);
+}
+
+void generate_mat_mul_by_vec_to(FILE *restrict stream, size_t dim,
+                                type_s type) {
+    const char *mat_prefix = mat_prefix_name(dim, type);
+    const char *vec_prefix = vec_prefix_name(dim, type);
+    fprintf(stream,
+            "LINALG_DEF void %s_mul_vec_to(%s_t *restrict out, const %s_t *M, "
+            "const %s_t *v) {\n",
+            mat_prefix, vec_prefix, mat_prefix, vec_prefix);
+    bool simd = has_simd_variant(dim, type);
+    if (simd) {
+        fprintf(stream, "#ifdef LINALG_SIMD\n");
+        for (size_t i = 0; i < dim; ++i) {
+            fprintf(stream,
+                    INDENT "__m128 p%zu = _mm_mul_ps(M->m[%zu], v->m);\n", i,
+                    i);
+        }
+        fprintf(stream, INDENT "_MM_TRANSPOSE4_PS(p0, p1, p2, p3);\n");
+        fprintf(stream, INDENT "out->m = _mm_add_ps(_mm_add_ps(p0, p1), "
+                               "_mm_add_ps(p2, p3));\n");
+        fprintf(stream, "#else\n");
+    }
+    for (size_t i = 0; i < dim; ++i) {
+        fprintf(stream, INDENT "out->%s = ", vec_component_name(dim, i));
+        for (size_t j = 0; j < dim; ++j) {
+            if (j > 0) {
+                fprintf(stream, " + ");
             }
-            for (size_t fn = 0; fn < ARRAY_LEN(fn_definitions); ++fn) {
-                generate_vec_function(stdout, dim, type, fn);
+            fprintf(stream, "M->_%zu%zu * v->%s", i + 1, j + 1,
+                    vec_component_name(dim, j));
+        }
+        fprintf(stream, ";\n");
+    }
+    if (simd) {
+        fprintf(stream, "#endif // LINALG_SIMD\n");
+    }
+    fprintf(stream, "}\n");
+    EMPTY_LINE(stream);
+}
+
+void generate_mat_hadamard_to(FILE *restrict stream, size_t dim, type_s type) {
+    const char *mat_prefix = mat_prefix_name(dim, type);
+    fprintf(stream,
+            "LINALG_DEF void %s_hadamard_to(%s_t *restrict out, const %s_t *A, "
+            "const %s_t *B) {\n",
+            mat_prefix, mat_prefix, mat_prefix, mat_prefix);
+    for (size_t component = 0; component < dim * dim; ++component) {
+        fprintf(stream, INDENT "out->e[%zu] = A->e[%zu] * B->e[%zu];\n",
+                component, component, component);
+    }
+    fprintf(stream, "}\n");
+    EMPTY_LINE(stream);
+}
+
+#define TRANSFORM_ARRAY_UNROLL 4
+
+// Index of the `offset`-th element of an unrolled loop iteration.
+const char *unrolled_index(size_t offset) {
+    return offset == 0 ? "i" : varia_temp_sprintf("i + %zu", offset);
+}
+
+// Emits the statements transforming `in[i + offset]` into `out[i + offset]`
+// with the matrix elements hoisted in `mIJ` locals.
+void generate_transform_point(FILE *restrict stream, size_t dim, type_s type,
+                              size_t offset) {
+    const char *type_keyword = type_definitions[type].keyword;
+    const char *index = unrolled_index(offset);
+    for (size_t j = 0; j < dim; ++j) {
+        fprintf(stream, INDENT INDENT "const %s v%zu_%zu = in[%s].e[%zu];\n",
+                type_keyword, offset, j, index, j);
+    }
+    for (size_t i = 0; i < dim; ++i) {
+        fprintf(stream, INDENT INDENT "out[%s].e[%zu] = ", index, i);
+        for (size_t j = 0; j < dim; ++j) {
+            if (j > 0) {
+                fprintf(stream, " + ");
             }
-            for (variadic_op_s variadic_op = 0; variadic_op < NUM_VARIADIC_OPS;
-                 ++variadic_op) {
-                generate_vec_variadic_operation(stdout, dim, type, variadic_op);
+            fprintf(stream, "m%zu%zu * v%zu_%zu", i + 1, j + 1, offset, j);
+        }
+        fprintf(stream, ";\n");
+    }
+}
+
+void generate_mat_transform_array(FILE *restrict stream, size_t dim,
+                                  type_s type) {
+    const char *mat_prefix = mat_prefix_name(dim, type);
+    const char *vec_type = vec_type_name(dim, type);
+    const char *type_keyword = type_definitions[type].keyword;
+    fprintf(stream,
+            "LINALG_DEF void %s_transform_array(const %s_t *M, const %s "
+            "*restrict in, %s *restrict out, size_t n) {\n",
+            mat_prefix, mat_prefix, vec_type, vec_type);
+    fprintf(stream, INDENT "size_t i = 0;\n");
+    bool simd = has_simd_variant(dim, type);
+    if (simd) {
+        // Each output is a linear combination of the columns of M, weighted
+        // by the broadcast components of the input point.
+        fprintf(stream, "#ifdef LINALG_SIMD\n");
+        for (size_t j = 0; j < dim; ++j) {
+            fprintf(stream, INDENT "__m128 c%zu = M->m[%zu];\n", j, j);
+        }
+        fprintf(stream, INDENT "_MM_TRANSPOSE4_PS(c0, c1, c2, c3);\n");
+        fprintf(stream, INDENT "for (; i + %d <= n; i += %d) {\n",
+                TRANSFORM_ARRAY_UNROLL, TRANSFORM_ARRAY_UNROLL);
+        for (size_t p = 0; p < TRANSFORM_ARRAY_UNROLL; ++p) {
+            fprintf(stream, INDENT INDENT "__m128 v%zu = in[%s].m;\n", p,
+                    unrolled_index(p));
+            fprintf(stream,
+                    INDENT INDENT "__m128 r%zu = _mm_mul_ps(c0, "
+                                  "_mm_shuffle_ps(v%zu, v%zu, 0x00));\n",
+                    p, p, p);
+            for (size_t j = 1; j < dim; ++j) {
+                unsigned lane = (unsigned)(j * 0x55);
+                fprintf(stream,
+                        INDENT INDENT "r%zu = linalg_madd_ps(c%zu, "
+                                      "_mm_shuffle_ps(v%zu, v%zu, 0x%02X), "
+                                      "r%zu);\n",
+                        p, j, p, p, lane, p);
             }
-            generate_vec_dot(stdout, dim, type);
-            generate_vec_cross(stdout, dim, type);
-            generate_vec_sqrlen(stdout, dim, type);
-            generate_vec_1norm(stdout, dim, type);
-            generate_vec_2norm(stdout, dim, type);
-            generate_vec_unit(stdout, dim, type);
-            generate_vec_eq(stdout, dim, type);
-            generate_vec_reflect(stdout, dim, type);
-            generate_vec_direction(stdout, dim, type);
-            generate_vec_angle_between(stdout, dim, type);
-            generate_mat_mul(stdout, dim, type);
-            generate_mat_variadic_mul(stdout, dim, type);
-            generate_mat_mul_by_vec(stdout, dim, type);
-            generate_mat_hadamard(stdout, dim, type);
-            generate_mat_rotate(stdout, dim, type);
-        }
-    }
-
-    fprintf(stdout, "#endif // LINALG_H\n");
+        }
+        for (size_t p = 0; p < TRANSFORM_ARRAY_UNROLL; ++p) {
+            fprintf(stream, INDENT INDENT "out[%s].m = r%zu;\n",
+                    unrolled_index(p), p);
+        }
+        fprintf(stream, INDENT "}\n");
+        fprintf(stream, INDENT "for (; i < n; ++i) {\n");
+        fprintf(stream, INDENT INDENT "out[i] = %s_mul_vec(*M, in[i]);\n",
+                mat_prefix);
+        fprintf(stream, INDENT "}\n");
+        fprintf(stream, "#else\n");
+    }
+    // Hoist the matrix out of the loop so it lives in registers.
+    for (size_t i = 0; i < dim; ++i) {
+        for (size_t j = 0; j < dim; ++j) {
+            fprintf(stream, INDENT "const %s m%zu%zu = M->_%zu%zu;\n",
+                    type_keyword, i + 1, j + 1, i + 1, j + 1);
+        }
+    }
+    fprintf(stream, INDENT "for (; i + %d <= n; i += %d) {\n",
+            TRANSFORM_ARRAY_UNROLL, TRANSFORM_ARRAY_UNROLL);
+    for (size_t p = 0; p < TRANSFORM_ARRAY_UNROLL; ++p) {
+        generate_transform_point(stream, dim, type, p);
+    }
+    fprintf(stream, INDENT "}\n");
+    fprintf(stream, INDENT "for (; i < n; ++i) {\n");
+    generate_transform_point(stream, dim, type, 0);
+    fprintf(stream, INDENT "}\n");
+    if (simd) {
+        fprintf(stream, "#endif // LINALG_SIMD\n");
+    }
+    fprintf(stream, "}\n");
+    EMPTY_LINE(stream);
+}
 
+void generate_mat_transpose(FILE *restrict stream, size_t dim, type_s type) {
+    const char *mat_prefix = mat_prefix_name(dim, type);
+    fprintf(stream, "LINALG_DEF %s_t %s_transpose(%s_t M) {\n", mat_prefix,
+            mat_prefix, mat_prefix);
+    bool simd = has_simd_variant(dim, type);
+    if (simd) {
+        fprintf(stream, "#ifdef LINALG_SIMD\n");
+        fprintf(stream,
+                INDENT "_MM_TRANSPOSE4_PS(M.m[0], M.m[1], M.m[2], M.m[3]);\n");
+        fprintf(stream, INDENT "return M;\n");
+        fprintf(stream, "#else\n");
+    }
+    fprintf(stream, INDENT "%s_t T;\n", mat_prefix);
+    for (size_t i = 0; i < dim; ++i) {
+        for (size_t j = 0; j < dim; ++j) {
+            fprintf(stream, INDENT "T._%zu%zu = M._%zu%zu;\n", i + 1, j + 1,
+                    j + 1, i + 1);
+        }
+    }
+    fprintf(stream, INDENT "return T;\n");
+    if (simd) {
+        fprintf(stream, "#endif // LINALG_SIMD\n");
+    }
+    fprintf(stream, "}\n");
+    EMPTY_LINE(stream);
+}
+
+/* Determinants and inverses are closed-form (cofactor expansion and
+ * adjugate), which is much cheaper than a general decomposition for these
+ * sizes. The 4x4 versions share the twelve 2x2 minors of the top and bottom
+ * row pairs:
+ *
+ *     s0 = |a11 a12|  s1 = |a11 a13|  ...  s5 = |a13 a14|
+ *          |a21 a22|       |a21 a23|            |a23 a24|
+ *
+ * and likewise c0..c5 for rows 3 and 4, so that
+ * det = s0 c5 - s1 c4 + s2 c3 + s3 c2 - s4 c1 + s5 c0 (Laplace expansion).
+ *
+ * NOTE: inverting a singular matrix divides by zero; check `matN<t>_det` first
+ * when the input may be degenerate.
+ */
+
+// Pairs of columns of the 2x2 minors `s0..s5` (and `c0..c5`).
+static const size_t mat4_minor_columns[6][2] = {
+    {1, 2}, {1, 3}, {1, 4}, {2, 3}, {2, 4}, {3, 4},
+};
+
+void generate_mat4_minors(FILE *restrict stream, type_s type) {
+    const char *type_keyword = type_definitions[type].keyword;
+    for (size_t k = 0; k < 6; ++k) {
+        size_t p = mat4_minor_columns[k][0], q = mat4_minor_columns[k][1];
+        fprintf(stream,
+                INDENT "const %s s%zu = M._1%zu * M._2%zu - M._2%zu * "
+                       "M._1%zu;\n",
+                type_keyword, k, p, q, p, q);
+    }
+    for (size_t k = 0; k < 6; ++k) {
+        size_t p = mat4_minor_columns[k][0], q = mat4_minor_columns[k][1];
+        fprintf(stream,
+                INDENT "const %s c%zu = M._3%zu * M._4%zu - M._4%zu * "
+                       "M._3%zu;\n",
+                type_keyword, k, p, q, p, q);
+    }
+}
+
+// Cofactor of the element at row `i` and column `j` (0-based) of a 3x3
+// matrix: the cyclic order of the remaining rows and columns gives the sign.
+const char *mat3_cofactor(size_t i, size_t j) {
+    size_t i1 = (i + 1) % 3 + 1, i2 = (i + 2) % 3 + 1;
+    size_t j1 = (j + 1) % 3 + 1, j2 = (j + 2) % 3 + 1;
+    return varia_temp_sprintf("(M._%zu%zu * M._%zu%zu - M._%zu%zu * M._%zu%zu)",
+                              i1, j1, i2, j2, i1, j2, i2, j1);
+}
+
+void generate_mat_det(FILE *restrict stream, size_t dim, type_s type) {
+    if (dim > 4 || !is_floating_type(type)) {
+        return;
+    }
+    const char *mat_prefix = mat_prefix_name(dim, type);
+    const char *type_keyword = type_definitions[type].keyword;
+    fprintf(stream, "LINALG_DEF %s %s_det(%s_t M) {\n", type_keyword,
+            mat_prefix, mat_prefix);
+    switch (dim) {
+    case 2:
+        fprintf(stream, INDENT "return M._11 * M._22 - M._12 * M._21;\n");
+        break;
+    case 3:
+        fprintf(stream, INDENT "return ");
+        for (size_t j = 0; j < 3; ++j) {
+            fprintf(stream, "%sM._1%zu * %s", j > 0 ? " + " : "", j + 1,
+                    mat3_cofactor(0, j));
+        }
+        fprintf(stream, ";\n");
+        break;
+    case 4:
+        generate_mat4_minors(stream, type);
+        fprintf(stream, INDENT "return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - "
+                               "s4 * c1 + s5 * c0;\n");
+        break;
+    }
+    fprintf(stream, "}\n");
+    EMPTY_LINE(stream);
+}
+
+// Entries of the 4x4 adjugate in terms of the minors, row by row.
+static const char *mat4_adjugate[4][4] = {
+    {"M._22 * c5 - M._23 * c4 + M._24 * c3",
+     "-M._12 * c5 + M._13 * c4 - M._14 * c3",
+     "M._42 * s5 - M._43 * s4 + M._44 * s3",
+     "-M._32 * s5 + M._33 * s4 - M._34 * s3"},
+    {"-M._21 * c5 + M._23 * c2 - M._24 * c1",
+     "M._11 * c5 - M._13 * c2 + M._14 * c1",
+     "-M._41 * s5 + M._43 * s2 - M._44 * s1",
+     "M._31 * s5 - M._33 * s2 + M._34 * s1"},
+    {"M._21 * c4 - M._22 * c2 + M._24 * c0",
+     "-M._11 * c4 + M._12 * c2 - M._14 * c0",
+     "M._41 * s4 - M._42 * s2 + M._44 * s0",
+     "-M._31 * s4 + M._32 * s2 - M._34 * s0"},
+    {"-M._21 * c3 + M._22 * c1 - M._23 * c0",
+     "M._11 * c3 - M._12 * c1 + M._13 * c0",
+     "-M._41 * s3 + M._42 * s1 - M._43 * s0",
+     "M._31 * s3 - M._32 * s1 + M._33 * s0"},
+};
+
+// Emits `const __m128 <name>_<lanes> = _mm_shuffle_ps(<name>, <name>, ...)`,
+// where `lanes` lists the source lane of each destination lane.
+void generate_swizzle(FILE *restrict stream, const char *name,
+                      const char *lanes) {
+    fprintf(stream,
+            INDENT "const __m128 %s_%s = _mm_shuffle_ps(%s, %s, "
+                   "_MM_SHUFFLE(%c, %c, %c, %c));\n",
+            name, lanes, name, name, lanes[3], lanes[2], lanes[1], lanes[0]);
+}
+
+// 2x2 matrix products on `(a11, a12, a21, a22)` vectors, used by the block-wise
+// 4x4 inverse: `A B`, `adj(A) B` and `A adj(B)`.
+void generate_mat2_simd_helpers(FILE *restrict stream) {
+    fprintf(stream, "#ifdef LINALG_SIMD\n");
+    fprintf(stream,
+            "LINALG_DEF __m128 linalg_mat2_mul_ps(__m128 A, __m128 B) {\n");
+    generate_swizzle(stream, "A", "1032");
+    generate_swizzle(stream, "B", "0303");
+    generate_swizzle(stream, "B", "2121");
+    fprintf(stream, INDENT "return _mm_add_ps(_mm_mul_ps(A, B_0303), "
+                           "_mm_mul_ps(A_1032, B_2121));\n");
+    fprintf(stream, "}\n");
+    EMPTY_LINE(stream);
+    fprintf(stream, "LINALG_DEF __m128 linalg_mat2_adj_mul_ps(__m128 A, "
+                    "__m128 B) {\n");
+    generate_swizzle(stream, "A", "3300");
+    generate_swizzle(stream, "A", "1122");
+    generate_swizzle(stream, "B", "2301");
+    fprintf(stream, INDENT "return _mm_sub_ps(_mm_mul_ps(A_3300, B), "
+                           "_mm_mul_ps(A_1122, B_2301));\n");
+    fprintf(stream, "}\n");
+    EMPTY_LINE(stream);
+    fprintf(stream, "LINALG_DEF __m128 linalg_mat2_mul_adj_ps(__m128 A, "
+                    "__m128 B) {\n");
+    generate_swizzle(stream, "A", "1032");
+    generate_swizzle(stream, "B", "3030");
+    generate_swizzle(stream, "B", "2121");
+    fprintf(stream, INDENT "return _mm_sub_ps(_mm_mul_ps(A, B_3030), "
+                           "_mm_mul_ps(A_1032, B_2121));\n");
+    fprintf(stream, "}\n");
+    fprintf(stream, "#endif // LINALG_SIMD\n");
+    EMPTY_LINE(stream);
+}
+
+// Block-wise inverse of M = |A B|, with 2x2 blocks held in one register each:
+//                           |C D|
+//   det(M) = |A||D| + |B||C| - tr(adj(A) B adj(D) C), and
+//   inverse = 1 / det(M) * |adj(X) adj(Y)| where X = |D| A - B adj(D) C, ...
+//                          |adj(Z) adj(W)|
+void generate_mat4f_inverse_simd(FILE *restrict stream) {
+    for (size_t i = 0; i < 4; ++i) {
+        fprintf(stream, INDENT "const __m128 m%zu = M.m[%zu];\n", i, i);
+    }
+    fprintf(stream, INDENT "const __m128 A = _mm_movelh_ps(m0, m1);\n");
+    fprintf(stream, INDENT "const __m128 B = _mm_movehl_ps(m1, m0);\n");
+    fprintf(stream, INDENT "const __m128 C = _mm_movelh_ps(m2, m3);\n");
+    fprintf(stream, INDENT "const __m128 D = _mm_movehl_ps(m3, m2);\n");
+    // (|A|, |B|, |C|, |D|) from the even and odd columns of each row pair.
+    fprintf(stream, INDENT "const __m128 even_02 = _mm_shuffle_ps(m0, m2, "
+                           "_MM_SHUFFLE(2, 0, 2, 0));\n");
+    fprintf(stream, INDENT "const __m128 odd_02 = _mm_shuffle_ps(m0, m2, "
+                           "_MM_SHUFFLE(3, 1, 3, 1));\n");
+    fprintf(stream, INDENT "const __m128 even_13 = _mm_shuffle_ps(m1, m3, "
+                           "_MM_SHUFFLE(2, 0, 2, 0));\n");
+    fprintf(stream, INDENT "const __m128 odd_13 = _mm_shuffle_ps(m1, m3, "
+                           "_MM_SHUFFLE(3, 1, 3, 1));\n");
+    fprintf(stream, INDENT "const __m128 dets = _mm_sub_ps(_mm_mul_ps(even_02, "
+                           "odd_13), _mm_mul_ps(odd_02, even_13));\n");
+    const char *blocks = "ABCD";
+    for (size_t k = 0; k < 4; ++k) {
+        fprintf(stream,
+                INDENT "const __m128 det_%c = _mm_shuffle_ps(dets, dets, "
+                       "_MM_SHUFFLE(%zu, %zu, %zu, %zu));\n",
+                blocks[k], k, k, k, k);
+    }
+    // AB = adj(A) B and DC = adj(D) C.
+    fprintf(stream, INDENT "const __m128 AB = linalg_mat2_adj_mul_ps(A, B);\n");
+    fprintf(stream, INDENT "const __m128 DC = linalg_mat2_adj_mul_ps(D, C);\n");
+    fprintf(stream, INDENT "__m128 X = _mm_sub_ps(_mm_mul_ps(det_D, A), "
+                           "linalg_mat2_mul_ps(B, DC));\n");
+    fprintf(stream, INDENT "__m128 Y = _mm_sub_ps(_mm_mul_ps(det_B, C), "
+                           "linalg_mat2_mul_adj_ps(D, AB));\n");
+    fprintf(stream, INDENT "__m128 Z = _mm_sub_ps(_mm_mul_ps(det_C, B), "
+                           "linalg_mat2_mul_adj_ps(A, DC));\n");
+    fprintf(stream, INDENT "__m128 W = _mm_sub_ps(_mm_mul_ps(det_A, D), "
+                           "linalg_mat2_mul_ps(C, AB));\n");
+    // tr(AB DC), with a horizontal sum that does not need SSE3.
+    generate_swizzle(stream, "DC", "0213");
+    fprintf(stream, INDENT "const __m128 tr = _mm_mul_ps(AB, DC_0213);\n");
+    generate_swizzle(stream, "tr", "2301");
+    fprintf(stream, INDENT "const __m128 tr2 = _mm_add_ps(tr, tr_2301);\n");
+    generate_swizzle(stream, "tr2", "1032");
+    fprintf(stream,
+            INDENT "const __m128 trace = _mm_add_ps(tr2, tr2_1032);\n");
+    fprintf(stream, INDENT "__m128 det = _mm_mul_ps(det_A, det_D);\n");
+    fprintf(stream,
+            INDENT "det = _mm_add_ps(det, _mm_mul_ps(det_B, det_C));\n");
+    fprintf(stream, INDENT "det = _mm_sub_ps(det, trace);\n");
+    // The signs of the 2x2 adjugates are folded in the reciprocal.
+    fprintf(stream, INDENT "const __m128 inv_det = _mm_div_ps(_mm_setr_ps(1, "
+                           "-1, -1, 1), det);\n");
+    const char *results = "XYZW";
+    for (size_t k = 0; k < 4; ++k) {
+        fprintf(stream, INDENT "%c = _mm_mul_ps(%c, inv_det);\n", results[k],
+                results[k]);
+    }
+    fprintf(stream, INDENT "mat4f_t result;\n");
+    fprintf(stream, INDENT "result.m[0] = _mm_shuffle_ps(X, Y, _MM_SHUFFLE(1, "
+                           "3, 1, 3));\n");
+    fprintf(stream, INDENT "result.m[1] = _mm_shuffle_ps(X, Y, _MM_SHUFFLE(0, "
+                           "2, 0, 2));\n");
+    fprintf(stream, INDENT "result.m[2] = _mm_shuffle_ps(Z, W, _MM_SHUFFLE(1, "
+                           "3, 1, 3));\n");
+    fprintf(stream, INDENT "result.m[3] = _mm_shuffle_ps(Z, W, _MM_SHUFFLE(0, "
+                           "2, 0, 2));\n");
+    fprintf(stream, INDENT "return result;\n");
+}
+
+void generate_mat_inverse(FILE *restrict stream, size_t dim, type_s type) {
+    if (dim > 4 || !is_floating_type(type)) {
+        return;
+    }
+    const char *mat_prefix = mat_prefix_name(dim, type);
+    const char *type_keyword = type_definitions[type].keyword;
+    bool simd = has_simd_variant(dim, type);
+    if (simd) {
+        generate_mat2_simd_helpers(stream);
+    }
+    fprintf(stream, "LINALG_DEF %s_t %s_inverse(%s_t M) {\n", mat_prefix,
+            mat_prefix, mat_prefix);
+    if (simd) {
+        fprintf(stream, "#ifdef LINALG_SIMD\n");
+        generate_mat4f_inverse_simd(stream);
+        fprintf(stream, "#else\n");
+    }
+    fprintf(stream, INDENT "%s_t result;\n", mat_prefix);
+    switch (dim) {
+    case 2:
+        fprintf(stream, INDENT "const %s inv_det = 1 / %s_det(M);\n",
+                type_keyword, mat_prefix);
+        fprintf(stream, INDENT "result._11 = M._22 * inv_det;\n");
+        fprintf(stream, INDENT "result._12 = -M._12 * inv_det;\n");
+        fprintf(stream, INDENT "result._21 = -M._21 * inv_det;\n");
+        fprintf(stream, INDENT "result._22 = M._11 * inv_det;\n");
+        break;
+    case 3:
+        // The cofactors of the first row give the determinant for free.
+        for (size_t j = 0; j < 3; ++j) {
+            fprintf(stream, INDENT "const %s c1%zu = %s;\n", type_keyword,
+                    j + 1, mat3_cofactor(0, j));
+        }
+        fprintf(stream,
+                INDENT "const %s inv_det = 1 / (M._11 * c11 + M._12 * c12 + "
+                       "M._13 * c13);\n",
+                type_keyword);
+        for (size_t i = 0; i < 3; ++i) {
+            for (size_t j = 0; j < 3; ++j) {
+                if (i == 0) {
+                    fprintf(stream, INDENT "result._%zu1 = c1%zu * inv_det;\n",
+                            j + 1, j + 1);
+                } else {
+                    fprintf(stream, INDENT "result._%zu%zu = %s * inv_det;\n",
+                            j + 1, i + 1, mat3_cofactor(i, j));
+                }
+            }
+        }
+        break;
+    case 4:
+        generate_mat4_minors(stream, type);
+        fprintf(stream, INDENT "%s det = s0 * c5 - s1 * c4 + s2 * c3;\n",
+                type_keyword);
+        fprintf(stream, INDENT "det += s3 * c2 - s4 * c1 + s5 * c0;\n");
+        fprintf(stream, INDENT "const %s inv_det = 1 / det;\n", type_keyword);
+        for (size_t i = 0; i < 4; ++i) {
+            for (size_t j = 0; j < 4; ++j) {
+                fprintf(stream, INDENT "result._%zu%zu = (%s) * inv_det;\n",
+                        i + 1, j + 1, mat4_adjugate[i][j]);
+            }
+        }
+        break;
+    }
+    fprintf(stream, INDENT "return result;\n");
+    if (simd) {
+        fprintf(stream, "#endif // LINALG_SIMD\n");
+    }
+    fprintf(stream, "}\n");
+    EMPTY_LINE(stream);
+}
+
+// Inverse of a rigid transform (rotation and translation, bottom row
+// `0 0 0 1`): the rotation is transposed and the translation `t` becomes
+// `-R^T t`, which avoids the general inverse altogether.
+void generate_mat_inverse_affine(FILE *restrict stream, size_t dim,
+                                 type_s type) {
+    if (dim != 4 || !is_floating_type(type)) {
+        return;
+    }
+    const char *mat_prefix = mat_prefix_name(dim, type);
+    fprintf(stream, "LINALG_DEF %s_t %s_inverse_affine(%s_t M) {\n",
+            mat_prefix, mat_prefix, mat_prefix);
+    bool simd = has_simd_variant(dim, type);
+    if (simd) {
+        // Transposing the rows of R with `(-R^T t, 1)` as the fourth row moves
+        // the new translation in the last column.
+        fprintf(stream, "#ifdef LINALG_SIMD\n");
+        fprintf(stream,
+                INDENT "const __m128 mask = "
+                       "_mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));\n");
+        for (size_t i = 0; i < 3; ++i) {
+            fprintf(stream,
+                    INDENT "__m128 r%zu = _mm_and_ps(M.m[%zu], mask);\n", i, i);
+        }
+        fprintf(stream, INDENT "__m128 t = _mm_setr_ps(0, 0, 0, 1);\n");
+        for (size_t i = 0; i < 3; ++i) {
+            fprintf(stream,
+                    INDENT "t = _mm_sub_ps(t, _mm_mul_ps(r%zu, "
+                           "_mm_shuffle_ps(M.m[%zu], M.m[%zu], _MM_SHUFFLE(3, "
+                           "3, 3, 3))));\n",
+                    i, i, i);
+        }
+        fprintf(stream, INDENT "_MM_TRANSPOSE4_PS(r0, r1, r2, t);\n");
+        fprintf(stream,
+                INDENT "return (%s_t){.m = {r0, r1, r2, t}};\n", mat_prefix);
+        fprintf(stream, "#else\n");
+    }
+    fprintf(stream, INDENT "%s_t result;\n", mat_prefix);
+    for (size_t i = 0; i < 3; ++i) {
+        for (size_t j = 0; j < 3; ++j) {
+            fprintf(stream, INDENT "result._%zu%zu = M._%zu%zu;\n", i + 1,
+                    j + 1, j + 1, i + 1);
+        }
+        fprintf(stream,
+                INDENT "result._%zu4 = -(M._1%zu * M._14 + M._2%zu * M._24 + "
+                       "M._3%zu * M._34);\n",
+                i + 1, i + 1, i + 1, i + 1);
+    }
+    fprintf(stream, INDENT "result._41 = result._42 = result._43 = 0;\n");
+    fprintf(stream, INDENT "result._44 = 1;\n");
+    fprintf(stream, INDENT "return result;\n");
+    if (simd) {
+        fprintf(stream, "#endif // LINALG_SIMD\n");
+    }
+    fprintf(stream, "}\n");
+    EMPTY_LINE(stream);
+}
+
+// Batch variants: `in` and `out` must not overlap.
+void generate_mat_inverse_array(FILE *restrict stream, size_t dim, type_s type,
+                                const char *fn_name) {
+    if (dim > 4 || !is_floating_type(type)) {
+        return;
+    }
+    if (strcmp(fn_name, "inverse_affine") == 0 && dim != 4) {
+        return;
+    }
+    const char *mat_prefix = mat_prefix_name(dim, type);
+    fprintf(stream,
+            "LINALG_DEF void %s_%s_array(const %s_t *restrict in, %s_t "
+            "*restrict out, size_t n) {\n",
+            mat_prefix, fn_name, mat_prefix, mat_prefix);
+    fprintf(stream, INDENT "for (size_t i = 0; i < n; ++i) {\n");
+    fprintf(stream, INDENT INDENT "out[i] = %s_%s(in[i]);\n", mat_prefix,
+            fn_name);
+    fprintf(stream, INDENT "}\n");
+    fprintf(stream, "}\n");
+    EMPTY_LINE(stream);
+}
+
+/* Quaternions (`quatf_t`, `quatd_t`): rotations as `x i + y j + z k + w`, with
+ * the same layout as `vec4<t>_t` (so `q.v` can be used with the vector
+ * functions). Composing two rotations costs 16 multiply-adds, and rotating a
+ * vector does not need any trigonometric function.
+ *
+ * NOTE: like the rotation matrices, `quat<t>_mul(a, b)` applies `b` first,
+ * then `a`, and the conversions follow the `matN<t>_R` convention (column
+ * vectors, counterclockwise rotations).
+ */
+
+const char *quat_prefix_name(type_s type) {
+    return varia_temp_sprintf("quat%s", type_definitions[type].suffix);
+}
+
+bool has_quat_variant(type_s type) {
+    return type == FLOAT_T || type == DOUBLE_T;
+}
+
+void generate_quat_definition(FILE *restrict stream, type_s type) {
+    if (!has_quat_variant(type)) {
+        return;
+    }
+    const char *type_keyword = type_definitions[type].keyword;
+    fprintf(stream, "typedef union {\n");
+    fprintf(stream, INDENT "struct { %s x, y, z, w; };\n", type_keyword);
+    fprintf(stream, INDENT "%s e[4];\n", type_keyword);
+    fprintf(stream, INDENT "%s v;\n", vec_type_name(4, type));
+    fprintf(stream, "} %s_t;\n", quat_prefix_name(type));
+    EMPTY_LINE(stream);
+}
+
+void generate_quat_constructors(FILE *restrict stream, type_s type) {
+    if (!has_quat_variant(type)) {
+        return;
+    }
+    const char *quat_prefix = quat_prefix_name(type);
+    const char *type_keyword = type_definitions[type].keyword;
+    const char *type_suffix = type == FLOAT_T ? "f" : "";
+    fprintf(stream, "LINALG_DEF %s_t %s(%s x, %s y, %s z, %s w) {\n",
+            quat_prefix, quat_prefix, type_keyword, type_keyword, type_keyword,
+            type_keyword);
+    fprintf(stream, INDENT "return (%s_t){.x = x, .y = y, .z = z, .w = w};\n",
+            quat_prefix);
+    fprintf(stream, "}\n");
+    EMPTY_LINE(stream);
+    fprintf(stream, "LINALG_DEF %s_t %s_identity(void) {\n", quat_prefix,
+            quat_prefix);
+    fprintf(stream, INDENT "return %s(0, 0, 0, 1);\n", quat_prefix);
+    fprintf(stream, "}\n");
+    EMPTY_LINE(stream);
+    // NOTE: `axis` must be a unit vector.
+    fprintf(stream,
+            "LINALG_DEF %s_t %s_from_axis_angle(%s axis, %s angle) {\n",
+            quat_prefix, quat_prefix, vec_type_name(3, type), type_keyword);
+    fprintf(stream, INDENT "%s s = sin%s(0.5%s * angle);\n", type_keyword,
+            type_suffix, type_suffix);
+    fprintf(stream,
+            INDENT "return %s(axis.x * s, axis.y * s, axis.z * s, "
+                   "cos%s(0.5%s * angle));\n",
+            quat_prefix, type_suffix, type_suffix);
+    fprintf(stream, "}\n");
+    EMPTY_LINE(stream);
+}
+
+void generate_quat_mul(FILE *restrict stream, type_s type) {
+    if (!has_quat_variant(type)) {
+        return;
+    }
+    const char *quat_prefix = quat_prefix_name(type);
+    fprintf(stream, "LINALG_DEF %s_t %s_mul(%s_t a, %s_t b) {\n", quat_prefix,
+            quat_prefix, quat_prefix, quat_prefix);
+    if (has_simd_variant(4, type)) {
+        // Each component of `a` scales a permutation of `b` with signs:
+        //   ax * ( bw, -bz,  by, -bx) + ay * ( bz,  bw, -bx, -by)
+        // + az * (-by,  bx,  bw, -bz) + aw * ( bx,  by,  bz,  bw).
+        fprintf(stream, "#ifdef LINALG_SIMD\n");
+        fprintf(stream, INDENT "const __m128 a_m = a.v.m, b_m = b.v.m;\n");
+        fprintf(stream, INDENT "const __m128 a_w = _mm_shuffle_ps(a_m, a_m, "
+                               "_MM_SHUFFLE(3, 3, 3, 3));\n");
+        fprintf(stream, INDENT "__m128 result = _mm_mul_ps(a_w, b_m);\n");
+        static const struct {
+            char component;
+            size_t index;
+            const char *permutation;
+            const char *shuffle;
+            const char *signs;
+        } terms[3] = {
+            {'x', 0, "wzyx", "0, 1, 2, 3", "0.0f, -0.0f, 0.0f, -0.0f"},
+            {'y', 1, "zwxy", "1, 0, 3, 2", "0.0f, 0.0f, -0.0f, -0.0f"},
+            {'z', 2, "yxwz", "2, 3, 0, 1", "-0.0f, 0.0f, 0.0f, -0.0f"},
+        };
+        for (size_t t = 0; t < ARRAY_LEN(terms); ++t) {
+            size_t index = terms[t].index;
+            fprintf(stream,
+                    INDENT "const __m128 a_%c = _mm_shuffle_ps(a_m, a_m, "
+                           "_MM_SHUFFLE(%zu, %zu, %zu, %zu));\n",
+                    terms[t].component, index, index, index, index);
+            fprintf(stream,
+                    INDENT "__m128 b_%s = _mm_shuffle_ps(b_m, b_m, "
+                           "_MM_SHUFFLE(%s));\n",
+                    terms[t].permutation, terms[t].shuffle);
+            fprintf(stream,
+                    INDENT "b_%s = _mm_xor_ps(b_%s, _mm_setr_ps(%s));\n",
+                    terms[t].permutation, terms[t].permutation,
+                    terms[t].signs);
+            fprintf(stream,
+                    INDENT "result = linalg_madd_ps(a_%c, b_%s, result);\n",
+                    terms[t].component, terms[t].permutation);
+        }
+        fprintf(stream, INDENT "return (%s_t){.v.m = result};\n", quat_prefix);
+        fprintf(stream, "#else\n");
+    }
+    fprintf(stream,
+            INDENT "return %s(a.w * b.x + a.x * b.w + a.y * b.z - a.z * b.y, "
+                   "a.w * b.y - a.x * b.z + a.y * b.w + a.z * b.x, "
+                   "a.w * b.z + a.x * b.y - a.y * b.x + a.z * b.w, "
+                   "a.w * b.w - a.x * b.x - a.y * b.y - a.z * b.z);\n",
+            quat_prefix);
+    if (has_simd_variant(4, type)) {
+        fprintf(stream, "#endif // LINALG_SIMD\n");
+    }
+    fprintf(stream, "}\n");
+    EMPTY_LINE(stream);
+}
+
+void generate_quat_conjugate(FILE *restrict stream, type_s type) {
+    if (!has_quat_variant(type)) {
+        return;
+    }
+    const char *quat_prefix = quat_prefix_name(type);
+    const char *type_keyword = type_definitions[type].keyword;
+    fprintf(stream, "LINALG_DEF %s_t %s_conjugate(%s_t q) {\n", quat_prefix,
+            quat_prefix, quat_prefix);
+    fprintf(stream, INDENT "return %s(-q.x, -q.y, -q.z, q.w);\n", quat_prefix);
+    fprintf(stream, "}\n");
+    EMPTY_LINE(stream);
+    // NOTE: the inverse of a unit quaternion is its (cheaper) conjugate.
+    fprintf(stream, "LINALG_DEF %s_t %s_inverse(%s_t q) {\n", quat_prefix,
+            quat_prefix, quat_prefix);
+    fprintf(stream, INDENT "%s inv_sqrlen = 1 / %s_sqrlen(q.v);\n",
+            type_keyword, vec_prefix_name(4, type));
+    fprintf(stream,
+            INDENT "return %s(-q.x * inv_sqrlen, -q.y * inv_sqrlen, "
+                   "-q.z * inv_sqrlen, q.w * inv_sqrlen);\n",
+            quat_prefix);
+    fprintf(stream, "}\n");
+    EMPTY_LINE(stream);
+}
+
+void generate_quat_normalize(FILE *restrict stream, type_s type) {
+    if (!has_quat_variant(type)) {
+        return;
+    }
+    const char *quat_prefix = quat_prefix_name(type);
+    const char *vec_prefix = vec_prefix_name(4, type);
+    fprintf(stream, "LINALG_DEF %s_t %s_normalize(%s_t q) {\n", quat_prefix,
+            quat_prefix, quat_prefix);
+    fprintf(stream, INDENT "return (%s_t){.v = %s_unit(q.v)};\n", quat_prefix,
+            vec_prefix);
+    fprintf(stream, "}\n");
+    EMPTY_LINE(stream);
+}
+
+void generate_quat_interpolation(FILE *restrict stream, type_s type) {
+    if (!has_quat_variant(type)) {
+        return;
+    }
+    const char *quat_prefix = quat_prefix_name(type);
+    const char *vec_prefix = vec_prefix_name(4, type);
+    const char *type_keyword = type_definitions[type].keyword;
+    const char *type_suffix = type == FLOAT_T ? "f" : "";
+    // Both interpolations take the shortest path: `b` and `-b` are the same
+    // rotation, so `b` is flipped when it is in the other hemisphere.
+    fprintf(stream,
+            "LINALG_DEF %s_t %s_nlerp(%s_t a, %s_t b, %s t) {\n",
+            quat_prefix, quat_prefix, quat_prefix, quat_prefix, type_keyword);
+    fprintf(stream, INDENT "%s wb = %s_dot(a.v, b.v) < 0 ? -t : t;\n",
+            type_keyword, vec_prefix);
+    fprintf(stream, INDENT "%s_t q;\n", quat_prefix);
+    fprintf(stream, INDENT "for (size_t i = 0; i < 4; ++i) {\n");
+    fprintf(stream, INDENT INDENT "q.e[i] = (1 - t) * a.e[i] + wb * b.e[i];\n");
+    fprintf(stream, INDENT "}\n");
+    fprintf(stream, INDENT "return %s_normalize(q);\n", quat_prefix);
+    fprintf(stream, "}\n");
+    EMPTY_LINE(stream);
+    fprintf(stream,
+            "LINALG_DEF %s_t %s_slerp(%s_t a, %s_t b, %s t) {\n",
+            quat_prefix, quat_prefix, quat_prefix, quat_prefix, type_keyword);
+    fprintf(stream, INDENT "%s cos_theta = %s_dot(a.v, b.v);\n", type_keyword,
+            vec_prefix);
+    fprintf(stream, INDENT "%s sign = 1;\n", type_keyword);
+    fprintf(stream, INDENT "if (cos_theta < 0) {\n");
+    fprintf(stream, INDENT INDENT "cos_theta = -cos_theta;\n");
+    fprintf(stream, INDENT INDENT "sign = -1;\n");
+    fprintf(stream, INDENT "}\n");
+    // Nearly parallel: sin(theta) vanishes, and nlerp is accurate enough.
+    fprintf(stream, INDENT "if (cos_theta > 0.9995%s) {\n", type_suffix);
+    fprintf(stream, INDENT INDENT "return %s_nlerp(a, b, t);\n", quat_prefix);
+    fprintf(stream, INDENT "}\n");
+    fprintf(stream, INDENT "%s theta = acos%s(cos_theta);\n", type_keyword,
+            type_suffix);
+    fprintf(stream, INDENT "%s inv_sin_theta = 1 / sin%s(theta);\n",
+            type_keyword, type_suffix);
+    fprintf(stream,
+            INDENT "%s wa = sin%s((1 - t) * theta) * inv_sin_theta;\n",
+            type_keyword, type_suffix);
+    fprintf(stream,
+            INDENT "%s wb = sign * sin%s(t * theta) * inv_sin_theta;\n",
+            type_keyword, type_suffix);
+    fprintf(stream, INDENT "%s_t q;\n", quat_prefix);
+    fprintf(stream, INDENT "for (size_t i = 0; i < 4; ++i) {\n");
+    fprintf(stream, INDENT INDENT "q.e[i] = wa * a.e[i] + wb * b.e[i];\n");
+    fprintf(stream, INDENT "}\n");
+    fprintf(stream, INDENT "return q;\n");
+    fprintf(stream, "}\n");
+    EMPTY_LINE(stream);
+}
+
+void generate_quat_rotate_vec(FILE *restrict stream, type_s type) {
+    if (!has_quat_variant(type)) {
+        return;
+    }
+    const char *quat_prefix = quat_prefix_name(type);
+    const char *vec_type = vec_type_name(3, type);
+    const char *type_keyword = type_definitions[type].keyword;
+    // NOTE: `q` must be a unit quaternion. With u = (q.x, q.y, q.z):
+    // v' = v + w t + u x t, where t = 2 (u x v).
+    fprintf(stream, "LINALG_DEF %s %s_rotate_vec(%s_t q, %s v) {\n", vec_type,
+            quat_prefix, quat_prefix, vec_type);
+    fprintf(stream, INDENT "%s tx = 2 * (q.y * v.z - q.z * v.y);\n",
+            type_keyword);
+    fprintf(stream, INDENT "%s ty = 2 * (q.z * v.x - q.x * v.z);\n",
+            type_keyword);
+    fprintf(stream, INDENT "%s tz = 2 * (q.x * v.y - q.y * v.x);\n",
+            type_keyword);
+    fprintf(stream, INDENT "%s result;\n", vec_type);
+    fprintf(stream,
+            INDENT "result.x = v.x + q.w * tx + (q.y * tz - q.z * ty);\n");
+    fprintf(stream,
+            INDENT "result.y = v.y + q.w * ty + (q.z * tx - q.x * tz);\n");
+    fprintf(stream,
+            INDENT "result.z = v.z + q.w * tz + (q.x * ty - q.y * tx);\n");
+    fprintf(stream, INDENT "return result;\n");
+    fprintf(stream, "}\n");
+    EMPTY_LINE(stream);
+}
+
+void generate_quat_mat_conversions(FILE *restrict stream, type_s type) {
+    if (!has_quat_variant(type)) {
+        return;
+    }
+    const char *quat_prefix = quat_prefix_name(type);
+    const char *type_keyword = type_definitions[type].keyword;
+    const char *type_suffix = type == FLOAT_T ? "f" : "";
+    for (size_t dim = 3; dim <= 4; ++dim) {
+        const char *mat_prefix = mat_prefix_name(dim, type);
+        // NOTE: `q` must be a unit quaternion.
+        fprintf(stream, "LINALG_DEF %s_t %s_to_%s(%s_t q) {\n", mat_prefix,
+                quat_prefix, varia_temp_sprintf("mat%zu", dim), quat_prefix);
+        fprintf(stream, INDENT "%s x2 = q.x + q.x, y2 = q.y + q.y, "
+                               "z2 = q.z + q.z;\n",
+                type_keyword);
+        fprintf(stream,
+                INDENT "%s xx = q.x * x2, yy = q.y * y2, zz = q.z * z2;\n",
+                type_keyword);
+        fprintf(stream,
+                INDENT "%s xy = q.x * y2, xz = q.x * z2, yz = q.y * z2;\n",
+                type_keyword);
+        fprintf(stream,
+                INDENT "%s wx = q.w * x2, wy = q.w * y2, wz = q.w * z2;\n",
+                type_keyword);
+        fprintf(stream, INDENT "%s_t R = {0};\n", mat_prefix);
+        fprintf(stream, INDENT "R._11 = 1 - (yy + zz);\n");
+        fprintf(stream, INDENT "R._12 = xy - wz;\n");
+        fprintf(stream, INDENT "R._13 = xz + wy;\n");
+        fprintf(stream, INDENT "R._21 = xy + wz;\n");
+        fprintf(stream, INDENT "R._22 = 1 - (xx + zz);\n");
+        fprintf(stream, INDENT "R._23 = yz - wx;\n");
+        fprintf(stream, INDENT "R._31 = xz - wy;\n");
+        fprintf(stream, INDENT "R._32 = yz + wx;\n");
+        fprintf(stream, INDENT "R._33 = 1 - (xx + yy);\n");
+        if (dim == 4) {
+            fprintf(stream, INDENT "R._44 = 1;\n");
+        }
+        fprintf(stream, INDENT "return R;\n");
+        fprintf(stream, "}\n");
+        EMPTY_LINE(stream);
+    }
+
+    // Shepperd's method: divide by the largest of the four candidate
+    // denominators to stay accurate for every rotation. Only the upper 3x3
+    // block of a `mat4` is used.
+    for (size_t dim = 3; dim <= 4; ++dim) {
+        const char *mat_prefix = mat_prefix_name(dim, type);
+        fprintf(stream, "LINALG_DEF %s_t %s_from_%s(%s_t R) {\n", quat_prefix,
+                quat_prefix, varia_temp_sprintf("mat%zu", dim), mat_prefix);
+        fprintf(stream, INDENT "%s trace = R._11 + R._22 + R._33;\n",
+                type_keyword);
+        fprintf(stream, INDENT "if (trace > 0) {\n");
+        fprintf(stream, INDENT INDENT "%s s = 2 * sqrt%s(trace + 1);\n",
+                type_keyword, type_suffix);
+        fprintf(stream,
+                INDENT INDENT "return %s((R._32 - R._23) / s, (R._13 - R._31) "
+                              "/ s, (R._21 - R._12) / s, 0.25%s * s);\n",
+                quat_prefix, type_suffix);
+        fprintf(stream, INDENT "}\n");
+        fprintf(stream, INDENT "if (R._11 > R._22 && R._11 > R._33) {\n");
+        fprintf(stream,
+                INDENT INDENT "%s s = 2 * sqrt%s(1 + R._11 - R._22 - R._33);\n",
+                type_keyword, type_suffix);
+        fprintf(stream,
+                INDENT INDENT "return %s(0.25%s * s, (R._12 + R._21) / s, "
+                              "(R._13 + R._31) / s, (R._32 - R._23) / s);\n",
+                quat_prefix, type_suffix);
+        fprintf(stream, INDENT "}\n");
+        fprintf(stream, INDENT "if (R._22 > R._33) {\n");
+        fprintf(stream,
+                INDENT INDENT "%s s = 2 * sqrt%s(1 + R._22 - R._11 - R._33);\n",
+                type_keyword, type_suffix);
+        fprintf(stream,
+                INDENT INDENT "return %s((R._12 + R._21) / s, 0.25%s * s, "
+                              "(R._23 + R._32) / s, (R._13 - R._31) / s);\n",
+                quat_prefix, type_suffix);
+        fprintf(stream, INDENT "}\n");
+        fprintf(stream,
+                INDENT "%s s = 2 * sqrt%s(1 + R._33 - R._11 - R._22);\n",
+                type_keyword, type_suffix);
+        fprintf(stream,
+                INDENT "return %s((R._13 + R._31) / s, (R._23 + R._32) / s, "
+                       "0.25%s * s, (R._21 - R._12) / s);\n",
+                quat_prefix, type_suffix);
+        fprintf(stream, "}\n");
+        EMPTY_LINE(stream);
+    }
+}
+
+const char *vec_soa_prefix_name(size_t dim, type_s type) {
+    return varia_temp_sprintf("vec%zu%s_soa", dim,
+                              type_definitions[type].suffix);
+}
+
+void generate_vec_soa_definition(FILE *restrict stream, size_t dim,
+                                 type_s type) {
+    const char *type_keyword = type_definitions[type].keyword;
+    fprintf(stream, "typedef struct {\n");
+    if (dim <= 4) {
+        fprintf(stream, INDENT "%s ", type_keyword);
+        for (size_t component = 0; component < dim; ++component) {
+            if (component > 0) {
+                fprintf(stream, ", ");
+            }
+            fprintf(stream, "*%c", vec_math_components[component]);
+        }
+        fprintf(stream, ";\n");
+    } else {
+        fprintf(stream, INDENT "%s *e[%zu];\n", type_keyword, dim);
+    }
+    fprintf(stream, INDENT "size_t n;\n");
+    fprintf(stream, "} %s_t;\n", vec_soa_prefix_name(dim, type));
+    EMPTY_LINE(stream);
+}
+
+// NOTE: the batch kernels below are written as one simple loop per component
+// stream so that the compiler can auto-vectorize them. Outputs may alias
+// inputs element-for-element (in-place updates), but must not partially
+// overlap them.
+void generate_vec_soa_operation(FILE *restrict stream, size_t dim, type_s type,
+                                op_s op) {
+    const char *soa_prefix = vec_soa_prefix_name(dim, type);
+    fprintf(stream, "LINALG_DEF void %s_%s(%s_t out, %s_t a, %s_t b) {\n",
+            soa_prefix, op_definitions[op].name, soa_prefix, soa_prefix,
+            soa_prefix);
+    fprintf(stream, INDENT "assert(a.n == out.n && b.n == out.n);\n");
+    for (size_t component = 0; component < dim; ++component) {
+        const char *c = vec_component_name(dim, component);
+        fprintf(stream, INDENT "for (size_t i = 0; i < out.n; ++i) {\n");
+        // Modulo operator does not support floating-point types.
+        if (op == OP_MOD && (type == FLOAT_T || type == DOUBLE_T)) {
+            fprintf(stream, INDENT INDENT "out.%s[i] = %s(a.%s[i], b.%s[i]);\n",
+                    c, type == FLOAT_T ? "fmodf" : "fmod", c, c);
+        } else {
+            fprintf(stream, INDENT INDENT "out.%s[i] = a.%s[i] %c b.%s[i];\n",
+                    c, c, op_definitions[op].keyword[0], c);
+        }
+        fprintf(stream, INDENT "}\n");
+    }
+    fprintf(stream, "}\n");
+    EMPTY_LINE(stream);
+}
+
+void generate_vec_soa_function(FILE *restrict stream, size_t dim, type_s type,
+                               size_t fn_index) {
+    fn_definition_s fn = fn_definitions[fn_index];
+    if (fn.generic_selection[type] == NULL) {
+        return;
+    }
+    assert(fn.arity > 0);
+    const char *soa_prefix = vec_soa_prefix_name(dim, type);
+    fprintf(stream, "LINALG_DEF void %s_%s(%s_t out", soa_prefix, fn.name,
+            soa_prefix);
+    for (size_t param = 0; param < fn.arity; ++param) {
+        fprintf(stream, ", %s_t %s", soa_prefix, fn.params[param]);
+    }
+    fprintf(stream, ") {\n");
+    fprintf(stream, INDENT "assert(");
+    for (size_t param = 0; param < fn.arity; ++param) {
+        if (param > 0) {
+            fprintf(stream, " && ");
+        }
+        fprintf(stream, "%s.n == out.n", fn.params[param]);
+    }
+    fprintf(stream, ");\n");
+    for (size_t component = 0; component < dim; ++component) {
+        const char *c = vec_component_name(dim, component);
+        fprintf(stream, INDENT "for (size_t i = 0; i < out.n; ++i) {\n");
+        fprintf(stream, INDENT INDENT "out.%s[i] = %s(", c,
+                fn.generic_selection[type]);
+        for (size_t param = 0; param < fn.arity; ++param) {
+            if (param > 0) {
+                fprintf(stream, ", ");
+            }
+            fprintf(stream, "%s.%s[i]", fn.params[param], c);
+        }
+        fprintf(stream, ");\n");
+        fprintf(stream, INDENT "}\n");
+    }
+    fprintf(stream, "}\n");
+    EMPTY_LINE(stream);
+}
+
+void generate_vec_soa_dot(FILE *restrict stream, size_t dim, type_s type) {
+    const char *soa_prefix = vec_soa_prefix_name(dim, type);
+    fprintf(stream, "LINALG_DEF void %s_dot(%s *out, %s_t a, %s_t b) {\n",
+            soa_prefix, type_definitions[type].keyword, soa_prefix, soa_prefix);
+    fprintf(stream, INDENT "assert(a.n == b.n);\n");
+    fprintf(stream, INDENT "for (size_t i = 0; i < a.n; ++i) {\n");
+    fprintf(stream, INDENT INDENT "out[i] = ");
+    for (size_t component = 0; component < dim; ++component) {
+        const char *c = vec_component_name(dim, component);
+        if (component > 0) {
+            fprintf(stream, " + ");
+        }
+        fprintf(stream, "a.%s[i] * b.%s[i]", c, c);
+    }
+    fprintf(stream, ";\n");
+    fprintf(stream, INDENT "}\n");
+    fprintf(stream, "}\n");
+    EMPTY_LINE(stream);
+}
+
+void generate_vec_soa_2norm(FILE *restrict stream, size_t dim, type_s type) {
+    if (!(type == FLOAT_T || type == DOUBLE_T)) {
+        return; // sqrt function does not support integer values.
+    }
+    const char *soa_prefix = vec_soa_prefix_name(dim, type);
+    fprintf(stream, "LINALG_DEF void %s_2norm(%s *out, %s_t v) {\n", soa_prefix,
+            type_definitions[type].keyword, soa_prefix);
+    fprintf(stream, INDENT "for (size_t i = 0; i < v.n; ++i) {\n");
+    fprintf(stream, INDENT INDENT "out[i] = sqrt%s(",
+            type == FLOAT_T ? "f" : "");
+    for (size_t component = 0; component < dim; ++component) {
+        const char *c = vec_component_name(dim, component);
+        if (component > 0) {
+            fprintf(stream, " + ");
+        }
+        fprintf(stream, "v.%s[i] * v.%s[i]", c, c);
+    }
+    fprintf(stream, ");\n");
+    fprintf(stream, INDENT "}\n");
+    fprintf(stream, "}\n");
+    EMPTY_LINE(stream);
+}
+
+void generate_vec_soa_unit(FILE *restrict stream, size_t dim, type_s type) {
+    if (!(type == FLOAT_T || type == DOUBLE_T)) {
+        return; // sqrt function does not support integer values.
+    }
+    const char *soa_prefix = vec_soa_prefix_name(dim, type);
+    const char *type_keyword = type_definitions[type].keyword;
+    fprintf(stream, "LINALG_DEF void %s_unit(%s_t out, %s_t v) {\n",
+            soa_prefix, soa_prefix, soa_prefix);
+    fprintf(stream, INDENT "assert(v.n == out.n);\n");
+    fprintf(stream, INDENT "for (size_t i = 0; i < v.n; ++i) {\n");
+    fprintf(stream, INDENT INDENT "%s len = sqrt%s(", type_keyword,
+            type == FLOAT_T ? "f" : "");
+    for (size_t component = 0; component < dim; ++component) {
+        const char *c = vec_component_name(dim, component);
+        if (component > 0) {
+            fprintf(stream, " + ");
+        }
+        fprintf(stream, "v.%s[i] * v.%s[i]", c, c);
+    }
+    fprintf(stream, ");\n");
+    for (size_t component = 0; component < dim; ++component) {
+        const char *c = vec_component_name(dim, component);
+        fprintf(stream, INDENT INDENT "out.%s[i] = v.%s[i] / len;\n", c, c);
+    }
+    fprintf(stream, INDENT "}\n");
+    fprintf(stream, "}\n");
+    EMPTY_LINE(stream);
+}
+
+void generate_mat_mul_by_vec_soa(FILE *restrict stream, size_t dim,
+                                 type_s type) {
+    const char *mat_prefix = mat_prefix_name(dim, type);
+    const char *soa_prefix = vec_soa_prefix_name(dim, type);
+    const char *type_keyword = type_definitions[type].keyword;
+    fprintf(stream,
+            "LINALG_DEF void %s_mul_vec_soa(%s_t out, %s_t M, %s_t v) {\n",
+            mat_prefix, soa_prefix, mat_prefix, soa_prefix);
+    fprintf(stream, INDENT "assert(v.n == out.n);\n");
+    // Hoist the matrix out of the loop so it lives in registers.
+    for (size_t i = 0; i < dim; ++i) {
+        for (size_t j = 0; j < dim; ++j) {
+            fprintf(stream, INDENT "const %s m%zu%zu = M._%zu%zu;\n",
+                    type_keyword, i + 1, j + 1, i + 1, j + 1);
+        }
+    }
+    fprintf(stream, INDENT "for (size_t i = 0; i < v.n; ++i) {\n");
+    for (size_t component = 0; component < dim; ++component) {
+        const char *c = vec_component_name(dim, component);
+        fprintf(stream, INDENT INDENT "const %s %s = v.%s[i];\n", type_keyword,
+                dim <= 4 ? c : varia_temp_sprintf("e%zu", component), c);
+    }
+    for (size_t i = 0; i < dim; ++i) {
+        fprintf(stream, INDENT INDENT "out.%s[i] = ",
+                vec_component_name(dim, i));
+        for (size_t j = 0; j < dim; ++j) {
+            if (j > 0) {
+                fprintf(stream, " + ");
+            }
+            fprintf(stream, "m%zu%zu * %s", i + 1, j + 1,
+                    dim <= 4 ? vec_component_name(dim, j)
+                             : varia_temp_sprintf("e%zu", j));
+        }
+        fprintf(stream, ";\n");
+    }
+    fprintf(stream, INDENT "}\n");
+    fprintf(stream, "}\n");
+    EMPTY_LINE(stream);
+}
+
+void generate_vec_soa_conversions(FILE *restrict stream, size_t dim,
+                                  type_s type) {
+    const char *vec_type = vec_type_name(dim, type);
+    const char *soa_prefix = vec_soa_prefix_name(dim, type);
+    fprintf(stream,
+            "LINALG_DEF void %s_from_aos(%s_t out, const %s *restrict in) {\n",
+            soa_prefix, soa_prefix, vec_type);
+    for (size_t component = 0; component < dim; ++component) {
+        const char *c = vec_component_name(dim, component);
+        fprintf(stream, INDENT "for (size_t i = 0; i < out.n; ++i) {\n");
+        fprintf(stream, INDENT INDENT "out.%s[i] = in[i].e[%zu];\n", c,
+                component);
+        fprintf(stream, INDENT "}\n");
+    }
+    fprintf(stream, "}\n");
+    EMPTY_LINE(stream);
+    fprintf(stream, "LINALG_DEF void %s_to_aos(%s *restrict out, %s_t in) {\n",
+            soa_prefix, vec_type, soa_prefix);
+    for (size_t component = 0; component < dim; ++component) {
+        const char *c = vec_component_name(dim, component);
+        fprintf(stream, INDENT "for (size_t i = 0; i < in.n; ++i) {\n");
+        fprintf(stream, INDENT INDENT "out[i].e[%zu] = in.%s[i];\n", component,
+                c);
+        fprintf(stream, INDENT "}\n");
+    }
+    fprintf(stream, "}\n");
+    EMPTY_LINE(stream);
+}
+
+/* Non-square matrices (`matRxC<t>_t`: R rows, C columns), for every pair of
+ * distinct enabled dimensions. They follow the square matrices' conventions
+ * (row-major, `M.v[i]` is row i, column vectors), and multiply with any
+ * matrix or vector of matching shape: `matRxK<t>_mul_matKxC<t>(A, B)`,
+ * where square operands keep their `matN<t>` name.
+ *
+ * The R x (R + 1) shapes (`mat2x3<t>`, `mat3x4<t>`) are also affine
+ * transforms with an implicit last row (0, ..., 0, 1): `mat3x4f_t` stores a
+ * 3D transform in 48 bytes instead of 64, and `transform_affine` applies it
+ * to a `vec3f_t` with 9 multiplications and 9 additions instead of 16 and 12.
+ */
+
+const char *mat_shape_prefix(size_t rows, size_t cols, type_s type) {
+    if (rows == cols) {
+        return mat_prefix_name(rows, type);
+    }
+    return varia_temp_sprintf("mat%zux%zu%s", rows, cols,
+                              type_definitions[type].suffix);
+}
+
+// Name of the product of `matRxK<t>_t` by `matKxC<t>_t`.
+const char *mat_product_name(size_t rows, size_t inner, size_t cols,
+                             type_s type) {
+    const char *a = mat_shape_prefix(rows, inner, type);
+    if (rows == inner && inner == cols) {
+        return varia_temp_sprintf("%s_mul", a);
+    }
+    return varia_temp_sprintf("%s_mul_%s", a,
+                              mat_shape_prefix(inner, cols, type));
+}
+
+void generate_mat_rect_definition(FILE *restrict stream, size_t rows,
+                                  size_t cols, type_s type) {
+    const char *type_keyword = type_definitions[type].keyword;
+    fprintf(stream, "typedef union {\n");
+    fprintf(stream, INDENT "struct {\n");
+    for (size_t i = 0; i < rows; ++i) {
+        fprintf(stream, INDENT INDENT "%s ", type_keyword);
+        for (size_t j = 0; j < cols; ++j) {
+            fprintf(stream, "%s_%zu%zu", j > 0 ? ", " : "", i + 1, j + 1);
+        }
+        fprintf(stream, ";\n");
+    }
+    fprintf(stream, INDENT "};\n");
+    fprintf(stream, INDENT "%s M[%zu][%zu];\n", type_keyword, rows, cols);
+    fprintf(stream, INDENT "%s e[%zu * %zu];\n", type_keyword, rows, cols);
+    fprintf(stream, INDENT "%s v[%zu];\n", vec_type_name(cols, type), rows);
+    fprintf(stream, "} %s_t;\n", mat_shape_prefix(rows, cols, type));
+    EMPTY_LINE(stream);
+}
+
+void generate_mat_rect_constructors(FILE *restrict stream, size_t rows,
+                                    size_t cols, type_s type) {
+    const char *mat_prefix = mat_shape_prefix(rows, cols, type);
+    fprintf(stream, "LINALG_DEF %s_t %s_zero(void) {\n", mat_prefix,
+            mat_prefix);
+    fprintf(stream, INDENT "%s_t M = {0};\n", mat_prefix);
+    fprintf(stream, INDENT "return M;\n");
+    fprintf(stream, "}\n");
+    EMPTY_LINE(stream);
+    // Ones on the leading diagonal (the identity transform for the affine
+    // shapes).
+    fprintf(stream, "LINALG_DEF %s_t %s_I(void) {\n", mat_prefix, mat_prefix);
+    fprintf(stream, INDENT "%s_t M = {0};\n", mat_prefix);
+    for (size_t i = 0; i < rows && i < cols; ++i) {
+        fprintf(stream, INDENT "M._%zu%zu = 1;\n", i + 1, i + 1);
+    }
+    fprintf(stream, INDENT "return M;\n");
+    fprintf(stream, "}\n");
+    EMPTY_LINE(stream);
+}
+
+void generate_mat_rect_mul_by_vec(FILE *restrict stream, size_t rows,
+                                  size_t cols, type_s type) {
+    const char *mat_prefix = mat_shape_prefix(rows, cols, type);
+    fprintf(stream, "LINALG_DEF %s %s_mul_vec(%s_t M, %s v) {\n",
+            vec_type_name(rows, type), mat_prefix, mat_prefix,
+            vec_type_name(cols, type));
+    fprintf(stream, INDENT "%s result;\n", vec_type_name(rows, type));
+    for (size_t i = 0; i < rows; ++i) {
+        fprintf(stream, INDENT "result.e[%zu] = ", i);
+        for (size_t j = 0; j < cols; ++j) {
+            fprintf(stream, "%sM._%zu%zu * v.e[%zu]", j > 0 ? " + " : "",
+                    i + 1, j + 1, j);
+        }
+        fprintf(stream, ";\n");
+    }
+    fprintf(stream, INDENT "return result;\n");
+    fprintf(stream, "}\n");
+    EMPTY_LINE(stream);
+}
+
+void generate_mat_rect_mul(FILE *restrict stream, size_t rows, size_t inner,
+                           size_t cols, type_s type) {
+    const char *a = mat_shape_prefix(rows, inner, type);
+    const char *b = mat_shape_prefix(inner, cols, type);
+    const char *result = mat_shape_prefix(rows, cols, type);
+    fprintf(stream, "LINALG_DEF %s_t %s(%s_t A, %s_t B) {\n", result,
+            mat_product_name(rows, inner, cols, type), a, b);
+    fprintf(stream, INDENT "%s_t result;\n", result);
+    for (size_t i = 0; i < rows; ++i) {
+        for (size_t j = 0; j < cols; ++j) {
+            fprintf(stream, INDENT "result._%zu%zu = ", i + 1, j + 1);
+            for (size_t k = 0; k < inner; ++k) {
+                fprintf(stream, "%sA._%zu%zu * B._%zu%zu", k > 0 ? " + " : "",
+                        i + 1, k + 1, k + 1, j + 1);
+            }
+            fprintf(stream, ";\n");
+        }
+    }
+    fprintf(stream, INDENT "return result;\n");
+    fprintf(stream, "}\n");
+    EMPTY_LINE(stream);
+}
+
+void generate_mat_rect_transpose(FILE *restrict stream, size_t rows,
+                                 size_t cols, type_s type) {
+    const char *mat_prefix = mat_shape_prefix(rows, cols, type);
+    const char *transposed = mat_shape_prefix(cols, rows, type);
+    fprintf(stream, "LINALG_DEF %s_t %s_transpose(%s_t M) {\n", transposed,
+            mat_prefix, mat_prefix);
+    fprintf(stream, INDENT "%s_t result;\n", transposed);
+    for (size_t i = 0; i < rows; ++i) {
+        for (size_t j = 0; j < cols; ++j) {
+            fprintf(stream, INDENT "result._%zu%zu = M._%zu%zu;\n", j + 1,
+                    i + 1, i + 1, j + 1);
+        }
+    }
+    fprintf(stream, INDENT "return result;\n");
+    fprintf(stream, "}\n");
+    EMPTY_LINE(stream);
+}
+
+// Emits the statements transforming the point `in[i + offset]` into
+// `out[i + offset]` with the matrix elements hoisted in `mIJ` locals.
+void generate_affine_point(FILE *restrict stream, size_t dim, type_s type,
+                           size_t offset) {
+    const char *type_keyword = type_definitions[type].keyword;
+    const char *index = unrolled_index(offset);
+    for (size_t j = 0; j < dim; ++j) {
+        fprintf(stream, INDENT INDENT "const %s v%zu_%zu = in[%s].e[%zu];\n",
+                type_keyword, offset, j, index, j);
+    }
+    for (size_t i = 0; i < dim; ++i) {
+        fprintf(stream, INDENT INDENT "out[%s].e[%zu] = ", index, i);
+        for (size_t j = 0; j < dim; ++j) {
+            fprintf(stream, "m%zu%zu * v%zu_%zu + ", i + 1, j + 1, offset, j);
+        }
+        fprintf(stream, "m%zu%zu;\n", i + 1, dim + 1);
+    }
+}
+
+// Affine functions of `mat<N>x<N+1><t>_t`.
+void generate_mat_affine(FILE *restrict stream, size_t dim, type_s type) {
+    const char *mat_prefix = mat_shape_prefix(dim, dim + 1, type);
+    const char *square_prefix = mat_prefix_name(dim + 1, type);
+    const char *vec_type = vec_type_name(dim, type);
+    const char *type_keyword = type_definitions[type].keyword;
+
+    fprintf(stream, "LINALG_DEF %s_t %s_from_%s(%s_t M) {\n", mat_prefix,
+            mat_prefix, square_prefix, square_prefix);
+    fprintf(stream, INDENT "%s_t result;\n", mat_prefix);
+    for (size_t i = 0; i < dim; ++i) {
+        for (size_t j = 0; j < dim + 1; ++j) {
+            fprintf(stream, INDENT "result._%zu%zu = M._%zu%zu;\n", i + 1,
+                    j + 1, i + 1, j + 1);
+        }
+    }
+    fprintf(stream, INDENT "return result;\n");
+    fprintf(stream, "}\n");
+    EMPTY_LINE(stream);
+
+    fprintf(stream, "LINALG_DEF %s_t %s_to_%s(%s_t M) {\n", square_prefix,
+            mat_prefix, square_prefix, mat_prefix);
+    fprintf(stream, INDENT "%s_t result = {0};\n", square_prefix);
+    for (size_t i = 0; i < dim; ++i) {
+        for (size_t j = 0; j < dim + 1; ++j) {
+            fprintf(stream, INDENT "result._%zu%zu = M._%zu%zu;\n", i + 1,
+                    j + 1, i + 1, j + 1);
+        }
+    }
+    fprintf(stream, INDENT "result._%zu%zu = 1;\n", dim + 1, dim + 1);
+    fprintf(stream, INDENT "return result;\n");
+    fprintf(stream, "}\n");
+    EMPTY_LINE(stream);
+
+    // NOTE: the rows of `mat3x4f_t` are `vec4f_t`, so they are `__m128`.
+    bool simd = has_simd_variant(dim + 1, type);
+
+    // The product of two affine transforms (`B` applied first).
+    fprintf(stream, "LINALG_DEF %s_t %s_mul_affine(%s_t A, %s_t B) {\n",
+            mat_prefix, mat_prefix, mat_prefix, mat_prefix);
+    fprintf(stream, INDENT "%s_t result;\n", mat_prefix);
+    if (simd) {
+        // Row i of the product is a linear combination of the rows of B,
+        // plus the translation of A (the implicit last row of B is 0 0 0 1).
+        fprintf(stream, "#ifdef LINALG_SIMD\n");
+        for (size_t i = 0; i < dim; ++i) {
+            fprintf(stream,
+                    INDENT "result.v[%zu].m = _mm_set_ps(A._%zu%zu, 0, 0, "
+                           "0);\n",
+                    i, i + 1, dim + 1);
+            for (size_t k = 0; k < dim; ++k) {
+                fprintf(stream,
+                        INDENT "result.v[%zu].m = linalg_madd_ps(_mm_set1_ps("
+                               "A._%zu%zu), B.v[%zu].m, result.v[%zu].m);\n",
+                        i, i + 1, k + 1, k, i);
+            }
+        }
+        fprintf(stream, "#else\n");
+    }
+    for (size_t i = 0; i < dim; ++i) {
+        for (size_t j = 0; j < dim + 1; ++j) {
+            fprintf(stream, INDENT "result._%zu%zu = ", i + 1, j + 1);
+            for (size_t k = 0; k < dim; ++k) {
+                fprintf(stream, "%sA._%zu%zu * B._%zu%zu", k > 0 ? " + " : "",
+                        i + 1, k + 1, k + 1, j + 1);
+            }
+            if (j == dim) {
+                fprintf(stream, " + A._%zu%zu", i + 1, dim + 1);
+            }
+            fprintf(stream, ";\n");
+        }
+    }
+    if (simd) {
+        fprintf(stream, "#endif // LINALG_SIMD\n");
+    }
+    fprintf(stream, INDENT "return result;\n");
+    fprintf(stream, "}\n");
+    EMPTY_LINE(stream);
+
+    fprintf(stream, "LINALG_DEF %s %s_transform_affine(%s_t M, %s p) {\n",
+            vec_type, mat_prefix, mat_prefix, vec_type);
+    fprintf(stream, INDENT "%s result;\n", vec_type);
+    for (size_t i = 0; i < dim; ++i) {
+        fprintf(stream, INDENT "result.e[%zu] = ", i);
+        for (size_t j = 0; j < dim; ++j) {
+            fprintf(stream, "M._%zu%zu * p.e[%zu] + ", i + 1, j + 1, j);
+        }
+        fprintf(stream, "M._%zu%zu;\n", i + 1, dim + 1);
+    }
+    fprintf(stream, INDENT "return result;\n");
+    fprintf(stream, "}\n");
+    EMPTY_LINE(stream);
+
+    fprintf(stream,
+            "LINALG_DEF void %s_transform_affine_array(const %s_t *M, const %s "
+            "*restrict in, %s *restrict out, size_t n) {\n",
+            mat_prefix, mat_prefix, vec_type, vec_type);
+    if (simd) {
+        // Each output is a linear combination of the columns of M (the last
+        // one being the translation), as in `mat4f_transform_array`.
+        // NOTE: the outputs are stored 4 lanes wide, so each store spills
+        // into the next point, which is written afterwards; the last point
+        // is written by the scalar loop.
+        fprintf(stream, "#ifdef LINALG_SIMD\n");
+        for (size_t j = 0; j < dim; ++j) {
+            fprintf(stream, INDENT "__m128 c%zu = M->v[%zu].m;\n", j, j);
+        }
+        fprintf(stream, INDENT "__m128 c%zu = _mm_setzero_ps();\n", dim);
+        fprintf(stream, INDENT "_MM_TRANSPOSE4_PS(c0, c1, c2, c3);\n");
+        fprintf(stream, INDENT "size_t i = 0;\n");
+        fprintf(stream, INDENT "for (; i + %d < n; i += %d) {\n",
+                TRANSFORM_ARRAY_UNROLL, TRANSFORM_ARRAY_UNROLL);
+        for (size_t p = 0; p < TRANSFORM_ARRAY_UNROLL; ++p) {
+            const char *index = unrolled_index(p);
+            fprintf(stream, INDENT INDENT "__m128 r%zu = c%zu;\n", p, dim);
+            for (size_t j = 0; j < dim; ++j) {
+                fprintf(stream,
+                        INDENT INDENT "r%zu = linalg_madd_ps(c%zu, "
+                                      "_mm_set1_ps(in[%s].e[%zu]), r%zu);\n",
+                        p, j, index, j, p);
+            }
+        }
+        for (size_t p = 0; p < TRANSFORM_ARRAY_UNROLL; ++p) {
+            fprintf(stream, INDENT INDENT "_mm_storeu_ps(out[%s].e, r%zu);\n",
+                    unrolled_index(p), p);
+        }
+        fprintf(stream, INDENT "}\n");
+        fprintf(stream, INDENT "for (; i < n; ++i) {\n");
+        fprintf(stream,
+                INDENT INDENT "out[i] = %s_transform_affine(*M, in[i]);\n",
+                mat_prefix);
+        fprintf(stream, INDENT "}\n");
+        fprintf(stream, "#else\n");
+    }
+    // Hoist the matrix out of the loop so it lives in registers.
+    for (size_t i = 0; i < dim; ++i) {
+        for (size_t j = 0; j < dim + 1; ++j) {
+            fprintf(stream, INDENT "const %s m%zu%zu = M->_%zu%zu;\n",
+                    type_keyword, i + 1, j + 1, i + 1, j + 1);
+        }
+    }
+    fprintf(stream, INDENT "size_t i = 0;\n");
+    fprintf(stream, INDENT "for (; i + %d <= n; i += %d) {\n",
+            TRANSFORM_ARRAY_UNROLL, TRANSFORM_ARRAY_UNROLL);
+    for (size_t p = 0; p < TRANSFORM_ARRAY_UNROLL; ++p) {
+        generate_affine_point(stream, dim, type, p);
+    }
+    fprintf(stream, INDENT "}\n");
+    fprintf(stream, INDENT "for (; i < n; ++i) {\n");
+    generate_affine_point(stream, dim, type, 0);
+    fprintf(stream, INDENT "}\n");
+    if (simd) {
+        fprintf(stream, "#endif // LINALG_SIMD\n");
+    }
+    fprintf(stream, "}\n");
+    EMPTY_LINE(stream);
+}
+
+/* Half precision storage (`vecN<h>_t`): IEEE 754 binary16 values kept as raw
+ * bits in `half_t`, half the size of `vecN<f>_t` for data at rest. Arrays are
+ * converted in bulk (F16C or AVX-512 under `LINALG_SIMD`, with a scalar
+ * fallback rounding the same way, to nearest even), and the fused
+ * `matN<f>_transform_array_h` converts block by block so that the widened
+ * data never leaves the L1 cache.
+ */
+
+void generate_half_definition(FILE *restrict stream) {
+    fprintf(stream, "// IEEE 754 half precision bits, for storage only: see "
+                    "`vecN<h>_t`.\n");
+    fprintf(stream, "typedef unsigned short half_t;\n");
+    EMPTY_LINE(stream);
+    // Vectors per block of the fused kernels (two blocks of `vecN<f>_t` are
+    // kept on the stack).
+    fprintf(stream, "#ifndef LINALG_HALF_BLOCK\n");
+    fprintf(stream, "#define LINALG_HALF_BLOCK 64\n");
+    fprintf(stream, "#endif // LINALG_HALF_BLOCK\n");
+    EMPTY_LINE(stream);
+    // Shifts the exponent and mantissa in place, then rebiases the exponent
+    // with a product, which also normalizes the subnormals.
+    fprintf(stream, "LINALG_INLINE float linalg_half_to_float(half_t h) {\n");
+    fprintf(stream, INDENT "union {\n");
+    fprintf(stream, INDENT INDENT "unsigned int u;\n");
+    fprintf(stream, INDENT INDENT "float f;\n");
+    fprintf(stream, INDENT "} v = {.u = (h & 0x7FFFu) << 13};\n");
+    fprintf(stream, INDENT "v.f *= 0x1p112f;\n");
+    fprintf(stream, INDENT "if (v.f >= 0x1p16f) {\n");
+    fprintf(stream, INDENT INDENT "v.u |= 0xFFu << 23; // Infinity or NaN.\n");
+    fprintf(stream, INDENT "}\n");
+    fprintf(stream, INDENT "v.u |= (h & 0x8000u) << 16;\n");
+    fprintf(stream, INDENT "return v.f;\n");
+    fprintf(stream, "}\n");
+    EMPTY_LINE(stream);
+    // Rounds to nearest even, like `_mm_cvtps_ph(x, _MM_FROUND_TO_NEAREST_INT)`
+    // (NaNs aside: they all become the same quiet NaN).
+    fprintf(stream, "LINALG_INLINE half_t linalg_float_to_half(float x) {\n");
+    fprintf(stream, INDENT "union {\n");
+    fprintf(stream, INDENT INDENT "unsigned int u;\n");
+    fprintf(stream, INDENT INDENT "float f;\n");
+    fprintf(stream, INDENT "} v = {.f = x};\n");
+    fprintf(stream, INDENT "unsigned int sign = (v.u >> 16) & 0x8000u;\n");
+    fprintf(stream, INDENT "unsigned int h;\n");
+    fprintf(stream, INDENT "v.u &= 0x7FFFFFFFu;\n");
+    fprintf(stream, INDENT "if (v.u >= 0x47800000u) {\n");
+    fprintf(stream, INDENT INDENT "// Out of range (>= 2^16), infinity or "
+                                  "NaN.\n");
+    fprintf(stream,
+            INDENT INDENT "h = v.u > 0x7F800000u ? 0x7E00u : 0x7C00u;\n");
+    fprintf(stream, INDENT "} else if (v.u < 0x38800000u) {\n");
+    fprintf(stream, INDENT INDENT "// Subnormal or zero (< 2^-14): adding 0.5 "
+                                  "lines the mantissa up\n");
+    fprintf(stream, INDENT INDENT "// with the half ulp, and lets the FPU "
+                                  "round it.\n");
+    fprintf(stream, INDENT INDENT "v.f += 0.5f;\n");
+    fprintf(stream, INDENT INDENT "h = v.u - 0x3F000000u;\n");
+    fprintf(stream, INDENT "} else {\n");
+    fprintf(stream, INDENT INDENT "// Rebias the exponent and round the 13 "
+                                  "dropped bits to even.\n");
+    fprintf(stream, INDENT INDENT "unsigned int odd = (v.u >> 13) & 1u;\n");
+    fprintf(stream,
+            INDENT INDENT "h = (v.u - (112u << 23) + 0xFFFu + odd) >> 13;\n");
+    fprintf(stream, INDENT "}\n");
+    fprintf(stream, INDENT "return (half_t)(h | sign);\n");
+    fprintf(stream, "}\n");
+    EMPTY_LINE(stream);
+}
+
+// SIMD loop of a half/single conversion over `count` scalars, `width` at a
+// time, under `condition`: `load` reads `x`, which `convert` turns into the
+// vector `store` writes.
+void generate_half_simd_loop(FILE *restrict stream, const char *condition,
+                             size_t width, const char *load,
+                             const char *convert, const char *store) {
+    fprintf(stream, "#if defined(LINALG_SIMD) && defined(%s)\n", condition);
+    fprintf(stream, INDENT "for (; i + %zu <= count; i += %zu) {\n", width,
+            width);
+    fprintf(stream, INDENT INDENT "%s\n", load);
+    fprintf(stream, INDENT INDENT "%s\n", convert);
+    fprintf(stream, INDENT INDENT "%s\n", store);
+    fprintf(stream, INDENT "}\n");
+    fprintf(stream, "#endif // LINALG_SIMD && %s\n", condition);
+}
+
+void generate_half_conversions(FILE *restrict stream, size_t dim) {
+    const char *half_prefix = vec_prefix_name(dim, HALF_T);
+    const char *float_prefix = vec_prefix_name(dim, FLOAT_T);
+    fprintf(stream, "LINALG_DEF %s_t %s_to_%s(%s_t v) {\n", float_prefix,
+            half_prefix, float_prefix, half_prefix);
+    fprintf(stream, INDENT "return %s(", float_prefix);
+    for (size_t component = 0; component < dim; ++component) {
+        fprintf(stream, "%slinalg_half_to_float(v.%c)",
+                component > 0 ? ", " : "", vec_math_components[component]);
+    }
+    fprintf(stream, ");\n");
+    fprintf(stream, "}\n");
+    EMPTY_LINE(stream);
+    fprintf(stream, "LINALG_DEF %s_t %s_from_%s(%s_t v) {\n", half_prefix,
+            half_prefix, float_prefix, float_prefix);
+    fprintf(stream, INDENT "%s_t h;\n", half_prefix);
+    for (size_t component = 0; component < dim; ++component) {
+        char c = vec_math_components[component];
+        fprintf(stream, INDENT "h.%c = linalg_float_to_half(v.%c);\n", c, c);
+    }
+    fprintf(stream, INDENT "return h;\n");
+    fprintf(stream, "}\n");
+    EMPTY_LINE(stream);
+
+    // NOTE: both vector types are packed arrays of scalars, so the arrays are
+    // converted as flat arrays of `dim * n` scalars.
+    fprintf(stream,
+            "LINALG_DEF void %s_to_%s_array(const %s_t *restrict in, %s_t "
+            "*restrict out, size_t n) {\n",
+            half_prefix, float_prefix, half_prefix, float_prefix);
+    fprintf(stream, INDENT "const half_t *src = (const half_t *)in;\n");
+    fprintf(stream, INDENT "float *dst = (float *)out;\n");
+    fprintf(stream, INDENT "size_t count = %zu * n, i = 0;\n", dim);
+    generate_half_simd_loop(
+        stream, "__AVX512F__", 16,
+        "__m256i x = _mm256_loadu_si256((const __m256i *)(src + i));",
+        "__m512 f = _mm512_cvtph_ps(x);", "_mm512_storeu_ps(dst + i, f);");
+    generate_half_simd_loop(
+        stream, "__F16C__", 8,
+        "__m128i x = _mm_loadu_si128((const __m128i *)(src + i));",
+        "__m256 f = _mm256_cvtph_ps(x);", "_mm256_storeu_ps(dst + i, f);");
+    fprintf(stream, INDENT "for (; i < count; ++i) {\n");
+    fprintf(stream, INDENT INDENT "dst[i] = linalg_half_to_float(src[i]);\n");
+    fprintf(stream, INDENT "}\n");
+    fprintf(stream, "}\n");
+    EMPTY_LINE(stream);
+
+    fprintf(stream,
+            "LINALG_DEF void %s_from_%s_array(const %s_t *restrict in, %s_t "
+            "*restrict out, size_t n) {\n",
+            half_prefix, float_prefix, float_prefix, half_prefix);
+    fprintf(stream, INDENT "const float *src = (const float *)in;\n");
+    fprintf(stream, INDENT "half_t *dst = (half_t *)out;\n");
+    fprintf(stream, INDENT "size_t count = %zu * n, i = 0;\n", dim);
+    generate_half_simd_loop(
+        stream, "__AVX512F__", 16, "__m512 x = _mm512_loadu_ps(src + i);",
+        "__m256i h = _mm512_cvtps_ph(x, _MM_FROUND_TO_NEAREST_INT);",
+        "_mm256_storeu_si256((__m256i *)(dst + i), h);");
+    generate_half_simd_loop(
+        stream, "__F16C__", 8, "__m256 x = _mm256_loadu_ps(src + i);",
+        "__m128i h = _mm256_cvtps_ph(x, _MM_FROUND_TO_NEAREST_INT);",
+        "_mm_storeu_si128((__m128i *)(dst + i), h);");
+    fprintf(stream, INDENT "for (; i < count; ++i) {\n");
+    fprintf(stream, INDENT INDENT "dst[i] = linalg_float_to_half(src[i]);\n");
+    fprintf(stream, INDENT "}\n");
+    fprintf(stream, "}\n");
+    EMPTY_LINE(stream);
+}
+
+void generate_mat_transform_array_half(FILE *restrict stream, size_t dim) {
+    const char *mat_prefix = mat_prefix_name(dim, FLOAT_T);
+    const char *half_prefix = vec_prefix_name(dim, HALF_T);
+    const char *float_prefix = vec_prefix_name(dim, FLOAT_T);
+    fprintf(stream,
+            "LINALG_DEF void %s_transform_array_h(const %s_t *M, const %s_t "
+            "*restrict in, %s_t *restrict out, size_t n) {\n",
+            mat_prefix, mat_prefix, half_prefix, half_prefix);
+    fprintf(stream,
+            INDENT "%s_t block_in[LINALG_HALF_BLOCK], "
+                   "block_out[LINALG_HALF_BLOCK];\n",
+            float_prefix);
+    fprintf(stream,
+            INDENT "for (size_t i = 0; i < n; i += LINALG_HALF_BLOCK) {\n");
+    fprintf(stream, INDENT INDENT "size_t m = n - i < LINALG_HALF_BLOCK ? n - "
+                                  "i : LINALG_HALF_BLOCK;\n");
+    fprintf(stream, INDENT INDENT "%s_to_%s_array(in + i, block_in, m);\n",
+            half_prefix, float_prefix);
+    fprintf(stream,
+            INDENT INDENT "%s_transform_array(M, block_in, block_out, m);\n",
+            mat_prefix);
+    fprintf(stream, INDENT INDENT "%s_from_%s_array(block_out, out + i, m);\n",
+            half_prefix, float_prefix);
+    fprintf(stream, INDENT "}\n");
+    fprintf(stream, "}\n");
+    EMPTY_LINE(stream);
+}
+
+/* Benchmark program generation (`--bench`).
+ *
+ * The benchmark program includes `linalg.h` and `src/bench.h`, and has one
+ * case per generated function, for every dimension and type. Cases run their
+ * function over a batch of BENCH_BATCH elements (small enough to stay in the
+ * L1 cache), so the reported time per operation is the throughput of batched
+ * usage. Functions that already take a whole array (e.g. `transform_array`,
+ * the structure-of-arrays kernels) are called once on the batch.
+ */
+
+#define BENCH_BATCH 256
+#define BENCH_MAX_CASES 2048
+
+typedef struct {
+    const char *group;
+    const char *function;
+    size_t dim;
+    type_s type;
+} bench_case_s;
+
+static bench_case_s bench_cases[BENCH_MAX_CASES];
+static size_t num_bench_cases = 0;
+
+// Emits the kernel of a benchmark case and registers it. When `batched` is
+// false, `statement` is executed for each index `i` of the batch.
+void generate_bench_case(FILE *restrict stream, const char *group,
+                         const char *function, size_t dim, type_s type,
+                         bool batched, const char *statement) {
+    assert(num_bench_cases < BENCH_MAX_CASES);
+    bench_cases[num_bench_cases++] = (bench_case_s){
+        .group = group, .function = function, .dim = dim, .type = type};
+    fprintf(stream, "static void bench_%s(size_t reps) {\n", function);
+    fprintf(stream, INDENT "for (size_t r = 0; r < reps; ++r) {\n");
+    if (batched) {
+        fprintf(stream, INDENT INDENT "%s\n", statement);
+    } else {
+        fprintf(stream,
+                INDENT INDENT "for (size_t i = 0; i < BENCH_BATCH; ++i) {\n");
+        fprintf(stream, INDENT INDENT INDENT "%s\n", statement);
+        fprintf(stream, INDENT INDENT "}\n");
+    }
+    fprintf(stream, INDENT INDENT "BENCH_CLOBBER();\n");
+    fprintf(stream, INDENT "}\n");
+    fprintf(stream, "}\n");
+    EMPTY_LINE(stream);
+}
+
+// Inputs and outputs of the cases of one dimension and type. They are not
+// static, so that `BENCH_CLOBBER` stops the compiler from caching them across
+// repetitions.
+// - `a`, `b` and `c` hold small positive values (valid divisors);
+// - `ones` keeps repeated products and in-place updates bounded;
+// - `I` holds identity matrices for the same reason.
+// Only the matrices and SoA batches of `mat` and `soa` are declared.
+void generate_bench_data(FILE *restrict stream, size_t dim, type_s type,
+                         bool mat, bool soa) {
+    const char *vec_type = vec_type_name(dim, type);
+    const char *mat_prefix = mat_prefix_name(dim, type);
+    const char *soa_prefix = vec_soa_prefix_name(dim, type);
+    const char *type_keyword = type_definitions[type].keyword;
+    const char *v = vec_prefix_name(dim, type);
+    fprintf(stream,
+            "%s bench_%s_a[BENCH_BATCH], bench_%s_b[BENCH_BATCH], "
+            "bench_%s_c[BENCH_BATCH];\n",
+            vec_type, v, v, v);
+    fprintf(stream, "%s bench_%s_ones[BENCH_BATCH], "
+                    "bench_%s_out[BENCH_BATCH];\n",
+            vec_type, v, v);
+    fprintf(stream, "%s bench_%s_scalars[BENCH_BATCH];\n",
+            type_keyword, v);
+    if (mat) {
+        fprintf(stream, "%s_t bench_%s_A[BENCH_BATCH], "
+                        "bench_%s_B[BENCH_BATCH], bench_%s_I[BENCH_BATCH], "
+                        "bench_%s_out[BENCH_BATCH];\n",
+                mat_prefix, mat_prefix, mat_prefix, mat_prefix, mat_prefix);
+    }
+    if (soa) {
+        fprintf(stream, "%s bench_%s_streams[3][%zu][BENCH_BATCH];\n",
+                type_keyword, soa_prefix, dim);
+        fprintf(stream, "%s_t bench_%s_a, bench_%s_b, bench_%s_out;\n",
+                soa_prefix, soa_prefix, soa_prefix, soa_prefix);
+    }
+    EMPTY_LINE(stream);
+
+    fprintf(stream, "static void bench_%s_init(void) {\n", v);
+    fprintf(stream, INDENT "for (size_t i = 0; i < BENCH_BATCH; ++i) {\n");
+    fprintf(stream, INDENT INDENT "for (size_t k = 0; k < %zu; ++k) {\n", dim);
+    fprintf(stream,
+            INDENT INDENT INDENT
+            "bench_%s_a[i].e[k] = (%s)(1 + (i * 7 + k * 3) %% 13);\n",
+            v, type_keyword);
+    fprintf(stream,
+            INDENT INDENT INDENT
+            "bench_%s_b[i].e[k] = (%s)(1 + (i * 5 + k * 11) %% 13);\n",
+            v, type_keyword);
+    fprintf(stream,
+            INDENT INDENT INDENT
+            "bench_%s_c[i].e[k] = (%s)(1 + (i * 3 + k * 7) %% 13);\n",
+            v, type_keyword);
+    fprintf(stream, INDENT INDENT INDENT "bench_%s_ones[i].e[k] = 1;\n", v);
+    fprintf(stream, INDENT INDENT "}\n");
+    if (mat) {
+        fprintf(stream, INDENT INDENT "for (size_t k = 0; k < %zu; ++k) {\n",
+                dim * dim);
+        fprintf(stream,
+                INDENT INDENT INDENT
+                "bench_%s_A[i].e[k] = (%s)(1 + (i * 7 + k * 3) %% 13);\n",
+                mat_prefix, type_keyword);
+        fprintf(stream,
+                INDENT INDENT INDENT
+                "bench_%s_B[i].e[k] = (%s)(1 + (i * 5 + k * 11) %% 13);\n",
+                mat_prefix, type_keyword);
+        fprintf(stream, INDENT INDENT "}\n");
+        fprintf(stream, INDENT INDENT "bench_%s_I[i] = %s_I();\n",
+                mat_prefix, mat_prefix);
+    }
+    fprintf(stream, INDENT "}\n");
+    if (!soa) {
+        fprintf(stream, "}\n");
+        EMPTY_LINE(stream);
+        return;
+    }
+    const char *soa_names[3] = {"a", "b", "out"};
+    for (size_t s = 0; s < 3; ++s) {
+        for (size_t component = 0; component < dim; ++component) {
+            fprintf(stream,
+                    INDENT "bench_%s_%s.%s = bench_%s_streams[%zu][%zu];\n",
+                    soa_prefix, soa_names[s],
+                    vec_component_name(dim, component), soa_prefix, s,
+                    component);
+        }
+        fprintf(stream, INDENT "bench_%s_%s.n = BENCH_BATCH;\n", soa_prefix,
+                soa_names[s]);
+    }
+    fprintf(stream, INDENT "%s_from_aos(bench_%s_a, bench_%s_a);\n", soa_prefix,
+            soa_prefix, v);
+    fprintf(stream, INDENT "%s_from_aos(bench_%s_b, bench_%s_b);\n", soa_prefix,
+            soa_prefix, v);
+    fprintf(stream, "}\n");
+    EMPTY_LINE(stream);
+}
+
+// Comma-separated arguments `bench_<vec>_a[i], bench_<vec>_b[i], ...` (or
+// pointers to them, or whole structure-of-arrays when `soa` is true).
+// NOTE: ternary functions get (a, ones, b) so that ranges such as the bounds of
+// `clamp` are valid (the structure-of-arrays variants get (a, b, b)).
+const char *bench_vec_args(size_t dim, type_s type, size_t arity, bool pointers,
+                           bool soa) {
+    static const char *binary_names[2] = {"a", "b"};
+    static const char *ternary_names[3] = {"a", "ones", "b"};
+    static const char *soa_ternary_names[3] = {"a", "b", "b"};
+    assert(arity <= 3);
+    const char *args = "";
+    for (size_t param = 0; param < arity; ++param) {
+        const char *name = arity < 3 ? binary_names[param]
+                           : soa     ? soa_ternary_names[param]
+                                     : ternary_names[param];
+        const char *arg =
+            soa ? varia_temp_sprintf("bench_%s_%s",
+                                     vec_soa_prefix_name(dim, type), name)
+                : varia_temp_sprintf("%sbench_%s_%s[i]", pointers ? "&" : "",
+                                     vec_prefix_name(dim, type), name);
+        args = varia_temp_sprintf("%s%s%s", args, param > 0 ? ", " : "", arg);
+    }
+    return args;
+}
+
+void generate_bench_vec_cases(FILE *restrict stream, size_t dim, type_s type) {
+    const char *v = vec_prefix_name(dim, type);
+    for (size_t op = 0; op < NUM_OPS; ++op) {
+        const char *name = op_definitions[op].name;
+        generate_bench_case(
+            stream, "vec_op", vec_fn_name(dim, type, name), dim, type, false,
+            varia_temp_sprintf("bench_%s_out[i] = %s(%s);", v,
+                               vec_fn_name(dim, type, name),
+                               bench_vec_args(dim, type, 2, false, false)));
+        generate_bench_case(
+            stream, "vec_op_to",
+            vec_fn_name(dim, type, varia_temp_sprintf("%s_to", name)), dim,
+            type, false,
+            varia_temp_sprintf("%s_to(&bench_%s_out[i], %s);",
+                               vec_fn_name(dim, type, name), v,
+                               bench_vec_args(dim, type, 2, true, false)));
+        generate_bench_case(
+            stream, "vec_op_assign",
+            vec_fn_name(dim, type, varia_temp_sprintf("%s_assign", name)), dim,
+            type, false,
+            varia_temp_sprintf("%s_assign(&bench_%s_out[i], bench_%s_%s[i]);",
+                               vec_fn_name(dim, type, name), v, v,
+                               op == OP_MOD ? "b" : "ones"));
+    }
+    for (size_t fn = 0; fn < ARRAY_LEN(fn_definitions); ++fn) {
+        fn_definition_s definition = fn_definitions[fn];
+        if (definition.generic_selection[type] == NULL) {
+            continue;
+        }
+        const char *fn_name = vec_fn_name(dim, type, definition.name);
+        generate_bench_case(
+            stream, "vec_fn", fn_name, dim, type, false,
+            varia_temp_sprintf(
+                "bench_%s_out[i] = %s(%s);", v, fn_name,
+                bench_vec_args(dim, type, definition.arity, false, false)));
+        generate_bench_case(
+            stream, "vec_fn_to", varia_temp_sprintf("%s_to", fn_name), dim,
+            type, false,
+            varia_temp_sprintf(
+                "%s_to(&bench_%s_out[i], %s);", fn_name, v,
+                bench_vec_args(dim, type, definition.arity, true, false)));
+    }
+    for (variadic_op_s variadic_op = 0; variadic_op < NUM_VARIADIC_OPS;
+         ++variadic_op) {
+        const char *name = variadic_op_definitions[variadic_op].name;
+        generate_bench_case(
+            stream, "vec_variadic", vec_fn_name(dim, type, name), dim, type,
+            false,
+            varia_temp_sprintf("bench_%s_out[i] = %s(3, %s);", v,
+                               vec_fn_name(dim, type, name),
+                               bench_vec_args(dim, type, 3, false, false)));
+        generate_bench_case(
+            stream, "vec_array",
+            vec_fn_name(dim, type, varia_temp_sprintf("%s_array", name)), dim,
+            type, true,
+            varia_temp_sprintf(
+                "bench_%s_out[0] = %s_array(bench_%s_%s, bench_batch);", v,
+                vec_fn_name(dim, type, name), v,
+                variadic_op == VARIADIC_OP_SUM ? "a" : "ones"));
+    }
+
+    const char *binary = bench_vec_args(dim, type, 2, false, false);
+    const char *unary = bench_vec_args(dim, type, 1, false, false);
+    generate_bench_case(stream, "vec_metric", vec_fn_name(dim, type, "dot"),
+                        dim, type, false,
+                        varia_temp_sprintf("bench_%s_scalars[i] = %s(%s);", v,
+                                           vec_fn_name(dim, type, "dot"),
+                                           binary));
+    generate_bench_case(stream, "vec_metric", vec_fn_name(dim, type, "sqrlen"),
+                        dim, type, false,
+                        varia_temp_sprintf("bench_%s_scalars[i] = %s(%s);", v,
+                                           vec_fn_name(dim, type, "sqrlen"),
+                                           unary));
+    generate_bench_case(stream, "vec_metric", vec_fn_name(dim, type, "1norm"),
+                        dim, type, false,
+                        varia_temp_sprintf("bench_%s_scalars[i] = %s(%s);", v,
+                                           vec_fn_name(dim, type, "1norm"),
+                                           unary));
+    generate_bench_case(stream, "vec_geometry",
+                        vec_fn_name(dim, type, "reflect"), dim, type, false,
+                        varia_temp_sprintf("bench_%s_out[i] = %s(%s);", v,
+                                           vec_fn_name(dim, type, "reflect"),
+                                           binary));
+    if (dim == 2 || dim == 3) {
+        generate_bench_case(
+            stream, "vec_geometry", vec_fn_name(dim, type, "cross"), dim, type,
+            false,
+            varia_temp_sprintf("bench_%s_%s[i] = %s(%s);", v,
+                               dim == 2 ? "scalars" : "out",
+                               vec_fn_name(dim, type, "cross"), binary));
+    }
+    if (!is_floating_type(type)) {
+        return;
+    }
+    generate_bench_case(stream, "vec_metric", vec_fn_name(dim, type, "2norm"),
+                        dim, type, false,
+                        varia_temp_sprintf("bench_%s_scalars[i] = %s(%s);", v,
+                                           vec_fn_name(dim, type, "2norm"),
+                                           unary));
+    generate_bench_case(
+        stream, "vec_metric", vec_fn_name(dim, type, "eq"), dim, type, false,
+        varia_temp_sprintf("bench_%s_scalars[i] = %s(%s, 1e-3);", v,
+                           vec_fn_name(dim, type, "eq"), binary));
+    generate_bench_case(stream, "vec_geometry", vec_fn_name(dim, type, "unit"),
+                        dim, type, false,
+                        varia_temp_sprintf("bench_%s_out[i] = %s(%s);", v,
+                                           vec_fn_name(dim, type, "unit"),
+                                           unary));
+    generate_bench_case(stream, "vec_geometry",
+                        vec_fn_name(dim, type, "direction"), dim, type, false,
+                        varia_temp_sprintf("bench_%s_out[i] = %s(%s);", v,
+                                           vec_fn_name(dim, type, "direction"),
+                                           binary));
+    if (dim == 2 || dim == 3) {
+        generate_bench_case(
+            stream, "vec_metric", vec_fn_name(dim, type, "angle_between"), dim,
+            type, false,
+            varia_temp_sprintf("bench_%s_scalars[i] = %s(%s);", v,
+                               vec_fn_name(dim, type, "angle_between"),
+                               binary));
+    }
+    if (!has_fast_variant(type)) {
+        return;
+    }
+    generate_bench_case(stream, "vec_geometry",
+                        vec_fn_name(dim, type, "unit_fast"), dim, type, false,
+                        varia_temp_sprintf("bench_%s_out[i] = %s(%s);", v,
+                                           vec_fn_name(dim, type, "unit_fast"),
+                                           unary));
+    if (dim == 2 || dim == 3) {
+        generate_bench_case(
+            stream, "vec_metric", vec_fn_name(dim, type, "angle_between_fast"),
+            dim, type, false,
+            varia_temp_sprintf("bench_%s_scalars[i] = %s(%s);", v,
+                               vec_fn_name(dim, type, "angle_between_fast"),
+                               binary));
+    }
+}
+
+void generate_bench_mat_cases(FILE *restrict stream, size_t dim, type_s type) {
+    const char *m = mat_prefix_name(dim, type);
+    const char *v = vec_prefix_name(dim, type);
+    generate_bench_case(
+        stream, "mat", varia_temp_sprintf("%s_mul", m), dim, type, false,
+        varia_temp_sprintf(
+            "bench_%s_out[i] = %s_mul(bench_%s_A[i], bench_%s_B[i]);", m, m, m,
+            m));
+    generate_bench_case(
+        stream, "mat", varia_temp_sprintf("%s_mul_to", m), dim, type, false,
+        varia_temp_sprintf(
+            "%s_mul_to(&bench_%s_out[i], &bench_%s_A[i], &bench_%s_B[i]);", m,
+            m, m, m));
+    generate_bench_case(
+        stream, "mat", varia_temp_sprintf("%s_nmul", m), dim, type, false,
+        varia_temp_sprintf("bench_%s_out[i] = %s_nmul(3, bench_%s_A[i], "
+                           "bench_%s_B[i], bench_%s_I[i]);",
+                           m, m, m, m, m));
+    generate_bench_case(
+        stream, "mat", varia_temp_sprintf("%s_mul_chain", m), dim, type, true,
+        varia_temp_sprintf(
+            "bench_%s_out[0] = %s_mul_chain(bench_%s_I, bench_batch);", m, m,
+            m));
+    generate_bench_case(
+        stream, "mat", varia_temp_sprintf("%s_mul_vec", m), dim, type, false,
+        varia_temp_sprintf(
+            "bench_%s_out[i] = %s_mul_vec(bench_%s_A[i], bench_%s_a[i]);", v, m,
+            m, v));
+    generate_bench_case(
+        stream, "mat", varia_temp_sprintf("%s_mul_vec_to", m), dim, type,
+        false,
+        varia_temp_sprintf(
+            "%s_mul_vec_to(&bench_%s_out[i], &bench_%s_A[i], &bench_%s_a[i]);",
+            m, v, m, v));
+    generate_bench_case(
+        stream, "mat", varia_temp_sprintf("%s_hadamard", m), dim, type, false,
+        varia_temp_sprintf(
+            "bench_%s_out[i] = %s_hadamard(bench_%s_A[i], bench_%s_B[i]);", m,
+            m, m, m));
+    generate_bench_case(
+        stream, "mat", varia_temp_sprintf("%s_hadamard_to", m), dim, type,
+        false,
+        varia_temp_sprintf(
+            "%s_hadamard_to(&bench_%s_out[i], &bench_%s_A[i], &bench_%s_B[i]);",
+            m, m, m, m));
+    if (is_floating_type(type)) {
+        generate_bench_case(
+            stream, "mat", varia_temp_sprintf("%s_rotate", m), dim, type, false,
+            varia_temp_sprintf("bench_%s_out[i] = %s_rotate(bench_%s_A[i], "
+                               "%s0.5);",
+                               m, m, m, dim == 2 ? "" : "AXIS_Z, "));
+        generate_bench_case(
+            stream, "mat", varia_temp_sprintf("%s_rotate_to", m), dim, type,
+            false,
+            varia_temp_sprintf("%s_rotate_to(&bench_%s_out[i], &bench_%s_A[i], "
+                               "%s0.5);",
+                               m, m, m, dim == 2 ? "" : "AXIS_Z, "));
+    }
+    if (has_fast_variant(type)) {
+        generate_bench_case(
+            stream, "mat", varia_temp_sprintf("%s_rotate_fast", m), dim, type,
+            false,
+            varia_temp_sprintf("bench_%s_out[i] = "
+                               "%s_rotate_fast(bench_%s_A[i], %s0.5);",
+                               m, m, m, dim == 2 ? "" : "AXIS_Z, "));
+    }
+    generate_bench_case(
+        stream, "mat", varia_temp_sprintf("%s_transpose", m), dim, type, false,
+        varia_temp_sprintf("bench_%s_out[i] = %s_transpose(bench_%s_A[i]);", m,
+                           m, m));
+    if (is_floating_type(type)) {
+        generate_bench_case(
+            stream, "mat", varia_temp_sprintf("%s_det", m), dim, type, false,
+            varia_temp_sprintf("bench_%s_scalars[i] = %s_det(bench_%s_A[i]);",
+                               v, m, m));
+        generate_bench_case(
+            stream, "mat", varia_temp_sprintf("%s_inverse", m), dim, type,
+            false,
+            varia_temp_sprintf("bench_%s_out[i] = %s_inverse(bench_%s_B[i]);",
+                               m, m, m));
+        generate_bench_case(
+            stream, "batch", varia_temp_sprintf("%s_inverse_array", m), dim,
+            type, true,
+            varia_temp_sprintf(
+                "%s_inverse_array(bench_%s_B, bench_%s_out, bench_batch);", m,
+                m, m));
+    }
+    if (is_floating_type(type) && dim == 4) {
+        generate_bench_case(
+            stream, "mat", varia_temp_sprintf("%s_inverse_affine", m), dim,
+            type, false,
+            varia_temp_sprintf(
+                "bench_%s_out[i] = %s_inverse_affine(bench_%s_B[i]);", m, m,
+                m));
+    }
+    generate_bench_case(
+        stream, "batch", varia_temp_sprintf("%s_transform_array", m), dim,
+        type, true,
+        varia_temp_sprintf("%s_transform_array(&bench_%s_A[0], bench_%s_a, "
+                           "bench_%s_out, bench_batch);",
+                           m, m, v, v));
+}
+
+void generate_bench_soa_cases(FILE *restrict stream, size_t dim, type_s type) {
+    const char *s = vec_soa_prefix_name(dim, type);
+    const char *v = vec_prefix_name(dim, type);
+    generate_bench_case(
+        stream, "batch", varia_temp_sprintf("%s_from_aos", s), dim, type, true,
+        varia_temp_sprintf("%s_from_aos(bench_%s_out, bench_%s_a);", s, s, v));
+    generate_bench_case(
+        stream, "batch", varia_temp_sprintf("%s_to_aos", s), dim, type, true,
+        varia_temp_sprintf("%s_to_aos(bench_%s_out, bench_%s_a);", s, v, s));
+    for (size_t op = 0; op < NUM_OPS; ++op) {
+        const char *name = op_definitions[op].name;
+        generate_bench_case(
+            stream, "batch", varia_temp_sprintf("%s_%s", s, name), dim, type,
+            true,
+            varia_temp_sprintf("%s_%s(bench_%s_out, %s);", s, name, s,
+                               bench_vec_args(dim, type, 2, false, true)));
+    }
+    for (size_t fn = 0; fn < ARRAY_LEN(fn_definitions); ++fn) {
+        fn_definition_s definition = fn_definitions[fn];
+        if (definition.generic_selection[type] == NULL) {
+            continue;
+        }
+        generate_bench_case(
+            stream, "batch", varia_temp_sprintf("%s_%s", s, definition.name),
+            dim, type, true,
+            varia_temp_sprintf(
+                "%s_%s(bench_%s_out, %s);", s, definition.name, s,
+                bench_vec_args(dim, type, definition.arity, false, true)));
+    }
+    generate_bench_case(
+        stream, "batch", varia_temp_sprintf("%s_dot", s), dim, type, true,
+        varia_temp_sprintf("%s_dot(bench_%s_scalars, bench_%s_a, bench_%s_b);",
+                           s, v, s, s));
+    if (is_floating_type(type)) {
+        generate_bench_case(
+            stream, "batch", varia_temp_sprintf("%s_2norm", s), dim, type, true,
+            varia_temp_sprintf("%s_2norm(bench_%s_scalars, bench_%s_a);", s, v,
+                               s));
+        generate_bench_case(
+            stream, "batch", varia_temp_sprintf("%s_unit", s), dim, type, true,
+            varia_temp_sprintf("%s_unit(bench_%s_out, bench_%s_a);", s, s, s));
+    }
+    const char *m = mat_prefix_name(dim, type);
+    generate_bench_case(
+        stream, "batch", varia_temp_sprintf("%s_mul_vec_soa", m), dim, type,
+        true,
+        varia_temp_sprintf(
+            "%s_mul_vec_soa(bench_%s_out, bench_%s_A[0], bench_%s_a);", m, s, m,
+            s));
+}
+
+// Affine transforms of `vecN<t>_t` by `matNx(N+1)<t>_t`, initialized from the
+// upper rows of `bench_matN+1<t>_A`.
+void generate_bench_affine_cases(FILE *restrict stream, size_t dim,
+                                 type_s type) {
+    if (dim + 1 > MAX_DIM) {
+        return;
+    }
+    const char *a = mat_shape_prefix(dim, dim + 1, type);
+    const char *m = mat_prefix_name(dim + 1, type);
+    const char *v = vec_prefix_name(dim, type);
+    fprintf(stream,
+            "%s_t bench_%s_A[BENCH_BATCH], bench_%s_out[BENCH_BATCH];\n", a, a,
+            a);
+    fprintf(stream, "static void bench_%s_init(void) {\n", a);
+    fprintf(stream, INDENT "for (size_t i = 0; i < BENCH_BATCH; ++i) {\n");
+    fprintf(stream,
+            INDENT INDENT "bench_%s_A[i] = %s_from_%s(bench_%s_A[i]);\n", a, a,
+            m, m);
+    fprintf(stream, INDENT "}\n");
+    fprintf(stream, "}\n");
+    EMPTY_LINE(stream);
+    generate_bench_case(
+        stream, "mat", varia_temp_sprintf("%s_mul_affine", a), dim, type,
+        false,
+        varia_temp_sprintf("bench_%s_out[i] = %s_mul_affine(bench_%s_A[i], "
+                           "bench_%s_A[i]);",
+                           a, a, a, a));
+    generate_bench_case(
+        stream, "batch", varia_temp_sprintf("%s_transform_affine_array", a),
+        dim, type, true,
+        varia_temp_sprintf("%s_transform_affine_array(&bench_%s_A[0], "
+                           "bench_%s_a, bench_%s_out, bench_batch);",
+                           a, a, v, v));
+}
+
+// Half precision data is initialized from the single precision inputs (so
+// `bench_vecN<f>_init()` runs first). The transform needs `matN<f>_t` (`mat`).
+void generate_bench_half_cases(FILE *restrict stream, size_t dim, bool mat) {
+    const char *h = vec_prefix_name(dim, HALF_T);
+    const char *f = vec_prefix_name(dim, FLOAT_T);
+    const char *m = mat_prefix_name(dim, FLOAT_T);
+    fprintf(stream,
+            "%s_t bench_%s_a[BENCH_BATCH], bench_%s_out[BENCH_BATCH];\n", h, h,
+            h);
+    fprintf(stream, "static void bench_%s_init(void) {\n", h);
+    fprintf(stream, INDENT "%s_from_%s_array(bench_%s_a, bench_%s_a, "
+                           "BENCH_BATCH);\n",
+            h, f, f, h);
+    fprintf(stream, "}\n");
+    EMPTY_LINE(stream);
+    generate_bench_case(
+        stream, "batch", varia_temp_sprintf("%s_to_%s_array", h, f), dim,
+        HALF_T, true,
+        varia_temp_sprintf("%s_to_%s_array(bench_%s_a, bench_%s_out, "
+                           "bench_batch);",
+                           h, f, h, f));
+    generate_bench_case(
+        stream, "batch", varia_temp_sprintf("%s_from_%s_array", h, f), dim,
+        HALF_T, true,
+        varia_temp_sprintf("%s_from_%s_array(bench_%s_a, bench_%s_out, "
+                           "bench_batch);",
+                           h, f, f, h));
+    if (!mat) {
+        return;
+    }
+    generate_bench_case(
+        stream, "batch", varia_temp_sprintf("%s_transform_array_h", m), dim,
+        HALF_T, true,
+        varia_temp_sprintf("%s_transform_array_h(&bench_%s_A[0], bench_%s_a, "
+                           "bench_%s_out, bench_batch);",
+                           m, m, h, h));
+}
+
+void generate_bench_quat_cases(FILE *restrict stream, type_s type) {
+    if (!has_quat_variant(type)) {
+        return;
+    }
+    const char *q = quat_prefix_name(type);
+    const char *v = vec_prefix_name(3, type);
+    const char *m3 = mat_prefix_name(3, type);
+    const char *m4 = mat_prefix_name(4, type);
+    fprintf(stream,
+            "%s_t bench_%s_a[BENCH_BATCH], bench_%s_b[BENCH_BATCH], "
+            "bench_%s_out[BENCH_BATCH];\n",
+            q, q, q, q);
+    fprintf(stream, "%s_t bench_%s_R[BENCH_BATCH];\n", m3, q);
+    EMPTY_LINE(stream);
+    // Unit quaternions, and rotation matrices to convert back.
+    fprintf(stream, "static void bench_%s_init(void) {\n", q);
+    fprintf(stream, INDENT "for (size_t i = 0; i < BENCH_BATCH; ++i) {\n");
+    fprintf(stream,
+            INDENT INDENT "bench_%s_a[i] = %s_normalize(%s(1, (%s)(i %% 7), "
+                          "2, (%s)(i %% 5)));\n",
+            q, q, q, type_definitions[type].keyword,
+            type_definitions[type].keyword);
+    fprintf(stream,
+            INDENT INDENT "bench_%s_b[i] = %s_normalize(%s((%s)(i %% 3), 1, "
+                          "(%s)(i %% 11), 3));\n",
+            q, q, q, type_definitions[type].keyword,
+            type_definitions[type].keyword);
+    fprintf(stream,
+            INDENT INDENT "bench_%s_R[i] = %s_to_mat3(bench_%s_a[i]);\n", q,
+            q, q);
+    fprintf(stream, INDENT "}\n");
+    fprintf(stream, "}\n");
+    EMPTY_LINE(stream);
+
+    const char *binary =
+        varia_temp_sprintf("bench_%s_a[i], bench_%s_b[i]", q, q);
+    const char *unary = varia_temp_sprintf("bench_%s_a[i]", q);
+    struct {
+        const char *fn;
+        const char *out;
+        const char *args;
+    } cases[] = {
+        {"mul", varia_temp_sprintf("bench_%s_out", q), binary},
+        {"conjugate", varia_temp_sprintf("bench_%s_out", q), unary},
+        {"inverse", varia_temp_sprintf("bench_%s_out", q), unary},
+        {"normalize", varia_temp_sprintf("bench_%s_out", q), unary},
+        {"nlerp", varia_temp_sprintf("bench_%s_out", q),
+         varia_temp_sprintf("%s, 0.25", binary)},
+        {"slerp", varia_temp_sprintf("bench_%s_out", q),
+         varia_temp_sprintf("%s, 0.25", binary)},
+        {"rotate_vec", varia_temp_sprintf("bench_%s_out", v),
+         varia_temp_sprintf("bench_%s_a[i], bench_%s_a[i]", q, v)},
+        {"to_mat3", varia_temp_sprintf("bench_%s_out", m3), unary},
+        {"to_mat4", varia_temp_sprintf("bench_%s_out", m4), unary},
+        {"from_mat3", varia_temp_sprintf("bench_%s_out", q),
+         varia_temp_sprintf("bench_%s_R[i]", q)},
+    };
+    for (size_t c = 0; c < ARRAY_LEN(cases); ++c) {
+        const char *fn = varia_temp_sprintf("%s_%s", q, cases[c].fn);
+        generate_bench_case(stream, "quat", fn, 4, type, false,
+                            varia_temp_sprintf("%s[i] = %s(%s);", cases[c].out,
+                                               fn, cases[c].args));
+    }
+}
+
+/* Selection of what gets generated, see `usage()`. By default everything is
+ * emitted in a single header on stdout.
+ */
+
+typedef enum {
+    GROUP_VEC = 0,
+    GROUP_MAT,
+    GROUP_RECT, // Non-square matrices.
+    GROUP_QUAT,
+    GROUP_SOA,
+    NUM_GROUPS,
+} group_s;
+
+static_assert(NUM_GROUPS == 5, "Number of groups has changed.");
+static const char *group_names[NUM_GROUPS] = {
+    [GROUP_VEC] = "vec",
+    [GROUP_MAT] = "mat",
+    [GROUP_RECT] = "rect",
+    [GROUP_QUAT] = "quat",
+    [GROUP_SOA] = "soa",
+};
+
+typedef struct {
+    bool dims[MAX_DIM + 1];
+    bool types[NUM_TYPES];
+    bool groups[NUM_GROUPS];
+    bool bench;            // The benchmark program instead of the library.
+    const char *split_dir; // NULL: single header on stdout.
+    size_t jobs;           // Threads rendering the functions.
+} generator_config_s;
+
+void usage(FILE *restrict stream, const char *program) {
+    fprintf(stream,
+            "usage: %s [--bench] [--dims=LIST] [--types=LIST] "
+            "[--groups=LIST] [--split=DIR] [--jobs=N]\n",
+            program);
+    fprintf(stream, "  --bench        generate the benchmark program\n");
+    fprintf(stream, "  --dims=LIST    dimensions among %d..%d (e.g. 3,4)\n",
+            MIN_DIM, MAX_DIM);
+    fprintf(stream, "  --types=LIST   scalar types among f,d,i,u,h\n");
+    fprintf(stream,
+            "  --groups=LIST  function groups among vec,mat,rect,quat,soa\n");
+    fprintf(stream, "  --split=DIR    write linalg_types.h, one linalg_<t>.h "
+                    "per type and an umbrella linalg.h in DIR\n");
+    fprintf(stream, "  --jobs=N       render the functions on N threads (0: "
+                    "one per CPU), the output is the same\n");
+}
+
+// Marks the entries of `names` listed in the comma-separated `list`. Returns
+// false on an unknown entry.
+bool select_names(const char *list, const char **names, size_t num_names,
+                  bool *selected) {
+    for (size_t i = 0; i < num_names; ++i) {
+        selected[i] = false;
+    }
+    for (;;) {
+        const char *end = strchr(list, ',');
+        size_t length = end == NULL ? strlen(list) : (size_t)(end - list);
+        size_t i = 0;
+        while (i < num_names && (strlen(names[i]) != length ||
+                                 strncmp(names[i], list, length) != 0)) {
+            ++i;
+        }
+        if (i == num_names) {
+            fprintf(stderr, "error: unknown entry '%.*s'\n", (int)length,
+                    list);
+            return false;
+        }
+        selected[i] = true;
+        if (end == NULL) {
+            return true;
+        }
+        list = end + 1;
+    }
+}
+
+bool parse_config(generator_config_s *config, int argc, char **argv) {
+    *config = (generator_config_s){.jobs = 1};
+    for (size_t dim = MIN_DIM; dim <= MAX_DIM; ++dim) {
+        config->dims[dim] = true;
+    }
+    for (size_t type = 0; type < NUM_TYPES; ++type) {
+        config->types[type] = true;
+    }
+    for (size_t group = 0; group < NUM_GROUPS; ++group) {
+        config->groups[group] = true;
+    }
+
+    const char *dim_names[MAX_DIM - MIN_DIM + 1];
+    for (size_t dim = MIN_DIM; dim <= MAX_DIM; ++dim) {
+        dim_names[dim - MIN_DIM] = varia_temp_sprintf("%zu", dim);
+    }
+    const char *type_names[NUM_TYPES];
+    for (size_t type = 0; type < NUM_TYPES; ++type) {
+        type_names[type] = type_definitions[type].suffix;
+    }
+    bool groups_selected = false; // Whether `--groups` was given.
+    for (int i = 1; i < argc; ++i) {
+        const char *arg = argv[i];
+        bool ok = true;
+        if (strcmp(arg, "--bench") == 0) {
+            config->bench = true;
+        } else if (strncmp(arg, "--dims=", 7) == 0) {
+            ok = select_names(arg + 7, dim_names, ARRAY_LEN(dim_names),
+                              &config->dims[MIN_DIM]);
+        } else if (strncmp(arg, "--types=", 8) == 0) {
+            ok = select_names(arg + 8, type_names, NUM_TYPES, config->types);
+        } else if (strncmp(arg, "--groups=", 9) == 0) {
+            ok = select_names(arg + 9, group_names, NUM_GROUPS,
+                              config->groups);
+            groups_selected = true;
+        } else if (strncmp(arg, "--split=", 8) == 0 && arg[8] != '\0') {
+            config->split_dir = arg + 8;
+        } else if (strncmp(arg, "--jobs=", 7) == 0) {
+            char *end;
+            config->jobs = strtoul(arg + 7, &end, 10);
+            ok = end != arg + 7 && *end == '\0';
+            if (ok && config->jobs == 0) {
+                long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+                config->jobs = cpus > 0 ? (size_t)cpus : 1;
+            }
+        } else {
+            fprintf(stderr, "error: unknown option '%s'\n", arg);
+            ok = false;
+        }
+        if (!ok) {
+            return false;
+        }
+    }
+
+    // NOTE: dependencies are pulled in rather than rejected: matrices are
+    // made of vectors, quaternions convert to and from `vec3`, `vec4`, `mat3`
+    // and `mat4`, the SoA kernels convert from vectors and use matrices,
+    // non-square matrices multiply with square ones, and the storage types
+    // convert to and from single precision. Quaternions are on by default,
+    // so they only pull in their dependencies when asked for with
+    // `--groups`; otherwise they are dropped when these are not selected.
+    if (config->types[HALF_T]) {
+        config->types[FLOAT_T] = true;
+    }
+    bool quat_types = config->types[FLOAT_T] || config->types[DOUBLE_T];
+    if (config->groups[GROUP_QUAT] && groups_selected) {
+        config->dims[3] = config->dims[4] = true;
+        config->groups[GROUP_MAT] = true;
+        config->types[FLOAT_T] |= !quat_types;
+    } else if (!config->dims[3] || !config->dims[4] || !quat_types) {
+        config->groups[GROUP_QUAT] = false;
+    }
+    if (config->groups[GROUP_SOA] || config->groups[GROUP_RECT]) {
+        config->groups[GROUP_MAT] = true;
+    }
+    if (config->groups[GROUP_MAT]) {
+        config->groups[GROUP_VEC] = true;
+    }
+    return true;
+}
+
+bool config_has(const generator_config_s *config, size_t dim, type_s type,
+                group_s group) {
+    return config->dims[dim] && config->types[type] && config->groups[group];
+}
+
+// Whether `matRxC<t>_t` is generated (square matrices included).
+bool config_has_shape(const generator_config_s *config, size_t rows,
+                      size_t cols, type_s type) {
+    return !is_storage_type(type) &&
+           config_has(config, rows, type, GROUP_MAT) &&
+           config_has(config, cols, type, GROUP_MAT) &&
+           (rows == cols || config->groups[GROUP_RECT]);
+}
+
+// The benchmark program, for the functions of a header generated with the same
+// `config`.
+void generate_bench(FILE *restrict stream, const generator_config_s *config) {
+    fprintf(stream,
+            "// Generated by `generate_linalg --bench`. Do not edit.\n");
+    fprintf(stream, "#include \"bench.h\"\n");
+    fprintf(stream, "#define LINALG_IMPLEMENTATION\n");
+    fprintf(stream, "#include \"linalg.h\"\n");
+    EMPTY_LINE(stream);
+    fprintf(stream, "#define BENCH_BATCH %d\n", BENCH_BATCH);
+    EMPTY_LINE(stream);
+    // A (non-static) variable rather than the constant, so that the array
+    // functions see a count only known at run time, like in real usage.
+    fprintf(stream, "size_t bench_batch = BENCH_BATCH;\n");
+    EMPTY_LINE(stream);
+    for (size_t dim = MIN_DIM; dim <= MAX_DIM; ++dim) {
+        for (size_t type = 0; type < NUM_TYPES; ++type) {
+            if (!config_has(config, dim, type, GROUP_VEC)) {
+                continue;
+            }
+            if (is_storage_type(type)) {
+                generate_bench_half_cases(
+                    stream, dim, config_has(config, dim, FLOAT_T, GROUP_MAT));
+                continue;
+            }
+            bool mat = config_has(config, dim, type, GROUP_MAT);
+            bool soa = config_has(config, dim, type, GROUP_SOA);
+            generate_bench_data(stream, dim, type, mat, soa);
+            generate_bench_vec_cases(stream, dim, type);
+            if (mat) {
+                generate_bench_mat_cases(stream, dim, type);
+            }
+            if (soa) {
+                generate_bench_soa_cases(stream, dim, type);
+            }
+        }
+    }
+    // NOTE: after the loop above, since the data of `matN+1<t>` is needed.
+    for (size_t dim = MIN_DIM; dim < MAX_DIM; ++dim) {
+        for (size_t type = 0; type < NUM_TYPES; ++type) {
+            if (config_has_shape(config, dim, dim + 1, type)) {
+                generate_bench_affine_cases(stream, dim, type);
+            }
+        }
+    }
+    for (size_t type = 0; type < NUM_TYPES; ++type) {
+        if (config_has(config, 4, type, GROUP_QUAT)) {
+            generate_bench_quat_cases(stream, type);
+        }
+    }
+
+    fprintf(stream, "static const bench_case_t benches[] = {\n");
+    for (size_t i = 0; i < num_bench_cases; ++i) {
+        bench_case_s bench = bench_cases[i];
+        fprintf(stream,
+                INDENT "{\"%s\", \"%s\", %zu, \"%s\", BENCH_BATCH, "
+                       "bench_%s},\n",
+                bench.group, bench.function, bench.dim,
+                type_definitions[bench.type].keyword, bench.function);
+    }
+    fprintf(stream, "};\n");
+    EMPTY_LINE(stream);
+    fprintf(stream, "// Usage: linalg_bench [function name filter]\n");
+    fprintf(stream, "int main(int argc, char **argv) {\n");
+    for (size_t dim = MIN_DIM; dim <= MAX_DIM; ++dim) {
+        for (size_t type = 0; type < NUM_TYPES; ++type) {
+            if (config_has(config, dim, type, GROUP_VEC)) {
+                fprintf(stream, INDENT "bench_%s_init();\n",
+                        vec_prefix_name(dim, type));
+            }
+        }
+    }
+    for (size_t dim = MIN_DIM; dim < MAX_DIM; ++dim) {
+        for (size_t type = 0; type < NUM_TYPES; ++type) {
+            if (config_has_shape(config, dim, dim + 1, type)) {
+                fprintf(stream, INDENT "bench_%s_init();\n",
+                        mat_shape_prefix(dim, dim + 1, type));
+            }
+        }
+    }
+    for (size_t type = 0; type < NUM_TYPES; ++type) {
+        if (config_has(config, 4, type, GROUP_QUAT) &&
+            has_quat_variant(type)) {
+            fprintf(stream, INDENT "bench_%s_init();\n",
+                    quat_prefix_name(type));
+        }
+    }
+    fprintf(stream, INDENT "const char *filter = argc > 1 ? argv[1] : NULL;\n");
+    fprintf(stream, INDENT "bench_run(benches, sizeof(benches) / "
+                           "sizeof(benches[0]), filter, stdout);\n");
+    fprintf(stream, INDENT "return 0;\n");
+    fprintf(stream, "}\n");
+}
+
+// Functions of the non-square matrices with `rows` rows, and the products of
+// `mat<rows><t>_t` by non-square matrices.
+void generate_mat_rect_functions(FILE *restrict stream,
+                                 const generator_config_s *config, size_t rows,
+                                 type_s type) {
+    for (size_t cols = MIN_DIM; cols <= MAX_DIM; ++cols) {
+        if (cols == rows || !config_has_shape(config, rows, cols, type)) {
+            continue;
+        }
+        generate_mat_rect_constructors(stream, rows, cols, type);
+        generate_mat_rect_mul_by_vec(stream, rows, cols, type);
+        generate_mat_rect_transpose(stream, rows, cols, type);
+        if (cols == rows + 1) {
+            generate_mat_affine(stream, rows, type);
+        }
+    }
+    for (size_t inner = MIN_DIM; inner <= MAX_DIM; ++inner) {
+        for (size_t cols = MIN_DIM; cols <= MAX_DIM; ++cols) {
+            if ((rows == inner && inner == cols) ||
+                !config_has_shape(config, rows, inner, type) ||
+                !config_has_shape(config, inner, cols, type)) {
+                continue;
+            }
+            generate_mat_rect_mul(stream, rows, inner, cols, type);
+        }
+    }
+}
+
+// `#define LINALG_HAS_<PREFIX>` (e.g. `LINALG_HAS_VEC3F_SOA`), so that the
+// modules built on the generated types only instantiate their functions for
+// the types of a restricted library.
+void generate_has_macro(FILE *restrict stream, const char *prefix) {
+    fprintf(stream, "#define LINALG_HAS_");
+    for (const char *c = prefix; *c != '\0'; ++c) {
+        fputc(toupper((unsigned char)*c), stream);
+    }
+    fprintf(stream, "\n");
+}
+
+void generate_definitions(FILE *restrict stream,
+                          const generator_config_s *config) {
+    if (config->types[HALF_T]) {
+        generate_half_definition(stream);
+    }
+    for (size_t dim = MIN_DIM; dim <= MAX_DIM; ++dim) {
+        for (size_t type = 0; type < NUM_TYPES; ++type) {
+            if (config_has(config, dim, type, GROUP_VEC)) {
+                generate_vec_definition(stream, dim, type);
+            }
+            if (is_storage_type(type)) {
+                continue;
+            }
+            if (config_has(config, dim, type, GROUP_MAT)) {
+                generate_mat_definition(stream, dim, type);
+            }
+            if (config_has(config, dim, type, GROUP_SOA)) {
+                generate_vec_soa_definition(stream, dim, type);
+            }
+        }
+    }
+    // After all the vectors, which are their rows.
+    for (size_t rows = MIN_DIM; rows <= MAX_DIM; ++rows) {
+        for (size_t cols = MIN_DIM; cols <= MAX_DIM; ++cols) {
+            for (size_t type = 0; type < NUM_TYPES; ++type) {
+                if (rows != cols &&
+                    config_has_shape(config, rows, cols, type)) {
+                    generate_mat_rect_definition(stream, rows, cols, type);
+                }
+            }
+        }
+    }
+    for (size_t type = 0; type < NUM_TYPES; ++type) {
+        if (config_has(config, 4, type, GROUP_QUAT)) {
+            generate_quat_definition(stream, type);
+        }
+    }
+
+    fprintf(stream, "// Types of this header, for the modules built on it.\n");
+    for (size_t dim = MIN_DIM; dim <= MAX_DIM; ++dim) {
+        for (size_t type = 0; type < NUM_TYPES; ++type) {
+            if (config_has(config, dim, type, GROUP_VEC)) {
+                generate_has_macro(stream, vec_prefix_name(dim, type));
+            }
+            if (is_storage_type(type)) {
+                continue;
+            }
+            if (config_has(config, dim, type, GROUP_MAT)) {
+                generate_has_macro(stream, mat_prefix_name(dim, type));
+            }
+            if (config_has(config, dim, type, GROUP_SOA)) {
+                generate_has_macro(stream, vec_soa_prefix_name(dim, type));
+            }
+        }
+    }
+    for (size_t type = 0; type < NUM_TYPES; ++type) {
+        if (config_has(config, 4, type, GROUP_QUAT) &&
+            has_quat_variant(type)) {
+            generate_has_macro(stream, quat_prefix_name(type));
+        }
+    }
+    EMPTY_LINE(stream);
+}
+
+/* The functions are generated in units: one group of functions for one
+ * dimension and type, in the order of the header. Units are independent, so
+ * `--jobs` renders them on several threads, each into its own buffer, and
+ * the buffers are concatenated in order: the output does not depend on the
+ * number of threads.
+ */
+
+typedef enum {
+    UNIT_CONSTRUCTORS = 0,
+    UNIT_FUNCTIONS,
+    UNIT_MAT_RECT, // Non-square matrices, by number of rows.
+    UNIT_QUAT,
+    UNIT_SOA,
+    UNIT_HALF, // The only unit of storage types.
+    NUM_UNIT_KINDS,
+} unit_kind_s;
+
+#define MAX_UNITS (NUM_UNIT_KINDS * (MAX_DIM + 1) * NUM_TYPES)
+
+typedef struct {
+    unit_kind_s kind;
+    size_t dim; // 4 for quaternions.
+    type_s type;
+    char *text; // Rendered by `render_units()`.
+    size_t size;
+} unit_s;
+
+// Lists the units of `config` in output order.
+size_t list_units(const generator_config_s *config, unit_s *units) {
+    static const group_s unit_groups[NUM_UNIT_KINDS] = {
+        [UNIT_CONSTRUCTORS] = GROUP_VEC,
+        [UNIT_FUNCTIONS] = GROUP_VEC,
+        [UNIT_MAT_RECT] = GROUP_RECT,
+        [UNIT_QUAT] = GROUP_QUAT,
+        [UNIT_SOA] = GROUP_SOA,
+        [UNIT_HALF] = GROUP_VEC,
+    };
+    size_t num_units = 0;
+    for (unit_kind_s kind = 0; kind < NUM_UNIT_KINDS; ++kind) {
+        size_t min_dim = kind == UNIT_QUAT ? 4 : MIN_DIM;
+        for (size_t dim = min_dim; dim <= MAX_DIM; ++dim) {
+            for (size_t type = 0; type < NUM_TYPES; ++type) {
+                if (is_storage_type(type) != (kind == UNIT_HALF)) {
+                    continue;
+                }
+                if (config_has(config, dim, type, unit_groups[kind])) {
+                    units[num_units++] =
+                        (unit_s){.kind = kind, .dim = dim, .type = type};
+                }
+            }
+        }
+    }
+    return num_units;
+}
+
+void generate_unit(FILE *restrict stream, const generator_config_s *config,
+                   const unit_s *unit) {
+    size_t dim = unit->dim;
+    type_s type = unit->type;
+    switch (unit->kind) {
+    case UNIT_CONSTRUCTORS:
+        generate_vec_constructor(stream, dim, type);
+        generate_vec_scalar_constructor(stream, dim, type);
+        if (!config_has(config, dim, type, GROUP_MAT)) {
+            break;
+        }
+        // NOTE: there are no matrix constructor with specified values
+        // generated, because the number of possible ways to specify the
+        // parameters is too high.
+        generate_mat_zero_constructor(stream, dim, type);
+        generate_mat_identity_constructor(stream, dim, type);
+        generate_mat_scalar_constructor(stream, dim, type);
+        generate_mat_diag_constructor(stream, dim, type);
+        generate_mat_rotation_constructor(stream, dim, type, false);
+        generate_mat_rotation_constructor(stream, dim, type, true);
+        generate_mat_transform_constructor(stream, dim, type, false);
+        generate_mat_transform_constructor(stream, dim, type, true);
+        break;
+    case UNIT_FUNCTIONS:
+        for (size_t op = 0; op < NUM_OPS; ++op) {
+            generate_vec_operation(stream, dim, type, op);
+            generate_vec_operation_to(stream, dim, type, op);
+            generate_vec_operation_assign(stream, dim, type, op);
+        }
+        for (size_t fn = 0; fn < ARRAY_LEN(fn_definitions); ++fn) {
+            generate_vec_function(stream, dim, type, fn);
+            generate_vec_function_to(stream, dim, type, fn);
+        }
+        for (variadic_op_s variadic_op = 0; variadic_op < NUM_VARIADIC_OPS;
+             ++variadic_op) {
+            generate_vec_variadic_operation(stream, dim, type, variadic_op);
+            generate_vec_array_operation(stream, dim, type, variadic_op);
+        }
+        generate_vec_dot(stream, dim, type);
+        generate_vec_cross(stream, dim, type);
+        generate_vec_sqrlen(stream, dim, type);
+        generate_vec_1norm(stream, dim, type);
+        generate_vec_2norm(stream, dim, type);
+        generate_vec_unit(stream, dim, type);
+        generate_vec_unit_fast(stream, dim, type);
+        generate_vec_eq(stream, dim, type);
+        generate_vec_reflect(stream, dim, type);
+        generate_vec_direction(stream, dim, type);
+        generate_vec_angle_between(stream, dim, type);
+        generate_vec_angle_between_fast(stream, dim, type);
+        if (!config_has(config, dim, type, GROUP_MAT)) {
+            break;
+        }
+        generate_mat_mul(stream, dim, type);
+        generate_mat_mul_to(stream, dim, type);
+        generate_mat_variadic_mul(stream, dim, type);
+        generate_mat_mul_chain(stream, dim, type);
+        generate_mat_mul_by_vec(stream, dim, type);
+        generate_mat_mul_by_vec_to(stream, dim, type);
+        generate_mat_hadamard(stream, dim, type);
+        generate_mat_hadamard_to(stream, dim, type);
+        for (rotate_form_s form = ROTATE_VALUE; form <= ROTATE_ASSIGN;
+             ++form) {
+            generate_mat_rotate(stream, dim, type, false, form);
+            generate_mat_rotate(stream, dim, type, true, form);
+        }
+        generate_mat_transform_array(stream, dim, type);
+        generate_mat_transpose(stream, dim, type);
+        generate_mat_det(stream, dim, type);
+        generate_mat_inverse(stream, dim, type);
+        generate_mat_inverse_affine(stream, dim, type);
+        generate_mat_inverse_array(stream, dim, type, "inverse");
+        generate_mat_inverse_array(stream, dim, type, "inverse_affine");
+        break;
+    case UNIT_MAT_RECT:
+        generate_mat_rect_functions(stream, config, dim, type);
+        break;
+    case UNIT_QUAT:
+        generate_quat_constructors(stream, type);
+        generate_quat_mul(stream, type);
+        generate_quat_conjugate(stream, type);
+        generate_quat_normalize(stream, type);
+        generate_quat_interpolation(stream, type);
+        generate_quat_rotate_vec(stream, type);
+        generate_quat_mat_conversions(stream, type);
+        break;
+    case UNIT_SOA:
+        // Structure-of-arrays batch kernels.
+        generate_vec_soa_conversions(stream, dim, type);
+        for (size_t op = 0; op < NUM_OPS; ++op) {
+            generate_vec_soa_operation(stream, dim, type, op);
+        }
+        for (size_t fn = 0; fn < ARRAY_LEN(fn_definitions); ++fn) {
+            generate_vec_soa_function(stream, dim, type, fn);
+        }
+        generate_vec_soa_dot(stream, dim, type);
+        generate_vec_soa_2norm(stream, dim, type);
+        generate_vec_soa_unit(stream, dim, type);
+        generate_mat_mul_by_vec_soa(stream, dim, type);
+        break;
+    case UNIT_HALF:
+        generate_half_conversions(stream, dim);
+        // NOTE: the single precision functions are a dependency of the
+        // storage types (see `parse_config()`).
+        if (config->groups[GROUP_MAT]) {
+            generate_mat_transform_array_half(stream, dim);
+        }
+        break;
+    default:
+        assert(false && "Unknown unit kind.");
+    }
+}
+
+typedef struct {
+    const generator_config_s *config;
+    unit_s *units;
+} render_context_s;
+
+// Renders units [begin, end) into memory (a `thread_pool_fn_t`).
+void render_units(void *ctx, size_t begin, size_t end,
+                  varia_arena_t *scratch) {
+    (void)scratch;
+    render_context_s *context = ctx;
+    for (size_t i = begin; i < end; ++i) {
+        unit_s *unit = &context->units[i];
+        FILE *stream = open_memstream(&unit->text, &unit->size);
+        generate_unit(stream, context->config, unit);
+        fclose(stream);
+    }
+}
+
+// Time spent in each step, for the report printed by `main()`.
+typedef struct {
+    double render_ms;
+    double sections_ms;
+    double write_ms;
+    size_t num_units;
+    size_t output_bytes;
+} generator_stats_s;
+
+static generator_stats_s generator_stats = {0};
+
+double now_ms(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)now.tv_sec * 1e3 + (double)now.tv_nsec * 1e-6;
+}
+
+// Returns the definitions of all the functions of `config` (to be freed).
+char *render_functions(const generator_config_s *config) {
+    double start = now_ms();
+    unit_s units[MAX_UNITS];
+    size_t num_units = list_units(config, units);
+    render_context_s context = {.config = config, .units = units};
+    thread_pool_t pool;
+    if (config->jobs > 1 && thread_pool_init(&pool, config->jobs)) {
+        thread_pool_parallel_for(&pool, num_units, 1, render_units, &context);
+        thread_pool_free(&pool);
+    } else {
+        render_units(&context, 0, num_units, NULL);
+    }
+
+    size_t size = 0;
+    for (size_t i = 0; i < num_units; ++i) {
+        size += units[i].size;
+    }
+    char *text = malloc(size + 1);
+    assert(text != NULL && "Out of memory for the functions.");
+    char *end = text;
+    for (size_t i = 0; i < num_units; ++i) {
+        memcpy(end, units[i].text, units[i].size);
+        end += units[i].size;
+        free(units[i].text);
+    }
+    *end = '\0';
+    generator_stats.render_ms += now_ms() - start;
+    generator_stats.num_units += num_units;
+    return text;
+}
+
+/* The functions are generated as definitions, then sorted into the two
+ * sections of the header: small functions (no loop, no recursion, no variadic
+ * arguments, at most INLINE_MAX_LINES lines) are emitted as `LINALG_INLINE`
+ * definitions with the declarations, the others as a prototype there and a
+ * definition in the `LINALG_IMPLEMENTATION` section.
+ */
+
+#define INLINE_MAX_LINES 24
+
+typedef enum {
+    SECTION_DECLARATIONS = 0,
+    SECTION_IMPLEMENTATION,
+    NUM_SECTIONS,
+} section_s;
+
+typedef struct {
+    FILE *stream;
+    const char *pending_if; // Opened conditional not written yet.
+    bool in_if;
+    bool dropped_if;      // The empty line following it is dropped too.
+    bool after_prototype; // Prototypes are not separated by empty lines.
+} section_state_s;
+
+// Whether `needle` occurs in [start, end).
+bool contains(const char *start, const char *end, const char *needle) {
+    size_t size = strlen(needle);
+    for (const char *c = start; c + size <= end; ++c) {
+        // Jump to the next candidate first byte (vectorized by the libc).
+        c = memchr(c, needle[0], (size_t)(end - c) - size + 1);
+        if (c == NULL) {
+            return false;
+        }
+        if (memcmp(c, needle, size) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool is_inline_function(const char *start, const char *end) {
+    const char *body = strchr(start, '\n');
+    if (contains(start, body, "...") || contains(body, end, "for (") ||
+        contains(body, end, "while (")) {
+        return false;
+    }
+    // Recursive functions cannot be forced inline.
+    const char *name_end = strchr(start, '(');
+    const char *name = name_end;
+    while (name[-1] != ' ' && name[-1] != '*') {
+        --name;
+    }
+    const char *call =
+        varia_temp_sprintf("%.*s(", (int)(name_end - name), name);
+    if (contains(body, end, call)) {
+        return false;
+    }
+    size_t lines = 0;
+    for (const char *c = start; c < end; ++c) {
+        lines += *c == '\n';
+    }
+    return lines <= INLINE_MAX_LINES;
+}
+
+void section_write(section_state_s *section, const char *text, size_t size,
+                   bool prototype) {
+    if (section->after_prototype && !prototype) {
+        EMPTY_LINE(section->stream);
+    }
+    if (section->pending_if != NULL) {
+        fprintf(section->stream, "%s", section->pending_if);
+        section->pending_if = NULL;
+        section->in_if = true;
+    }
+    fwrite(text, 1, size, section->stream);
+    section->dropped_if = false;
+    section->after_prototype = prototype;
+}
+
+// Sorts the functions of `text` (as generated by `render_functions()`) into
+// the declarations and implementation sections.
+void split_sections(const char *text, FILE *declarations,
+                    FILE *implementation) {
+    section_state_s sections[NUM_SECTIONS] = {
+        [SECTION_DECLARATIONS] = {.stream = declarations},
+        [SECTION_IMPLEMENTATION] = {.stream = implementation},
+    };
+    section_state_s *decls = &sections[SECTION_DECLARATIONS];
+    section_state_s *impls = &sections[SECTION_IMPLEMENTATION];
+    const char *const def = "LINALG_DEF ";
+    const char *const inline_def = "LINALG_INLINE ";
+    const char *line = text;
+    while (*line != '\0') {
+        const char *line_end = strchr(line, '\n');
+        size_t line_size = (size_t)(line_end - line) + 1;
+        if (strncmp(line, def, strlen(def)) == 0) {
+            const char *end = strstr(line, "\n}\n") + 3;
+            if (*end == '\n') {
+                ++end; // Include the empty line following the function.
+            }
+            if (is_inline_function(line, end)) {
+                const char *signature = line + strlen(def);
+                char *function = varia_temp_sprintf(
+                    "%s%.*s", inline_def, (int)(end - signature), signature);
+                section_write(decls, function, strlen(function), false);
+            } else {
+                // `LINALG_DEF <signature> {` becomes the prototype.
+                char *prototype = varia_temp_sprintf(
+                    "%.*s;\n", (int)(line_size - 3), line);
+                section_write(decls, prototype, strlen(prototype), true);
+                section_write(impls, line, (size_t)(end - line), false);
+            }
+            line = end;
+            continue;
+        }
+        if (strncmp(line, "#if", 3) == 0) {
+            const char *directive =
+                varia_temp_sprintf("%.*s", (int)line_size, line);
+            for (size_t s = 0; s < NUM_SECTIONS; ++s) {
+                assert(!sections[s].in_if && sections[s].pending_if == NULL);
+                sections[s].pending_if = directive;
+            }
+        } else if (strncmp(line, "#endif", 6) == 0) {
+            // Conditionals left empty in a section are dropped.
+            for (size_t s = 0; s < NUM_SECTIONS; ++s) {
+                if (sections[s].in_if) {
+                    fwrite(line, 1, line_size, sections[s].stream);
+                }
+                sections[s].dropped_if = !sections[s].in_if;
+                sections[s].pending_if = NULL;
+                sections[s].in_if = false;
+            }
+        } else {
+            for (size_t s = 0; s < NUM_SECTIONS; ++s) {
+                if (line_size == 1 && sections[s].dropped_if) {
+                    sections[s].dropped_if = false;
+                    continue;
+                }
+                section_write(&sections[s], line, line_size, false);
+            }
+        }
+        line += line_size;
+    }
+    if (decls->after_prototype) {
+        EMPTY_LINE(decls->stream);
+    }
+}
+
+/* Type-generic front end: `la_<name>(...)` is a `_Generic` selection on the
+ * type of its first argument, so it resolves to the function of the right
+ * dimension and scalar type at compile time, without any runtime dispatch.
+ * Matrix products also select on the second argument (a vector, or a matrix
+ * of any compatible shape), and `la_transform` of a `matNx(N+1)<t>_t` is the
+ * affine batch transform of `vecN<t>_t` points.
+ */
+
+typedef struct {
+    const char *name; // `la_<name>`.
+    const char *params;
+    const char *selector; // Controlling expression (NULL: the first param).
+    // Suffixes of the selected functions (NULL: type not accepted).
+    const char *vec_fn;
+    const char *mat_fn;
+    const char *rect_fn;    // Non-square matrices.
+    const char *affine_fn;  // Affine shapes (instead of `rect_fn`).
+    const char *mat_vec_fn; // Instead of `mat_fn` when `b` is not a matrix.
+    const char *quat_fn;
+    size_t max_vec_dim; // 0: all dimensions.
+    bool floating_only;
+} generic_definition_s;
+
+static const generic_definition_s generic_definitions[] = {
+    {.name = "add", .params = "a, b", .vec_fn = "add"},
+    {.name = "sub", .params = "a, b", .vec_fn = "sub"},
+    // Component-wise for vectors, and the product of any matrix by a matrix
+    // or vector of matching shape.
+    {.name = "mul",
+     .params = "a, b",
+     .vec_fn = "mul",
+     .mat_fn = "mul",
+     .rect_fn = "mul",
+     .mat_vec_fn = "mul_vec",
+     .quat_fn = "mul"},
+    {.name = "div", .params = "a, b", .vec_fn = "div"},
+    {.name = "dot", .params = "a, b", .vec_fn = "dot"},
+    {.name = "cross", .params = "a, b", .vec_fn = "cross", .max_vec_dim = 3},
+    {.name = "length", .params = "v", .vec_fn = "2norm", .floating_only = true},
+    {.name = "unit", .params = "v", .vec_fn = "unit", .floating_only = true},
+    {.name = "transpose",
+     .params = "M",
+     .mat_fn = "transpose",
+     .rect_fn = "transpose"},
+    {.name = "inverse",
+     .params = "M",
+     .mat_fn = "inverse",
+     .quat_fn = "inverse",
+     .floating_only = true},
+    {.name = "transform",
+     .params = "M, in, out, n",
+     .selector = "*(M)",
+     .mat_fn = "transform_array",
+     .affine_fn = "transform_affine_array"},
+};
+
+// Writes a line of a multi-line macro, with the backslash in the last column.
+void generate_macro_line(FILE *restrict stream, const char *line) {
+    fprintf(stream, "%-79s\\\n", varia_temp_sprintf("%s ", line));
+}
+
+// `matRxC<t>_t: <function>` (a line per association, for the products).
+const char *generic_mat_association(const generator_config_s *config,
+                                    const generic_definition_s *definition,
+                                    size_t rows, size_t cols, type_s type,
+                                    const char *suffix) {
+    const char *mat = mat_shape_prefix(rows, cols, type);
+    if (definition->mat_vec_fn == NULL) {
+        return varia_temp_sprintf("%s_t: %s_%s", mat, mat, suffix);
+    }
+    // Nested selection on the second operand: the matrices with `cols`
+    // rows, or else a vector.
+    const char *products[MAX_DIM + 1];
+    size_t num_products = 0;
+    for (size_t other = MIN_DIM; other <= MAX_DIM; ++other) {
+        if (config_has_shape(config, cols, other, type)) {
+            products[num_products++] = varia_temp_sprintf(
+                "%s_t: %s", mat_shape_prefix(cols, other, type),
+                mat_product_name(rows, cols, other, type));
+        }
+    }
+    const char *default_fn =
+        varia_temp_sprintf("default: %s_%s", mat, definition->mat_vec_fn);
+    if (num_products == 1) {
+        return varia_temp_sprintf("%s_t: _Generic((b), %s, %s)", mat,
+                                  products[0], default_fn);
+    }
+    const char *association =
+        varia_temp_sprintf("%s_t: _Generic((b),", mat);
+    for (size_t i = 0; i < num_products; ++i) {
+        association = varia_temp_sprintf("%s\n" INDENT "%s,", association,
+                                         products[i]);
+    }
+    return varia_temp_sprintf("%s\n" INDENT "%s)", association, default_fn);
+}
+
+void generate_generic(FILE *restrict stream, const generator_config_s *config,
+                      const generic_definition_s *definition) {
+    // Vectors, matrices of every shape, and quaternions.
+    const char *associations[(MAX_DIM + 1) * (MAX_DIM + 2) * NUM_TYPES];
+    size_t num_associations = 0;
+    for (size_t dim = MIN_DIM; dim <= MAX_DIM; ++dim) {
+        for (type_s type = 0; type < NUM_TYPES; ++type) {
+            if (!config_has(config, dim, type, GROUP_VEC) ||
+                is_storage_type(type) || definition->vec_fn == NULL ||
+                (definition->floating_only && !is_floating_type(type)) ||
+                (definition->max_vec_dim != 0 &&
+                 dim > definition->max_vec_dim)) {
+                continue;
+            }
+            associations[num_associations++] = varia_temp_sprintf(
+                "%s: %s", vec_type_name(dim, type),
+                vec_fn_name(dim, type, definition->vec_fn));
+        }
+    }
+    for (size_t rows = MIN_DIM; rows <= MAX_DIM; ++rows) {
+        for (size_t cols = MIN_DIM; cols <= MAX_DIM; ++cols) {
+            for (type_s type = 0; type < NUM_TYPES; ++type) {
+                const char *suffix = definition->rect_fn;
+                if (rows == cols) {
+                    suffix = definition->mat_fn;
+                } else if (cols == rows + 1 && definition->affine_fn) {
+                    suffix = definition->affine_fn;
+                }
+                if (suffix == NULL ||
+                    !config_has_shape(config, rows, cols, type) ||
+                    (definition->floating_only && !is_floating_type(type))) {
+                    continue;
+                }
+                associations[num_associations++] = generic_mat_association(
+                    config, definition, rows, cols, type, suffix);
+            }
+        }
+    }
+    for (type_s type = 0; type < NUM_TYPES; ++type) {
+        if (!config_has(config, 4, type, GROUP_QUAT) ||
+            !has_quat_variant(type) || definition->quat_fn == NULL) {
+            continue;
+        }
+        const char *quat = quat_prefix_name(type);
+        associations[num_associations++] = varia_temp_sprintf(
+            "%s_t: %s_%s", quat, quat, definition->quat_fn);
+    }
+    if (num_associations == 0) {
+        return;
+    }
+
+    const char *params = definition->params;
+    const char *selector = definition->selector;
+    if (selector == NULL) {
+        selector = varia_temp_sprintf("(%.*s)", (int)strcspn(params, ","),
+                                      params);
+    }
+    generate_macro_line(stream, varia_temp_sprintf("#define la_%s(%s)",
+                                                   definition->name, params));
+    generate_macro_line(stream,
+                        varia_temp_sprintf(INDENT "_Generic(%s,", selector));
+    for (size_t i = 0; i < num_associations; ++i) {
+        // Associations spanning several lines are split on '\n'.
+        const char *line = associations[i];
+        for (;;) {
+            size_t length = strcspn(line, "\n");
+            const char *text = varia_temp_sprintf(INDENT INDENT "%.*s",
+                                                  (int)length, line);
+            if (line[length] == '\n') {
+                generate_macro_line(stream, text);
+                line += length + 1;
+            } else if (i + 1 < num_associations) {
+                generate_macro_line(stream,
+                                    varia_temp_sprintf("%s,", text));
+                break;
+            } else {
+                fprintf(stream, "%s)(%s)\n", text, params);
+                break;
+            }
+        }
+    }
+}
+
+void generate_generics(FILE *restrict stream,
+                       const generator_config_s *config) {
+    fprintf(stream,
+            "/* Type-generic front end, resolved at compile time from the "
+            "type of the first\n"
+            " * argument:\n"
+            " *\n"
+            " *     typedef vec3f_t vec_t; // Or vec3d_t: the calls below "
+            "follow.\n"
+            " *     vec_t n = la_unit(la_cross(la_sub(b, a), la_sub(c, a)));\n"
+            " *     la_transform(&M, in, out, count);\n"
+            " *\n"
+            " * `la_mul` is component-wise for vectors, and the matrix "
+            "(or quaternion)\n"
+            " * product otherwise: `la_mul(M, v)` is `matN<t>_mul_vec`.\n"
+            " */\n");
+    for (size_t i = 0; i < ARRAY_LEN(generic_definitions); ++i) {
+        generate_generic(stream, config, &generic_definitions[i]);
+        EMPTY_LINE(stream);
+    }
+}
+
+void generate_function_sections(FILE *restrict stream,
+                                 const generator_config_s *config) {
+    char *text = render_functions(config);
+    double start = now_ms();
+    char *implementation = NULL;
+    size_t implementation_size = 0;
+    FILE *implementation_stream =
+        open_memstream(&implementation, &implementation_size);
+    split_sections(text, stream, implementation_stream);
+    fclose(implementation_stream);
+    free(text);
+    generator_stats.sections_ms += now_ms() - start;
+
+    fprintf(stream, "#ifdef LINALG_IMPLEMENTATION\n");
+    EMPTY_LINE(stream);
+    fwrite(implementation, 1, implementation_size, stream);
+    fprintf(stream, "#endif // LINALG_IMPLEMENTATION\n");
+    EMPTY_LINE(stream);
+    free(implementation);
+}
+
+// Writes `size` bytes to `fd`, whatever the number of write() calls it takes.
+bool write_all(int fd, const char *data, size_t size) {
+    while (size > 0) {
+        ssize_t written = write(fd, data, size);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        data += written;
+        size -= (size_t)written;
+    }
+    return true;
+}
+
+// Output file rendered in memory, then written at once by `output_close()`.
+typedef struct {
+    const char *path;
+    char *data;
+    size_t size;
+    FILE *stream;
+} output_s;
+
+FILE *output_open(output_s *output, const char *dir, const char *name) {
+    *output = (output_s){.path = varia_temp_sprintf("%s/%s", dir, name)};
+    output->stream = open_memstream(&output->data, &output->size);
+    return output->stream;
+}
+
+bool output_close(output_s *output) {
+    fclose(output->stream);
+    double start = now_ms();
+    FILE *file = fopen(output->path, "w");
+    bool written = file != NULL && write_all(fileno(file), output->data,
+                                             output->size);
+    if (file != NULL) {
+        written = fclose(file) == 0 && written;
+    }
+    if (!written) {
+        fprintf(stderr, "error: could not write '%s'\n", output->path);
+    }
+    generator_stats.write_ms += now_ms() - start;
+    generator_stats.output_bytes += output->size;
+    free(output->data);
+    return written;
+}
+
+/* Split layout: `linalg_types.h` holds the common head and the type
+ * definitions, `linalg_<t>.h` the functions of one scalar type, and `linalg.h`
+ * includes all of them. A translation unit only working with floats includes
+ * `linalg_f.h` and does not parse the rest of the library.
+ *
+ * NOTE: like `linalg.h`, the headers include `src/maths.h`, so the repository
+ * root must be in the include path.
+ */
+bool generate_split(const generator_config_s *config) {
+    output_s types_output;
+    FILE *types_stream =
+        output_open(&types_output, config->split_dir, "linalg_types.h");
+    fprintf(types_stream, "#ifndef LINALG_TYPES_H\n");
+    fprintf(types_stream, "#define LINALG_TYPES_H\n");
+    EMPTY_LINE(types_stream);
+    generate_head(types_stream);
+    generate_definitions(types_stream, config);
+    fprintf(types_stream, "#endif // LINALG_TYPES_H\n");
+    if (!output_close(&types_output)) {
+        return false;
+    }
+
+    output_s umbrella_output;
+    FILE *umbrella =
+        output_open(&umbrella_output, config->split_dir, "linalg.h");
+    fprintf(umbrella, "#ifndef LINALG_H\n");
+    fprintf(umbrella, "#define LINALG_H\n");
+    EMPTY_LINE(umbrella);
+    bool ok = true;
+    for (size_t type = 0; type < NUM_TYPES && ok; ++type) {
+        if (!config->types[type]) {
+            continue;
+        }
+        const char *suffix = type_definitions[type].suffix;
+        const char *name = varia_temp_sprintf("linalg_%s.h", suffix);
+        fprintf(umbrella, "#include \"%s\"\n", name);
+
+        output_s output;
+        FILE *stream = output_open(&output, config->split_dir, name);
+        generator_config_s type_config = *config;
+        for (size_t other = 0; other < NUM_TYPES; ++other) {
+            type_config.types[other] = other == type;
+        }
+        fprintf(stream, "#ifndef LINALG_%c_H\n", suffix[0] - 'a' + 'A');
+        fprintf(stream, "#define LINALG_%c_H\n", suffix[0] - 'a' + 'A');
+        EMPTY_LINE(stream);
+        fprintf(stream, "#include \"linalg_types.h\"\n");
+        if (is_storage_type(type)) {
+            fprintf(stream, "#include \"linalg_%s.h\"\n",
+                    type_definitions[FLOAT_T].suffix);
+        }
+        EMPTY_LINE(stream);
+        generate_function_sections(stream, &type_config);
+        fprintf(stream, "#endif // LINALG_%c_H\n", suffix[0] - 'a' + 'A');
+        ok = output_close(&output);
+    }
+    EMPTY_LINE(umbrella);
+    generate_generics(umbrella, config);
+    fprintf(umbrella, "#endif // LINALG_H\n");
+    return output_close(&umbrella_output) && ok;
+}
+
+int main(int argc, char **argv) {
+    if (argc > 1 && strcmp(argv[1], "--help") == 0) {
+        usage(stdout, argv[0]);
+        return 0;
+    }
+
+    generator_config_s config;
+    if (!parse_config(&config, argc, argv)) {
+        usage(stderr, argv[0]);
+        return 1;
+    }
+    if (config.bench) {
+        generate_bench(stdout, &config);
+        return 0;
+    }
+    if (config.split_dir != NULL) {
+        if (!generate_split(&config)) {
+            return 1;
+        }
+    } else {
+        // Rendered in memory, then written at once.
+        char *header = NULL;
+        size_t header_size = 0;
+        FILE *stream = open_memstream(&header, &header_size);
+        fprintf(stream, "#ifndef LINALG_H\n");
+        fprintf(stream, "#define LINALG_H\n");
+        EMPTY_LINE(stream);
+        generate_head(stream);
+        generate_definitions(stream, &config);
+        generate_function_sections(stream, &config);
+        generate_generics(stream, &config);
+        fprintf(stream, "#endif // LINALG_H\n");
+        fclose(stream);
+        double start = now_ms();
+        bool written = write_all(STDOUT_FILENO, header, header_size);
+        generator_stats.write_ms += now_ms() - start;
+        generator_stats.output_bytes += header_size;
+        free(header);
+        if (!written) {
+            perror("error: could not write the header");
+            return 1;
+        }
+    }
+
+    // NOTE: with several jobs, the units are rendered in the temp arenas of
+    // the workers, so the one of the main thread says nothing.
+    if (config.jobs == 1) {
+        size_t temp_used = varia_arena_used(&varia_temp_arena);
+        size_t temp_capacity = varia_arena_capacity(&varia_temp_arena);
+        fprintf(stderr,
+                "\033[93mBytes of temp arena used: %zu / %zu (%.4f%%)\033[0m\n",
+                temp_used, temp_capacity,
+                100 * (float)temp_used / (float)temp_capacity);
+    }
     fprintf(stderr,
-            "\033[93mBytes of temp stack used: %zu / %zu (%.4f%%)\033[0m\n",
-            varia_temp_size, (size_t)VARIA_TEMP_CAPACITY,
-            100 * (float)varia_temp_size / (float)VARIA_TEMP_CAPACITY);
+            "\033[93mTime: functions %.2f ms (%zu units, %zu jobs), "
+            "sections %.2f ms, write %.2f ms (%zu bytes)\033[0m\n",
+            generator_stats.render_ms, generator_stats.num_units, config.jobs,
+            generator_stats.sections_ms, generator_stats.write_ms,
+            generator_stats.output_bytes);
     return 0;
 }
 
 // Ideas for additional features:
 // - Implement matrix constructors with specified values;
-// - Add support for non-square matrices (definitions, zero, mul, mul_vec);
 // - Implement integer lerping (handle `float t` elegantly);
 // - Implement type casting (same size);
 // - Implement size casting (downsizing first, then upsizing);
 // - Add support for rudimentary (hard-coded) swizzling (?);
 // - Add support for swizzling using parsing macro (?);
-// - Add support for type generic operations and functions (C23< first,
-// maybe C99);
+// - Extend the type generic front end (`la_*`) to the remaining functions;
 // - Print statistics (loc generated, number of functions for each type,
 // etc.);
-// - Implement an "in-place" variant of the rotation function;
 // - Implement transform function (axis, angle, translation).
 //   |- Could be implemented "in-place" to differentiate enough from transform
 //      constructor + matmul.
@@ -0,0 +1,341 @@
+#ifndef LINALG_IO_H
+#define LINALG_IO_H
+
+/* Binary container for arrays of `vecN<s>_t` and `matN<s>_t`, loaded by
+ * mapping the file: the returned pointers point straight into the mapping, so
+ * loading costs no parsing and no copy (pages are read on first access).
+ *
+ *     linalg_io_write_vec3f("mesh.bin", positions, n);
+ *     ...
+ *     linalg_io_file_t file;
+ *     if (linalg_io_open(&file, "mesh.bin")) {
+ *         vec3f_t *positions = linalg_io_vec3f(&file); // NULL if not vec3f.
+ *         size_t n = file.header.count;
+ *         ...
+ *         linalg_io_close(&file);
+ *     }
+ *
+ * Layout: a 64-byte `linalg_io_header_t`, then the payload at a 64-byte
+ * aligned offset. The payload is either the array itself (AoS, `stride` bytes
+ * per element), or one array per component (SoA, for vectors only), each
+ * starting on a 64-byte boundary `stride` bytes after the previous one.
+ *
+ * NOTE: the data is stored in the byte order and with the type sizes of the
+ * machine that wrote it; readers reject other byte orders and element sizes.
+ * The mapping is private: elements can be modified in place, but changes are
+ * not written back to the file.
+ */
+
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "../linalg.h"
+
+#ifndef LINALG_IO_DEF
+#define LINALG_IO_DEF static inline
+#endif // LINALG_IO_DEF
+
+#define LINALG_IO_MAGIC "LINALGIO"
+#define LINALG_IO_VERSION 1
+#define LINALG_IO_BYTE_ORDER 0x01020304u
+#define LINALG_IO_ALIGNMENT 64
+
+typedef enum {
+    LINALG_IO_VEC = 0,
+    LINALG_IO_MAT,
+} linalg_io_kind_t;
+
+typedef enum {
+    LINALG_IO_AOS = 0,
+    LINALG_IO_SOA,
+} linalg_io_layout_t;
+
+typedef struct {
+    char magic[8]; // LINALG_IO_MAGIC, not null-terminated.
+    uint32_t version;
+    uint32_t byte_order; // LINALG_IO_BYTE_ORDER, as written by the writer.
+    uint8_t kind;        // `linalg_io_kind_t`.
+    uint8_t dim;
+    uint8_t type;   // Type suffix: 'f', 'd', 'i' or 'u'.
+    uint8_t layout; // `linalg_io_layout_t`.
+    uint32_t scalar_size;
+    uint64_t count;  // Number of elements.
+    uint64_t stride; // AoS: bytes per element, SoA: bytes per component.
+    uint64_t payload_offset;
+    uint64_t payload_size;
+    uint8_t reserved[8];
+} linalg_io_header_t;
+
+static_assert(sizeof(linalg_io_header_t) == LINALG_IO_ALIGNMENT,
+              "The header must keep the payload aligned.");
+
+typedef struct {
+    linalg_io_header_t header;
+    void *mapping;
+    size_t mapping_size;
+} linalg_io_file_t;
+
+LINALG_IO_DEF size_t linalg_io_align(size_t size) {
+    const size_t mask = LINALG_IO_ALIGNMENT - 1;
+    return (size + mask) & ~mask;
+}
+
+LINALG_IO_DEF linalg_io_header_t linalg_io_header(linalg_io_kind_t kind,
+                                                  size_t dim, char type,
+                                                  size_t scalar_size,
+                                                  linalg_io_layout_t layout,
+                                                  size_t count) {
+    linalg_io_header_t header = {
+        .version = LINALG_IO_VERSION,
+        .byte_order = LINALG_IO_BYTE_ORDER,
+        .kind = (uint8_t)kind,
+        .dim = (uint8_t)dim,
+        .type = (uint8_t)type,
+        .layout = (uint8_t)layout,
+        .scalar_size = (uint32_t)scalar_size,
+        .count = count,
+        .payload_offset = sizeof(linalg_io_header_t),
+    };
+    memcpy(header.magic, LINALG_IO_MAGIC, sizeof(header.magic));
+    return header;
+}
+
+// Writes `size` bytes of zeros (padding).
+LINALG_IO_DEF bool linalg_io_pad(FILE *stream, size_t size) {
+    static const char zeros[LINALG_IO_ALIGNMENT] = {0};
+    return fwrite(zeros, 1, size, stream) == size;
+}
+
+// Writes `header` followed by the `num_parts` arrays of `part_size` bytes,
+// each padded to the alignment. Returns false on failure.
+LINALG_IO_DEF bool linalg_io_write_parts(const char *path,
+                                         linalg_io_header_t header,
+                                         const void *const *parts,
+                                         size_t num_parts, size_t part_size) {
+    FILE *stream = fopen(path, "wb");
+    if (stream == NULL) {
+        return false;
+    }
+    size_t padded = linalg_io_align(part_size);
+    header.payload_size = num_parts * padded;
+    bool ok = fwrite(&header, sizeof(header), 1, stream) == 1;
+    // NOTE: the arrays of an empty batch may be NULL, which fwrite rejects
+    // even for 0 bytes.
+    for (size_t i = 0; i < num_parts && ok && part_size > 0; ++i) {
+        ok = fwrite(parts[i], 1, part_size, stream) == part_size &&
+             linalg_io_pad(stream, padded - part_size);
+    }
+    return fclose(stream) == 0 && ok;
+}
+
+LINALG_IO_DEF bool linalg_io_write_aos(const char *path,
+                                       linalg_io_header_t header,
+                                       const void *elements, size_t stride) {
+    header.stride = stride;
+    return linalg_io_write_parts(path, header, &elements, 1,
+                                 header.count * stride);
+}
+
+LINALG_IO_DEF bool linalg_io_write_soa(const char *path,
+                                       linalg_io_header_t header,
+                                       const void *const *components) {
+    size_t component_size = header.count * header.scalar_size;
+    header.stride = linalg_io_align(component_size);
+    return linalg_io_write_parts(path, header, components, header.dim,
+                                 component_size);
+}
+
+LINALG_IO_DEF bool linalg_io_valid(const linalg_io_header_t *header,
+                                   size_t file_size) {
+    if (memcmp(header->magic, LINALG_IO_MAGIC, sizeof(header->magic)) != 0 ||
+        header->version != LINALG_IO_VERSION || header->scalar_size == 0 ||
+        header->byte_order != LINALG_IO_BYTE_ORDER ||
+        header->payload_offset % LINALG_IO_ALIGNMENT != 0 ||
+        header->payload_offset > file_size ||
+        header->payload_size > file_size - header->payload_offset) {
+        return false;
+    }
+    // The payload must hold every element (checked without overflowing).
+    uint64_t parts = header->count;
+    if (header->layout == LINALG_IO_SOA) {
+        if (header->stride % LINALG_IO_ALIGNMENT != 0 ||
+            header->stride / header->scalar_size < header->count) {
+            return false;
+        }
+        parts = header->dim;
+    }
+    return parts == 0 || header->stride <= header->payload_size / parts;
+}
+
+// Maps the file at `path` and validates its header. Returns false if the
+// file cannot be read or is not a valid container.
+LINALG_IO_DEF bool linalg_io_open(linalg_io_file_t *file, const char *path) {
+    *file = (linalg_io_file_t){0};
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0 ||
+        (size_t)info.st_size < sizeof(linalg_io_header_t)) {
+        close(fd);
+        return false;
+    }
+    size_t size = (size_t)info.st_size;
+    // Private writable mapping: in-place changes stay in memory.
+    void *mapping =
+        mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd); // The mapping keeps the file alive.
+    if (mapping == MAP_FAILED) {
+        return false;
+    }
+    memcpy(&file->header, mapping, sizeof(file->header));
+    if (!linalg_io_valid(&file->header, size)) {
+        munmap(mapping, size);
+        file->header = (linalg_io_header_t){0};
+        return false;
+    }
+    file->mapping = mapping;
+    file->mapping_size = size;
+    return true;
+}
+
+LINALG_IO_DEF void linalg_io_close(linalg_io_file_t *file) {
+    if (file->mapping != NULL) {
+        munmap(file->mapping, file->mapping_size);
+    }
+    *file = (linalg_io_file_t){0};
+}
+
+// Payload of `file` if it holds the given kind of elements, NULL otherwise.
+LINALG_IO_DEF void *linalg_io_payload(const linalg_io_file_t *file,
+                                      linalg_io_kind_t kind, size_t dim,
+                                      char type, size_t scalar_size,
+                                      linalg_io_layout_t layout) {
+    const linalg_io_header_t *header = &file->header;
+    if (file->mapping == NULL || header->kind != kind || header->dim != dim ||
+        header->type != (uint8_t)type || header->scalar_size != scalar_size ||
+        header->layout != layout) {
+        return NULL;
+    }
+    return (char *)file->mapping + header->payload_offset;
+}
+
+/* Defines, for `vecN<s>_t` and `matN<s>_t`:
+ *
+ *     bool linalg_io_write_vecN<s>(path, const vecN<s>_t *xs, size_t n)
+ *     bool linalg_io_write_vecN<s>_soa(path, vecN<s>_soa_t v)
+ *     bool linalg_io_write_matN<s>(path, const matN<s>_t *xs, size_t n)
+ *     vecN<s>_t *linalg_io_vecN<s>(const linalg_io_file_t *file)
+ *     vecN<s>_soa_t linalg_io_vecN<s>_soa(const linalg_io_file_t *file)
+ *     matN<s>_t *linalg_io_matN<s>(const linalg_io_file_t *file)
+ *
+ * The readers return NULL (or an empty SoA batch) if the file holds another
+ * kind of element, layout, or element size.
+ */
+#define LINALG_IO_DEFINE(N, s, T)                                              \
+    LINALG_IO_DEF bool linalg_io_write_vec##N##s(                              \
+        const char *path, const vec##N##s##_t *xs, size_t n) {                 \
+        linalg_io_header_t header = linalg_io_header(                          \
+            LINALG_IO_VEC, N, #s[0], sizeof(T), LINALG_IO_AOS, n);             \
+        return linalg_io_write_aos(path, header, xs, sizeof(*xs));             \
+    }                                                                          \
+                                                                               \
+    LINALG_IO_DEF bool linalg_io_write_mat##N##s(                              \
+        const char *path, const mat##N##s##_t *xs, size_t n) {                 \
+        linalg_io_header_t header = linalg_io_header(                          \
+            LINALG_IO_MAT, N, #s[0], sizeof(T), LINALG_IO_AOS, n);             \
+        return linalg_io_write_aos(path, header, xs, sizeof(*xs));             \
+    }                                                                          \
+                                                                               \
+    LINALG_IO_DEF bool linalg_io_write_vec##N##s##_soa(const char *path,       \
+                                                       vec##N##s##_soa_t v) {  \
+        linalg_io_header_t header = linalg_io_header(                          \
+            LINALG_IO_VEC, N, #s[0], sizeof(T), LINALG_IO_SOA, v.n);           \
+        /* The component pointers are the first members, in order. */          \
+        T *components[N];                                                      \
+        memcpy(components, &v, sizeof(components));                            \
+        return linalg_io_write_soa(path, header,                               \
+                                   (const void *const *)components);           \
+    }                                                                          \
+                                                                               \
+    LINALG_IO_DEF vec##N##s##_t *linalg_io_vec##N##s(                          \
+        const linalg_io_file_t *file) {                                        \
+        if (file->header.stride != sizeof(vec##N##s##_t)) {                    \
+            return NULL;                                                       \
+        }                                                                      \
+        return linalg_io_payload(file, LINALG_IO_VEC, N, #s[0], sizeof(T),     \
+                                 LINALG_IO_AOS);                               \
+    }                                                                          \
+                                                                               \
+    LINALG_IO_DEF mat##N##s##_t *linalg_io_mat##N##s(                          \
+        const linalg_io_file_t *file) {                                        \
+        if (file->header.stride != sizeof(mat##N##s##_t)) {                    \
+            return NULL;                                                       \
+        }                                                                      \
+        return linalg_io_payload(file, LINALG_IO_MAT, N, #s[0], sizeof(T),     \
+                                 LINALG_IO_AOS);                               \
+    }                                                                          \
+                                                                               \
+    LINALG_IO_DEF vec##N##s##_soa_t linalg_io_vec##N##s##_soa(                 \
+        const linalg_io_file_t *file) {                                        \
+        vec##N##s##_soa_t v = {0};                                             \
+        char *payload = linalg_io_payload(file, LINALG_IO_VEC, N, #s[0],       \
+                                          sizeof(T), LINALG_IO_SOA);           \
+        if (payload == NULL) {                                                 \
+            return v;                                                          \
+        }                                                                      \
+        T *components[N];                                                      \
+        for (size_t i = 0; i < N; ++i) {                                       \
+            components[i] = (T *)(payload + i * file->header.stride);          \
+        }                                                                      \
+        memcpy(&v, components, sizeof(components));                            \
+        v.n = file->header.count;                                              \
+        return v;                                                              \
+    }
+
+// NOTE: for the types of the generated header only (the SoA types come with
+// the matrices, see `generate_linalg --help`).
+#ifdef LINALG_HAS_VEC2F_SOA
+LINALG_IO_DEFINE(2, f, float)
+#endif // LINALG_HAS_VEC2F_SOA
+#ifdef LINALG_HAS_VEC3F_SOA
+LINALG_IO_DEFINE(3, f, float)
+#endif // LINALG_HAS_VEC3F_SOA
+#ifdef LINALG_HAS_VEC4F_SOA
+LINALG_IO_DEFINE(4, f, float)
+#endif // LINALG_HAS_VEC4F_SOA
+#ifdef LINALG_HAS_VEC2D_SOA
+LINALG_IO_DEFINE(2, d, double)
+#endif // LINALG_HAS_VEC2D_SOA
+#ifdef LINALG_HAS_VEC3D_SOA
+LINALG_IO_DEFINE(3, d, double)
+#endif // LINALG_HAS_VEC3D_SOA
+#ifdef LINALG_HAS_VEC4D_SOA
+LINALG_IO_DEFINE(4, d, double)
+#endif // LINALG_HAS_VEC4D_SOA
+#ifdef LINALG_HAS_VEC2I_SOA
+LINALG_IO_DEFINE(2, i, int)
+#endif // LINALG_HAS_VEC2I_SOA
+#ifdef LINALG_HAS_VEC3I_SOA
+LINALG_IO_DEFINE(3, i, int)
+#endif // LINALG_HAS_VEC3I_SOA
+#ifdef LINALG_HAS_VEC4I_SOA
+LINALG_IO_DEFINE(4, i, int)
+#endif // LINALG_HAS_VEC4I_SOA
+#ifdef LINALG_HAS_VEC2U_SOA
+LINALG_IO_DEFINE(2, u, unsigned int)
+#endif // LINALG_HAS_VEC2U_SOA
+#ifdef LINALG_HAS_VEC3U_SOA
+LINALG_IO_DEFINE(3, u, unsigned int)
+#endif // LINALG_HAS_VEC3U_SOA
+#ifdef LINALG_HAS_VEC4U_SOA
+LINALG_IO_DEFINE(4, u, unsigned int)
+#endif // LINALG_HAS_VEC4U_SOA
+
+#endif // LINALG_IO_H
@@ -0,0 +1,172 @@
+#ifndef LINALG_PARALLEL_H
+#define LINALG_PARALLEL_H
+
+/* Multi-threaded versions of the `linalg.h` batch kernels, sharded over a
+ * `thread_pool_t`:
+ *
+ *     mat4f_transform_array_parallel(&pool, &M, in, out, n);
+ *     vec3f_soa_unit_parallel(&pool, out, v);
+ *
+ * Each chunk is processed by the serial kernel, so the SIMD paths are kept.
+ * Chunks are sized so that the data they touch fits comfortably in a core's
+ * L2 cache (LINALG_PARALLEL_CHUNK_BYTES), and start on cache line boundaries
+ * so that no two workers write to the same line.
+ *
+ * NOTE: single and double precision only, for the dimensions of the
+ * generated header that have SoA types (see `generate_linalg --help`).
+ */
+
+#include "../linalg.h"
+#include "thread_pool.h"
+
+#ifndef LINALG_PARALLEL_DEF
+#define LINALG_PARALLEL_DEF static inline
+#endif // LINALG_PARALLEL_DEF
+
+#ifndef LINALG_PARALLEL_CHUNK_BYTES
+#define LINALG_PARALLEL_CHUNK_BYTES (128 * 1024)
+#endif // LINALG_PARALLEL_CHUNK_BYTES
+
+// Elements per chunk, for a kernel reading and writing `bytes_per_element`
+// bytes per element. A multiple of 16, so that every array of (at least)
+// 4-byte scalars is split on 64-byte boundaries.
+LINALG_PARALLEL_DEF size_t linalg_parallel_grain(size_t bytes_per_element) {
+    size_t grain = LINALG_PARALLEL_CHUNK_BYTES / bytes_per_element;
+    return MAX(grain / 16 * 16, 16);
+}
+
+LINALG_PARALLEL_DEF void linalg_parallel_for(thread_pool_t *pool, size_t n,
+                                             size_t bytes_per_element,
+                                             thread_pool_fn_t fn, void *ctx) {
+    thread_pool_parallel_for(pool, n, linalg_parallel_grain(bytes_per_element),
+                             fn, ctx);
+}
+
+// Views of elements [begin, end) of a SoA batch.
+#define LINALG_SOA_SLICE_2(v, begin, end)                                      \
+    {.x = (v).x + (begin), .y = (v).y + (begin), .n = (end) - (begin)}
+#define LINALG_SOA_SLICE_3(v, begin, end)                                      \
+    {.x = (v).x + (begin),                                                     \
+     .y = (v).y + (begin),                                                     \
+     .z = (v).z + (begin),                                                     \
+     .n = (end) - (begin)}
+#define LINALG_SOA_SLICE_4(v, begin, end)                                      \
+    {.x = (v).x + (begin),                                                     \
+     .y = (v).y + (begin),                                                     \
+     .z = (v).z + (begin),                                                     \
+     .w = (v).w + (begin),                                                     \
+     .n = (end) - (begin)}
+
+/* Defines, for `vecN<s>_t` and `matN<s>_t`:
+ *
+ *     matN<s>_transform_array_parallel(pool, M, in, out, n)
+ *     matN<s>_mul_vec_soa_parallel(pool, out, M, v)
+ *     vecN<s>_soa_unit_parallel(pool, out, v)
+ *     vecN<s>_soa_dot_parallel(pool, out, a, b)
+ *
+ * with the same semantics as the serial functions.
+ */
+#define LINALG_PARALLEL_DEFINE(N, s, T)                                        \
+    typedef struct {                                                           \
+        const mat##N##s##_t *M;                                                \
+        const vec##N##s##_t *in;                                               \
+        vec##N##s##_t *out;                                                    \
+        vec##N##s##_soa_t soa_out, a, b;                                       \
+        T *scalars;                                                            \
+    } linalg_parallel_##N##s##_ctx_t;                                          \
+                                                                               \
+    LINALG_PARALLEL_DEF void mat##N##s##_transform_array_chunk(                \
+        void *ctx, size_t begin, size_t end, varia_arena_t *scratch) {         \
+        (void)scratch;                                                         \
+        linalg_parallel_##N##s##_ctx_t *c = ctx;                               \
+        mat##N##s##_transform_array(c->M, c->in + begin, c->out + begin,       \
+                                    end - begin);                              \
+    }                                                                          \
+                                                                               \
+    LINALG_PARALLEL_DEF void mat##N##s##_transform_array_parallel(             \
+        thread_pool_t *pool, const mat##N##s##_t *M,                           \
+        const vec##N##s##_t *restrict in, vec##N##s##_t *restrict out,         \
+        size_t n) {                                                            \
+        linalg_parallel_##N##s##_ctx_t ctx = {.M = M, .in = in, .out = out};   \
+        linalg_parallel_for(pool, n, 2 * sizeof(*in),                          \
+                            mat##N##s##_transform_array_chunk, &ctx);          \
+    }                                                                          \
+                                                                               \
+    LINALG_PARALLEL_DEF void mat##N##s##_mul_vec_soa_chunk(                    \
+        void *ctx, size_t begin, size_t end, varia_arena_t *scratch) {         \
+        (void)scratch;                                                         \
+        linalg_parallel_##N##s##_ctx_t *c = ctx;                               \
+        mat##N##s##_mul_vec_soa(                                               \
+            (vec##N##s##_soa_t)LINALG_SOA_SLICE_##N(c->soa_out, begin, end),   \
+            *c->M, (vec##N##s##_soa_t)LINALG_SOA_SLICE_##N(c->a, begin, end)); \
+    }                                                                          \
+                                                                               \
+    LINALG_PARALLEL_DEF void mat##N##s##_mul_vec_soa_parallel(                 \
+        thread_pool_t *pool, vec##N##s##_soa_t out, mat##N##s##_t M,           \
+        vec##N##s##_soa_t v) {                                                 \
+        assert(v.n == out.n);                                                  \
+        linalg_parallel_##N##s##_ctx_t ctx = {                                 \
+            .M = &M, .soa_out = out, .a = v};                                  \
+        linalg_parallel_for(pool, v.n, 2 * N * sizeof(T),                      \
+                            mat##N##s##_mul_vec_soa_chunk, &ctx);              \
+    }                                                                          \
+                                                                               \
+    LINALG_PARALLEL_DEF void vec##N##s##_soa_unit_chunk(                       \
+        void *ctx, size_t begin, size_t end, varia_arena_t *scratch) {         \
+        (void)scratch;                                                         \
+        linalg_parallel_##N##s##_ctx_t *c = ctx;                               \
+        vec##N##s##_soa_unit(                                                  \
+            (vec##N##s##_soa_t)LINALG_SOA_SLICE_##N(c->soa_out, begin, end),   \
+            (vec##N##s##_soa_t)LINALG_SOA_SLICE_##N(c->a, begin, end));        \
+    }                                                                          \
+                                                                               \
+    LINALG_PARALLEL_DEF void vec##N##s##_soa_unit_parallel(                    \
+        thread_pool_t *pool, vec##N##s##_soa_t out, vec##N##s##_soa_t v) {     \
+        assert(v.n == out.n);                                                  \
+        linalg_parallel_##N##s##_ctx_t ctx = {.soa_out = out, .a = v};         \
+        linalg_parallel_for(pool, v.n, 2 * N * sizeof(T),                      \
+                            vec##N##s##_soa_unit_chunk, &ctx);                 \
+    }                                                                          \
+                                                                               \
+    LINALG_PARALLEL_DEF void vec##N##s##_soa_dot_chunk(                        \
+        void *ctx, size_t begin, size_t end, varia_arena_t *scratch) {         \
+        (void)scratch;                                                         \
+        linalg_parallel_##N##s##_ctx_t *c = ctx;                               \
+        vec##N##s##_soa_dot(                                                   \
+            c->scalars + begin,                                                \
+            (vec##N##s##_soa_t)LINALG_SOA_SLICE_##N(c->a, begin, end),         \
+            (vec##N##s##_soa_t)LINALG_SOA_SLICE_##N(c->b, begin, end));        \
+    }                                                                          \
+                                                                               \
+    LINALG_PARALLEL_DEF void vec##N##s##_soa_dot_parallel(                     \
+        thread_pool_t *pool, T *out, vec##N##s##_soa_t a,                      \
+        vec##N##s##_soa_t b) {                                                 \
+        assert(a.n == b.n);                                                    \
+        linalg_parallel_##N##s##_ctx_t ctx = {                                 \
+            .scalars = out, .a = a, .b = b};                                   \
+        linalg_parallel_for(pool, a.n, (2 * N + 1) * sizeof(T),                \
+                            vec##N##s##_soa_dot_chunk, &ctx);                  \
+    }
+
+// NOTE: for the types of the generated header only (the SoA types come with
+// the matrices, see `generate_linalg --help`).
+#ifdef LINALG_HAS_VEC2F_SOA
+LINALG_PARALLEL_DEFINE(2, f, float)
+#endif // LINALG_HAS_VEC2F_SOA
+#ifdef LINALG_HAS_VEC3F_SOA
+LINALG_PARALLEL_DEFINE(3, f, float)
+#endif // LINALG_HAS_VEC3F_SOA
+#ifdef LINALG_HAS_VEC4F_SOA
+LINALG_PARALLEL_DEFINE(4, f, float)
+#endif // LINALG_HAS_VEC4F_SOA
+#ifdef LINALG_HAS_VEC2D_SOA
+LINALG_PARALLEL_DEFINE(2, d, double)
+#endif // LINALG_HAS_VEC2D_SOA
+#ifdef LINALG_HAS_VEC3D_SOA
+LINALG_PARALLEL_DEFINE(3, d, double)
+#endif // LINALG_HAS_VEC3D_SOA
+#ifdef LINALG_HAS_VEC4D_SOA
+LINALG_PARALLEL_DEFINE(4, d, double)
+#endif // LINALG_HAS_VEC4D_SOA
+
+#endif // LINALG_PARALLEL_H
@@ -6,13 +6,20 @@
 #define MATHS_H
 
 #include <assert.h>
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif // __SSE2__
 
 #ifndef MATHS_DEF
 #define MATHS_DEF static inline
 #endif // MATHS_DEF
 
-constexpr double pi = {3.141592653589793};
-constexpr float pi_f = {3.141592F};
+static constexpr double pi = {3.141592653589793};
+static constexpr float pi_f = {3.14159265F};
 
 MATHS_DEF int mini(int a, int b) { return a < b ? a : b; }
 MATHS_DEF int maxi(int a, int b) { return a > b ? a : b; }
@@ -80,4 +87,308 @@ MATHS_DEF double clampd(double x, double min, double max) {
 }
 MATHS_DEF double lerpd(double a, double b, double t) { return a + (b - a) * t; }
 
+/* Fast approximations (single precision).
+ *
+ * - `sincosf_fast`: |error| < 1e-6 for |x| <= 100 (the argument is reduced
+ *   modulo pi/2 with a three-part constant, then evaluated with the minimax
+ *   polynomials of Cephes on [-pi/4, pi/4]);
+ * - `rsqrtf_fast`: relative error < 5e-6 (hardware estimate or bit trick, then
+ *   Newton iterations);
+ * - `acosf_fast`: |error| < 1e-6 on [-1, 1] (Abramowitz & Stegun 4.4.46);
+ * - `atan2f_fast`: |error| < 1e-6 (Abramowitz & Stegun 4.4.47 on the ratio of
+ *   the smallest to the largest coordinate).
+ *
+ * These are the bounds `tests/test_maths.c` checks against <math.h>.
+ *
+ * The `_ps` (SSE2, 4 lanes) and `_ps256` (AVX2, 8 lanes) variants compute the
+ * same approximations without branches.
+ */
+
+#define MATHS_PIO2_1 1.5703125f
+#define MATHS_PIO2_2 4.837512969970703125e-4f
+#define MATHS_PIO2_3 7.54978995489188216e-8f
+#define MATHS_2_OVER_PI 0.636619772367581343f
+
+#define MATHS_SIN_1 -1.6666654611e-1f
+#define MATHS_SIN_2 8.3321608736e-3f
+#define MATHS_SIN_3 -1.9515295891e-4f
+#define MATHS_COS_1 4.166664568298827e-2f
+#define MATHS_COS_2 -1.388731625493765e-3f
+#define MATHS_COS_3 2.443315711809948e-5f
+
+#define MATHS_ACOS_0 1.5707963050f
+#define MATHS_ACOS_1 -0.2145988016f
+#define MATHS_ACOS_2 0.0889789874f
+#define MATHS_ACOS_3 -0.0501743046f
+#define MATHS_ACOS_4 0.0308918810f
+#define MATHS_ACOS_5 -0.0170881256f
+#define MATHS_ACOS_6 0.0066700901f
+#define MATHS_ACOS_7 -0.0012624911f
+
+#define MATHS_ATAN_1 0.9999993329f
+#define MATHS_ATAN_3 -0.3332985605f
+#define MATHS_ATAN_5 0.1994653599f
+#define MATHS_ATAN_7 -0.1390853351f
+#define MATHS_ATAN_9 0.0964200441f
+#define MATHS_ATAN_11 -0.0559098861f
+#define MATHS_ATAN_13 0.0218612288f
+#define MATHS_ATAN_15 -0.0040540580f
+
+MATHS_DEF void sincosf_fast(float x, float *s, float *c) {
+    // x = r + q pi/2, with |r| <= pi/4.
+    int q = (int)(x * MATHS_2_OVER_PI + (x < 0 ? -0.5f : 0.5f));
+    float qf = (float)q;
+    float r = x - qf * MATHS_PIO2_1 - qf * MATHS_PIO2_2 - qf * MATHS_PIO2_3;
+    float z = r * r;
+    float sin_p = MATHS_SIN_1 + z * (MATHS_SIN_2 + z * MATHS_SIN_3);
+    float sin_r = r + r * z * sin_p;
+    float cos_r = 1 - 0.5f * z +
+                  z * z * (MATHS_COS_1 + z * (MATHS_COS_2 + z * MATHS_COS_3));
+    if (q & 1) {
+        float tmp = sin_r;
+        sin_r = cos_r;
+        cos_r = tmp;
+    }
+    *s = q & 2 ? -sin_r : sin_r;
+    *c = (q + 1) & 2 ? -cos_r : cos_r;
+}
+
+MATHS_DEF float rsqrtf_fast(float x) {
+#if defined(__SSE__)
+    float y = _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(x)));
+    return y * (1.5f - 0.5f * x * y * y);
+#else
+    uint32_t bits;
+    memcpy(&bits, &x, sizeof(bits));
+    bits = 0x5f375a86 - (bits >> 1);
+    float y;
+    memcpy(&y, &bits, sizeof(y));
+    y = y * (1.5f - 0.5f * x * y * y);
+    return y * (1.5f - 0.5f * x * y * y);
+#endif // __SSE__
+}
+
+// NOTE: `x` must be in [-1, 1].
+MATHS_DEF float acosf_fast(float x) {
+    float a = x < 0 ? -x : x;
+    float p = MATHS_ACOS_7;
+    p = p * a + MATHS_ACOS_6;
+    p = p * a + MATHS_ACOS_5;
+    p = p * a + MATHS_ACOS_4;
+    p = p * a + MATHS_ACOS_3;
+    p = p * a + MATHS_ACOS_2;
+    p = p * a + MATHS_ACOS_1;
+    p = p * a + MATHS_ACOS_0;
+    float r = sqrtf(1 - a) * p;
+    return x < 0 ? pi_f - r : r;
+}
+
+// atan(a) for a in [0, 1].
+MATHS_DEF float maths_atan_unit(float a) {
+    float z = a * a;
+    float p = MATHS_ATAN_15;
+    p = p * z + MATHS_ATAN_13;
+    p = p * z + MATHS_ATAN_11;
+    p = p * z + MATHS_ATAN_9;
+    p = p * z + MATHS_ATAN_7;
+    p = p * z + MATHS_ATAN_5;
+    p = p * z + MATHS_ATAN_3;
+    p = p * z + MATHS_ATAN_1;
+    return a * p;
+}
+
+MATHS_DEF float atan2f_fast(float y, float x) {
+    float ax = x < 0 ? -x : x;
+    float ay = y < 0 ? -y : y;
+    float max = ax > ay ? ax : ay;
+    float min = ax > ay ? ay : ax;
+    float r = max == 0 ? 0 : maths_atan_unit(min / max);
+    r = ay > ax ? 0.5f * pi_f - r : r;
+    r = x < 0 ? pi_f - r : r;
+    return y < 0 ? -r : r;
+}
+
+#if defined(__SSE2__)
+MATHS_DEF __m128 maths_madd_ps(__m128 a, __m128 b, __m128 c) {
+#ifdef __FMA__
+    return _mm_fmadd_ps(a, b, c);
+#else
+    return _mm_add_ps(_mm_mul_ps(a, b), c);
+#endif // __FMA__
+}
+
+MATHS_DEF __m128 maths_select_ps(__m128 mask, __m128 a, __m128 b) {
+    return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+}
+
+MATHS_DEF void sincosf_fast_ps(__m128 x, __m128 *s, __m128 *c) {
+    __m128i q = _mm_cvtps_epi32(_mm_mul_ps(x, _mm_set1_ps(MATHS_2_OVER_PI)));
+    __m128 qf = _mm_cvtepi32_ps(q);
+    __m128 r = maths_madd_ps(qf, _mm_set1_ps(-MATHS_PIO2_1), x);
+    r = maths_madd_ps(qf, _mm_set1_ps(-MATHS_PIO2_2), r);
+    r = maths_madd_ps(qf, _mm_set1_ps(-MATHS_PIO2_3), r);
+    __m128 z = _mm_mul_ps(r, r);
+
+    __m128 p = maths_madd_ps(z, _mm_set1_ps(MATHS_SIN_3),
+                             _mm_set1_ps(MATHS_SIN_2));
+    p = maths_madd_ps(z, p, _mm_set1_ps(MATHS_SIN_1));
+    __m128 sin_r = maths_madd_ps(_mm_mul_ps(r, z), p, r);
+    p = maths_madd_ps(z, _mm_set1_ps(MATHS_COS_3), _mm_set1_ps(MATHS_COS_2));
+    p = maths_madd_ps(z, p, _mm_set1_ps(MATHS_COS_1));
+    __m128 cos_r = maths_madd_ps(z, _mm_set1_ps(-0.5f), _mm_set1_ps(1));
+    cos_r = maths_madd_ps(_mm_mul_ps(z, z), p, cos_r);
+
+    const __m128i one = _mm_set1_epi32(1), two = _mm_set1_epi32(2);
+    __m128 swap =
+        _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(q, one), one));
+    __m128 sin_sign =
+        _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(q, two), 30));
+    __m128 cos_sign = _mm_castsi128_ps(
+        _mm_slli_epi32(_mm_and_si128(_mm_add_epi32(q, one), two), 30));
+    *s = _mm_xor_ps(maths_select_ps(swap, cos_r, sin_r), sin_sign);
+    *c = _mm_xor_ps(maths_select_ps(swap, sin_r, cos_r), cos_sign);
+}
+
+MATHS_DEF __m128 rsqrtf_fast_ps(__m128 x) {
+    __m128 y = _mm_rsqrt_ps(x);
+    __m128 half_x_y2 = _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(0.5f), x),
+                                  _mm_mul_ps(y, y));
+    return _mm_mul_ps(y, _mm_sub_ps(_mm_set1_ps(1.5f), half_x_y2));
+}
+
+MATHS_DEF __m128 acosf_fast_ps(__m128 x) {
+    const __m128 sign = _mm_set1_ps(-0.0f);
+    __m128 a = _mm_andnot_ps(sign, x);
+    __m128 p = maths_madd_ps(a, _mm_set1_ps(MATHS_ACOS_7),
+                             _mm_set1_ps(MATHS_ACOS_6));
+    p = maths_madd_ps(a, p, _mm_set1_ps(MATHS_ACOS_5));
+    p = maths_madd_ps(a, p, _mm_set1_ps(MATHS_ACOS_4));
+    p = maths_madd_ps(a, p, _mm_set1_ps(MATHS_ACOS_3));
+    p = maths_madd_ps(a, p, _mm_set1_ps(MATHS_ACOS_2));
+    p = maths_madd_ps(a, p, _mm_set1_ps(MATHS_ACOS_1));
+    p = maths_madd_ps(a, p, _mm_set1_ps(MATHS_ACOS_0));
+    __m128 r = _mm_mul_ps(_mm_sqrt_ps(_mm_sub_ps(_mm_set1_ps(1), a)), p);
+    __m128 negative = _mm_cmplt_ps(x, _mm_setzero_ps());
+    return maths_select_ps(negative, _mm_sub_ps(_mm_set1_ps(pi_f), r), r);
+}
+
+MATHS_DEF __m128 atan2f_fast_ps(__m128 y, __m128 x) {
+    const __m128 sign = _mm_set1_ps(-0.0f);
+    __m128 ax = _mm_andnot_ps(sign, x);
+    __m128 ay = _mm_andnot_ps(sign, y);
+    __m128 max = _mm_max_ps(ax, ay);
+    __m128 a = _mm_div_ps(_mm_min_ps(ax, ay), max);
+    a = _mm_and_ps(a, _mm_cmpneq_ps(max, _mm_setzero_ps())); // 0 / 0
+    __m128 z = _mm_mul_ps(a, a);
+    __m128 p = maths_madd_ps(z, _mm_set1_ps(MATHS_ATAN_15),
+                             _mm_set1_ps(MATHS_ATAN_13));
+    p = maths_madd_ps(z, p, _mm_set1_ps(MATHS_ATAN_11));
+    p = maths_madd_ps(z, p, _mm_set1_ps(MATHS_ATAN_9));
+    p = maths_madd_ps(z, p, _mm_set1_ps(MATHS_ATAN_7));
+    p = maths_madd_ps(z, p, _mm_set1_ps(MATHS_ATAN_5));
+    p = maths_madd_ps(z, p, _mm_set1_ps(MATHS_ATAN_3));
+    p = maths_madd_ps(z, p, _mm_set1_ps(MATHS_ATAN_1));
+    __m128 r = _mm_mul_ps(a, p);
+    r = maths_select_ps(_mm_cmpgt_ps(ay, ax),
+                        _mm_sub_ps(_mm_set1_ps(0.5f * pi_f), r), r);
+    r = maths_select_ps(_mm_cmplt_ps(x, _mm_setzero_ps()),
+                        _mm_sub_ps(_mm_set1_ps(pi_f), r), r);
+    return _mm_xor_ps(r, _mm_and_ps(y, sign));
+}
+#endif // __SSE2__
+
+#if defined(__AVX__)
+// NOTE: AVX only, so that the AVX paths of other modules can use it too.
+MATHS_DEF __m256 maths_madd_ps256(__m256 a, __m256 b, __m256 c) {
+#ifdef __FMA__
+    return _mm256_fmadd_ps(a, b, c);
+#else
+    return _mm256_add_ps(_mm256_mul_ps(a, b), c);
+#endif // __FMA__
+}
+#endif // __AVX__
+
+#if defined(__AVX2__)
+MATHS_DEF void sincosf_fast_ps256(__m256 x, __m256 *s, __m256 *c) {
+    __m256i q =
+        _mm256_cvtps_epi32(_mm256_mul_ps(x, _mm256_set1_ps(MATHS_2_OVER_PI)));
+    __m256 qf = _mm256_cvtepi32_ps(q);
+    __m256 r = maths_madd_ps256(qf, _mm256_set1_ps(-MATHS_PIO2_1), x);
+    r = maths_madd_ps256(qf, _mm256_set1_ps(-MATHS_PIO2_2), r);
+    r = maths_madd_ps256(qf, _mm256_set1_ps(-MATHS_PIO2_3), r);
+    __m256 z = _mm256_mul_ps(r, r);
+
+    __m256 p = maths_madd_ps256(z, _mm256_set1_ps(MATHS_SIN_3),
+                                _mm256_set1_ps(MATHS_SIN_2));
+    p = maths_madd_ps256(z, p, _mm256_set1_ps(MATHS_SIN_1));
+    __m256 sin_r = maths_madd_ps256(_mm256_mul_ps(r, z), p, r);
+    p = maths_madd_ps256(z, _mm256_set1_ps(MATHS_COS_3),
+                         _mm256_set1_ps(MATHS_COS_2));
+    p = maths_madd_ps256(z, p, _mm256_set1_ps(MATHS_COS_1));
+    __m256 cos_r =
+        maths_madd_ps256(z, _mm256_set1_ps(-0.5f), _mm256_set1_ps(1));
+    cos_r = maths_madd_ps256(_mm256_mul_ps(z, z), p, cos_r);
+
+    const __m256i one = _mm256_set1_epi32(1), two = _mm256_set1_epi32(2);
+    __m256 swap = _mm256_castsi256_ps(
+        _mm256_cmpeq_epi32(_mm256_and_si256(q, one), one));
+    __m256 sin_sign =
+        _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(q, two), 30));
+    __m256 cos_sign = _mm256_castsi256_ps(_mm256_slli_epi32(
+        _mm256_and_si256(_mm256_add_epi32(q, one), two), 30));
+    *s = _mm256_xor_ps(_mm256_blendv_ps(sin_r, cos_r, swap), sin_sign);
+    *c = _mm256_xor_ps(_mm256_blendv_ps(cos_r, sin_r, swap), cos_sign);
+}
+
+MATHS_DEF __m256 rsqrtf_fast_ps256(__m256 x) {
+    __m256 y = _mm256_rsqrt_ps(x);
+    __m256 half_x_y2 = _mm256_mul_ps(_mm256_mul_ps(_mm256_set1_ps(0.5f), x),
+                                     _mm256_mul_ps(y, y));
+    return _mm256_mul_ps(y, _mm256_sub_ps(_mm256_set1_ps(1.5f), half_x_y2));
+}
+
+MATHS_DEF __m256 acosf_fast_ps256(__m256 x) {
+    const __m256 sign = _mm256_set1_ps(-0.0f);
+    __m256 a = _mm256_andnot_ps(sign, x);
+    __m256 p = maths_madd_ps256(a, _mm256_set1_ps(MATHS_ACOS_7),
+                                _mm256_set1_ps(MATHS_ACOS_6));
+    p = maths_madd_ps256(a, p, _mm256_set1_ps(MATHS_ACOS_5));
+    p = maths_madd_ps256(a, p, _mm256_set1_ps(MATHS_ACOS_4));
+    p = maths_madd_ps256(a, p, _mm256_set1_ps(MATHS_ACOS_3));
+    p = maths_madd_ps256(a, p, _mm256_set1_ps(MATHS_ACOS_2));
+    p = maths_madd_ps256(a, p, _mm256_set1_ps(MATHS_ACOS_1));
+    p = maths_madd_ps256(a, p, _mm256_set1_ps(MATHS_ACOS_0));
+    __m256 r =
+        _mm256_mul_ps(_mm256_sqrt_ps(_mm256_sub_ps(_mm256_set1_ps(1), a)), p);
+    __m256 negative = _mm256_cmp_ps(x, _mm256_setzero_ps(), _CMP_LT_OQ);
+    return _mm256_blendv_ps(r, _mm256_sub_ps(_mm256_set1_ps(pi_f), r),
+                            negative);
+}
+
+MATHS_DEF __m256 atan2f_fast_ps256(__m256 y, __m256 x) {
+    const __m256 sign = _mm256_set1_ps(-0.0f);
+    const __m256 zero = _mm256_setzero_ps();
+    __m256 ax = _mm256_andnot_ps(sign, x);
+    __m256 ay = _mm256_andnot_ps(sign, y);
+    __m256 max = _mm256_max_ps(ax, ay);
+    __m256 a = _mm256_div_ps(_mm256_min_ps(ax, ay), max);
+    a = _mm256_and_ps(a, _mm256_cmp_ps(max, zero, _CMP_NEQ_OQ)); // 0 / 0
+    __m256 z = _mm256_mul_ps(a, a);
+    __m256 p = maths_madd_ps256(z, _mm256_set1_ps(MATHS_ATAN_15),
+                                _mm256_set1_ps(MATHS_ATAN_13));
+    p = maths_madd_ps256(z, p, _mm256_set1_ps(MATHS_ATAN_11));
+    p = maths_madd_ps256(z, p, _mm256_set1_ps(MATHS_ATAN_9));
+    p = maths_madd_ps256(z, p, _mm256_set1_ps(MATHS_ATAN_7));
+    p = maths_madd_ps256(z, p, _mm256_set1_ps(MATHS_ATAN_5));
+    p = maths_madd_ps256(z, p, _mm256_set1_ps(MATHS_ATAN_3));
+    p = maths_madd_ps256(z, p, _mm256_set1_ps(MATHS_ATAN_1));
+    __m256 r = _mm256_mul_ps(a, p);
+    r = _mm256_blendv_ps(r, _mm256_sub_ps(_mm256_set1_ps(0.5f * pi_f), r),
+                         _mm256_cmp_ps(ay, ax, _CMP_GT_OQ));
+    r = _mm256_blendv_ps(r, _mm256_sub_ps(_mm256_set1_ps(pi_f), r),
+                         _mm256_cmp_ps(x, zero, _CMP_LT_OQ));
+    return _mm256_xor_ps(r, _mm256_and_ps(y, sign));
+}
+#endif // __AVX2__
+
 #endif // MATHS_H
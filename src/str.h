@@ -3,17 +3,70 @@
 
 #include "char_type.h"
 #include "typedefs.h"
+#include "varia.h"
+
+#include <errno.h>
+#include <limits.h>
+#include <sys/uio.h>
+
+// Pieces per writev() call.
+#ifdef IOV_MAX
+#define STR_LIST_IOV_MAX IOV_MAX
+#else
+#define STR_LIST_IOV_MAX 1024
+#endif // IOV_MAX
 
 #ifndef STR_DEF
 #define STR_DEF static inline
 #endif // STR_DEF
 
+// Returned by the search functions when there is no match.
+#define STR_NOT_FOUND (~(u64)0)
+
+// Builds a `str_t` from a string literal (without the null terminator).
+#define str_lit(literal)                                                       \
+    str_from_parts((const u8 *)(literal), sizeof(literal) - 1)
+
+// NOTE: the vectorized primitives process 32 (AVX2) or 16 (SSE2) bytes at a
+// time. The instruction set is chosen at compile time (e.g. `-march=native`);
+// other targets use the scalar fallback.
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define STR_SIMD_WIDTH 32
+typedef __m256i str_simd_t;
+#define str_simd_load(ptr) _mm256_loadu_si256((const __m256i *)(ptr))
+#define str_simd_splat(byte) _mm256_set1_epi8((char)(byte))
+#define str_simd_eq(a, b) _mm256_cmpeq_epi8(a, b)
+#define str_simd_and(a, b) _mm256_and_si256(a, b)
+#define str_simd_or(a, b) _mm256_or_si256(a, b)
+#define str_simd_sub(a, b) _mm256_sub_epi8(a, b)
+#define str_simd_min_u8(a, b) _mm256_min_epu8(a, b)
+#define str_simd_mask(v) ((u32)_mm256_movemask_epi8(v))
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define STR_SIMD_WIDTH 16
+typedef __m128i str_simd_t;
+#define str_simd_load(ptr) _mm_loadu_si128((const __m128i *)(ptr))
+#define str_simd_splat(byte) _mm_set1_epi8((char)(byte))
+#define str_simd_eq(a, b) _mm_cmpeq_epi8(a, b)
+#define str_simd_and(a, b) _mm_and_si128(a, b)
+#define str_simd_or(a, b) _mm_or_si128(a, b)
+#define str_simd_sub(a, b) _mm_sub_epi8(a, b)
+#define str_simd_min_u8(a, b) _mm_min_epu8(a, b)
+#define str_simd_mask(v) ((u32)_mm_movemask_epi8(v))
+#endif
+
+#ifdef STR_SIMD_WIDTH
+// Bit mask with one bit set per lane.
+#define STR_SIMD_FULL_MASK ((u32)((1ULL << STR_SIMD_WIDTH) - 1))
+#endif // STR_SIMD_WIDTH
+
 typedef struct {
     u8 *data;
     u64 size;
 } str_t;
 
-typedef struct {
+typedef struct str_node_t {
     struct str_node_t *next;
     str_t string;
 } str_node_t;
@@ -40,6 +93,84 @@ STR_DEF str_t str_trim(str_t str);
 STR_DEF bool str_eq(str_t a, str_t b, u64 n);
 STR_DEF bool str_starts_with(str_t str, str_t expected_prefix);
 
+// Index of the first occurrence of `byte` (or STR_NOT_FOUND).
+STR_DEF u64 str_find_byte(str_t str, u8 byte);
+
+// Index of the first occurrence of `needle` (or STR_NOT_FOUND).
+STR_DEF u64 str_find(str_t str, str_t needle);
+
+// Number of occurrences of `byte`.
+STR_DEF u64 str_count_byte(str_t str, u8 byte);
+
+// Index of the first byte that belongs to `set` (or STR_NOT_FOUND).
+STR_DEF u64 str_find_any(str_t str, str_t set);
+
+// Fast non-cryptographic 64-bit hash (wyhash), e.g. for hash tables. Equal
+// strings hash equally for a given seed, whatever their alignment.
+STR_DEF u64 str_hash_seeded(str_t str, u64 seed);
+STR_DEF u64 str_hash(str_t str);
+
+/* Splitting. Tokens are views into the input (nothing is copied), so the input
+ * must outlive them. Consecutive delimiters produce empty tokens, and a
+ * delimiter at the very end produces a final empty token (like strsep()).
+ *
+ * The iterator form does not allocate at all:
+ *
+ *     str_split_t it = str_split(input);
+ *     str_t token;
+ *     while (str_split_next_byte(&it, ',', &token)) {
+ *         ...
+ *     }
+ *
+ * The `str_array_t` form stores the tokens in an arena.
+ */
+
+typedef struct {
+    str_t rest;
+    bool done;
+} str_split_t;
+
+STR_DEF str_split_t str_split(str_t str);
+STR_DEF bool str_split_next_byte(str_split_t *it, u8 delimiter, str_t *token);
+STR_DEF bool str_split_next_set(str_split_t *it, str_t delimiters,
+                                str_t *token);
+// NOTE: lines end with '\n' or "\r\n" (the terminator is not part of the
+// line), and a trailing terminator does not start an extra empty line.
+STR_DEF bool str_split_next_line(str_split_t *it, str_t *line);
+
+// Appends `str`, doubling the capacity when the array is full.
+STR_DEF void str_array_push(varia_arena_t *arena, str_array_t *array,
+                            str_t str);
+STR_DEF str_array_t str_split_by_byte(varia_arena_t *arena, str_t str,
+                                      u8 delimiter);
+STR_DEF str_array_t str_split_by_set(varia_arena_t *arena, str_t str,
+                                     str_t delimiters);
+STR_DEF str_array_t str_lines(varia_arena_t *arena, str_t str);
+
+/* String builder: a list of pieces, concatenated only once at the end (or
+ * never, see `str_list_write`), instead of many small writes or reallocations:
+ *
+ *     str_list_t out = {0};
+ *     str_list_push(&arena, &out, str_lit("vec3f_t v = "));
+ *     str_list_pushf(&arena, &out, "{%g, %g, %g};\n", x, y, z);
+ *     str_t text = str_list_flatten(&arena, &out);
+ *
+ * The nodes live in the arena. `str_list_push` does not copy the string, so it
+ * must outlive the list; `str_list_pushf` formats into the arena.
+ */
+
+STR_DEF void str_list_push(varia_arena_t *arena, str_list_t *list, str_t str);
+STR_DEF void str_list_pushf(varia_arena_t *arena, str_list_t *list,
+                            const char *fmt, ...)
+    __attribute__((format(printf, 3, 4)));
+// Concatenates the pieces with `separator` between them.
+STR_DEF str_t str_list_join(varia_arena_t *arena, const str_list_t *list,
+                            str_t separator);
+STR_DEF str_t str_list_flatten(varia_arena_t *arena, const str_list_t *list);
+// Writes every piece to `fd` with writev() (no concatenation). Returns false
+// if a write fails.
+STR_DEF bool str_list_write(int fd, const str_list_t *list);
+
 #define STR_IMPLEMENTATION
 #ifdef STR_IMPLEMENTATION
 
@@ -59,8 +190,30 @@ STR_DEF str_t str_from_cstr(const u8 *cstr) {
     return str_from_parts(cstr, cstrlen(cstr));
 }
 
+#ifdef STR_SIMD_WIDTH
+// Lanes holding a space character (same set as `is_space`).
+STR_DEF str_simd_t str_simd_is_space(str_simd_t block) {
+    // '\t', '\n', '\v', '\f' and '\r' are contiguous: (c - '\t') <= 4.
+    str_simd_t shifted = str_simd_sub(block, str_simd_splat('\t'));
+    str_simd_t control =
+        str_simd_eq(str_simd_min_u8(shifted, str_simd_splat(4)), shifted);
+    return str_simd_or(control, str_simd_eq(block, str_simd_splat(' ')));
+}
+#endif // STR_SIMD_WIDTH
+
 STR_DEF str_t str_trim_left(str_t str) {
     u64 i = 0;
+#ifdef STR_SIMD_WIDTH
+    for (; i + STR_SIMD_WIDTH <= str.size; i += STR_SIMD_WIDTH) {
+        str_simd_t block = str_simd_load(str.data + i);
+        u32 non_space = ~str_simd_mask(str_simd_is_space(block));
+        non_space &= STR_SIMD_FULL_MASK;
+        if (non_space != 0) {
+            i += __builtin_ctz(non_space);
+            return str_from_parts(str.data + i, str.size - i);
+        }
+    }
+#endif // STR_SIMD_WIDTH
     while (i < str.size && is_space(str.data[i])) {
         ++i;
     }
@@ -70,6 +223,19 @@ STR_DEF str_t str_trim_left(str_t str) {
 
 STR_DEF str_t str_trim_right(str_t str) {
     u64 i = 0;
+#ifdef STR_SIMD_WIDTH
+    for (; i + STR_SIMD_WIDTH <= str.size; i += STR_SIMD_WIDTH) {
+        str_simd_t block =
+            str_simd_load(str.data + str.size - i - STR_SIMD_WIDTH);
+        u32 non_space = ~str_simd_mask(str_simd_is_space(block));
+        non_space &= STR_SIMD_FULL_MASK;
+        if (non_space != 0) {
+            // Bit (WIDTH - 1) is the last byte of the block.
+            i += STR_SIMD_WIDTH - 1 - (31 - __builtin_clz(non_space));
+            return str_from_parts(str.data, str.size - i);
+        }
+    }
+#endif // STR_SIMD_WIDTH
     while (i < str.size && is_space(str.data[str.size - 1 - i])) {
         ++i;
     }
@@ -79,16 +245,33 @@ STR_DEF str_t str_trim_right(str_t str) {
 
 STR_DEF str_t str_trim(str_t str) { return str_trim_right(str_trim_left(str)); }
 
+// Compares `n` bytes, like memcmp() == 0.
+STR_DEF bool str_bytes_eq(const u8 *lhs, const u8 *rhs, u64 n) {
+    u64 i = 0;
+#ifdef STR_SIMD_WIDTH
+    for (; i + STR_SIMD_WIDTH <= n; i += STR_SIMD_WIDTH) {
+        str_simd_t eq =
+            str_simd_eq(str_simd_load(lhs + i), str_simd_load(rhs + i));
+        if (str_simd_mask(eq) != STR_SIMD_FULL_MASK) {
+            return false;
+        }
+    }
+#endif // STR_SIMD_WIDTH
+    for (; i < n; ++i) {
+        if (lhs[i] != rhs[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// NOTE: both strings must have the same size, and only the first `n` bytes
+// (at most the size) are compared.
 STR_DEF bool str_eq(str_t a, str_t b, u64 n) {
     if (a.size != b.size) {
         return false;
-    } else {
-        const u8 *lhs = a.data, *rhs = b.data;
-        for (; n > 0 && *lhs == *rhs; --n, lhs++, rhs++) {
-            ;
-        }
-        return true;
     }
+    return str_bytes_eq(a.data, b.data, n < a.size ? n : a.size);
 }
 
 STR_DEF bool str_starts_with(str_t str, str_t expected_prefix) {
@@ -99,6 +282,411 @@ STR_DEF bool str_starts_with(str_t str, str_t expected_prefix) {
     return false;
 }
 
+STR_DEF u64 str_find_byte(str_t str, u8 byte) {
+    u64 i = 0;
+#ifdef STR_SIMD_WIDTH
+    str_simd_t target = str_simd_splat(byte);
+    for (; i + STR_SIMD_WIDTH <= str.size; i += STR_SIMD_WIDTH) {
+        u32 mask =
+            str_simd_mask(str_simd_eq(str_simd_load(str.data + i), target));
+        if (mask != 0) {
+            return i + __builtin_ctz(mask);
+        }
+    }
+#endif // STR_SIMD_WIDTH
+    for (; i < str.size; ++i) {
+        if (str.data[i] == byte) {
+            return i;
+        }
+    }
+    return STR_NOT_FOUND;
+}
+
+STR_DEF u64 str_find(str_t str, str_t needle) {
+    if (needle.size == 0) {
+        return 0;
+    }
+    if (needle.size > str.size) {
+        return STR_NOT_FOUND;
+    }
+    if (needle.size == 1) {
+        return str_find_byte(str, needle.data[0]);
+    }
+    const u64 last = needle.size - 1;
+    const u64 num_positions = str.size - needle.size + 1;
+    u64 i = 0;
+#ifdef STR_SIMD_WIDTH
+    // Filter candidate positions on the first and last bytes of the needle
+    // for a whole block at once, then verify the candidates.
+    str_simd_t first_byte = str_simd_splat(needle.data[0]);
+    str_simd_t last_byte = str_simd_splat(needle.data[last]);
+    for (; i + STR_SIMD_WIDTH <= num_positions; i += STR_SIMD_WIDTH) {
+        str_simd_t first = str_simd_load(str.data + i);
+        str_simd_t end = str_simd_load(str.data + i + last);
+        u32 candidates = str_simd_mask(str_simd_and(
+            str_simd_eq(first, first_byte), str_simd_eq(end, last_byte)));
+        while (candidates != 0) {
+            u64 position = i + __builtin_ctz(candidates);
+            if (str_bytes_eq(str.data + position + 1, needle.data + 1,
+                             needle.size - 2)) {
+                return position;
+            }
+            candidates &= candidates - 1;
+        }
+    }
+#endif // STR_SIMD_WIDTH
+    for (; i < num_positions; ++i) {
+        if (str.data[i] == needle.data[0] &&
+            str.data[i + last] == needle.data[last] &&
+            str_bytes_eq(str.data + i + 1, needle.data + 1, needle.size - 2)) {
+            return i;
+        }
+    }
+    return STR_NOT_FOUND;
+}
+
+STR_DEF u64 str_count_byte(str_t str, u8 byte) {
+    u64 count = 0;
+    u64 i = 0;
+#ifdef STR_SIMD_WIDTH
+    str_simd_t target = str_simd_splat(byte);
+    for (; i + STR_SIMD_WIDTH <= str.size; i += STR_SIMD_WIDTH) {
+        u32 mask =
+            str_simd_mask(str_simd_eq(str_simd_load(str.data + i), target));
+        count += __builtin_popcount(mask);
+    }
+#endif // STR_SIMD_WIDTH
+    for (; i < str.size; ++i) {
+        count += str.data[i] == byte;
+    }
+    return count;
+}
+
+STR_DEF u64 str_find_any(str_t str, str_t set) {
+    u64 i = 0;
+#ifdef STR_SIMD_WIDTH
+    // Small sets (e.g. whitespace or CSV separators) compare every lane
+    // against each member; larger ones use the lookup table below.
+    if (set.size <= 8) {
+        str_simd_t members[8];
+        for (u64 m = 0; m < set.size; ++m) {
+            members[m] = str_simd_splat(set.data[m]);
+        }
+        for (; i + STR_SIMD_WIDTH <= str.size; i += STR_SIMD_WIDTH) {
+            str_simd_t block = str_simd_load(str.data + i);
+            str_simd_t hits = str_simd_splat(0);
+            for (u64 m = 0; m < set.size; ++m) {
+                hits = str_simd_or(hits, str_simd_eq(block, members[m]));
+            }
+            u32 mask = str_simd_mask(hits);
+            if (mask != 0) {
+                return i + __builtin_ctz(mask);
+            }
+        }
+    }
+#endif // STR_SIMD_WIDTH
+    u64 table[256 / 64] = {0};
+    for (u64 m = 0; m < set.size; ++m) {
+        table[set.data[m] / 64] |= 1ULL << (set.data[m] % 64);
+    }
+    for (; i < str.size; ++i) {
+        if (table[str.data[i] / 64] & (1ULL << (str.data[i] % 64))) {
+            return i;
+        }
+    }
+    return STR_NOT_FOUND;
+}
+
+/* wyhash (final version 4, by Wang Yi, public domain): 16 bytes per 128-bit
+ * multiply, with 3 independent lanes for long inputs. Short strings, the
+ * common case for identifiers, cost a couple of overlapping loads and two
+ * multiplications.
+ */
+static const u64 str_wyhash_secret[4] = {
+    0x2d358dccaa6c78a5ULL,
+    0x8bb84b93962eacc9ULL,
+    0x4b33a62ed433d4a3ULL,
+    0x4d5a2da51de1aa47ULL,
+};
+
+// 64x64 -> 128-bit multiplication, low half in `a` and high half in `b`.
+STR_DEF void str_wyhash_mum(u64 *a, u64 *b) {
+    __uint128_t r = (__uint128_t)*a * *b;
+    *a = (u64)r;
+    *b = (u64)(r >> 64);
+}
+
+STR_DEF u64 str_wyhash_mix(u64 a, u64 b) {
+    str_wyhash_mum(&a, &b);
+    return a ^ b;
+}
+
+// NOTE: unaligned little-endian loads, like the reference implementation on
+// x86 and ARM.
+STR_DEF u64 str_wyhash_r8(const u8 *p) {
+    u64 v;
+    __builtin_memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+STR_DEF u64 str_wyhash_r4(const u8 *p) {
+    u32 v;
+    __builtin_memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+STR_DEF u64 str_hash_seeded(str_t str, u64 seed) {
+    const u64 *secret = str_wyhash_secret;
+    const u8 *p = str.data;
+    u64 size = str.size;
+    seed ^= str_wyhash_mix(seed ^ secret[0], secret[1]);
+    u64 a, b;
+    if (size <= 16) {
+        if (size >= 4) {
+            // Two (possibly overlapping) pairs of 4-byte loads.
+            u64 middle = (size >> 3) << 2;
+            a = (str_wyhash_r4(p) << 32) | str_wyhash_r4(p + middle);
+            b = (str_wyhash_r4(p + size - 4) << 32) |
+                str_wyhash_r4(p + size - 4 - middle);
+        } else if (size > 0) {
+            a = ((u64)p[0] << 16) | ((u64)p[size >> 1] << 8) | p[size - 1];
+            b = 0;
+        } else {
+            a = b = 0;
+        }
+    } else {
+        u64 i = size;
+        if (i > 48) {
+            u64 see1 = seed, see2 = seed;
+            do {
+                seed = str_wyhash_mix(str_wyhash_r8(p) ^ secret[1],
+                                      str_wyhash_r8(p + 8) ^ seed);
+                see1 = str_wyhash_mix(str_wyhash_r8(p + 16) ^ secret[2],
+                                      str_wyhash_r8(p + 24) ^ see1);
+                see2 = str_wyhash_mix(str_wyhash_r8(p + 32) ^ secret[3],
+                                      str_wyhash_r8(p + 40) ^ see2);
+                p += 48;
+                i -= 48;
+            } while (i > 48);
+            seed ^= see1 ^ see2;
+        }
+        while (i > 16) {
+            seed = str_wyhash_mix(str_wyhash_r8(p) ^ secret[1],
+                                  str_wyhash_r8(p + 8) ^ seed);
+            i -= 16;
+            p += 16;
+        }
+        a = str_wyhash_r8(p + i - 16);
+        b = str_wyhash_r8(p + i - 8);
+    }
+    a ^= secret[1];
+    b ^= seed;
+    str_wyhash_mum(&a, &b);
+    return str_wyhash_mix(a ^ secret[0] ^ size, b ^ secret[1]);
+}
+
+STR_DEF u64 str_hash(str_t str) { return str_hash_seeded(str, 0); }
+
+STR_DEF str_split_t str_split(str_t str) {
+    return (str_split_t){.rest = str, .done = false};
+}
+
+// Cuts the token ending at `index` (the delimiter is `delimiter_size` bytes).
+STR_DEF str_t str_split_cut(str_split_t *it, u64 index, u64 delimiter_size) {
+    str_t token = it->rest;
+    if (index == STR_NOT_FOUND) {
+        it->done = true;
+        it->rest = str_from_parts(it->rest.data + it->rest.size, 0);
+        return token;
+    }
+    token.size = index;
+    u64 skipped = index + delimiter_size;
+    it->rest = str_from_parts(it->rest.data + skipped, it->rest.size - skipped);
+    return token;
+}
+
+STR_DEF bool str_split_next_byte(str_split_t *it, u8 delimiter, str_t *token) {
+    if (it->done) {
+        return false;
+    }
+    *token = str_split_cut(it, str_find_byte(it->rest, delimiter), 1);
+    return true;
+}
+
+STR_DEF bool str_split_next_set(str_split_t *it, str_t delimiters,
+                                str_t *token) {
+    if (it->done) {
+        return false;
+    }
+    *token = str_split_cut(it, str_find_any(it->rest, delimiters), 1);
+    return true;
+}
+
+STR_DEF bool str_split_next_line(str_split_t *it, str_t *line) {
+    if (it->done || it->rest.size == 0) {
+        it->done = true;
+        return false;
+    }
+    *line = str_split_cut(it, str_find_byte(it->rest, '\n'), 1);
+    if (line->size > 0 && line->data[line->size - 1] == '\r') {
+        --line->size;
+    }
+    return true;
+}
+
+STR_DEF void str_array_push(varia_arena_t *arena, str_array_t *array,
+                            str_t str) {
+    if (array->size == array->capacity) {
+        u64 capacity = array->capacity ? 2 * array->capacity : 16;
+        str_t *elements =
+            varia_arena_alloc(arena, capacity * sizeof(*elements));
+        assert(elements != NULL && "Out of memory for the string array.");
+        for (u64 i = 0; i < array->size; ++i) {
+            elements[i] = array->elements[i];
+        }
+        array->elements = elements;
+        array->capacity = capacity;
+    }
+    array->elements[array->size++] = str;
+}
+
+// Reserves exactly `capacity` elements (used when the token count is known).
+STR_DEF str_array_t str_array_reserve(varia_arena_t *arena, u64 capacity) {
+    str_t *elements = varia_arena_alloc(arena, capacity * sizeof(*elements));
+    assert(elements != NULL && "Out of memory for the string array.");
+    return (str_array_t){.elements = elements, .size = 0, .capacity = capacity};
+}
+
+STR_DEF str_array_t str_split_by_byte(varia_arena_t *arena, str_t str,
+                                      u8 delimiter) {
+    // NOTE: counting first is a single vectorized pass, and it avoids both the
+    // reallocations and the wasted arena space of a growing array.
+    str_array_t tokens =
+        str_array_reserve(arena, str_count_byte(str, delimiter) + 1);
+    str_split_t it = str_split(str);
+    str_t token;
+    while (str_split_next_byte(&it, delimiter, &token)) {
+        tokens.elements[tokens.size++] = token;
+    }
+    return tokens;
+}
+
+STR_DEF str_array_t str_split_by_set(varia_arena_t *arena, str_t str,
+                                     str_t delimiters) {
+    str_array_t tokens = {0};
+    str_split_t it = str_split(str);
+    str_t token;
+    while (str_split_next_set(&it, delimiters, &token)) {
+        str_array_push(arena, &tokens, token);
+    }
+    return tokens;
+}
+
+STR_DEF str_array_t str_lines(varia_arena_t *arena, str_t str) {
+    str_array_t lines =
+        str_array_reserve(arena, str_count_byte(str, '\n') + 1);
+    str_split_t it = str_split(str);
+    str_t line;
+    while (str_split_next_line(&it, &line)) {
+        lines.elements[lines.size++] = line;
+    }
+    return lines;
+}
+
+STR_DEF void str_list_push_node(str_list_t *list, str_node_t *node) {
+    node->next = NULL;
+    if (list->last != NULL) {
+        list->last->next = node;
+    } else {
+        list->first = node;
+    }
+    list->last = node;
+    ++list->num_nodes;
+    list->total_size += node->string.size;
+}
+
+STR_DEF void str_list_push(varia_arena_t *arena, str_list_t *list, str_t str) {
+    str_node_t *node = varia_arena_alloc(arena, sizeof(*node));
+    assert(node != NULL && "Out of memory for the string list.");
+    node->string = str;
+    str_list_push_node(list, node);
+}
+
+STR_DEF void str_list_pushf(varia_arena_t *arena, str_list_t *list,
+                            const char *fmt, ...) {
+    // The node first, so the text can be formatted in place after it.
+    str_node_t *node = varia_arena_alloc(arena, sizeof(*node));
+    assert(node != NULL && "Out of memory for the string list.");
+    va_list args;
+    va_start(args, fmt);
+    size_t size;
+    char *text = varia_arena_vsprintf(arena, &size, fmt, args);
+    va_end(args);
+    node->string = str_from_parts((const u8 *)text, size);
+    str_list_push_node(list, node);
+}
+
+STR_DEF str_t str_list_join(varia_arena_t *arena, const str_list_t *list,
+                            str_t separator) {
+    u64 size = list->total_size;
+    if (list->num_nodes > 1) {
+        size += (list->num_nodes - 1) * separator.size;
+    }
+    u8 *data = varia_arena_alloc_aligned(arena, size, 1);
+    assert(data != NULL && "Out of memory for the joined string.");
+    u8 *end = data;
+    for (str_node_t *node = list->first; node != NULL; node = node->next) {
+        // NOTE: empty strings may have a NULL `data`, which memcpy rejects
+        // even for 0 bytes.
+        if (node != list->first && separator.size > 0) {
+            __builtin_memcpy(end, separator.data, separator.size);
+            end += separator.size;
+        }
+        if (node->string.size > 0) {
+            __builtin_memcpy(end, node->string.data, node->string.size);
+            end += node->string.size;
+        }
+    }
+    return str_from_parts(data, size);
+}
+
+STR_DEF str_t str_list_flatten(varia_arena_t *arena, const str_list_t *list) {
+    return str_list_join(arena, list, str_from_parts(NULL, 0));
+}
+
+STR_DEF bool str_list_write(int fd, const str_list_t *list) {
+    struct iovec iov[STR_LIST_IOV_MAX];
+    str_node_t *node = list->first;
+    u64 offset = 0; // Bytes of `node` already written.
+    while (node != NULL) {
+        int count = 0;
+        for (str_node_t *n = node; n != NULL && count < STR_LIST_IOV_MAX;
+             n = n->next) {
+            u64 skip = n == node ? offset : 0;
+            iov[count++] = (struct iovec){
+                .iov_base = n->string.data + skip,
+                .iov_len = n->string.size - skip,
+            };
+        }
+        ssize_t written = writev(fd, iov, count);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        // Skip what was written, possibly stopping in the middle of a node.
+        u64 left = (u64)written;
+        while (node != NULL && left >= node->string.size - offset) {
+            left -= node->string.size - offset;
+            offset = 0;
+            node = node->next;
+        }
+        offset += left;
+    }
+    return true;
+}
+
 #endif // STR_IMPLEMENTATION
 
 #endif // STR_H
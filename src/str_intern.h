@@ -0,0 +1,211 @@
+#ifndef STR_INTERN_H
+#define STR_INTERN_H
+
+/* String interning: each distinct string is stored once and identified by a
+ * small integer, so comparing interned strings is an integer comparison:
+ *
+ *     varia_arena_t arena = {0};
+ *     str_intern_t table = {.arena = &arena};
+ *     str_id_t a = str_intern(&table, str_lit("width"));
+ *     str_id_t b = str_intern(&table, token); // a == b iff same bytes.
+ *     str_t name = str_intern_get(&table, a);
+ *     ...
+ *     varia_arena_free(&arena); // Releases the table and the strings.
+ *
+ * Ids are dense (0, 1, 2... in order of first insertion) and the interned
+ * bytes never move, so both ids and the `str_t` returned by `str_intern_get`
+ * stay valid for the lifetime of the arena. Strings cannot be removed.
+ *
+ * The lookup structure is an open-addressing hash set in the style of Swiss
+ * tables (Abseil's `flat_hash_set`): one control byte per slot holds either
+ * STR_INTERN_EMPTY or 7 bits of the hash, so a whole group of slots is
+ * filtered with a single vector compare (see `str_simd_t`) and the strings
+ * themselves are only compared on a 7-bit match. Groups are probed with
+ * triangular steps (1, 2, 3, ... groups), and the table doubles when it is 7/8
+ * full.
+ */
+
+#include "str.h"
+
+#ifndef STR_INTERN_DEF
+#define STR_INTERN_DEF static inline
+#endif // STR_INTERN_DEF
+
+// Slots per group: one vector of control bytes.
+#ifdef STR_SIMD_WIDTH
+#define STR_INTERN_GROUP STR_SIMD_WIDTH
+#else
+#define STR_INTERN_GROUP 8
+#endif // STR_SIMD_WIDTH
+
+#define STR_INTERN_EMPTY 0x80
+// Returned by `str_intern_find` when the string was never interned.
+#define STR_ID_NONE (~(str_id_t)0)
+
+typedef u32 str_id_t;
+
+typedef struct {
+    varia_arena_t *arena; // Storage for the strings and the table.
+
+    // Hash set of ids: `control[i]` describes `slots[i]`.
+    u8 *control;
+    str_id_t *slots;
+    u64 capacity; // Number of slots (0, or a power of two).
+
+    // Indexed by id.
+    str_t *strings;
+    u64 *hashes;
+    u64 count;
+    u64 strings_capacity;
+} str_intern_t;
+
+// Interns `str` (copying its bytes the first time it is seen).
+STR_INTERN_DEF str_id_t str_intern(str_intern_t *table, str_t str);
+// Id of `str`, or STR_ID_NONE if it was never interned.
+STR_INTERN_DEF str_id_t str_intern_find(const str_intern_t *table, str_t str);
+STR_INTERN_DEF str_t str_intern_get(const str_intern_t *table, str_id_t id);
+
+#define STR_INTERN_IMPLEMENTATION
+#ifdef STR_INTERN_IMPLEMENTATION
+
+// Bit `i` set when control byte `i` of the group equals `byte`.
+STR_INTERN_DEF u32 str_intern_match(const u8 *group, u8 byte) {
+#ifdef STR_SIMD_WIDTH
+    return str_simd_mask(
+        str_simd_eq(str_simd_load(group), str_simd_splat(byte)));
+#else
+    u32 mask = 0;
+    for (u32 i = 0; i < STR_INTERN_GROUP; ++i) {
+        mask |= (u32)(group[i] == byte) << i;
+    }
+    return mask;
+#endif // STR_SIMD_WIDTH
+}
+
+// The low 7 bits go to the control bytes, the others select the group, so
+// that the two are independent.
+STR_INTERN_DEF u8 str_intern_h2(u64 hash) { return hash & 0x7F; }
+
+STR_INTERN_DEF u64 str_intern_first_group(const str_intern_t *table,
+                                          u64 hash) {
+    return (hash >> 7) & (table->capacity / STR_INTERN_GROUP - 1);
+}
+
+// Slot holding `str` (of hash `hash`), or the empty slot where it belongs.
+STR_INTERN_DEF u64 str_intern_probe(const str_intern_t *table, str_t str,
+                                    u64 hash) {
+    u64 group_mask = table->capacity / STR_INTERN_GROUP - 1;
+    u64 group = str_intern_first_group(table, hash);
+    u8 h2 = str_intern_h2(hash);
+    // Triangular steps visit every group of a power-of-two table.
+    for (u64 step = 1;; ++step) {
+        const u8 *control = table->control + group * STR_INTERN_GROUP;
+        u32 candidates = str_intern_match(control, h2);
+        while (candidates != 0) {
+            u64 slot = group * STR_INTERN_GROUP + __builtin_ctz(candidates);
+            str_id_t id = table->slots[slot];
+            if (table->hashes[id] == hash &&
+                str_eq(table->strings[id], str, str.size)) {
+                return slot;
+            }
+            candidates &= candidates - 1;
+        }
+        // NOTE: nothing is ever removed, so the first empty slot ends the
+        // probe sequence and is also where a new string goes.
+        u32 empty = str_intern_match(control, STR_INTERN_EMPTY);
+        if (empty != 0) {
+            return group * STR_INTERN_GROUP + __builtin_ctz(empty);
+        }
+        group = (group + step) & group_mask;
+    }
+}
+
+STR_INTERN_DEF void str_intern_rehash(str_intern_t *table, u64 capacity) {
+    u8 *control = varia_arena_alloc_aligned(table->arena, capacity,
+                                            STR_INTERN_GROUP);
+    str_id_t *slots =
+        varia_arena_alloc(table->arena, capacity * sizeof(*slots));
+    assert(control != NULL && slots != NULL && "Out of memory for the table.");
+    for (u64 i = 0; i < capacity; ++i) {
+        control[i] = STR_INTERN_EMPTY;
+    }
+    table->control = control;
+    table->slots = slots;
+    table->capacity = capacity;
+    for (str_id_t id = 0; id < table->count; ++id) {
+        u64 slot = str_intern_probe(table, table->strings[id],
+                                    table->hashes[id]);
+        control[slot] = str_intern_h2(table->hashes[id]);
+        slots[slot] = id;
+    }
+}
+
+STR_INTERN_DEF void str_intern_push(str_intern_t *table, str_t str,
+                                    u64 hash) {
+    if (table->count == table->strings_capacity) {
+        u64 capacity = table->strings_capacity ? 2 * table->strings_capacity
+                                               : 64;
+        str_t *strings =
+            varia_arena_alloc(table->arena, capacity * sizeof(*strings));
+        u64 *hashes =
+            varia_arena_alloc(table->arena, capacity * sizeof(*hashes));
+        assert(strings != NULL && hashes != NULL &&
+               "Out of memory for the strings.");
+        for (u64 i = 0; i < table->count; ++i) {
+            strings[i] = table->strings[i];
+            hashes[i] = table->hashes[i];
+        }
+        table->strings = strings;
+        table->hashes = hashes;
+        table->strings_capacity = capacity;
+    }
+    u8 *bytes = varia_arena_alloc_aligned(table->arena, str.size, 1);
+    assert(bytes != NULL && "Out of memory for the strings.");
+    for (u64 i = 0; i < str.size; ++i) {
+        bytes[i] = str.data[i];
+    }
+    table->strings[table->count] = str_from_parts(bytes, str.size);
+    table->hashes[table->count] = hash;
+    ++table->count;
+}
+
+STR_INTERN_DEF str_id_t str_intern(str_intern_t *table, str_t str) {
+    assert(table->arena != NULL && "The table needs an arena.");
+    // Grow before the table is 7/8 full (which also keeps an empty slot, so
+    // that probing terminates).
+    if (8 * (table->count + 1) > 7 * table->capacity) {
+        str_intern_rehash(table, table->capacity ? 2 * table->capacity
+                                                 : 4 * STR_INTERN_GROUP);
+    }
+    u64 hash = str_hash(str);
+    u64 slot = str_intern_probe(table, str, hash);
+    if (table->control[slot] != STR_INTERN_EMPTY) {
+        return table->slots[slot];
+    }
+    assert(table->count < STR_ID_NONE && "Too many interned strings.");
+    str_id_t id = (str_id_t)table->count;
+    str_intern_push(table, str, hash);
+    table->control[slot] = str_intern_h2(hash);
+    table->slots[slot] = id;
+    return id;
+}
+
+STR_INTERN_DEF str_id_t str_intern_find(const str_intern_t *table, str_t str) {
+    if (table->capacity == 0) {
+        return STR_ID_NONE;
+    }
+    u64 slot = str_intern_probe(table, str, str_hash(str));
+    if (table->control[slot] == STR_INTERN_EMPTY) {
+        return STR_ID_NONE;
+    }
+    return table->slots[slot];
+}
+
+STR_INTERN_DEF str_t str_intern_get(const str_intern_t *table, str_id_t id) {
+    assert(id < table->count && "Unknown string id.");
+    return table->strings[id];
+}
+
+#endif // STR_INTERN_IMPLEMENTATION
+
+#endif // STR_INTERN_H
@@ -0,0 +1,318 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+/* Fixed-size pool of worker threads running data-parallel loops:
+ *
+ *     thread_pool_t pool;
+ *     thread_pool_init(&pool, 0); // One thread per online CPU.
+ *     thread_pool_parallel_for(&pool, n, 4096, kernel, &ctx);
+ *     thread_pool_free(&pool);
+ *
+ * `kernel(ctx, begin, end, scratch)` is called on disjoint chunks covering
+ * [0, n), each at most `grain` elements long. The range is split recursively:
+ * a worker halves its chunk until it fits the grain, pushing the upper halves
+ * on its own deque, so thieves take the oldest (largest) pieces and idle
+ * workers end up splitting them further. The calling thread works too, and
+ * `thread_pool_parallel_for` returns once every chunk is done.
+ *
+ * `scratch` is an arena private to the worker running the chunk, reset
+ * after each chunk, for temporary buffers that would otherwise contend on a
+ * shared allocator.
+ *
+ * NOTE: one loop runs at a time per pool, and kernels must not start loops on
+ * the pool they run on.
+ */
+
+#ifndef _DEFAULT_SOURCE
+#define _DEFAULT_SOURCE // sysconf(_SC_NPROCESSORS_ONLN)
+#endif                  // _DEFAULT_SOURCE
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "varia.h"
+
+#ifndef THREAD_POOL_DEF
+#define THREAD_POOL_DEF static inline
+#endif // THREAD_POOL_DEF
+
+// Recursive halving leaves at most log2(n / grain) chunks in a deque, so 64
+// slots are enough for any `size_t` range.
+#define THREAD_POOL_DEQUE_CAPACITY 64
+#define THREAD_POOL_CACHE_LINE 64
+
+typedef void (*thread_pool_fn_t)(void *ctx, size_t begin, size_t end,
+                                 varia_arena_t *scratch);
+
+typedef struct {
+    size_t begin, end;
+} thread_pool_range_t;
+
+/* Chase-Lev deque: the owner pushes and pops at the bottom, thieves steal from
+ * the top (see Lê et al., "Correct and Efficient Work-Stealing for Weak Memory
+ * Models", 2013). Never resized, see THREAD_POOL_DEQUE_CAPACITY.
+ *
+ * NOTE: a thief may read a slot that is concurrently reused once it lost the
+ * race for it, hence the (relaxed) atomic slots.
+ */
+typedef struct {
+    _Atomic long top;
+    _Atomic long bottom;
+    _Atomic size_t begins[THREAD_POOL_DEQUE_CAPACITY];
+    _Atomic size_t ends[THREAD_POOL_DEQUE_CAPACITY];
+} thread_pool_deque_t;
+
+THREAD_POOL_DEF thread_pool_range_t
+thread_pool_deque_load(thread_pool_deque_t *deque, long i) {
+    size_t slot = (size_t)i % THREAD_POOL_DEQUE_CAPACITY;
+    return (thread_pool_range_t){
+        atomic_load_explicit(&deque->begins[slot], memory_order_relaxed),
+        atomic_load_explicit(&deque->ends[slot], memory_order_relaxed),
+    };
+}
+
+typedef struct {
+    // Owned by a single thread, so keep it off the neighbours' cache lines.
+    _Alignas(THREAD_POOL_CACHE_LINE) thread_pool_deque_t deque;
+    varia_arena_t scratch;
+    struct thread_pool_t *pool;
+    pthread_t thread;
+    unsigned long long seed; // Victim selection.
+} thread_pool_worker_t;
+
+typedef struct thread_pool_t {
+    thread_pool_worker_t *workers; // workers[0] is the calling thread.
+    size_t num_workers;
+
+    pthread_mutex_t mutex;
+    pthread_cond_t wake;
+    unsigned long long generation; // Incremented by every loop.
+    bool stop;
+
+    // Current loop, written before any of its chunks is published.
+    thread_pool_fn_t fn;
+    void *ctx;
+    size_t grain;
+    _Alignas(THREAD_POOL_CACHE_LINE) _Atomic size_t remaining; // Elements.
+} thread_pool_t;
+
+THREAD_POOL_DEF void thread_pool_push(thread_pool_deque_t *deque,
+                                      thread_pool_range_t range) {
+    long b = atomic_load_explicit(&deque->bottom, memory_order_relaxed);
+    assert(b - atomic_load_explicit(&deque->top, memory_order_acquire) <
+               THREAD_POOL_DEQUE_CAPACITY &&
+           "Deque overflow.");
+    size_t slot = (size_t)b % THREAD_POOL_DEQUE_CAPACITY;
+    atomic_store_explicit(&deque->begins[slot], range.begin,
+                          memory_order_relaxed);
+    atomic_store_explicit(&deque->ends[slot], range.end, memory_order_relaxed);
+    atomic_store_explicit(&deque->bottom, b + 1, memory_order_release);
+}
+
+THREAD_POOL_DEF bool thread_pool_pop(thread_pool_deque_t *deque,
+                                     thread_pool_range_t *range) {
+    long b = atomic_load_explicit(&deque->bottom, memory_order_relaxed) - 1;
+    atomic_store_explicit(&deque->bottom, b, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+    long t = atomic_load_explicit(&deque->top, memory_order_relaxed);
+    if (t > b) { // Empty.
+        atomic_store_explicit(&deque->bottom, b + 1, memory_order_relaxed);
+        return false;
+    }
+    *range = thread_pool_deque_load(deque, b);
+    if (t == b) { // Last one: race the thieves for it.
+        bool won = atomic_compare_exchange_strong_explicit(
+            &deque->top, &t, t + 1, memory_order_seq_cst,
+            memory_order_relaxed);
+        atomic_store_explicit(&deque->bottom, b + 1, memory_order_relaxed);
+        return won;
+    }
+    return true;
+}
+
+THREAD_POOL_DEF bool thread_pool_steal(thread_pool_deque_t *deque,
+                                       thread_pool_range_t *range) {
+    long t = atomic_load_explicit(&deque->top, memory_order_acquire);
+    atomic_thread_fence(memory_order_seq_cst);
+    long b = atomic_load_explicit(&deque->bottom, memory_order_acquire);
+    if (t >= b) {
+        return false;
+    }
+    *range = thread_pool_deque_load(deque, t);
+    return atomic_compare_exchange_strong_explicit(&deque->top, &t, t + 1,
+                                                   memory_order_seq_cst,
+                                                   memory_order_relaxed);
+}
+
+THREAD_POOL_DEF void thread_pool_call(thread_pool_fn_t fn, void *ctx,
+                                      thread_pool_range_t range,
+                                      varia_arena_t *scratch) {
+    fn(ctx, range.begin, range.end, scratch);
+    // NOTE: reset rather than restore to an empty mark, which would unmap the
+    // first block after every chunk.
+    varia_arena_reset(scratch);
+}
+
+// Splits `range` down to the grain, keeping the lowest chunk for itself.
+THREAD_POOL_DEF void thread_pool_run(thread_pool_worker_t *worker,
+                                     thread_pool_range_t range) {
+    thread_pool_t *pool = worker->pool;
+    size_t grain = pool->grain;
+    while (range.end - range.begin > grain) {
+        // Split on a multiple of the grain, so chunks stay aligned with it.
+        size_t chunks = (range.end - range.begin + grain - 1) / grain;
+        size_t mid = range.begin + chunks / 2 * grain;
+        thread_pool_push(&worker->deque,
+                         (thread_pool_range_t){mid, range.end});
+        range.end = mid;
+    }
+    thread_pool_call(pool->fn, pool->ctx, range, &worker->scratch);
+    atomic_fetch_sub_explicit(&pool->remaining, range.end - range.begin,
+                              memory_order_acq_rel);
+}
+
+THREAD_POOL_DEF bool thread_pool_steal_any(thread_pool_worker_t *worker,
+                                           thread_pool_range_t *range) {
+    thread_pool_t *pool = worker->pool;
+    // xorshift64, to spread the thieves over the victims.
+    worker->seed ^= worker->seed << 13;
+    worker->seed ^= worker->seed >> 7;
+    worker->seed ^= worker->seed << 17;
+    size_t start = worker->seed % pool->num_workers;
+    for (size_t i = 0; i < pool->num_workers; ++i) {
+        thread_pool_worker_t *victim =
+            &pool->workers[(start + i) % pool->num_workers];
+        if (victim != worker && thread_pool_steal(&victim->deque, range)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Works on the current loop until all of its elements are done.
+THREAD_POOL_DEF void thread_pool_work(thread_pool_worker_t *worker) {
+    thread_pool_t *pool = worker->pool;
+    thread_pool_range_t range;
+    while (atomic_load_explicit(&pool->remaining, memory_order_acquire) > 0) {
+        if (thread_pool_pop(&worker->deque, &range) ||
+            thread_pool_steal_any(worker, &range)) {
+            thread_pool_run(worker, range);
+        } else {
+            sched_yield();
+        }
+    }
+}
+
+THREAD_POOL_DEF void *thread_pool_worker_main(void *arg) {
+    thread_pool_worker_t *worker = arg;
+    thread_pool_t *pool = worker->pool;
+    unsigned long long seen = 0;
+    for (;;) {
+        pthread_mutex_lock(&pool->mutex);
+        while (pool->generation == seen && !pool->stop) {
+            pthread_cond_wait(&pool->wake, &pool->mutex);
+        }
+        seen = pool->generation;
+        bool stop = pool->stop;
+        pthread_mutex_unlock(&pool->mutex);
+        if (stop) {
+            break;
+        }
+        thread_pool_work(worker);
+    }
+    varia_arena_free(&worker->scratch);
+    varia_arena_free(&varia_temp_arena);
+    return NULL;
+}
+
+// Stops and joins the workers of a pool started by `thread_pool_init()`.
+THREAD_POOL_DEF void thread_pool_free(thread_pool_t *pool) {
+    pthread_mutex_lock(&pool->mutex);
+    pool->stop = true;
+    pthread_cond_broadcast(&pool->wake);
+    pthread_mutex_unlock(&pool->mutex);
+    for (size_t i = 1; i < pool->num_workers; ++i) {
+        pthread_join(pool->workers[i].thread, NULL);
+    }
+    varia_arena_free(&pool->workers[0].scratch);
+    pthread_mutex_destroy(&pool->mutex);
+    pthread_cond_destroy(&pool->wake);
+    free(pool->workers);
+    pool->workers = NULL;
+}
+
+// Starts `num_threads` - 1 workers (the caller being the last one), or one
+// per online CPU if `num_threads` is 0. Returns false on failure, after
+// stopping the workers already started and zeroing `*pool`: there is then
+// nothing for `thread_pool_free()` to do.
+THREAD_POOL_DEF bool thread_pool_init(thread_pool_t *pool, size_t num_threads) {
+    if (num_threads == 0) {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        num_threads = cpus > 0 ? (size_t)cpus : 1;
+    }
+    *pool = (thread_pool_t){.num_workers = num_threads};
+    pool->workers = aligned_alloc(THREAD_POOL_CACHE_LINE,
+                                  num_threads * sizeof(thread_pool_worker_t));
+    if (pool->workers == NULL) {
+        *pool = (thread_pool_t){0};
+        return false;
+    }
+    pthread_mutex_init(&pool->mutex, NULL);
+    pthread_cond_init(&pool->wake, NULL);
+    for (size_t i = 0; i < num_threads; ++i) {
+        pool->workers[i] = (thread_pool_worker_t){
+            .pool = pool,
+            .seed = 0x9e3779b97f4a7c15ULL * (i + 1),
+        };
+    }
+    for (size_t i = 1; i < num_threads; ++i) {
+        thread_pool_worker_t *worker = &pool->workers[i];
+        if (pthread_create(&worker->thread, NULL, thread_pool_worker_main,
+                           worker) != 0) {
+            pool->num_workers = i; // Only join the workers started so far.
+            thread_pool_free(pool);
+            *pool = (thread_pool_t){0};
+            return false;
+        }
+    }
+    return true;
+}
+
+THREAD_POOL_DEF void thread_pool_parallel_for(thread_pool_t *pool, size_t n,
+                                              size_t grain,
+                                              thread_pool_fn_t fn, void *ctx) {
+    if (n == 0) {
+        return;
+    }
+    thread_pool_worker_t *caller = &pool->workers[0];
+    if (grain == 0) {
+        grain = 1;
+    }
+    if (n <= grain || pool->num_workers == 1) {
+        // Not worth waking anyone: run the whole range, still chunked.
+        for (size_t begin = 0; begin < n; begin += grain) {
+            thread_pool_range_t range = {begin, begin + MIN(grain, n - begin)};
+            thread_pool_call(fn, ctx, range, &caller->scratch);
+        }
+        return;
+    }
+    assert(atomic_load(&pool->remaining) == 0 &&
+           "One parallel loop at a time per pool.");
+    pool->fn = fn;
+    pool->ctx = ctx;
+    pool->grain = grain;
+    atomic_store_explicit(&pool->remaining, n, memory_order_release);
+
+    pthread_mutex_lock(&pool->mutex);
+    ++pool->generation;
+    pthread_cond_broadcast(&pool->wake);
+    pthread_mutex_unlock(&pool->mutex);
+
+    thread_pool_run(caller, (thread_pool_range_t){0, n});
+    thread_pool_work(caller);
+}
+
+#endif // THREAD_POOL_H
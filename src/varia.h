@@ -1,12 +1,19 @@
 #ifndef VARIA_H
 #define VARIA_H
 
+// NOTE: MAP_ANONYMOUS is not part of strict ISO C.
+#ifndef _DEFAULT_SOURCE
+#define _DEFAULT_SOURCE
+#endif // _DEFAULT_SOURCE
+
 #include <assert.h>
 #include <stdarg.h>
+#include <stddef.h>
 #include <stdio.h>
+#include <sys/mman.h>
 
 #define VARIA_DEF static inline
-#define VARIA_TEMP_CAPACITY (8 * 1024 * 1024) // 8 MB "internal stack" capacity
+#define VARIA_TEMP_CAPACITY (8 * 1024 * 1024) // 8 MB default arena block size
 
 #define ARRAY_LEN(xs) (sizeof(xs) / sizeof(xs[0]))
 
@@ -17,35 +24,214 @@
 
 typedef unsigned long uintptr_t; // NOTE: might be dangerous.
 
-static size_t varia_temp_size = 0;
-static char varia_temp_stack[VARIA_TEMP_CAPACITY] = {0};
+/* Arena (linear) allocator made of a chain of mmap-backed blocks. A new block
+ * is mapped whenever the current one is full, so allocations only fail when
+ * the system runs out of memory. Allocations are released all at once, either
+ * completely (`varia_arena_reset`, `varia_arena_free`) or back to a previously
+ * saved mark (`varia_arena_restore`), which gives scoped temporary storage:
+ *
+ *     varia_arena_mark_t mark = varia_arena_mark(&arena);
+ *     float *xs = varia_arena_alloc_aligned(&arena, n * sizeof(*xs), 32);
+ *     ...
+ *     varia_arena_restore(&arena, mark);
+ *
+ * An arena is not thread-safe; use one arena per thread instead (see
+ * `varia_temp_arena`).
+ */
 
-VARIA_DEF void *varia_temp_alloc(size_t requested) {
-    size_t word_size = sizeof(uintptr_t);
-    // NOTE: floor with "multiply by one" trick.
-    size_t size = (requested + word_size - 1) / word_size * word_size;
-    if (varia_temp_size + size > VARIA_TEMP_CAPACITY) {
+typedef struct varia_arena_block_t {
+    struct varia_arena_block_t *prev;
+    size_t size;     // Bytes in use in `data`.
+    size_t capacity; // Bytes available in `data`.
+    char data[];
+} varia_arena_block_t;
+
+typedef struct {
+    varia_arena_block_t *current;
+    size_t block_size; // Minimum block capacity (0 means VARIA_TEMP_CAPACITY).
+} varia_arena_t;
+
+typedef struct {
+    varia_arena_block_t *block;
+    size_t size;
+} varia_arena_mark_t;
+
+VARIA_DEF varia_arena_block_t *varia_arena_block_new(size_t capacity) {
+    size_t bytes = sizeof(varia_arena_block_t) + capacity;
+    void *memory = mmap(NULL, bytes, PROT_READ | PROT_WRITE,
+                        MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (memory == MAP_FAILED) {
+        return NULL;
+    }
+    varia_arena_block_t *block = memory;
+    block->prev = NULL;
+    block->size = 0;
+    block->capacity = capacity;
+    return block;
+}
+
+VARIA_DEF void varia_arena_block_free(varia_arena_block_t *block) {
+    munmap(block, sizeof(varia_arena_block_t) + block->capacity);
+}
+
+// NOTE: `alignment` must be a power of two no greater than the page size
+// (e.g. 16, 32 or 64 for SIMD data).
+VARIA_DEF void *varia_arena_alloc_aligned(varia_arena_t *arena,
+                                          size_t requested, size_t alignment) {
+    assert(alignment > 0 && (alignment & (alignment - 1)) == 0 &&
+           "Alignment must be a power of two.");
+    varia_arena_block_t *block = arena->current;
+    if (block != NULL) {
+        uintptr_t base = (uintptr_t)block->data;
+        uintptr_t start =
+            (base + block->size + alignment - 1) & ~(alignment - 1);
+        if (start - base + requested <= block->capacity) {
+            block->size = start - base + requested;
+            return (void *)start;
+        }
+    }
+
+    size_t capacity =
+        arena->block_size ? arena->block_size : VARIA_TEMP_CAPACITY;
+    if (requested + alignment > capacity) {
+        capacity = requested + alignment; // Oversized allocation: own block.
+    }
+    varia_arena_block_t *fresh = varia_arena_block_new(capacity);
+    if (fresh == NULL) {
         return NULL;
     }
-    void *result = &varia_temp_stack[varia_temp_size];
-    varia_temp_size += size;
+    fresh->prev = block;
+    arena->current = fresh;
+    return varia_arena_alloc_aligned(arena, requested, alignment);
+}
+
+VARIA_DEF void *varia_arena_alloc(varia_arena_t *arena, size_t requested) {
+    return varia_arena_alloc_aligned(arena, requested, sizeof(uintptr_t));
+}
+
+VARIA_DEF varia_arena_mark_t varia_arena_mark(const varia_arena_t *arena) {
+    varia_arena_mark_t mark = {.block = arena->current, .size = 0};
+    if (arena->current != NULL) {
+        mark.size = arena->current->size;
+    }
+    return mark;
+}
+
+// Releases everything allocated since `mark` was taken (blocks mapped since
+// then are returned to the system).
+VARIA_DEF void varia_arena_restore(varia_arena_t *arena,
+                                   varia_arena_mark_t mark) {
+    while (arena->current != mark.block) {
+        assert(arena->current != NULL && "Mark does not belong to the arena.");
+        varia_arena_block_t *prev = arena->current->prev;
+        varia_arena_block_free(arena->current);
+        arena->current = prev;
+    }
+    if (arena->current != NULL) {
+        arena->current->size = mark.size;
+    }
+}
+
+// Releases every allocation, but keeps the oldest block mapped for reuse.
+VARIA_DEF void varia_arena_reset(varia_arena_t *arena) {
+    while (arena->current != NULL && arena->current->prev != NULL) {
+        varia_arena_block_t *prev = arena->current->prev;
+        varia_arena_block_free(arena->current);
+        arena->current = prev;
+    }
+    if (arena->current != NULL) {
+        arena->current->size = 0;
+    }
+}
+
+VARIA_DEF void varia_arena_free(varia_arena_t *arena) {
+    varia_arena_restore(arena, (varia_arena_mark_t){0});
+}
+
+VARIA_DEF size_t varia_arena_used(const varia_arena_t *arena) {
+    size_t used = 0;
+    for (varia_arena_block_t *block = arena->current; block != NULL;
+         block = block->prev) {
+        used += block->size;
+    }
+    return used;
+}
+
+VARIA_DEF size_t varia_arena_capacity(const varia_arena_t *arena) {
+    size_t capacity = 0;
+    for (varia_arena_block_t *block = arena->current; block != NULL;
+         block = block->prev) {
+        capacity += block->capacity;
+    }
+    return capacity;
+}
+
+/* Formats into `arena` like vsprintf() and returns the null-terminated result
+ * (its length in `*size`, unless `size` is NULL). The string is formatted in
+ * place in the current block when it fits, so the common case is one pass.
+ */
+VARIA_DEF char *varia_arena_vsprintf(varia_arena_t *arena, size_t *size,
+                                     const char *fmt, va_list args) {
+    va_list retry;
+    va_copy(retry, args);
+    char *result = NULL;
+    int n = -1;
+    varia_arena_block_t *block = arena->current;
+    if (block != NULL) {
+        size_t available = block->capacity - block->size;
+        n = vsnprintf(block->data + block->size, available, fmt, args);
+        if (n >= 0 && (size_t)n < available) {
+            result = block->data + block->size;
+            block->size += n + 1;
+        }
+    } else {
+        n = vsnprintf(NULL, 0, fmt, args);
+    }
+    if (result == NULL) {
+        assert(n >= 0);
+        result = varia_arena_alloc_aligned(arena, n + 1, 1);
+        assert(result != NULL && "Out of memory for the arena.");
+        vsnprintf(result, n + 1, fmt, retry);
+    }
+    va_end(retry);
+    if (size != NULL) {
+        *size = n;
+    }
     return result;
 }
 
-VARIA_DEF char *varia_temp_sprintf(const char *fmt, ...) {
+VARIA_DEF char *varia_arena_sprintf(varia_arena_t *arena, const char *fmt,
+                                    ...) {
     va_list args;
     va_start(args, fmt);
-    int n = vsnprintf(NULL, 0, fmt, args);
+    char *result = varia_arena_vsprintf(arena, NULL, fmt, args);
     va_end(args);
+    return result;
+}
 
-    assert(n >= 0);
-    char *result = (char *)varia_temp_alloc(n + 1);
-    assert(result != NULL && "Extend the size of the temporary allocator.");
+// Per-thread temporary storage, so the `varia_temp_*` functions can be used
+// from worker threads without locking.
+static _Thread_local varia_arena_t varia_temp_arena = {0};
+
+VARIA_DEF void *varia_temp_alloc(size_t requested) {
+    return varia_arena_alloc(&varia_temp_arena, requested);
+}
+
+VARIA_DEF varia_arena_mark_t varia_temp_mark(void) {
+    return varia_arena_mark(&varia_temp_arena);
+}
 
+VARIA_DEF void varia_temp_restore(varia_arena_mark_t mark) {
+    varia_arena_restore(&varia_temp_arena, mark);
+}
+
+VARIA_DEF void varia_temp_reset(void) { varia_arena_reset(&varia_temp_arena); }
+
+VARIA_DEF char *varia_temp_sprintf(const char *fmt, ...) {
+    va_list args;
     va_start(args, fmt);
-    vsnprintf(result, n + 1, fmt, args);
+    char *result = varia_arena_vsprintf(&varia_temp_arena, NULL, fmt, args);
     va_end(args);
-
     return result;
 }
 
@@ -62,7 +248,7 @@ VARIA_DEF char *varia_strdup(const char *s) {
     while (s[len] != '\0') {
         ++len;
     }
-    char *result = varia_temp_alloc(len);
+    char *result = varia_temp_alloc(len + 1);
     char *ptr = result; // Iterate while leaving original pointer intact.
     while (*s) {
         *ptr++ = *s++;
@@ -300,6 +300,94 @@ void test_to_ascii(void) {
     assert(to_ascii(0x7F) == 0x7F);
 }
 
+// Arithmetic definitions the class table must agree with.
+static bool reference_class(int c, unsigned class_bit) {
+    unsigned u = (unsigned)c;
+    switch (class_bit) {
+    case CT_CNTRL:
+        return u < 0x20 || u == 0x7F;
+    case CT_SPACE:
+        return u == ' ' || u - '\t' < 5;
+    case CT_BLANK:
+        return u == ' ' || u == '\t';
+    case CT_UPPER:
+        return u - 'A' < 26;
+    case CT_LOWER:
+        return u - 'a' < 26;
+    case CT_DIGIT:
+        return u - '0' < 10;
+    case CT_HEX_LETTER:
+        return (u | 0x20) - 'a' < 6 && u < 0x80;
+    case CT_PUNCT:
+        return u - 0x21 < 0x5E && (u | 0x20) - 'a' >= 26 && u - '0' >= 10;
+    case CT_PRINT_SPACE:
+        return u == ' ';
+    default:
+        return false;
+    }
+}
+
+void test_class_table(void) {
+    for (int c = -1; c < 300; ++c) {
+        for (unsigned bit = 0; bit < CT_NUM_CLASSES; ++bit) {
+            unsigned class_bit = 1u << bit;
+            assert(ct_is(c, class_bit) == reference_class(c, class_bit));
+            if (c >= 0 && c < 256) {
+                bool in_nibble_table = (ct_nibble_table[bit][c & 0xF] &
+                                        ct_high_nibble_bits[c >> 4]) != 0;
+                assert(in_nibble_table == ct_is(c, class_bit));
+            }
+        }
+    }
+    assert(ct_class('7') == CT_DIGIT);
+    assert(ct_class('b') == (CT_LOWER | CT_HEX_LETTER));
+    assert(ct_is('_', CT_GRAPH) && !ct_is('_', CT_ALNUM));
+}
+
+void test_classify_buffer(void) {
+    unsigned char buf[256 + 7];
+    unsigned short classes[sizeof(buf)];
+    for (unsigned long i = 0; i < sizeof(buf); ++i) {
+        buf[i] = (unsigned char)(i * 37 + 11); // Every byte, shuffled.
+    }
+    ct_classify_buffer(buf, sizeof(buf), classes);
+    for (unsigned long i = 0; i < sizeof(buf); ++i) {
+        assert(classes[i] == ct_class(buf[i]));
+    }
+}
+
+void test_to_lower_buffer(void) {
+    unsigned char buf[256 + 7];
+    unsigned char lower[sizeof(buf)];
+    for (unsigned long i = 0; i < sizeof(buf); ++i) {
+        buf[i] = (unsigned char)(i * 37 + 11);
+    }
+    ct_to_lower_buffer(buf, sizeof(buf), lower);
+    for (unsigned long i = 0; i < sizeof(buf); ++i) {
+        assert(lower[i] == to_lower(buf[i]));
+    }
+    ct_to_lower_buffer(buf, sizeof(buf), buf); // In place
+    for (unsigned long i = 0; i < sizeof(buf); ++i) {
+        assert(buf[i] == lower[i]);
+    }
+}
+
+void test_span_while(void) {
+    const unsigned char number[] = "12345678901234567890123456789012345678x9";
+    assert(ct_span_while(number, sizeof(number) - 1, CT_DIGIT) == 38);
+    assert(ct_span_while(number, 5, CT_DIGIT) == 5);
+    assert(ct_span_while(number, sizeof(number) - 1, CT_ALNUM) == 40);
+    assert(ct_span_while(number, sizeof(number) - 1, CT_SPACE) == 0);
+    assert(ct_span_while(number, 0, CT_DIGIT) == 0);
+
+    const unsigned char text[] = " \t\n  \r\n\v\f                     \xC3\xA9";
+    assert(ct_span_while(text, sizeof(text) - 1, CT_SPACE) ==
+           sizeof(text) - 3);
+    assert(ct_span_while(text, sizeof(text) - 1, CT_SPACE | CT_CNTRL) ==
+           sizeof(text) - 3);
+    assert(ct_span_while(text, sizeof(text) - 1, CT_BLANK) == 2);
+}
+
 int main(void) {
     test_is_alpha();
     test_is_digit();
@@ -317,6 +405,10 @@ int main(void) {
     test_to_lower();
     test_to_upper();
     test_to_ascii();
+    test_class_table();
+    test_classify_buffer();
+    test_to_lower_buffer();
+    test_span_while();
 
     printf("All tests passed!\n");
     return 0;
@@ -0,0 +1,585 @@
+#include <assert.h>
+#include <stdalign.h>
+#include <stdio.h>
+#include <string.h>
+
+#define LINALG_IMPLEMENTATION
+#include "../linalg.h"
+
+#define ARRAY_LEN(xs) (sizeof(xs) / sizeof(xs[0]))
+#define EPSILON 1e-5f
+
+static const mat4f_t A = {.M = {{1, 2, 3, 4},
+                                {5, 6, 7, 8},
+                                {9, 10, 11, 12},
+                                {13, 14, 15, 16}}};
+
+static const mat4f_t B = {.M = {{2, 0, 1, 0},
+                                {0, 3, 0, 1},
+                                {1, 0, 4, 0},
+                                {0, 1, 0, 5}}};
+
+void test_vec4f_layout(void) {
+#ifdef LINALG_SIMD
+    static_assert(alignof(vec4f_t) == 16, "vec4f_t must be SSE aligned.");
+    static_assert(alignof(mat4f_t) == 16, "mat4f_t must be SSE aligned.");
+#endif // LINALG_SIMD
+    static_assert(sizeof(vec4f_t) == 4 * sizeof(float), "Padded vec4f_t.");
+    static_assert(sizeof(mat4f_t) == 16 * sizeof(float), "Padded mat4f_t.");
+
+    vec4f_t v = vec4f(1, 2, 3, 4);
+    assert(v.x == 1 && v.y == 2 && v.z == 3 && v.w == 4);
+    assert(v.r == 1 && v.a == 4);
+    assert(v.e[2] == 3);
+    assert(A.v[1].y == 6 && A._23 == 7 && A.e[15] == 16);
+}
+
+void test_vec4f_operations(void) {
+    vec4f_t a = vec4f(1, 2, 3, 4);
+    vec4f_t b = vec4f(8, 6, 4, 2);
+
+    assert(vec4f_eq(vec4f_add(a, b), vec4f(9, 8, 7, 6), EPSILON));
+    assert(vec4f_eq(vec4f_sub(a, b), vec4f(-7, -4, -1, 2), EPSILON));
+    assert(vec4f_eq(vec4f_mul(a, b), vec4f(8, 12, 12, 8), EPSILON));
+    assert(vec4f_eq(vec4f_div(b, a), vec4f(8, 3, 4.0f / 3.0f, 0.5f), EPSILON));
+    assert(fabsf(vec4f_dot(a, b) - 40) < EPSILON);
+}
+
+void test_mat4f_mul(void) {
+    mat4f_t C = mat4f_mul(A, B);
+    for (size_t i = 0; i < 4; ++i) {
+        for (size_t j = 0; j < 4; ++j) {
+            float expected = 0;
+            for (size_t k = 0; k < 4; ++k) {
+                expected += A.M[i][k] * B.M[k][j];
+            }
+            assert(fabsf(C.M[i][j] - expected) < EPSILON);
+        }
+    }
+
+    C = mat4f_mul(A, mat4f_I());
+    for (size_t i = 0; i < 16; ++i) {
+        assert(C.e[i] == A.e[i]);
+    }
+}
+
+void test_mat4f_mul_vec(void) {
+    vec4f_t v = vec4f(1, -1, 2, 0.5f);
+    vec4f_t result = mat4f_mul_vec(A, v);
+    assert(vec4f_eq(result, vec4f(7, 17, 27, 37), EPSILON));
+}
+
+void test_pointer_variants(void) {
+    mat4f_t C;
+    mat4f_mul_to(&C, &A, &B);
+    mat4f_t expected = mat4f_mul(A, B);
+    for (size_t i = 0; i < 16; ++i) {
+        assert(fabsf(C.e[i] - expected.e[i]) < EPSILON);
+    }
+
+    vec4f_t v = vec4f(1, -1, 2, 0.5f), result;
+    mat4f_mul_vec_to(&result, &A, &v);
+    assert(vec4f_eq(result, mat4f_mul_vec(A, v), EPSILON));
+
+    vec4f_t a = vec4f(1, 2, 3, 4);
+    vec4f_add_assign(&a, vec4f_splat(1));
+    assert(vec4f_eq(a, vec4f(2, 3, 4, 5), EPSILON));
+    vec4f_mul_to(&result, &a, &v);
+    assert(vec4f_eq(result, vec4f(2, -3, 8, 2.5f), EPSILON));
+
+    mat4f_hadamard_to(&C, &A, &B);
+    assert(C._11 == 2 && C._22 == 18 && C._33 == 44 && C._44 == 80);
+    assert(C._12 == 0 && C._24 == 8);
+
+    mat4f_rotate_to(&C, &A, AXIS_Y, 0.3f);
+    mat4f_t rotated = A;
+    mat4f_rotate_assign(&rotated, AXIS_Y, 0.3f);
+    expected = mat4f_rotate(A, AXIS_Y, 0.3f);
+    for (size_t i = 0; i < 16; ++i) {
+        assert(C.e[i] == expected.e[i] && rotated.e[i] == expected.e[i]);
+    }
+    const mat2d_t M = {.M = {{1, 2}, {3, 4}}};
+    mat2d_t R = M;
+    mat2d_rotate_assign(&R, 0.5);
+    mat2d_t expected_2d = mat2d_rotate(M, 0.5);
+    for (size_t i = 0; i < 4; ++i) {
+        assert(R.e[i] == expected_2d.e[i]);
+    }
+}
+
+void test_array_reductions(void) {
+    vec3d_t xs[21];
+    vec3d_t expected_sum = {0};
+    vec3d_t expected_product = vec3d_splat(1);
+    for (size_t i = 0; i < ARRAY_LEN(xs); ++i) {
+        xs[i] = vec3d(1.0 + 0.01 * (double)i, -2.0, 0.5 * (double)(i % 3));
+        expected_sum = vec3d_add(expected_sum, xs[i]);
+        expected_product = vec3d_mul(expected_product, xs[i]);
+    }
+    assert(vec3d_eq(vec3d_sum_array(xs, ARRAY_LEN(xs)), expected_sum, 1e-9));
+    assert(vec3d_eq(vec3d_product_array(xs, ARRAY_LEN(xs)), expected_product,
+                    1e-9));
+    assert(vec3d_eq(vec3d_sum_array(xs, 0), vec3d_splat(0), 0));
+
+    mat4f_t Ms[5] = {A, B, mat4f_I(), B, A};
+    mat4f_t chain = mat4f_mul_chain(Ms, ARRAY_LEN(Ms));
+    mat4f_t expected = mat4f_nmul(5, A, B, mat4f_I(), B, A);
+    for (size_t i = 0; i < 16; ++i) {
+        float tolerance = 1e-6f * fabsf(expected.e[i]);
+        assert(fabsf(chain.e[i] - expected.e[i]) <= tolerance);
+    }
+}
+
+void test_mat4f_transform_array(void) {
+    // Odd count exercises both the unrolled loop and the remainder.
+    vec4f_t in[7], out[7];
+    for (size_t i = 0; i < ARRAY_LEN(in); ++i) {
+        in[i] = vec4f((float)i, 1 - (float)i, 0.5f * (float)i, 1);
+    }
+    mat4f_transform_array(&A, in, out, ARRAY_LEN(in));
+    for (size_t i = 0; i < ARRAY_LEN(in); ++i) {
+        assert(vec4f_eq(out[i], mat4f_mul_vec(A, in[i]), EPSILON));
+    }
+}
+
+void test_vec3f_soa(void) {
+    vec3f_t points[5] = {{{1, 2, 3}}, {{-1, 0, 1}}, {{4, 4, 2}},
+                         {{0, 0, 0}}, {{3, -2, 6}}};
+    float xs[5], ys[5], zs[5], dots[5];
+    vec3f_soa_t soa = {.x = xs, .y = ys, .z = zs, .n = ARRAY_LEN(points)};
+    vec3f_soa_from_aos(soa, points);
+    assert(soa.y[2] == 4 && soa.z[4] == 6);
+
+    vec3f_soa_add(soa, soa, soa);
+    vec3f_soa_dot(dots, soa, soa);
+    for (size_t i = 0; i < soa.n; ++i) {
+        assert(fabsf(dots[i] - 4 * vec3f_dot(points[i], points[i])) < EPSILON);
+    }
+
+    mat3f_t M = {.M = {{0, -1, 0}, {1, 0, 0}, {0, 0, 2}}};
+    vec3f_t transformed[5];
+    mat3f_mul_vec_soa(soa, M, soa);
+    vec3f_soa_to_aos(transformed, soa);
+    for (size_t i = 0; i < soa.n; ++i) {
+        vec3f_t expected = mat3f_mul_vec(M, vec3f_add(points[i], points[i]));
+        assert(vec3f_eq(transformed[i], expected, EPSILON));
+    }
+}
+
+static vec3f_t vec3f_soa_at(vec3f_soa_t v, size_t i) {
+    return vec3f(v.x[i], v.y[i], v.z[i]);
+}
+
+void test_vec3f_soa_kernels(void) {
+    // Not a multiple of any SIMD width, so the tail loops run too.
+    enum { N = 19 };
+    float ax[N], ay[N], az[N], bx[N], by[N], bz[N], ox[N], oy[N], oz[N];
+    float norms[N];
+    vec3f_soa_t a = {.x = ax, .y = ay, .z = az, .n = N};
+    vec3f_soa_t b = {.x = bx, .y = by, .z = bz, .n = N};
+    vec3f_soa_t out = {.x = ox, .y = oy, .z = oz, .n = N};
+    for (size_t i = 0; i < N; ++i) {
+        ax[i] = (float)i * 0.75f - 6;
+        ay[i] = (float)(i % 5) - 2.5f;
+        az[i] = 3 - (float)(i % 7) * 1.25f;
+        bx[i] = 1.5f + (float)(i % 3);
+        by[i] = -0.5f - (float)(i % 4);
+        bz[i] = 0.25f * (float)(i + 1);
+    }
+
+    vec3f_soa_2norm(norms, a);
+    vec3f_soa_unit(out, a);
+    for (size_t i = 0; i < N; ++i) {
+        vec3f_t v = vec3f_soa_at(a, i);
+        assert(fabsf(norms[i] - vec3f_2norm(v)) < EPSILON);
+        assert(vec3f_eq(vec3f_soa_at(out, i), vec3f_unit(v), EPSILON));
+    }
+    vec3f_soa_mod(out, a, b);
+    for (size_t i = 0; i < N; ++i) {
+        vec3f_t expected = vec3f_mod(vec3f_soa_at(a, i), vec3f_soa_at(b, i));
+        assert(vec3f_eq(vec3f_soa_at(out, i), expected, EPSILON));
+    }
+
+    // The component-wise functions.
+    vec3f_soa_floor(out, a);
+    for (size_t i = 0; i < N; ++i) {
+        assert(vec3f_eq(vec3f_soa_at(out, i), vec3f_floor(vec3f_soa_at(a, i)),
+                        EPSILON));
+    }
+    vec3f_soa_abs(out, a);
+    for (size_t i = 0; i < N; ++i) {
+        assert(vec3f_eq(vec3f_soa_at(out, i), vec3f_abs(vec3f_soa_at(a, i)),
+                        EPSILON));
+    }
+    vec3f_soa_min(out, a, b);
+    for (size_t i = 0; i < N; ++i) {
+        vec3f_t expected = vec3f_min(vec3f_soa_at(a, i), vec3f_soa_at(b, i));
+        assert(vec3f_eq(vec3f_soa_at(out, i), expected, EPSILON));
+    }
+    // Between -|b| and |b|.
+    float lx[N], ly[N], lz[N], hx[N], hy[N], hz[N];
+    vec3f_soa_t low = {.x = lx, .y = ly, .z = lz, .n = N};
+    vec3f_soa_t high = {.x = hx, .y = hy, .z = hz, .n = N};
+    vec3f_soa_abs(high, b);
+    for (size_t i = 0; i < N; ++i) {
+        lx[i] = -hx[i], ly[i] = -hy[i], lz[i] = -hz[i];
+    }
+    vec3f_soa_clamp(out, a, low, high);
+    for (size_t i = 0; i < N; ++i) {
+        vec3f_t expected = vec3f_clamp(vec3f_soa_at(a, i), vec3f_soa_at(low, i),
+                                       vec3f_soa_at(high, i));
+        assert(vec3f_eq(vec3f_soa_at(out, i), expected, EPSILON));
+    }
+}
+
+void test_vec3f_cross(void) {
+    vec3f_t x = vec3f(1, 0, 0), y = vec3f(0, 1, 0), z = vec3f(0, 0, 1);
+    assert(vec3f_eq(vec3f_cross(x, y), z, 0));
+    assert(vec3f_eq(vec3f_cross(y, z), x, 0));
+    assert(vec3f_eq(vec3f_cross(z, x), y, 0));
+    assert(vec3f_eq(vec3f_cross(vec3f(1, 2, 3), vec3f(4, 5, 6)),
+                    vec3f(-3, 6, -3), 0));
+}
+
+static bool mat4f_eq(mat4f_t A, mat4f_t B, float epsilon) {
+    for (size_t i = 0; i < 16; ++i) {
+        if (fabsf(A.e[i] - B.e[i]) >= epsilon) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void test_mat_transpose(void) {
+    mat4f_t T = mat4f_transpose(A);
+    mat3d_t M = {.M = {{1, 2, 3}, {4, 5, 6}, {7, 8, 9}}};
+    mat3d_t U = mat3d_transpose(M);
+    for (size_t i = 0; i < 4; ++i) {
+        for (size_t j = 0; j < 4; ++j) {
+            assert(T.M[i][j] == A.M[j][i]);
+            assert(i >= 3 || j >= 3 || U.M[i][j] == M.M[j][i]);
+        }
+    }
+}
+
+void test_mat_det(void) {
+    assert(mat2f_det((mat2f_t){.M = {{1, 2}, {3, 4}}}) == -2);
+    assert(mat3d_det((mat3d_t){.M = {{2, 0, 1}, {1, 3, 2}, {1, 1, 2}}}) == 6);
+    assert(fabsf(mat4f_det(A)) < EPSILON); // Rows in arithmetic progression.
+    assert(fabsf(mat4f_det(B) - 98) < EPSILON);
+    assert(mat4d_det(mat4d_I()) == 1);
+}
+
+void test_mat_inverse(void) {
+    const mat4f_t C = {.M = {{4, 7, 2, 3},
+                             {0, 5, 0, 1},
+                             {1, 2, 9, 4},
+                             {3, 0, 1, 6}}};
+    assert(mat4f_eq(mat4f_mul(B, mat4f_inverse(B)), mat4f_I(), 1e-4f));
+    assert(mat4f_eq(mat4f_mul(mat4f_inverse(C), C), mat4f_I(), 1e-4f));
+
+    mat4d_t D = {.M = {{4, 7, 2, 3}, {0, 5, 0, 1}, {1, 2, 9, 4}, {3, 0, 1, 6}}};
+    mat4d_t I4 = mat4d_mul(D, mat4d_inverse(D));
+    mat3f_t M3 = {.M = {{2, 0, 1}, {1, 3, 2}, {1, 1, 2}}};
+    mat3f_t I3 = mat3f_mul(M3, mat3f_inverse(M3));
+    mat2d_t M2 = {.M = {{1, 2}, {3, 4}}};
+    mat2d_t I2 = mat2d_mul(mat2d_inverse(M2), M2);
+    for (size_t i = 0; i < 4; ++i) {
+        for (size_t j = 0; j < 4; ++j) {
+            assert(fabs(I4.M[i][j] - (i == j)) < 1e-12);
+            assert(i >= 3 || j >= 3 || fabsf(I3.M[i][j] - (i == j)) < EPSILON);
+            assert(i >= 2 || j >= 2 || fabs(I2.M[i][j] - (i == j)) < 1e-12);
+        }
+    }
+
+    mat4f_t in[5] = {B, C, mat4f_I(), C, B};
+    mat4f_t out[5];
+    mat4f_inverse_array(in, out, ARRAY_LEN(in));
+    for (size_t i = 0; i < ARRAY_LEN(in); ++i) {
+        assert(mat4f_eq(out[i], mat4f_inverse(in[i]), EPSILON));
+    }
+}
+
+void test_mat4f_inverse_affine(void) {
+    quatf_t q = quatf_from_axis_angle(vec3f_unit(vec3f(1, -2, 3)), 0.8f);
+    mat4f_t M = quatf_to_mat4(q);
+    M._14 = 3;
+    M._24 = -1;
+    M._34 = 0.5f;
+    mat4f_t inverse = mat4f_inverse_affine(M);
+    assert(mat4f_eq(inverse, mat4f_inverse(M), EPSILON));
+    assert(mat4f_eq(mat4f_mul(M, inverse), mat4f_I(), EPSILON));
+
+    mat4f_t in[3] = {M, mat4f_I(), M};
+    mat4f_t out[3];
+    mat4f_inverse_affine_array(in, out, ARRAY_LEN(in));
+    assert(mat4f_eq(out[0], inverse, EPSILON));
+    assert(mat4f_eq(out[1], mat4f_I(), EPSILON));
+}
+
+void test_mat_rect(void) {
+    // A rotation and a translation, as a 3x4 affine transform.
+    quatf_t q = quatf_from_axis_angle(vec3f_unit(vec3f(2, 1, -1)), 1.3f);
+    mat4f_t M = quatf_to_mat4(q);
+    M._14 = -2;
+    M._24 = 0.5f;
+    M._34 = 4;
+    mat3x4f_t affine = mat3x4f_from_mat4f(M);
+    static_assert(sizeof(mat3x4f_t) == 12 * sizeof(float), "Padded mat3x4f_t.");
+    assert(affine._23 == M._23 && affine.M[2][3] == 4 && affine.e[4] == M._21);
+    assert(mat4f_eq(mat3x4f_to_mat4f(affine), M, EPSILON));
+
+    // Transforms a tail shorter than the unrolled loop as well.
+    enum { N = 11 };
+    vec3f_t in[N], out[N];
+    for (size_t i = 0; i < N; ++i) {
+        in[i] = vec3f((float)i, 1 - (float)i, 0.5f * (float)(i % 3));
+    }
+    mat3x4f_transform_affine_array(&affine, in, out, N);
+    for (size_t i = 0; i < N; ++i) {
+        vec4f_t p = mat4f_mul_vec(M, vec4f(in[i].x, in[i].y, in[i].z, 1));
+        assert(vec3f_eq(out[i], vec3f(p.x, p.y, p.z), EPSILON));
+        assert(vec3f_eq(mat3x4f_transform_affine(affine, in[i]), out[i],
+                        EPSILON));
+    }
+    la_transform(&affine, in, out, 1);
+    assert(vec3f_eq(out[0], mat3x4f_transform_affine(affine, in[0]), EPSILON));
+
+    // Composition matches the product of the 4x4 matrices.
+    mat4f_t N4 = mat4f_mul(B, M);
+    N4._41 = N4._42 = N4._43 = 0;
+    N4._44 = 1;
+    mat3x4f_t product = mat3x4f_mul_affine(mat3x4f_from_mat4f(N4), affine);
+    assert(mat4f_eq(mat3x4f_to_mat4f(product), mat4f_mul(N4, M), 1e-4f));
+
+    // General products, checked against the 4x4 product of padded matrices.
+    mat4x3f_t T = mat3x4f_transpose(affine);
+    assert(T._41 == affine._14 && T._13 == affine._31);
+    mat3f_t square = mat3x4f_mul_mat4x3f(affine, T);
+    mat4f_t padded = mat3x4f_to_mat4f(affine);
+    mat4f_t expected = mat4f_mul(padded, mat4f_transpose(padded));
+    for (size_t i = 0; i < 3; ++i) {
+        for (size_t j = 0; j < 3; ++j) {
+            assert(fabsf(square.M[i][j] - expected.M[i][j]) <= EPSILON);
+        }
+    }
+    assert(vec3f_eq(la_mul(affine, vec4f(1, 2, 3, 1)),
+                    mat3x4f_transform_affine(affine, vec3f(1, 2, 3)), EPSILON));
+    mat3f_t via_generic = la_mul(affine, la_transpose(affine));
+    assert(memcmp(&via_generic, &square, sizeof(square)) == 0);
+
+    mat2x3f_t R = {.M = {{1, 2, 3}, {4, 5, 6}}};
+    vec2f_t v = mat2x3f_mul_vec(R, vec3f(1, 0, -1));
+    assert(v.x == -2 && v.y == -2);
+    mat2f_t RRt = la_mul(R, la_transpose(R));
+    assert(RRt._11 == 14 && RRt._12 == 32 && RRt._21 == 32 && RRt._22 == 77);
+    mat2x3f_t I = mat2x3f_I();
+    assert(I._11 == 1 && I._22 == 1 && I._13 == 0 && I._23 == 0);
+}
+
+static bool quatf_same_rotation(quatf_t a, quatf_t b) {
+    // q and -q represent the same rotation.
+    if (vec4f_dot(a.v, b.v) < 0) {
+        b = quatf(-b.x, -b.y, -b.z, -b.w);
+    }
+    return vec4f_eq(a.v, b.v, EPSILON);
+}
+
+void test_quatf(void) {
+    const vec3f_t z = vec3f(0, 0, 1);
+    mat3f_t Q = quatf_to_mat3(quatf_from_axis_angle(z, 0.7f));
+    mat3f_t R = mat3f_R(AXIS_Z, 0.7f);
+    for (size_t i = 0; i < 9; ++i) {
+        assert(fabsf(Q.e[i] - R.e[i]) < EPSILON);
+    }
+
+    quatf_t a = quatf_from_axis_angle(vec3f_unit(vec3f(1, 2, 3)), 1.1f);
+    quatf_t b = quatf_from_axis_angle(vec3f_unit(vec3f(-2, 0, 1)), -0.4f);
+    quatf_t ab = quatf_mul(a, b);
+    vec3f_t v = vec3f(0.5f, -1, 2);
+    vec3f_t expected = quatf_rotate_vec(a, quatf_rotate_vec(b, v));
+    assert(vec3f_eq(quatf_rotate_vec(ab, v), expected, EPSILON));
+    mat3f_t M = mat3f_mul(quatf_to_mat3(a), quatf_to_mat3(b));
+    assert(vec3f_eq(mat3f_mul_vec(M, v), expected, EPSILON));
+    mat4f_t M4 = quatf_to_mat4(ab);
+    vec4f_t v4 = mat4f_mul_vec(M4, vec4f(v.x, v.y, v.z, 1));
+    assert(vec4f_eq(v4, vec4f(expected.x, expected.y, expected.z, 1), EPSILON));
+
+    assert(quatf_same_rotation(quatf_mul(a, quatf_conjugate(a)),
+                               quatf_identity()));
+    assert(vec4f_eq(quatf_inverse(a).v, quatf_conjugate(a).v, EPSILON));
+    assert(vec4f_eq(quatf_normalize(quatf(0, 3, 0, 4)).v,
+                    vec4f(0, 0.6f, 0, 0.8f), EPSILON));
+
+    // Rotations by almost pi go through every branch of the conversion.
+    quatf_t rotations[] = {
+        ab,
+        quatf_from_axis_angle(vec3f(1, 0, 0), 3),
+        quatf_from_axis_angle(vec3f(0, 1, 0), 3),
+        quatf_from_axis_angle(z, 3),
+    };
+    for (size_t i = 0; i < ARRAY_LEN(rotations); ++i) {
+        quatf_t q = rotations[i];
+        assert(quatf_same_rotation(quatf_from_mat3(quatf_to_mat3(q)), q));
+        assert(quatf_same_rotation(quatf_from_mat4(quatf_to_mat4(q)), q));
+    }
+
+    quatf_t start = quatf_identity();
+    quatf_t end = quatf_from_axis_angle(z, 1.2f);
+    quatf_t halfway = quatf_from_axis_angle(z, 0.6f);
+    assert(quatf_same_rotation(quatf_slerp(start, end, 0), start));
+    assert(quatf_same_rotation(quatf_slerp(start, end, 1), end));
+    assert(quatf_same_rotation(quatf_slerp(start, end, 0.5f), halfway));
+    assert(quatf_same_rotation(quatf_nlerp(start, end, 0.5f), halfway));
+    // Shortest path, even when `end` is given in the other hemisphere.
+    quatf_t flipped = quatf(-end.x, -end.y, -end.z, -end.w);
+    assert(quatf_same_rotation(quatf_slerp(start, flipped, 0.5f), halfway));
+}
+
+void test_fast_variants(void) {
+    for (float angle = -7; angle <= 7; angle += 0.25f) {
+        assert(mat4f_eq(mat4f_R_fast(AXIS_Y, angle), mat4f_R(AXIS_Y, angle),
+                        EPSILON));
+        assert(mat4f_eq(mat4f_rotate_fast(A, AXIS_X, angle),
+                        mat4f_rotate(A, AXIS_X, angle), 1e-4f));
+        mat2f_t R = mat2f_R_fast(angle), expected = mat2f_R(angle);
+        assert(fabsf(R._12 - expected._12) < EPSILON);
+    }
+    vec4f_t v = vec4f(3, -4, 12, 0.5f);
+    vec4f_t u = vec4f_unit_fast(v);
+    assert(vec4f_eq(u, vec4f_unit(v), EPSILON));
+    assert(fabsf(vec4f_2norm(u) - 1) < EPSILON);
+    assert(vec3f_eq(vec3f_unit_fast(vec3f(1e-3f, 2e-3f, 0)),
+                    vec3f_unit(vec3f(1e-3f, 2e-3f, 0)), EPSILON));
+
+    vec3f_t a = vec3f(1, 2, 3), b = vec3f(-2, 0.5f, 1);
+    assert(fabsf(vec3f_angle_between_fast(a, b) - vec3f_angle_between(a, b)) <
+           1e-5f);
+    // Parallel vectors, where rounding pushes the cosine past 1.
+    assert(vec3f_angle_between_fast(a, vec3f(3, 6, 9)) < 1e-3f);
+    // acos is ill-conditioned at -1: one ulp on the cosine costs ~3e-4 rad.
+    assert(fabsf(vec2f_angle_between_fast(vec2f(1, 0), vec2f(-1, 0)) - pi_f) <
+           1e-3f);
+}
+
+// Written once, for any precision: the `la_*` calls follow the argument types.
+#define TRIANGLE_NORMAL(a, b, c) la_unit(la_cross(la_sub(b, a), la_sub(c, a)))
+
+void test_generic(void) {
+    vec3f_t nf = TRIANGLE_NORMAL(vec3f(0, 0, 0), vec3f(2, 0, 0),
+                                 vec3f(0, 3, 0));
+    vec3d_t nd = TRIANGLE_NORMAL(vec3d(0, 0, 0), vec3d(2, 0, 0),
+                                 vec3d(0, 3, 0));
+    assert(vec3f_eq(nf, vec3f(0, 0, 1), EPSILON));
+    assert(vec3d_eq(nd, vec3d(0, 0, 1), 1e-12));
+    static_assert(_Generic(la_dot(nd, nd), double: true, default: false),
+                  "Resolved to the double precision function.");
+    assert(la_dot(nf, nf) == vec3f_dot(nf, nf));
+    assert(la_length(vec2d(3, 4)) == 5);
+    vec2i_t sum = la_add(vec2i(1, 2), vec2i(3, -4));
+    assert(sum.x == 4 && sum.y == -2);
+    assert(vec4f_eq(la_mul(vec4f(1, 2, 3, 4), vec4f(2, 2, 2, 2)),
+                    vec4f(2, 4, 6, 8), EPSILON));
+
+    // Matrix product of a matrix or a vector, depending on the second type.
+    assert(mat4f_eq(la_mul(A, B), mat4f_mul(A, B), EPSILON));
+    vec4f_t v = vec4f(1, -1, 2, 0.5f);
+    assert(vec4f_eq(la_mul(A, v), mat4f_mul_vec(A, v), EPSILON));
+    assert(mat4f_eq(la_transpose(A), mat4f_transpose(A), EPSILON));
+    assert(mat4f_eq(la_mul(la_inverse(B), B), mat4f_I(), 1e-4f));
+    quatf_t q = quatf_from_axis_angle(vec3f(0, 0, 1), 0.5f);
+    assert(quatf_same_rotation(la_mul(q, la_inverse(q)), quatf_identity()));
+
+    vec4f_t in[3] = {v, vec4f(0, 1, 0, 1), vec4f(2, 0, 0, 1)}, out[3];
+    la_transform(&A, in, out, ARRAY_LEN(in));
+    for (size_t i = 0; i < ARRAY_LEN(in); ++i) {
+        assert(vec4f_eq(out[i], mat4f_mul_vec(A, in[i]), EPSILON));
+    }
+}
+
+void test_half(void) {
+    // Every half converts to a float and back exactly (NaNs aside).
+    for (unsigned bits = 0; bits <= 0xFFFF; ++bits) {
+        float x = linalg_half_to_float((half_t)bits);
+        if (isnan(x)) {
+            assert((bits & 0x7C00) == 0x7C00 && (bits & 0x3FF) != 0);
+            continue;
+        }
+        assert(linalg_float_to_half(x) == bits);
+    }
+    assert(linalg_half_to_float(0x3C00) == 1);
+    assert(linalg_half_to_float(0xC000) == -2);
+    assert(linalg_half_to_float(0x0001) == 0x1p-24f); // Smallest subnormal.
+    assert(linalg_half_to_float(0x7BFF) == 65504);    // Largest finite.
+    assert(isinf(linalg_half_to_float(0xFC00)));
+    // Rounding to nearest even, overflow and underflow.
+    assert(linalg_float_to_half(1 + 0x1p-11f) == 0x3C00);
+    assert(linalg_float_to_half(1 + 3 * 0x1p-11f) == 0x3C02);
+    assert(linalg_float_to_half(65520) == 0x7C00);
+    assert(linalg_float_to_half(-1e9f) == 0xFC00);
+    assert(linalg_float_to_half(0x1p-26f) == 0);
+    assert(linalg_float_to_half(3 * 0x1p-26f) == 0x0001);
+    assert(linalg_float_to_half(NAN) == 0x7E00);
+
+    // Arrays (with a tail shorter than a SIMD iteration) match the scalar
+    // conversions, whichever path converts them.
+    enum { N = 103 };
+    vec3f_t f[N], widened[N];
+    vec3h_t h[N];
+    for (size_t i = 0; i < N; ++i) {
+        f[i] = vec3f((float)i / 7, -(float)i * 100.3f, 1e-6f * (float)i);
+    }
+    vec3h_from_vec3f_array(f, h, N);
+    vec3h_to_vec3f_array(h, widened, N);
+    for (size_t i = 0; i < N; ++i) {
+        vec3h_t expected = vec3h_from_vec3f(f[i]);
+        assert(memcmp(&h[i], &expected, sizeof(expected)) == 0);
+        vec3f_t back = vec3h_to_vec3f(h[i]);
+        assert(memcmp(&widened[i], &back, sizeof(back)) == 0);
+        // Within half an ulp of 11 bits (or the subnormal spacing).
+        assert(fabsf(back.y - f[i].y) <= fabsf(f[i].y) * 0x1p-11f);
+        assert(fabsf(back.z - f[i].z) <= 0x1p-25f);
+    }
+
+    // The fused kernel matches widen, transform, narrow.
+    mat4f_t M = mat4f_mul(mat4f_T(AXIS_Y, 0.3f), mat4f_T(AXIS_X, -1.2f));
+    M._14 = 2;
+    vec4h_t in[N], out[N];
+    vec4f_t points[N], transformed[N];
+    for (size_t i = 0; i < N; ++i) {
+        points[i] = vec4f((float)i, 1, -(float)(i % 11), 1);
+    }
+    vec4h_from_vec4f_array(points, in, N);
+    vec4h_to_vec4f_array(in, points, N);
+    mat4f_transform_array(&M, points, transformed, N);
+    mat4f_transform_array_h(&M, in, out, N);
+    for (size_t i = 0; i < N; ++i) {
+        vec4h_t expected = vec4h_from_vec4f(transformed[i]);
+        assert(memcmp(&out[i], &expected, sizeof(expected)) == 0);
+    }
+}
+
+int main(void) {
+    test_vec4f_layout();
+    test_vec4f_operations();
+    test_mat4f_mul();
+    test_mat4f_mul_vec();
+    test_pointer_variants();
+    test_array_reductions();
+    test_mat4f_transform_array();
+    test_vec3f_soa();
+    test_vec3f_soa_kernels();
+    test_vec3f_cross();
+    test_mat_transpose();
+    test_mat_det();
+    test_mat_inverse();
+    test_mat4f_inverse_affine();
+    test_mat_rect();
+    test_quatf();
+    test_fast_variants();
+    test_generic();
+    test_half();
+
+    printf("All tests passed!\n");
+    return 0;
+}
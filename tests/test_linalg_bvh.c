@@ -0,0 +1,263 @@
+#include <assert.h>
+#include <stdio.h>
+
+// Bin long ranges on the pool even for small test meshes, and split at the
+// median below the top levels, so both kinds of splits are checked.
+#define LINALG_BVH_PARALLEL_MIN 256
+#define LINALG_BVH_MAX_DEPTH 3
+#define LINALG_IMPLEMENTATION
+#include "../src/linalg_bvh.h"
+
+#define EPSILON 1e-5f
+
+static uint32_t rng_state = 12345;
+
+static float random_float(float min, float max) {
+    rng_state = rng_state * 1664525u + 1013904223u;
+    return min + (max - min) * (float)(rng_state >> 8) / (float)(1 << 24);
+}
+
+static vec3f_t random_vec3f(float min, float max) {
+    float x = random_float(min, max);
+    float y = random_float(min, max);
+    return vec3f(x, y, random_float(min, max));
+}
+
+// Small triangles scattered in a cube, over a large floor at y = -10.
+static void random_mesh(vec3f_t *vertices, size_t n) {
+    for (size_t i = 0; i < n - 2; ++i) {
+        vec3f_t center = random_vec3f(-10, 10);
+        for (size_t j = 0; j < 3; ++j) {
+            vertices[3 * i + j] = vec3f_add(center, random_vec3f(-0.5f, 0.5f));
+        }
+    }
+    vec3f_t floor[6] = {vec3f(-50, -10, -50), vec3f(50, -10, -50),
+                        vec3f(50, -10, 50),   vec3f(-50, -10, -50),
+                        vec3f(50, -10, 50),   vec3f(-50, -10, 50)};
+    for (size_t j = 0; j < 6; ++j) {
+        vertices[3 * (n - 2) + j] = floor[j];
+    }
+}
+
+static bool brute_force_intersect(const vec3f_t *vertices, size_t n,
+                                  linalg_bvh_ray_t ray, linalg_bvh_hit_t *hit) {
+    hit->t = ray.t_max;
+    hit->triangle = LINALG_BVH_NONE;
+    for (size_t i = 0; i < n; ++i) {
+        float t, u, v;
+        if (linalg_ray_triangle(ray.origin, ray.direction, vertices[3 * i],
+                                vertices[3 * i + 1], vertices[3 * i + 2], &t,
+                                &u, &v) &&
+            t >= 0 && t < hit->t) {
+            *hit = (linalg_bvh_hit_t){t, u, v, (uint32_t)i};
+        }
+    }
+    return hit->triangle != LINALG_BVH_NONE;
+}
+
+static float brute_force_distance2(const vec3f_t *vertices, size_t n,
+                                   vec3f_t p) {
+    float best = INFINITY;
+    for (size_t i = 0; i < n; ++i) {
+        vec3f_t q = linalg_closest_point_triangle(
+            p, vertices[3 * i], vertices[3 * i + 1], vertices[3 * i + 2]);
+        vec3f_t d = vec3f_sub(q, p);
+        best = MIN(best, vec3f_dot(d, d));
+    }
+    return best;
+}
+
+// Every triangle is in exactly one leaf, inside the bounds of the leaf.
+static void check_tree(const linalg_bvh_t *bvh) {
+    static bool seen[4096];
+    assert(bvh->num_triangles <= ARRAY_LEN(seen));
+    for (size_t i = 0; i < bvh->num_triangles; ++i) {
+        seen[i] = false;
+    }
+    size_t triangles = 0;
+    for (size_t i = 0; i < bvh->num_nodes; ++i) {
+        const linalg_bvh_node_t *node = &bvh->nodes[i];
+        for (size_t k = 0; k < LINALG_BVH_WIDTH; ++k) {
+            if (node->child[k] == LINALG_BVH_NONE) {
+                assert(node->min_x[k] > node->max_x[k]);
+                continue;
+            }
+            if (node->count[k] == 0) {
+                assert(node->child[k] > i && node->child[k] < bvh->num_nodes);
+                continue;
+            }
+            assert(node->count[k] <= LINALG_BVH_LEAF_SIZE);
+            for (uint32_t t = node->child[k];
+                 t < node->child[k] + node->count[k]; ++t) {
+                assert(!seen[bvh->indices[t]]);
+                seen[bvh->indices[t]] = true;
+                ++triangles;
+                for (size_t j = 0; j < 3; ++j) {
+                    vec3f_t v = bvh->vertices[3 * t + j];
+                    assert(v.x >= node->min_x[k] && v.x <= node->max_x[k]);
+                    assert(v.y >= node->min_y[k] && v.y <= node->max_y[k]);
+                    assert(v.z >= node->min_z[k] && v.z <= node->max_z[k]);
+                }
+            }
+        }
+    }
+    assert(triangles == bvh->num_triangles);
+}
+
+void test_triangle_primitives(void) {
+    vec3f_t a = vec3f(0, 0, 0), b = vec3f(1, 0, 0), c = vec3f(0, 1, 0);
+    float t, u, v;
+    assert(linalg_ray_triangle(vec3f(0.25f, 0.5f, 2), vec3f(0, 0, -1), a, b, c,
+                               &t, &u, &v));
+    assert(fabsf(t - 2) <= EPSILON && fabsf(u - 0.25f) <= EPSILON &&
+           fabsf(v - 0.5f) <= EPSILON);
+    assert(!linalg_ray_triangle(vec3f(1, 1, 2), vec3f(0, 0, -1), a, b, c, &t,
+                                &u, &v));
+    assert(!linalg_ray_triangle(vec3f(0.2f, 0.2f, 1), vec3f(1, 0, 0), a, b, c,
+                                &t, &u, &v));
+
+    // One point per Voronoi region: vertices, edges and the face.
+    assert(vec3f_eq(linalg_closest_point_triangle(vec3f(-1, -1, 1), a, b, c),
+                    a, EPSILON));
+    assert(vec3f_eq(linalg_closest_point_triangle(vec3f(2, -1, 0), a, b, c), b,
+                    EPSILON));
+    assert(vec3f_eq(linalg_closest_point_triangle(vec3f(-1, 3, 0), a, b, c), c,
+                    EPSILON));
+    assert(vec3f_eq(linalg_closest_point_triangle(vec3f(0.5f, -2, 1), a, b, c),
+                    vec3f(0.5f, 0, 0), EPSILON));
+    assert(vec3f_eq(linalg_closest_point_triangle(vec3f(-3, 0.5f, 0), a, b, c),
+                    vec3f(0, 0.5f, 0), EPSILON));
+    assert(vec3f_eq(linalg_closest_point_triangle(vec3f(1, 1, 0), a, b, c),
+                    vec3f(0.5f, 0.5f, 0), EPSILON));
+    assert(vec3f_eq(linalg_closest_point_triangle(vec3f(0.2f, 0.3f, -4), a, b,
+                                                  c),
+                    vec3f(0.2f, 0.3f, 0), EPSILON));
+}
+
+void test_bvh_select(void) {
+    enum { N = 257 };
+    static linalg_bvh_ref_t refs[N];
+    for (size_t nth = 0; nth < N; nth += 16) {
+        for (size_t i = 0; i < N; ++i) {
+            // Many equal centroids.
+            float y = (float)(int)random_float(0, 20);
+            refs[i] = (linalg_bvh_ref_t){.centroid = vec3f(0, y, 0),
+                                         .index = (uint32_t)i};
+        }
+        linalg_bvh_select(refs, 0, N, nth, 1);
+        float y = refs[nth].centroid.y;
+        for (size_t i = 0; i < N; ++i) {
+            assert(i < nth ? refs[i].centroid.y <= y
+                           : refs[i].centroid.y >= y);
+        }
+    }
+}
+
+void test_bvh_queries(void) {
+    enum { N = 3000 };
+    static vec3f_t vertices[3 * N];
+    random_mesh(vertices, N);
+
+    varia_arena_t arena = {0};
+    linalg_bvh_t bvh;
+    linalg_bvh_build(&bvh, &arena, NULL, vertices, N);
+    check_tree(&bvh);
+    assert(bvh.num_nodes < N);
+    assert(bvh.min.x == -50 && bvh.max.z == 50);
+
+    // The parallel build gives the same tree.
+    thread_pool_t pool;
+    assert(thread_pool_init(&pool, 4));
+    linalg_bvh_t parallel;
+    linalg_bvh_build(&parallel, &arena, &pool, vertices, N);
+    thread_pool_free(&pool);
+    assert(parallel.num_nodes == bvh.num_nodes);
+    assert(memcmp(parallel.nodes, bvh.nodes,
+                  bvh.num_nodes * sizeof(*bvh.nodes)) == 0);
+    assert(memcmp(parallel.indices, bvh.indices, N * sizeof(uint32_t)) == 0);
+
+    size_t hits = 0;
+    for (size_t i = 0; i < 500; ++i) {
+        linalg_bvh_ray_t ray = {
+            .origin = random_vec3f(-15, 15),
+            .direction = random_vec3f(-1, 1),
+            .t_max = i % 2 ? INFINITY : 10,
+        };
+        if (i % 10 == 0) {
+            ray.direction = vec3f(0, -1, 0); // Axis-aligned.
+        }
+        linalg_bvh_hit_t hit, expected = {0};
+        bool found = linalg_bvh_intersect(&bvh, ray, &hit);
+        assert(found == brute_force_intersect(vertices, N, ray, &expected));
+        if (found) {
+            assert(hit.triangle == expected.triangle && hit.t == expected.t);
+            assert(hit.u == expected.u && hit.v == expected.v);
+            ++hits;
+        }
+    }
+    assert(hits > 100 && hits < 500);
+
+    for (size_t i = 0; i < 200; ++i) {
+        vec3f_t p = random_vec3f(-20, 20);
+        float expected = brute_force_distance2(vertices, N, p);
+        linalg_bvh_closest_t closest;
+        assert(linalg_bvh_closest_point(&bvh, p, INFINITY, &closest));
+        assert(closest.distance2 == expected);
+        vec3f_t d = vec3f_sub(closest.point, p);
+        assert(fabsf(vec3f_dot(d, d) - expected) <= EPSILON * (1 + expected));
+        const vec3f_t *v = &vertices[3 * closest.triangle];
+        assert(vec3f_eq(linalg_closest_point_triangle(p, v[0], v[1], v[2]),
+                        closest.point, EPSILON));
+        // Nothing closer than the closest point.
+        float distance = sqrtf(expected);
+        assert(!linalg_bvh_closest_point(&bvh, p, 0.99f * distance, &closest));
+    }
+    varia_arena_free(&arena);
+}
+
+void test_bvh_degenerate(void) {
+    varia_arena_t arena = {0};
+    linalg_bvh_t bvh;
+    linalg_bvh_ray_t ray = {vec3f(0.1f, 0.1f, 5), vec3f(0, 0, -1), INFINITY};
+    linalg_bvh_hit_t hit;
+    linalg_bvh_closest_t closest;
+
+    linalg_bvh_build(&bvh, &arena, NULL, NULL, 0);
+    assert(!linalg_bvh_intersect(&bvh, ray, &hit));
+    assert(!linalg_bvh_closest_point(&bvh, vec3f(0, 0, 0), INFINITY,
+                                     &closest));
+
+    // Identical triangles: the centroids cannot be binned.
+    enum { N = 100 };
+    static vec3f_t vertices[3 * N];
+    for (size_t i = 0; i < N; ++i) {
+        vertices[3 * i] = vec3f(0, 0, (float)(i % 2));
+        vertices[3 * i + 1] = vec3f(1, 0, 0);
+        vertices[3 * i + 2] = vec3f(0, 1, (float)(i % 2) * -1);
+    }
+    linalg_bvh_build(&bvh, &arena, NULL, vertices, 1);
+    check_tree(&bvh);
+    assert(linalg_bvh_intersect(&bvh, ray, &hit) && hit.triangle == 0);
+    for (size_t i = 0; i < N; ++i) {
+        vertices[3 * i] = vec3f(0, 0, 0);
+        vertices[3 * i + 2] = vec3f(0, 1, 0);
+    }
+    linalg_bvh_build(&bvh, &arena, NULL, vertices, N);
+    check_tree(&bvh);
+    assert(linalg_bvh_intersect(&bvh, ray, &hit));
+    assert(fabsf(hit.t - 5) <= EPSILON);
+    assert(linalg_bvh_closest_point(&bvh, vec3f(0.1f, 0.1f, -2), INFINITY,
+                                    &closest));
+    assert(fabsf(closest.distance2 - 4) <= EPSILON);
+    varia_arena_free(&arena);
+}
+
+int main(void) {
+    test_triangle_primitives();
+    test_bvh_select();
+    test_bvh_queries();
+    test_bvh_degenerate();
+
+    printf("All tests passed!\n");
+    return 0;
+}
@@ -0,0 +1,112 @@
+#include <assert.h>
+#include <stdio.h>
+
+#define LINALG_IMPLEMENTATION
+#include "../src/linalg_cull.h"
+
+#define EPSILON 1e-5f
+
+// Perspective projection looking down -z (OpenGL clip space).
+static mat4f_t perspective(float near, float far) {
+    return (mat4f_t){.M = {{1, 0, 0, 0},
+                           {0, 1, 0, 0},
+                           {0, 0, (far + near) / (near - far),
+                            2 * far * near / (near - far)},
+                           {0, 0, -1, 0}}};
+}
+
+void test_frustum_planes(void) {
+    linalg_frustum_t frustum = linalg_frustum_from_mat4f(perspective(1, 100),
+                                                         false);
+    for (size_t i = 0; i < LINALG_FRUSTUM_PLANES; ++i) {
+        vec4f_t p = frustum.planes[i];
+        assert(fabsf(p.x * p.x + p.y * p.y + p.z * p.z - 1) <= EPSILON);
+    }
+    // The near and far planes are at z = -1 and z = -100.
+    assert(vec4f_eq(frustum.planes[4], vec4f(0, 0, -1, -1), EPSILON));
+    assert(vec4f_eq(frustum.planes[5], vec4f(0, 0, 1, 100), 1e-3f));
+
+    vec3f_t unit = vec3f(1, 1, 1);
+    assert(linalg_frustum_test_aabb(&frustum, vec3f(0, 0, -10), unit));
+    assert(!linalg_frustum_test_aabb(&frustum, vec3f(0, 0, 10), unit));
+    assert(!linalg_frustum_test_aabb(&frustum, vec3f(0, 0, -200), unit));
+    assert(!linalg_frustum_test_aabb(&frustum, vec3f(30, 0, -10), unit));
+    // Straddling the left plane (x = z).
+    assert(linalg_frustum_test_aabb(&frustum, vec3f(-10.5f, 0, -10), unit));
+    assert(linalg_frustum_test_sphere(&frustum, vec3f(0, 0, -0.5f), 1));
+    assert(!linalg_frustum_test_sphere(&frustum, vec3f(0, 0, 2), 1));
+
+    // With 0 <= z <= w, the same near plane comes from a different matrix.
+    mat4f_t M = perspective(1, 100);
+    M._33 = 100.0f / (1 - 100);
+    M._34 = 100.0f / (1 - 100);
+    linalg_frustum_t d3d = linalg_frustum_from_mat4f(M, true);
+    assert(vec4f_eq(d3d.planes[4], vec4f(0, 0, -1, -1), EPSILON));
+}
+
+void test_cull_batches(void) {
+    // The clip volume itself: the cube [-1, 1]^3. Coordinates are multiples
+    // of 1/8, so that both paths compute exactly and agree on every box.
+    linalg_frustum_t frustum = linalg_frustum_from_mat4f(mat4f_I(), false);
+    enum { N = 8 * 125 + 5 };
+    static float cx[N], cy[N], cz[N], ex[N], ey[N], ez[N], r[N];
+    static uint32_t visible[N];
+    for (size_t i = 0; i < N; ++i) {
+        cx[i] = (float)((i * 7) % 41) / 8 - 2.5f;
+        cy[i] = (float)((i * 13) % 37) / 8 - 2.25f;
+        cz[i] = (float)((i * 5) % 43) / 8 - 2.625f;
+        ex[i] = (float)(i % 5) / 8;
+        ey[i] = (float)(i % 3) / 8;
+        ez[i] = (float)(i % 7) / 8;
+        r[i] = (float)(i % 9) / 8;
+    }
+
+    linalg_aabb_soa_t boxes = {
+        .center = {.x = cx, .y = cy, .z = cz, .n = N},
+        .extent = {.x = ex, .y = ey, .z = ez, .n = N},
+    };
+    size_t count = linalg_cull_aabbs(&frustum, boxes, visible);
+    size_t expected = 0;
+    for (size_t i = 0; i < N; ++i) {
+        // Overlap of the box with the cube, one axis at a time.
+        bool overlaps = fabsf(cx[i]) - ex[i] <= 1 &&
+                        fabsf(cy[i]) - ey[i] <= 1 && fabsf(cz[i]) - ez[i] <= 1;
+        if (overlaps) {
+            assert(expected < count && visible[expected] == i);
+            ++expected;
+        }
+    }
+    assert(count == expected && count > 0 && count < N);
+
+    linalg_sphere_soa_t spheres = {
+        .center = {.x = cx, .y = cy, .z = cz, .n = N}, .radius = r};
+    count = linalg_cull_spheres(&frustum, spheres, visible);
+    expected = 0;
+    for (size_t i = 0; i < N; ++i) {
+        if (linalg_frustum_test_sphere(&frustum, vec3f(cx[i], cy[i], cz[i]),
+                                       r[i])) {
+            assert(expected < count && visible[expected] == i);
+            ++expected;
+        }
+    }
+    assert(count == expected && count > 0 && count < N);
+
+    // Empty batches and batches shorter than a SIMD iteration.
+    boxes.center.n = boxes.extent.n = 0;
+    assert(linalg_cull_aabbs(&frustum, boxes, visible) == 0);
+    boxes.center.n = boxes.extent.n = 3;
+    count = linalg_cull_aabbs(&frustum, boxes, visible);
+    for (size_t i = 0; i < count; ++i) {
+        assert(linalg_frustum_test_aabb(
+            &frustum, vec3f(cx[visible[i]], cy[visible[i]], cz[visible[i]]),
+            vec3f(ex[visible[i]], ey[visible[i]], ez[visible[i]])));
+    }
+}
+
+int main(void) {
+    test_frustum_planes();
+    test_cull_batches();
+
+    printf("All tests passed!\n");
+    return 0;
+}
@@ -0,0 +1,141 @@
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define LINALG_IMPLEMENTATION
+#include "../src/linalg_io.h"
+
+// Path of a fresh temporary file (removed by the caller).
+static void temp_path(char *path, size_t size) {
+    snprintf(path, size, "/tmp/test_linalg_io_XXXXXX");
+    int fd = mkstemp(path);
+    assert(fd >= 0);
+    close(fd);
+}
+
+void test_aos(void) {
+    char path[64];
+    temp_path(path, sizeof(path));
+    enum { N = 1000 };
+    static vec3f_t positions[N];
+    for (size_t i = 0; i < N; ++i) {
+        positions[i] = vec3f((float)i, -(float)i, 0.5f * (float)i);
+    }
+    assert(linalg_io_write_vec3f(path, positions, N));
+
+    linalg_io_file_t file;
+    assert(linalg_io_open(&file, path));
+    assert(file.header.count == N);
+    vec3f_t *loaded = linalg_io_vec3f(&file);
+    // Zero-copy: the elements are read straight from the mapping.
+    assert((char *)loaded == (char *)file.mapping + LINALG_IO_ALIGNMENT);
+    assert((uintptr_t)loaded % LINALG_IO_ALIGNMENT == 0);
+    assert(memcmp(loaded, positions, sizeof(positions)) == 0);
+    // Other element types are rejected.
+    assert(linalg_io_vec3d(&file) == NULL);
+    assert(linalg_io_vec4f(&file) == NULL);
+    assert(linalg_io_mat3f(&file) == NULL);
+    assert(linalg_io_vec3f_soa(&file).x == NULL);
+    // The mapping is private: changes are not written back.
+    loaded[0].x = 42;
+    linalg_io_close(&file);
+    assert(file.mapping == NULL);
+    assert(linalg_io_open(&file, path));
+    assert(linalg_io_vec3f(&file)[0].x == 0);
+    linalg_io_close(&file);
+
+    mat4f_t matrices[3] = {mat4f_I(), mat4f_T(AXIS_X, 0.5f),
+                           mat4f_T(AXIS_Z, -2)};
+    assert(linalg_io_write_mat4f(path, matrices, 3));
+    assert(linalg_io_open(&file, path));
+    assert(linalg_io_vec4f(&file) == NULL);
+    mat4f_t *loaded_matrices = linalg_io_mat4f(&file);
+    assert(file.header.count == 3);
+    assert(memcmp(loaded_matrices, matrices, sizeof(matrices)) == 0);
+    linalg_io_close(&file);
+
+    // Empty arrays are valid.
+    assert(linalg_io_write_vec2i(path, NULL, 0));
+    assert(linalg_io_open(&file, path));
+    assert(file.header.count == 0 && linalg_io_vec2i(&file) != NULL);
+    linalg_io_close(&file);
+    remove(path);
+}
+
+void test_soa(void) {
+    char path[64];
+    temp_path(path, sizeof(path));
+    enum { N = 37 };
+    double x[N], y[N], z[N];
+    for (size_t i = 0; i < N; ++i) {
+        x[i] = (double)i;
+        y[i] = 2.0 * (double)i;
+        z[i] = -(double)i;
+    }
+    vec3d_soa_t v = {.x = x, .y = y, .z = z, .n = N};
+    assert(linalg_io_write_vec3d_soa(path, v));
+
+    linalg_io_file_t file;
+    assert(linalg_io_open(&file, path));
+    assert(linalg_io_vec3d(&file) == NULL);
+    vec3d_soa_t loaded = linalg_io_vec3d_soa(&file);
+    assert(loaded.n == N);
+    // Every component starts on its own cache line.
+    assert((uintptr_t)loaded.x % LINALG_IO_ALIGNMENT == 0);
+    assert((uintptr_t)loaded.y % LINALG_IO_ALIGNMENT == 0);
+    assert((uintptr_t)loaded.z % LINALG_IO_ALIGNMENT == 0);
+    assert(memcmp(loaded.x, x, sizeof(x)) == 0);
+    assert(memcmp(loaded.y, y, sizeof(y)) == 0);
+    assert(memcmp(loaded.z, z, sizeof(z)) == 0);
+    linalg_io_close(&file);
+    remove(path);
+}
+
+void test_invalid(void) {
+    char path[64];
+    temp_path(path, sizeof(path));
+    linalg_io_file_t file;
+    // Empty file, and missing file.
+    assert(!linalg_io_open(&file, path));
+    assert(file.mapping == NULL);
+    assert(!linalg_io_open(&file, "/nonexistent/linalg_io"));
+
+    enum { N = 100 };
+    vec4u_t xs[N] = {0};
+    assert(linalg_io_write_vec4u(path, xs, N));
+    assert(linalg_io_open(&file, path));
+    linalg_io_close(&file);
+
+    // Truncated payload.
+    assert(truncate(path, LINALG_IO_ALIGNMENT + sizeof(xs) / 2) == 0);
+    assert(!linalg_io_open(&file, path));
+
+    // Corrupt magic.
+    assert(linalg_io_write_vec4u(path, xs, N));
+    FILE *stream = fopen(path, "r+b");
+    assert(stream != NULL);
+    assert(fputc('X', stream) == 'X');
+    assert(fclose(stream) == 0);
+    assert(!linalg_io_open(&file, path));
+
+    // Foreign byte order.
+    assert(linalg_io_write_vec4u(path, xs, N));
+    stream = fopen(path, "r+b");
+    assert(stream != NULL);
+    uint32_t swapped = __builtin_bswap32(LINALG_IO_BYTE_ORDER);
+    assert(fseek(stream, offsetof(linalg_io_header_t, byte_order),
+                 SEEK_SET) == 0);
+    assert(fwrite(&swapped, sizeof(swapped), 1, stream) == 1);
+    assert(fclose(stream) == 0);
+    assert(!linalg_io_open(&file, path));
+    remove(path);
+}
+
+int main(void) {
+    test_aos();
+    test_soa();
+    test_invalid();
+
+    printf("All tests passed!\n");
+    return 0;
+}
@@ -0,0 +1,108 @@
+#include <assert.h>
+#include <stdio.h>
+
+#include "../src/maths.h"
+
+#define ARRAY_LEN(xs) (sizeof(xs) / sizeof(xs[0]))
+#define EPSILON 1e-6f
+
+void test_sincosf_fast(void) {
+    for (float x = -100; x <= 100; x += 0.01f) {
+        float s, c;
+        sincosf_fast(x, &s, &c);
+        assert(fabs(s - sin(x)) < EPSILON);
+        assert(fabs(c - cos(x)) < EPSILON);
+    }
+}
+
+void test_rsqrtf_fast(void) {
+    for (float x = 1e-6f; x < 1e6f; x *= 1.01f) {
+        double expected = 1 / sqrt(x);
+        assert(fabs(rsqrtf_fast(x) - expected) < 5e-6 * expected);
+    }
+}
+
+void test_acosf_fast(void) {
+    for (float x = -1; x <= 1; x += 1e-4f) {
+        assert(fabs(acosf_fast(x) - acos(x)) < EPSILON);
+    }
+    assert(fabs(acosf_fast(1)) < EPSILON);
+    assert(fabs(acosf_fast(-1) - pi) < EPSILON);
+}
+
+void test_atan2f_fast(void) {
+    for (float angle = -3.14f; angle <= 3.14f; angle += 1e-3f) {
+        for (float radius = 1e-3f; radius < 1e3f; radius *= 10) {
+            float y = radius * sinf(angle), x = radius * cosf(angle);
+            assert(fabs(atan2f_fast(y, x) - atan2(y, x)) < EPSILON);
+        }
+    }
+    assert(atan2f_fast(0, 0) == 0);
+    assert(fabs(atan2f_fast(1, 0) - pi / 2) < EPSILON);
+    assert(fabs(atan2f_fast(0, -1) - pi) < EPSILON);
+}
+
+#if defined(__SSE2__)
+void test_fast_ps(void) {
+    const float xs[4] = {-7.5f, -0.3f, 0.9f, 42};
+    const float ys[4] = {0.5f, -2, 0, 3};
+    __m128 x = _mm_loadu_ps(xs);
+    float s[4], c[4], r[4], a[4], t[4];
+    __m128 s_ps, c_ps;
+    sincosf_fast_ps(x, &s_ps, &c_ps);
+    _mm_storeu_ps(s, s_ps);
+    _mm_storeu_ps(c, c_ps);
+    _mm_storeu_ps(r, rsqrtf_fast_ps(_mm_mul_ps(x, x)));
+    _mm_storeu_ps(a, acosf_fast_ps(_mm_mul_ps(x, _mm_set1_ps(1 / 42.0f))));
+    _mm_storeu_ps(t, atan2f_fast_ps(_mm_loadu_ps(ys), x));
+    for (size_t i = 0; i < 4; ++i) {
+        float sf, cf;
+        sincosf_fast(xs[i], &sf, &cf);
+        assert(fabsf(s[i] - sf) < EPSILON && fabsf(c[i] - cf) < EPSILON);
+        assert(fabsf(r[i] * fabsf(xs[i]) - 1) < 5e-6f);
+        assert(fabsf(a[i] - acosf_fast(xs[i] / 42)) < EPSILON);
+        assert(fabsf(t[i] - atan2f_fast(ys[i], xs[i])) < EPSILON);
+    }
+}
+#endif // __SSE2__
+
+#if defined(__AVX2__)
+void test_fast_ps256(void) {
+    const float xs[8] = {-7.5f, -0.3f, 0.9f, 42, 1e-3f, -1000, 3, 0};
+    const float ys[8] = {0.5f, -2, 0, 3, -1, 0, -0.25f, 0};
+    __m256 x = _mm256_loadu_ps(xs);
+    float s[8], c[8], r[8], a[8], t[8];
+    __m256 s_ps, c_ps;
+    sincosf_fast_ps256(x, &s_ps, &c_ps);
+    _mm256_storeu_ps(s, s_ps);
+    _mm256_storeu_ps(c, c_ps);
+    _mm256_storeu_ps(r, rsqrtf_fast_ps256(_mm256_mul_ps(x, x)));
+    _mm256_storeu_ps(
+        a, acosf_fast_ps256(_mm256_mul_ps(x, _mm256_set1_ps(1 / 1000.0f))));
+    _mm256_storeu_ps(t, atan2f_fast_ps256(_mm256_loadu_ps(ys), x));
+    for (size_t i = 0; i < 8; ++i) {
+        float sf, cf;
+        sincosf_fast(xs[i], &sf, &cf);
+        assert(fabsf(s[i] - sf) < EPSILON && fabsf(c[i] - cf) < EPSILON);
+        assert(xs[i] == 0 || fabsf(r[i] * fabsf(xs[i]) - 1) < 5e-6f);
+        assert(fabsf(a[i] - acosf_fast(xs[i] / 1000)) < EPSILON);
+        assert(fabsf(t[i] - atan2f_fast(ys[i], xs[i])) < EPSILON);
+    }
+}
+#endif // __AVX2__
+
+int main(void) {
+    test_sincosf_fast();
+    test_rsqrtf_fast();
+    test_acosf_fast();
+    test_atan2f_fast();
+#if defined(__SSE2__)
+    test_fast_ps();
+#endif // __SSE2__
+#if defined(__AVX2__)
+    test_fast_ps256();
+#endif // __AVX2__
+
+    printf("All tests passed!\n");
+    return 0;
+}
@@ -0,0 +1,250 @@
+#include <assert.h>
+#include <stdio.h>
+#include <unistd.h>
+
+#include "../src/str.h"
+
+// Long enough to go through the vectorized loops and their scalar tails.
+static const char text[] =
+    "  \t the quick brown fox jumps over the lazy dog, "
+    "then the quick brown fox naps under the lazy dog's tree. \r\n";
+
+void test_str_eq(void) {
+    str_t a = str_lit("hello, world");
+    str_t b = str_lit("hello, there");
+    assert(str_eq(a, a, a.size));
+    assert(!str_eq(a, b, a.size));
+    assert(str_eq(a, b, 7)); // Only the first 7 bytes are compared.
+    assert(!str_eq(a, str_lit("hello"), 5));
+
+    str_t long_a = str_lit(text);
+    u8 copy[sizeof(text)];
+    for (u64 i = 0; i < sizeof(text); ++i) {
+        copy[i] = text[i];
+    }
+    str_t long_b = str_from_parts(copy, long_a.size);
+    assert(str_eq(long_a, long_b, long_a.size));
+    copy[70] = '#';
+    assert(!str_eq(long_a, long_b, long_a.size));
+    copy[70] = text[70];
+    copy[long_a.size - 1] = '#';
+    assert(!str_eq(long_a, long_b, long_a.size));
+}
+
+void test_str_starts_with(void) {
+    assert(str_starts_with(str_lit("prefix_name"), str_lit("prefix")));
+    assert(!str_starts_with(str_lit("prefix_name"), str_lit("name")));
+    assert(!str_starts_with(str_lit("pre"), str_lit("prefix")));
+}
+
+void test_str_trim(void) {
+    str_t trimmed = str_trim(str_lit(text));
+    assert(trimmed.data[0] == 't');
+    assert(trimmed.data[trimmed.size - 1] == '.');
+    assert(trimmed.size == sizeof(text) - 1 - 4 - 3);
+
+    str_t blank =
+        str_trim(str_lit("  \t\n\v\f\r                             "));
+    assert(blank.size == 0);
+
+    str_t padded =
+        str_trim_right(str_lit("x                                 "));
+    assert(padded.size == 1 && padded.data[0] == 'x');
+    padded = str_trim_left(str_lit("                                    x"));
+    assert(padded.size == 1 && padded.data[0] == 'x');
+
+    // Exactly one 32 byte block, and one block plus a byte.
+    blank = str_trim(str_lit("  \t\n\v\f\r                         "));
+    assert(blank.size == 0);
+    padded = str_trim_right(str_lit("x                                "));
+    assert(padded.size == 1 && padded.data[0] == 'x');
+}
+
+void test_str_find_byte(void) {
+    str_t str = str_lit(text);
+    assert(str_find_byte(str, 't') == 4);
+    assert(str_find_byte(str, ',') == 47);
+    assert(str_find_byte(str, '\n') == str.size - 1);
+    assert(str_find_byte(str, '#') == STR_NOT_FOUND);
+    assert(str_find_byte(str_lit(""), 'a') == STR_NOT_FOUND);
+}
+
+void test_str_find(void) {
+    str_t str = str_lit(text);
+    assert(str_find(str, str_lit("quick")) == 8);
+    assert(str_find(str, str_lit("naps")) == 74);
+    assert(str_find(str, str_lit("tree. \r\n")) == str.size - 8);
+    assert(str_find(str, str_lit("lazy dog's")) == 89);
+    assert(str_find(str, str_lit("lazy cat")) == STR_NOT_FOUND);
+    assert(str_find(str, str_lit("")) == 0);
+    assert(str_find(str_lit("ab"), str_lit("abc")) == STR_NOT_FOUND);
+    assert(str_find(str_lit("aaab"), str_lit("ab")) == 2);
+}
+
+void test_str_count_byte(void) {
+    str_t str = str_lit(text);
+    assert(str_count_byte(str, 'o') == 7);
+    assert(str_count_byte(str, '\'') == 1);
+    assert(str_count_byte(str, '#') == 0);
+}
+
+static bool str_is(str_t str, const char *expected) {
+    return str_eq(str, str_from_cstr((const u8 *)expected), str.size);
+}
+
+void test_str_find_any(void) {
+    str_t str = str_lit(text);
+    assert(str_find_any(str, str_lit(",'")) == 47);
+    assert(str_find_any(str, str_lit("#$%&()*+-./:;<=>?@")) == str.size - 4);
+    assert(str_find_any(str, str_lit("#")) == STR_NOT_FOUND);
+    assert(str_find_any(str, str_lit("")) == STR_NOT_FOUND);
+}
+
+void test_str_split_iterator(void) {
+    str_split_t it = str_split(str_lit("a,bc,,d,"));
+    const char *expected[] = {"a", "bc", "", "d", ""};
+    str_t token;
+    u64 count = 0;
+    while (str_split_next_byte(&it, ',', &token)) {
+        assert(count < ARRAY_LEN(expected) && str_is(token, expected[count]));
+        ++count;
+    }
+    assert(count == ARRAY_LEN(expected));
+
+    it = str_split(str_lit(""));
+    assert(str_split_next_byte(&it, ',', &token) && token.size == 0);
+    assert(!str_split_next_byte(&it, ',', &token));
+}
+
+void test_str_split_arrays(void) {
+    varia_arena_t arena = {.block_size = 4096};
+    str_t str = str_lit(text);
+
+    str_array_t words = str_split_by_byte(&arena, str_trim(str), ' ');
+    assert(words.size == 20 && words.size <= words.capacity);
+    assert(str_is(words.elements[0], "the"));
+    assert(str_is(words.elements[8], "dog,"));
+    assert(str_is(words.elements[19], "tree."));
+    // Views into the input, not copies.
+    assert(words.elements[1].data == str.data + 8);
+
+    // More tokens than the initial capacity, to go through the growth path.
+    str_array_t fields = str_split_by_set(&arena, str, str_lit(" \t,'\r\n"));
+    u64 non_empty = 0;
+    for (u64 i = 0; i < fields.size; ++i) {
+        non_empty += fields.elements[i].size > 0;
+    }
+    assert(non_empty == 21);
+    assert(str_is(fields.elements[fields.size - 1], ""));
+
+    str_array_t lines = str_lines(&arena, str_lit("first\r\n\nthird\nlast"));
+    assert(lines.size == 4);
+    assert(str_is(lines.elements[0], "first"));
+    assert(lines.elements[1].size == 0);
+    assert(str_is(lines.elements[3], "last"));
+    assert(str_lines(&arena, str_lit("one\ntwo\n")).size == 2);
+    assert(str_lines(&arena, str_lit("")).size == 0);
+
+    varia_arena_free(&arena);
+}
+
+void test_str_hash(void) {
+    // Same bytes at every alignment and through every length path (empty,
+    // 1-3, 4-16, 17-48 and longer), all distinct.
+    u8 copy[sizeof(text) + 8];
+    u64 hashes[sizeof(text)];
+    for (u64 size = 0; size < sizeof(text); ++size) {
+        hashes[size] = str_hash(str_from_parts((const u8 *)text, size));
+        for (u64 offset = 1; offset < 8; ++offset) {
+            for (u64 i = 0; i < size; ++i) {
+                copy[offset + i] = text[i];
+            }
+            assert(str_hash(str_from_parts(copy + offset, size)) ==
+                   hashes[size]);
+        }
+        for (u64 other = 0; other < size; ++other) {
+            assert(hashes[other] != hashes[size]);
+        }
+    }
+    // Test vectors of the reference implementation.
+    assert(str_hash(str_lit("")) == 0x93228a4de0eec5a2);
+    assert(str_hash_seeded(str_lit("a"), 1) == 0xc5bac3db178713c4);
+    assert(str_hash_seeded(str_lit("abc"), 2) == 0xa97f2f7b1d9b3314);
+    assert(str_hash_seeded(str_lit("message digest"), 3) ==
+           0x786d1f1df3801df4);
+    // Single bit flips, and the seed.
+    str_t word = str_lit("identifier");
+    assert(str_hash(word) != str_hash(str_lit("identifies")));
+    assert(str_hash(word) != str_hash(str_lit("Identifier")));
+    assert(str_hash_seeded(word, 1) != str_hash(word));
+    assert(str_hash_seeded(word, 0) == str_hash(word));
+}
+
+void test_str_list(void) {
+    varia_arena_t arena = {.block_size = 4096};
+    str_list_t list = {0};
+    assert(str_list_flatten(&arena, &list).size == 0);
+
+    str_list_push(&arena, &list, str_lit("vec3f_t"));
+    str_list_pushf(&arena, &list, "v%d = {%g, %s}", 3, 0.5, "y");
+    str_list_push(&arena, &list, str_lit(""));
+    str_list_pushf(&arena, &list, "%s", ";");
+    assert(list.num_nodes == 4 && list.total_size == 21);
+    assert(list.first->next->next->next == list.last);
+
+    str_t flat = str_list_flatten(&arena, &list);
+    assert(str_is(flat, "vec3f_tv3 = {0.5, y};") && flat.size == 21);
+    str_t joined = str_list_join(&arena, &list, str_lit(", "));
+    assert(str_is(joined, "vec3f_t, v3 = {0.5, y}, , ;"));
+
+    // Formatted pieces larger than the arena blocks.
+    str_list_t big = {0};
+    str_list_pushf(&arena, &big, "%5000d", 7);
+    assert(big.total_size == 5000 && big.last->string.data[4999] == '7');
+
+    varia_arena_free(&arena);
+}
+
+void test_str_list_write(void) {
+    varia_arena_t arena = {0};
+    str_list_t list = {0};
+    // More pieces than a single writev() call takes.
+    for (u64 i = 0; i < 3 * STR_LIST_IOV_MAX + 5; ++i) {
+        str_list_pushf(&arena, &list, "%c", 'a' + (int)(i % 26));
+    }
+    int fds[2];
+    assert(pipe(fds) == 0);
+    assert(str_list_write(fds[1], &list));
+    close(fds[1]);
+
+    str_t expected = str_list_flatten(&arena, &list);
+    u8 *read_back = varia_arena_alloc(&arena, expected.size + 1);
+    u64 total = 0;
+    for (ssize_t n; (n = read(fds[0], read_back + total,
+                               expected.size + 1 - total)) > 0;) {
+        total += (u64)n;
+    }
+    close(fds[0]);
+    assert(total == expected.size);
+    assert(str_bytes_eq(read_back, expected.data, total));
+
+    varia_arena_free(&arena);
+}
+
+int main(void) {
+    test_str_eq();
+    test_str_starts_with();
+    test_str_trim();
+    test_str_find_byte();
+    test_str_find();
+    test_str_count_byte();
+    test_str_find_any();
+    test_str_split_iterator();
+    test_str_split_arrays();
+    test_str_hash();
+    test_str_list();
+    test_str_list_write();
+
+    printf("All tests passed!\n");
+    return 0;
+}
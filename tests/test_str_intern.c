@@ -0,0 +1,67 @@
+#include <assert.h>
+#include <stdio.h>
+
+#include "../src/str_intern.h"
+
+void test_str_intern_ids(void) {
+    varia_arena_t arena = {.block_size = 4096};
+    str_intern_t table = {.arena = &arena};
+    assert(str_intern_find(&table, str_lit("x")) == STR_ID_NONE);
+
+    str_id_t width = str_intern(&table, str_lit("width"));
+    str_id_t height = str_intern(&table, str_lit("height"));
+    str_id_t empty = str_intern(&table, str_lit(""));
+    assert(width == 0 && height == 1 && empty == 2); // Dense ids.
+
+    // Same bytes from another buffer: same id and same interned copy.
+    u8 buffer[] = "width";
+    str_id_t again = str_intern(&table, str_from_parts(buffer, 5));
+    assert(again == width);
+    str_t interned = str_intern_get(&table, width);
+    assert(interned.data != buffer && interned.size == 5);
+    assert(str_eq(interned, str_lit("width"), 5));
+    buffer[0] = 'W'; // The table keeps its own copy.
+    assert(str_intern_find(&table, str_lit("width")) == width);
+    assert(str_intern_find(&table, str_from_parts(buffer, 5)) == STR_ID_NONE);
+    assert(str_intern_find(&table, str_lit("")) == empty);
+    assert(table.count == 3);
+
+    varia_arena_free(&arena);
+}
+
+void test_str_intern_growth(void) {
+    varia_arena_t arena = {0};
+    str_intern_t table = {.arena = &arena};
+    enum { N = 20000 };
+    str_t first = {0};
+    for (u64 i = 0; i < N; ++i) {
+        char *name = varia_temp_sprintf("symbol_%llu", (unsigned long long)i);
+        str_id_t id = str_intern(&table, str_from_cstr((const u8 *)name));
+        assert(id == i);
+        if (i == 0) {
+            first = str_intern_get(&table, id);
+        }
+    }
+    assert(table.count == N && 8 * table.count <= 7 * table.capacity);
+    // Interned bytes do not move when the table grows.
+    assert(str_intern_get(&table, 0).data == first.data);
+    for (u64 i = 0; i < N; i += 7) {
+        char *name = varia_temp_sprintf("symbol_%llu", (unsigned long long)i);
+        str_t str = str_from_cstr((const u8 *)name);
+        assert(str_intern_find(&table, str) == i);
+        assert(str_intern(&table, str) == i);
+    }
+    assert(str_intern_find(&table, str_lit("symbol_")) == STR_ID_NONE);
+    assert(table.count == N);
+
+    varia_arena_free(&arena);
+    varia_arena_free(&varia_temp_arena);
+}
+
+int main(void) {
+    test_str_intern_ids();
+    test_str_intern_growth();
+
+    printf("All tests passed!\n");
+    return 0;
+}
@@ -0,0 +1,121 @@
+#include <assert.h>
+#include <stdio.h>
+
+#define LINALG_IMPLEMENTATION
+#include "../src/linalg_parallel.h"
+#include "../src/thread_pool.h"
+
+#define EPSILON 1e-6f
+
+typedef struct {
+    _Atomic unsigned *visits;
+    size_t grain;
+    _Atomic size_t chunks;
+} visit_ctx_t;
+
+static void visit(void *ctx, size_t begin, size_t end,
+                  varia_arena_t *scratch) {
+    visit_ctx_t *c = ctx;
+    assert(begin < end && end - begin <= c->grain);
+    assert(begin % c->grain == 0); // Chunks are aligned with the grain.
+    // The scratch arena is private to the worker and rewound after the chunk.
+    assert(varia_arena_used(scratch) == 0);
+    unsigned char *tmp = varia_arena_alloc(scratch, end - begin);
+    for (size_t i = begin; i < end; ++i) {
+        tmp[i - begin] = 1;
+        atomic_fetch_add(&c->visits[i], tmp[i - begin]);
+    }
+    atomic_fetch_add(&c->chunks, 1);
+}
+
+void test_parallel_for(void) {
+    static _Atomic unsigned visits[100003];
+    size_t threads[] = {1, 2, 4, 7};
+    size_t grains[] = {1, 16, 1000, 200000};
+    size_t sizes[] = {0, 1, 999, 1000, 1001, ARRAY_LEN(visits)};
+    for (size_t t = 0; t < ARRAY_LEN(threads); ++t) {
+        thread_pool_t pool;
+        assert(thread_pool_init(&pool, threads[t]));
+        assert(pool.num_workers == threads[t]);
+        for (size_t g = 0; g < ARRAY_LEN(grains); ++g) {
+            for (size_t s = 0; s < ARRAY_LEN(sizes); ++s) {
+                size_t n = sizes[s];
+                for (size_t i = 0; i < n; ++i) {
+                    visits[i] = 0;
+                }
+                visit_ctx_t ctx = {.visits = visits, .grain = grains[g]};
+                thread_pool_parallel_for(&pool, n, grains[g], visit, &ctx);
+                for (size_t i = 0; i < n; ++i) {
+                    assert(visits[i] == 1);
+                }
+                assert(ctx.chunks == (n + grains[g] - 1) / grains[g]);
+            }
+        }
+        thread_pool_free(&pool);
+    }
+}
+
+void test_init_failure(void) {
+    // Too many workers to allocate: nothing is left to free.
+    thread_pool_t pool;
+    assert(!thread_pool_init(&pool, (size_t)1 << 50));
+    assert(pool.workers == NULL && pool.num_workers == 0);
+}
+
+void test_parallel_kernels(void) {
+    thread_pool_t pool;
+    assert(thread_pool_init(&pool, 4));
+    // Several chunks, plus a tail shorter than a SIMD iteration.
+    enum { N = 3 * 8192 + 3 };
+    static vec4f_t in[N], out[N], expected[N];
+    static float x[N], y[N], z[N], ux[N], uy[N], uz[N], dots[N];
+    static float mx[N], my[N], mz[N], ex[N], ey[N], ez[N];
+    for (size_t i = 0; i < N; ++i) {
+        in[i] = vec4f((float)i, 1, -(float)(i % 7), 1);
+        x[i] = (float)(i % 13) + 1;
+        y[i] = -(float)(i % 5);
+        z[i] = 0.5f * (float)i;
+    }
+
+    mat4f_t M = mat4f_mul(mat4f_T(AXIS_Y, 0.3f), mat4f_T(AXIS_Z, -1.1f));
+    M._14 = 3; // Translation.
+    mat4f_transform_array(&M, in, expected, N);
+    mat4f_transform_array_parallel(&pool, &M, in, out, N);
+    for (size_t i = 0; i < N; ++i) {
+        assert(vec4f_eq(out[i], expected[i], EPSILON));
+    }
+
+    vec3f_soa_t v = {.x = x, .y = y, .z = z, .n = N};
+    vec3f_soa_t u = {.x = ux, .y = uy, .z = uz, .n = N};
+    vec3f_soa_unit_parallel(&pool, u, v);
+    vec3f_soa_dot_parallel(&pool, dots, u, v);
+    for (size_t i = 0; i < N; ++i) {
+        vec3f_t unit = vec3f_unit(vec3f(x[i], y[i], z[i]));
+        assert(vec3f_eq(vec3f(ux[i], uy[i], uz[i]), unit, EPSILON));
+        float length = vec3f_2norm(vec3f(x[i], y[i], z[i]));
+        assert(fabsf(dots[i] - length) <= 1e-5f * length);
+    }
+
+    // The chunks of 3D vectors do not divide N either.
+    assert(N % linalg_parallel_grain(6 * sizeof(float)) != 0);
+    mat3f_t R = mat3f_mul(mat3f_R(AXIS_X, 0.7f), mat3f_R(AXIS_Y, -0.2f));
+    R._13 = 2; // Not a rotation.
+    vec3f_soa_t m = {.x = mx, .y = my, .z = mz, .n = N};
+    vec3f_soa_t e = {.x = ex, .y = ey, .z = ez, .n = N};
+    mat3f_mul_vec_soa(e, R, v);
+    mat3f_mul_vec_soa_parallel(&pool, m, R, v);
+    for (size_t i = 0; i < N; ++i) {
+        // Chunks start on multiples of the SIMD width: same operations.
+        assert(mx[i] == ex[i] && my[i] == ey[i] && mz[i] == ez[i]);
+    }
+    thread_pool_free(&pool);
+}
+
+int main(void) {
+    test_parallel_for();
+    test_init_failure();
+    test_parallel_kernels();
+
+    printf("All tests passed!\n");
+    return 0;
+}
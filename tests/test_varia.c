@@ -0,0 +1,102 @@
+#include <assert.h>
+#include <pthread.h>
+#include <stdio.h>
+
+#include "../src/varia.h"
+
+void test_arena_alignment(void) {
+    varia_arena_t arena = {.block_size = 4096};
+    for (size_t alignment = 1; alignment <= 64; alignment *= 2) {
+        varia_arena_alloc(&arena, 3); // Misalign the next allocation.
+        void *ptr = varia_arena_alloc_aligned(&arena, 24, alignment);
+        assert(ptr != NULL);
+        assert((uintptr_t)ptr % alignment == 0);
+    }
+    varia_arena_free(&arena);
+    assert(arena.current == NULL);
+}
+
+void test_arena_growth(void) {
+    varia_arena_t arena = {.block_size = 1024};
+    char *first = varia_arena_alloc(&arena, 1000);
+    char *second = varia_arena_alloc(&arena, 1000); // Does not fit: new block.
+    char *oversized = varia_arena_alloc(&arena, 10000);
+    assert(first != NULL && second != NULL && oversized != NULL);
+    first[999] = second[999] = oversized[9999] = 'x';
+    assert(varia_arena_used(&arena) == 12000);
+    assert(varia_arena_capacity(&arena) >= 12000);
+
+    varia_arena_reset(&arena);
+    assert(varia_arena_used(&arena) == 0);
+    assert(arena.current != NULL && arena.current->prev == NULL);
+    varia_arena_free(&arena);
+}
+
+void test_arena_marks(void) {
+    varia_arena_t arena = {.block_size = 256};
+    char *persistent = varia_arena_alloc(&arena, 64);
+    varia_arena_mark_t mark = varia_arena_mark(&arena);
+    for (size_t i = 0; i < 16; ++i) {
+        assert(varia_arena_alloc(&arena, 200) != NULL);
+    }
+    varia_arena_restore(&arena, mark);
+    assert(varia_arena_used(&arena) == 64);
+    assert(varia_arena_alloc(&arena, 8) == persistent + 64);
+    varia_arena_free(&arena);
+}
+
+void test_strdup(void) {
+    varia_arena_mark_t mark = varia_temp_mark();
+    char *copy = varia_strdup("hello");
+    assert(varia_strlen(copy) == 5 && copy[4] == 'o' && copy[5] == '\0');
+    varia_temp_restore(mark);
+}
+
+void test_arena_sprintf(void) {
+    varia_arena_t arena = {.block_size = 64};
+    char *first = varia_arena_sprintf(&arena, "%s-%d", "block", 1);
+    char *second = varia_arena_sprintf(&arena, "%d", 42);
+    assert(first[0] == 'b' && first[7] == '\0');
+    assert(second == first + 8); // Formatted in place, right after.
+    // Does not fit in the current block.
+    char *long_text = varia_arena_sprintf(&arena, "%100d", 5);
+    assert(long_text[99] == '5' && long_text[100] == '\0');
+    assert(second[0] == '4' && second[2] == '\0');
+    varia_arena_free(&arena);
+}
+
+static void *format_on_worker(void *arg) {
+    size_t id = (size_t)arg;
+    for (size_t i = 0; i < 1000; ++i) {
+        char *s = varia_temp_sprintf("worker %zu: %zu", id, i);
+        char expected[64];
+        snprintf(expected, sizeof(expected), "worker %zu: %zu", id, i);
+        for (size_t c = 0; expected[c] != '\0'; ++c) {
+            assert(s[c] == expected[c]);
+        }
+    }
+    varia_arena_free(&varia_temp_arena);
+    return NULL;
+}
+
+void test_temp_arena_threads(void) {
+    pthread_t threads[4];
+    for (size_t i = 0; i < ARRAY_LEN(threads); ++i) {
+        pthread_create(&threads[i], NULL, format_on_worker, (void *)i);
+    }
+    for (size_t i = 0; i < ARRAY_LEN(threads); ++i) {
+        pthread_join(threads[i], NULL);
+    }
+}
+
+int main(void) {
+    test_arena_alignment();
+    test_arena_growth();
+    test_arena_marks();
+    test_strdup();
+    test_arena_sprintf();
+    test_temp_arena_threads();
+
+    printf("All tests passed!\n");
+    return 0;
+}